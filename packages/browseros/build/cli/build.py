@@ -54,6 +54,7 @@ from ..modules.sign.sparkle import SparkleSignModule
 from ..modules.package.macos import MacOSPackageModule
 from ..modules.package.windows import WindowsPackageModule
 from ..modules.package.linux import LinuxPackageModule
+from ..modules.package.sparkle_delta import SparkleDeltaModule
 
 AVAILABLE_MODULES = {
     # Setup & Environment
@@ -81,6 +82,7 @@ AVAILABLE_MODULES = {
     "package_macos": MacOSPackageModule,
     "package_windows": WindowsPackageModule,
     "package_linux": LinuxPackageModule,
+    "sparkle_delta": SparkleDeltaModule,  # macOS Sparkle binary deltas
     # Storage (upload/download)
     "upload": UploadModule,
 }
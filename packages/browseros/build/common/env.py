@@ -175,6 +175,11 @@ class EnvConfig:
         """Path to Sparkle sign_update tool (overrides auto-detection)"""
         return os.environ.get("SPARKLE_SIGN_UPDATE_PATH")
 
+    @property
+    def sparkle_binary_delta_path(self) -> Optional[str]:
+        """Path to Sparkle BinaryDelta tool (overrides the sparkle_setup copy)"""
+        return os.environ.get("SPARKLE_BINARY_DELTA_PATH")
+
     # === Notifications ===
 
     @property
@@ -34,6 +34,7 @@ This module internally runs (for EACH architecture):
     - compile (ninja build)
     - sign_macos (code signing + notarization)
     - package_macos (DMG creation)
+    - sparkle_delta (binary deltas from previous releases, when configured)
     - upload (artifact upload)
 
 Then merges and processes the universal binary.
@@ -160,6 +161,9 @@ class UniversalBuildModule(CommandModule):
             MacOSPackageModule().execute(arch_ctx)
             log_success(f"✅ {arch} packaging complete")
 
+            # === DELTA PHASE ===
+            self._create_sparkle_deltas(arch_ctx)
+
             # === UPLOAD PHASE ===
             log_info(f"\n☁️  Uploading {arch} artifacts...")
             try:
@@ -199,6 +203,8 @@ class UniversalBuildModule(CommandModule):
         MacOSPackageModule().execute(universal_ctx)
         log_success("✅ Universal packaging complete")
 
+        self._create_sparkle_deltas(universal_ctx)
+
         # Upload universal
         log_info("\n☁️  Uploading universal artifacts...")
         try:
@@ -221,6 +227,29 @@ class UniversalBuildModule(CommandModule):
         )
         log_info("=" * 70)
 
+    def _create_sparkle_deltas(self, ctx: Context) -> None:
+        """Create Sparkle deltas from previous releases, if configured
+
+        Deltas only save download size, so a failure leaves the DMG as the
+        update and doesn't stop the build.
+
+        Args:
+            ctx: Context of the architecture just packaged
+        """
+        from ..package.sparkle_delta import SparkleDeltaModule
+
+        module = SparkleDeltaModule()
+        try:
+            module.validate(ctx)
+        except ValidationError as e:
+            log_info(f"Skipping Sparkle deltas for {ctx.architecture}: {e}")
+            return
+
+        try:
+            module.execute(ctx)
+        except Exception as e:
+            log_warning(f"⚠️  {ctx.architecture} Sparkle deltas failed (non-fatal): {e}")
+
     def _clean_build_directories(self, ctx: Context) -> None:
         """Clean architecture-specific and universal build directories
 
@@ -1,7 +1,9 @@
 #!/usr/bin/env python3
 """Bundled Extensions Module - Download and bundle extensions from CDN manifest"""
 
+import hashlib
 import json
+import struct
 import sys
 import xml.etree.ElementTree as ET
 from pathlib import Path
@@ -14,11 +16,24 @@ from ...common.module import CommandModule, ValidationError
 from ...common.utils import log_info, log_success, log_error
 
 
+# CRX3 files start with this magic followed by a little-endian version
+CRX_MAGIC = b"Cr24"
+CRX_VERSION = 3
+
+
 class ExtensionInfo(NamedTuple):
     """Extension metadata parsed from update manifest"""
     id: str
     version: str
     codebase: str
+    hash_sha256: str = ""
+
+
+class BundledCrx(NamedTuple):
+    """A downloaded CRX that passed build-time validation"""
+    info: ExtensionInfo
+    sha256: str
+    size: int
 
 
 class BundledExtensionsModule(CommandModule):
@@ -49,10 +64,12 @@ class BundledExtensionsModule(CommandModule):
 
         log_info(f"  Found {len(extensions)} extensions in manifest")
 
+        bundled = []
         for ext in extensions:
             self._download_extension(ext, output_dir)
+            bundled.append(self._validate_crx(ext, output_dir))
 
-        self._generate_json(extensions, output_dir)
+        self._generate_json(bundled, output_dir)
 
         log_success(f"Bundled {len(extensions)} extensions successfully")
 
@@ -78,7 +95,8 @@ class BundledExtensionsModule(CommandModule):
         Expected format (with namespace):
         <gupdate xmlns="http://www.google.com/update2/response" protocol='2.0'>
           <app appid='extension_id'>
-            <updatecheck codebase='https://...' version='1.0.0' />
+            <updatecheck codebase='https://...' version='1.0.0'
+                         hash_sha256='...' />
           </app>
         </gupdate>
         """
@@ -115,6 +133,7 @@ class BundledExtensionsModule(CommandModule):
                     id=app_id,
                     version=version,
                     codebase=codebase,
+                    hash_sha256=(updatecheck.get("hash_sha256") or "").lower(),
                 ))
 
         return extensions
@@ -153,15 +172,43 @@ class BundledExtensionsModule(CommandModule):
         except requests.RequestException as e:
             raise RuntimeError(f"Failed to download {ext.id}: {e}")
 
-    def _generate_json(self, extensions: List[ExtensionInfo], output_dir: Path) -> None:
+    def _validate_crx(self, ext: ExtensionInfo, output_dir: Path) -> BundledCrx:
+        """Check a downloaded .crx is a CRX3 matching the manifest hash
+
+        The browser trusts the size and hash recorded here, so a bad download
+        fails the build instead of a first-run install.
+        """
+        crx_path = output_dir / f"{ext.id}.crx"
+        data = crx_path.read_bytes()
+
+        if len(data) < 12 or data[:4] != CRX_MAGIC:
+            raise RuntimeError(f"{crx_path.name} is not a CRX file")
+        (crx_version,) = struct.unpack("<I", data[4:8])
+        if crx_version != CRX_VERSION:
+            raise RuntimeError(
+                f"{crx_path.name} is CRX{crx_version}, expected CRX{CRX_VERSION}"
+            )
+
+        sha256 = hashlib.sha256(data).hexdigest()
+        if ext.hash_sha256 and ext.hash_sha256 != sha256:
+            raise RuntimeError(
+                f"{crx_path.name} hash mismatch: manifest {ext.hash_sha256}, "
+                f"downloaded {sha256}"
+            )
+
+        return BundledCrx(info=ext, sha256=sha256, size=len(data))
+
+    def _generate_json(self, bundled: List[BundledCrx], output_dir: Path) -> None:
         """Generate bundled_extensions.json"""
         json_path = output_dir / "bundled_extensions.json"
 
-        data: Dict[str, Dict[str, str]] = {}
-        for ext in extensions:
-            data[ext.id] = {
-                "external_crx": f"{ext.id}.crx",
-                "external_version": ext.version,
+        data: Dict[str, Dict[str, object]] = {}
+        for crx in bundled:
+            data[crx.info.id] = {
+                "external_crx": f"{crx.info.id}.crx",
+                "external_version": crx.info.version,
+                "sha256": crx.sha256,
+                "size": crx.size,
             }
 
         with open(json_path, "w") as f:
@@ -1,6 +1,7 @@
 #!/usr/bin/env python3
 """Common utilities for OTA update modules"""
 
+import json
 import os
 import re
 import shutil
@@ -228,13 +229,19 @@ def generate_server_appcast(
 def create_server_zip(
     binary_path: Path,
     output_zip: Path,
+    version: str,
     is_windows: bool = False,
 ) -> bool:
     """Create zip with proper structure: resources/bin/browseros_server
 
+    Next to bin/, resources/server_manifest.json records the version, like
+    the manifest bundled with the browser. The zip signature covers it, so
+    the browser trusts it instead of running the binary with --version.
+
     Args:
         binary_path: Path to the binary to package
         output_zip: Path for output zip file
+        version: Server version the binary reports
         is_windows: Whether this is Windows binary (affects target name)
 
     Returns:
@@ -249,6 +256,9 @@ def create_server_zip(
         target_name = "browseros_server.exe" if is_windows else "browseros_server"
         shutil.copy2(binary_path, bin_dir / target_name)
 
+        manifest_path = staging_dir / "resources" / "server_manifest.json"
+        manifest_path.write_text(json.dumps({"version": version}) + "\n")
+
         with zipfile.ZipFile(output_zip, 'w', zipfile.ZIP_DEFLATED) as zf:
             for root, _, files in os.walk(staging_dir):
                 for file in files:
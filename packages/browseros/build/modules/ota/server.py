@@ -142,7 +142,9 @@ class ServerOTAModule(CommandModule):
             zip_path = temp_dir / zip_name
             is_windows = platform["os"] == "windows"
 
-            if not create_server_zip(temp_binary, zip_path, is_windows):
+            if not create_server_zip(
+                temp_binary, zip_path, self.version, is_windows
+            ):
                 log_error(f"Failed to create zip for {platform['name']}")
                 continue
 
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""Sparkle binary delta module for macOS auto-update
+
+Builds Sparkle binary deltas from the last few releases to the app just
+built, so users on those releases download a patch instead of the full DMG.
+Old apps are taken from their release DMGs on R2. Deltas are signed with the
+Sparkle key and attached to the DMG's release.json entry by the upload
+module; the appcast lists them under <sparkle:deltas>.
+
+Sparkle checks a delta against the installed app before applying it and
+falls back to the full update when it doesn't match, so a missing or stale
+delta only costs the full download.
+"""
+
+import tempfile
+from pathlib import Path
+from typing import Dict, List, Optional
+
+from ...common.context import Context
+from ...common.module import CommandModule, ValidationError
+from ...common.sparkle import sparkle_sign_file
+from ...common.utils import (
+    log_info,
+    log_success,
+    log_warning,
+    run_command,
+    IS_MACOS,
+)
+from ..storage import (
+    BOTO3_AVAILABLE,
+    get_r2_client,
+    download_file_from_r2,
+    get_release_json,
+)
+
+# Releases to build deltas from, newest first. Users further behind get the
+# full update.
+SPARKLE_DELTA_FROM_VERSIONS = 3
+
+
+class SparkleDeltaModule(CommandModule):
+    """Create signed Sparkle binary deltas from previous releases"""
+
+    produces = ["sparkle_deltas"]
+    requires = []
+    description = "Create Sparkle binary deltas from previous macOS releases"
+
+    def validate(self, ctx: Context) -> None:
+        if not IS_MACOS():
+            raise ValidationError("Sparkle deltas require macOS")
+
+        if not BOTO3_AVAILABLE:
+            raise ValidationError(
+                "boto3 library not installed - run: pip install boto3"
+            )
+
+        if not ctx.env.has_r2_config():
+            raise ValidationError("R2 configuration not set")
+
+        if not ctx.env.has_sparkle_key():
+            raise ValidationError(
+                "SPARKLE_PRIVATE_KEY environment variable not set"
+            )
+
+        if not get_binary_delta_tool(ctx).exists():
+            raise ValidationError(
+                f"Sparkle BinaryDelta not found: {get_binary_delta_tool(ctx)} "
+                "(run sparkle_setup or set SPARKLE_BINARY_DELTA_PATH)"
+            )
+
+        app_path = ctx.get_app_path()
+        if not app_path.exists():
+            raise ValidationError(f"App not found: {app_path}")
+
+    def execute(self, ctx: Context) -> None:
+        log_info(f"\n🧩 Creating Sparkle deltas for {ctx.architecture}...")
+
+        dmg_name = ctx.get_artifact_name("dmg")
+        deltas = create_sparkle_deltas(ctx, dmg_name)
+
+        # Keyed by DMG like sparkle_signatures, for the upload module
+        all_deltas = ctx.artifacts.setdefault("sparkle_deltas", {})
+        all_deltas[dmg_name] = deltas
+
+        log_success(f"✅ Created {len(deltas)} Sparkle delta(s) for {dmg_name}")
+
+
+def get_binary_delta_tool(ctx: Context) -> Path:
+    """Path to Sparkle's BinaryDelta, from the env or the Sparkle download"""
+    override = ctx.env.sparkle_binary_delta_path
+    if override:
+        return Path(override)
+    return ctx.get_sparkle_dir() / "bin" / "BinaryDelta"
+
+
+def create_sparkle_deltas(ctx: Context, dmg_name: str) -> List[Dict]:
+    """Create and sign deltas from the previous releases to ctx's app
+
+    Args:
+        ctx: Build context of the architecture being released
+        dmg_name: Filename of the DMG the deltas belong to
+
+    Returns:
+        List of delta dicts with filename, delta_from, sparkle_signature and
+        sparkle_length. Releases without a usable DMG are skipped.
+    """
+    from ..release.common import list_all_versions
+
+    current = ctx.get_semantic_version()
+    previous = [v for v in list_all_versions(ctx.env) if v != current]
+    previous = previous[:SPARKLE_DELTA_FROM_VERSIONS]
+    if not previous:
+        log_info("No previous releases to create deltas from")
+        return []
+
+    client = get_r2_client(ctx.env)
+    if not client:
+        log_warning("Failed to create R2 client, skipping deltas")
+        return []
+
+    deltas = []
+    for version in previous:
+        delta = _create_delta_from(ctx, client, version, dmg_name)
+        if delta:
+            deltas.append(delta)
+    return deltas
+
+
+def _create_delta_from(
+    ctx: Context,
+    client,
+    version: str,
+    dmg_name: str,
+) -> Optional[Dict]:
+    release = get_release_json(version, "macos", ctx.env)
+    if not release:
+        log_warning(f"No macOS release.json for {version}, skipping delta")
+        return None
+
+    artifact = release.get("artifacts", {}).get(ctx.architecture)
+    from_version = release.get("sparkle_version")
+    if not artifact or not from_version:
+        log_warning(f"No {ctx.architecture} DMG in {version}, skipping delta")
+        return None
+
+    delta_name = f"{Path(dmg_name).stem}_from_{from_version}.delta"
+    delta_path = ctx.get_dist_dir() / delta_name
+
+    with tempfile.TemporaryDirectory(prefix="browseros_delta_") as tmp:
+        old_dmg = Path(tmp) / artifact["filename"]
+        # Same layout as Context.get_release_path
+        r2_key = f"releases/{version}/macos/{artifact['filename']}"
+        log_info(f"📥 Downloading {version} DMG...")
+        if not download_file_from_r2(client, r2_key, old_dmg, ctx.env.r2_bucket):
+            log_warning(f"Failed to download {r2_key}, skipping delta")
+            return None
+
+        mount_point = Path(tmp) / "mount"
+        mount_point.mkdir()
+        try:
+            run_command(
+                [
+                    "hdiutil",
+                    "attach",
+                    "-nobrowse",
+                    "-readonly",
+                    "-noautoopen",
+                    "-mountpoint",
+                    str(mount_point),
+                    str(old_dmg),
+                ]
+            )
+        except Exception as e:
+            log_warning(f"Failed to mount {old_dmg.name}: {e}")
+            return None
+
+        try:
+            old_app = mount_point / ctx.BROWSEROS_APP_NAME
+            log_info(f"🧩 Creating delta {from_version} -> {ctx.get_sparkle_version()}...")
+            run_command(
+                [
+                    str(get_binary_delta_tool(ctx)),
+                    "create",
+                    str(old_app),
+                    str(ctx.get_app_path()),
+                    str(delta_path),
+                ]
+            )
+        except Exception as e:
+            log_warning(f"Failed to create delta from {version}: {e}")
+            return None
+        finally:
+            run_command(["hdiutil", "detach", "-force", str(mount_point)], check=False)
+
+    sig, length = sparkle_sign_file(delta_path, ctx.env)
+    if not sig:
+        log_warning(f"Failed to sign {delta_name}, skipping delta")
+        delta_path.unlink(missing_ok=True)
+        return None
+
+    log_success(f"✓ {delta_name} ({length} bytes)")
+    return {
+        "filename": delta_name,
+        "delta_from": from_version,
+        "sparkle_signature": sig,
+        "sparkle_length": length,
+    }
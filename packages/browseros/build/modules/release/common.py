@@ -130,6 +130,22 @@ def generate_appcast_item(
     signature = artifact.get("sparkle_signature", "")
     length = artifact.get("sparkle_length", artifact.get("size", 0))
 
+    deltas = ""
+    if artifact.get("deltas"):
+        enclosures = "".join(
+            f"""
+    <enclosure
+      url="{delta['url']}"
+      sparkle:deltaFrom="{delta['delta_from']}"
+      sparkle:edSignature="{delta['sparkle_signature']}"
+      length="{delta['sparkle_length']}"
+      type="application/octet-stream" />"""
+            for delta in artifact["deltas"]
+        )
+        deltas = f"""
+  <sparkle:deltas>{enclosures}
+  </sparkle:deltas>"""
+
     return f"""<item>
   <title>BrowserOS - {version}</title>
   <description sparkle:format="plain-text">
@@ -142,7 +158,7 @@ def generate_appcast_item(
     url="{artifact['url']}"
     sparkle:edSignature="{signature}"
     length="{length}"
-    type="application/octet-stream" />
+    type="application/octet-stream" />{deltas}
   <sparkle:minimumSystemVersion>10.15</sparkle:minimumSystemVersion>
 </item>"""
 
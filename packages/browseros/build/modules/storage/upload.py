@@ -66,6 +66,13 @@ class UploadModule(CommandModule):
                     "sparkle_length": length,
                 }
 
+        # Deltas go in their DMG's entry, for the appcast's <sparkle:deltas>
+        sparkle_deltas = ctx.artifacts.get("sparkle_deltas")
+        if sparkle_deltas:
+            for filename, deltas in sparkle_deltas.items():
+                if deltas:
+                    extra_metadata.setdefault(filename, {})["deltas"] = deltas
+
         success, release_json = upload_release_artifacts(ctx, extra_metadata)
         if not success:
             raise RuntimeError("Failed to upload artifacts to R2")
@@ -115,6 +122,9 @@ def generate_release_json(
             if key != "filename":
                 artifact_data[key] = value
 
+        for delta in artifact_data.get("deltas", []):
+            delta["url"] = f"{base_url}{delta['filename']}"
+
         release_data["artifacts"][artifact_key] = artifact_data
 
     return release_data
@@ -188,7 +198,9 @@ def upload_release_artifacts(
     Args:
         ctx: Build context
         extra_metadata: Optional dict mapping filename to extra metadata fields
-                       e.g. {"file.dmg": {"sparkle_signature": "...", "sparkle_length": 123}}
+                       e.g. {"file.dmg": {"sparkle_signature": "...", "sparkle_length": 123}}.
+                       A "deltas" list names Sparkle delta files in the dist
+                       dir, which are uploaded alongside.
 
     Returns:
         (success, release_json_data) tuple
@@ -237,6 +249,12 @@ def upload_release_artifacts(
         if extra_metadata and artifact_path.name in extra_metadata:
             metadata.update(extra_metadata[artifact_path.name])
 
+        for delta in metadata.get("deltas", []):
+            delta_path = artifact_path.parent / delta["filename"]
+            delta_key = f"{release_path}{delta['filename']}"
+            if not upload_file_to_r2(client, delta_path, delta_key, env.r2_bucket):
+                return False, None
+
         artifact_metadata.append(metadata)
 
     release_data = generate_release_json(ctx, artifact_metadata, platform)
@@ -0,0 +1,40 @@
+diff --git a/chrome/browser/browseros/core/browseros_agent_activity.cc b/chrome/browser/browseros/core/browseros_agent_activity.cc
+new file mode 100644
+index 0000000000000..342a9c3f5d4c8
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_agent_activity.cc
+@@ -0,0 +1,34 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_agent_activity.h"
++
++#include <utility>
++
++#include "base/no_destructor.h"
++#include "content/public/browser/browser_thread.h"
++
++namespace browseros {
++
++namespace {
++
++base::RepeatingClosureList& GetActivityCallbacks() {
++  static base::NoDestructor<base::RepeatingClosureList> callbacks;
++  return *callbacks;
++}
++
++}  // namespace
++
++void NotifyAgentActivity() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  GetActivityCallbacks().Notify();
++}
++
++base::CallbackListSubscription AddAgentActivityCallback(
++    base::RepeatingClosure callback) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  return GetActivityCallbacks().Add(std::move(callback));
++}
++
++}  // namespace browseros
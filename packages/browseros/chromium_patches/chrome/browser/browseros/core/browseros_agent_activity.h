@@ -0,0 +1,32 @@
+diff --git a/chrome/browser/browseros/core/browseros_agent_activity.h b/chrome/browser/browseros/core/browseros_agent_activity.h
+new file mode 100644
+index 0000000000000..bc9e751a44e23
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_agent_activity.h
+@@ -0,0 +1,26 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AGENT_ACTIVITY_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AGENT_ACTIVITY_H_
++
++#include "base/callback_list.h"
++#include "base/functional/callback_forward.h"
++
++namespace browseros {
++
++// Process-wide signal that an agent is at work: MCP traffic through the
++// server proxy or browserOS API calls. Lets components that idle out, like
++// BrowserOSWorkerKeepalive, stay warm without depending on where the work
++// comes from. UI thread only.
++void NotifyAgentActivity();
++
++// |callback| runs on every NotifyAgentActivity() while the subscription is
++// alive.
++[[nodiscard]] base::CallbackListSubscription AddAgentActivityCallback(
++    base::RepeatingClosure callback);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AGENT_ACTIVITY_H_
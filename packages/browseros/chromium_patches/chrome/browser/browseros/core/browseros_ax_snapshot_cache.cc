@@ -0,0 +1,250 @@
+diff --git a/chrome/browser/browseros/core/browseros_ax_snapshot_cache.cc b/chrome/browser/browseros/core/browseros_ax_snapshot_cache.cc
+new file mode 100644
+index 0000000000000..da7ecf1114aad
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_ax_snapshot_cache.cc
+@@ -0,0 +1,244 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_ax_snapshot_cache.h"
++
++#include <set>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/trace_event/trace_event.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace browseros {
++
++namespace {
++
++// Every live cache, for dropping snapshots on memory pressure
++std::set<AXSnapshotCache*>& GetCaches() {
++  static base::NoDestructor<std::set<AXSnapshotCache*>> caches;
++  return *caches;
++}
++
++// How requests were served since startup
++struct RequestCounts {
++  uint64_t cache_hits = 0;
++  uint64_t joined = 0;
++  uint64_t renderer_requests = 0;
++};
++
++RequestCounts& GetRequestCounts() {
++  static RequestCounts counts;
++  return counts;
++}
++
++}  // namespace
++
++AXSnapshotCache::Entry::Entry(ui::AXMode mode,
++                              content::WebContents::AXTreeSnapshotPolicy policy)
++    : mode(mode), policy(policy) {}
++AXSnapshotCache::Entry::Entry(Entry&&) = default;
++AXSnapshotCache::Entry& AXSnapshotCache::Entry::operator=(Entry&&) = default;
++AXSnapshotCache::Entry::~Entry() = default;
++
++// static
++void AXSnapshotCache::Request(content::WebContents* web_contents,
++                              ui::AXMode mode,
++                              content::WebContents::AXTreeSnapshotPolicy policy,
++                              base::TimeDelta timeout,
++                              Freshness freshness,
++                              Callback callback) {
++  CreateForWebContents(web_contents);
++  FromWebContents(web_contents)
++      ->RequestSnapshot(mode, policy, timeout, freshness, std::move(callback));
++}
++
++AXSnapshotCache::AXSnapshotCache(content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<AXSnapshotCache>(*web_contents) {
++  static base::NoDestructor<base::ScopedClosureRunner> registration(
++      AddMemoryPressureHandler(
++          "ax_snapshots",
++          base::BindRepeating(&AXSnapshotCache::OnMemoryPressure)));
++  static base::NoDestructor<base::ScopedClosureRunner> profiler_registration(
++      AddStepProfilerSource(
++          "ax_snapshot_cache",
++          base::BindRepeating(&AXSnapshotCache::ReportStepProfile)));
++  GetCaches().insert(this);
++}
++
++AXSnapshotCache::~AXSnapshotCache() {
++  GetCaches().erase(this);
++}
++
++void AXSnapshotCache::RequestSnapshot(
++    ui::AXMode mode,
++    content::WebContents::AXTreeSnapshotPolicy policy,
++    base::TimeDelta timeout,
++    Freshness freshness,
++    Callback callback) {
++  Entry& entry = FindOrCreateEntry(mode, policy);
++
++  if (freshness == Freshness::kAny && entry.snapshot) {
++    VLOG(1) << "[browseros] AX snapshot cache hit ("
++            << entry.snapshot->data.nodes.size() << " nodes)";
++    GetRequestCounts().cache_hits++;
++    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++        FROM_HERE, base::BindOnce(std::move(callback), entry.snapshot));
++    return;
++  }
++
++  entry.waiters.push_back(std::move(callback));
++  if (freshness == Freshness::kAny && entry.request_id != 0) {
++    VLOG(1) << "[browseros] AX snapshot request joined one in flight ("
++            << entry.waiters.size() << " waiting)";
++    GetRequestCounts().joined++;
++    return;
++  }
++
++  // A newer request supersedes the one in flight; everyone waiting gets
++  // its result
++  entry.snapshot.reset();
++  entry.stale = false;
++  entry.request_id = next_request_id_++;
++  GetRequestCounts().renderer_requests++;
++  TRACE_EVENT_BEGIN(
++      "browser", "BrowserOS::AXSnapshotRequest",
++      perfetto::Track(entry.request_id, perfetto::Track::FromPointer(this)),
++      "waiters", entry.waiters.size());
++  web_contents()->RequestAXTreeSnapshot(
++      base::BindOnce(&AXSnapshotCache::OnSnapshotReceived,
++                     weak_factory_.GetWeakPtr(), entry.request_id),
++      mode, /* max_nodes= */ 0, timeout, policy);
++}
++
++AXSnapshotCache::Entry& AXSnapshotCache::FindOrCreateEntry(
++    ui::AXMode mode,
++    content::WebContents::AXTreeSnapshotPolicy policy) {
++  for (Entry& entry : entries_) {
++    if (entry.mode == mode && entry.policy == policy) {
++      return entry;
++    }
++  }
++  return entries_.emplace_back(mode, policy);
++}
++
++void AXSnapshotCache::OnSnapshotReceived(uint64_t request_id,
++                                         ui::AXTreeUpdate& update) {
++  Entry* entry = nullptr;
++  for (Entry& candidate : entries_) {
++    if (candidate.request_id == request_id) {
++      entry = &candidate;
++      break;
++    }
++  }
++  TRACE_EVENT_END(
++      "browser",
++      perfetto::Track(request_id, perfetto::Track::FromPointer(this)),
++      "nodes", update.nodes.size(), "current", !!entry);
++  if (!entry) {
++    return;
++  }
++
++  auto snapshot = base::MakeRefCounted<base::RefCountedData<ui::AXTreeUpdate>>(
++      std::move(update));
++  entry->request_id = 0;
++  std::vector<Callback> waiters = std::move(entry->waiters);
++
++  // Keep it only if change events will tell us when it goes stale
++  const bool stale = entry->stale;
++  entry->stale = false;
++  if (!stale && web_contents()->GetAccessibilityMode().has_mode(
++                    ui::AXMode::kWebContents)) {
++    entry->snapshot = snapshot;
++  }
++
++  for (Callback& waiter : waiters) {
++    std::move(waiter).Run(snapshot);
++  }
++}
++
++void AXSnapshotCache::Invalidate() {
++  for (Entry& entry : entries_) {
++    entry.snapshot.reset();
++    entry.stale = entry.request_id != 0;
++  }
++}
++
++// static
++void AXSnapshotCache::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level,
++    base::OnceCallback<void(ReleasedMemory)> done) {
++  ReleasedMemory released;
++  for (AXSnapshotCache* cache : GetCaches()) {
++    for (const Entry& entry : cache->entries_) {
++      // Snapshots still handed out stay alive with their consumers
++      if (entry.snapshot && entry.snapshot->HasOneRef()) {
++        released.items++;
++        released.bytes +=
++            entry.snapshot->data.nodes.size() * sizeof(ui::AXNodeData);
++      }
++    }
++    cache->Invalidate();
++  }
++  std::move(done).Run(released);
++}
++
++// static
++void AXSnapshotCache::ReportStepProfile(
++    base::OnceCallback<void(base::Value::Dict)> done) {
++  size_t snapshots = 0;
++  size_t nodes = 0;
++  size_t in_flight = 0;
++  for (const AXSnapshotCache* cache : GetCaches()) {
++    for (const Entry& entry : cache->entries_) {
++      if (entry.snapshot) {
++        snapshots++;
++        nodes += entry.snapshot->data.nodes.size();
++      }
++      if (entry.request_id != 0) {
++        in_flight++;
++      }
++    }
++  }
++  const RequestCounts& counts = GetRequestCounts();
++  std::move(done).Run(
++      base::Value::Dict()
++          .Set("tabs", static_cast<int>(GetCaches().size()))
++          .Set("cachedSnapshots", static_cast<int>(snapshots))
++          .Set("cachedNodes", static_cast<int>(nodes))
++          .Set("cachedBytes",
++               static_cast<double>(nodes * sizeof(ui::AXNodeData)))
++          .Set("inFlight", static_cast<int>(in_flight))
++          .Set("cacheHits", static_cast<double>(counts.cache_hits))
++          .Set("joined", static_cast<double>(counts.joined))
++          .Set("rendererRequests",
++               static_cast<double>(counts.renderer_requests)));
++}
++
++void AXSnapshotCache::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  if (!details.updates.empty() || !details.events.empty()) {
++    Invalidate();
++  }
++}
++
++void AXSnapshotCache::AccessibilityLocationChangesReceived(
++    const ui::AXTreeID& tree_id,
++    ui::AXLocationAndScrollUpdates& details) {
++  // Bounds in the cached trees are stale
++  Invalidate();
++}
++
++void AXSnapshotCache::PrimaryPageChanged(content::Page& page) {
++  Invalidate();
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(AXSnapshotCache);
++
++}  // namespace browseros
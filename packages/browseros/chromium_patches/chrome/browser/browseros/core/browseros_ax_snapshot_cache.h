@@ -0,0 +1,138 @@
+diff --git a/chrome/browser/browseros/core/browseros_ax_snapshot_cache.h b/chrome/browser/browseros/core/browseros_ax_snapshot_cache.h
+new file mode 100644
+index 0000000000000..9ecaeb9d00585
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_ax_snapshot_cache.h
+@@ -0,0 +1,132 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AX_SNAPSHOT_CACHE_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AX_SNAPSHOT_CACHE_H_
++
++#include <cstdint>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/ref_counted.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_mode.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace browseros {
++
++// Immutable AX tree snapshot shared by every consumer that asked for it.
++// Thread-safe refcounted, so it can be handed to ThreadPool tasks as is.
++using SharedAXTreeUpdate =
++    scoped_refptr<base::RefCountedData<ui::AXTreeUpdate>>;
++
++// Per-tab front end for WebContents::RequestAXTreeSnapshot, shared by the
++// browserOS extension API and the side panels.
++// Concurrent requests with the same mode and policy are coalesced into one
++// renderer round trip. While the tab has accessibility enabled (so change
++// events arrive), the finished snapshot is also kept until the next
++// accessibility change or navigation. Without events a cached tree could
++// silently go stale, so it is then only shared with requests that were
++// already waiting. Finished snapshots of every tab are dropped on memory
++// pressure.
++class AXSnapshotCache
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<AXSnapshotCache> {
++ public:
++  using Callback = base::OnceCallback<void(SharedAXTreeUpdate snapshot)>;
++
++  enum class Freshness {
++    // A cached snapshot or one already in flight will do
++    kAny,
++    // The snapshot must be requested after this call, e.g. to observe the
++    // effect of an action that was just dispatched
++    kRequestedAfterNow,
++  };
++
++  // Runs |callback| with a snapshot of |web_contents| taken with |mode| and
++  // |policy|, always asynchronously. |timeout| only applies when a new
++  // renderer request is made.
++  static void Request(content::WebContents* web_contents,
++                      ui::AXMode mode,
++                      content::WebContents::AXTreeSnapshotPolicy policy,
++                      base::TimeDelta timeout,
++                      Freshness freshness,
++                      Callback callback);
++
++  AXSnapshotCache(const AXSnapshotCache&) = delete;
++  AXSnapshotCache& operator=(const AXSnapshotCache&) = delete;
++  ~AXSnapshotCache() override;
++
++ private:
++  friend class content::WebContentsUserData<AXSnapshotCache>;
++
++  struct Entry {
++    Entry(ui::AXMode mode, content::WebContents::AXTreeSnapshotPolicy policy);
++    Entry(Entry&&);
++    Entry& operator=(Entry&&);
++    ~Entry();
++
++    ui::AXMode mode;
++    content::WebContents::AXTreeSnapshotPolicy policy;
++    // Set once the snapshot arrived and is still current
++    SharedAXTreeUpdate snapshot;
++    // Requests waiting for the in-flight snapshot
++    std::vector<Callback> waiters;
++    // Identifies the newest in-flight request; 0 when there is none.
++    // Responses to superseded requests are ignored.
++    uint64_t request_id = 0;
++    // The page changed while the request was in flight, so its result
++    // may already be out of date
++    bool stale = false;
++  };
++
++  explicit AXSnapshotCache(content::WebContents* web_contents);
++
++  void RequestSnapshot(ui::AXMode mode,
++                       content::WebContents::AXTreeSnapshotPolicy policy,
++                       base::TimeDelta timeout,
++                       Freshness freshness,
++                       Callback callback);
++  Entry& FindOrCreateEntry(ui::AXMode mode,
++                           content::WebContents::AXTreeSnapshotPolicy policy);
++  void OnSnapshotReceived(uint64_t request_id, ui::AXTreeUpdate& update);
++
++  // Drops finished snapshots; in-flight requests are delivered to their
++  // waiters but not kept
++  void Invalidate();
++
++  // Invalidate()s every cache, counting the snapshots no consumer holds
++  static void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(ReleasedMemory)> done);
++
++  // Hit counts and cached snapshots, for chrome://browseros-internals
++  static void ReportStepProfile(
++      base::OnceCallback<void(base::Value::Dict)> done);
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void AccessibilityLocationChangesReceived(
++      const ui::AXTreeID& tree_id,
++      ui::AXLocationAndScrollUpdates& details) override;
++  void PrimaryPageChanged(content::Page& page) override;
++
++  std::vector<Entry> entries_;
++  uint64_t next_request_id_ = 1;
++
++  base::WeakPtrFactory<AXSnapshotCache> weak_factory_{this};
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AX_SNAPSHOT_CACHE_H_
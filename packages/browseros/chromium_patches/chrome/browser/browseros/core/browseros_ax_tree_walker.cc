@@ -0,0 +1,88 @@
+diff --git a/chrome/browser/browseros/core/browseros_ax_tree_walker.cc b/chrome/browser/browseros/core/browseros_ax_tree_walker.cc
+new file mode 100644
+index 0000000000000..1835e67a70a0e
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_ax_tree_walker.cc
+@@ -0,0 +1,82 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_ax_tree_walker.h"
++
++#include <algorithm>
++#include <vector>
++
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace browseros {
++
++namespace {
++
++// A node waiting on the walk stack. |exit| entries stand for the end of a
++// node's children.
++struct PendingNode {
++  int32_t id;
++  const ui::AXNodeData* exit;
++};
++
++}  // namespace
++
++AXTreeWalker::AXTreeWalker(const ui::AXTreeUpdate& update) : update_(update) {
++  positions_.reserve(update.nodes.size());
++  for (size_t i = 0; i < update.nodes.size(); ++i) {
++    positions_[update.nodes[i].id] = i;
++  }
++}
++
++AXTreeWalker::~AXTreeWalker() = default;
++
++const ui::AXNodeData* AXTreeWalker::Find(int32_t ax_id) const {
++  auto it = positions_.find(ax_id);
++  if (it == positions_.end()) {
++    return nullptr;
++  }
++  return &update_->nodes[it->second];
++}
++
++int32_t AXTreeWalker::root_id() const {
++  return update_->root_id;
++}
++
++size_t AXTreeWalker::size() const {
++  return update_->nodes.size();
++}
++
++bool AXTreeWalker::Walk(int32_t root_id, AXContentSink& sink) const {
++  // Children are pushed in reverse to pop in document order
++  std::vector<PendingNode> stack = {{root_id, nullptr}};
++  while (!stack.empty()) {
++    if (sink.IsDone()) {
++      // Only the exits of nodes already visited may be left
++      return std::ranges::all_of(
++          stack, [](const PendingNode& rest) { return rest.exit != nullptr; });
++    }
++
++    const PendingNode pending = stack.back();
++    stack.pop_back();
++    if (pending.exit) {
++      sink.ExitNode(*pending.exit);
++      continue;
++    }
++
++    const ui::AXNodeData* node = Find(pending.id);
++    if (!node || !sink.EnterNode(*node)) {
++      continue;
++    }
++
++    stack.push_back({node->id, node});
++    for (auto it = node->child_ids.rbegin(); it != node->child_ids.rend();
++         ++it) {
++      stack.push_back({*it, nullptr});
++    }
++  }
++  return true;
++}
++
++}  // namespace browseros
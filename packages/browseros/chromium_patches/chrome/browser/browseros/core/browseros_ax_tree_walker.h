@@ -0,0 +1,77 @@
+diff --git a/chrome/browser/browseros/core/browseros_ax_tree_walker.h b/chrome/browser/browseros/core/browseros_ax_tree_walker.h
+new file mode 100644
+index 0000000000000..c9cb340aa6949
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_ax_tree_walker.h
+@@ -0,0 +1,71 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AX_TREE_WALKER_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AX_TREE_WALKER_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <unordered_map>
++
++#include "base/memory/raw_ref.h"
++
++namespace ui {
++struct AXNodeData;
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace browseros {
++
++// Receives the nodes of an AX tree walk in document order. Implementations
++// turn them into an output format (markdown, ContentItems, ...).
++class AXContentSink {
++ public:
++  virtual ~AXContentSink() = default;
++
++  // Called for each node in pre-order. Returns true to visit its children,
++  // in which case ExitNode is called for it once they are done.
++  virtual bool EnterNode(const ui::AXNodeData& node) = 0;
++
++  // Called after the children of a node EnterNode descended into.
++  virtual void ExitNode(const ui::AXNodeData& node) {}
++
++  // Returns true to end the walk early, e.g. once an output budget is spent.
++  virtual bool IsDone() const { return false; }
++};
++
++// Iterative depth-first walk over an AXTreeUpdate, shared by the text
++// extractors of the browserOS API and the side panels.
++// Built once per update, the AX id -> position index is reused by every
++// Walk() over it. The nodes are not copied, so |update| must outlive the
++// walker. Touches no browser state, so it can run on the ThreadPool.
++class AXTreeWalker {
++ public:
++  explicit AXTreeWalker(const ui::AXTreeUpdate& update);
++
++  AXTreeWalker(const AXTreeWalker&) = delete;
++  AXTreeWalker& operator=(const AXTreeWalker&) = delete;
++
++  ~AXTreeWalker();
++
++  // Returns the node with the given AX id, or nullptr.
++  const ui::AXNodeData* Find(int32_t ax_id) const;
++
++  int32_t root_id() const;
++  size_t size() const;
++
++  // Walks the subtree at |root_id| into |sink|. Unlike a recursive walk,
++  // deeply nested pages cannot overflow the stack. Returns false if the
++  // sink ended the walk before every node was visited.
++  bool Walk(int32_t root_id, AXContentSink& sink) const;
++  bool Walk(AXContentSink& sink) const { return Walk(root_id(), sink); }
++
++ private:
++  const raw_ref<const ui::AXTreeUpdate> update_;
++  std::unordered_map<int32_t, size_t> positions_;  // AX id -> index in nodes
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_AX_TREE_WALKER_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_constants.h b/chrome/browser/browseros/core/browseros_constants.h
 new file mode 100644
-index 0000000000000..476d761245673
+index 0000000000000..7bd4fbbbd25f1
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_constants.h
-@@ -0,0 +1,222 @@
+@@ -0,0 +1,283 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,8 +11,11 @@ index 0000000000000..476d761245673
 +#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_CONSTANTS_H_
 +#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_CONSTANTS_H_
 +
++#include <array>
 +#include <cstddef>
++#include <cstdint>
 +#include <string>
++#include <string_view>
 +#include <vector>
 +
 +#include "base/command_line.h"
@@ -182,27 +185,85 @@ index 0000000000000..476d761245673
 +inline constexpr size_t kBrowserOSExtensionsCount =
 +    sizeof(kBrowserOSExtensions) / sizeof(kBrowserOSExtensions[0]);
 +
-+inline const BrowserOSExtensionInfo* FindBrowserOSExtensionInfo(
-+    const std::string& extension_id) {
++// BrowserOS extensions are looked up from hot paths (service worker events,
++// media access checks), so their IDs are hashed into a table built at
++// compile time: a lookup hashes a few characters and compares one ID.
++namespace internal {
++
++inline constexpr size_t kExtensionIdLength = 32;
++inline constexpr size_t kExtensionTableSize = 16;
++
++// FNV-1a of the leading characters. IDs are random, so a few tell them
++// apart. |id| must be kExtensionIdLength long.
++constexpr size_t ExtensionIdSlot(std::string_view id) {
++  uint32_t hash = 2166136261u;
++  for (size_t i = 0; i < 8; ++i) {
++    hash = (hash ^ static_cast<uint8_t>(id[i])) * 16777619u;
++  }
++  return hash % kExtensionTableSize;
++}
++
++// Index into kBrowserOSExtensions of the ID in each slot, or -1
++constexpr std::array<int, kExtensionTableSize> BuildExtensionTable() {
++  std::array<int, kExtensionTableSize> table;
++  table.fill(-1);
++  for (size_t i = 0; i < kBrowserOSExtensionsCount; ++i) {
++    table[ExtensionIdSlot(kBrowserOSExtensions[i].id)] = static_cast<int>(i);
++  }
++  return table;
++}
++
++constexpr bool IsExtensionTablePerfect() {
++  std::array<bool, kExtensionTableSize> used = {};
 +  for (const auto& info : kBrowserOSExtensions) {
-+    if (extension_id == info.id)
-+      return &info;
++    if (std::string_view(info.id).size() != kExtensionIdLength) {
++      return false;
++    }
++    const size_t slot = ExtensionIdSlot(info.id);
++    if (used[slot]) {
++      return false;
++    }
++    used[slot] = true;
 +  }
-+  return nullptr;
++  return true;
++}
++
++static_assert(IsExtensionTablePerfect(),
++              "BrowserOS extension IDs collide, grow kExtensionTableSize");
++
++inline constexpr std::array<int, kExtensionTableSize> kExtensionTable =
++    BuildExtensionTable();
++
++}  // namespace internal
++
++constexpr const BrowserOSExtensionInfo* FindBrowserOSExtensionInfo(
++    std::string_view extension_id) {
++  if (extension_id.size() != internal::kExtensionIdLength) {
++    return nullptr;
++  }
++  const int index =
++      internal::kExtensionTable[internal::ExtensionIdSlot(extension_id)];
++  if (index < 0 || extension_id != kBrowserOSExtensions[index].id) {
++    return nullptr;
++  }
++  return &kBrowserOSExtensions[index];
 +}
 +
 +// Check if an extension is a BrowserOS extension
-+inline bool IsBrowserOSExtension(const std::string& extension_id) {
++constexpr bool IsBrowserOSExtension(std::string_view extension_id) {
 +  return FindBrowserOSExtensionInfo(extension_id) != nullptr;
 +}
 +
-+inline bool IsBrowserOSPinnedExtension(const std::string& extension_id) {
++static_assert(IsBrowserOSExtension(kAgentV2ExtensionId));
++static_assert(!IsBrowserOSExtension("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
++
++inline bool IsBrowserOSPinnedExtension(std::string_view extension_id) {
 +  const BrowserOSExtensionInfo* info =
 +      FindBrowserOSExtensionInfo(extension_id);
 +  return info && info->is_pinned;
 +}
 +
-+inline bool IsBrowserOSLabelledExtension(const std::string& extension_id) {
++inline bool IsBrowserOSLabelledExtension(std::string_view extension_id) {
 +  const BrowserOSExtensionInfo* info =
 +      FindBrowserOSExtensionInfo(extension_id);
 +  return info && info->is_labelled;
@@ -0,0 +1,47 @@
+diff --git a/chrome/browser/browseros/core/browseros_direct_call.cc b/chrome/browser/browseros/core/browseros_direct_call.cc
+new file mode 100644
+index 0000000000000..690ef2b6ac858
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_direct_call.cc
+@@ -0,0 +1,41 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_direct_call.h"
++
++#include <utility>
++
++#include "base/no_destructor.h"
++#include "content/public/browser/browser_thread.h"
++
++namespace browseros {
++
++namespace {
++
++DirectCallHandler& GetDirectCallHandler() {
++  static base::NoDestructor<DirectCallHandler> handler;
++  return *handler;
++}
++
++}  // namespace
++
++void SetDirectCallHandler(DirectCallHandler handler) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  GetDirectCallHandler() = std::move(handler);
++}
++
++void RunDirectCall(std::string function,
++                   base::Value::List args,
++                   DirectCallReplyCallback reply) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  const DirectCallHandler& handler = GetDirectCallHandler();
++  if (!handler) {
++    std::move(reply).Run(
++        base::unexpected("BrowserOS API is not available yet"));
++    return;
++  }
++  handler.Run(std::move(function), std::move(args), std::move(reply));
++}
++
++}  // namespace browseros
@@ -0,0 +1,49 @@
+diff --git a/chrome/browser/browseros/core/browseros_direct_call.h b/chrome/browser/browseros/core/browseros_direct_call.h
+new file mode 100644
+index 0000000000000..9d9cf9a09a348
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_direct_call.h
+@@ -0,0 +1,43 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_DIRECT_CALL_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_DIRECT_CALL_H_
++
++#include <string>
++
++#include "base/functional/callback.h"
++#include "base/types/expected.h"
++#include "base/values.h"
++
++namespace browseros {
++
++// Results of a browserOS function, or its error
++using DirectCallResult = base::expected<base::Value::List, std::string>;
++using DirectCallReplyCallback = base::OnceCallback<void(DirectCallResult)>;
++
++// Runs the browserOS function |function| (without the "browserOS." prefix)
++// with |args| and replies with its results.
++using DirectCallHandler =
++    base::RepeatingCallback<void(std::string function,
++                                 base::Value::List args,
++                                 DirectCallReplyCallback reply)>;
++
++// Process-wide slot through which the server proxy calls browserOS functions
++// in-process, without a round trip through the agent extension. Kept here so
++// the server doesn't depend on the extensions layer, which fills the slot
++// (BrowserOSDirectDispatcher). UI thread only.
++//
++// Claims the slot for |handler|, or clears it when |handler| is null.
++void SetDirectCallHandler(DirectCallHandler handler);
++
++// Runs |function| through the handler, or replies with an error if none is
++// set.
++void RunDirectCall(std::string function,
++                   base::Value::List args,
++                   DirectCallReplyCallback reply);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_DIRECT_CALL_H_
@@ -0,0 +1,157 @@
+diff --git a/chrome/browser/browseros/core/browseros_memory_pressure.cc b/chrome/browser/browseros/core/browseros_memory_pressure.cc
+new file mode 100644
+index 0000000000000..f1e340a033b7e
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_memory_pressure.cc
+@@ -0,0 +1,151 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++
++#include <map>
++#include <optional>
++#include <utility>
++#include <vector>
++
++#include "base/barrier_callback.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "content/public/browser/browser_thread.h"
++
++namespace browseros {
++
++namespace {
++
++using ComponentRelease = std::pair<std::string, ReleasedMemory>;
++
++const char* GetLevelName(
++    base::MemoryPressureListener::MemoryPressureLevel level) {
++  return level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL
++             ? "critical"
++             : "moderate";
++}
++
++void LogReleased(base::MemoryPressureListener::MemoryPressureLevel level,
++                 std::vector<ComponentRelease> releases) {
++  std::map<std::string, ReleasedMemory> by_component;
++  ReleasedMemory total;
++  for (const auto& [component, released] : releases) {
++    if (component.empty()) {
++      continue;  // Unregistered before it ran
++    }
++    by_component[component].bytes += released.bytes;
++    by_component[component].items += released.items;
++    total.bytes += released.bytes;
++    total.items += released.items;
++  }
++  if (total.bytes == 0 && total.items == 0) {
++    return;
++  }
++
++  base::Value::Dict props;
++  props.Set("level", GetLevelName(level));
++  props.Set("total_bytes", static_cast<double>(total.bytes));
++  for (const auto& [component, released] : by_component) {
++    props.Set(component + "_bytes", static_cast<double>(released.bytes));
++    props.Set(component + "_items", static_cast<double>(released.items));
++  }
++  LOG(INFO) << "browseros: Released about " << total.bytes / 1024
++            << " KB and " << total.items << " items on " << GetLevelName(level)
++            << " memory pressure";
++  browseros_metrics::BrowserOSMetrics::Log("memory.pressure_release",
++                                           std::move(props));
++}
++
++class MemoryPressureCoordinator {
++ public:
++  static MemoryPressureCoordinator* Get() {
++    static base::NoDestructor<MemoryPressureCoordinator> instance;
++    return instance.get();
++  }
++
++  base::ScopedClosureRunner Add(std::string component,
++                                MemoryPressureHandler handler) {
++    const int id = next_id_++;
++    handlers_.emplace(id, ComponentHandler{std::move(component),
++                                           std::move(handler)});
++    if (!listener_) {
++      listener_.emplace(
++          FROM_HERE,
++          base::BindRepeating(&MemoryPressureCoordinator::OnMemoryPressure,
++                              base::Unretained(this)));
++    }
++    return base::ScopedClosureRunner(base::BindOnce(
++        &MemoryPressureCoordinator::Remove, base::Unretained(this), id));
++  }
++
++ private:
++  friend base::NoDestructor<MemoryPressureCoordinator>;
++
++  struct ComponentHandler {
++    std::string component;
++    MemoryPressureHandler handler;
++  };
++
++  MemoryPressureCoordinator() = default;
++  ~MemoryPressureCoordinator() = default;
++
++  void Remove(int id) {
++    handlers_.erase(id);
++    if (handlers_.empty()) {
++      listener_.reset();
++    }
++  }
++
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level) {
++    if (level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE ||
++        handlers_.empty()) {
++      return;
++    }
++
++    // A handler may unregister others, e.g. by discarding the WebContents
++    // that own them, so each one is looked up again right before it runs
++    std::vector<int> ids;
++    for (const auto& [id, handler] : handlers_) {
++      ids.push_back(id);
++    }
++    auto barrier = base::BarrierCallback<ComponentRelease>(
++        ids.size(), base::BindOnce(&LogReleased, level));
++    for (int id : ids) {
++      auto it = handlers_.find(id);
++      if (it == handlers_.end()) {
++        barrier.Run({std::string(), ReleasedMemory()});
++        continue;
++      }
++      it->second.handler.Run(
++          level, base::BindOnce(
++                     [](const std::string& component,
++                        ReleasedMemory released) -> ComponentRelease {
++                       return {component, released};
++                     },
++                     it->second.component)
++                     .Then(barrier));
++    }
++  }
++
++  std::map<int, ComponentHandler> handlers_;
++  int next_id_ = 0;
++  std::optional<base::MemoryPressureListener> listener_;
++};
++
++}  // namespace
++
++base::ScopedClosureRunner AddMemoryPressureHandler(
++    std::string component,
++    MemoryPressureHandler handler) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  return MemoryPressureCoordinator::Get()->Add(std::move(component),
++                                               std::move(handler));
++}
++
++}  // namespace browseros
@@ -0,0 +1,52 @@
+diff --git a/chrome/browser/browseros/core/browseros_memory_pressure.h b/chrome/browser/browseros/core/browseros_memory_pressure.h
+new file mode 100644
+index 0000000000000..0ae4c902a2a01
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_memory_pressure.h
+@@ -0,0 +1,46 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_MEMORY_PRESSURE_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_MEMORY_PRESSURE_H_
++
++#include <cstddef>
++#include <string>
++
++#include "base/functional/callback.h"
++#include "base/functional/callback_helpers.h"
++#include "base/memory/memory_pressure_listener.h"
++
++namespace browseros {
++
++// What a component gave back on memory pressure: an estimate of the heap
++// bytes freed, and a count of things whose size the browser process can't
++// see, like WebContents or sockets.
++struct ReleasedMemory {
++  size_t bytes = 0;
++  size_t items = 0;
++};
++
++// Releases what the component can spare at |level| and runs |done| with
++// what it released, possibly later, e.g. after a hop to the IO thread.
++using MemoryPressureHandler = base::RepeatingCallback<void(
++    base::MemoryPressureListener::MemoryPressureLevel level,
++    base::OnceCallback<void(ReleasedMemory)> done)>;
++
++// Process-wide memory pressure handling for BrowserOS components. A single
++// base::MemoryPressureListener runs every handler on moderate and critical
++// pressure. Once all of them replied, what each |component| released is
++// logged as one "memory.pressure_release" metric, summed over handlers
++// registered under the same name. Rounds that released nothing, as when
++// pressure persists, are not logged.
++//
++// |handler| stays registered until the returned runner goes away. UI
++// thread only.
++[[nodiscard]] base::ScopedClosureRunner AddMemoryPressureHandler(
++    std::string component,
++    MemoryPressureHandler handler);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_MEMORY_PRESSURE_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_prefs.cc b/chrome/browser/browseros/core/browseros_prefs.cc
 new file mode 100644
-index 0000000000000..9ebd1e2429ac0
+index 0000000000000..8b72fed5add61
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_prefs.cc
-@@ -0,0 +1,55 @@
+@@ -0,0 +1,65 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -25,6 +25,16 @@ index 0000000000000..9ebd1e2429ac0
 +  registry->RegisterStringPref(prefs::kProviders, "");
 +  registry->RegisterStringPref(prefs::kCustomProviders, "[]");
 +  registry->RegisterStringPref(prefs::kDefaultProviderId, "");
++
++  // Teach mode prefs
++  registry->RegisterDictionaryPref(prefs::kActionScripts);
++
++  // Agent automation prefs
++  registry->RegisterBooleanPref(prefs::kShareTaskRenderers, false);
++  registry->RegisterDictionaryPref(prefs::kSnapshotPruneRules);
++
++  // LLM panel prefs
++  registry->RegisterBooleanPref(prefs::kPageTextDiskCache, false);
 +}
 +
 +bool ShouldShowLLMChat(PrefService* pref_service) {
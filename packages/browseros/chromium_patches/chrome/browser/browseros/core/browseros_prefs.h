@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_prefs.h b/chrome/browser/browseros/core/browseros_prefs.h
 new file mode 100644
-index 0000000000000..3d2c46562d783
+index 0000000000000..de2a7227d50dd
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_prefs.h
-@@ -0,0 +1,65 @@
+@@ -0,0 +1,86 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -42,6 +42,27 @@ index 0000000000000..3d2c46562d783
 +// String containing the default provider ID for BrowserOS
 +inline constexpr char kDefaultProviderId[] = "browseros.default_provider_id";
 +
++// Teach mode prefs
++// Dictionary of the saved action scripts, keyed by name
++inline constexpr char kActionScripts[] = "browseros.action_scripts";
++
++// Agent automation prefs
++// Boolean: Open the tabs of one agent task in a shared browsing instance, so
++// same-site pages share renderer processes (default: false)
++inline constexpr char kShareTaskRenderers[] =
++    "browseros.automation.share_task_renderers";
++// Dictionary: Snapshot prune rules, lists keyed by host (see
++// browser_os_prune_rules.h)
++inline constexpr char kSnapshotPruneRules[] =
++    "browseros.automation.snapshot_prune_rules";
++
++// LLM panel prefs
++// Boolean: Also keep the text extracted from pages for the LLM panels on
++// disk, so unchanged pages aren't extracted again after a restart. Never
++// applies off the record (default: false)
++inline constexpr char kPageTextDiskCache[] =
++    "browseros.llm.page_text_disk_cache";
++
 +}  // namespace prefs
 +
 +// Registers BrowserOS profile preferences.
@@ -0,0 +1,167 @@
+diff --git a/chrome/browser/browseros/core/browseros_startup_timing.cc b/chrome/browser/browseros/core/browseros_startup_timing.cc
+new file mode 100644
+index 0000000000000..cbc717b7976ba
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_startup_timing.cc
+@@ -0,0 +1,161 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_startup_timing.h"
++
++#include <array>
++#include <string>
++#include <utility>
++
++#include "base/metrics/histogram_functions.h"
++#include "base/no_destructor.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr size_t kPhaseCount =
++    static_cast<size_t>(StartupPhase::kMaxValue) + 1;
++
++// Slow corporate machines take minutes to scan a freshly launched binary
++constexpr base::TimeDelta kHistogramMin = base::Milliseconds(1);
++constexpr base::TimeDelta kHistogramMax = base::Minutes(3);
++constexpr size_t kHistogramBuckets = 50;
++
++struct PhaseTiming {
++  base::TimeTicks begin;
++  base::TimeTicks end;
++};
++
++struct StartupTiming {
++  base::TimeTicks origin;
++  std::array<PhaseTiming, kPhaseCount> phases;
++  base::TimeTicks mcp_ready;
++  bool reported = false;
++};
++
++StartupTiming& GetStartupTiming() {
++  static base::NoDestructor<StartupTiming> timing;
++  return *timing;
++}
++
++PhaseTiming& GetPhase(StartupPhase phase) {
++  return GetStartupTiming().phases[static_cast<size_t>(phase)];
++}
++
++// Histogram suffix and metric key of |phase|
++const char* GetPhaseName(StartupPhase phase) {
++  switch (phase) {
++    case StartupPhase::kAcquireLock:
++      return "AcquireLock";
++    case StartupPhase::kRecoverFromOrphan:
++      return "RecoverFromOrphan";
++    case StartupPhase::kResolvePorts:
++      return "ResolvePorts";
++    case StartupPhase::kStartCDPServer:
++      return "StartCDPServer";
++    case StartupPhase::kStartProxy:
++      return "StartProxy";
++    case StartupPhase::kLaunchProcess:
++      return "LaunchProcess";
++    case StartupPhase::kFirstHealthCheck:
++      return "FirstHealthCheck";
++    case StartupPhase::kExtensionInstall:
++      return "ExtensionInstall";
++  }
++}
++
++void RecordTime(const std::string& name, base::TimeDelta sample) {
++  base::UmaHistogramCustomTimes("BrowserOS.Startup." + name, sample,
++                                kHistogramMin, kHistogramMax,
++                                kHistogramBuckets);
++}
++
++int ToMilliseconds(base::TimeDelta delta) {
++  return static_cast<int>(delta.InMilliseconds());
++}
++
++// Logs every phase once the MCP endpoint and the extensions are both ready
++void MaybeReport() {
++  StartupTiming& timing = GetStartupTiming();
++  const PhaseTiming& extensions = GetPhase(StartupPhase::kExtensionInstall);
++  if (timing.reported || timing.mcp_ready.is_null() ||
++      extensions.end.is_null()) {
++    return;
++  }
++  timing.reported = true;
++
++  base::Value::Dict properties;
++  const char* long_pole = nullptr;
++  base::TimeDelta longest;
++  for (size_t i = 0; i < kPhaseCount; ++i) {
++    const PhaseTiming& phase = timing.phases[i];
++    if (phase.end.is_null()) {
++      continue;
++    }
++    const char* name = GetPhaseName(static_cast<StartupPhase>(i));
++    const base::TimeDelta duration = phase.end - phase.begin;
++    properties.Set(std::string(name) + "_ms", ToMilliseconds(duration));
++    if (!timing.origin.is_null()) {
++      properties.Set(std::string(name) + "_at_ms",
++                     ToMilliseconds(phase.begin - timing.origin));
++    }
++    if (!long_pole || duration > longest) {
++      long_pole = name;
++      longest = duration;
++    }
++  }
++  if (!timing.origin.is_null()) {
++    properties.Set("mcp_ready_ms",
++                   ToMilliseconds(timing.mcp_ready - timing.origin));
++  }
++  if (long_pole) {
++    properties.Set("long_pole", long_pole);
++  }
++
++  browseros_metrics::BrowserOSMetrics::Log("server.startup.phases",
++                                           std::move(properties));
++}
++
++}  // namespace
++
++void SetStartupOrigin(base::TimeTicks origin) {
++  StartupTiming& timing = GetStartupTiming();
++  if (timing.origin.is_null()) {
++    timing.origin = origin;
++  }
++}
++
++void BeginStartupPhase(StartupPhase phase) {
++  PhaseTiming& timing = GetPhase(phase);
++  if (timing.begin.is_null()) {
++    timing.begin = base::TimeTicks::Now();
++  }
++}
++
++void EndStartupPhase(StartupPhase phase) {
++  PhaseTiming& timing = GetPhase(phase);
++  if (timing.begin.is_null() || !timing.end.is_null()) {
++    return;
++  }
++  timing.end = base::TimeTicks::Now();
++  RecordTime(GetPhaseName(phase), timing.end - timing.begin);
++  MaybeReport();
++}
++
++void MarkStartupMcpReady() {
++  StartupTiming& timing = GetStartupTiming();
++  if (!timing.mcp_ready.is_null()) {
++    return;
++  }
++  timing.mcp_ready = base::TimeTicks::Now();
++  if (!timing.origin.is_null()) {
++    RecordTime("MCPReady", timing.mcp_ready - timing.origin);
++  }
++  MaybeReport();
++}
++
++}  // namespace browseros
@@ -0,0 +1,55 @@
+diff --git a/chrome/browser/browseros/core/browseros_startup_timing.h b/chrome/browser/browseros/core/browseros_startup_timing.h
+new file mode 100644
+index 0000000000000..158f4395f20fe
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_startup_timing.h
+@@ -0,0 +1,49 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STARTUP_TIMING_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STARTUP_TIMING_H_
++
++#include "base/time/time.h"
++
++namespace browseros {
++
++// Steps between the server manager's Start() and the MCP endpoint serving,
++// plus the bundled extension install, which runs alongside them.
++enum class StartupPhase {
++  kAcquireLock,
++  kRecoverFromOrphan,
++  kResolvePorts,
++  kStartCDPServer,
++  kStartProxy,
++  kLaunchProcess,
++  // From the process launching to its first successful health check
++  kFirstHealthCheck,
++  kExtensionInstall,
++  kMaxValue = kExtensionInstall,
++};
++
++// Phase timing of the first BrowserOS startup of the browser session.
++//
++// Each phase is timed from its first BeginStartupPhase() to its first
++// EndStartupPhase() and recorded to BrowserOS.Startup.<Phase>. Later calls,
++// as from server restarts, are ignored. Once the MCP endpoint is ready and
++// the extension install finished, every phase is logged as one
++// "server.startup.phases" metric along with the slowest of them, so slow
++// machines show which step held startup up.
++//
++// UI thread only.
++
++// Marks when startup began; phase offsets in the metric count from here.
++void SetStartupOrigin(base::TimeTicks origin);
++
++void BeginStartupPhase(StartupPhase phase);
++void EndStartupPhase(StartupPhase phase);
++
++// Marks the MCP endpoint forwarding to the server.
++void MarkStartupMcpReady();
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STARTUP_TIMING_H_
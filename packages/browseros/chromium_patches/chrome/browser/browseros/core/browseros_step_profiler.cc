@@ -0,0 +1,297 @@
+diff --git a/chrome/browser/browseros/core/browseros_step_profiler.cc b/chrome/browser/browseros/core/browseros_step_profiler.cc
+new file mode 100644
+index 0000000000000..e8c90dd9b6593
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_step_profiler.cc
+@@ -0,0 +1,291 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++
++#include <map>
++#include <utility>
++#include <vector>
++
++#include "base/barrier_callback.h"
++#include "base/containers/circular_deque.h"
++#include "base/functional/bind.h"
++#include "base/no_destructor.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "content/public/browser/browser_thread.h"
++
++namespace browseros {
++
++namespace {
++
++using SourceReport = std::pair<std::string, base::Value::Dict>;
++
++struct Phase {
++  std::string name;
++  base::TimeTicks begin;
++  // Null while the phase runs
++  base::TimeTicks end;
++};
++
++struct Call {
++  Call() = default;
++  Call(Call&&) = default;
++  Call& operator=(Call&&) = default;
++  ~Call() = default;
++
++  std::string function;
++  int tab_id = -1;
++  base::Time wall_start;
++  base::TimeTicks start;
++  // Null while the call runs
++  base::TimeTicks end;
++  bool success = false;
++  std::vector<Phase> phases;
++};
++
++double ToMilliseconds(base::TimeDelta delta) {
++  return delta.InMillisecondsF();
++}
++
++base::Value::Dict CallToValue(const Call& call, base::TimeTicks now) {
++  base::Value::List phases;
++  for (const Phase& phase : call.phases) {
++    const base::TimeTicks end = phase.end.is_null() ? now : phase.end;
++    phases.Append(
++        base::Value::Dict()
++            .Set("name", phase.name)
++            .Set("startMs", ToMilliseconds(phase.begin - call.start))
++            .Set("durationMs", ToMilliseconds(end - phase.begin)));
++  }
++
++  const bool running = call.end.is_null();
++  base::Value::Dict value;
++  value.Set("function", call.function);
++  value.Set("tabId", call.tab_id);
++  value.Set("startTime", call.wall_start.InMillisecondsFSinceUnixEpoch());
++  value.Set("totalMs",
++            ToMilliseconds((running ? now : call.end) - call.start));
++  value.Set("running", running);
++  value.Set("success", call.success);
++  value.Set("phases", std::move(phases));
++  return value;
++}
++
++void OnSourcesReported(base::Value::Dict profile,
++                       base::OnceCallback<void(base::Value::Dict)> done,
++                       std::vector<SourceReport> reports) {
++  base::Value::Dict sources;
++  for (auto& [component, report] : reports) {
++    if (component.empty()) {
++      continue;  // Unregistered before it was read
++    }
++    base::Value::List* list = sources.EnsureList(component);
++    list->Append(std::move(report));
++  }
++  profile.Set("sources", std::move(sources));
++  std::move(done).Run(std::move(profile));
++}
++
++class StepProfiler {
++ public:
++  static StepProfiler* Get() {
++    static base::NoDestructor<StepProfiler> instance;
++    return instance.get();
++  }
++
++  uint64_t Begin(std::string_view function,
++                 base::TimeTicks start,
++                 std::string_view first_phase) {
++    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++    if (!memory_pressure_registration_) {
++      memory_pressure_registration_ = AddMemoryPressureHandler(
++          "step_profiler",
++          base::BindRepeating(&StepProfiler::OnMemoryPressure,
++                              base::Unretained(this)));
++    }
++
++    Call call;
++    call.function = std::string(function);
++    call.start = start;
++    call.wall_start = base::Time::Now() - (base::TimeTicks::Now() - start);
++    call.phases.push_back({std::string(first_phase), start, {}});
++    const uint64_t id = next_id_++;
++    running_.emplace(id, std::move(call));
++    return id;
++  }
++
++  void SetTabId(uint64_t id, int tab_id) {
++    if (Call* call = FindRunning(id)) {
++      call->tab_id = tab_id;
++    }
++  }
++
++  void StartPhase(uint64_t id, std::string_view phase) {
++    Call* call = FindRunning(id);
++    if (!call) {
++      return;
++    }
++    const base::TimeTicks now = base::TimeTicks::Now();
++    call->phases.back().end = now;
++    call->phases.push_back({std::string(phase), now, {}});
++  }
++
++  void Finish(uint64_t id, bool success) {
++    auto it = running_.find(id);
++    if (it == running_.end()) {
++      return;
++    }
++    const base::TimeTicks now = base::TimeTicks::Now();
++    Call call = std::move(it->second);
++    running_.erase(it);
++    call.phases.back().end = now;
++    call.end = now;
++    call.success = success;
++    recent_.push_back(std::move(call));
++    if (recent_.size() > kMaxProfiledCalls) {
++      recent_.pop_front();
++    }
++  }
++
++  base::ScopedClosureRunner AddSource(std::string component,
++                                      StepProfilerSource source) {
++    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++    const int id = next_source_id_++;
++    sources_.emplace(id, ComponentSource{std::move(component),
++                                         std::move(source)});
++    return base::ScopedClosureRunner(base::BindOnce(
++        &StepProfiler::RemoveSource, base::Unretained(this), id));
++  }
++
++  void Collect(base::OnceCallback<void(base::Value::Dict)> done) {
++    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++    const base::TimeTicks now = base::TimeTicks::Now();
++    // Oldest first, the running ones last
++    base::Value::List calls;
++    for (const Call& call : recent_) {
++      calls.Append(CallToValue(call, now));
++    }
++    for (const auto& [id, call] : running_) {
++      calls.Append(CallToValue(call, now));
++    }
++    base::Value::Dict profile;
++    profile.Set("calls", std::move(calls));
++    profile.Set("maxCalls", static_cast<int>(kMaxProfiledCalls));
++
++    // A source may unregister others, so each one is looked up again right
++    // before it runs
++    std::vector<int> ids;
++    for (const auto& [id, source] : sources_) {
++      ids.push_back(id);
++    }
++    auto barrier = base::BarrierCallback<SourceReport>(
++        ids.size(),
++        base::BindOnce(&OnSourcesReported, std::move(profile), std::move(done)));
++    for (int id : ids) {
++      auto it = sources_.find(id);
++      if (it == sources_.end()) {
++        barrier.Run({std::string(), base::Value::Dict()});
++        continue;
++      }
++      it->second.source.Run(
++          base::BindOnce(
++              [](const std::string& component,
++                 base::Value::Dict report) -> SourceReport {
++                return {component, std::move(report)};
++              },
++              it->second.component)
++              .Then(barrier));
++    }
++  }
++
++ private:
++  friend base::NoDestructor<StepProfiler>;
++
++  struct ComponentSource {
++    std::string component;
++    StepProfilerSource source;
++  };
++
++  StepProfiler() = default;
++  ~StepProfiler() = default;
++
++  Call* FindRunning(uint64_t id) {
++    auto it = running_.find(id);
++    return it == running_.end() ? nullptr : &it->second;
++  }
++
++  void RemoveSource(int id) { sources_.erase(id); }
++
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(ReleasedMemory)> done) {
++    ReleasedMemory released;
++    released.items = recent_.size();
++    recent_.clear();
++    std::move(done).Run(released);
++  }
++
++  std::map<uint64_t, Call> running_;
++  base::circular_deque<Call> recent_;
++  uint64_t next_id_ = 1;
++
++  std::map<int, ComponentSource> sources_;
++  int next_source_id_ = 0;
++
++  base::ScopedClosureRunner memory_pressure_registration_;
++};
++
++}  // namespace
++
++ProfiledCall::ProfiledCall() = default;
++
++ProfiledCall::ProfiledCall(std::string_view function,
++                           base::TimeTicks start,
++                           std::string_view first_phase)
++    : id_(StepProfiler::Get()->Begin(function, start, first_phase)) {}
++
++ProfiledCall::ProfiledCall(ProfiledCall&& other)
++    : id_(std::exchange(other.id_, 0)) {}
++
++ProfiledCall& ProfiledCall::operator=(ProfiledCall&& other) {
++  if (this != &other) {
++    Finish(false);
++    id_ = std::exchange(other.id_, 0);
++  }
++  return *this;
++}
++
++ProfiledCall::~ProfiledCall() {
++  Finish(false);
++}
++
++void ProfiledCall::set_tab_id(int tab_id) {
++  if (id_) {
++    StepProfiler::Get()->SetTabId(id_, tab_id);
++  }
++}
++
++void ProfiledCall::StartPhase(std::string_view phase) {
++  if (id_) {
++    StepProfiler::Get()->StartPhase(id_, phase);
++  }
++}
++
++void ProfiledCall::Finish(bool success) {
++  if (id_) {
++    StepProfiler::Get()->Finish(std::exchange(id_, 0), success);
++  }
++}
++
++base::ScopedClosureRunner AddStepProfilerSource(std::string component,
++                                                StepProfilerSource source) {
++  return StepProfiler::Get()->AddSource(std::move(component),
++                                        std::move(source));
++}
++
++void CollectStepProfile(base::OnceCallback<void(base::Value::Dict)> done) {
++  StepProfiler::Get()->Collect(std::move(done));
++}
++
++}  // namespace browseros
@@ -0,0 +1,83 @@
+diff --git a/chrome/browser/browseros/core/browseros_step_profiler.h b/chrome/browser/browseros/core/browseros_step_profiler.h
+new file mode 100644
+index 0000000000000..f2b729088096d
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_step_profiler.h
+@@ -0,0 +1,77 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STEP_PROFILER_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STEP_PROFILER_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <string>
++#include <string_view>
++
++#include "base/functional/callback.h"
++#include "base/functional/callback_helpers.h"
++#include "base/time/time.h"
++#include "base/values.h"
++
++namespace browseros {
++
++// Where recent browserOS calls spent their time, for
++// chrome://browseros-internals. Each call is split into consecutive named
++// phases, e.g. "queued", "ax_request", "processing" and "encoding", the first
++// of them starting when the call was dispatched. The last kMaxProfiledCalls
++// finished calls are kept, along with the ones still running, and dropped on
++// memory pressure.
++//
++// Components report their current state, like queue depths, cache hit
++// counts and store sizes, through sources that are only read while the page
++// polls. UI thread only.
++inline constexpr size_t kMaxProfiledCalls = 200;
++
++// Handle to one profiled call. A call destroyed without Finish() is
++// recorded as failed, like one that responded with an error.
++class ProfiledCall {
++ public:
++  // Profiles nothing
++  ProfiledCall();
++  // Starts profiling |function|, dispatched at |start|, in |first_phase|
++  ProfiledCall(std::string_view function,
++               base::TimeTicks start,
++               std::string_view first_phase);
++  ProfiledCall(ProfiledCall&& other);
++  ProfiledCall& operator=(ProfiledCall&& other);
++  ~ProfiledCall();
++
++  void set_tab_id(int tab_id);
++
++  // Ends the running phase and starts |phase|
++  void StartPhase(std::string_view phase);
++
++  // Ends the call; later calls on this handle are ignored
++  void Finish(bool success);
++
++ private:
++  // 0 when not profiling
++  uint64_t id_ = 0;
++};
++
++// Reports a component's current state by running |done| with a dictionary,
++// possibly later, e.g. after a hop to the IO thread.
++using StepProfilerSource = base::RepeatingCallback<void(
++    base::OnceCallback<void(base::Value::Dict)> done)>;
++
++// |source| is read until the returned runner goes away. Reports of sources
++// registered under the same |component|, like one per profile, are listed
++// together.
++[[nodiscard]] base::ScopedClosureRunner AddStepProfilerSource(
++    std::string component,
++    StepProfilerSource source);
++
++// Runs |done| once every source has reported, with the recent and running
++// calls under "calls" and the reports under "sources", keyed by component
++void CollectStepProfile(base::OnceCallback<void(base::Value::Dict)> done);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STEP_PROFILER_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_switches.h b/chrome/browser/browseros/core/browseros_switches.h
 new file mode 100644
-index 0000000000000..dcd8b3ae307f2
+index 0000000000000..24afa89b267c0
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_switches.h
-@@ -0,0 +1,86 @@
+@@ -0,0 +1,130 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -48,6 +48,46 @@ index 0000000000000..dcd8b3ae307f2
 +// Overrides the Extension server port.
 +inline constexpr char kExtensionPort[] = "browseros-extension-port";
 +
++// Has the sidecar backend also serve on a Unix domain socket in the execution
++// directory, which the MCP proxy then forwards over (POSIX only).
++inline constexpr char kServerSocket[] = "browseros-server-socket";
++
++// Number of sidecar server processes the MCP proxy balances across
++// (1-8, default 1).
++inline constexpr char kServerWorkers[] = "browseros-server-workers";
++
++// Turns on fleet mode: the MCP proxy takes capacity reports from other
++// BrowserOS instances sharing this token, and sends them new MCP sessions
++// once its own are used up.
++inline constexpr char kFleetToken[] = "browseros-fleet-token";
++
++// Fleet coordinator this instance reports its capacity to, as
++// "address:port" with an IP literal, e.g. "10.0.0.2:9000".
++inline constexpr char kFleetCoordinator[] = "browseros-fleet-coordinator";
++
++// Active MCP sessions a fleet instance serves itself (default 8).
++inline constexpr char kFleetMaxSessions[] = "browseros-fleet-max-sessions";
++
++// How long the MCP proxy holds requests while the sidecar restarts, in
++// seconds, before answering 503. 0 answers 503 right away.
++inline constexpr char kProxyHoldTime[] = "browseros-proxy-hold-time";
++
++// Has the MCP proxy forward every tool call to the sidecar instead of
++// serving the hot ones in the browser.
++inline constexpr char kDisableMcpFastPath[] =
++    "disable-browseros-mcp-fast-path";
++
++// Niceness the sidecar server runs at (0-19). On Windows any positive value
++// lowers its priority class.
++inline constexpr char kServerNice[] = "browseros-server-nice";
++
++// Caps the sidecar server's memory, in MB.
++inline constexpr char kServerMemoryLimit[] = "browseros-server-memory-limit";
++
++// Comma-separated CPU cores the sidecar server may run on, e.g. "2,3"
++// (Linux and Windows).
++inline constexpr char kServerCpuAffinity[] = "browseros-server-cpu-affinity";
++
 +// === Extension Switches ===
 +
 +// Disables BrowserOS managed extensions.
@@ -56,6 +96,10 @@ index 0000000000000..dcd8b3ae307f2
 +// Overrides the extensions config URL.
 +inline constexpr char kExtensionsUrl[] = "browseros-extensions-url";
 +
++// Also reports browserOS API call telemetry as aggregated BrowserOSMetrics
++// events, on top of the UMA histograms.
++inline constexpr char kApiMetricsRollup[] = "browseros-api-metrics-rollup";
++
 +// === URL Override Switches ===
 +
 +// Disables chrome://browseros/* URL overrides.
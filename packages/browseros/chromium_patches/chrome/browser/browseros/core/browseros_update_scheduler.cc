@@ -0,0 +1,223 @@
+diff --git a/chrome/browser/browseros/core/browseros_update_scheduler.cc b/chrome/browser/browseros/core/browseros_update_scheduler.cc
+new file mode 100644
+index 0000000000000..d7a56c85ae760
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_update_scheduler.cc
+@@ -0,0 +1,217 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_update_scheduler.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/power_monitor/power_monitor.h"
++#include "base/rand_util.h"
++#include "chrome/browser/browseros/core/browseros_agent_activity.h"
++#include "content/public/browser/browser_thread.h"
++
++namespace browseros {
++
++namespace {
++
++// The first check of each client waits this long, plus its stagger and
++// jitter, so it stays clear of startup
++constexpr base::TimeDelta kFirstCheckDelay = base::Minutes(2);
++
++// Extra delay of each client's first check over the previous client's
++constexpr base::TimeDelta kClientStagger = base::Minutes(3);
++
++// Random delay added to the first check
++constexpr base::TimeDelta kFirstCheckJitter = base::Minutes(2);
++
++// Fraction of the interval each later check may move either way
++constexpr double kIntervalJitter = 0.1;
++
++// Minimum time between two checks of any clients
++constexpr base::TimeDelta kMinCheckSpacing = base::Minutes(1);
++
++// An agent active within this long counts as the machine being busy
++constexpr base::TimeDelta kAgentBusyPeriod = base::Minutes(5);
++
++// How often idleness is re-evaluated while downloads are waiting
++constexpr base::TimeDelta kIdleRecheckInterval = base::Minutes(5);
++
++// A download waiting this long runs regardless of idleness
++constexpr base::TimeDelta kMaxDownloadDeferral = base::Hours(12);
++
++const char* GetClientName(BrowserOSUpdateScheduler::Client client) {
++  switch (client) {
++    case BrowserOSUpdateScheduler::Client::kBrowser:
++      return "browser";
++    case BrowserOSUpdateScheduler::Client::kServer:
++      return "server";
++  }
++}
++
++}  // namespace
++
++BrowserOSUpdateScheduler::ClientState::ClientState() = default;
++BrowserOSUpdateScheduler::ClientState::~ClientState() = default;
++
++// static
++BrowserOSUpdateScheduler* BrowserOSUpdateScheduler::GetInstance() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  static base::NoDestructor<BrowserOSUpdateScheduler> instance;
++  return instance.get();
++}
++
++BrowserOSUpdateScheduler::BrowserOSUpdateScheduler() {
++  auto* power_monitor = base::PowerMonitor::GetInstance();
++  power_monitor->AddPowerStateObserver(this);
++  thermal_state_ = power_monitor->AddPowerThermalObserverAndReturnThermalState(
++      this);
++  agent_activity_subscription_ = AddAgentActivityCallback(
++      base::BindRepeating(&BrowserOSUpdateScheduler::OnAgentActivity,
++                          base::Unretained(this)));
++}
++
++BrowserOSUpdateScheduler::~BrowserOSUpdateScheduler() {
++  auto* power_monitor = base::PowerMonitor::GetInstance();
++  power_monitor->RemovePowerThermalObserver(this);
++  power_monitor->RemovePowerStateObserver(this);
++}
++
++void BrowserOSUpdateScheduler::RegisterClient(Client client,
++                                              base::TimeDelta interval,
++                                              base::RepeatingClosure check) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  ClientState& state = GetState(client);
++  state.interval = interval;
++  state.check = std::move(check);
++
++  const base::TimeDelta delay =
++      kFirstCheckDelay + kClientStagger * static_cast<int>(client) +
++      base::RandTimeDelta(base::TimeDelta(), kFirstCheckJitter);
++  VLOG(1) << "browseros: First " << GetClientName(client)
++          << " update check in " << delay.InSeconds() << "s";
++  ScheduleCheck(client, delay);
++}
++
++void BrowserOSUpdateScheduler::UnregisterClient(Client client) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  ClientState& state = GetState(client);
++  state.check_timer.Stop();
++  state.check.Reset();
++  state.pending_download.Reset();
++  MaybeRunDownloads();
++}
++
++void BrowserOSUpdateScheduler::RunWhenIdle(Client client,
++                                           base::OnceClosure download) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  if (IsIdle()) {
++    std::move(download).Run();
++    return;
++  }
++
++  LOG(INFO) << "browseros: Deferring " << GetClientName(client)
++            << " update download until the machine is idle";
++  ClientState& state = GetState(client);
++  if (!state.pending_download) {
++    state.deferred_since = base::TimeTicks::Now();
++  }
++  state.pending_download = std::move(download);
++  if (!idle_recheck_timer_.IsRunning()) {
++    idle_recheck_timer_.Start(FROM_HERE, kIdleRecheckInterval, this,
++                              &BrowserOSUpdateScheduler::MaybeRunDownloads);
++  }
++}
++
++bool BrowserOSUpdateScheduler::IsIdle() const {
++  if (base::PowerMonitor::GetInstance()->IsOnBatteryPower()) {
++    return false;
++  }
++  if (thermal_state_ == DeviceThermalState::kSerious ||
++      thermal_state_ == DeviceThermalState::kCritical) {
++    return false;
++  }
++  return last_agent_activity_.is_null() ||
++         base::TimeTicks::Now() - last_agent_activity_ >= kAgentBusyPeriod;
++}
++
++void BrowserOSUpdateScheduler::OnBatteryPowerStatusChange(
++    base::PowerStateObserver::BatteryPowerStatus battery_power_status) {
++  MaybeRunDownloads();
++}
++
++void BrowserOSUpdateScheduler::OnThermalStateChange(
++    DeviceThermalState new_state) {
++  thermal_state_ = new_state;
++  MaybeRunDownloads();
++}
++
++BrowserOSUpdateScheduler::ClientState& BrowserOSUpdateScheduler::GetState(
++    Client client) {
++  return clients_[static_cast<size_t>(client)];
++}
++
++void BrowserOSUpdateScheduler::ScheduleCheck(Client client,
++                                             base::TimeDelta delay) {
++  GetState(client).check_timer.Start(
++      FROM_HERE, delay,
++      base::BindOnce(&BrowserOSUpdateScheduler::OnCheckTimer,
++                     base::Unretained(this), client));
++}
++
++void BrowserOSUpdateScheduler::OnCheckTimer(Client client) {
++  ClientState& state = GetState(client);
++  if (!state.check) {
++    return;
++  }
++
++  // Keep clients that came due together from fetching at the same time
++  const base::TimeTicks now = base::TimeTicks::Now();
++  if (!last_check_time_.is_null() &&
++      now - last_check_time_ < kMinCheckSpacing) {
++    ScheduleCheck(client, last_check_time_ + kMinCheckSpacing - now);
++    return;
++  }
++  last_check_time_ = now;
++
++  const double jitter = base::RandDouble() * 2 * kIntervalJitter -
++                        kIntervalJitter;
++  ScheduleCheck(client, state.interval * (1 + jitter));
++
++  VLOG(1) << "browseros: Running " << GetClientName(client)
++          << " update check";
++  state.check.Run();
++}
++
++void BrowserOSUpdateScheduler::MaybeRunDownloads() {
++  const bool idle = IsIdle();
++  const base::TimeTicks now = base::TimeTicks::Now();
++  for (size_t i = 0; i < clients_.size(); ++i) {
++    ClientState& state = clients_[i];
++    if (!state.pending_download) {
++      continue;
++    }
++    if (!idle && now - state.deferred_since < kMaxDownloadDeferral) {
++      continue;
++    }
++    LOG(INFO) << "browseros: Starting deferred "
++              << GetClientName(static_cast<Client>(i))
++              << " update download";
++    std::move(state.pending_download).Run();
++  }
++
++  if (std::ranges::none_of(clients_, [](const ClientState& state) {
++        return !state.pending_download.is_null();
++      })) {
++    idle_recheck_timer_.Stop();
++  }
++}
++
++void BrowserOSUpdateScheduler::OnAgentActivity() {
++  last_agent_activity_ = base::TimeTicks::Now();
++}
++
++}  // namespace browseros
@@ -0,0 +1,118 @@
+diff --git a/chrome/browser/browseros/core/browseros_update_scheduler.h b/chrome/browser/browseros/core/browseros_update_scheduler.h
+new file mode 100644
+index 0000000000000..9c69a23339c44
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_update_scheduler.h
+@@ -0,0 +1,112 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_UPDATE_SCHEDULER_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_UPDATE_SCHEDULER_H_
++
++#include <array>
++
++#include "base/callback_list.h"
++#include "base/functional/callback.h"
++#include "base/no_destructor.h"
++#include "base/power_monitor/power_observer.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++
++namespace browseros {
++
++// Decides when BrowserOS looks for and downloads updates, for both the
++// browser (Sparkle on macOS) and the BrowserOS server sidecar.
++//
++// Checks are staggered: the first ones wait until well after startup, each
++// client at a different offset, and no two checks run closer together than
++// a minimum spacing. Every interval is jittered so that installs started at
++// the same time don't hit the CDN in lockstep. Downloads handed to
++// RunWhenIdle() wait while the machine is on battery, thermally throttled
++// or driven by an agent, but never longer than a fixed cap.
++//
++// UI thread only.
++class BrowserOSUpdateScheduler : public base::PowerStateObserver,
++                                 public base::PowerThermalObserver {
++ public:
++  enum class Client {
++    kBrowser,
++    kServer,
++    kMaxValue = kServer,
++  };
++
++  static BrowserOSUpdateScheduler* GetInstance();
++
++  BrowserOSUpdateScheduler(const BrowserOSUpdateScheduler&) = delete;
++  BrowserOSUpdateScheduler& operator=(const BrowserOSUpdateScheduler&) =
++      delete;
++
++  // Runs |check| about every |interval| until UnregisterClient(). Replaces
++  // an earlier registration of |client|.
++  void RegisterClient(Client client,
++                      base::TimeDelta interval,
++                      base::RepeatingClosure check);
++
++  // Stops the checks of |client| and drops its deferred download, if any.
++  void UnregisterClient(Client client);
++
++  // Runs |download| now if the machine is idle, otherwise once it is.
++  // Replaces a download of |client| that is still waiting.
++  void RunWhenIdle(Client client, base::OnceClosure download);
++
++  // Whether a download would run right now.
++  bool IsIdle() const;
++
++ private:
++  friend base::NoDestructor<BrowserOSUpdateScheduler>;
++
++  struct ClientState {
++    ClientState();
++    ~ClientState();
++
++    base::TimeDelta interval;
++    base::RepeatingClosure check;
++    base::OneShotTimer check_timer;
++    base::OnceClosure pending_download;
++    base::TimeTicks deferred_since;
++  };
++
++  BrowserOSUpdateScheduler();
++  ~BrowserOSUpdateScheduler() override;
++
++  // base::PowerStateObserver:
++  void OnBatteryPowerStatusChange(
++      base::PowerStateObserver::BatteryPowerStatus battery_power_status)
++      override;
++
++  // base::PowerThermalObserver:
++  void OnThermalStateChange(DeviceThermalState new_state) override;
++  void OnSpeedLimitChange(int speed_limit) override {}
++
++  ClientState& GetState(Client client);
++
++  void ScheduleCheck(Client client, base::TimeDelta delay);
++  void OnCheckTimer(Client client);
++
++  // Runs the waiting downloads if idle, or those waiting too long
++  void MaybeRunDownloads();
++
++  void OnAgentActivity();
++
++  std::array<ClientState, static_cast<size_t>(Client::kMaxValue) + 1>
++      clients_;
++
++  base::TimeTicks last_check_time_;
++  base::TimeTicks last_agent_activity_;
++  DeviceThermalState thermal_state_ = DeviceThermalState::kUnknown;
++
++  // Re-evaluates idleness while downloads are waiting
++  base::RepeatingTimer idle_recheck_timer_;
++
++  base::CallbackListSubscription agent_activity_subscription_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_UPDATE_SCHEDULER_H_
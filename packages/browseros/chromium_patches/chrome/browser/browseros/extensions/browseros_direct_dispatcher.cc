@@ -0,0 +1,110 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_direct_dispatcher.cc b/chrome/browser/browseros/extensions/browseros_direct_dispatcher.cc
+new file mode 100644
+index 0000000000000..780576d1c53a6
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_direct_dispatcher.cc
+@@ -0,0 +1,104 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/extensions/browseros_direct_dispatcher.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/strings/strcat.h"
++#include "base/uuid.h"
++#include "chrome/browser/browseros/core/browseros_constants.h"
++#include "content/public/browser/browser_context.h"
++#include "extensions/browser/extension_function.h"
++#include "extensions/browser/extension_function_registry.h"
++#include "extensions/browser/extension_registry.h"
++#include "extensions/common/extension.h"
++#include "extensions/common/mojom/context_type.mojom.h"
++#include "extensions/common/permissions/permissions_data.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr char kFunctionPrefix[] = "browserOS.";
++
++// Only one profile serves direct calls at a time
++bool g_handler_claimed = false;
++
++void OnFunctionResponded(DirectCallReplyCallback reply,
++                         ExtensionFunction::ResponseType type,
++                         base::Value::List results,
++                         const std::string& error,
++                         extensions::mojom::ExtraResponseDataPtr) {
++  if (type == ExtensionFunction::ResponseType::kSucceeded) {
++    std::move(reply).Run(std::move(results));
++    return;
++  }
++  std::move(reply).Run(base::unexpected(error.empty() ? "Call failed" : error));
++}
++
++}  // namespace
++
++BrowserOSDirectDispatcher::BrowserOSDirectDispatcher(
++    content::BrowserContext* context)
++    : context_(context) {
++  if (g_handler_claimed) {
++    return;
++  }
++  g_handler_claimed = true;
++  owns_handler_ = true;
++  SetDirectCallHandler(base::BindRepeating(
++      &BrowserOSDirectDispatcher::Dispatch, base::Unretained(this)));
++}
++
++BrowserOSDirectDispatcher::~BrowserOSDirectDispatcher() = default;
++
++void BrowserOSDirectDispatcher::Shutdown() {
++  if (owns_handler_) {
++    SetDirectCallHandler(DirectCallHandler());
++    g_handler_claimed = false;
++    owns_handler_ = false;
++  }
++  context_ = nullptr;
++}
++
++void BrowserOSDirectDispatcher::Dispatch(std::string function,
++                                         base::Value::List args,
++                                         DirectCallReplyCallback reply) {
++  const extensions::Extension* extension =
++      extensions::ExtensionRegistry::Get(context_)
++          ->enabled_extensions()
++          .GetByID(kControllerExtensionId);
++  if (!extension ||
++      !extension->permissions_data()->HasAPIPermission("browserOS")) {
++    std::move(reply).Run(
++        base::unexpected("BrowserOS controller extension is not enabled"));
++    return;
++  }
++
++  const std::string name = base::StrCat({kFunctionPrefix, function});
++  scoped_refptr<ExtensionFunction> extension_function =
++      ExtensionFunctionRegistry::GetInstance().NewFunction(name);
++  if (!extension_function) {
++    std::move(reply).Run(base::unexpected("Unknown function: " + name));
++    return;
++  }
++
++  VLOG(1) << "browseros: Direct call " << name;
++  extension_function->set_extension(extension);
++  extension_function->set_browser_context(context_);
++  extension_function->set_source_context_type(
++      extensions::mojom::ContextType::kPrivilegedExtension);
++  extension_function->set_request_uuid(base::Uuid::GenerateRandomV4());
++  extension_function->set_has_callback(true);
++  extension_function->SetArgs(std::move(args));
++  extension_function->set_response_callback(
++      base::BindOnce(&OnFunctionResponded, std::move(reply)));
++  extension_function->RunWithValidation().Execute();
++}
++
++}  // namespace browseros
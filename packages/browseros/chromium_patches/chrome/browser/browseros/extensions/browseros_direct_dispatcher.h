@@ -0,0 +1,58 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_direct_dispatcher.h b/chrome/browser/browseros/extensions/browseros_direct_dispatcher.h
+new file mode 100644
+index 0000000000000..7543fcbb1adc1
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_direct_dispatcher.h
+@@ -0,0 +1,52 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_DIRECT_DISPATCHER_H_
++#define CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_DIRECT_DISPATCHER_H_
++
++#include <string>
++
++#include "base/memory/raw_ptr.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_direct_call.h"
++#include "components/keyed_service/core/keyed_service.h"
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace browseros {
++
++// Runs browserOS functions for the server proxy's /browseros/call/ route
++// (see SetDirectCallHandler()). Calls are created from the extension
++// function registry and run on behalf of the controller extension, exactly
++// as if the extension had made them, but without the hop through its
++// service worker.
++//
++// The first regular profile to create one owns the process-wide handler
++// until it shuts down.
++class BrowserOSDirectDispatcher : public KeyedService {
++ public:
++  explicit BrowserOSDirectDispatcher(content::BrowserContext* context);
++  ~BrowserOSDirectDispatcher() override;
++
++  BrowserOSDirectDispatcher(const BrowserOSDirectDispatcher&) = delete;
++  BrowserOSDirectDispatcher& operator=(const BrowserOSDirectDispatcher&) =
++      delete;
++
++  // KeyedService:
++  void Shutdown() override;
++
++ private:
++  void Dispatch(std::string function,
++                base::Value::List args,
++                DirectCallReplyCallback reply);
++
++  raw_ptr<content::BrowserContext> context_;
++  bool owns_handler_ = false;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_DIRECT_DISPATCHER_H_
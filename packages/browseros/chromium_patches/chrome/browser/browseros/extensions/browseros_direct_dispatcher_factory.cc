@@ -0,0 +1,66 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_direct_dispatcher_factory.cc b/chrome/browser/browseros/extensions/browseros_direct_dispatcher_factory.cc
+new file mode 100644
+index 0000000000000..a1156f3246bea
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_direct_dispatcher_factory.cc
+@@ -0,0 +1,60 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/extensions/browseros_direct_dispatcher_factory.h"
++
++#include <memory>
++
++#include "base/no_destructor.h"
++#include "chrome/browser/browseros/extensions/browseros_direct_dispatcher.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/keyed_service/content/browser_context_dependency_manager.h"
++#include "content/public/browser/browser_context.h"
++#include "extensions/browser/extension_registry_factory.h"
++
++namespace browseros {
++
++// static
++BrowserOSDirectDispatcher*
++BrowserOSDirectDispatcherFactory::GetForBrowserContext(
++    content::BrowserContext* context) {
++  return static_cast<BrowserOSDirectDispatcher*>(
++      GetInstance()->GetServiceForBrowserContext(context, true));
++}
++
++// static
++BrowserOSDirectDispatcherFactory*
++BrowserOSDirectDispatcherFactory::GetInstance() {
++  static base::NoDestructor<BrowserOSDirectDispatcherFactory> instance;
++  return instance.get();
++}
++
++BrowserOSDirectDispatcherFactory::BrowserOSDirectDispatcherFactory()
++    : BrowserContextKeyedServiceFactory(
++          "BrowserOSDirectDispatcher",
++          BrowserContextDependencyManager::GetInstance()) {
++  DependsOn(extensions::ExtensionRegistryFactory::GetInstance());
++}
++
++BrowserOSDirectDispatcherFactory::~BrowserOSDirectDispatcherFactory() = default;
++
++std::unique_ptr<KeyedService>
++BrowserOSDirectDispatcherFactory::BuildServiceInstanceForBrowserContext(
++    content::BrowserContext* context) const {
++  Profile* profile = Profile::FromBrowserContext(context);
++
++  // BrowserOS extensions don't run in incognito profiles
++  if (profile->IsOffTheRecord()) {
++    return nullptr;
++  }
++
++  return std::make_unique<BrowserOSDirectDispatcher>(context);
++}
++
++bool BrowserOSDirectDispatcherFactory::ServiceIsCreatedWithBrowserContext()
++    const {
++  return true;
++}
++
++}  // namespace browseros
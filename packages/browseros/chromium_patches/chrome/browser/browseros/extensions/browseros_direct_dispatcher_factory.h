@@ -0,0 +1,58 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_direct_dispatcher_factory.h b/chrome/browser/browseros/extensions/browseros_direct_dispatcher_factory.h
+new file mode 100644
+index 0000000000000..5c08454ca857a
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_direct_dispatcher_factory.h
+@@ -0,0 +1,52 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_DIRECT_DISPATCHER_FACTORY_H_
++#define CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_DIRECT_DISPATCHER_FACTORY_H_
++
++#include "base/no_destructor.h"
++#include "components/keyed_service/content/browser_context_keyed_service_factory.h"
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace browseros {
++
++class BrowserOSDirectDispatcher;
++
++// Factory for creating BrowserOSDirectDispatcher instances per profile. The
++// service is created with the profile so direct calls work before the
++// controller extension is first used.
++class BrowserOSDirectDispatcherFactory
++    : public BrowserContextKeyedServiceFactory {
++ public:
++  BrowserOSDirectDispatcherFactory(const BrowserOSDirectDispatcherFactory&) =
++      delete;
++  BrowserOSDirectDispatcherFactory& operator=(
++      const BrowserOSDirectDispatcherFactory&) = delete;
++
++  // Returns the BrowserOSDirectDispatcher for |context|, creating one if
++  // needed.
++  static BrowserOSDirectDispatcher* GetForBrowserContext(
++      content::BrowserContext* context);
++
++  // Returns the singleton factory instance.
++  static BrowserOSDirectDispatcherFactory* GetInstance();
++
++ private:
++  friend base::NoDestructor<BrowserOSDirectDispatcherFactory>;
++
++  BrowserOSDirectDispatcherFactory();
++  ~BrowserOSDirectDispatcherFactory() override;
++
++  // BrowserContextKeyedServiceFactory:
++  std::unique_ptr<KeyedService> BuildServiceInstanceForBrowserContext(
++      content::BrowserContext* context) const override;
++  bool ServiceIsCreatedWithBrowserContext() const override;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_DIRECT_DISPATCHER_FACTORY_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_installer.cc b/chrome/browser/browseros/extensions/browseros_extension_installer.cc
 new file mode 100644
-index 0000000000000..e84ab10537ec4
+index 0000000000000..42ff37446aebf
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_installer.cc
-@@ -0,0 +1,338 @@
+@@ -0,0 +1,359 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,6 +13,7 @@ index 0000000000000..e84ab10537ec4
 +#include <utility>
 +
 +#include "base/feature_list.h"
++#include "base/files/file.h"
 +#include "base/files/file_util.h"
 +#include "base/json/json_reader.h"
 +#include "base/logging.h"
@@ -24,6 +25,7 @@ index 0000000000000..e84ab10537ec4
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/common/chrome_paths.h"
 +#include "content/public/browser/storage_partition.h"
++#include "extensions/browser/extension_registry.h"
 +#include "net/base/load_flags.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
 +#include "services/network/public/cpp/resource_request.h"
@@ -75,17 +77,30 @@ index 0000000000000..e84ab10537ec4
 +
 +  LOG(INFO) << "browseros: Starting extension installation";
 +
-+  // TODO(nikhil): Re-enable bundled extension loading once OTA update flow is
-+  // fully validated. Remote install is now fast with InstallPendingNow fix.
-+#if 0
-+  if (TryLoadFromBundled()) {
++  // TODO(nikhil): Use bundled extensions on every startup once OTA update
++  // flow is fully validated. Until then the bundled CRXs, validated at build
++  // time, only serve first run so the agent works before any download.
++  if (!HasInstalledBrowserOSExtensions() && TryLoadFromBundled()) {
 +    return;
 +  }
-+#endif
 +
 +  FetchFromRemote();
 +}
 +
++bool BrowserOSExtensionInstaller::HasInstalledBrowserOSExtensions() const {
++  extensions::ExtensionRegistry* registry =
++      extensions::ExtensionRegistry::Get(profile_);
++  if (!registry) {
++    return false;
++  }
++  for (const std::string& id : extension_ids_) {
++    if (registry->GetInstalledExtension(id)) {
++      return true;
++    }
++  }
++  return false;
++}
++
 +bool BrowserOSExtensionInstaller::TryLoadFromBundled() {
 +  base::FilePath bundled_path;
 +  if (!base::PathService::Get(chrome::DIR_BROWSEROS_BUNDLED_EXTENSIONS,
@@ -94,14 +109,11 @@ index 0000000000000..e84ab10537ec4
 +    return false;
 +  }
 +
++  // A missing manifest is found on the ThreadPool, not here on the UI thread;
++  // the empty result falls back to the remote config
 +  base::FilePath manifest_path =
 +      bundled_path.Append(FILE_PATH_LITERAL("bundled_extensions.json"));
 +
-+  if (!base::PathExists(manifest_path)) {
-+    LOG(INFO) << "browseros: No bundled manifest at " << manifest_path.value();
-+    return false;
-+  }
-+
 +  LOG(INFO) << "browseros: Loading from bundled at " << bundled_path.value();
 +
 +  base::ThreadPool::PostTaskAndReplyWithResult(
@@ -120,7 +132,7 @@ index 0000000000000..e84ab10537ec4
 +    const base::FilePath& bundled_path) {
 +  std::string json_content;
 +  if (!base::ReadFileToString(manifest_path, &json_content)) {
-+    LOG(ERROR) << "browseros: Failed to read bundled manifest";
++    LOG(INFO) << "browseros: No bundled manifest at " << manifest_path.value();
 +    return base::Value::Dict();
 +  }
 +
@@ -163,10 +175,19 @@ index 0000000000000..e84ab10537ec4
 +    base::FilePath crx_path =
 +        bundled_path.Append(base::FilePath::FromUTF8Unsafe(*crx_file));
 +
-+    if (!base::PathExists(crx_path)) {
++    // The build validated each CRX and recorded its size; a size mismatch
++    // means the file was truncated or replaced after packaging
++    base::File::Info crx_info;
++    if (!base::GetFileInfo(crx_path, &crx_info)) {
 +      LOG(WARNING) << "browseros: CRX not found: " << crx_path.value();
 +      continue;
 +    }
++    std::optional<int> expected_size = config_dict.FindInt("size");
++    if (expected_size && crx_info.size != *expected_size) {
++      LOG(WARNING) << "browseros: CRX size mismatch for " << extension_id
++                   << ": " << crx_info.size << " != " << *expected_size;
++      continue;
++    }
 +
 +    base::Value::Dict ext_prefs;
 +    ext_prefs.Set(extensions::ExternalProviderImpl::kExternalCrx,
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_installer.h b/chrome/browser/browseros/extensions/browseros_extension_installer.h
 new file mode 100644
-index 0000000000000..7502da6d31ff5
+index 0000000000000..aeb2272e232b6
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_installer.h
-@@ -0,0 +1,99 @@
+@@ -0,0 +1,103 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -65,6 +65,10 @@ index 0000000000000..7502da6d31ff5
 +                         InstallCompleteCallback callback);
 +
 + private:
++  // Whether any BrowserOS extension is already installed, i.e. this is not
++  // the first run for the profile.
++  bool HasInstalledBrowserOSExtensions() const;
++
 +  // Attempts to load from bundled CRX files. Returns true if attempting.
 +  bool TryLoadFromBundled();
 +
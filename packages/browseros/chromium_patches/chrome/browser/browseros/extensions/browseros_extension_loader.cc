@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_loader.cc b/chrome/browser/browseros/extensions/browseros_extension_loader.cc
 new file mode 100644
-index 0000000000000..52703e88e7478
+index 0000000000000..46e3d929c6e1d
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_loader.cc
-@@ -0,0 +1,212 @@
+@@ -0,0 +1,225 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -17,9 +17,11 @@ index 0000000000000..52703e88e7478
 +#include "base/task/single_thread_task_runner.h"
 +#include "chrome/browser/browser_features.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
++#include "chrome/browser/browseros/core/browseros_startup_timing.h"
 +#include "chrome/browser/extensions/external_provider_impl.h"
 +#include "chrome/browser/extensions/updater/extension_updater.h"
 +#include "chrome/browser/profiles/profile.h"
++#include "content/public/browser/browser_thread.h"
 +#include "extensions/browser/extension_registry.h"
 +#include "extensions/browser/pending_extension_manager.h"
 +#include "extensions/common/extension.h"
@@ -62,10 +64,20 @@ index 0000000000000..52703e88e7478
 +
 +void BrowserOSExtensionLoader::StartLoading() {
 +  LOG(INFO) << "browseros: Extension loader starting";
++  browseros::BeginStartupPhase(browseros::StartupPhase::kExtensionInstall);
 +
 +  installer_ = std::make_unique<BrowserOSExtensionInstaller>(profile_);
 +  maintainer_ = std::make_unique<BrowserOSExtensionMaintainer>(profile_);
 +
++  // Reading the bundle or fetching the config competes with the first
++  // window, so it waits until best-effort tasks run after startup
++  content::BrowserThread::PostBestEffortTask(
++      FROM_HERE, base::SingleThreadTaskRunner::GetCurrentDefault(),
++      base::BindOnce(&BrowserOSExtensionLoader::StartInstallation,
++                     weak_ptr_factory_.GetWeakPtr()));
++}
++
++void BrowserOSExtensionLoader::StartInstallation() {
 +  installer_->StartInstallation(
 +      config_url_,
 +      base::BindOnce(&BrowserOSExtensionLoader::OnInstallComplete,
@@ -73,6 +85,7 @@ index 0000000000000..52703e88e7478
 +}
 +
 +void BrowserOSExtensionLoader::OnInstallComplete(InstallResult result) {
++  browseros::EndStartupPhase(browseros::StartupPhase::kExtensionInstall);
 +  if (result.from_bundled) {
 +    bundled_crx_base_path_ = result.bundled_path;
 +  }
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_loader.h b/chrome/browser/browseros/extensions/browseros_extension_loader.h
 new file mode 100644
-index 0000000000000..c0b26b369ad07
+index 0000000000000..2a78c6617384b
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_loader.h
-@@ -0,0 +1,81 @@
+@@ -0,0 +1,84 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -55,6 +55,9 @@ index 0000000000000..c0b26b369ad07
 + private:
 +  friend class base::RefCountedThreadSafe<extensions::ExternalLoader>;
 +
++  // Runs the installer once browser startup has finished.
++  void StartInstallation();
++
 +  // Called when installer completes.
 +  void OnInstallComplete(InstallResult result);
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc b/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc
 new file mode 100644
-index 0000000000000..fec50b08b130c
+index 0000000000000..85bc9019e2542
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc
-@@ -0,0 +1,381 @@
+@@ -0,0 +1,461 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -31,9 +31,13 @@ index 0000000000000..fec50b08b130c
 +#include "extensions/common/extension.h"
 +#include "extensions/common/mojom/manifest.mojom-shared.h"
 +#include "net/base/load_flags.h"
++#include "net/http/http_request_headers.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
 +#include "services/network/public/cpp/resource_request.h"
 +#include "services/network/public/cpp/simple_url_loader.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
 +
 +namespace browseros {
 +
@@ -42,13 +46,19 @@ index 0000000000000..fec50b08b130c
 +constexpr base::TimeDelta kMaintenanceInterval = base::Minutes(15);
 +constexpr base::TimeDelta kInitialMaintenanceDelay = base::Seconds(60);
 +
++// Delay before repairing after a registry event, so that a burst of events
++// and the uninstalls done by maintenance itself settle first
++constexpr base::TimeDelta kRepairDelay = base::Seconds(5);
++
 +constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
 +    net::DefineNetworkTrafficAnnotation("browseros_extension_maintenance", R"(
 +        semantics {
 +          sender: "BrowserOS Extension Maintainer"
 +          description:
 +            "Fetches JSON configuration for BrowserOS extension maintenance."
-+          trigger: "Periodic maintenance cycle (every 15 minutes)."
++          trigger:
++            "Periodic maintenance cycle (every 15 minutes). The request is "
++            "conditional on the ETag of the previous response."
 +          data: "No user data. GET request only."
 +          destination: OTHER
 +          destination_other: "BrowserOS configuration server."
@@ -73,6 +83,11 @@ index 0000000000000..fec50b08b130c
 +  extension_ids_ = std::move(extension_ids);
 +  last_config_ = std::move(initial_config);
 +
++  if (extensions::ExtensionRegistry* registry =
++          extensions::ExtensionRegistry::Get(profile_)) {
++    registry_observation_.Observe(registry);
++  }
++
 +  LOG(INFO) << "browseros: Scheduling maintenance in "
 +            << kInitialMaintenanceDelay.InSeconds() << " seconds";
 +
@@ -88,6 +103,48 @@ index 0000000000000..fec50b08b130c
 +  extension_ids_ = std::move(ids);
 +}
 +
++void BrowserOSExtensionMaintainer::OnExtensionUnloaded(
++    content::BrowserContext* browser_context,
++    const extensions::Extension* extension,
++    extensions::UnloadedExtensionReason reason) {
++  // Updates and reloads unload too; only a disable needs repair
++  if (reason != extensions::UnloadedExtensionReason::DISABLE ||
++      !extension_ids_.contains(extension->id())) {
++    return;
++  }
++  LOG(INFO) << "browseros: Tracked extension " << extension->id()
++            << " was disabled";
++  ScheduleRepair();
++}
++
++void BrowserOSExtensionMaintainer::OnExtensionUninstalled(
++    content::BrowserContext* browser_context,
++    const extensions::Extension* extension,
++    extensions::UninstallReason reason) {
++  if (!extension_ids_.contains(extension->id())) {
++    return;
++  }
++  LOG(INFO) << "browseros: Tracked extension " << extension->id()
++            << " was uninstalled";
++  ScheduleRepair();
++}
++
++void BrowserOSExtensionMaintainer::ScheduleRepair() {
++  if (repair_timer_.IsRunning()) {
++    return;
++  }
++  repair_timer_.Start(FROM_HERE, kRepairDelay,
++                      base::BindOnce(&BrowserOSExtensionMaintainer::RunRepair,
++                                     weak_ptr_factory_.GetWeakPtr()));
++}
++
++void BrowserOSExtensionMaintainer::RunRepair() {
++  // Deprecated extensions are not in the config and stay uninstalled
++  ReinstallMissingExtensions();
++  ReenableDisabledExtensions();
++  LogExtensionHealth("registry_event");
++}
++
 +void BrowserOSExtensionMaintainer::RunMaintenanceCycle() {
 +  LOG(INFO) << "browseros: Running maintenance cycle";
 +
@@ -111,9 +168,15 @@ index 0000000000000..fec50b08b130c
 +  request->url = config_url_;
 +  request->method = "GET";
 +  request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
++  if (!config_etag_.empty()) {
++    request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
++                               config_etag_);
++  }
 +
 +  auto loader =
 +      network::SimpleURLLoader::Create(std::move(request), kTrafficAnnotation);
++  // 304 Not Modified must reach OnConfigFetched
++  loader->SetAllowHttpErrorResults(true);
 +
 +  auto* loader_ptr = loader.get();
 +  loader_ptr->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
@@ -125,9 +188,20 @@ index 0000000000000..fec50b08b130c
 +void BrowserOSExtensionMaintainer::OnConfigFetched(
 +    std::unique_ptr<network::SimpleURLLoader> loader,
 +    std::unique_ptr<std::string> response_body) {
-+  if (response_body) {
++  int response_code = 0;
++  const net::HttpResponseHeaders* headers =
++      loader->ResponseInfo() ? loader->ResponseInfo()->headers.get() : nullptr;
++  if (headers) {
++    response_code = headers->response_code();
++  }
++
++  if (response_code == net::HTTP_NOT_MODIFIED) {
++    VLOG(1) << "browseros: Maintenance config not modified";
++  } else if (response_body && response_code == net::HTTP_OK) {
++    config_etag_ = headers->GetNormalizedHeader("ETag").value_or(std::string());
 +    base::Value::Dict config = ParseConfigJson(*response_body);
-+    if (!config.empty()) {
++    if (!config.empty() && config != last_config_) {
++      config_changed_ = true;
 +      last_config_ = std::move(config);
 +
 +      for (const auto [id, _] : last_config_) {
@@ -138,7 +212,8 @@ index 0000000000000..fec50b08b130c
 +                << " extensions";
 +    }
 +  } else {
-+    LOG(WARNING) << "browseros: Failed to fetch maintenance config";
++    LOG(WARNING) << "browseros: Failed to fetch maintenance config ("
++                 << response_code << ")";
 +  }
 +
 +  ExecuteMaintenanceTasks();
@@ -171,7 +246,12 @@ index 0000000000000..fec50b08b130c
 +  UninstallDeprecatedExtensions();
 +  ReinstallMissingExtensions();
 +  ReenableDisabledExtensions();
-+  ForceUpdateCheck();
++  if (config_changed_) {
++    ForceUpdateCheck();
++    config_changed_ = false;
++  } else {
++    VLOG(1) << "browseros: Config unchanged, skipping update check";
++  }
 +  LogExtensionHealth("maintenance");
 +}
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer.h b/chrome/browser/browseros/extensions/browseros_extension_maintainer.h
 new file mode 100644
-index 0000000000000..e7e228e6fd71e
+index 0000000000000..f9aa5e1781877
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer.h
-@@ -0,0 +1,83 @@
+@@ -0,0 +1,115 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -18,7 +18,11 @@ index 0000000000000..e7e228e6fd71e
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/scoped_observation.h"
++#include "base/timer/timer.h"
 +#include "base/values.h"
++#include "extensions/browser/extension_registry.h"
++#include "extensions/browser/extension_registry_observer.h"
 +#include "url/gurl.h"
 +
 +namespace network {
@@ -30,13 +34,19 @@ index 0000000000000..e7e228e6fd71e
 +
 +namespace browseros {
 +
-+// Handles periodic maintenance of BrowserOS extensions.
++// Handles maintenance of BrowserOS extensions.
 +// Tasks: uninstall deprecated, reinstall missing, re-enable disabled,
 +// force update check, log health metrics.
-+class BrowserOSExtensionMaintainer {
++//
++// Uninstalls and disables of tracked extensions are repaired as soon as the
++// registry reports them. The periodic cycle only re-fetches the remote
++// config, conditionally with its ETag, and forces an update check only when
++// the config changed.
++class BrowserOSExtensionMaintainer
++    : public extensions::ExtensionRegistryObserver {
 + public:
 +  explicit BrowserOSExtensionMaintainer(Profile* profile);
-+  ~BrowserOSExtensionMaintainer();
++  ~BrowserOSExtensionMaintainer() override;
 +
 +  BrowserOSExtensionMaintainer(const BrowserOSExtensionMaintainer&) = delete;
 +  BrowserOSExtensionMaintainer& operator=(const BrowserOSExtensionMaintainer&) =
@@ -50,6 +60,14 @@ index 0000000000000..e7e228e6fd71e
 +  // Updates the set of tracked extension IDs.
 +  void UpdateExtensionIds(std::set<std::string> ids);
 +
++  // extensions::ExtensionRegistryObserver:
++  void OnExtensionUnloaded(content::BrowserContext* browser_context,
++                           const extensions::Extension* extension,
++                           extensions::UnloadedExtensionReason reason) override;
++  void OnExtensionUninstalled(content::BrowserContext* browser_context,
++                              const extensions::Extension* extension,
++                              extensions::UninstallReason reason) override;
++
 + private:
 +  // Fetches remote config and runs maintenance.
 +  void RunMaintenanceCycle();
@@ -67,6 +85,11 @@ index 0000000000000..e7e228e6fd71e
 +  // Schedules next maintenance cycle.
 +  void ScheduleNextMaintenance();
 +
++  // Repairs tracked extensions shortly after a registry event, once per
++  // burst of events.
++  void ScheduleRepair();
++  void RunRepair();
++
 +  // Individual maintenance tasks
 +  void UninstallDeprecatedExtensions();
 +  void ReinstallMissingExtensions();
@@ -78,6 +101,15 @@ index 0000000000000..e7e228e6fd71e
 +  GURL config_url_;
 +  std::set<std::string> extension_ids_;
 +  base::Value::Dict last_config_;
++  // ETag of the last fetched config, sent back as If-None-Match
++  std::string config_etag_;
++  // Whether the config changed since the last forced update check
++  bool config_changed_ = true;
++
++  base::OneShotTimer repair_timer_;
++  base::ScopedObservation<extensions::ExtensionRegistry,
++                          extensions::ExtensionRegistryObserver>
++      registry_observation_{this};
 +
 +  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
 +
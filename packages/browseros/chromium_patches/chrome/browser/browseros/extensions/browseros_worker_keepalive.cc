@@ -0,0 +1,136 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_worker_keepalive.cc b/chrome/browser/browseros/extensions/browseros_worker_keepalive.cc
+new file mode 100644
+index 0000000000000..d48438f97eb37
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_worker_keepalive.cc
+@@ -0,0 +1,130 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/extensions/browseros_worker_keepalive.h"
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "chrome/browser/browseros/core/browseros_agent_activity.h"
++#include "chrome/browser/browseros/core/browseros_constants.h"
++#include "content/public/browser/service_worker_external_request_timeout_type.h"
++#include "extensions/browser/activity.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr char kKeepaliveData[] = "browseros_worker_keepalive";
++
++}  // namespace
++
++BrowserOSWorkerKeepalive::BrowserOSWorkerKeepalive(
++    extensions::ProcessManager* process_manager)
++    : process_manager_(process_manager) {
++  observation_.Observe(process_manager_);
++  activity_subscription_ = AddAgentActivityCallback(base::BindRepeating(
++      &BrowserOSWorkerKeepalive::OnActivity, base::Unretained(this)));
++}
++
++BrowserOSWorkerKeepalive::~BrowserOSWorkerKeepalive() = default;
++
++void BrowserOSWorkerKeepalive::Shutdown() {
++  activity_subscription_ = {};
++  idle_timer_.Stop();
++  observation_.Reset();
++  process_manager_ = nullptr;
++  workers_.clear();
++}
++
++void BrowserOSWorkerKeepalive::OnProcessManagerShutdown(
++    extensions::ProcessManager* manager) {
++  Shutdown();
++}
++
++void BrowserOSWorkerKeepalive::OnStartedTrackingServiceWorkerInstance(
++    const extensions::WorkerId& worker_id) {
++  if (!IsBrowserOSExtension(worker_id.extension_id)) {
++    return;
++  }
++  workers_[worker_id] = std::nullopt;
++  // Whatever woke the worker is activity; give it the idle window
++  OnActivity();
++}
++
++void BrowserOSWorkerKeepalive::OnStoppedTrackingServiceWorkerInstance(
++    const extensions::WorkerId& worker_id) {
++  // The worker is gone, and its keepalive with it
++  workers_.erase(worker_id);
++}
++
++void BrowserOSWorkerKeepalive::OnExtensionFrameRegistered(
++    const extensions::ExtensionId& extension_id,
++    content::RenderFrameHost* render_frame_host) {
++  if (IsBrowserOSExtension(extension_id)) {
++    UpdateKeepalives();
++  }
++}
++
++void BrowserOSWorkerKeepalive::OnExtensionFrameUnregistered(
++    const extensions::ExtensionId& extension_id,
++    content::RenderFrameHost* render_frame_host) {
++  // Closing the side panel starts the idle window rather than releasing
++  // right away, so reopening it finds the worker warm
++  if (IsBrowserOSExtension(extension_id)) {
++    OnActivity();
++  }
++}
++
++void BrowserOSWorkerKeepalive::OnActivity() {
++  last_activity_ = base::TimeTicks::Now();
++  UpdateKeepalives();
++}
++
++bool BrowserOSWorkerKeepalive::ShouldKeepAlive(
++    const extensions::ExtensionId& extension_id) const {
++  if (base::TimeTicks::Now() - last_activity_ < kIdleTimeout) {
++    return true;
++  }
++  return !process_manager_->GetRenderFrameHostsForExtension(extension_id)
++              .empty();
++}
++
++void BrowserOSWorkerKeepalive::UpdateKeepalives() {
++  if (!process_manager_) {
++    return;
++  }
++
++  bool any_held = false;
++  for (auto& [worker_id, keepalive] : workers_) {
++    const bool keep = ShouldKeepAlive(worker_id.extension_id);
++    if (keep && !keepalive) {
++      keepalive = process_manager_->IncrementServiceWorkerKeepaliveCount(
++          worker_id,
++          content::ServiceWorkerExternalRequestTimeoutType::kDoesNotTimeout,
++          extensions::Activity::PROCESS_MANAGER, kKeepaliveData);
++      VLOG(1) << "browseros: Holding service worker of "
++              << worker_id.extension_id;
++    } else if (!keep && keepalive) {
++      process_manager_->DecrementServiceWorkerKeepaliveCount(
++          worker_id, *keepalive, extensions::Activity::PROCESS_MANAGER,
++          kKeepaliveData);
++      keepalive.reset();
++      VLOG(1) << "browseros: Released idle service worker of "
++              << worker_id.extension_id;
++    }
++    any_held |= keep;
++  }
++
++  // Re-evaluate when the idle window ends; workers held by an open page are
++  // re-evaluated when it closes
++  const base::TimeDelta remaining =
++      last_activity_ + kIdleTimeout - base::TimeTicks::Now();
++  if (any_held && remaining.is_positive()) {
++    idle_timer_.Start(FROM_HERE, remaining,
++                      base::BindOnce(&BrowserOSWorkerKeepalive::UpdateKeepalives,
++                                     base::Unretained(this)));
++  }
++}
++
++}  // namespace browseros
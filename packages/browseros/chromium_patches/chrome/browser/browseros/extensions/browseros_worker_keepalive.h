@@ -0,0 +1,90 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_worker_keepalive.h b/chrome/browser/browseros/extensions/browseros_worker_keepalive.h
+new file mode 100644
+index 0000000000000..549c38669ac1d
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_worker_keepalive.h
+@@ -0,0 +1,84 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_H_
++#define CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_H_
++
++#include <map>
++#include <optional>
++#include <string>
++
++#include "base/callback_list.h"
++#include "base/memory/raw_ptr.h"
++#include "base/scoped_observation.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/uuid.h"
++#include "components/keyed_service/core/keyed_service.h"
++#include "extensions/browser/process_manager.h"
++#include "extensions/browser/process_manager_observer.h"
++#include "extensions/browser/service_worker/worker_id.h"
++
++namespace browseros {
++
++// Keeps the service workers of BrowserOS extensions running while they are
++// in use, instead of forever. A worker is held while one of the extension's
++// pages (such as its side panel) is open, and for kIdleTimeout after the
++// last agent activity: MCP traffic or browserOS API calls, see
++// NotifyAgentActivity(). Once released, a worker follows the normal idle
++// shutdown and is restarted on its next event.
++class BrowserOSWorkerKeepalive : public KeyedService,
++                                 public extensions::ProcessManagerObserver {
++ public:
++  static constexpr base::TimeDelta kIdleTimeout = base::Minutes(5);
++
++  explicit BrowserOSWorkerKeepalive(extensions::ProcessManager* process_manager);
++  ~BrowserOSWorkerKeepalive() override;
++
++  BrowserOSWorkerKeepalive(const BrowserOSWorkerKeepalive&) = delete;
++  BrowserOSWorkerKeepalive& operator=(const BrowserOSWorkerKeepalive&) =
++      delete;
++
++  // KeyedService:
++  void Shutdown() override;
++
++  // extensions::ProcessManagerObserver:
++  void OnProcessManagerShutdown(extensions::ProcessManager* manager) override;
++  void OnStartedTrackingServiceWorkerInstance(
++      const extensions::WorkerId& worker_id) override;
++  void OnStoppedTrackingServiceWorkerInstance(
++      const extensions::WorkerId& worker_id) override;
++  void OnExtensionFrameRegistered(
++      const extensions::ExtensionId& extension_id,
++      content::RenderFrameHost* render_frame_host) override;
++  void OnExtensionFrameUnregistered(
++      const extensions::ExtensionId& extension_id,
++      content::RenderFrameHost* render_frame_host) override;
++
++ private:
++  // Restarts the idle window and holds every tracked worker
++  void OnActivity();
++
++  // Holds or releases each worker's keepalive to match ShouldKeepAlive(),
++  // and arms |idle_timer_| for the end of the idle window
++  void UpdateKeepalives();
++  bool ShouldKeepAlive(const extensions::ExtensionId& extension_id) const;
++
++  raw_ptr<extensions::ProcessManager> process_manager_;
++
++  // Running BrowserOS extension workers and their keepalive, if held
++  std::map<extensions::WorkerId, std::optional<base::Uuid>> workers_;
++
++  base::TimeTicks last_activity_;
++  base::OneShotTimer idle_timer_;
++
++  base::CallbackListSubscription activity_subscription_;
++  base::ScopedObservation<extensions::ProcessManager,
++                          extensions::ProcessManagerObserver>
++      observation_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_H_
@@ -0,0 +1,67 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_worker_keepalive_factory.cc b/chrome/browser/browseros/extensions/browseros_worker_keepalive_factory.cc
+new file mode 100644
+index 0000000000000..bf04a84cab008
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_worker_keepalive_factory.cc
+@@ -0,0 +1,61 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/extensions/browseros_worker_keepalive_factory.h"
++
++#include <memory>
++
++#include "base/no_destructor.h"
++#include "chrome/browser/browseros/extensions/browseros_worker_keepalive.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/keyed_service/content/browser_context_dependency_manager.h"
++#include "content/public/browser/browser_context.h"
++#include "extensions/browser/process_manager.h"
++#include "extensions/browser/process_manager_factory.h"
++
++namespace browseros {
++
++// static
++BrowserOSWorkerKeepalive* BrowserOSWorkerKeepaliveFactory::GetForBrowserContext(
++    content::BrowserContext* context) {
++  return static_cast<BrowserOSWorkerKeepalive*>(
++      GetInstance()->GetServiceForBrowserContext(context, true));
++}
++
++// static
++BrowserOSWorkerKeepaliveFactory*
++BrowserOSWorkerKeepaliveFactory::GetInstance() {
++  static base::NoDestructor<BrowserOSWorkerKeepaliveFactory> instance;
++  return instance.get();
++}
++
++BrowserOSWorkerKeepaliveFactory::BrowserOSWorkerKeepaliveFactory()
++    : BrowserContextKeyedServiceFactory(
++          "BrowserOSWorkerKeepalive",
++          BrowserContextDependencyManager::GetInstance()) {
++  DependsOn(extensions::ProcessManagerFactory::GetInstance());
++}
++
++BrowserOSWorkerKeepaliveFactory::~BrowserOSWorkerKeepaliveFactory() = default;
++
++std::unique_ptr<KeyedService>
++BrowserOSWorkerKeepaliveFactory::BuildServiceInstanceForBrowserContext(
++    content::BrowserContext* context) const {
++  Profile* profile = Profile::FromBrowserContext(context);
++
++  // BrowserOS extensions don't run in incognito profiles
++  if (profile->IsOffTheRecord()) {
++    return nullptr;
++  }
++
++  return std::make_unique<BrowserOSWorkerKeepalive>(
++      extensions::ProcessManager::Get(context));
++}
++
++bool BrowserOSWorkerKeepaliveFactory::ServiceIsCreatedWithBrowserContext()
++    const {
++  return true;
++}
++
++}  // namespace browseros
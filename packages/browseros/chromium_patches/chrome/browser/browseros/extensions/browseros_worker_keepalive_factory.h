@@ -0,0 +1,57 @@
+diff --git a/chrome/browser/browseros/extensions/browseros_worker_keepalive_factory.h b/chrome/browser/browseros/extensions/browseros_worker_keepalive_factory.h
+new file mode 100644
+index 0000000000000..1062a1080a19d
+--- /dev/null
++++ b/chrome/browser/browseros/extensions/browseros_worker_keepalive_factory.h
+@@ -0,0 +1,51 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_FACTORY_H_
++#define CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_FACTORY_H_
++
++#include "base/no_destructor.h"
++#include "components/keyed_service/content/browser_context_keyed_service_factory.h"
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace browseros {
++
++class BrowserOSWorkerKeepalive;
++
++// Factory for creating BrowserOSWorkerKeepalive instances per profile. The
++// service is created with the profile so it sees the first worker start.
++class BrowserOSWorkerKeepaliveFactory
++    : public BrowserContextKeyedServiceFactory {
++ public:
++  BrowserOSWorkerKeepaliveFactory(const BrowserOSWorkerKeepaliveFactory&) =
++      delete;
++  BrowserOSWorkerKeepaliveFactory& operator=(
++      const BrowserOSWorkerKeepaliveFactory&) = delete;
++
++  // Returns the BrowserOSWorkerKeepalive for |context|, creating one if
++  // needed.
++  static BrowserOSWorkerKeepalive* GetForBrowserContext(
++      content::BrowserContext* context);
++
++  // Returns the singleton factory instance.
++  static BrowserOSWorkerKeepaliveFactory* GetInstance();
++
++ private:
++  friend base::NoDestructor<BrowserOSWorkerKeepaliveFactory>;
++
++  BrowserOSWorkerKeepaliveFactory();
++  ~BrowserOSWorkerKeepaliveFactory() override;
++
++  // BrowserContextKeyedServiceFactory:
++  std::unique_ptr<KeyedService> BuildServiceInstanceForBrowserContext(
++      content::BrowserContext* context) const override;
++  bool ServiceIsCreatedWithBrowserContext() const override;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_WORKER_KEEPALIVE_FACTORY_H_
@@ -0,0 +1,153 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_daily_usage.cc b/chrome/browser/browseros/metrics/browseros_daily_usage.cc
+new file mode 100644
+index 0000000000000..74da0e6940830
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_daily_usage.cc
+@@ -0,0 +1,147 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/metrics/browseros_daily_usage.h"
++
++#include <algorithm>
++#include <string>
++#include <utility>
++
++#include "base/memory/raw_ptr.h"
++#include "base/values.h"
++#include "chrome/browser/browser_process.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/common/pref_names.h"
++#include "components/metrics/daily_event.h"
++#include "components/prefs/pref_service.h"
++#include "content/public/browser/browser_thread.h"
++
++namespace browseros_metrics {
++
++namespace {
++
++// Granularity of active minutes, and how often counters are saved
++constexpr base::TimeDelta kTickInterval = base::Minutes(1);
++
++}  // namespace
++
++class BrowserOSDailyUsage::DailyEventObserver
++    : public metrics::DailyEvent::Observer {
++ public:
++  explicit DailyEventObserver(BrowserOSDailyUsage* usage) : usage_(usage) {}
++
++  DailyEventObserver(const DailyEventObserver&) = delete;
++  DailyEventObserver& operator=(const DailyEventObserver&) = delete;
++
++  ~DailyEventObserver() override = default;
++
++  // metrics::DailyEvent::Observer:
++  void OnDailyEvent(metrics::DailyEvent::IntervalType type) override {
++    usage_->OnDayEnded(type == metrics::DailyEvent::IntervalType::DAY_ELAPSED);
++  }
++
++ private:
++  raw_ptr<BrowserOSDailyUsage> usage_;
++};
++
++// static
++BrowserOSDailyUsage* BrowserOSDailyUsage::GetInstance() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  static base::NoDestructor<BrowserOSDailyUsage> instance;
++  return instance.get();
++}
++
++BrowserOSDailyUsage::BrowserOSDailyUsage() {
++  PrefService* prefs = local_state();
++  if (!prefs) {
++    return;
++  }
++  daily_event_ = std::make_unique<metrics::DailyEvent>(
++      prefs, prefs::kBrowserOSDailyUsageLastFired,
++      /*histogram_name=*/std::string());
++  daily_event_->AddObserver(std::make_unique<DailyEventObserver>(this));
++}
++
++BrowserOSDailyUsage::~BrowserOSDailyUsage() = default;
++
++void BrowserOSDailyUsage::RecordUserActivity(size_t tab_count) {
++  max_tabs_ = std::max(max_tabs_, tab_count);
++
++  const base::TimeTicks now = base::TimeTicks::Now();
++  if (last_active_minute_.is_null() ||
++      now - last_active_minute_ >= kTickInterval) {
++    last_active_minute_ = now;
++    active_minutes_++;
++  }
++  MaybeTick();
++}
++
++void BrowserOSDailyUsage::RecordAgentCall() {
++  agent_calls_++;
++  MaybeTick();
++}
++
++void BrowserOSDailyUsage::MaybeTick() {
++  const base::TimeTicks now = base::TimeTicks::Now();
++  if (!last_tick_.is_null() && now - last_tick_ < kTickInterval) {
++    return;
++  }
++  last_tick_ = now;
++
++  PrefService* prefs = local_state();
++  if (!prefs || !daily_event_) {
++    return;
++  }
++
++  if (active_minutes_ > 0) {
++    prefs->SetInteger(
++        prefs::kBrowserOSDailyUsageActiveMinutes,
++        prefs->GetInteger(prefs::kBrowserOSDailyUsageActiveMinutes) +
++            static_cast<int>(active_minutes_));
++  }
++  if (agent_calls_ > 0) {
++    prefs->SetInteger(prefs::kBrowserOSDailyUsageAgentCalls,
++                      prefs->GetInteger(prefs::kBrowserOSDailyUsageAgentCalls) +
++                          static_cast<int>(agent_calls_));
++  }
++  if (static_cast<int>(max_tabs_) >
++      prefs->GetInteger(prefs::kBrowserOSDailyUsageMaxTabs)) {
++    prefs->SetInteger(prefs::kBrowserOSDailyUsageMaxTabs,
++                      static_cast<int>(max_tabs_));
++  }
++  active_minutes_ = 0;
++  agent_calls_ = 0;
++  max_tabs_ = 0;
++
++  // Runs OnDayEnded() if a day has passed since the last report
++  daily_event_->CheckInterval();
++}
++
++void BrowserOSDailyUsage::OnDayEnded(bool report) {
++  PrefService* prefs = local_state();
++  if (!prefs) {
++    return;
++  }
++
++  if (report) {
++    base::Value::Dict properties;
++    properties.Set("active_minutes",
++                   prefs->GetInteger(prefs::kBrowserOSDailyUsageActiveMinutes));
++    properties.Set("max_tabs",
++                   prefs->GetInteger(prefs::kBrowserOSDailyUsageMaxTabs));
++    properties.Set("agent_calls",
++                   prefs->GetInteger(prefs::kBrowserOSDailyUsageAgentCalls));
++    BrowserOSMetrics::Log("usage.daily", std::move(properties));
++  }
++
++  prefs->ClearPref(prefs::kBrowserOSDailyUsageActiveMinutes);
++  prefs->ClearPref(prefs::kBrowserOSDailyUsageMaxTabs);
++  prefs->ClearPref(prefs::kBrowserOSDailyUsageAgentCalls);
++}
++
++PrefService* BrowserOSDailyUsage::local_state() {
++  return g_browser_process ? g_browser_process->local_state() : nullptr;
++}
++
++}  // namespace browseros_metrics
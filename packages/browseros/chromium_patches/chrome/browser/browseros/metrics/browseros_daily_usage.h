@@ -0,0 +1,82 @@
+diff --git a/chrome/browser/browseros/metrics/browseros_daily_usage.h b/chrome/browser/browseros/metrics/browseros_daily_usage.h
+new file mode 100644
+index 0000000000000..cfb545e754b1e
+--- /dev/null
++++ b/chrome/browser/browseros/metrics/browseros_daily_usage.h
+@@ -0,0 +1,76 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_DAILY_USAGE_H_
++#define CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_DAILY_USAGE_H_
++
++#include <stddef.h>
++#include <stdint.h>
++
++#include <memory>
++
++#include "base/no_destructor.h"
++#include "base/time/time.h"
++
++class PrefService;
++
++namespace metrics {
++class DailyEvent;
++}  // namespace metrics
++
++namespace browseros_metrics {
++
++// Sums up a day of use locally and logs it as a single "usage.daily" event
++// through the batched metrics queue:
++//
++//   active_minutes  minutes with user input
++//   max_tabs        most tabs open at once while the user was active
++//   agent_calls     browserOS snapshot, interaction and screenshot calls
++//
++// Recording only updates counters in memory. Once a minute at most, they
++// are saved to local state, so a restart doesn't lose the day, and the day
++// is checked for being over. UI thread only.
++class BrowserOSDailyUsage {
++ public:
++  static BrowserOSDailyUsage* GetInstance();
++
++  BrowserOSDailyUsage(const BrowserOSDailyUsage&) = delete;
++  BrowserOSDailyUsage& operator=(const BrowserOSDailyUsage&) = delete;
++
++  // User input, with the number of tabs open at the time
++  void RecordUserActivity(size_t tab_count);
++
++  // A browserOS call that recorded its latency
++  void RecordAgentCall();
++
++ private:
++  friend base::NoDestructor<BrowserOSDailyUsage>;
++  class DailyEventObserver;
++
++  BrowserOSDailyUsage();
++  ~BrowserOSDailyUsage();
++
++  // Saves the counters and checks for the end of the day, once a minute
++  void MaybeTick();
++
++  // Logs the day that just ended, or drops it on first run and clock
++  // changes, and starts over
++  void OnDayEnded(bool report);
++
++  PrefService* local_state();
++
++  std::unique_ptr<metrics::DailyEvent> daily_event_;
++
++  // Not yet saved to local state
++  int64_t active_minutes_ = 0;
++  int64_t agent_calls_ = 0;
++  size_t max_tabs_ = 0;
++
++  base::TimeTicks last_tick_;
++  base::TimeTicks last_active_minute_;
++};
++
++}  // namespace browseros_metrics
++
++#endif  // CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_DAILY_USAGE_H_
@@ -1,17 +1,23 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics.cc b/chrome/browser/browseros/metrics/browseros_metrics.cc
 new file mode 100644
-index 0000000000000..cf1a9a0c1790b
+index 0000000000000..e8ee1f3984818
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics.cc
-@@ -0,0 +1,100 @@
+@@ -0,0 +1,238 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +
++#include <algorithm>
++#include <array>
++#include <map>
++
 +#include "base/logging.h"
++#include "base/no_destructor.h"
 +#include "base/rand_util.h"
++#include "base/synchronization/lock.h"
 +#include "base/task/thread_pool.h"
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service.h"
@@ -56,6 +62,127 @@ index 0000000000000..cf1a9a0c1790b
 +  }
 +}
 +
++// How long Count() and RecordLatency() accumulate before logging summaries
++constexpr base::TimeDelta kAggregationInterval = base::Minutes(10);
++
++// Upper bounds of the latency buckets in milliseconds; the last one is open
++constexpr int64_t kLatencyBucketBoundsMs[] = {
++    1,   2,    5,    10,   20,    50,    100,   200,
++    500, 1000, 2000, 5000, 10000, 30000, 60000, INT64_MAX,
++};
++
++struct LatencyAggregate {
++  std::array<int64_t, std::size(kLatencyBucketBoundsMs)> buckets = {};
++  int64_t count = 0;
++  base::TimeDelta sum;
++  base::TimeDelta max;
++
++  // Upper bound of the bucket holding the |fraction| quantile, capped by
++  // the largest sample
++  double PercentileMs(double fraction) const {
++    const int64_t target = static_cast<int64_t>(count * fraction);
++    int64_t seen = 0;
++    for (size_t i = 0; i < buckets.size(); ++i) {
++      seen += buckets[i];
++      if (seen > target) {
++        return std::min(kLatencyBucketBoundsMs[i],
++                        max.InMilliseconds() + 1);
++      }
++    }
++    return max.InMilliseconds() + 1;
++  }
++};
++
++// Accumulates Count() and RecordLatency() calls. The first call of an
++// interval schedules one flush on the UI thread, so nothing wakes up while
++// no aggregated metric is recorded.
++class MetricsAggregator {
++ public:
++  static MetricsAggregator& Get() {
++    static base::NoDestructor<MetricsAggregator> instance;
++    return *instance;
++  }
++
++  void AddCount(const std::string& event_name, int64_t count) {
++    base::AutoLock lock(lock_);
++    counts_[event_name] += count;
++    ScheduleFlushLocked();
++  }
++
++  void AddLatency(const std::string& event_name, base::TimeDelta latency) {
++    const int64_t ms = latency.InMilliseconds();
++    size_t bucket = 0;
++    while (ms >= kLatencyBucketBoundsMs[bucket] &&
++           bucket + 1 < std::size(kLatencyBucketBoundsMs)) {
++      bucket++;
++    }
++
++    base::AutoLock lock(lock_);
++    LatencyAggregate& aggregate = latencies_[event_name];
++    aggregate.buckets[bucket]++;
++    aggregate.count++;
++    aggregate.sum += latency;
++    aggregate.max = std::max(aggregate.max, latency);
++    ScheduleFlushLocked();
++  }
++
++ private:
++  friend class base::NoDestructor<MetricsAggregator>;
++  MetricsAggregator() = default;
++
++  void ScheduleFlushLocked() {
++    lock_.AssertAcquired();
++    if (flush_scheduled_) {
++      return;
++    }
++    flush_scheduled_ = true;
++    interval_start_ = base::TimeTicks::Now();
++    // Unretained is safe: the aggregator is never destroyed
++    content::GetUIThreadTaskRunner({})->PostDelayedTask(
++        FROM_HERE,
++        base::BindOnce(&MetricsAggregator::Flush, base::Unretained(this)),
++        kAggregationInterval);
++  }
++
++  void Flush() {
++    std::map<std::string, int64_t> counts;
++    std::map<std::string, LatencyAggregate> latencies;
++    base::TimeDelta interval;
++    {
++      base::AutoLock lock(lock_);
++      counts.swap(counts_);
++      latencies.swap(latencies_);
++      interval = base::TimeTicks::Now() - interval_start_;
++      flush_scheduled_ = false;
++    }
++
++    const int interval_s = static_cast<int>(interval.InSeconds());
++    for (const auto& [event_name, count] : counts) {
++      base::Value::Dict properties;
++      properties.Set("count", static_cast<double>(count));
++      properties.Set("interval_s", interval_s);
++      LogOnUIThread(event_name, std::move(properties));
++    }
++    for (const auto& [event_name, aggregate] : latencies) {
++      base::Value::Dict properties;
++      properties.Set("count", static_cast<double>(aggregate.count));
++      properties.Set("mean_ms",
++                     aggregate.sum.InMillisecondsF() / aggregate.count);
++      properties.Set("max_ms", aggregate.max.InMillisecondsF());
++      properties.Set("p50_ms", aggregate.PercentileMs(0.5));
++      properties.Set("p95_ms", aggregate.PercentileMs(0.95));
++      properties.Set("interval_s", interval_s);
++      LogOnUIThread(event_name, std::move(properties));
++    }
++  }
++
++  base::Lock lock_;
++  std::map<std::string, int64_t> counts_ GUARDED_BY(lock_);
++  std::map<std::string, LatencyAggregate> latencies_ GUARDED_BY(lock_);
++  base::TimeTicks interval_start_ GUARDED_BY(lock_);
++  bool flush_scheduled_ GUARDED_BY(lock_) = false;
++};
++
 +}  // namespace
 +
 +// static
@@ -103,4 +230,15 @@ index 0000000000000..cf1a9a0c1790b
 +  }
 +}
 +
++// static
++void BrowserOSMetrics::Count(const std::string& event_name, int64_t count) {
++  MetricsAggregator::Get().AddCount(event_name, count);
++}
++
++// static
++void BrowserOSMetrics::RecordLatency(const std::string& event_name,
++                                     base::TimeDelta latency) {
++  MetricsAggregator::Get().AddLatency(event_name, latency);
++}
++
 +}  // namespace browseros_metrics
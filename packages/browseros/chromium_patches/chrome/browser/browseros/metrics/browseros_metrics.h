@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics.h b/chrome/browser/browseros/metrics/browseros_metrics.h
 new file mode 100644
-index 0000000000000..6da70921b619a
+index 0000000000000..675cbe8133cd2
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics.h
-@@ -0,0 +1,40 @@
+@@ -0,0 +1,55 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,9 +11,12 @@ index 0000000000000..6da70921b619a
 +#ifndef CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_H_
 +#define CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_H_
 +
++#include <stdint.h>
++
 +#include <string>
 +#include <utility>
 +
++#include "base/time/time.h"
 +#include "base/values.h"
 +
 +namespace browseros_metrics {
@@ -37,6 +40,18 @@ index 0000000000000..6da70921b619a
 +  static void Log(const std::string& event_name, base::Value::Dict properties,
 +                  double sample_rate = 1.0);
 +
++  // Aggregated metrics for hot paths: calls only update an in-memory
++  // aggregate, and each name is logged as one summary event per interval.
++  // Safe to call from any thread.
++
++  // Adds |count| to a counter, logged as {"count", "interval_s"}
++  static void Count(const std::string& event_name, int64_t count = 1);
++
++  // Adds |latency| to a histogram, logged as {"count", "mean_ms", "max_ms",
++  // "p50_ms", "p95_ms", "interval_s"}; the percentiles are bucket bounds
++  static void RecordLatency(const std::string& event_name,
++                            base::TimeDelta latency);
++
 + private:
 +  BrowserOSMetrics() = delete;
 +};
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_prefs.cc b/chrome/browser/browseros/metrics/browseros_metrics_prefs.cc
 new file mode 100644
-index 0000000000000..83f4ab681749f
+index 0000000000000..8bd4edf9b709a
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_prefs.cc
-@@ -0,0 +1,28 @@
+@@ -0,0 +1,39 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,6 +11,7 @@ index 0000000000000..83f4ab681749f
 +#include "chrome/browser/browseros/metrics/browseros_metrics_prefs.h"
 +
 +#include "chrome/common/pref_names.h"
++#include "components/metrics/daily_event.h"
 +#include "components/prefs/pref_registry_simple.h"
 +#include "components/pref_registry/pref_registry_syncable.h"
 +
@@ -22,6 +23,9 @@ index 0000000000000..83f4ab681749f
 +  registry->RegisterStringPref(
 +      prefs::kBrowserOSMetricsClientId,
 +      std::string());
++
++  // Events captured but not yet uploaded, kept across restarts
++  registry->RegisterListPref(prefs::kBrowserOSMetricsPendingEvents);
 +}
 +
 +void RegisterLocalStatePrefs(PrefRegistrySimple* registry) {
@@ -29,6 +33,13 @@ index 0000000000000..83f4ab681749f
 +  registry->RegisterStringPref(
 +      prefs::kBrowserOSMetricsInstallId,
 +      std::string());
++
++  // Daily usage report: the day's totals so far, and when it last went out
++  metrics::DailyEvent::RegisterPref(registry,
++                                    prefs::kBrowserOSDailyUsageLastFired);
++  registry->RegisterIntegerPref(prefs::kBrowserOSDailyUsageActiveMinutes, 0);
++  registry->RegisterIntegerPref(prefs::kBrowserOSDailyUsageMaxTabs, 0);
++  registry->RegisterIntegerPref(prefs::kBrowserOSDailyUsageAgentCalls, 0);
 +}
 +
 +}  // namespace browseros_metrics
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service.cc b/chrome/browser/browseros/metrics/browseros_metrics_service.cc
 new file mode 100644
-index 0000000000000..8c8c588df4481
+index 0000000000000..d587881031aa4
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service.cc
-@@ -0,0 +1,231 @@
+@@ -0,0 +1,359 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,15 +12,19 @@ index 0000000000000..8c8c588df4481
 +
 +#include <memory>
 +#include <string>
++#include <utility>
 +
 +#include "base/uuid.h"
++#include "base/i18n/time_formatting.h"
 +#include "base/json/json_writer.h"
 +#include "base/logging.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/system/sys_info.h"
++#include "base/task/thread_pool.h"
 +#include "base/time/time.h"
 +#include "chrome/common/pref_names.h"
 +#include "components/prefs/pref_service.h"
++#include "components/prefs/scoped_user_pref_update.h"
 +#include "components/version_info/version_info.h"
 +#include "net/base/load_flags.h"
 +#include "net/http/http_status_code.h"
@@ -41,9 +45,18 @@ index 0000000000000..8c8c588df4481
 +
 +// PostHog API configuration
 +constexpr char kPostHogApiKey[] = "phc_PRrpVnBMVJgUumvaXzUnwKZ1dDs3L8MSICLhTdnc8jC";
-+constexpr char kPostHogEndpoint[] = "https://us.i.posthog.com/i/v0/e/";
++constexpr char kPostHogBatchEndpoint[] = "https://us.i.posthog.com/batch/";
 +constexpr size_t kMaxUploadSize = 256 * 1024;  // 256KB max upload size
 +
++// Queued events that trigger an upload right away
++constexpr size_t kFlushEventCount = 50;
++
++// How long the first queued event waits for others before an upload
++constexpr base::TimeDelta kFlushDelay = base::Minutes(10);
++
++// Events kept while uploads fail; older ones are dropped beyond this
++constexpr size_t kMaxQueuedEvents = 1000;
++
 +constexpr net::NetworkTrafficAnnotationTag kBrowserOSMetricsTrafficAnnotation =
 +    net::DefineNetworkTrafficAnnotation("browseros_metrics", R"(
 +        semantics {
@@ -72,6 +85,22 @@ index 0000000000000..8c8c588df4481
 +            "the browser experience."
 +        })");
 +
++// Builds the JSON body of a batch upload, adding |default_properties| to
++// every event of |events|. Runs on the ThreadPool.
++std::optional<std::string> SerializeBatch(base::Value::Dict default_properties,
++                                          base::Value::List events) {
++  for (base::Value& event : events) {
++    event.GetDict()
++        .EnsureDict("properties")
++        ->Merge(default_properties.Clone());
++  }
++
++  base::Value::Dict payload;
++  payload.Set("api_key", kPostHogApiKey);
++  payload.Set("batch", std::move(events));
++  return base::WriteJson(payload);
++}
++
 +}  // namespace
 +
 +BrowserOSMetricsService::BrowserOSMetricsService(
@@ -86,6 +115,8 @@ index 0000000000000..8c8c588df4481
 +  CHECK(url_loader_factory_);
 +  InitializeClientId();
 +  InitializeInstallId();
++  InitializeDefaultProperties();
++  LoadPersistedEvents();
 +}
 +
 +BrowserOSMetricsService::~BrowserOSMetricsService() = default;
@@ -99,11 +130,23 @@ index 0000000000000..8c8c588df4481
 +
 +  VLOG(1) << "browseros: Capturing event: " << event_name;
 +
-+  // Add default properties
-+  AddDefaultProperties(properties);
-+
-+  // Send to PostHog
-+  SendEventToPostHog(event_name, std::move(properties));
++  // Default properties are added off the UI thread when the batch is sent.
++  // The timestamp and uuid let PostHog place a late event correctly and
++  // drop it if a retried batch delivers it twice
++  base::Value::Dict event;
++  event.Set("event", "browseros.native." + event_name);
++  event.Set("distinct_id", client_id_);
++  event.Set("uuid", base::Uuid::GenerateRandomV4().AsLowercaseString());
++  event.Set("timestamp", base::TimeFormatAsIso8601(base::Time::Now()));
++  event.Set("properties", std::move(properties));
++  QueueEvent(std::move(event));
++
++  if (pending_events_.size() >= kFlushEventCount) {
++    FlushEvents();
++  } else if (!flush_timer_.IsRunning()) {
++    flush_timer_.Start(FROM_HERE, kFlushDelay, this,
++                       &BrowserOSMetricsService::FlushEvents);
++  }
 +}
 +
 +std::string BrowserOSMetricsService::GetClientId() const {
@@ -115,8 +158,12 @@ index 0000000000000..8c8c588df4481
 +}
 +
 +void BrowserOSMetricsService::Shutdown() {
-+  // Cancel any pending network requests
++  // Cancel any pending network requests; their events are saved with the
++  // queue and sent again next session
++  flush_timer_.Stop();
++  upload_loader_.reset();
 +  weak_factory_.InvalidateWeakPtrs();
++  PersistEvents();
 +}
 +
 +void BrowserOSMetricsService::InitializeClientId() {
@@ -157,66 +204,147 @@ index 0000000000000..8c8c588df4481
 +  VLOG(1) << "browseros: Metrics install ID: " << install_id_;
 +}
 +
-+void BrowserOSMetricsService::SendEventToPostHog(
-+    const std::string& event_name,
-+    base::Value::Dict properties) {
-+  // Build the request payload
-+  base::Value::Dict payload;
-+  payload.Set("api_key", kPostHogApiKey);
-+  payload.Set("event", "browseros.native." + event_name);
-+  payload.Set("distinct_id", client_id_);
-+  payload.Set("properties", std::move(properties));
++void BrowserOSMetricsService::QueueEvent(base::Value::Dict event) {
++  if (pending_events_.size() >= kMaxQueuedEvents) {
++    pending_events_.pop_front();
++  }
++  pending_events_.push_back(std::move(event));
++}
++
++void BrowserOSMetricsService::FlushEvents() {
++  flush_timer_.Stop();
++  if (!uploading_events_.empty() || pending_events_.empty()) {
++    return;
++  }
++
++  // The batch stays here too, so that it can be retried or persisted
++  base::Value::List batch;
++  for (auto& event : pending_events_) {
++    batch.Append(event.Clone());
++    uploading_events_.push_back(std::move(event));
++  }
++  pending_events_.clear();
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::TaskPriority::BEST_EFFORT},
++      base::BindOnce(&SerializeBatch, default_properties_.Clone(),
++                     std::move(batch)),
++      base::BindOnce(&BrowserOSMetricsService::OnBatchSerialized,
++                     weak_factory_.GetWeakPtr()));
++}
 +
-+  // Convert to JSON
-+  std::string json_payload;
-+  if (!base::JSONWriter::Write(payload, &json_payload)) {
++void BrowserOSMetricsService::OnBatchSerialized(
++    std::optional<std::string> json_payload) {
++  if (!json_payload) {
 +    LOG(ERROR) << "browseros: Failed to serialize metrics payload";
++    uploading_events_.clear();
 +    return;
 +  }
 +
 +  // Create the request
 +  auto resource_request = std::make_unique<network::ResourceRequest>();
-+  resource_request->url = GURL(kPostHogEndpoint);
++  resource_request->url = GURL(kPostHogBatchEndpoint);
 +  resource_request->method = "POST";
 +  resource_request->load_flags = net::LOAD_DISABLE_CACHE;
 +  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
 +
 +  // Create the URL loader
-+  auto url_loader = network::SimpleURLLoader::Create(
++  upload_loader_ = network::SimpleURLLoader::Create(
 +      std::move(resource_request), kBrowserOSMetricsTrafficAnnotation);
-+  url_loader->SetAllowHttpErrorResults(true);
-+  url_loader->AttachStringForUpload(json_payload, "application/json");
++  upload_loader_->SetAllowHttpErrorResults(true);
++  upload_loader_->AttachStringForUpload(*json_payload, "application/json");
++
++  VLOG(1) << "browseros: Uploading " << uploading_events_.size()
++          << " metrics events";
 +
 +  // Send the request
-+  network::SimpleURLLoader* loader_ptr = url_loader.get();
-+  loader_ptr->DownloadToString(
++  upload_loader_->DownloadToString(
 +      url_loader_factory_.get(),
-+      base::BindOnce(&BrowserOSMetricsService::OnPostHogResponse,
-+                     weak_factory_.GetWeakPtr(), std::move(url_loader)),
++      base::BindOnce(&BrowserOSMetricsService::OnBatchUploaded,
++                     weak_factory_.GetWeakPtr()),
 +      kMaxUploadSize);
 +}
 +
-+void BrowserOSMetricsService::OnPostHogResponse(
-+    std::unique_ptr<network::SimpleURLLoader> loader,
++void BrowserOSMetricsService::OnBatchUploaded(
 +    std::unique_ptr<std::string> response_body) {
 +  int response_code = 0;
-+  if (loader->ResponseInfo() && loader->ResponseInfo()->headers) {
-+    response_code = loader->ResponseInfo()->headers->response_code();
++  if (upload_loader_->ResponseInfo() &&
++      upload_loader_->ResponseInfo()->headers) {
++    response_code = upload_loader_->ResponseInfo()->headers->response_code();
 +  }
++  upload_loader_.reset();
++  std::vector<base::Value::Dict> events = std::move(uploading_events_);
++  uploading_events_.clear();
 +
 +  if (response_code == net::HTTP_OK) {
-+    VLOG(2) << "browseros: Metrics event sent successfully";
++    VLOG(2) << "browseros: Metrics batch sent successfully";
++    // Persisted events from an earlier failure have now been sent
++    if (!pref_service_->GetList(prefs::kBrowserOSMetricsPendingEvents)
++             .empty()) {
++      PersistEvents();
++    }
 +  } else {
-+    LOG(WARNING) << "browseros: Failed to send metrics event. Response code: "
++    LOG(WARNING) << "browseros: Failed to send metrics batch. Response code: "
 +                 << response_code;
 +    if (response_body && !response_body->empty()) {
 +      LOG(WARNING) << "browseros: Error response: " << *response_body;
 +    }
++    // Client errors mean the batch itself was rejected, so only network
++    // failures and server errors are retried
++    const bool retry = response_code == 0 || response_code >= 500 ||
++                       response_code == net::HTTP_TOO_MANY_REQUESTS;
++    if (retry) {
++      // Put the batch back ahead of anything queued meanwhile, and keep it
++      // across restarts in case the browser is offline for a while
++      for (auto it = events.rbegin(); it != events.rend(); ++it) {
++        if (pending_events_.size() >= kMaxQueuedEvents) {
++          break;
++        }
++        pending_events_.push_front(std::move(*it));
++      }
++      PersistEvents();
++    }
++  }
++
++  if (!pending_events_.empty() && !flush_timer_.IsRunning()) {
++    flush_timer_.Start(FROM_HERE, kFlushDelay, this,
++                       &BrowserOSMetricsService::FlushEvents);
 +  }
 +}
 +
-+void BrowserOSMetricsService::AddDefaultProperties(
-+    base::Value::Dict& properties) {
++void BrowserOSMetricsService::LoadPersistedEvents() {
++  const base::Value::List& persisted =
++      pref_service_->GetList(prefs::kBrowserOSMetricsPendingEvents);
++  for (const base::Value& event : persisted) {
++    if (event.is_dict()) {
++      QueueEvent(event.GetDict().Clone());
++    }
++  }
++
++  if (!pending_events_.empty()) {
++    VLOG(1) << "browseros: Loaded " << pending_events_.size()
++            << " unsent metrics events";
++    flush_timer_.Start(FROM_HERE, kFlushDelay, this,
++                       &BrowserOSMetricsService::FlushEvents);
++  }
++}
++
++void BrowserOSMetricsService::PersistEvents() {
++  ScopedListPrefUpdate update(pref_service_,
++                              prefs::kBrowserOSMetricsPendingEvents);
++  base::Value::List& persisted = update.Get();
++  persisted.clear();
++  for (const auto& event : uploading_events_) {
++    persisted.Append(event.Clone());
++  }
++  for (const auto& event : pending_events_) {
++    persisted.Append(event.Clone());
++  }
++}
++
++void BrowserOSMetricsService::InitializeDefaultProperties() {
++  base::Value::Dict& properties = default_properties_;
++
 +  // Add browser version
 +  properties.Set("$browser_version", version_info::GetVersionNumber());
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service.h b/chrome/browser/browseros/metrics/browseros_metrics_service.h
 new file mode 100644
-index 0000000000000..2157d1eb1698e
+index 0000000000000..0d343d0a5b701
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service.h
-@@ -0,0 +1,95 @@
+@@ -0,0 +1,127 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,10 +12,14 @@ index 0000000000000..2157d1eb1698e
 +#define CHROME_BROWSER_BROWSEROS_METRICS_BROWSEROS_METRICS_SERVICE_H_
 +
 +#include <memory>
++#include <optional>
 +#include <string>
++#include <vector>
 +
++#include "base/containers/circular_deque.h"
 +#include "base/functional/callback.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/timer/timer.h"
 +#include "base/values.h"
 +#include "components/keyed_service/core/keyed_service.h"
 +#include "services/network/public/cpp/simple_url_loader.h"
@@ -32,6 +36,11 @@ index 0000000000000..2157d1eb1698e
 +// Service for capturing and sending analytics events to PostHog.
 +// This service manages a stable client ID (per-profile) and install ID
 +// (per-installation) and sends events to the PostHog API.
++//
++// Events are queued in memory and uploaded together through PostHog's batch
++// endpoint, once enough have been queued or a while after the first one.
++// Events not yet uploaded when the profile shuts down, or while uploads
++// fail, are kept in profile prefs and sent later.
 +class BrowserOSMetricsService : public KeyedService {
 + public:
 +  explicit BrowserOSMetricsService(
@@ -66,16 +75,26 @@ index 0000000000000..2157d1eb1698e
 +  // Initializes or retrieves the stable install ID from local state.
 +  void InitializeInstallId();
 +
-+  // Sends the event to PostHog API.
-+  void SendEventToPostHog(const std::string& event_name,
-+                          base::Value::Dict properties);
++  // Adds an event to the upload queue, dropping the oldest if it is full.
++  void QueueEvent(base::Value::Dict event);
 +
-+  // Handles the response from PostHog API.
-+  void OnPostHogResponse(std::unique_ptr<network::SimpleURLLoader> loader,
-+                         std::unique_ptr<std::string> response_body);
++  // Uploads the queued events as one batch, unless one is in flight. The
++  // batch is serialized on the ThreadPool first.
++  void FlushEvents();
++  void OnBatchSerialized(std::optional<std::string> json_payload);
 +
-+  // Adds default properties to the event.
-+  void AddDefaultProperties(base::Value::Dict& properties);
++  // Handles the response to a batch upload. Failed events are queued again.
++  void OnBatchUploaded(std::unique_ptr<std::string> response_body);
++
++  // Moves events persisted by an earlier session into the queue.
++  void LoadPersistedEvents();
++
++  // Saves the queued and in-flight events to profile prefs.
++  void PersistEvents();
++
++  // Computes the properties added to every event, which don't change for
++  // the life of the service.
++  void InitializeDefaultProperties();
 +
 +  // PrefService for storing the stable client ID (profile prefs).
 +  raw_ptr<PrefService> pref_service_;
@@ -92,6 +111,19 @@ index 0000000000000..2157d1eb1698e
 +  // Stable install ID for this browser installation.
 +  std::string install_id_;
 +
++  // Browser version, OS and install ID, sent with every event.
++  base::Value::Dict default_properties_;
++
++  // Events waiting for the next batch upload, oldest first.
++  base::circular_deque<base::Value::Dict> pending_events_;
++
++  // Events of the batch being serialized or uploaded, with its loader.
++  std::vector<base::Value::Dict> uploading_events_;
++  std::unique_ptr<network::SimpleURLLoader> upload_loader_;
++
++  // Flushes the queue a while after the first event was queued.
++  base::OneShotTimer flush_timer_;
++
 +  // Weak pointer factory for callbacks.
 +  base::WeakPtrFactory<BrowserOSMetricsService> weak_factory_{this};
 +};
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser.cc b/chrome/browser/browseros/server/browseros_appcast_parser.cc
 new file mode 100644
-index 0000000000000..dd30f75d414ec
+index 0000000000000..05e886224d468
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser.cc
-@@ -0,0 +1,202 @@
+@@ -0,0 +1,310 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,6 +12,7 @@ index 0000000000000..dd30f75d414ec
 +
 +#include <map>
 +
++#include "base/json/values_util.h"
 +#include "base/logging.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/time/time.h"
@@ -105,6 +106,11 @@ index 0000000000000..dd30f75d414ec
 +    base::StringToInt64(it->second, &enclosure.length);
 +  }
 +
++  it = attrs.find("sparkle:deltaFrom");
++  if (it != attrs.end()) {
++    enclosure.delta_from = base::Version(it->second);
++  }
++
 +  return enclosure;
 +}
 +
@@ -114,9 +120,111 @@ index 0000000000000..dd30f75d414ec
 +  return os == GetCurrentOSString() && arch == GetCurrentArchString();
 +}
 +
++bool AppcastEnclosure::IsDelta() const {
++  return delta_from.IsValid();
++}
++
++base::Value::Dict AppcastEnclosure::ToValue() const {
++  base::Value::Dict dict;
++  dict.Set("url", url);
++  dict.Set("os", os);
++  dict.Set("arch", arch);
++  dict.Set("signature", signature);
++  dict.Set("length", base::Int64ToValue(length));
++  if (IsDelta()) {
++    dict.Set("delta_from", delta_from.GetString());
++  }
++  return dict;
++}
++
++// static
++std::optional<AppcastEnclosure> AppcastEnclosure::FromValue(
++    const base::Value::Dict& dict) {
++  const std::string* url = dict.FindString("url");
++  const std::string* os = dict.FindString("os");
++  const std::string* arch = dict.FindString("arch");
++  const std::string* signature = dict.FindString("signature");
++  const base::Value* length = dict.Find("length");
++  if (!url || url->empty() || !os || !arch || !signature || !length) {
++    return std::nullopt;
++  }
++
++  AppcastEnclosure enclosure;
++  enclosure.url = *url;
++  enclosure.os = *os;
++  enclosure.arch = *arch;
++  enclosure.signature = *signature;
++  enclosure.length = base::ValueToInt64(*length).value_or(0);
++  if (const std::string* delta_from = dict.FindString("delta_from")) {
++    enclosure.delta_from = base::Version(*delta_from);
++    if (!enclosure.IsDelta()) {
++      return std::nullopt;
++    }
++  }
++  return enclosure;
++}
++
++base::Value::Dict AppcastItem::ToValue() const {
++  base::Value::List enclosure_list;
++  for (const auto& enclosure : enclosures) {
++    enclosure_list.Append(enclosure.ToValue());
++  }
++
++  base::Value::Dict dict;
++  dict.Set("version", version.GetString());
++  dict.Set("pub_date", base::TimeToValue(pub_date));
++  dict.Set("enclosures", std::move(enclosure_list));
++  return dict;
++}
++
++// static
++std::optional<AppcastItem> AppcastItem::FromValue(
++    const base::Value::Dict& dict) {
++  const std::string* version = dict.FindString("version");
++  const base::Value::List* enclosure_list = dict.FindList("enclosures");
++  if (!version || !enclosure_list) {
++    return std::nullopt;
++  }
++
++  AppcastItem item;
++  item.version = base::Version(*version);
++  if (!item.version.IsValid()) {
++    return std::nullopt;
++  }
++  if (const base::Value* pub_date = dict.Find("pub_date")) {
++    item.pub_date = base::ValueToTime(*pub_date).value_or(base::Time());
++  }
++  for (const base::Value& value : *enclosure_list) {
++    if (!value.is_dict()) {
++      return std::nullopt;
++    }
++    std::optional<AppcastEnclosure> enclosure =
++        AppcastEnclosure::FromValue(value.GetDict());
++    if (!enclosure) {
++      return std::nullopt;
++    }
++    item.enclosures.push_back(std::move(*enclosure));
++  }
++  return item;
++}
++
 +const AppcastEnclosure* AppcastItem::GetEnclosureForCurrentPlatform() const {
 +  for (const auto& enclosure : enclosures) {
-+    if (enclosure.MatchesCurrentPlatform()) {
++    if (!enclosure.IsDelta() && enclosure.MatchesCurrentPlatform()) {
++      return &enclosure;
++    }
++  }
++  return nullptr;
++}
++
++const AppcastEnclosure* AppcastItem::GetDeltaEnclosureForCurrentPlatform(
++    const base::Version& from) const {
++  if (!from.IsValid()) {
++    return nullptr;
++  }
++  for (const auto& enclosure : enclosures) {
++    if (enclosure.IsDelta() && enclosure.delta_from == from &&
++        enclosure.MatchesCurrentPlatform()) {
 +      return &enclosure;
 +    }
 +  }
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser.h b/chrome/browser/browseros/server/browseros_appcast_parser.h
 new file mode 100644
-index 0000000000000..bd996e8cb06d2
+index 0000000000000..7f23d0a45cdca
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser.h
-@@ -0,0 +1,88 @@
+@@ -0,0 +1,121 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -16,6 +16,7 @@ index 0000000000000..bd996e8cb06d2
 +#include <vector>
 +
 +#include "base/time/time.h"
++#include "base/values.h"
 +#include "base/version.h"
 +
 +namespace browseros_server {
@@ -35,9 +36,20 @@ index 0000000000000..bd996e8cb06d2
 +  std::string arch;       // "arm64", "x86_64"
 +  std::string signature;  // Ed25519 signature (base64)
 +  int64_t length = 0;
++  // For delta packages, the installed version the delta applies to
++  base::Version delta_from;
 +
 +  // Returns true if this enclosure matches the current platform and arch.
 +  bool MatchesCurrentPlatform() const;
++
++  // Returns true if this is a delta against |delta_from| rather than a full
++  // package.
++  bool IsDelta() const;
++
++  // Serialization for caching a parsed appcast in prefs.
++  base::Value::Dict ToValue() const;
++  static std::optional<AppcastEnclosure> FromValue(
++      const base::Value::Dict& dict);
 +};
 +
 +// Represents a single item (version) in an appcast feed.
@@ -53,8 +65,19 @@ index 0000000000000..bd996e8cb06d2
 +  base::Time pub_date;
 +  std::vector<AppcastEnclosure> enclosures;
 +
-+  // Returns the enclosure matching the current platform, or nullptr if none.
++  // Returns the full-package enclosure matching the current platform, or
++  // nullptr if none.
 +  const AppcastEnclosure* GetEnclosureForCurrentPlatform() const;
++
++  // Returns the delta enclosure for the current platform that upgrades
++  // |from|, or nullptr if the feed has none.
++  const AppcastEnclosure* GetDeltaEnclosureForCurrentPlatform(
++      const base::Version& from) const;
++
++  // Serialization for caching a parsed appcast in prefs. FromValue() returns
++  // std::nullopt for a dict that ToValue() could not have produced.
++  base::Value::Dict ToValue() const;
++  static std::optional<AppcastItem> FromValue(const base::Value::Dict& dict);
 +};
 +
 +// Parses Sparkle-style appcast XML to extract version and download information.
@@ -72,6 +95,16 @@ index 0000000000000..bd996e8cb06d2
 +//         sparkle:edSignature="base64..."
 +//         length="12345678"
 +//         type="application/zip"/>
++//       <sparkle:deltas>
++//         <enclosure
++//           url="https://..."
++//           sparkle:os="macos"
++//           sparkle:arch="arm64"
++//           sparkle:deltaFrom="0.29.0"
++//           sparkle:edSignature="base64..."
++//           length="123456"
++//           type="application/zip"/>
++//       </sparkle:deltas>
 +//     </item>
 +//   </channel>
 +// </rss>
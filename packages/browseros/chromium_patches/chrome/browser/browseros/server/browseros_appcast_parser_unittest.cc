@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc b/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc
 new file mode 100644
-index 0000000000000..ceb483dee35c6
+index 0000000000000..84f8116e395a7
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser_unittest.cc
-@@ -0,0 +1,389 @@
+@@ -0,0 +1,516 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -391,5 +391,132 @@ index 0000000000000..ceb483dee35c6
 +  EXPECT_TRUE(item->enclosures[0].signature.empty());
 +}
 +
++// =============================================================================
++// Delta Enclosures
++// =============================================================================
++
++TEST(BrowserOSAppcastParserTest, ParsesDeltaEnclosures) {
++  const char kDeltaXml[] = R"(
++    <rss xmlns:sparkle="http://www.andymatuschak.org/xml-namespaces/sparkle">
++      <channel>
++        <item>
++          <sparkle:version>1.1.0</sparkle:version>
++          <enclosure url="https://example.com/full.zip"
++                     sparkle:os="macos" sparkle:arch="arm64"
++                     sparkle:edSignature="full_sig" length="1000"/>
++          <sparkle:deltas>
++            <enclosure url="https://example.com/delta-1.0.0.zip"
++                       sparkle:os="macos" sparkle:arch="arm64"
++                       sparkle:deltaFrom="1.0.0"
++                       sparkle:edSignature="delta_sig" length="100"/>
++          </sparkle:deltas>
++        </item>
++      </channel>
++    </rss>
++  )";
++
++  auto item = BrowserOSAppcastParser::ParseLatestItem(kDeltaXml);
++
++  ASSERT_TRUE(item.has_value());
++  ASSERT_EQ(2u, item->enclosures.size());
++  EXPECT_FALSE(item->enclosures[0].IsDelta());
++  EXPECT_TRUE(item->enclosures[1].IsDelta());
++  EXPECT_EQ(base::Version("1.0.0"), item->enclosures[1].delta_from);
++  EXPECT_EQ("https://example.com/delta-1.0.0.zip", item->enclosures[1].url);
++  EXPECT_EQ("delta_sig", item->enclosures[1].signature);
++}
++
++TEST(AppcastItemTest, DeltaEnclosuresAreSeparateFromFullPackage) {
++  AppcastItem item;
++  item.version = base::Version("1.1.0");
++
++  // A full package and a delta from 1.0.0 for every platform, deltas first
++  const char* const kPlatforms[][2] = {{"macos", "arm64"},
++                                       {"macos", "x86_64"},
++                                       {"linux", "x86_64"},
++                                       {"windows", "x86_64"}};
++  for (const auto& platform : kPlatforms) {
++    AppcastEnclosure delta;
++    delta.os = platform[0];
++    delta.arch = platform[1];
++    delta.url = "https://example.com/delta.zip";
++    delta.delta_from = base::Version("1.0.0");
++    item.enclosures.push_back(delta);
++  }
++  for (const auto& platform : kPlatforms) {
++    AppcastEnclosure full;
++    full.os = platform[0];
++    full.arch = platform[1];
++    full.url = "https://example.com/full.zip";
++    item.enclosures.push_back(full);
++  }
++
++  const AppcastEnclosure* full = item.GetEnclosureForCurrentPlatform();
++  const AppcastEnclosure* delta =
++      item.GetDeltaEnclosureForCurrentPlatform(base::Version("1.0.0"));
++  EXPECT_EQ(full == nullptr, delta == nullptr);
++  if (full) {
++    EXPECT_EQ("https://example.com/full.zip", full->url);
++    EXPECT_EQ("https://example.com/delta.zip", delta->url);
++  }
++
++  EXPECT_EQ(nullptr,
++            item.GetDeltaEnclosureForCurrentPlatform(base::Version("0.9.0")));
++  EXPECT_EQ(nullptr, item.GetDeltaEnclosureForCurrentPlatform(base::Version()));
++}
++
++// =============================================================================
++// Serialization
++// =============================================================================
++
++TEST(AppcastItemTest, ValueRoundTrip) {
++  AppcastItem item;
++  item.version = base::Version("1.2.3");
++  item.pub_date = base::Time::UnixEpoch() + base::Days(20000);
++
++  AppcastEnclosure full;
++  full.url = "https://example.com/full.zip";
++  full.os = "linux";
++  full.arch = "x86_64";
++  full.signature = "full_sig";
++  full.length = int64_t{5} * 1024 * 1024 * 1024;
++
++  AppcastEnclosure delta = full;
++  delta.url = "https://example.com/delta.zip";
++  delta.signature = "delta_sig";
++  delta.length = 1000;
++  delta.delta_from = base::Version("1.2.0");
++
++  item.enclosures = {full, delta};
++
++  std::optional<AppcastItem> restored = AppcastItem::FromValue(item.ToValue());
++  ASSERT_TRUE(restored.has_value());
++  EXPECT_EQ(item.version, restored->version);
++  EXPECT_EQ(item.pub_date, restored->pub_date);
++  ASSERT_EQ(2u, restored->enclosures.size());
++  EXPECT_EQ(full.url, restored->enclosures[0].url);
++  EXPECT_EQ(full.os, restored->enclosures[0].os);
++  EXPECT_EQ(full.arch, restored->enclosures[0].arch);
++  EXPECT_EQ(full.signature, restored->enclosures[0].signature);
++  EXPECT_EQ(full.length, restored->enclosures[0].length);
++  EXPECT_FALSE(restored->enclosures[0].IsDelta());
++  EXPECT_EQ(base::Version("1.2.0"), restored->enclosures[1].delta_from);
++}
++
++TEST(AppcastItemTest, FromValueRejectsInvalidDict) {
++  EXPECT_FALSE(AppcastItem::FromValue(base::Value::Dict()).has_value());
++
++  base::Value::Dict bad_version;
++  bad_version.Set("version", "not a version");
++  bad_version.Set("enclosures", base::Value::List());
++  EXPECT_FALSE(AppcastItem::FromValue(bad_version).has_value());
++
++  base::Value::Dict bad_enclosure;
++  bad_enclosure.Set("version", "1.0.0");
++  bad_enclosure.Set("enclosures",
++                    base::Value::List().Append(base::Value::Dict()));
++  EXPECT_FALSE(AppcastItem::FromValue(bad_enclosure).has_value());
++}
++
 +}  // namespace
 +}  // namespace browseros_server
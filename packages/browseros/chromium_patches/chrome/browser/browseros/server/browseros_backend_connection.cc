@@ -0,0 +1,423 @@
+diff --git a/chrome/browser/browseros/server/browseros_backend_connection.cc b/chrome/browser/browseros/server/browseros_backend_connection.cc
+new file mode 100644
+index 0000000000000..52a76ab8c8769
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_backend_connection.cc
+@@ -0,0 +1,417 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_backend_connection.h"
++
++#include <algorithm>
++
++#include "base/containers/span.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "build/build_config.h"
++#include "net/base/address_list.h"
++#include "net/base/io_buffer.h"
++#include "net/base/ip_address.h"
++#include "net/base/ip_endpoint.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_chunked_decoder.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "net/http/http_util.h"
++#include "net/log/net_log_source.h"
++#include "net/socket/tcp_client_socket.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include "net/socket/unix_domain_client_socket_posix.h"
++#endif
++
++namespace browseros {
++
++namespace {
++
++// Enough for bursts of concurrent tool calls from one client
++constexpr size_t kMaxIdleConnections = 8;
++
++constexpr int kReadBufferSize = 64 * 1024;
++
++// Larger response headers are treated as a broken backend
++constexpr size_t kMaxResponseHeaderSize = 64 * 1024;
++
++}  // namespace
++
++// BrowserOSBackendConnectionPool implementation
++
++BrowserOSBackendConnectionPool::BrowserOSBackendConnectionPool() = default;
++BrowserOSBackendConnectionPool::~BrowserOSBackendConnectionPool() = default;
++
++void BrowserOSBackendConnectionPool::SetBackend(
++    int port,
++    const base::FilePath& socket_path) {
++  if (port != port_ || socket_path != socket_path_ ||
++      address_ != net::IPAddress::IPv4Localhost()) {
++    idle_sockets_.clear();
++    address_ = net::IPAddress::IPv4Localhost();
++    port_ = port;
++    socket_path_ = socket_path;
++    generation_++;
++  }
++}
++
++void BrowserOSBackendConnectionPool::SetRemoteBackend(
++    const net::IPEndPoint& endpoint) {
++  if (endpoint.address() != address_ || endpoint.port() != port_ ||
++      !socket_path_.empty()) {
++    idle_sockets_.clear();
++    address_ = endpoint.address();
++    port_ = endpoint.port();
++    socket_path_.clear();
++    generation_++;
++  }
++}
++
++std::string BrowserOSBackendConnectionPool::host() const {
++  return net::IPEndPoint(address_, port_).ToString();
++}
++
++std::unique_ptr<net::StreamSocket> BrowserOSBackendConnectionPool::Take() {
++  while (!idle_sockets_.empty()) {
++    std::unique_ptr<net::StreamSocket> socket =
++        std::move(idle_sockets_.back());
++    idle_sockets_.pop_back();
++    // Drops connections the backend closed while they sat idle
++    if (socket->IsConnectedAndIdle()) {
++      return socket;
++    }
++  }
++  return nullptr;
++}
++
++void BrowserOSBackendConnectionPool::Return(
++    std::unique_ptr<net::StreamSocket> socket,
++    int generation) {
++  if (generation != generation_ ||
++      idle_sockets_.size() >= kMaxIdleConnections ||
++      !socket->IsConnectedAndIdle()) {
++    return;
++  }
++  idle_sockets_.push_back(std::move(socket));
++}
++
++size_t BrowserOSBackendConnectionPool::CloseIdleConnections() {
++  const size_t count = idle_sockets_.size();
++  idle_sockets_.clear();
++  return count;
++}
++
++std::unique_ptr<net::StreamSocket>
++BrowserOSBackendConnectionPool::CreateSocket() const {
++#if BUILDFLAG(IS_POSIX)
++  if (!socket_path_.empty()) {
++    return std::make_unique<net::UnixDomainClientSocket>(
++        socket_path_.value(), /*use_abstract_namespace=*/false);
++  }
++#endif
++  return std::make_unique<net::TCPClientSocket>(
++      net::AddressList(net::IPEndPoint(address_, port_)),
++      nullptr, nullptr, nullptr, net::NetLogSource());
++}
++
++// BrowserOSBackendRequest implementation
++
++BrowserOSBackendRequest::BrowserOSBackendRequest(
++    BrowserOSBackendConnectionPool* pool,
++    Delegate* delegate,
++    const net::NetworkTrafficAnnotationTag& traffic_annotation)
++    : pool_(pool),
++      delegate_(delegate),
++      traffic_annotation_(traffic_annotation),
++      host_(pool->host()),
++      pool_generation_(pool->generation()) {}
++
++BrowserOSBackendRequest::~BrowserOSBackendRequest() = default;
++
++void BrowserOSBackendRequest::Start(
++    const std::string& method,
++    const std::string& path,
++    const std::vector<std::pair<std::string, std::string>>& headers,
++    const std::string& body,
++    base::TimeDelta timeout) {
++  method_ = method;
++  request_ = method + " " + path + " HTTP/1.1\r\n";
++  request_ += "Host: " + host_ + "\r\n";
++  request_ += "Connection: keep-alive\r\n";
++  for (const auto& [name, value] : headers) {
++    request_ += name + ": " + value + "\r\n";
++  }
++  if (!body.empty() || method == "POST") {
++    request_ +=
++        "Content-Length: " + base::NumberToString(body.size()) + "\r\n";
++  }
++  request_ += "\r\n";
++  request_ += body;
++
++  timeout_timer_.Start(FROM_HERE, timeout,
++                       base::BindOnce(&BrowserOSBackendRequest::Finish,
++                                      base::Unretained(this), false));
++
++  std::unique_ptr<net::StreamSocket> socket = pool_->Take();
++  if (socket) {
++    StartOnSocket(std::move(socket), /*reused=*/true);
++  } else {
++    StartOnSocket(pool_->CreateSocket(), /*reused=*/false);
++  }
++}
++
++void BrowserOSBackendRequest::StartOnSocket(
++    std::unique_ptr<net::StreamSocket> socket,
++    bool reused) {
++  socket_ = std::move(socket);
++  reused_socket_ = reused;
++  write_buffer_ = nullptr;
++  pending_read_.clear();
++
++  if (reused) {
++    DoWrite();
++    return;
++  }
++
++  int result = socket_->Connect(base::BindOnce(
++      &BrowserOSBackendRequest::OnConnect, base::Unretained(this)));
++  if (result != net::ERR_IO_PENDING) {
++    OnConnect(result);
++  }
++}
++
++void BrowserOSBackendRequest::OnConnect(int result) {
++  if (result != net::OK) {
++    LOG(WARNING) << "browseros: Backend connect failed - "
++                 << net::ErrorToString(result);
++    Finish(false);
++    return;
++  }
++  DoWrite();
++}
++
++void BrowserOSBackendRequest::DoWrite() {
++  if (!write_buffer_) {
++    write_buffer_ = base::MakeRefCounted<net::DrainableIOBuffer>(
++        base::MakeRefCounted<net::StringIOBuffer>(request_), request_.size());
++  }
++
++  while (write_buffer_->BytesRemaining() > 0) {
++    int result = socket_->Write(
++        write_buffer_.get(), write_buffer_->BytesRemaining(),
++        base::BindOnce(&BrowserOSBackendRequest::OnWrite,
++                       base::Unretained(this)),
++        traffic_annotation_);
++    if (result == net::ERR_IO_PENDING) {
++      return;
++    }
++    if (result < 0) {
++      if (!MaybeRetry()) {
++        Finish(false);
++      }
++      return;
++    }
++    write_buffer_->DidConsume(result);
++  }
++
++  write_buffer_ = nullptr;
++  DoRead();
++}
++
++void BrowserOSBackendRequest::OnWrite(int result) {
++  if (result < 0) {
++    if (!MaybeRetry()) {
++      Finish(false);
++    }
++    return;
++  }
++
++  write_buffer_->DidConsume(result);
++  DoWrite();
++}
++
++void BrowserOSBackendRequest::DoRead() {
++  if (!read_buffer_) {
++    read_buffer_ =
++        base::MakeRefCounted<net::IOBufferWithSize>(kReadBufferSize);
++  }
++
++  // Reads that complete synchronously are handled in this loop rather than
++  // by recursing
++  while (true) {
++    int result = socket_->Read(
++        read_buffer_.get(), read_buffer_->size(),
++        base::BindOnce(&BrowserOSBackendRequest::OnReadCompleted,
++                       base::Unretained(this)));
++    if (result == net::ERR_IO_PENDING || !HandleRead(result)) {
++      return;
++    }
++  }
++}
++
++void BrowserOSBackendRequest::OnReadCompleted(int result) {
++  if (HandleRead(result)) {
++    DoRead();
++  }
++}
++
++bool BrowserOSBackendRequest::HandleRead(int result) {
++  if (result <= 0) {
++    if (!response_headers_) {
++      if (!MaybeRetry()) {
++        Finish(false);
++      }
++      return false;
++    }
++    if (result == 0 && framing_ == BodyFraming::kUntilClose) {
++      Finish(true);
++      return false;
++    }
++    Finish(false);
++    return false;
++  }
++
++  pending_read_.append(read_buffer_->data(), result);
++  if (!response_headers_) {
++    return ProcessResponseHeaders();
++  }
++  return ProcessBody();
++}
++
++bool BrowserOSBackendRequest::ProcessResponseHeaders() {
++  while (!response_headers_) {
++    size_t header_end = pending_read_.find("\r\n\r\n");
++    if (header_end == std::string::npos) {
++      if (pending_read_.size() > kMaxResponseHeaderSize) {
++        Finish(false);
++        return false;
++      }
++      return true;  // Waiting for the rest of the headers
++    }
++
++    header_end += 4;
++    auto headers = base::MakeRefCounted<net::HttpResponseHeaders>(
++        net::HttpUtil::AssembleRawHeaders(
++            std::string_view(pending_read_).substr(0, header_end)));
++    pending_read_.erase(0, header_end);
++    if (headers->response_code() / 100 == 1) {
++      continue;  // Interim response; the final one follows
++    }
++    response_headers_ = std::move(headers);
++  }
++
++  const int response_code = response_headers_->response_code();
++  const int64_t content_length = response_headers_->GetContentLength();
++  if (method_ == "HEAD" || response_code == net::HTTP_NO_CONTENT ||
++      response_code == net::HTTP_NOT_MODIFIED) {
++    framing_ = BodyFraming::kNone;
++  } else if (response_headers_->IsChunkEncoded()) {
++    framing_ = BodyFraming::kChunked;
++    chunked_decoder_ = std::make_unique<net::HttpChunkedDecoder>();
++  } else if (content_length >= 0) {
++    framing_ = BodyFraming::kContentLength;
++    remaining_body_bytes_ = content_length;
++  } else {
++    framing_ = BodyFraming::kUntilClose;
++  }
++  keep_alive_ = response_headers_->IsKeepAlive() &&
++                framing_ != BodyFraming::kUntilClose;
++
++  base::WeakPtr<BrowserOSBackendRequest> self = weak_factory_.GetWeakPtr();
++  delegate_->OnResponseStarted(response_headers_);
++  if (!self) {
++    return false;
++  }
++  return ProcessBody();
++}
++
++bool BrowserOSBackendRequest::ProcessBody() {
++  std::string data;
++  bool body_complete = false;
++
++  switch (framing_) {
++    case BodyFraming::kNone:
++      body_complete = true;
++      break;
++    case BodyFraming::kContentLength: {
++      const size_t length = static_cast<size_t>(std::min<int64_t>(
++          remaining_body_bytes_, static_cast<int64_t>(pending_read_.size())));
++      data = pending_read_.substr(0, length);
++      remaining_body_bytes_ -= length;
++      pending_read_.erase(0, length);
++      body_complete = remaining_body_bytes_ == 0;
++      break;
++    }
++    case BodyFraming::kChunked: {
++      int result = chunked_decoder_->FilterBuf(
++          base::as_writable_byte_span(pending_read_));
++      if (result < 0) {
++        Finish(false);
++        return false;
++      }
++      data = pending_read_.substr(0, result);
++      pending_read_.clear();
++      body_complete = chunked_decoder_->reached_eof();
++      if (chunked_decoder_->bytes_after_eof() > 0) {
++        keep_alive_ = false;
++      }
++      break;
++    }
++    case BodyFraming::kUntilClose:
++      data = std::move(pending_read_);
++      pending_read_.clear();
++      break;
++  }
++
++  if (body_complete && !pending_read_.empty()) {
++    // Bytes past the response; the connection is out of step
++    keep_alive_ = false;
++  }
++
++  if (!data.empty()) {
++    base::WeakPtr<BrowserOSBackendRequest> self = weak_factory_.GetWeakPtr();
++    delegate_->OnResponseData(data);
++    if (!self) {
++      return false;
++    }
++  }
++
++  if (body_complete) {
++    Finish(true);
++    return false;
++  }
++  return true;
++}
++
++bool BrowserOSBackendRequest::MaybeRetry() {
++  // A pooled connection may have been closed by the backend's keep-alive
++  // timeout just before it was reused
++  if (!reused_socket_ || response_headers_ || finished_) {
++    return false;
++  }
++
++  VLOG(1) << "browseros: Reused backend connection was closed, retrying";
++  StartOnSocket(pool_->CreateSocket(), /*reused=*/false);
++  return true;
++}
++
++void BrowserOSBackendRequest::Finish(bool success) {
++  if (finished_) {
++    return;
++  }
++  finished_ = true;
++  timeout_timer_.Stop();
++
++  if (success && keep_alive_ && socket_) {
++    pool_->Return(std::move(socket_), pool_generation_);
++  }
++  socket_.reset();
++
++  delegate_->OnResponseComplete(success);
++}
++
++}  // namespace browseros
@@ -0,0 +1,179 @@
+diff --git a/chrome/browser/browseros/server/browseros_backend_connection.h b/chrome/browser/browseros/server/browseros_backend_connection.h
+new file mode 100644
+index 0000000000000..3981b91a05b1d
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_backend_connection.h
+@@ -0,0 +1,173 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_BACKEND_CONNECTION_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_BACKEND_CONNECTION_H_
++
++#include <cstdint>
++#include <memory>
++#include <string>
++#include <string_view>
++#include <utility>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/timer/timer.h"
++#include "net/base/ip_address.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++
++namespace net {
++class DrainableIOBuffer;
++class HttpChunkedDecoder;
++class HttpResponseHeaders;
++class IOBufferWithSize;
++class IPEndPoint;
++class StreamSocket;
++}  // namespace net
++
++namespace browseros {
++
++// Idle keep-alive connections to the sidecar's backend. The proxy's
++// upstreams are its own sidecars, so it talks HTTP/1.1 over raw loopback TCP
++// sockets, or over the backend's Unix domain socket when it has one, instead
++// of going through the network service. Fleet nodes (SetRemoteBackend()) are
++// other BrowserOS proxies, reached the same way over the network.
++class BrowserOSBackendConnectionPool {
++ public:
++  BrowserOSBackendConnectionPool();
++  ~BrowserOSBackendConnectionPool();
++
++  BrowserOSBackendConnectionPool(const BrowserOSBackendConnectionPool&) =
++      delete;
++  BrowserOSBackendConnectionPool& operator=(
++      const BrowserOSBackendConnectionPool&) = delete;
++
++  // Switches to a new backend, dropping connections to the old one. A
++  // non-empty |socket_path| is used instead of 127.0.0.1:|port| (POSIX
++  // only); |port| still names the backend in Host headers.
++  void SetBackend(int port, const base::FilePath& socket_path);
++  // Switches to the BrowserOS proxy at |endpoint| on another host
++  void SetRemoteBackend(const net::IPEndPoint& endpoint);
++  int port() const { return port_; }
++  // "address:port", for Host headers
++  std::string host() const;
++
++  // Bumped by every SetBackend() that changes the backend
++  int generation() const { return generation_; }
++
++  // Returns an idle connection, or nullptr if none is usable.
++  std::unique_ptr<net::StreamSocket> Take();
++
++  // Keeps |socket| for reuse if it is idle, still connected to the current
++  // backend (|generation|), and the pool has room.
++  void Return(std::unique_ptr<net::StreamSocket> socket, int generation);
++
++  // Creates a new, unconnected socket to the backend.
++  std::unique_ptr<net::StreamSocket> CreateSocket() const;
++
++  // Closes the idle connections, returning how many there were.
++  size_t CloseIdleConnections();
++
++ private:
++  net::IPAddress address_ = net::IPAddress::IPv4Localhost();
++  int port_ = 0;
++  base::FilePath socket_path_;
++  int generation_ = 0;
++  std::vector<std::unique_ptr<net::StreamSocket>> idle_sockets_;
++};
++
++// One HTTP/1.1 request to the backend over a pooled connection. The
++// response is reported to the delegate as it arrives; the body is
++// de-chunked. The connection goes back to the pool if the response leaves
++// it reusable.
++class BrowserOSBackendRequest {
++ public:
++  // Each method may delete the request.
++  class Delegate {
++   public:
++    virtual ~Delegate() = default;
++
++    virtual void OnResponseStarted(
++        scoped_refptr<net::HttpResponseHeaders> headers) = 0;
++    virtual void OnResponseData(std::string_view data) = 0;
++    // |success| is false if the request failed or the body was truncated.
++    virtual void OnResponseComplete(bool success) = 0;
++  };
++
++  BrowserOSBackendRequest(
++      BrowserOSBackendConnectionPool* pool,
++      Delegate* delegate,
++      const net::NetworkTrafficAnnotationTag& traffic_annotation);
++  ~BrowserOSBackendRequest();
++
++  BrowserOSBackendRequest(const BrowserOSBackendRequest&) = delete;
++  BrowserOSBackendRequest& operator=(const BrowserOSBackendRequest&) = delete;
++
++  // |headers| are sent as-is, one "Name: value" pair each.
++  void Start(const std::string& method,
++             const std::string& path,
++             const std::vector<std::pair<std::string, std::string>>& headers,
++             const std::string& body,
++             base::TimeDelta timeout);
++
++ private:
++  // How the end of the response body is found
++  enum class BodyFraming {
++    kNone,
++    kContentLength,
++    kChunked,
++    kUntilClose,
++  };
++
++  void StartOnSocket(std::unique_ptr<net::StreamSocket> socket, bool reused);
++  void OnConnect(int result);
++  void DoWrite();
++  void OnWrite(int result);
++  void DoRead();
++  void OnReadCompleted(int result);
++
++  // Steps below return false once the request is finished, after which
++  // |this| may already be deleted.
++  bool HandleRead(int result);
++  bool ProcessResponseHeaders();
++  bool ProcessBody();
++
++  // Retries once on a fresh connection if a reused one turned out to be
++  // closed by the backend before answering. Returns false if not retried.
++  bool MaybeRetry();
++
++  void Finish(bool success);
++
++  raw_ptr<BrowserOSBackendConnectionPool> pool_;
++  raw_ptr<Delegate> delegate_;
++  const net::NetworkTrafficAnnotationTag traffic_annotation_;
++  const std::string host_;
++  const int pool_generation_;
++
++  std::string request_;
++  std::string method_;
++  bool reused_socket_ = false;
++  bool finished_ = false;
++  base::OneShotTimer timeout_timer_;
++
++  std::unique_ptr<net::StreamSocket> socket_;
++  scoped_refptr<net::DrainableIOBuffer> write_buffer_;
++  scoped_refptr<net::IOBufferWithSize> read_buffer_;
++  std::string pending_read_;  // Received bytes not consumed yet
++
++  scoped_refptr<net::HttpResponseHeaders> response_headers_;
++  BodyFraming framing_ = BodyFraming::kNone;
++  int64_t remaining_body_bytes_ = 0;
++  std::unique_ptr<net::HttpChunkedDecoder> chunked_decoder_;
++  bool keep_alive_ = false;
++
++  base::WeakPtrFactory<BrowserOSBackendRequest> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_BACKEND_CONNECTION_H_
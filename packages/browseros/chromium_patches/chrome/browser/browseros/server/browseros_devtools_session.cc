@@ -0,0 +1,132 @@
+diff --git a/chrome/browser/browseros/server/browseros_devtools_session.cc b/chrome/browser/browseros/server/browseros_devtools_session.cc
+new file mode 100644
+index 0000000000000..ae5d5ef3159ce
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_devtools_session.cc
+@@ -0,0 +1,126 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_devtools_session.h"
++
++#include <algorithm>
++#include <optional>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/strings/string_util.h"
++#include "base/task/bind_post_task.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr char kDomainPrefix[] = "BrowserOS.";
++
++// JSON-RPC error codes, as used by the DevTools protocol
++constexpr int kParseError = -32700;
++constexpr int kInvalidRequest = -32600;
++constexpr int kMethodNotFound = -32601;
++constexpr int kInvalidParams = -32602;
++constexpr int kServerError = -32000;
++
++// Commands a client may have running at once
++constexpr size_t kMaxPendingCommands = 64;
++
++}  // namespace
++
++BrowserOSDevToolsSession::BrowserOSDevToolsSession(DirectCallHandler handler,
++                                                   SendCallback send)
++    : handler_(std::move(handler)), send_(std::move(send)) {}
++
++BrowserOSDevToolsSession::~BrowserOSDevToolsSession() = default;
++
++void BrowserOSDevToolsSession::HandleMessage(std::string_view message) {
++  std::optional<base::Value::Dict> command =
++      base::JSONReader::ReadDict(message);
++  if (!command) {
++    SendError(std::nullopt, kParseError, "Message must be a JSON object");
++    return;
++  }
++
++  std::optional<int> id = command->FindInt("id");
++  const std::string* method = command->FindString("method");
++  if (!id || !method) {
++    SendError(id, kInvalidRequest,
++              "Message must have integer 'id' and string 'method' properties");
++    return;
++  }
++
++  std::string_view function(*method);
++  if (!base::StartsWith(function, kDomainPrefix)) {
++    SendError(id, kMethodNotFound, "'" + *method + "' wasn't found");
++    return;
++  }
++  function.remove_prefix(std::size(kDomainPrefix) - 1);
++  if (function.empty() || !std::ranges::all_of(function, [](char c) {
++        return base::IsAsciiAlphaNumeric(c);
++      })) {
++    SendError(id, kMethodNotFound, "'" + *method + "' wasn't found");
++    return;
++  }
++
++  base::Value::List args;
++  if (const base::Value* params = command->Find("params")) {
++    const base::Value::List* list =
++        params->is_dict() ? params->GetDict().FindList("args") : nullptr;
++    if (!list && !(params->is_dict() && params->GetDict().empty())) {
++      SendError(id, kInvalidParams, "'params' must be {\"args\": [...]}");
++      return;
++    }
++    if (list) {
++      args = list->Clone();
++    }
++  }
++
++  if (pending_commands_ >= kMaxPendingCommands) {
++    SendError(id, kServerError, "Too many pending commands");
++    return;
++  }
++
++  pending_commands_++;
++  handler_.Run(std::string(function), std::move(args),
++               base::BindPostTaskToCurrentDefault(base::BindOnce(
++                   &BrowserOSDevToolsSession::OnCommandComplete,
++                   weak_factory_.GetWeakPtr(), *id)));
++}
++
++void BrowserOSDevToolsSession::OnCommandComplete(int id,
++                                                 DirectCallResult result) {
++  pending_commands_--;
++  if (!result.has_value()) {
++    SendError(id, kServerError, result.error());
++    return;
++  }
++
++  base::Value::Dict response;
++  response.Set("id", id);
++  response.Set("result",
++               base::Value::Dict().Set("results", std::move(result).value()));
++  Send(std::move(response));
++}
++
++void BrowserOSDevToolsSession::SendError(std::optional<int> id,
++                                         int code,
++                                         std::string_view message) {
++  base::Value::Dict response;
++  if (id) {
++    response.Set("id", *id);
++  }
++  response.Set("error",
++               base::Value::Dict().Set("code", code).Set("message", message));
++  Send(std::move(response));
++}
++
++void BrowserOSDevToolsSession::Send(base::Value::Dict message) {
++  send_.Run(base::WriteJson(message).value_or("{}"));
++}
++
++}  // namespace browseros
@@ -0,0 +1,65 @@
+diff --git a/chrome/browser/browseros/server/browseros_devtools_session.h b/chrome/browser/browseros/server/browseros_devtools_session.h
+new file mode 100644
+index 0000000000000..1c162e01f3171
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_devtools_session.h
+@@ -0,0 +1,59 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_DEVTOOLS_SESSION_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_DEVTOOLS_SESSION_H_
++
++#include <optional>
++#include <string>
++#include <string_view>
++
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_direct_call.h"
++
++namespace browseros {
++
++// One client of the proxy's /browseros/devtools WebSocket, speaking the
++// DevTools protocol's JSON framing for a BrowserOS domain. A command such as
++//
++//   {"id": 1, "method": "BrowserOS.getInteractiveSnapshot",
++//    "params": {"args": [42]}}
++//
++// runs the browserOS function of that name through the direct call handler
++// and is answered with {"id": 1, "result": {"results": [...]}}, or with
++// {"id": 1, "error": {"code": ..., "message": ...}}. As in CDP, commands run
++// concurrently and responses may arrive out of order.
++//
++// Lives on the IO thread with the proxy.
++class BrowserOSDevToolsSession {
++ public:
++  using SendCallback = base::RepeatingCallback<void(std::string message)>;
++
++  // |send| delivers one text frame to the client.
++  BrowserOSDevToolsSession(DirectCallHandler handler, SendCallback send);
++  ~BrowserOSDevToolsSession();
++
++  BrowserOSDevToolsSession(const BrowserOSDevToolsSession&) = delete;
++  BrowserOSDevToolsSession& operator=(const BrowserOSDevToolsSession&) =
++      delete;
++
++  void HandleMessage(std::string_view message);
++
++ private:
++  void OnCommandComplete(int id, DirectCallResult result);
++  void SendError(std::optional<int> id, int code, std::string_view message);
++  void Send(base::Value::Dict message);
++
++  const DirectCallHandler handler_;
++  const SendCallback send_;
++  size_t pending_commands_ = 0;
++
++  base::WeakPtrFactory<BrowserOSDevToolsSession> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_DEVTOOLS_SESSION_H_
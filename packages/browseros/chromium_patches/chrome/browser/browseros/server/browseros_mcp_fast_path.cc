@@ -0,0 +1,227 @@
+diff --git a/chrome/browser/browseros/server/browseros_mcp_fast_path.cc b/chrome/browser/browseros/server/browseros_mcp_fast_path.cc
+new file mode 100644
+index 0000000000000..3e5e743b40083
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_mcp_fast_path.cc
+@@ -0,0 +1,221 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_mcp_fast_path.h"
++
++#include <array>
++#include <iterator>
++#include <utility>
++
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/strings/string_util.h"
++
++namespace browseros {
++
++namespace {
++
++enum class ParamType {
++  kNone,
++  kInt,
++  kString,
++};
++
++struct Param {
++  const char* name = nullptr;
++  ParamType type = ParamType::kNone;
++  bool optional = false;
++};
++
++struct HotTool {
++  const char* tool;
++  const char* function;
++  // In the function's positional order
++  std::array<Param, 3> params;
++  bool image_result;
++};
++
++constexpr Param kTabId = {"tabId", ParamType::kInt, /*optional=*/true};
++constexpr Param kNodeId = {"nodeId", ParamType::kInt};
++constexpr Param kText = {"text", ParamType::kString};
++
++constexpr HotTool kHotTools[] = {
++    {"browser_snapshot", "getInteractiveSnapshot", {kTabId}, false},
++    {"browser_click", "click", {kTabId, kNodeId}, false},
++    {"browser_type", "inputText", {kTabId, kNodeId, kText}, false},
++    {"browser_screenshot", "captureScreenshot", {kTabId}, true},
++};
++
++constexpr char kDataUrlPrefix[] = "data:";
++constexpr char kBase64Marker[] = ";base64,";
++
++const HotTool* FindHotTool(const std::string& name) {
++  for (const HotTool& tool : kHotTools) {
++    if (name == tool.tool) {
++      return &tool;
++    }
++  }
++  return nullptr;
++}
++
++bool HasType(const base::Value& value, ParamType type) {
++  switch (type) {
++    case ParamType::kNone:
++      return false;
++    case ParamType::kInt:
++      return value.is_int();
++    case ParamType::kString:
++      return value.is_string();
++  }
++}
++
++// Positional arguments of |tool| from the named |arguments|, or
++// std::nullopt if they don't map onto its parameters
++std::optional<base::Value::List> MapArguments(
++    const HotTool& tool,
++    const base::Value::Dict& arguments) {
++  size_t mapped = 0;
++  base::Value::List args;
++  for (const Param& param : tool.params) {
++    if (!param.name) {
++      break;
++    }
++    const base::Value* value = arguments.Find(param.name);
++    if (value) {
++      mapped++;
++    }
++    if (!value || value->is_none()) {
++      if (!param.optional) {
++        return std::nullopt;
++      }
++      // Extension functions treat null as an omitted optional argument
++      args.Append(base::Value());
++      continue;
++    }
++    if (!HasType(*value, param.type)) {
++      return std::nullopt;
++    }
++    args.Append(value->Clone());
++  }
++  if (mapped != arguments.size()) {
++    return std::nullopt;
++  }
++
++  while (!args.empty() && args.back().is_none()) {
++    args.erase(args.end() - 1);
++  }
++  return args;
++}
++
++base::Value::Dict TextContent(std::string text) {
++  return base::Value::Dict().Set("type", "text").Set("text", std::move(text));
++}
++
++// Image content from a data: URL, or nullopt if |url| isn't a base64 one
++std::optional<base::Value::Dict> ImageContent(const std::string& url) {
++  if (!base::StartsWith(url, kDataUrlPrefix)) {
++    return std::nullopt;
++  }
++  const size_t marker = url.find(kBase64Marker);
++  if (marker == std::string::npos) {
++    return std::nullopt;
++  }
++  const size_t mime_start = std::size(kDataUrlPrefix) - 1;
++  return base::Value::Dict()
++      .Set("type", "image")
++      .Set("mimeType", url.substr(mime_start, marker - mime_start))
++      .Set("data", url.substr(marker + std::size(kBase64Marker) - 1));
++}
++
++base::Value::Dict ToolResult(const McpFastPathCall& call,
++                             DirectCallResult result) {
++  base::Value::List content;
++  if (!result.has_value()) {
++    content.Append(TextContent(std::move(result).error()));
++    return base::Value::Dict()
++        .Set("content", std::move(content))
++        .Set("isError", true);
++  }
++
++  base::Value::List& results = result.value();
++  base::Value value =
++      results.empty() ? base::Value() : std::move(results.front());
++  if (call.image_result && value.is_string()) {
++    if (std::optional<base::Value::Dict> image =
++            ImageContent(value.GetString())) {
++      content.Append(std::move(*image));
++      return base::Value::Dict()
++          .Set("content", std::move(content))
++          .Set("isError", false);
++    }
++  }
++
++  base::Value::Dict tool_result;
++  content.Append(TextContent(base::WriteJson(value).value_or("null")));
++  tool_result.Set("content", std::move(content));
++  if (value.is_dict()) {
++    tool_result.Set("structuredContent", std::move(value));
++  }
++  tool_result.Set("isError", false);
++  return tool_result;
++}
++
++}  // namespace
++
++McpFastPathCall::McpFastPathCall() = default;
++McpFastPathCall::McpFastPathCall(McpFastPathCall&&) = default;
++McpFastPathCall& McpFastPathCall::operator=(McpFastPathCall&&) = default;
++McpFastPathCall::~McpFastPathCall() = default;
++
++std::optional<McpFastPathCall> ParseMcpFastPathCall(std::string_view body) {
++  std::optional<base::Value::Dict> request = base::JSONReader::ReadDict(body);
++  if (!request) {
++    return std::nullopt;
++  }
++
++  const std::string* version = request->FindString("jsonrpc");
++  const std::string* method = request->FindString("method");
++  const base::Value* id = request->Find("id");
++  if (!version || *version != "2.0" || !method || *method != "tools/call" ||
++      !id || !(id->is_int() || id->is_string())) {
++    return std::nullopt;
++  }
++
++  const base::Value::Dict* params = request->FindDict("params");
++  const std::string* name = params ? params->FindString("name") : nullptr;
++  const HotTool* tool = name ? FindHotTool(*name) : nullptr;
++  if (!tool) {
++    return std::nullopt;
++  }
++
++  base::Value::Dict no_arguments;
++  const base::Value* arguments = params->Find("arguments");
++  if (arguments && !arguments->is_dict()) {
++    return std::nullopt;
++  }
++  std::optional<base::Value::List> args = MapArguments(
++      *tool, arguments ? arguments->GetDict() : no_arguments);
++  if (!args) {
++    return std::nullopt;
++  }
++
++  McpFastPathCall call;
++  call.id = id->Clone();
++  call.tool = tool->tool;
++  call.function = tool->function;
++  call.args = std::move(*args);
++  call.image_result = tool->image_result;
++  return call;
++}
++
++std::string FormatMcpFastPathResponse(const McpFastPathCall& call,
++                                      DirectCallResult result) {
++  base::Value::Dict response;
++  response.Set("jsonrpc", "2.0");
++  response.Set("id", call.id.Clone());
++  response.Set("result", ToolResult(call, std::move(result)));
++  return base::WriteJson(response).value_or("{}");
++}
++
++}  // namespace browseros
@@ -0,0 +1,64 @@
+diff --git a/chrome/browser/browseros/server/browseros_mcp_fast_path.h b/chrome/browser/browseros/server/browseros_mcp_fast_path.h
+new file mode 100644
+index 0000000000000..296a0d0738dab
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_mcp_fast_path.h
+@@ -0,0 +1,58 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_MCP_FAST_PATH_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_MCP_FAST_PATH_H_
++
++#include <optional>
++#include <string>
++#include <string_view>
++
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_direct_call.h"
++
++namespace browseros {
++
++// An MCP tools/call request that the proxy answers itself by running a
++// browserOS function through the direct call handler. This skips the hops
++// to the sidecar and from the sidecar to the agent extension.
++struct McpFastPathCall {
++  McpFastPathCall();
++  McpFastPathCall(McpFastPathCall&&);
++  McpFastPathCall& operator=(McpFastPathCall&&);
++  ~McpFastPathCall();
++
++  // JSON-RPC id of the request, echoed in the response
++  base::Value id;
++  // MCP tool name
++  std::string tool;
++  // browserOS function the tool maps onto, and its positional arguments
++  std::string function;
++  base::Value::List args;
++  // The function replies with a data: URL that becomes image content
++  bool image_result = false;
++};
++
++// Returns the call if |body| is a single JSON-RPC tools/call of one of the
++// hot tools, with only arguments that map onto the function's parameters:
++//
++//   browser_snapshot   {tabId?}                -> getInteractiveSnapshot
++//   browser_click      {tabId?, nodeId}        -> click
++//   browser_type       {tabId?, nodeId, text}  -> inputText
++//   browser_screenshot {tabId?}                -> captureScreenshot
++//
++// Anything else returns std::nullopt and goes to the sidecar as before:
++// other methods and tools, notifications, batches, and arguments that are
++// unknown, missing or of the wrong type, which the sidecar reports in its
++// own words.
++std::optional<McpFastPathCall> ParseMcpFastPathCall(std::string_view body);
++
++// JSON-RPC response to |call|. A failed function is a tool result with
++// isError set, as for tools run by the sidecar.
++std::string FormatMcpFastPathResponse(const McpFastPathCall& call,
++                                      DirectCallResult result);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_MCP_FAST_PATH_H_
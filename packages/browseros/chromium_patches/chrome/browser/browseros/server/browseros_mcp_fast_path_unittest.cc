@@ -0,0 +1,139 @@
+diff --git a/chrome/browser/browseros/server/browseros_mcp_fast_path_unittest.cc b/chrome/browser/browseros/server/browseros_mcp_fast_path_unittest.cc
+new file mode 100644
+index 0000000000000..00846c9e8b479
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_mcp_fast_path_unittest.cc
+@@ -0,0 +1,133 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_mcp_fast_path.h"
++
++#include <optional>
++#include <string>
++
++#include "base/test/values_test_util.h"
++#include "base/types/expected.h"
++#include "testing/gtest/include/gtest/gtest.h"
++
++namespace browseros {
++namespace {
++
++std::string ToolCall(const std::string& name, const std::string& arguments) {
++  return R"({"jsonrpc": "2.0", "id": 7, "method": "tools/call",
++             "params": {"name": ")" +
++         name + R"(", "arguments": )" + arguments + "}}";
++}
++
++// =============================================================================
++// Request Parsing
++// =============================================================================
++
++TEST(BrowserOSMcpFastPathTest, MapsClickArgumentsInOrder) {
++  std::optional<McpFastPathCall> call = ParseMcpFastPathCall(
++      ToolCall("browser_click", R"({"nodeId": 12, "tabId": 3})"));
++
++  ASSERT_TRUE(call.has_value());
++  EXPECT_EQ(base::Value(7), call->id);
++  EXPECT_EQ("browser_click", call->tool);
++  EXPECT_EQ("click", call->function);
++  EXPECT_EQ(base::test::ParseJson("[3, 12]"), base::Value(call->args.Clone()));
++  EXPECT_FALSE(call->image_result);
++}
++
++TEST(BrowserOSMcpFastPathTest, PassesNullForOmittedTab) {
++  std::optional<McpFastPathCall> call = ParseMcpFastPathCall(
++      ToolCall("browser_type", R"({"nodeId": 4, "text": "hello"})"));
++
++  ASSERT_TRUE(call.has_value());
++  EXPECT_EQ("inputText", call->function);
++  EXPECT_EQ(base::test::ParseJson(R"([null, 4, "hello"])"),
++            base::Value(call->args.Clone()));
++}
++
++TEST(BrowserOSMcpFastPathTest, DropsTrailingOmittedArguments) {
++  std::optional<McpFastPathCall> call =
++      ParseMcpFastPathCall(ToolCall("browser_snapshot", "{}"));
++
++  ASSERT_TRUE(call.has_value());
++  EXPECT_EQ("getInteractiveSnapshot", call->function);
++  EXPECT_TRUE(call->args.empty());
++}
++
++TEST(BrowserOSMcpFastPathTest, LeavesOtherRequestsToTheSidecar) {
++  // Not a hot tool
++  EXPECT_FALSE(ParseMcpFastPathCall(ToolCall("browser_navigate", "{}")));
++  // Arguments the function has no parameter for
++  EXPECT_FALSE(ParseMcpFastPathCall(
++      ToolCall("browser_click", R"({"nodeId": 1, "button": "right"})")));
++  // Missing required argument
++  EXPECT_FALSE(ParseMcpFastPathCall(ToolCall("browser_click", "{}")));
++  // Wrong type
++  EXPECT_FALSE(
++      ParseMcpFastPathCall(ToolCall("browser_click", R"({"nodeId": "1"})")));
++  // Other methods, notifications and batches
++  EXPECT_FALSE(ParseMcpFastPathCall(
++      R"({"jsonrpc": "2.0", "id": 1, "method": "tools/list"})"));
++  EXPECT_FALSE(ParseMcpFastPathCall(
++      R"({"jsonrpc": "2.0", "method": "tools/call",
++          "params": {"name": "browser_snapshot"}})"));
++  EXPECT_FALSE(ParseMcpFastPathCall("[" + ToolCall("browser_snapshot", "{}") +
++                                    "]"));
++  EXPECT_FALSE(ParseMcpFastPathCall("not json"));
++}
++
++// =============================================================================
++// Response Formatting
++// =============================================================================
++
++TEST(BrowserOSMcpFastPathTest, FormatsResultAsTextAndStructuredContent) {
++  McpFastPathCall call = *ParseMcpFastPathCall(
++      ToolCall("browser_click", R"({"nodeId": 1})"));
++  base::Value::List results;
++  results.Append(base::Value::Dict().Set("success", true));
++
++  EXPECT_EQ(base::test::ParseJson(R"({
++              "jsonrpc": "2.0", "id": 7,
++              "result": {
++                "content": [{"type": "text", "text": "{\"success\":true}"}],
++                "structuredContent": {"success": true},
++                "isError": false
++              }})"),
++            base::test::ParseJson(
++                FormatMcpFastPathResponse(call, std::move(results))));
++}
++
++TEST(BrowserOSMcpFastPathTest, FormatsScreenshotAsImage) {
++  McpFastPathCall call =
++      *ParseMcpFastPathCall(ToolCall("browser_screenshot", "{}"));
++  base::Value::List results;
++  results.Append("data:image/jpeg;base64,AAAA");
++
++  EXPECT_EQ(base::test::ParseJson(R"({
++              "jsonrpc": "2.0", "id": 7,
++              "result": {
++                "content": [{"type": "image", "mimeType": "image/jpeg",
++                             "data": "AAAA"}],
++                "isError": false
++              }})"),
++            base::test::ParseJson(
++                FormatMcpFastPathResponse(call, std::move(results))));
++}
++
++TEST(BrowserOSMcpFastPathTest, FormatsFailureAsToolError) {
++  McpFastPathCall call = *ParseMcpFastPathCall(
++      ToolCall("browser_click", R"({"nodeId": 1})"));
++
++  EXPECT_EQ(base::test::ParseJson(R"({
++              "jsonrpc": "2.0", "id": 7,
++              "result": {
++                "content": [{"type": "text", "text": "Node not found"}],
++                "isError": true
++              }})"),
++            base::test::ParseJson(FormatMcpFastPathResponse(
++                call, base::unexpected("Node not found"))));
++}
++
++}  // namespace
++}  // namespace browseros
@@ -0,0 +1,226 @@
+diff --git a/chrome/browser/browseros/server/browseros_proxy_stats.cc b/chrome/browser/browseros/server/browseros_proxy_stats.cc
+new file mode 100644
+index 0000000000000..3837d931c5657
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_proxy_stats.cc
+@@ -0,0 +1,220 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_proxy_stats.h"
++
++#include <algorithm>
++#include <cstdint>
++#include <utility>
++
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++
++namespace browseros {
++
++namespace {
++
++// Upper bounds of the latency buckets in milliseconds; the last one is open
++constexpr int64_t kBucketBoundsMs[] = {
++    1,    2,    5,     10,    20,    50,    100,      200,
++    500,  1000, 2000,  5000,  10000, 30000, 60000, INT64_MAX,
++};
++
++static_assert(std::size(kBucketBoundsMs) == 16,
++              "Must match LatencyHistogram::buckets_");
++
++// Distinct routes tracked before the rest are folded into "other"
++constexpr size_t kMaxRoutes = 32;
++
++constexpr size_t kMaxRecentRequests = 100;
++
++// Share of requests also reported through BrowserOSMetrics
++constexpr double kRequestMetricSampleRate = 0.01;
++
++double ToMilliseconds(base::TimeDelta delta) {
++  return delta.InMillisecondsF();
++}
++
++}  // namespace
++
++// LatencyHistogram implementation
++
++BrowserOSProxyStats::LatencyHistogram::LatencyHistogram() = default;
++BrowserOSProxyStats::LatencyHistogram::LatencyHistogram(
++    const LatencyHistogram&) = default;
++BrowserOSProxyStats::LatencyHistogram&
++BrowserOSProxyStats::LatencyHistogram::operator=(const LatencyHistogram&) =
++    default;
++BrowserOSProxyStats::LatencyHistogram::~LatencyHistogram() = default;
++
++void BrowserOSProxyStats::LatencyHistogram::Add(base::TimeDelta sample) {
++  const int64_t ms = sample.InMilliseconds();
++  size_t bucket = 0;
++  while (ms >= kBucketBoundsMs[bucket] && bucket + 1 < buckets_.size()) {
++    bucket++;
++  }
++  buckets_[bucket]++;
++  count_++;
++  sum_ += sample;
++  max_ = std::max(max_, sample);
++}
++
++int64_t BrowserOSProxyStats::LatencyHistogram::Percentile(
++    double fraction) const {
++  const uint64_t target = static_cast<uint64_t>(count_ * fraction);
++  uint64_t seen = 0;
++  for (size_t i = 0; i < buckets_.size(); ++i) {
++    seen += buckets_[i];
++    if (seen > target) {
++      return kBucketBoundsMs[i];
++    }
++  }
++  return kBucketBoundsMs[buckets_.size() - 1];
++}
++
++base::Value::Dict BrowserOSProxyStats::LatencyHistogram::ToValue() const {
++  base::Value::Dict dict;
++  dict.Set("count", static_cast<double>(count_));
++  if (count_ == 0) {
++    return dict;
++  }
++
++  dict.Set("mean_ms", ToMilliseconds(sum_) / count_);
++  dict.Set("max_ms", ToMilliseconds(max_));
++  // Upper bucket bounds, so these overestimate by at most one bucket
++  dict.Set("p50_ms", static_cast<double>(std::min<int64_t>(
++                         Percentile(0.5), max_.InMilliseconds() + 1)));
++  dict.Set("p95_ms", static_cast<double>(std::min<int64_t>(
++                         Percentile(0.95), max_.InMilliseconds() + 1)));
++
++  base::Value::List buckets;
++  for (size_t i = 0; i < buckets_.size(); ++i) {
++    if (buckets_[i] == 0) {
++      continue;
++    }
++    base::Value::Dict bucket;
++    if (kBucketBoundsMs[i] != INT64_MAX) {
++      bucket.Set("lt_ms", static_cast<double>(kBucketBoundsMs[i]));
++    }
++    bucket.Set("count", static_cast<double>(buckets_[i]));
++    buckets.Append(std::move(bucket));
++  }
++  dict.Set("buckets", std::move(buckets));
++  return dict;
++}
++
++// RouteStats implementation
++
++BrowserOSProxyStats::RouteStats::RouteStats() = default;
++BrowserOSProxyStats::RouteStats::RouteStats(const RouteStats&) = default;
++BrowserOSProxyStats::RouteStats& BrowserOSProxyStats::RouteStats::operator=(
++    const RouteStats&) = default;
++BrowserOSProxyStats::RouteStats::~RouteStats() = default;
++
++// BrowserOSProxyStats implementation
++
++BrowserOSProxyStats::BrowserOSProxyStats() : started_at_(base::Time::Now()) {}
++BrowserOSProxyStats::~BrowserOSProxyStats() = default;
++
++std::string BrowserOSProxyStats::GetRoute(const std::string& method,
++                                          const std::string& path) const {
++  std::string route = method + " " + path.substr(0, path.find('?'));
++  if (routes_.size() >= kMaxRoutes && !routes_.contains(route)) {
++    return "other";
++  }
++  return route;
++}
++
++void BrowserOSProxyStats::RecordStarted(const std::string& route) {
++  routes_[route].in_flight++;
++}
++
++void BrowserOSProxyStats::RecordFinished(const ProxyRequestRecord& record) {
++  RouteStats& stats = routes_[record.route];
++  if (stats.in_flight > 0) {
++    stats.in_flight--;
++  }
++  stats.requests++;
++  const bool failed = record.backend_error || record.status == 0 ||
++                      record.status >= 500;
++  if (failed) {
++    stats.errors++;
++  }
++  stats.request_bytes += record.request_bytes;
++  stats.response_bytes += record.response_bytes;
++
++  const base::TimeTicks dispatched_at = record.dispatched_at.is_null()
++                                            ? record.completed_at
++                                            : record.dispatched_at;
++  const base::TimeDelta queue_time = dispatched_at - record.received_at;
++  const base::TimeDelta backend_time = record.completed_at - dispatched_at;
++  const base::TimeDelta total_time = record.completed_at - record.received_at;
++  stats.queue_time.Add(queue_time);
++  stats.backend_time.Add(backend_time);
++  stats.total_time.Add(total_time);
++
++  recent_.push_back(record);
++  if (recent_.size() > kMaxRecentRequests) {
++    recent_.pop_front();
++  }
++
++  browseros_metrics::BrowserOSMetrics::Log(
++      "server.proxy.request",
++      {{"route", base::Value(record.route)},
++       {"status", base::Value(record.status)},
++       {"queue_ms", base::Value(ToMilliseconds(queue_time))},
++       {"backend_ms", base::Value(ToMilliseconds(backend_time))},
++       {"total_ms", base::Value(ToMilliseconds(total_time))}},
++      kRequestMetricSampleRate);
++}
++
++size_t BrowserOSProxyStats::DropRecentRequests() {
++  size_t bytes = 0;
++  for (const ProxyRequestRecord& record : recent_) {
++    bytes += sizeof(ProxyRequestRecord) + record.route.capacity();
++  }
++  recent_.clear();
++  recent_.shrink_to_fit();
++  return bytes;
++}
++
++base::Value::Dict BrowserOSProxyStats::ToValue() const {
++  base::Value::Dict routes;
++  for (const auto& [route, stats] : routes_) {
++    base::Value::Dict dict;
++    dict.Set("requests", static_cast<double>(stats.requests));
++    dict.Set("errors", static_cast<double>(stats.errors));
++    dict.Set("in_flight", static_cast<double>(stats.in_flight));
++    dict.Set("request_bytes", static_cast<double>(stats.request_bytes));
++    dict.Set("response_bytes", static_cast<double>(stats.response_bytes));
++    dict.Set("queue_time", stats.queue_time.ToValue());
++    dict.Set("backend_time", stats.backend_time.ToValue());
++    dict.Set("total_time", stats.total_time.ToValue());
++    routes.Set(route, std::move(dict));
++  }
++
++  const base::TimeTicks now = base::TimeTicks::Now();
++  base::Value::List recent;
++  for (const ProxyRequestRecord& record : recent_) {
++    base::Value::Dict dict;
++    dict.Set("route", record.route);
++    dict.Set("status", record.status);
++    dict.Set("age_ms", ToMilliseconds(now - record.completed_at));
++    dict.Set("total_ms",
++             ToMilliseconds(record.completed_at - record.received_at));
++    dict.Set("request_bytes", static_cast<double>(record.request_bytes));
++    dict.Set("response_bytes", static_cast<double>(record.response_bytes));
++    if (record.backend_error) {
++      dict.Set("backend_error", true);
++    }
++    recent.Append(std::move(dict));
++  }
++
++  base::Value::Dict root;
++  root.Set("uptime_s", (base::Time::Now() - started_at_).InSecondsF());
++  root.Set("routes", std::move(routes));
++  root.Set("recent", std::move(recent));
++  return root;
++}
++
++}  // namespace browseros
@@ -0,0 +1,113 @@
+diff --git a/chrome/browser/browseros/server/browseros_proxy_stats.h b/chrome/browser/browseros/server/browseros_proxy_stats.h
+new file mode 100644
+index 0000000000000..409441e9939c6
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_proxy_stats.h
+@@ -0,0 +1,107 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_PROXY_STATS_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_PROXY_STATS_H_
++
++#include <array>
++#include <cstdint>
++#include <string>
++
++#include "base/containers/circular_deque.h"
++#include "base/containers/flat_map.h"
++#include "base/time/time.h"
++#include "base/values.h"
++
++namespace browseros {
++
++// Timing and size of one request through the MCP proxy. Queue time runs
++// from arrival until the request is sent to the backend (including time
++// held while the sidecar restarts), backend time from there until the
++// response is finished.
++struct ProxyRequestRecord {
++  std::string route;  // "METHOD /path", without the query
++  int status = 0;     // 0 if the request was abandoned
++  base::TimeTicks received_at;
++  base::TimeTicks dispatched_at;
++  base::TimeTicks completed_at;
++  size_t request_bytes = 0;
++  size_t response_bytes = 0;
++  bool backend_error = false;
++};
++
++// In-memory request statistics for BrowserOSServerProxy: per-route counters
++// and latency histograms plus a ring of the most recent requests, served as
++// JSON from /browseros/stats. A small sample of requests is also reported
++// through BrowserOSMetrics.
++//
++// Lives on the IO thread with the proxy.
++class BrowserOSProxyStats {
++ public:
++  BrowserOSProxyStats();
++  ~BrowserOSProxyStats();
++
++  BrowserOSProxyStats(const BrowserOSProxyStats&) = delete;
++  BrowserOSProxyStats& operator=(const BrowserOSProxyStats&) = delete;
++
++  // Normalizes |method| and |path| into a route name, folding routes beyond
++  // a fixed number into "other".
++  std::string GetRoute(const std::string& method,
++                       const std::string& path) const;
++
++  void RecordStarted(const std::string& route);
++  void RecordFinished(const ProxyRequestRecord& record);
++
++  base::Value::Dict ToValue() const;
++
++  // Forgets the recent requests, keeping the per-route totals. Returns
++  // about how many bytes they held.
++  size_t DropRecentRequests();
++
++ private:
++  // Latency histogram over fixed, roughly exponential millisecond buckets
++  class LatencyHistogram {
++   public:
++    LatencyHistogram();
++    LatencyHistogram(const LatencyHistogram&);
++    LatencyHistogram& operator=(const LatencyHistogram&);
++    ~LatencyHistogram();
++
++    void Add(base::TimeDelta sample);
++    base::Value::Dict ToValue() const;
++
++   private:
++    // Upper bound of the bucket holding the |fraction| quantile
++    int64_t Percentile(double fraction) const;
++
++    std::array<uint64_t, 16> buckets_ = {};
++    uint64_t count_ = 0;
++    base::TimeDelta sum_;
++    base::TimeDelta max_;
++  };
++
++  struct RouteStats {
++    RouteStats();
++    RouteStats(const RouteStats&);
++    RouteStats& operator=(const RouteStats&);
++    ~RouteStats();
++
++    uint64_t requests = 0;
++    uint64_t errors = 0;
++    uint64_t in_flight = 0;
++    uint64_t request_bytes = 0;
++    uint64_t response_bytes = 0;
++    LatencyHistogram queue_time;
++    LatencyHistogram backend_time;
++    LatencyHistogram total_time;
++  };
++
++  const base::Time started_at_;
++  base::flat_map<std::string, RouteStats> routes_;
++  base::circular_deque<ProxyRequestRecord> recent_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_PROXY_STATS_H_
@@ -1,15 +1,16 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_config.cc b/chrome/browser/browseros/server/browseros_server_config.cc
 new file mode 100644
-index 0000000000000..3e0c69cdf6442
+index 0000000000000..3b38d8768778b
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_config.cc
-@@ -0,0 +1,81 @@
+@@ -0,0 +1,113 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_config.h"
 +
++#include "base/strings/string_number_conversions.h"
 +#include "base/strings/stringprintf.h"
 +
 +namespace browseros {
@@ -47,11 +48,15 @@ index 0000000000000..3e0c69cdf6442
 +      "  fallback=%s\n"
 +      "  resources=%s\n"
 +      "  execution=%s\n"
++      "  backend_socket=%s\n"
++      "  shared_payloads=%s\n"
 +      "}",
 +      exe.AsUTF8Unsafe().c_str(),
 +      fallback_exe.AsUTF8Unsafe().c_str(),
 +      resources.AsUTF8Unsafe().c_str(),
-+      execution.AsUTF8Unsafe().c_str());
++      execution.AsUTF8Unsafe().c_str(),
++      backend_socket.AsUTF8Unsafe().c_str(),
++      shared_payloads.AsUTF8Unsafe().c_str());
 +}
 +
 +std::string ServerIdentity::DebugString() const {
@@ -66,6 +71,30 @@ index 0000000000000..3e0c69cdf6442
 +      chromium_version.c_str());
 +}
 +
++ServerResourceLimits::ServerResourceLimits() = default;
++ServerResourceLimits::ServerResourceLimits(const ServerResourceLimits&) =
++    default;
++ServerResourceLimits& ServerResourceLimits::operator=(
++    const ServerResourceLimits&) = default;
++ServerResourceLimits::~ServerResourceLimits() = default;
++
++bool ServerResourceLimits::IsEmpty() const {
++  return nice == 0 && memory_limit_mb == 0 && cpu_affinity.empty();
++}
++
++std::string ServerResourceLimits::DebugString() const {
++  std::string cores;
++  for (int core : cpu_affinity) {
++    if (!cores.empty()) {
++      cores += ",";
++    }
++    cores += base::NumberToString(core);
++  }
++  return base::StringPrintf(
++      "ServerResourceLimits{nice=%d, memory_mb=%d, cpus=%s}", nice,
++      memory_limit_mb, cores.empty() ? "all" : cores.c_str());
++}
++
 +bool ServerLaunchConfig::IsValid() const {
 +  return ports.IsValid() && paths.IsValid();
 +}
@@ -76,12 +105,15 @@ index 0000000000000..3e0c69cdf6442
 +      "  %s\n"
 +      "  %s\n"
 +      "  %s\n"
++      "  %s\n"
 +      "  allow_remote=%s\n"
++      "  worker=%d\n"
 +      "}",
 +      ports.DebugString().c_str(),
 +      paths.DebugString().c_str(),
 +      identity.DebugString().c_str(),
-+      allow_remote_in_mcp ? "true" : "false");
++      limits.DebugString().c_str(),
++      allow_remote_in_mcp ? "true" : "false", worker_index);
 +}
 +
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_config.h b/chrome/browser/browseros/server/browseros_server_config.h
 new file mode 100644
-index 0000000000000..3b121ed6f6635
+index 0000000000000..0175d4625d712
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_config.h
-@@ -0,0 +1,90 @@
+@@ -0,0 +1,135 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,6 +12,7 @@ index 0000000000000..3b121ed6f6635
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_CONFIG_H_
 +
 +#include <string>
++#include <vector>
 +
 +#include "base/files/file_path.h"
 +
@@ -59,6 +60,13 @@ index 0000000000000..3b121ed6f6635
 +  // Runtime data directory (~/.browseros or equivalent).
 +  base::FilePath execution;
 +
++  // Unix domain socket the backend serves on besides its TCP port.
++  // Empty when the backend is TCP only.
++  base::FilePath backend_socket;
++
++  // Directory the proxy writes shared direct call payloads to.
++  base::FilePath shared_payloads;
++
 +  // Returns true if required paths are set.
 +  bool IsValid() const;
 +
@@ -76,14 +84,51 @@ index 0000000000000..3b121ed6f6635
 +  std::string DebugString() const;
 +};
 +
++// OS scheduling and memory limits applied to a launched server so a busy
++// sidecar can't starve the browser.
++struct ServerResourceLimits {
++  ServerResourceLimits();
++  ServerResourceLimits(const ServerResourceLimits&);
++  ServerResourceLimits& operator=(const ServerResourceLimits&);
++  ~ServerResourceLimits();
++
++  // Niceness of the server, 0-19. On Windows, 1-9 run it below normal
++  // priority and 10 or more at idle priority.
++  int nice = 0;
++
++  // Memory cap in MB, 0 for none. Enforced by a job object on Windows; on
++  // other platforms the manager restarts the server when its resident set
++  // exceeds it.
++  int memory_limit_mb = 0;
++
++  // CPU cores the server may run on, empty for all. Ignored on macOS, which
++  // has no process affinity.
++  std::vector<int> cpu_affinity;
++
++  // Returns true if no limit is set.
++  bool IsEmpty() const;
++
++  // Returns a debug string for logging.
++  std::string DebugString() const;
++};
++
 +// Complete configuration for a single server launch.
 +// Assembled fresh before each ProcessController::Launch() call.
 +struct ServerLaunchConfig {
 +  ServerPorts ports;
 +  ServerPaths paths;
 +  ServerIdentity identity;
++  ServerResourceLimits limits;
 +  bool allow_remote_in_mcp = false;
 +
++  // 0 for the primary server, 1..N-1 for extra workers the proxy balances
++  // across. Each worker gets its own config file.
++  int worker_index = 0;
++
++  // Secret the sidecar presents at the proxy's /browseros/call/ route.
++  // Random per browser session and left out of DebugString().
++  std::string direct_call_token;
++
 +  // Returns true if the config is valid for launching.
 +  bool IsValid() const;
 +
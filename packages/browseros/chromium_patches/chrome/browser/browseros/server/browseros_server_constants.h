@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_constants.h b/chrome/browser/browseros/server/browseros_server_constants.h
 new file mode 100644
-index 0000000000000..d2c8229f8c805
+index 0000000000000..fe28007433625
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_constants.h
-@@ -0,0 +1,52 @@
+@@ -0,0 +1,82 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,6 +11,8 @@ index 0000000000000..d2c8229f8c805
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_CONSTANTS_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_CONSTANTS_H_
 +
++#include <cstdint>
++
 +#include "base/time/time.h"
 +
 +namespace browseros_server {
@@ -29,12 +31,31 @@ index 0000000000000..d2c8229f8c805
 +inline constexpr char kServerUpdatePublicKey[] =
 +    "LzQmcNuTsdB3/dsivo0eeN+jPfDoriRHAkkEJcfFs2A=";
 +
-+// Maximum number of old versions to keep in the versions directory
++// Maximum number of versions to keep in the versions directory, counting
++// the current one
 +inline constexpr int kMaxVersionsToKeep = 2;
 +
++// Disk quota of the versions directory. Versions older than the current one
++// are deleted past it, even if that leaves no rollback target.
++inline constexpr int64_t kVersionsDiskQuota = 1024 * 1024 * 1024;  // 1 GB
++
 +// Timeout for downloading update packages
 +inline constexpr base::TimeDelta kDownloadTimeout = base::Minutes(10);
 +
++// Update packages are extracted this many bytes at a time, and held back
++// between chunks while the user is browsing or an agent is running
++inline constexpr int64_t kExtractionChunkSize = 8 * 1024 * 1024;  // 8 MB
++
++// How often a held-back extraction re-checks whether it may continue
++inline constexpr base::TimeDelta kExtractionThrottleInterval =
++    base::Seconds(2);
++
++// Input more recent than this counts as the user browsing
++inline constexpr base::TimeDelta kExtractionUserIdleTime = base::Seconds(30);
++
++// Total time an extraction can be held back before it runs regardless
++inline constexpr base::TimeDelta kMaxExtractionPause = base::Minutes(10);
++
 +// Timeout for fetching appcast XML
 +inline constexpr base::TimeDelta kAppcastFetchTimeout = base::Seconds(30);
 +
@@ -52,6 +73,15 @@ index 0000000000000..d2c8229f8c805
 +inline constexpr char kCurrentVersionFileName[] = "current_version";
 +inline constexpr char kPendingUpdateDirectoryName[] = "pending_update";
 +inline constexpr char kDownloadFileName[] = "download.zip";
++// Resume state of an interrupted download of kDownloadFileName
++inline constexpr char kDownloadStateFileName[] = "download.json";
++// Build-time manifest in the bundled resources directory
++inline constexpr char kServerManifestFileName[] = "server_manifest.json";
++// Lists the files of the new version inside a delta package
++inline constexpr char kDeltaManifestFileName[] = "delta.json";
++// Direct call results handed to the sidecar as files, under the execution
++// directory
++inline constexpr char kSharedPayloadDirectoryName[] = "payloads";
 +
 +}  // namespace browseros_server
 +
@@ -0,0 +1,325 @@
+diff --git a/chrome/browser/browseros/server/browseros_server_fleet.cc b/chrome/browser/browseros/server/browseros_server_fleet.cc
+new file mode 100644
+index 0000000000000..6415e6ae58a7d
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_server_fleet.cc
+@@ -0,0 +1,319 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_server_fleet.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/numerics/safe_conversions.h"
++#include "base/system/sys_info.h"
++#include "base/task/thread_pool.h"
++#include "net/base/ip_address.h"
++#include "net/base/url_util.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr base::TimeDelta kFleetReportTimeout = base::Seconds(5);
++
++// Sessions tracked beyond this are dropped wholesale, like the proxy's
++// session routes
++constexpr size_t kMaxFleetSessions = 4096;
++
++net::NetworkTrafficAnnotationTag GetFleetTrafficAnnotation() {
++  return net::DefineNetworkTrafficAnnotation("browseros_fleet_report", R"(
++    semantics {
++      sender: "BrowserOS MCP Proxy"
++      description:
++        "Reports the free MCP sessions, CPU cores and available memory of "
++        "this BrowserOS instance to the fleet coordinator it was started "
++        "with, which sends it MCP sessions when its own are used up."
++      trigger:
++        "Every 10 seconds while the browser runs with "
++        "--browseros-fleet-coordinator."
++      data: "Capacity counts, the proxy port and the fleet token."
++      destination: OTHER
++      destination_other: "The fleet coordinator given on the command line."
++    }
++    policy {
++      cookies_allowed: NO
++      setting:
++        "Only sent when the browser is started with "
++        "--browseros-fleet-coordinator and --browseros-fleet-token."
++      policy_exception_justification:
++        "Opt-in deployment setting for BrowserOS fleets."
++    })");
++}
++
++}  // namespace
++
++FleetConfig::FleetConfig() = default;
++FleetConfig::FleetConfig(const FleetConfig&) = default;
++FleetConfig& FleetConfig::operator=(const FleetConfig&) = default;
++FleetConfig::~FleetConfig() = default;
++
++std::optional<net::IPEndPoint> ParseFleetEndpoint(std::string_view value) {
++  std::string host;
++  int port = -1;
++  net::IPAddress address;
++  if (!net::ParseHostAndPort(value, &host, &port) || port <= 0 ||
++      !net::ParseURLHostnameToAddress(host, &address)) {
++    return std::nullopt;
++  }
++  return net::IPEndPoint(address, static_cast<uint16_t>(port));
++}
++
++base::Value::Dict FleetCapacity::ToValue() const {
++  return base::Value::Dict()
++      .Set("max_sessions", max_sessions)
++      .Set("free_sessions", free_sessions)
++      .Set("cpu_cores", cpu_cores)
++      .Set("available_memory_mb", available_memory_mb);
++}
++
++// static
++std::optional<FleetCapacity> FleetCapacity::FromValue(
++    const base::Value::Dict& value) {
++  std::optional<int> max_sessions = value.FindInt("max_sessions");
++  std::optional<int> free_sessions = value.FindInt("free_sessions");
++  std::optional<int> cpu_cores = value.FindInt("cpu_cores");
++  std::optional<int> available_memory_mb =
++      value.FindInt("available_memory_mb");
++  if (!max_sessions || !free_sessions || !cpu_cores || !available_memory_mb ||
++      *max_sessions < 0 || *free_sessions < 0 || *cpu_cores < 0 ||
++      *available_memory_mb < 0) {
++    return std::nullopt;
++  }
++  FleetCapacity capacity;
++  capacity.max_sessions = *max_sessions;
++  capacity.free_sessions = *free_sessions;
++  capacity.cpu_cores = *cpu_cores;
++  capacity.available_memory_mb = *available_memory_mb;
++  return capacity;
++}
++
++FleetCapacity SampleHostCapacity() {
++  FleetCapacity capacity;
++  capacity.cpu_cores = base::SysInfo::NumberOfProcessors();
++  capacity.available_memory_mb = base::saturated_cast<int>(
++      base::SysInfo::AmountOfAvailablePhysicalMemory() / (1024 * 1024));
++  return capacity;
++}
++
++// BrowserOSFleetSessions implementation
++
++BrowserOSFleetSessions::BrowserOSFleetSessions() = default;
++BrowserOSFleetSessions::~BrowserOSFleetSessions() = default;
++
++void BrowserOSFleetSessions::Touch(const std::string& session_id) {
++  if (last_request_.size() >= kMaxFleetSessions &&
++      !last_request_.contains(session_id)) {
++    CountActive();
++    if (last_request_.size() >= kMaxFleetSessions) {
++      last_request_.clear();
++    }
++  }
++  last_request_[session_id] = base::TimeTicks::Now();
++}
++
++void BrowserOSFleetSessions::Remove(const std::string& session_id) {
++  last_request_.erase(session_id);
++}
++
++int BrowserOSFleetSessions::CountActive() {
++  const base::TimeTicks cutoff =
++      base::TimeTicks::Now() - kFleetSessionIdleTimeout;
++  base::EraseIf(last_request_, [cutoff](const auto& session) {
++    return session.second < cutoff;
++  });
++  return static_cast<int>(last_request_.size());
++}
++
++// BrowserOSFleetRegistry implementation
++
++BrowserOSFleetRegistry::BrowserOSFleetRegistry() = default;
++BrowserOSFleetRegistry::~BrowserOSFleetRegistry() = default;
++
++void BrowserOSFleetRegistry::Register(const net::IPEndPoint& endpoint,
++                                      const FleetCapacity& capacity) {
++  for (Node& node : nodes_) {
++    if (node.endpoint == endpoint) {
++      node.capacity = capacity;
++      node.last_report = base::TimeTicks::Now();
++      return;
++    }
++  }
++
++  LOG(INFO) << "browseros: Fleet node " << endpoint.ToString()
++            << " registered with " << capacity.free_sessions << "/"
++            << capacity.max_sessions << " free session(s)";
++  Node node;
++  node.pool = std::make_unique<BrowserOSBackendConnectionPool>();
++  node.pool->SetRemoteBackend(endpoint);
++  node.endpoint = endpoint;
++  node.capacity = capacity;
++  node.last_report = base::TimeTicks::Now();
++  nodes_.push_back(std::move(node));
++}
++
++BrowserOSBackendConnectionPool* BrowserOSFleetRegistry::SelectNode() {
++  Node* best = nullptr;
++  for (Node& node : nodes_) {
++    if (node.capacity.free_sessions <= 0) {
++      continue;
++    }
++    // Ties go to the node with more memory to spare
++    if (!best || node.capacity.free_sessions > best->capacity.free_sessions ||
++        (node.capacity.free_sessions == best->capacity.free_sessions &&
++         node.capacity.available_memory_mb >
++             best->capacity.available_memory_mb)) {
++      best = &node;
++    }
++  }
++  if (!best) {
++    return nullptr;
++  }
++  best->capacity.free_sessions--;
++  return best->pool.get();
++}
++
++bool BrowserOSFleetRegistry::Contains(
++    const BrowserOSBackendConnectionPool* pool) const {
++  for (const Node& node : nodes_) {
++    if (node.pool.get() == pool) {
++      return true;
++    }
++  }
++  return false;
++}
++
++std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>>
++BrowserOSFleetRegistry::TakeExpiredNodes() {
++  const base::TimeTicks cutoff = base::TimeTicks::Now() - kFleetNodeTimeout;
++  std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>> expired;
++  std::vector<Node> kept;
++  for (Node& node : nodes_) {
++    if (node.last_report < cutoff) {
++      LOG(WARNING) << "browseros: Fleet node " << node.endpoint.ToString()
++                   << " stopped reporting, dropping it";
++      expired.push_back(std::move(node.pool));
++    } else {
++      kept.push_back(std::move(node));
++    }
++  }
++  nodes_ = std::move(kept);
++  return expired;
++}
++
++std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>>
++BrowserOSFleetRegistry::TakeAll() {
++  std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>> pools;
++  for (Node& node : nodes_) {
++    pools.push_back(std::move(node.pool));
++  }
++  nodes_.clear();
++  return pools;
++}
++
++size_t BrowserOSFleetRegistry::CloseIdleConnections() {
++  size_t closed = 0;
++  for (Node& node : nodes_) {
++    closed += node.pool->CloseIdleConnections();
++  }
++  return closed;
++}
++
++base::Value::List BrowserOSFleetRegistry::ToValue() const {
++  const base::TimeTicks now = base::TimeTicks::Now();
++  base::Value::List nodes;
++  for (const Node& node : nodes_) {
++    nodes.Append(
++        base::Value::Dict()
++            .Set("node", node.endpoint.ToString())
++            .Set("capacity", node.capacity.ToValue())
++            .Set("last_report_ms",
++                 static_cast<int>((now - node.last_report).InMilliseconds())));
++  }
++  return nodes;
++}
++
++// BrowserOSFleetReporter implementation
++
++BrowserOSFleetReporter::BrowserOSFleetReporter(
++    const FleetConfig& config,
++    int port,
++    ActiveSessionsCallback active_sessions)
++    : token_(config.token),
++      port_(port),
++      max_sessions_(config.max_sessions),
++      active_sessions_(std::move(active_sessions)) {
++  coordinator_.SetRemoteBackend(*config.coordinator);
++  LOG(INFO) << "browseros: Reporting fleet capacity to "
++            << config.coordinator->ToString();
++  timer_.Start(FROM_HERE, kFleetReportInterval, this,
++               &BrowserOSFleetReporter::SampleCapacity);
++  SampleCapacity();
++}
++
++BrowserOSFleetReporter::~BrowserOSFleetReporter() = default;
++
++void BrowserOSFleetReporter::SampleCapacity() {
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::BEST_EFFORT},
++      base::BindOnce(&SampleHostCapacity),
++      base::BindOnce(&BrowserOSFleetReporter::SendReport,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSFleetReporter::SendReport(FleetCapacity capacity) {
++  if (request_) {
++    return;  // The last report is still going; this one would be as stale
++  }
++  capacity.max_sessions = max_sessions_;
++  capacity.free_sessions = std::max(0, max_sessions_ - active_sessions_.Run());
++
++  std::string body =
++      base::WriteJson(base::Value::Dict()
++                          .Set("port", port_)
++                          .Set("capacity", capacity.ToValue()))
++          .value_or("{}");
++  response_code_ = 0;
++  request_ = std::make_unique<BrowserOSBackendRequest>(
++      &coordinator_, this, GetFleetTrafficAnnotation());
++  request_->Start("POST", kFleetRegisterPath,
++                  {{"Content-Type", "application/json"},
++                   {kFleetTokenHeader, token_}},
++                  body, kFleetReportTimeout);
++}
++
++void BrowserOSFleetReporter::OnResponseStarted(
++    scoped_refptr<net::HttpResponseHeaders> headers) {
++  response_code_ = headers->response_code();
++}
++
++void BrowserOSFleetReporter::OnResponseData(std::string_view data) {}
++
++void BrowserOSFleetReporter::OnResponseComplete(bool success) {
++  const bool accepted = success && response_code_ == net::HTTP_OK;
++  if (accepted != last_report_accepted_) {
++    if (accepted) {
++      LOG(INFO) << "browseros: Fleet coordinator accepting reports again";
++    } else {
++      LOG(WARNING) << "browseros: Fleet coordinator rejected the report ("
++                   << (response_code_ ? response_code_ : -1) << ")";
++    }
++    last_report_accepted_ = accepted;
++  }
++  request_.reset();
++}
++
++}  // namespace browseros
@@ -0,0 +1,206 @@
+diff --git a/chrome/browser/browseros/server/browseros_server_fleet.h b/chrome/browser/browseros/server/browseros_server_fleet.h
+new file mode 100644
+index 0000000000000..fd379caaacc11
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_server_fleet.h
+@@ -0,0 +1,200 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_FLEET_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_FLEET_H_
++
++#include <memory>
++#include <optional>
++#include <string>
++#include <string_view>
++#include <vector>
++
++#include "base/containers/flat_map.h"
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/server/browseros_backend_connection.h"
++#include "net/base/ip_endpoint.h"
++
++namespace browseros {
++
++// Fleet mode spreads MCP sessions across BrowserOS instances on several
++// hosts behind one proxy endpoint. Every instance given a coordinator
++// reports its spare capacity there every kFleetReportInterval. The
++// coordinator, an instance like the others, serves its own sessions until
++// FleetConfig::max_sessions of them are active, then sends new sessions to
++// the node with the most free ones. Requests of a session stick to the
++// node that issued it, as they do with sidecar workers, so overflow moves
++// whole sessions rather than single tool calls, and the MCP fast path only
++// serves local sessions.
++//
++// Nodes are reached at the address they reported from, on the proxy port
++// they reported, so they need remote MCP access allowed; so does the
++// coordinator, for their reports. Reports are only accepted with the fleet
++// token, so only instances sharing it can join.
++inline constexpr base::TimeDelta kFleetReportInterval = base::Seconds(10);
++// A node that hasn't reported for this long is dropped
++inline constexpr base::TimeDelta kFleetNodeTimeout = base::Seconds(30);
++// A session without requests for this long no longer counts as active
++inline constexpr base::TimeDelta kFleetSessionIdleTimeout = base::Minutes(5);
++inline constexpr int kDefaultFleetMaxSessions = 8;
++
++// Where nodes POST their reports: {"port": <proxy port>, "capacity":
++// FleetCapacity}
++inline constexpr char kFleetRegisterPath[] = "/browseros/fleet/register";
++inline constexpr char kFleetTokenHeader[] = "x-browseros-fleet-token";
++
++struct FleetConfig {
++  FleetConfig();
++  FleetConfig(const FleetConfig&);
++  FleetConfig& operator=(const FleetConfig&);
++  ~FleetConfig();
++
++  // Fleet mode is off without a token
++  std::string token;
++  // Where this instance reports, if it is a node
++  std::optional<net::IPEndPoint> coordinator;
++  // Active MCP sessions this instance serves before it overflows or reports
++  // itself full
++  int max_sessions = kDefaultFleetMaxSessions;
++};
++
++// "address:port" with an IP literal address, e.g. "10.0.0.2:9000" or
++// "[fd00::2]:9000"
++std::optional<net::IPEndPoint> ParseFleetEndpoint(std::string_view value);
++
++// Spare capacity a node reports to its coordinator
++struct FleetCapacity {
++  int max_sessions = 0;
++  int free_sessions = 0;
++  int cpu_cores = 0;
++  int available_memory_mb = 0;
++
++  base::Value::Dict ToValue() const;
++  // Returns nullopt if a field is missing or negative
++  static std::optional<FleetCapacity> FromValue(const base::Value::Dict& value);
++};
++
++// Reads the host's CPU cores and available memory. Blocking.
++FleetCapacity SampleHostCapacity();
++
++// MCP sessions the proxy serves locally and when each last sent a request,
++// to tell the active ones from those the client left without a DELETE.
++// IO thread.
++class BrowserOSFleetSessions {
++ public:
++  BrowserOSFleetSessions();
++  ~BrowserOSFleetSessions();
++
++  BrowserOSFleetSessions(const BrowserOSFleetSessions&) = delete;
++  BrowserOSFleetSessions& operator=(const BrowserOSFleetSessions&) = delete;
++
++  void Touch(const std::string& session_id);
++  void Remove(const std::string& session_id);
++  // Sessions with a request in the last kFleetSessionIdleTimeout. Drops the
++  // others.
++  int CountActive();
++  void Clear() { last_request_.clear(); }
++
++ private:
++  base::flat_map<std::string, base::TimeTicks> last_request_;
++};
++
++// Nodes reporting to this proxy as their coordinator. IO thread.
++class BrowserOSFleetRegistry {
++ public:
++  BrowserOSFleetRegistry();
++  ~BrowserOSFleetRegistry();
++
++  BrowserOSFleetRegistry(const BrowserOSFleetRegistry&) = delete;
++  BrowserOSFleetRegistry& operator=(const BrowserOSFleetRegistry&) = delete;
++
++  // Adds the node at |endpoint| or refreshes its capacity
++  void Register(const net::IPEndPoint& endpoint,
++                const FleetCapacity& capacity);
++
++  // The node with the most free sessions, or null if none has one. The
++  // session about to start there is taken off its free sessions until it
++  // reports again.
++  BrowserOSBackendConnectionPool* SelectNode();
++
++  // Whether |pool| is one of the nodes
++  bool Contains(const BrowserOSBackendConnectionPool* pool) const;
++
++  // Removes the nodes that stopped reporting, for the proxy to close what
++  // is in flight to them
++  std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>>
++  TakeExpiredNodes();
++
++  // Closes the idle connections to every node, returning how many there
++  // were
++  size_t CloseIdleConnections();
++
++  // Removes every node
++  std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>> TakeAll();
++
++  void Clear() { nodes_.clear(); }
++  bool empty() const { return nodes_.empty(); }
++
++  // The nodes with their last reported capacity, for /browseros/stats
++  base::Value::List ToValue() const;
++
++ private:
++  struct Node {
++    std::unique_ptr<BrowserOSBackendConnectionPool> pool;
++    net::IPEndPoint endpoint;
++    FleetCapacity capacity;
++    base::TimeTicks last_report;
++  };
++
++  std::vector<Node> nodes_;
++};
++
++// Reports this instance's capacity to its coordinator every
++// kFleetReportInterval, starting right away. IO thread.
++class BrowserOSFleetReporter : public BrowserOSBackendRequest::Delegate {
++ public:
++  using ActiveSessionsCallback = base::RepeatingCallback<int()>;
++
++  // |port| is the proxy port the coordinator forwards sessions to
++  BrowserOSFleetReporter(const FleetConfig& config,
++                         int port,
++                         ActiveSessionsCallback active_sessions);
++  ~BrowserOSFleetReporter() override;
++
++  BrowserOSFleetReporter(const BrowserOSFleetReporter&) = delete;
++  BrowserOSFleetReporter& operator=(const BrowserOSFleetReporter&) = delete;
++
++ private:
++  void SampleCapacity();
++  void SendReport(FleetCapacity capacity);
++
++  // BrowserOSBackendRequest::Delegate:
++  void OnResponseStarted(
++      scoped_refptr<net::HttpResponseHeaders> headers) override;
++  void OnResponseData(std::string_view data) override;
++  void OnResponseComplete(bool success) override;
++
++  const std::string token_;
++  const int port_;
++  const int max_sessions_;
++  ActiveSessionsCallback active_sessions_;
++
++  BrowserOSBackendConnectionPool coordinator_;
++  // The report in flight; one at a time
++  std::unique_ptr<BrowserOSBackendRequest> request_;
++  int response_code_ = 0;
++  // Only changes between accepted and failed reports are logged
++  bool last_report_accepted_ = true;
++  base::RepeatingTimer timer_;
++
++  base::WeakPtrFactory<BrowserOSFleetReporter> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_FLEET_H_
@@ -1,17 +1,19 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager.cc b/chrome/browser/browseros/server/browseros_server_manager.cc
 new file mode 100644
-index 0000000000000..6d44b32b78ce8
+index 0000000000000..c56c0e2ac04fb
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager.cc
-@@ -0,0 +1,1061 @@
+@@ -0,0 +1,1988 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_manager.h"
 +
++#include <algorithm>
 +#include <optional>
 +#include <set>
++#include <utility>
 +
 +#include "base/command_line.h"
 +#include "base/files/file_path.h"
@@ -20,19 +22,36 @@ index 0000000000000..6d44b32b78ce8
 +#include "base/path_service.h"
 +#include "base/rand_util.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_split.h"
 +#include "base/system/sys_info.h"
++#include "base/task/bind_post_task.h"
++#include "base/task/sequenced_task_runner.h"
 +#include "base/task/thread_pool.h"
 +#include "content/public/browser/browser_thread.h"
 +#include "base/threading/thread_restrictions.h"
++#include "base/unguessable_token.h"
 +#include "build/build_config.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include <sys/un.h>
++#endif
 +#include "chrome/browser/browser_process.h"
++#include "chrome/browser/browseros/core/browseros_agent_activity.h"
++#include "chrome/browser/browseros/core/browseros_direct_call.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "chrome/browser/browseros/core/browseros_startup_timing.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service_factory.h"
 +#include "chrome/browser/browseros/server/browseros_server_config.h"
++#include "chrome/browser/browseros/server/browseros_server_constants.h"
++#include "chrome/browser/browseros/server/browseros_server_fleet.h"
 +#include "chrome/browser/browseros/server/browseros_server_prefs.h"
 +#include "chrome/browser/browseros/server/browseros_server_proxy.h"
 +#include "chrome/browser/browseros/server/browseros_server_updater.h"
++#include "chrome/browser/browseros/server/browseros_server_workers.h"
 +#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +#include "chrome/browser/browseros/server/health_checker.h"
 +#include "chrome/browser/browseros/server/health_checker_impl.h"
@@ -41,8 +60,6 @@ index 0000000000000..6d44b32b78ce8
 +#include "chrome/browser/browseros/server/server_state_store.h"
 +#include "chrome/browser/browseros/server/server_state_store_impl.h"
 +#include "chrome/browser/browseros/server/server_updater.h"
-+#include "chrome/browser/net/system_network_context_manager.h"
-+#include "services/network/public/cpp/shared_url_loader_factory.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/browser/profiles/profile_manager.h"
 +#include "chrome/common/chrome_paths.h"
@@ -65,14 +82,99 @@ index 0000000000000..6d44b32b78ce8
 +
 +constexpr int kBackLog = 10;
 +
++// Health checks back off from kHealthCheckInterval while the server answers
++// quickly and drop to kHealthCheckRetryInterval after a failure
 +constexpr base::TimeDelta kHealthCheckInterval = base::Seconds(30);
++constexpr base::TimeDelta kHealthCheckMaxInterval = base::Minutes(2);
++constexpr base::TimeDelta kHealthCheckRetryInterval = base::Seconds(5);
++// A passing check slower than this keeps the interval from backing off
++constexpr base::TimeDelta kSlowHealthCheckLatency = base::Seconds(2);
++// The timeout follows the smoothed latency and grows after each failure, so a
++// loaded but healthy server is given more time before it counts as down
++constexpr base::TimeDelta kHealthCheckMinTimeout = base::Seconds(5);
++constexpr base::TimeDelta kHealthCheckMaxTimeout = base::Seconds(30);
++constexpr int kHealthCheckTimeoutLatencyMultiplier = 4;
++// Consecutive failed checks before the server is restarted
++constexpr int kMaxConsecutiveHealthFailures = 3;
 +constexpr base::TimeDelta kProcessCheckInterval = base::Seconds(5);
++// Polling interval once exits are watched, only catches a missed signal
++constexpr base::TimeDelta kProcessCheckFallbackInterval = base::Seconds(60);
 +
 +constexpr base::TimeDelta kStartupGracePeriod = base::Seconds(30);
++
++// /health is probed with exponential backoff after launch so the proxy can
++// start forwarding as soon as the server listens
++constexpr base::TimeDelta kReadinessProbeInitialDelay = base::Milliseconds(50);
++constexpr base::TimeDelta kReadinessProbeMaxDelay = base::Seconds(1);
 +constexpr int kMaxStartupFailures = 3;
 +
++// After an update switches the proxy to the new server, the old one finishes
++// requests it already has for up to this long before it is shut down
++constexpr base::TimeDelta kUpdateDrainTimeout = base::Seconds(60);
++constexpr base::TimeDelta kRetiringExitTimeout = base::Seconds(5);
++
 +constexpr int kExitCodeSuccess = 0;
 +
++constexpr int kMaxServerWorkers = 8;
++
++// Sidecar memory and CPU are sampled this often; a share of the samples is
++// reported through BrowserOSMetrics
++constexpr base::TimeDelta kResourceSampleInterval = base::Seconds(30);
++constexpr double kResourceMetricSampleRate = 0.1;
++
++constexpr int kMaxServerNice = 19;
++
++browseros::ServerResourceLimits GetResourceLimitsFromCommandLine(
++    base::CommandLine* command_line) {
++  browseros::ServerResourceLimits limits;
++
++  if (command_line->HasSwitch(browseros::kServerNice)) {
++    std::string value =
++        command_line->GetSwitchValueASCII(browseros::kServerNice);
++    int nice = 0;
++    if (base::StringToInt(value, &nice) && nice >= 0 &&
++        nice <= kMaxServerNice) {
++      limits.nice = nice;
++    } else {
++      LOG(WARNING) << "browseros: Invalid server nice level specified on "
++                      "command line: "
++                   << value << " (must be 0-" << kMaxServerNice << ")";
++    }
++  }
++
++  if (command_line->HasSwitch(browseros::kServerMemoryLimit)) {
++    std::string value =
++        command_line->GetSwitchValueASCII(browseros::kServerMemoryLimit);
++    int limit_mb = 0;
++    if (base::StringToInt(value, &limit_mb) && limit_mb > 0) {
++      limits.memory_limit_mb = limit_mb;
++    } else {
++      LOG(WARNING) << "browseros: Invalid server memory limit specified on "
++                      "command line: "
++                   << value;
++    }
++  }
++
++  if (command_line->HasSwitch(browseros::kServerCpuAffinity)) {
++    std::string value =
++        command_line->GetSwitchValueASCII(browseros::kServerCpuAffinity);
++    for (const std::string& core_str : base::SplitString(
++             value, ",", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
++      int core = 0;
++      if (!base::StringToInt(core_str, &core) || core < 0) {
++        LOG(WARNING) << "browseros: Invalid server CPU affinity specified on "
++                        "command line: "
++                     << value;
++        limits.cpu_affinity.clear();
++        break;
++      }
++      limits.cpu_affinity.push_back(core);
++    }
++  }
++
++  return limits;
++}
++
 +int GetPortOverrideFromCommandLine(base::CommandLine* command_line,
 +                                    const char* switch_name,
 +                                    const char* port_name) {
@@ -140,6 +242,83 @@ index 0000000000000..6d44b32b78ce8
 +  uint16_t port_;
 +};
 +
++// Returns the backend's Unix domain socket under |execution_dir|, or an
++// empty path when the backend should stay TCP only.
++base::FilePath GetBackendSocketPath(const base::FilePath& execution_dir) {
++#if BUILDFLAG(IS_POSIX)
++  if (!base::CommandLine::ForCurrentProcess()->HasSwitch(
++          browseros::kServerSocket)) {
++    return base::FilePath();
++  }
++
++  base::FilePath socket_path =
++      execution_dir.Append(FILE_PATH_LITERAL("server.sock"));
++  // sun_path is fixed size; 104 bytes on macOS
++  if (socket_path.value().size() >= sizeof(sockaddr_un::sun_path)) {
++    LOG(WARNING) << "browseros: Socket path too long, backend stays on TCP: "
++                 << socket_path;
++    return base::FilePath();
++  }
++  return socket_path;
++#else
++  // Named pipes have no net::StreamSocket client to forward over
++  return base::FilePath();
++#endif
++}
++
++// Socket path for a server started next to the one on |current|, so the
++// running server keeps its socket until it is shut down
++base::FilePath GetStandbySocketPath(const base::FilePath& default_path,
++                                    const base::FilePath& current) {
++  if (default_path.empty() || current != default_path) {
++    return default_path;
++  }
++  base::FilePath standby_path =
++      default_path.InsertBeforeExtensionASCII("_standby");
++#if BUILDFLAG(IS_POSIX)
++  if (standby_path.value().size() >= sizeof(sockaddr_un::sun_path)) {
++    return base::FilePath();
++  }
++#endif
++  return standby_path;
++}
++
++// Fleet settings from the command line; fleet mode stays off without a
++// token
++FleetConfig GetFleetConfig() {
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  FleetConfig config;
++  config.token = command_line->GetSwitchValueASCII(browseros::kFleetToken);
++  if (config.token.empty()) {
++    return config;
++  }
++
++  if (command_line->HasSwitch(browseros::kFleetCoordinator)) {
++    std::string value =
++        command_line->GetSwitchValueASCII(browseros::kFleetCoordinator);
++    config.coordinator = ParseFleetEndpoint(value);
++    if (!config.coordinator) {
++      LOG(WARNING) << "browseros: Invalid fleet coordinator specified on "
++                      "command line: "
++                   << value << " (must be address:port)";
++    }
++  }
++
++  if (command_line->HasSwitch(browseros::kFleetMaxSessions)) {
++    std::string value =
++        command_line->GetSwitchValueASCII(browseros::kFleetMaxSessions);
++    int max_sessions = 0;
++    if (base::StringToInt(value, &max_sessions) && max_sessions >= 0) {
++      config.max_sessions = max_sessions;
++    } else {
++      LOG(WARNING) << "browseros: Invalid fleet session count specified on "
++                      "command line: "
++                   << value;
++    }
++  }
++  return config;
++}
++
 +}  // namespace
 +
 +namespace browseros {
@@ -155,7 +334,8 @@ index 0000000000000..6d44b32b78ce8
 +      state_store_(std::make_unique<ServerStateStoreImpl>()),
 +      health_checker_(std::make_unique<HealthCheckerImpl>()),
 +      local_state_(g_browser_process ? g_browser_process->local_state()
-+                                     : nullptr) {}
++                                     : nullptr),
++      direct_call_token_(base::UnguessableToken::Create().ToString()) {}
 +
 +BrowserOSServerManager::BrowserOSServerManager(
 +    std::unique_ptr<ProcessController> process_controller,
@@ -167,6 +347,7 @@ index 0000000000000..6d44b32b78ce8
 +      state_store_(std::move(state_store)),
 +      health_checker_(std::move(health_checker)),
 +      local_state_(local_state),
++      direct_call_token_(base::UnguessableToken::Create().ToString()),
 +      updater_(std::move(updater)) {}
 +
 +BrowserOSServerManager::~BrowserOSServerManager() {
@@ -207,22 +388,108 @@ index 0000000000000..6d44b32b78ce8
 +  return true;
 +}
 +
-+bool BrowserOSServerManager::RecoverFromOrphan() {
-+  base::ScopedAllowBlocking allow_blocking;
++void BrowserOSServerManager::ReserveProxyPort() {
++  const bool fixed = base::CommandLine::ForCurrentProcess()->HasSwitch(
++      browseros::kProxyPort);
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&BrowserOSServerManager::BindProxyPort, ports_, fixed),
++      base::BindOnce(&BrowserOSServerManager::OnProxyPortReserved,
++                     weak_factory_.GetWeakPtr()));
++}
 +
-+  std::optional<server_utils::ServerState> state = state_store_->Read();
++// static
++BrowserOSServerManager::ResolvedPorts BrowserOSServerManager::BindProxyPort(
++    ServerPorts ports,
++    bool fixed) {
++  ResolvedPorts resolved;
++  resolved.ports = ports;
++  if (fixed) {
++    resolved.proxy_socket = server_utils::ListenOnPort(ports.proxy, kBackLog);
++  } else {
++    resolved.proxy_socket = server_utils::ListenOnAvailablePort(
++        ports.proxy, {ports.cdp}, kBackLog, &resolved.ports.proxy);
++  }
++  return resolved;
++}
++
++void BrowserOSServerManager::OnProxyPortReserved(ResolvedPorts resolved) {
++  if (!start_pending_) {
++    return;
++  }
++  if (resolved.proxy_socket) {
++    ports_.proxy = resolved.ports.proxy;
++    pending_proxy_socket_ = std::move(resolved.proxy_socket);
++    LOG(INFO) << "browseros: Reserved MCP port " << ports_.proxy;
++  }
++
++  content::BrowserThread::PostBestEffortTask(
++      FROM_HERE, base::SequencedTaskRunner::GetCurrentDefault(),
++      base::BindOnce(&BrowserOSServerManager::StartDeferred,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::StartDeferred() {
++  if (!start_pending_) {
++    return;
++  }
++  start_pending_ = false;
++
++  const base::TimeDelta startup_time = base::TimeTicks::Now() - start_time_;
++  LOG(INFO) << "browseros: Continuing server startup "
++            << startup_time.InMilliseconds() << "ms after browser start";
++  browseros_metrics::BrowserOSMetrics::Log(
++      "server.startup.deferred",
++      {{"startup_ms",
++        base::Value(static_cast<int>(startup_time.InMilliseconds()))}});
++
++  browseros::BeginStartupPhase(browseros::StartupPhase::kAcquireLock);
++  const bool locked = AcquireLock();
++  browseros::EndStartupPhase(browseros::StartupPhase::kAcquireLock);
++  if (!locked) {
++    // Another browser's server owns the MCP port
++    pending_proxy_socket_.reset();
++    return;
++  }
++
++  resource_limits_ =
++      GetResourceLimitsFromCommandLine(base::CommandLine::ForCurrentProcess());
++
++  // Phase 2: We hold the lock — we're the active instance.
++  // Clean up after a crashed predecessor, then resolve actual available
++  // ports and save the final values.
++  RecoverFromOrphan();
++}
++
++void BrowserOSServerManager::RecoverFromOrphan() {
++  // The state file is claimed first so the new server's state, written at
++  // launch, can't be deleted by the recovery
++  browseros::BeginStartupPhase(browseros::StartupPhase::kRecoverFromOrphan);
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&BrowserOSServerManager::ClaimOrphan,
++                     base::Unretained(state_store_.get())),
++      base::BindOnce(&BrowserOSServerManager::OnOrphanClaimed,
++                     weak_factory_.GetWeakPtr()));
++}
++
++// static
++std::optional<base::ProcessId> BrowserOSServerManager::ClaimOrphan(
++    ServerStateStore* state_store) {
++  std::optional<server_utils::ServerState> state = state_store->Read();
 +  if (!state) {
 +    LOG(INFO) << "browseros: No orphan state file found";
-+    return false;
++    return std::nullopt;
 +  }
 +
 +  LOG(INFO) << "browseros: Found state file - PID: " << state->pid
 +            << ", creation_time: " << state->creation_time;
 +
++  state_store->Delete();
++
 +  if (!server_utils::ProcessExists(state->pid)) {
 +    LOG(INFO) << "browseros: Process " << state->pid << " no longer exists";
-+    state_store_->Delete();
-+    return false;
++    return std::nullopt;
 +  }
 +
 +  std::optional<int64_t> actual_creation_time =
@@ -230,30 +497,55 @@ index 0000000000000..6d44b32b78ce8
 +  if (!actual_creation_time) {
 +    LOG(WARNING) << "browseros: Could not get creation time for PID "
 +                 << state->pid;
-+    state_store_->Delete();
-+    return false;
++    return std::nullopt;
 +  }
 +
 +  if (*actual_creation_time != state->creation_time) {
 +    LOG(INFO) << "browseros: PID " << state->pid << " was reused "
 +              << "(expected creation_time: " << state->creation_time
 +              << ", actual: " << *actual_creation_time << ")";
-+    state_store_->Delete();
-+    return false;
++    return std::nullopt;
 +  }
 +
-+  LOG(INFO) << "browseros: Killing orphan server (PID: " << state->pid << ")";
-+  constexpr base::TimeDelta kGracefulTimeout = base::Seconds(2);
-+  bool killed = server_utils::KillProcess(state->pid, kGracefulTimeout);
++  return state->pid;
++}
 +
-+  if (killed) {
-+    LOG(INFO) << "browseros: Orphan server killed successfully";
-+  } else {
-+    LOG(WARNING) << "browseros: Failed to kill orphan server, proceeding anyway";
++void BrowserOSServerManager::OnOrphanClaimed(
++    std::optional<base::ProcessId> orphan_pid) {
++  browseros::EndStartupPhase(browseros::StartupPhase::kRecoverFromOrphan);
++  if (orphan_pid) {
++    // Killed in the background while the new server starts; the orphan's
++    // ports are still taken, so port resolution picks fresh ones
++    LOG(INFO) << "browseros: Killing orphan server (PID: " << *orphan_pid
++              << ")";
++    base::ThreadPool::PostTask(
++        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
++        base::BindOnce(
++            [](base::ProcessId pid) {
++              constexpr base::TimeDelta kGracefulTimeout = base::Seconds(2);
++              if (server_utils::KillProcess(pid, kGracefulTimeout)) {
++                LOG(INFO) << "browseros: Orphan server killed successfully";
++              } else {
++                LOG(WARNING) << "browseros: Failed to kill orphan server";
++              }
++            },
++            *orphan_pid));
 +  }
 +
-+  state_store_->Delete();
-+  return killed;
++  // Skip probing for CLI-overridden ports — trust the developer.
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  FixedPorts fixed;
++  fixed.cdp = command_line->HasSwitch(browseros::kCDPPort);
++  fixed.server = command_line->HasSwitch(browseros::kServerPort);
++  fixed.extension = command_line->HasSwitch(browseros::kExtensionPort);
++  // The proxy port reserved by Start() stays; it is only probed here if
++  // reserving it failed
++  const bool proxy_reserved = !!pending_proxy_socket_;
++  fixed.proxy = proxy_reserved || command_line->HasSwitch(browseros::kProxyPort);
++  browseros::BeginStartupPhase(browseros::StartupPhase::kResolvePorts);
++  ResolvePorts(fixed, /*bind_proxy=*/!proxy_reserved,
++               base::BindOnce(&BrowserOSServerManager::OnStartupPortsResolved,
++                              weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSServerManager::LoadPortsFromPrefs() {
@@ -318,47 +610,105 @@ index 0000000000000..6d44b32b78ce8
 +          base::Unretained(this)));
 +}
 +
-+void BrowserOSServerManager::ResolvePortsForStartup() {
-+  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
-+  std::set<int> assigned_ports;
++BrowserOSServerManager::ResolvedPorts::ResolvedPorts() = default;
++BrowserOSServerManager::ResolvedPorts::ResolvedPorts(ResolvedPorts&&) =
++    default;
++BrowserOSServerManager::ResolvedPorts&
++BrowserOSServerManager::ResolvedPorts::operator=(ResolvedPorts&&) = default;
++BrowserOSServerManager::ResolvedPorts::~ResolvedPorts() = default;
++
++void BrowserOSServerManager::ResolvePorts(FixedPorts fixed,
++                                          bool bind_proxy,
++                                          base::OnceClosure then) {
++  // Probing binds sockets, which blocks; keep it off the UI thread
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&BrowserOSServerManager::ProbePorts, ports_, fixed,
++                     bind_proxy),
++      base::BindOnce(&BrowserOSServerManager::OnPortsResolved,
++                     weak_factory_.GetWeakPtr(), std::move(then)));
++}
 +
-+  // Skip FindAvailablePort for CLI-overridden ports — trust the developer.
-+  bool cdp_fixed = command_line->HasSwitch(browseros::kCDPPort);
-+  bool proxy_fixed = command_line->HasSwitch(browseros::kProxyPort);
-+  bool server_fixed = command_line->HasSwitch(browseros::kServerPort);
-+  bool extension_fixed = command_line->HasSwitch(browseros::kExtensionPort);
++// static
++BrowserOSServerManager::ResolvedPorts BrowserOSServerManager::ProbePorts(
++    ServerPorts ports,
++    FixedPorts fixed,
++    bool bind_proxy) {
++  ResolvedPorts resolved;
++  resolved.ports = ports;
++  std::set<int> assigned_ports;
 +
-+  if (cdp_fixed) {
-+    assigned_ports.insert(ports_.cdp);
-+  } else {
-+    ports_.cdp = server_utils::FindAvailablePort(ports_.cdp, assigned_ports);
-+    assigned_ports.insert(ports_.cdp);
++  if (!fixed.cdp) {
++    resolved.ports.cdp =
++        server_utils::FindAvailablePort(ports.cdp, assigned_ports);
 +  }
++  assigned_ports.insert(resolved.ports.cdp);
 +
-+  if (proxy_fixed) {
-+    assigned_ports.insert(ports_.proxy);
-+  } else {
-+    ports_.proxy = server_utils::FindAvailablePort(ports_.proxy, assigned_ports,
-+                                                   /*allow_reuse=*/true);
-+    assigned_ports.insert(ports_.proxy);
++  if (bind_proxy) {
++    // Bound here and handed to the proxy, so the port can't be lost between
++    // the probe and the proxy starting
++    if (fixed.proxy) {
++      resolved.proxy_socket = server_utils::ListenOnPort(ports.proxy, kBackLog);
++    } else {
++      resolved.proxy_socket = server_utils::ListenOnAvailablePort(
++          ports.proxy, assigned_ports, kBackLog, &resolved.ports.proxy);
++    }
 +  }
++  assigned_ports.insert(resolved.ports.proxy);
 +
-+  if (server_fixed) {
-+    assigned_ports.insert(ports_.server);
-+  } else {
-+    ports_.server = server_utils::FindAvailablePort(
++  if (!fixed.server) {
++    resolved.ports.server = server_utils::FindAvailablePort(
 +        browseros_server::kDefaultServerPort, assigned_ports);
-+    assigned_ports.insert(ports_.server);
 +  }
++  assigned_ports.insert(resolved.ports.server);
 +
-+  if (extension_fixed) {
-+    assigned_ports.insert(ports_.extension);
-+  } else {
-+    ports_.extension = server_utils::FindAvailablePort(
++  if (!fixed.extension) {
++    resolved.ports.extension = server_utils::FindAvailablePort(
 +        browseros_server::kDefaultExtensionPort, assigned_ports);
 +  }
 +
-+  LOG(INFO) << "browseros: Resolved ports for startup - " << ports_.DebugString();
++  return resolved;
++}
++
++void BrowserOSServerManager::OnPortsResolved(base::OnceClosure then,
++                                             ResolvedPorts resolved) {
++  ports_ = resolved.ports;
++  if (resolved.proxy_socket) {
++    pending_proxy_socket_ = std::move(resolved.proxy_socket);
++  }
++  LOG(INFO) << "browseros: Resolved ports - " << ports_.DebugString();
++
++  SavePortsToPrefs();
++  std::move(then).Run();
++}
++
++void BrowserOSServerManager::ResolvePortsForRestart() {
++  // CDP and the proxy keep running across restarts; so do CLI-overridden
++  // ports
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  FixedPorts fixed;
++  fixed.cdp = true;
++  fixed.proxy = true;
++  fixed.server = command_line->HasSwitch(browseros::kServerPort);
++  fixed.extension = command_line->HasSwitch(browseros::kExtensionPort);
++  ResolvePorts(fixed, /*bind_proxy=*/false,
++               base::BindOnce(&BrowserOSServerManager::LaunchBrowserOSProcess,
++                              weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnStartupPortsResolved() {
++  browseros::EndStartupPhase(browseros::StartupPhase::kResolvePorts);
++  LOG(INFO) << "browseros: Starting BrowserOS server";
++
++  browseros::BeginStartupPhase(browseros::StartupPhase::kStartCDPServer);
++  StartCDPServer();
++  browseros::EndStartupPhase(browseros::StartupPhase::kStartCDPServer);
++
++  browseros::BeginStartupPhase(browseros::StartupPhase::kStartProxy);
++  StartProxy();
++  browseros::EndStartupPhase(browseros::StartupPhase::kStartProxy);
++
++  LaunchBrowserOSProcess();
 +}
 +
 +void BrowserOSServerManager::ApplyCommandLineOverrides() {
@@ -410,10 +760,12 @@ index 0000000000000..6d44b32b78ce8
 +}
 +
 +void BrowserOSServerManager::Start() {
-+  if (is_running_) {
++  if (is_running_ || start_pending_) {
 +    LOG(INFO) << "browseros: BrowserOS server already running";
 +    return;
 +  }
++  start_time_ = base::TimeTicks::Now();
++  browseros::SetStartupOrigin(start_time_);
 +
 +  // Phase 1: Load user intent (prefs + CLI overrides).
 +  // Save stable port preferences so CLI overrides are persisted even when
@@ -429,24 +781,17 @@ index 0000000000000..6d44b32b78ce8
 +    return;
 +  }
 +
-+  if (!AcquireLock()) {
-+    return;
-+  }
-+
-+  // Phase 2: We hold the lock — we're the active instance.
-+  // Now resolve actual available ports and save the final values.
-+  RecoverFromOrphan();
-+  ResolvePortsForStartup();
-+  SavePortsToPrefs();
-+
-+  LOG(INFO) << "browseros: Starting BrowserOS server";
-+
-+  StartCDPServer();
-+  StartProxy();
-+  LaunchBrowserOSProcess();
++  // Only the MCP port is taken during browser startup; the rest is staged
++  // behind it
++  start_pending_ = true;
++  ReserveProxyPort();
 +}
 +
 +void BrowserOSServerManager::Stop() {
++  // A startup still waiting for its deferred phase is dropped
++  if (std::exchange(start_pending_, false)) {
++    pending_proxy_socket_.reset();
++  }
 +  if (!is_running_) {
 +    return;
 +  }
@@ -455,7 +800,14 @@ index 0000000000000..6d44b32b78ce8
 +
 +  LOG(INFO) << "browseros: Stopping BrowserOS server";
 +  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  readiness_probe_timer_.Stop();
++  StopWatchingProcess();
++  StopWorkers();
++  AbortStandby();
++  if (retiring_process_.IsValid()) {
++    process_controller_->Terminate(&retiring_process_, /*wait=*/false);
++    retiring_process_ = base::Process();
++  }
 +
 +  if (updater_) {
 +    updater_->Stop();
@@ -466,10 +818,7 @@ index 0000000000000..6d44b32b78ce8
 +
 +  TerminateBrowserOSProcess(base::DoNothing());
 +
-+  {
-+    base::ScopedAllowBlocking allow_blocking;
-+    state_store_->Delete();
-+  }
++  state_store_->Delete();
 +
 +  if (lock_file_.IsValid()) {
 +    lock_file_.Unlock();
@@ -511,30 +860,107 @@ index 0000000000000..6d44b32b78ce8
 +void BrowserOSServerManager::StartProxy() {
 +  server_proxy_ = std::make_unique<BrowserOSServerProxy>();
 +
-+  // Clone the factory on the UI thread so it can be bound on the IO thread.
-+  auto pending_factory =
-+      g_browser_process->system_network_context_manager()
-+          ->GetSharedURLLoaderFactory()
-+          ->Clone();
++  std::optional<base::TimeDelta> hold_time;
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  if (command_line->HasSwitch(browseros::kProxyHoldTime)) {
++    std::string value =
++        command_line->GetSwitchValueASCII(browseros::kProxyHoldTime);
++    int seconds = 0;
++    if (base::StringToInt(value, &seconds) && seconds >= 0) {
++      hold_time = base::Seconds(seconds);
++    } else {
++      LOG(WARNING) << "browseros: Invalid proxy hold time specified on "
++                      "command line: "
++                   << value;
++    }
++  }
++
++  base::FilePath shared_payload_dir;
++  const base::FilePath execution_dir = GetBrowserOSExecutionDir();
++  if (!execution_dir.empty()) {
++    shared_payload_dir = execution_dir.AppendASCII(
++        browseros_server::kSharedPayloadDirectoryName);
++  }
 +
 +  content::GetIOThreadTaskRunner({})->PostTask(
 +      FROM_HERE,
 +      base::BindOnce(
 +          [](BrowserOSServerProxy* proxy, int port,
-+             std::unique_ptr<network::PendingSharedURLLoaderFactory> pending,
-+             bool allow_remote) {
-+            if (!proxy->Start(port, std::move(pending))) {
++             std::unique_ptr<net::TCPServerSocket> listen_socket,
++             bool allow_remote, std::optional<base::TimeDelta> hold_time,
++             base::RepeatingClosure on_backend_activity,
++             std::string direct_call_token,
++             DirectCallHandler direct_call_handler,
++             base::FilePath shared_payload_dir, bool mcp_fast_path,
++             FleetConfig fleet_config) {
++            if (!proxy->Start(port, std::move(listen_socket))) {
 +              LOG(ERROR) << "browseros: Failed to start MCP proxy on port "
 +                         << port;
 +              return;
 +            }
 +            proxy->SetAllowRemote(allow_remote);
++            proxy->SetBackendActivityCallback(std::move(on_backend_activity));
++            proxy->SetDirectCallHandler(std::move(direct_call_token),
++                                        std::move(direct_call_handler));
++            proxy->SetMcpFastPathEnabled(mcp_fast_path);
++            if (!shared_payload_dir.empty()) {
++              proxy->SetSharedPayloadDir(shared_payload_dir);
++            }
++            if (hold_time) {
++              proxy->SetRequestHoldTime(*hold_time);
++            }
++            if (!fleet_config.token.empty()) {
++              proxy->SetFleetConfig(fleet_config);
++            }
 +          },
-+          server_proxy_.get(), ports_.proxy, std::move(pending_factory),
-+          allow_remote_in_mcp_));
++          server_proxy_.get(), ports_.proxy, std::move(pending_proxy_socket_),
++          allow_remote_in_mcp_, hold_time,
++          base::BindPostTaskToCurrentDefault(base::BindRepeating(
++              &BrowserOSServerManager::OnProxyBackendActivity,
++              weak_factory_.GetWeakPtr())),
++          direct_call_token_,
++          base::BindPostTask(content::GetUIThreadTaskRunner({}),
++                             base::BindRepeating(&RunDirectCall)),
++          std::move(shared_payload_dir),
++          !command_line->HasSwitch(browseros::kDisableMcpFastPath),
++          GetFleetConfig()));
++
++  proxy_memory_pressure_registration_ = AddMemoryPressureHandler(
++      "server_proxy",
++      base::BindRepeating(
++          [](BrowserOSServerProxy* proxy,
++             base::MemoryPressureListener::MemoryPressureLevel level,
++             base::OnceCallback<void(ReleasedMemory)> done) {
++            // StopProxy() drops this registration before it posts the
++            // proxy's deletion, so the proxy outlives the task
++            content::GetIOThreadTaskRunner({})->PostTaskAndReplyWithResult(
++                FROM_HERE,
++                base::BindOnce(&BrowserOSServerProxy::ReleaseMemory,
++                               base::Unretained(proxy)),
++                std::move(done));
++          },
++          base::Unretained(server_proxy_.get())));
++
++  // Queue and backend time of MCP requests, next to the browserOS calls
++  // they turn into on chrome://browseros-internals
++  proxy_profiler_registration_ = AddStepProfilerSource(
++      "server_proxy",
++      base::BindRepeating(
++          [](BrowserOSServerProxy* proxy,
++             base::OnceCallback<void(base::Value::Dict)> done) {
++            // Dropped in StopProxy() like the memory pressure handler
++            content::GetIOThreadTaskRunner({})->PostTaskAndReplyWithResult(
++                FROM_HERE,
++                base::BindOnce(&BrowserOSServerProxy::GetStats,
++                               base::Unretained(proxy)),
++                std::move(done));
++          },
++          base::Unretained(server_proxy_.get())));
 +}
 +
 +void BrowserOSServerManager::StopProxy() {
++  proxy_memory_pressure_registration_.RunAndReset();
++  proxy_profiler_registration_.RunAndReset();
 +  if (server_proxy_) {
 +    content::GetIOThreadTaskRunner({})->PostTask(
 +        FROM_HERE,
@@ -553,6 +979,11 @@ index 0000000000000..6d44b32b78ce8
 +  config.paths.fallback_exe = GetBrowserOSServerExecutablePath();
 +  config.paths.fallback_resources = GetBrowserOSServerResourcesPath();
 +  config.paths.execution = GetBrowserOSExecutionDir();
++  config.paths.backend_socket = GetBackendSocketPath(config.paths.execution);
++  if (!config.paths.execution.empty()) {
++    config.paths.shared_payloads = config.paths.execution.AppendASCII(
++        browseros_server::kSharedPayloadDirectoryName);
++  }
 +
 +  if (updater_) {
 +    config.paths.exe = updater_->GetBestServerBinaryPath();
@@ -582,7 +1013,9 @@ index 0000000000000..6d44b32b78ce8
 +    }
 +  }
 +
++  config.limits = resource_limits_;
 +  config.allow_remote_in_mcp = allow_remote_in_mcp_;
++  config.direct_call_token = direct_call_token_;
 +
 +  return config;
 +}
@@ -596,9 +1029,12 @@ index 0000000000000..6d44b32b78ce8
 +  }
 +
 +  LOG(INFO) << "browseros: Launching server - " << config.DebugString();
++  backend_socket_ = config.paths.backend_socket;
 +
 +  ProcessController* pc = process_controller_.get();
 +
++  // Only the first launch of the session is timed; retries count towards it
++  browseros::BeginStartupPhase(browseros::StartupPhase::kLaunchProcess);
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
 +      base::BindOnce(&ProcessController::Launch, base::Unretained(pc), config),
@@ -618,50 +1054,15 @@ index 0000000000000..6d44b32b78ce8
 +    is_restarting_ = false;
 +
 +    if (was_updating) {
-+      is_updating_ = false;
-+      if (update_complete_callback_) {
-+        std::move(update_complete_callback_).Run(false);
-+      }
++      FinishUpdate(false);
 +    }
 +    return;
 +  }
 +
-+  process_ = std::move(result.process);
-+  is_running_ = true;
-+  last_launch_time_ = base::TimeTicks::Now();
-+
-+  LOG(INFO) << "browseros: BrowserOS server started with PID: " << process_.Pid();
-+  LOG(INFO) << "browseros: " << ports_.DebugString();
-+
-+  // Point proxy at the new backend port (proxy lives on IO thread)
-+  if (server_proxy_) {
-+    content::GetIOThreadTaskRunner({})->PostTask(
-+        FROM_HERE,
-+        base::BindOnce(&BrowserOSServerProxy::SetBackendPort,
-+                       base::Unretained(server_proxy_.get()), ports_.server));
-+  }
-+
-+  {
-+    base::ScopedAllowBlocking allow_blocking;
-+    std::optional<int64_t> creation_time =
-+        server_utils::GetProcessCreationTime(process_.Pid());
-+    if (creation_time) {
-+      server_utils::ServerState state;
-+      state.pid = process_.Pid();
-+      state.creation_time = *creation_time;
-+      if (!state_store_->Write(state)) {
-+        LOG(WARNING) << "browseros: Failed to write server state file";
-+      }
-+    } else {
-+      LOG(WARNING)
-+          << "browseros: Could not get process creation time for state file";
-+    }
-+  }
-+
-+  health_check_timer_.Start(FROM_HERE, kHealthCheckInterval, this,
-+                            &BrowserOSServerManager::CheckServerHealth);
-+  process_check_timer_.Start(FROM_HERE, kProcessCheckInterval, this,
-+                             &BrowserOSServerManager::CheckProcessStatus);
++  browseros::EndStartupPhase(browseros::StartupPhase::kLaunchProcess);
++  browseros::BeginStartupPhase(browseros::StartupPhase::kFirstHealthCheck);
++  AdoptServerProcess(std::move(result.process), base::TimeTicks::Now());
++  StartReadinessProbe();
 +
 +  if (is_restarting_) {
 +    is_restarting_ = false;
@@ -673,10 +1074,7 @@ index 0000000000000..6d44b32b78ce8
 +  }
 +
 +  if (was_updating) {
-+    is_updating_ = false;
-+    if (update_complete_callback_) {
-+      std::move(update_complete_callback_).Run(true);
-+    }
++    FinishUpdate(true);
 +  }
 +
 +  if (!updater_) {
@@ -691,6 +1089,46 @@ index 0000000000000..6d44b32b78ce8
 +  }
 +}
 +
++void BrowserOSServerManager::AdoptServerProcess(base::Process process,
++                                                base::TimeTicks launch_time) {
++  process_ = std::move(process);
++  is_running_ = true;
++  last_launch_time_ = launch_time;
++
++  LOG(INFO) << "browseros: BrowserOS server started with PID: " << process_.Pid();
++  LOG(INFO) << "browseros: " << ports_.DebugString();
++
++  std::optional<int64_t> creation_time;
++  {
++    base::ScopedAllowBlocking allow_blocking;
++    creation_time = server_utils::GetProcessCreationTime(process_.Pid());
++  }
++  if (creation_time) {
++    server_utils::ServerState state;
++    state.pid = process_.Pid();
++    state.creation_time = *creation_time;
++    if (!state_store_->Write(state)) {
++      LOG(WARNING) << "browseros: Failed to write server state file";
++    }
++  } else {
++    LOG(WARNING)
++        << "browseros: Could not get process creation time for state file";
++  }
++
++  consecutive_health_failures_ = 0;
++  health_check_interval_ = kHealthCheckInterval;
++  health_check_timeout_ = kHealthCheckMinTimeout;
++  health_check_latency_ = base::TimeDelta();
++  last_backend_activity_ = base::TimeTicks();
++  ScheduleHealthCheck(health_check_interval_);
++  process_check_timer_.Start(FROM_HERE, kProcessCheckInterval, this,
++                             &BrowserOSServerManager::CheckProcessStatus);
++  last_resource_sample_ = {};
++  resource_sample_timer_.Start(FROM_HERE, kResourceSampleInterval, this,
++                               &BrowserOSServerManager::SampleServerResources);
++  WatchProcessExit();
++}
++
 +void BrowserOSServerManager::TerminateBrowserOSProcess(
 +    base::OnceCallback<void()> callback) {
 +  if (!process_.IsValid()) {
@@ -723,8 +1161,17 @@ index 0000000000000..6d44b32b78ce8
 +  LOG(INFO) << "browseros: BrowserOS server exited with code: " << exit_code;
 +  is_running_ = false;
 +
++  if (standby_starting_) {
++    LOG(WARNING) << "browseros: Server exited during update, dropping the "
++                    "standby server";
++    AbortStandby();
++    FinishUpdate(false);
++  }
++
 +  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  readiness_probe_timer_.Stop();
++  StopWatchingProcess();
++  StopWorkers();
 +
 +  if (exit_code == kExitCodeSuccess) {
 +    LOG(INFO) << "browseros: Server exited cleanly (code 0), not restarting";
@@ -761,22 +1208,193 @@ index 0000000000000..6d44b32b78ce8
 +  RestartBrowserOSProcess();
 +}
 +
++void BrowserOSServerManager::StartReadinessProbe() {
++  server_ready_ = false;
++  readiness_probe_delay_ = kReadinessProbeInitialDelay;
++  readiness_probe_timer_.Start(FROM_HERE, readiness_probe_delay_, this,
++                               &BrowserOSServerManager::ProbeReadiness);
++}
++
++void BrowserOSServerManager::ProbeReadiness() {
++  if (!is_running_ || server_ready_) {
++    return;
++  }
++
++  if (base::TimeTicks::Now() - last_launch_time_ >= kStartupGracePeriod) {
++    LOG(WARNING) << "browseros: Server not healthy after "
++                 << kStartupGracePeriod.InSeconds()
++                 << "s, forwarding to it anyway";
++    browseros_metrics::BrowserOSMetrics::Log("server.startup.not_ready");
++    OnServerReady();
++    return;
++  }
++
++  health_checker_->CheckHealth(
++      ports_.server,
++      base::BindOnce(&BrowserOSServerManager::OnReadinessProbeComplete,
++                     weak_factory_.GetWeakPtr(), process_.Pid()));
++}
++
++void BrowserOSServerManager::OnReadinessProbeComplete(base::ProcessId pid,
++                                                      bool success) {
++  // Ignores probes of a process that has since been replaced
++  if (!is_running_ || server_ready_ || !process_.IsValid() ||
++      process_.Pid() != pid) {
++    return;
++  }
++
++  if (success) {
++    base::TimeDelta ready_time = base::TimeTicks::Now() - last_launch_time_;
++    LOG(INFO) << "browseros: Server ready after "
++              << ready_time.InMilliseconds() << "ms";
++    browseros_metrics::BrowserOSMetrics::Log(
++        "server.startup.ready",
++        {{"ready_ms", base::Value(static_cast<int>(
++                          ready_time.InMilliseconds()))}});
++    browseros::EndStartupPhase(browseros::StartupPhase::kFirstHealthCheck);
++    OnServerReady();
++    return;
++  }
++
++  readiness_probe_delay_ =
++      std::min(readiness_probe_delay_ * 2, kReadinessProbeMaxDelay);
++  readiness_probe_timer_.Start(FROM_HERE, readiness_probe_delay_, this,
++                               &BrowserOSServerManager::ProbeReadiness);
++}
++
++void BrowserOSServerManager::OnServerReady() {
++  server_ready_ = true;
++  readiness_probe_timer_.Stop();
++  // Time-to-MCP-ready, counted from Start() and reported once per
++  // browser session
++  if (!start_time_.is_null()) {
++    const base::TimeDelta mcp_ready_time = base::TimeTicks::Now() - start_time_;
++    browseros_metrics::BrowserOSMetrics::Log(
++        "server.startup.mcp_ready",
++        {{"mcp_ready_ms",
++          base::Value(static_cast<int>(mcp_ready_time.InMilliseconds()))}});
++    browseros::MarkStartupMcpReady();
++    start_time_ = base::TimeTicks();
++  }
++  SetProxyBackend(ports_.server, backend_socket_);
++  StartWorkers();
++}
++
++void BrowserOSServerManager::StartWorkers() {
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  if (!command_line->HasSwitch(browseros::kServerWorkers)) {
++    return;
++  }
++
++  std::string value =
++      command_line->GetSwitchValueASCII(browseros::kServerWorkers);
++  int count = 0;
++  if (!base::StringToInt(value, &count) || count < 1 ||
++      count > kMaxServerWorkers) {
++    LOG(WARNING) << "browseros: Invalid server worker count specified on "
++                    "command line: "
++                 << value << " (must be 1-" << kMaxServerWorkers << ")";
++    return;
++  }
++  if (count == 1) {
++    return;
++  }
++
++  if (!workers_) {
++    workers_ = std::make_unique<BrowserOSServerWorkers>(
++        process_controller_.get(),
++        base::BindRepeating([]() -> std::unique_ptr<HealthChecker> {
++          return std::make_unique<HealthCheckerImpl>();
++        }),
++        base::BindRepeating(&BrowserOSServerManager::SetProxyWorkers,
++                            weak_factory_.GetWeakPtr()));
++  }
++  workers_->Start(count, BuildLaunchConfig());
++}
++
++void BrowserOSServerManager::StopWorkers() {
++  if (workers_) {
++    workers_->Stop();
++  }
++}
++
++void BrowserOSServerManager::SetProxyWorkers(std::vector<int> ports) {
++  if (server_proxy_) {
++    content::GetIOThreadTaskRunner({})->PostTask(
++        FROM_HERE,
++        base::BindOnce(&BrowserOSServerProxy::SetWorkerBackends,
++                       base::Unretained(server_proxy_.get()),
++                       std::move(ports)));
++  }
++}
++
++void BrowserOSServerManager::SetProxyBackend(
++    int port,
++    const base::FilePath& socket_path) {
++  // Proxy lives on IO thread
++  if (server_proxy_) {
++    content::GetIOThreadTaskRunner({})->PostTask(
++        FROM_HERE,
++        base::BindOnce(&BrowserOSServerProxy::SetBackend,
++                       base::Unretained(server_proxy_.get()), port,
++                       socket_path));
++  }
++}
++
++void BrowserOSServerManager::ScheduleHealthCheck(base::TimeDelta delay) {
++  health_check_timer_.Start(FROM_HERE, delay, this,
++                            &BrowserOSServerManager::CheckServerHealth);
++}
++
 +void BrowserOSServerManager::CheckServerHealth() {
-+  if (!is_running_) {
++  // The server being replaced by an update isn't checked any more
++  if (!is_running_ || standby_starting_) {
 +    return;
 +  }
 +
++  if (workers_) {
++    workers_->CheckHealth();
++  }
++
++  // Traffic the proxy relayed successfully is as good as a passing probe
++  const base::TimeDelta since_activity =
++      base::TimeTicks::Now() - last_backend_activity_;
++  if (!last_backend_activity_.is_null() && consecutive_health_failures_ == 0 &&
++      since_activity < health_check_interval_) {
++    VLOG(1) << "browseros: Server active "
++            << since_activity.InSeconds() << "s ago, skipping health check";
++    ScheduleHealthCheck(health_check_interval_ - since_activity);
++    return;
++  }
++
++  health_check_start_time_ = base::TimeTicks::Now();
++  // Keeps checks going if the reply is dropped, e.g. when a readiness probe
++  // replaces the request; a reply reschedules from its own result
++  ScheduleHealthCheck(health_check_interval_ + health_check_timeout_);
++  health_checker_->SetHealthCheckTimeout(health_check_timeout_);
 +  health_checker_->CheckHealth(
 +      ports_.server,
 +      base::BindOnce(&BrowserOSServerManager::OnHealthCheckComplete,
 +                     weak_factory_.GetWeakPtr()));
 +}
 +
++void BrowserOSServerManager::OnProxyBackendActivity() {
++  if (is_running_ && server_ready_) {
++    last_backend_activity_ = base::TimeTicks::Now();
++  }
++  // MCP clients are driving the browser; keeps agent extensions warm
++  NotifyAgentActivity();
++}
++
 +void BrowserOSServerManager::CheckProcessStatus() {
 +  if (!is_running_ || !process_.IsValid() || is_restarting_) {
 +    return;
 +  }
 +
++  if (workers_) {
++    workers_->CheckProcesses();
++  }
++
 +  int exit_code = 0;
 +  bool exited = process_.WaitForExitWithTimeout(base::TimeDelta(), &exit_code);
 +  VLOG(1) << "browseros: CheckProcessStatus PID: " << process_.Pid()
@@ -788,17 +1406,147 @@ index 0000000000000..6d44b32b78ce8
 +  }
 +}
 +
++void BrowserOSServerManager::WatchProcessExit() {
++  exit_watcher_.emplace(base::ThreadPool::CreateSequencedTaskRunner(
++                            {base::TaskPriority::USER_VISIBLE}),
++                        process_.Duplicate());
++  // The signal only triggers a status check, which collects the exit code on
++  // this thread and ignores stale signals from a previous process
++  exit_watcher_.AsyncCall(&ProcessExitWatcher::Watch)
++      .WithArgs(base::BindPostTaskToCurrentDefault(
++          base::BindOnce(&BrowserOSServerManager::CheckProcessStatus,
++                         weak_factory_.GetWeakPtr())))
++      .Then(base::BindOnce(&BrowserOSServerManager::OnProcessExitWatchStarted,
++                           weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnProcessExitWatchStarted(bool watching) {
++  if (!watching || !process_check_timer_.IsRunning()) {
++    return;
++  }
++  VLOG(1) << "browseros: Watching server process for exit";
++  process_check_timer_.Start(FROM_HERE, kProcessCheckFallbackInterval, this,
++                             &BrowserOSServerManager::CheckProcessStatus);
++}
++
++void BrowserOSServerManager::StopWatchingProcess() {
++  process_check_timer_.Stop();
++  resource_sample_timer_.Stop();
++  exit_watcher_.Reset();
++}
++
++void BrowserOSServerManager::SampleServerResources() {
++  if (!is_running_ || !process_.IsValid() || is_restarting_) {
++    return;
++  }
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::BEST_EFFORT},
++      base::BindOnce(&server_utils::GetProcessResourceUsage, process_.Pid()),
++      base::BindOnce(&BrowserOSServerManager::OnServerResourcesSampled,
++                     weak_factory_.GetWeakPtr(), process_.Pid()));
++}
++
++void BrowserOSServerManager::OnServerResourcesSampled(
++    base::ProcessId pid,
++    std::optional<server_utils::ProcessResourceUsage> usage) {
++  if (!usage || !is_running_ || is_restarting_ || !process_.IsValid() ||
++      process_.Pid() != pid) {
++    return;
++  }
++
++  const base::TimeTicks now = base::TimeTicks::Now();
++  const double rss_mb = usage->resident_bytes / (1024.0 * 1024.0);
++  // CPU share since the previous sample, 100 per fully busy core
++  double cpu_percent = 0;
++  if (!last_resource_sample_.time.is_null()) {
++    const base::TimeDelta wall = now - last_resource_sample_.time;
++    if (wall.is_positive()) {
++      cpu_percent = (usage->cpu_time - last_resource_sample_.cpu_time) / wall *
++                    100;
++    }
++  }
++  last_resource_sample_ = {now, usage->cpu_time};
++
++  VLOG(1) << "browseros: Server PID " << pid << " RSS " << rss_mb
++          << "MB, CPU " << cpu_percent << "%";
++  browseros_metrics::BrowserOSMetrics::Log(
++      "server.resources",
++      {{"rss_mb", base::Value(rss_mb)},
++       {"cpu_percent", base::Value(cpu_percent)},
++       {"uptime_s", base::Value((now - last_launch_time_).InSecondsF())}},
++      kResourceMetricSampleRate);
++
++#if !BUILDFLAG(IS_WIN)
++  // Windows enforces the cap through the server's job object
++  if (resource_limits_.memory_limit_mb > 0 &&
++      rss_mb > resource_limits_.memory_limit_mb) {
++    LOG(WARNING) << "browseros: Server uses " << static_cast<int>(rss_mb)
++                 << "MB, over its " << resource_limits_.memory_limit_mb
++                 << "MB limit, restarting";
++    browseros_metrics::BrowserOSMetrics::Log(
++        "server.resources.memory_limit_exceeded",
++        {{"rss_mb", base::Value(rss_mb)},
++         {"limit_mb", base::Value(resource_limits_.memory_limit_mb)}});
++    RestartBrowserOSProcess();
++  }
++#endif
++}
++
 +void BrowserOSServerManager::OnHealthCheckComplete(bool success) {
-+  if (!is_running_) {
++  if (!is_running_ || standby_starting_) {
 +    return;
 +  }
 +
++  const base::TimeDelta latency =
++      health_check_start_time_.is_null()
++          ? base::TimeDelta()
++          : base::TimeTicks::Now() - health_check_start_time_;
++  health_check_start_time_ = base::TimeTicks();
++
 +  if (success) {
-+    LOG(INFO) << "browseros: Health check passed";
++    consecutive_health_failures_ = 0;
++    // Exponentially weighted, newest sample 1/4
++    health_check_latency_ = health_check_latency_.is_zero()
++                                ? latency
++                                : (health_check_latency_ * 3 + latency) / 4;
++    health_check_timeout_ =
++        std::clamp(health_check_latency_ * kHealthCheckTimeoutLatencyMultiplier,
++                   kHealthCheckMinTimeout, kHealthCheckMaxTimeout);
++    health_check_interval_ =
++        latency < kSlowHealthCheckLatency
++            ? std::min(std::max(health_check_interval_, kHealthCheckInterval) *
++                           2,
++                       kHealthCheckMaxInterval)
++            : kHealthCheckInterval;
++    VLOG(1) << "browseros: Health check passed in "
++            << latency.InMilliseconds() << "ms, next in "
++            << health_check_interval_.InSeconds() << "s";
++    ScheduleHealthCheck(health_check_interval_);
 +    return;
 +  }
 +
-+  LOG(WARNING) << "browseros: Health check failed, restarting";
++  consecutive_health_failures_++;
++  if (consecutive_health_failures_ < kMaxConsecutiveHealthFailures) {
++    health_check_interval_ = kHealthCheckRetryInterval;
++    health_check_timeout_ =
++        std::min(health_check_timeout_ * 2, kHealthCheckMaxTimeout);
++    LOG(WARNING) << "browseros: Health check failed ("
++                 << consecutive_health_failures_ << "/"
++                 << kMaxConsecutiveHealthFailures << "), retrying in "
++                 << health_check_interval_.InSeconds() << "s";
++    ScheduleHealthCheck(health_check_interval_);
++    return;
++  }
++
++  LOG(WARNING) << "browseros: " << consecutive_health_failures_
++               << " consecutive health checks failed, restarting";
++  browseros_metrics::BrowserOSMetrics::Log(
++      "server.health.restart",
++      {{"failures", base::Value(consecutive_health_failures_)},
++       {"latency_ms",
++        base::Value(health_check_latency_.InMillisecondsF())}});
++  consecutive_health_failures_ = 0;
 +  RestartBrowserOSProcess();
 +}
 +
@@ -812,7 +1560,11 @@ index 0000000000000..6d44b32b78ce8
 +  is_restarting_ = true;
 +
 +  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  readiness_probe_timer_.Stop();
++  StopWatchingProcess();
++  StopWorkers();
++  // 503 until the replacement is ready
++  SetProxyBackend(0, base::FilePath());
 +
 +  TerminateBrowserOSProcess(
 +      base::BindOnce(&BrowserOSServerManager::ContinueRestartAfterTerminate,
@@ -844,34 +1596,8 @@ index 0000000000000..6d44b32b78ce8
 +            if (!weak_manager) {
 +              return;
 +            }
-+            auto* manager = weak_manager.get();
-+
 +            // Pick new ephemeral ports for server and extension
-+            // (unless CLI-overridden)
-+            base::CommandLine* cl =
-+                base::CommandLine::ForCurrentProcess();
-+            std::set<int> assigned;
-+            assigned.insert(manager->ports_.cdp);
-+            assigned.insert(manager->ports_.proxy);
-+
-+            if (!cl->HasSwitch(browseros::kServerPort)) {
-+              manager->ports_.server =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultServerPort, assigned);
-+            }
-+            assigned.insert(manager->ports_.server);
-+
-+            if (!cl->HasSwitch(browseros::kExtensionPort)) {
-+              manager->ports_.extension =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultExtensionPort, assigned);
-+            }
-+
-+            LOG(INFO) << "browseros: New ephemeral ports - "
-+                      << manager->ports_.DebugString();
-+
-+            manager->SavePortsToPrefs();
-+            manager->LaunchBrowserOSProcess();
++            weak_manager->ResolvePortsForRestart();
 +          },
 +          weak_factory_.GetWeakPtr()));
 +}
@@ -889,15 +1615,237 @@ index 0000000000000..6d44b32b78ce8
 +  is_updating_ = true;
 +  update_complete_callback_ = std::move(callback);
 +
++  // Fixed backend ports can't be shared by two servers at once
++  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
++  if (process_.IsValid() && server_ready_ && !retiring_process_.IsValid() &&
++      !command_line->HasSwitch(browseros::kServerPort) &&
++      !command_line->HasSwitch(browseros::kExtensionPort)) {
++    StartStandbyServer();
++    return;
++  }
++
 +  is_restarting_ = true;
 +  health_check_timer_.Stop();
-+  process_check_timer_.Stop();
++  readiness_probe_timer_.Stop();
++  StopWatchingProcess();
++  StopWorkers();
++  // 503 until the replacement is ready
++  SetProxyBackend(0, base::FilePath());
 +
 +  TerminateBrowserOSProcess(
 +      base::BindOnce(&BrowserOSServerManager::ContinueUpdateAfterTerminate,
 +                     weak_factory_.GetWeakPtr()));
 +}
 +
++void BrowserOSServerManager::FinishUpdate(bool success) {
++  is_updating_ = false;
++  if (update_complete_callback_) {
++    std::move(update_complete_callback_).Run(success);
++  }
++}
++
++// static
++ServerPorts BrowserOSServerManager::ProbeStandbyPorts(ServerPorts ports) {
++  std::set<int> excluded = {ports.cdp, ports.proxy, ports.server,
++                            ports.extension};
++  ports.server = server_utils::FindAvailablePort(
++      browseros_server::kDefaultServerPort, excluded);
++  excluded.insert(ports.server);
++  ports.extension = server_utils::FindAvailablePort(
++      browseros_server::kDefaultExtensionPort, excluded);
++  return ports;
++}
++
++void BrowserOSServerManager::StartStandbyServer() {
++  LOG(INFO) << "browseros: Starting updated server next to the running one";
++  standby_starting_ = true;
++  // The standby probes share the health checker
++  health_check_timer_.Stop();
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(&BrowserOSServerManager::ProbeStandbyPorts, ports_),
++      base::BindOnce(&BrowserOSServerManager::OnStandbyPortsResolved,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnStandbyPortsResolved(ServerPorts ports) {
++  if (!standby_starting_) {
++    return;
++  }
++
++  standby_ports_ = ports;
++  ServerLaunchConfig config = BuildLaunchConfig();
++  config.ports = standby_ports_;
++  config.paths.backend_socket =
++      GetStandbySocketPath(config.paths.backend_socket, backend_socket_);
++  standby_socket_ = config.paths.backend_socket;
++
++  LOG(INFO) << "browseros: Launching standby server - "
++            << standby_ports_.DebugString();
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(&ProcessController::Launch,
++                     base::Unretained(process_controller_.get()), config),
++      base::BindOnce(&BrowserOSServerManager::OnStandbyLaunched,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnStandbyLaunched(LaunchResult result) {
++  if (!standby_starting_) {
++    // Aborted while launching
++    process_controller_->Terminate(&result.process, /*wait=*/false);
++    return;
++  }
++
++  if (result.used_fallback && updater_) {
++    updater_->InvalidateDownloadedVersion();
++  }
++
++  if (!result.process.IsValid()) {
++    LOG(ERROR) << "browseros: Failed to launch updated server, keeping the "
++                  "running one";
++    AbortStandby();
++    FinishUpdate(false);
++    return;
++  }
++
++  standby_process_ = std::move(result.process);
++  standby_launch_time_ = base::TimeTicks::Now();
++  standby_probe_delay_ = kReadinessProbeInitialDelay;
++  standby_probe_timer_.Start(FROM_HERE, standby_probe_delay_, this,
++                             &BrowserOSServerManager::ProbeStandby);
++}
++
++void BrowserOSServerManager::ProbeStandby() {
++  if (!standby_process_.IsValid()) {
++    return;
++  }
++
++  if (base::TimeTicks::Now() - standby_launch_time_ >= kStartupGracePeriod) {
++    LOG(WARNING) << "browseros: Updated server not healthy after "
++                 << kStartupGracePeriod.InSeconds()
++                 << "s, keeping the running one";
++    AbortStandby();
++    FinishUpdate(false);
++    return;
++  }
++
++  health_checker_->CheckHealth(
++      standby_ports_.server,
++      base::BindOnce(&BrowserOSServerManager::OnStandbyProbeComplete,
++                     weak_factory_.GetWeakPtr(), standby_process_.Pid()));
++}
++
++void BrowserOSServerManager::OnStandbyProbeComplete(base::ProcessId pid,
++                                                    bool success) {
++  if (!standby_process_.IsValid() || standby_process_.Pid() != pid) {
++    return;
++  }
++
++  if (success) {
++    SwapToStandby();
++    return;
++  }
++
++  standby_probe_delay_ =
++      std::min(standby_probe_delay_ * 2, kReadinessProbeMaxDelay);
++  standby_probe_timer_.Start(FROM_HERE, standby_probe_delay_, this,
++                             &BrowserOSServerManager::ProbeStandby);
++}
++
++void BrowserOSServerManager::SwapToStandby() {
++  LOG(INFO) << "browseros: Updated server ready after "
++            << (base::TimeTicks::Now() - standby_launch_time_).InMilliseconds()
++            << "ms, switching proxy to port " << standby_ports_.server;
++  standby_starting_ = false;
++  standby_probe_timer_.Stop();
++
++  health_check_timer_.Stop();
++  readiness_probe_timer_.Stop();
++  StopWatchingProcess();
++  StopWorkers();
++
++  retiring_process_ = std::move(process_);
++  retiring_port_ = ports_.server;
++
++  ports_.server = standby_ports_.server;
++  ports_.extension = standby_ports_.extension;
++  backend_socket_ = standby_socket_;
++  SavePortsToPrefs();
++
++  AdoptServerProcess(std::move(standby_process_), standby_launch_time_);
++  OnServerReady();
++
++  // Requests the old server already has finish there before it stops
++  if (server_proxy_) {
++    content::GetIOThreadTaskRunner({})->PostTask(
++        FROM_HERE,
++        base::BindOnce(
++            &BrowserOSServerProxy::DrainPreviousBackend,
++            base::Unretained(server_proxy_.get()), kUpdateDrainTimeout,
++            base::BindPostTaskToCurrentDefault(
++                base::BindOnce(&BrowserOSServerManager::RetireServerProcess,
++                               weak_factory_.GetWeakPtr()))));
++  } else {
++    RetireServerProcess();
++  }
++
++  FinishUpdate(true);
++}
++
++void BrowserOSServerManager::AbortStandby() {
++  standby_starting_ = false;
++  standby_probe_timer_.Stop();
++  if (standby_process_.IsValid()) {
++    process_controller_->Terminate(&standby_process_, /*wait=*/false);
++    standby_process_ = base::Process();
++  }
++
++  // Back to checking the server that keeps running
++  if (is_running_ && process_.IsValid()) {
++    ScheduleHealthCheck(health_check_interval_);
++  }
++}
++
++void BrowserOSServerManager::RetireServerProcess() {
++  if (!retiring_process_.IsValid()) {
++    return;
++  }
++
++  LOG(INFO) << "browseros: Stopping previous server (PID: "
++            << retiring_process_.Pid() << ")";
++  health_checker_->RequestShutdown(
++      retiring_port_,
++      base::BindOnce(&BrowserOSServerManager::OnRetiringShutdownRequested,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnRetiringShutdownRequested(bool http_success) {
++  if (!retiring_process_.IsValid()) {
++    return;
++  }
++
++  base::ThreadPool::PostTask(
++      FROM_HERE,
++      {base::MayBlock(), base::WithBaseSyncPrimitives(),
++       base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(
++          [](ProcessController* process_controller, base::Process process,
++             bool http_success) {
++            int exit_code = 0;
++            if (!http_success ||
++                !process_controller->WaitForExitWithTimeout(
++                    &process, kRetiringExitTimeout, &exit_code)) {
++              process_controller->Terminate(&process, /*wait=*/true);
++            }
++          },
++          base::Unretained(process_controller_.get()),
++          std::move(retiring_process_), http_success));
++  retiring_process_ = base::Process();
++  retiring_port_ = 0;
++}
++
 +void BrowserOSServerManager::ContinueUpdateAfterTerminate() {
 +  base::ThreadPool::PostTaskAndReply(
 +      FROM_HERE,
@@ -923,29 +1871,8 @@ index 0000000000000..6d44b32b78ce8
 +            if (!weak_manager) {
 +              return;
 +            }
-+            auto* manager = weak_manager.get();
-+
-+            base::CommandLine* cl =
-+                base::CommandLine::ForCurrentProcess();
-+            std::set<int> assigned;
-+            assigned.insert(manager->ports_.cdp);
-+            assigned.insert(manager->ports_.proxy);
-+
-+            if (!cl->HasSwitch(browseros::kServerPort)) {
-+              manager->ports_.server =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultServerPort, assigned);
-+            }
-+            assigned.insert(manager->ports_.server);
-+
-+            if (!cl->HasSwitch(browseros::kExtensionPort)) {
-+              manager->ports_.extension =
-+                  server_utils::FindAvailablePort(
-+                      browseros_server::kDefaultExtensionPort, assigned);
-+            }
-+
-+            manager->SavePortsToPrefs();
-+            manager->LaunchBrowserOSProcess();
++            // Pick new ephemeral ports for server and extension
++            weak_manager->ResolvePortsForRestart();
 +          },
 +          weak_factory_.GetWeakPtr()));
 +}
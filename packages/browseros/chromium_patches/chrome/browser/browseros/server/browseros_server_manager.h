@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager.h b/chrome/browser/browseros/server/browseros_server_manager.h
 new file mode 100644
-index 0000000000000..241343e436f94
+index 0000000000000..5fc4cc5eeaee9
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager.h
-@@ -0,0 +1,158 @@
+@@ -0,0 +1,321 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,17 +12,24 @@ index 0000000000000..241343e436f94
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_MANAGER_H_
 +
 +#include <memory>
++#include <optional>
 +#include <set>
++#include <string>
++#include <vector>
 +
 +#include "base/files/file.h"
 +#include "base/files/file_path.h"
++#include "base/functional/callback_helpers.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/no_destructor.h"
 +#include "base/process/process.h"
++#include "base/threading/sequence_bound.h"
 +#include "base/timer/timer.h"
 +#include "chrome/browser/browseros/server/browseros_server_config.h"
++#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +#include "chrome/browser/browseros/server/process_controller.h"
++#include "chrome/browser/browseros/server/process_exit_watcher.h"
 +
 +class PrefChangeRegistrar;
 +class PrefService;
@@ -31,8 +38,13 @@ index 0000000000000..241343e436f94
 +class BrowserOSServerUpdater;
 +}
 +
++namespace net {
++class TCPServerSocket;
++}  // namespace net
++
 +namespace browseros {
 +class BrowserOSServerProxy;
++class BrowserOSServerWorkers;
 +class HealthChecker;
 +class ProcessController;
 +class ServerStateStore;
@@ -80,7 +92,8 @@ index 0000000000000..241343e436f94
 +
 +  void Shutdown();
 +
-+  // Health check result handler (public for testing)
++  // Health check result handler (public for testing). The server is
++  // restarted after several consecutive failures.
 +  void OnHealthCheckComplete(bool success);
 +
 +  void SetRunningForTesting(bool running) { is_running_ = running; }
@@ -88,21 +101,70 @@ index 0000000000000..241343e436f94
 +  base::FilePath GetBrowserOSServerExecutablePath() const;
 +  base::FilePath GetBrowserOSServerResourcesPath() const;
 +
++  // Switches to the updated server binary, without downtime when a ready
++  // server is running. |callback| reports whether the new server runs.
 +  using UpdateCompleteCallback = base::OnceCallback<void(bool success)>;
 +  void RestartServerForUpdate(UpdateCompleteCallback callback);
 +
 + private:
 +  friend base::NoDestructor<BrowserOSServerManager>;
 +
++  // Ports taken as given instead of probed
++  struct FixedPorts {
++    bool cdp = false;
++    bool proxy = false;
++    bool server = false;
++    bool extension = false;
++  };
++
++  // Ports picked off the UI thread. |proxy_socket| is already listening on
++  // |ports.proxy| when the proxy port was resolved too.
++  struct ResolvedPorts {
++    ResolvedPorts();
++    ResolvedPorts(ResolvedPorts&&);
++    ResolvedPorts& operator=(ResolvedPorts&&);
++    ~ResolvedPorts();
++
++    ServerPorts ports;
++    std::unique_ptr<net::TCPServerSocket> proxy_socket;
++  };
++
 +  BrowserOSServerManager();
 +  ~BrowserOSServerManager();
 +
++  // Startup is staged: Start() only loads the ports and reserves the proxy
++  // (MCP) port, so clients can connect right away and are served once the
++  // server is up. The lock, orphan recovery, the remaining ports and the
++  // launch wait for a best-effort task after browser startup.
++  void ReserveProxyPort();
++  static ResolvedPorts BindProxyPort(ServerPorts ports, bool fixed);
++  void OnProxyPortReserved(ResolvedPorts resolved);
++  void StartDeferred();
++
 +  bool AcquireLock();
-+  bool RecoverFromOrphan();
++  // Deletes the state file of a server left by a crashed browser and kills
++  // that server in the background, then continues startup without waiting
++  // for it to exit.
++  void RecoverFromOrphan();
++  // Returns the PID to kill, if the state file names a live orphan. Blocking.
++  static std::optional<base::ProcessId> ClaimOrphan(
++      ServerStateStore* state_store);
++  void OnOrphanClaimed(std::optional<base::ProcessId> orphan_pid);
 +
 +  void LoadPortsFromPrefs();
 +  void SetupPrefObservers();
-+  void ResolvePortsForStartup();
++  // Probes for free ports on a background sequence, keeping the ones in
++  // |fixed|, then stores and saves them and runs |then|. With |bind_proxy|
++  // the proxy's listening socket is bound as part of the probe.
++  void ResolvePorts(FixedPorts fixed,
++                    bool bind_proxy,
++                    base::OnceClosure then);
++  static ResolvedPorts ProbePorts(ServerPorts ports,
++                                  FixedPorts fixed,
++                                  bool bind_proxy);
++  void OnPortsResolved(base::OnceClosure then, ResolvedPorts resolved);
++  void ResolvePortsForRestart();
++  void OnStartupPortsResolved();
 +  void ApplyCommandLineOverrides();
 +  void SavePortsToPrefs();
 +  void StartCDPServer();
@@ -122,27 +184,95 @@ index 0000000000000..241343e436f94
 +  void RestartBrowserOSProcess();
 +  void ContinueRestartAfterTerminate();
 +  void ContinueUpdateAfterTerminate();
++  void FinishUpdate(bool success);
++
++  // Zero-downtime update: the new version starts next to the running server
++  // on fresh backend ports. Once it answers /health the proxy switches to
++  // it, and the old server is shut down after its in-flight requests drain.
++  // Falls back to stop-then-start when the backend ports are fixed or no
++  // ready server is running.
++  static ServerPorts ProbeStandbyPorts(ServerPorts ports);
++  void StartStandbyServer();
++  void OnStandbyPortsResolved(ServerPorts ports);
++  void OnStandbyLaunched(LaunchResult result);
++  void ProbeStandby();
++  void OnStandbyProbeComplete(base::ProcessId pid, bool success);
++  void SwapToStandby();
++  // Terminates the standby server, if any, and keeps the running one
++  void AbortStandby();
++  void RetireServerProcess();
++  void OnRetiringShutdownRequested(bool http_success);
++
++  // Makes |process| the managed server and starts watching it
++  void AdoptServerProcess(base::Process process, base::TimeTicks launch_time);
 +
 +  void OnProcessExited(int exit_code);
++  void ScheduleHealthCheck(base::TimeDelta delay);
++  // Skips the /health probe when the proxy relayed traffic recently enough
 +  void CheckServerHealth();
++  void OnProxyBackendActivity();
 +  void OnAllowRemoteInMCPChanged();
 +  void OnRestartServerRequestedChanged();
 +  void CheckProcessStatus();
 +
++  // Probes /health with backoff after launch until the server answers, then
++  // points the proxy at it. Gives up waiting after kStartupGracePeriod.
++  void StartReadinessProbe();
++  void ProbeReadiness();
++  void OnReadinessProbeComplete(base::ProcessId pid, bool success);
++  void OnServerReady();
++  void SetProxyBackend(int port, const base::FilePath& socket_path);
++
++  // Extra server workers (--browseros-server-workers) follow the primary:
++  // they are launched once it is ready and stopped whenever it stops.
++  void StartWorkers();
++  void StopWorkers();
++  void SetProxyWorkers(std::vector<int> ports);
++
++  // Watches the launched process so exits are handled as soon as they
++  // happen; the process check timer stays on as a slower fallback.
++  void WatchProcessExit();
++  void OnProcessExitWatchStarted(bool watching);
++  void StopWatchingProcess();
++
++  // Samples the server's memory and CPU for metrics, and restarts it when it
++  // exceeds its memory limit where the OS doesn't enforce one.
++  void SampleServerResources();
++  void OnServerResourcesSampled(
++      base::ProcessId pid,
++      std::optional<server_utils::ProcessResourceUsage> usage);
++
 +  base::FilePath GetBrowserOSExecutionDir() const;
 +
 +  std::unique_ptr<ProcessController> process_controller_;
 +  std::unique_ptr<ServerStateStore> state_store_;
 +  std::unique_ptr<HealthChecker> health_checker_;
 +  std::unique_ptr<BrowserOSServerProxy> server_proxy_;
++  // Runs BrowserOSServerProxy::ReleaseMemory() on memory pressure while
++  // the proxy is up
++  base::ScopedClosureRunner proxy_memory_pressure_registration_;
++  // Reports GetStats() to chrome://browseros-internals while the proxy is up
++  base::ScopedClosureRunner proxy_profiler_registration_;
++  std::unique_ptr<BrowserOSServerWorkers> workers_;
++  // Bound during startup port resolution, consumed by StartProxy()
++  std::unique_ptr<net::TCPServerSocket> pending_proxy_socket_;
 +
 +  raw_ptr<PrefService> local_state_ = nullptr;
 +
 +  base::File lock_file_;
 +  base::Process process_;
 +  ServerPorts ports_;
++  // Unix domain socket of the running backend, empty when TCP only
++  base::FilePath backend_socket_;
 +  bool allow_remote_in_mcp_ = false;
++  // Handed to the sidecar for the proxy's /browseros/call/ route
++  const std::string direct_call_token_;
 +  bool is_running_ = false;
++  // Between Start() and StartDeferred()
++  bool start_pending_ = false;
++  // Start() time until the server is first ready, to report time-to-MCP-
++  // ready apart from browser startup
++  base::TimeTicks start_time_;
 +  bool is_restarting_ = false;
 +  bool is_updating_ = false;
 +  UpdateCompleteCallback update_complete_callback_;
@@ -150,8 +280,41 @@ index 0000000000000..241343e436f94
 +  int consecutive_startup_failures_ = 0;
 +  base::TimeTicks last_launch_time_;
 +
-+  base::RepeatingTimer health_check_timer_;
++  // Adaptive health checking; reset on every launch
++  base::OneShotTimer health_check_timer_;
++  base::TimeDelta health_check_interval_;
++  base::TimeDelta health_check_timeout_;
++  // Smoothed latency of passing checks
++  base::TimeDelta health_check_latency_;
++  base::TimeTicks health_check_start_time_;
++  int consecutive_health_failures_ = 0;
++  // Last successful response relayed by the proxy from the primary backend
++  base::TimeTicks last_backend_activity_;
++  base::OneShotTimer readiness_probe_timer_;
++  base::TimeDelta readiness_probe_delay_;
++  bool server_ready_ = false;
 +  base::RepeatingTimer process_check_timer_;
++  base::SequenceBound<ProcessExitWatcher> exit_watcher_;
++
++  bool standby_starting_ = false;
++  base::Process standby_process_;
++  ServerPorts standby_ports_;
++  base::FilePath standby_socket_;
++  base::TimeTicks standby_launch_time_;
++  base::OneShotTimer standby_probe_timer_;
++  base::TimeDelta standby_probe_delay_;
++  // Previous server after an update, until its requests have drained
++  base::Process retiring_process_;
++  int retiring_port_ = 0;
++
++  // From the command line, applied to every launch
++  ServerResourceLimits resource_limits_;
++  base::RepeatingTimer resource_sample_timer_;
++  struct ResourceSample {
++    base::TimeTicks time;
++    base::TimeDelta cpu_time;
++  };
++  ResourceSample last_resource_sample_;
 +
 +  std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
 +  std::unique_ptr<ServerUpdater> updater_;
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager_unittest.cc b/chrome/browser/browseros/server/browseros_server_manager_unittest.cc
 new file mode 100644
-index 0000000000000..8f97e0b97467f
+index 0000000000000..cc8f78768a417
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager_unittest.cc
-@@ -0,0 +1,497 @@
+@@ -0,0 +1,514 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -120,9 +120,24 @@ index 0000000000000..8f97e0b97467f
 +TEST_F(BrowserOSServerManagerTest, HealthCheckFail_TriggersRestart) {
 +  manager_->SetRunningForTesting(true);
 +
-+  // Single health check failure should trigger restart
++  // Three consecutive failures should trigger restart
++  for (int i = 0; i < 3; ++i) {
++    manager_->OnHealthCheckComplete(false);
++  }
++  // is_restarting_ is now true (verified indirectly: next call is ignored)
++  manager_->OnHealthCheckComplete(false);
++}
++
++TEST_F(BrowserOSServerManagerTest, HealthCheckSingleFailure_DoesNotRestart) {
++  manager_->SetRunningForTesting(true);
++
++  EXPECT_CALL(*health_checker_, RequestShutdown(_, _)).Times(0);
++  EXPECT_CALL(*process_controller_, Terminate(_, _)).Times(0);
++
++  // A failure between passing checks only tightens the interval
++  manager_->OnHealthCheckComplete(false);
 +  manager_->OnHealthCheckComplete(false);
-+  // is_restarting_ is now true (verified indirectly: second call is ignored)
++  manager_->OnHealthCheckComplete(true);
 +  manager_->OnHealthCheckComplete(false);
 +}
 +
@@ -454,8 +469,10 @@ index 0000000000000..8f97e0b97467f
 +  ON_CALL(*process_controller_, WaitForExitWithTimeout(_, _, _))
 +      .WillByDefault(Return(true));
 +
-+  // Trigger restart via health check failure
-+  manager_->OnHealthCheckComplete(false);
++  // Trigger restart via consecutive health check failures
++  for (int i = 0; i < 3; ++i) {
++    manager_->OnHealthCheckComplete(false);
++  }
 +
 +  // Run all pending tasks (thread pool + reply)
 +  task_environment_.RunUntilIdle();
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_prefs.h b/chrome/browser/browseros/server/browseros_server_prefs.h
 new file mode 100644
-index 0000000000000..69bd172f9ce25
+index 0000000000000..54977dd1726bc
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_prefs.h
-@@ -0,0 +1,36 @@
+@@ -0,0 +1,37 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -29,6 +29,7 @@ index 0000000000000..69bd172f9ce25
 +extern const char kAllowRemoteInMCP[];
 +extern const char kRestartServerRequested[];
 +extern const char kServerVersion[];
++extern const char kServerAppcastCache[];
 +
 +// Deprecated prefs (kept for migration, will be removed in future)
 +extern const char kMCPServerPort[];       // DEPRECATED: migrated to kProxyPort
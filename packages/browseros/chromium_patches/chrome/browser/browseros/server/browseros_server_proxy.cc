@@ -1,32 +1,42 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_proxy.cc b/chrome/browser/browseros/server/browseros_server_proxy.cc
 new file mode 100644
-index 0000000000000..7ffdb8f011b08
+index 0000000000000..58480d42ccc7a
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_proxy.cc
-@@ -0,0 +1,225 @@
+@@ -0,0 +1,1064 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_proxy.h"
 +
++#include <algorithm>
 +#include <optional>
++#include <string_view>
 +
++#include "base/containers/contains.h"
 +#include "base/functional/bind.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
 +#include "base/logging.h"
-+#include "base/strings/string_number_conversions.h"
++#include "base/memory/raw_ptr.h"
++#include "base/strings/string_util.h"
++#include "base/strings/stringprintf.h"
++#include "base/task/bind_post_task.h"
++#include "base/time/time.h"
++#include "chrome/browser/browseros/server/browseros_devtools_session.h"
++#include "chrome/browser/browseros/server/browseros_websocket_tunnel.h"
++#include "crypto/secure_util.h"
 +#include "net/base/ip_address.h"
 +#include "net/base/net_errors.h"
++#include "net/base/url_util.h"
++#include "net/http/http_response_headers.h"
 +#include "net/http/http_status_code.h"
 +#include "net/log/net_log_source.h"
 +#include "net/server/http_server_request_info.h"
 +#include "net/server/http_server_response_info.h"
 +#include "net/socket/tcp_server_socket.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
-+#include "services/network/public/cpp/resource_request.h"
-+#include "services/network/public/cpp/shared_url_loader_factory.h"
-+#include "services/network/public/cpp/simple_url_loader.h"
-+#include "services/network/public/mojom/url_response_head.mojom.h"
 +#include "url/gurl.h"
 +
 +namespace browseros {
@@ -34,7 +44,45 @@ index 0000000000000..7ffdb8f011b08
 +namespace {
 +
 +constexpr int kBackLog = 10;
-+constexpr size_t kMaxResponseBodySize = 5 * 1024 * 1024;  // 5 MB
++
++constexpr char kStatsPath[] = "/browseros/stats";
++
++constexpr char kDirectCallPathPrefix[] = "/browseros/call/";
++constexpr char kDirectCallTokenHeader[] = "x-browseros-token";
++// Set to kSharedPayloadValue to have the result written to a payload file
++constexpr char kDirectCallPayloadHeader[] = "x-browseros-payload";
++constexpr char kSharedPayloadValue[] = "shared";
++
++constexpr char kDevToolsPath[] = "/browseros/devtools";
++
++constexpr char kMcpPath[] = "/mcp";
++
++constexpr base::TimeDelta kBackendRequestTimeout = base::Seconds(300);
++
++// Covers a restart or OTA hot-swap of the sidecar
++constexpr base::TimeDelta kDefaultRequestHoldTime = base::Seconds(15);
++
++// Requests beyond this while no backend is set get 503 right away
++constexpr size_t kMaxHeldRequests = 64;
++
++// Upper bound on response bytes queued for a connection that the client has
++// not read yet. net::HttpServer drops writes beyond its per-connection send
++// buffer, so streamed responses raise it to this size.
++constexpr int kMaxQueuedResponseBytes = 16 * 1024 * 1024;  // 16 MB
++
++// Session routes beyond this are dropped wholesale; clients whose session
++// then lands on the wrong backend re-initialize
++constexpr size_t kMaxTrackedSessions = 4096;
++
++// Successful backend exchanges are reported to the manager at most this
++// often; they stand in for its /health probes while traffic flows
++constexpr base::TimeDelta kBackendActivityReportInterval = base::Seconds(10);
++
++// Backend response headers relayed to the client besides Content-Type
++constexpr const char* kForwardedResponseHeaders[] = {
++    "cache-control",
++    "mcp-session-id",
++};
 +
 +net::NetworkTrafficAnnotationTag GetProxyTrafficAnnotation() {
 +  return net::DefineNetworkTrafficAnnotation("browseros_mcp_proxy", R"(
@@ -63,7 +111,127 @@ index 0000000000000..7ffdb8f011b08
 +
 +}  // namespace
 +
-+BrowserOSServerProxy::BrowserOSServerProxy() = default;
++class BrowserOSServerProxy::BackendStream
++    : public BrowserOSBackendRequest::Delegate {
++ public:
++  BackendStream(BrowserOSServerProxy* proxy,
++                int connection_id,
++                BrowserOSBackendConnectionPool* backend,
++                ProxyRequestRecord record)
++      : proxy_(proxy),
++        connection_id_(connection_id),
++        backend_(backend),
++        backend_generation_(backend->generation()),
++        request_(backend, this, GetProxyTrafficAnnotation()),
++        record_(std::move(record)) {
++    proxy_->stats_.RecordStarted(record_.route);
++  }
++
++  BackendStream(const BackendStream&) = delete;
++  BackendStream& operator=(const BackendStream&) = delete;
++  ~BackendStream() override {
++    record_.completed_at = base::TimeTicks::Now();
++    proxy_->stats_.RecordFinished(record_);
++  }
++
++  BrowserOSBackendRequest& request() { return request_; }
++  void MarkDispatched() { record_.dispatched_at = base::TimeTicks::Now(); }
++  BrowserOSBackendConnectionPool* backend() { return backend_; }
++  int backend_generation() const { return backend_generation_; }
++
++ private:
++  net::HttpServer* server() { return proxy_->server_.get(); }
++
++  // BrowserOSBackendRequest::Delegate:
++  void OnResponseStarted(
++      scoped_refptr<net::HttpResponseHeaders> headers) override {
++    if (!server()) {
++      return;
++    }
++
++    record_.status = headers->response_code();
++    net::HttpServerResponseInfo response(
++        static_cast<net::HttpStatusCode>(headers->response_code()));
++    response.AddHeader(
++        "Content-Type",
++        headers->GetNormalizedHeader("content-type")
++            .value_or("application/json"));
++    for (const char* name : kForwardedResponseHeaders) {
++      std::optional<std::string> value = headers->GetNormalizedHeader(name);
++      if (value.has_value()) {
++        response.AddHeader(name, *value);
++      }
++    }
++    std::optional<std::string> session_id =
++        headers->GetNormalizedHeader("mcp-session-id");
++    if (session_id.has_value()) {
++      proxy_->BindSession(*session_id, backend_);
++    }
++    response.AddHeader("Transfer-Encoding", "chunked");
++
++    server()->SetSendBufferSize(connection_id_, kMaxQueuedResponseBytes);
++    server()->SendRaw(connection_id_, response.Serialize(),
++                      GetProxyTrafficAnnotation());
++    headers_sent_ = true;
++  }
++
++  void OnResponseData(std::string_view data) override {
++    if (!headers_sent_ || !server()) {
++      // Nothing to relay to; dropping the stream cancels the request
++      proxy_->OnStreamComplete(connection_id_, /*close_connection=*/true);
++      return;
++    }
++
++    record_.response_bytes += data.size();
++    std::string chunk = base::StringPrintf("%zX\r\n", data.size());
++    chunk.append(data);
++    chunk.append("\r\n");
++    server()->SendRaw(connection_id_, chunk, GetProxyTrafficAnnotation());
++  }
++
++  void OnResponseComplete(bool success) override {
++    if (!server()) {
++      proxy_->OnStreamComplete(connection_id_, /*close_connection=*/false);
++      return;
++    }
++
++    if (!headers_sent_) {
++      // The backend never answered; nothing has been written yet
++      record_.status = net::HTTP_SERVICE_UNAVAILABLE;
++      record_.backend_error = true;
++      Send503(server(), connection_id_);
++      proxy_->OnStreamComplete(connection_id_, /*close_connection=*/false);
++      return;
++    }
++
++    if (!success) {
++      record_.backend_error = true;
++      // A truncated chunked body can only be signalled by closing
++      LOG(WARNING) << "browseros: Backend response failed mid-stream";
++      proxy_->OnStreamComplete(connection_id_, /*close_connection=*/true);
++      return;
++    }
++
++    server()->SendRaw(connection_id_, "0\r\n\r\n",
++                      GetProxyTrafficAnnotation());
++    if (backend_ == &proxy_->backend_connections_ &&
++        record_.status < net::HTTP_INTERNAL_SERVER_ERROR) {
++      proxy_->OnBackendActivity();
++    }
++    proxy_->OnStreamComplete(connection_id_, /*close_connection=*/false);
++  }
++
++  raw_ptr<BrowserOSServerProxy> proxy_;
++  const int connection_id_;
++  raw_ptr<BrowserOSBackendConnectionPool> backend_;
++  const int backend_generation_;
++  BrowserOSBackendRequest request_;
++  ProxyRequestRecord record_;
++  bool headers_sent_ = false;
++};
++
++BrowserOSServerProxy::BrowserOSServerProxy()
++    : hold_time_(kDefaultRequestHoldTime) {}
 +
 +BrowserOSServerProxy::~BrowserOSServerProxy() {
 +  Stop();
@@ -71,24 +239,24 @@ index 0000000000000..7ffdb8f011b08
 +
 +bool BrowserOSServerProxy::Start(
 +    int port,
-+    std::unique_ptr<network::PendingSharedURLLoaderFactory> pending_factory) {
++    std::unique_ptr<net::TCPServerSocket> listen_socket) {
 +  if (server_) {
 +    LOG(WARNING) << "browseros: Proxy already started on port " << bound_port_;
 +    return false;
 +  }
 +
-+  // Bind the cloned factory on this (IO) thread.
-+  url_loader_factory_ =
-+      network::SharedURLLoaderFactory::Create(std::move(pending_factory));
-+
-+  auto server_socket =
-+      std::make_unique<net::TCPServerSocket>(nullptr, net::NetLogSource());
-+  int result = server_socket->ListenWithAddressAndPort("0.0.0.0", port,
-+                                                        kBackLog);
-+  if (result != net::OK) {
-+    LOG(ERROR) << "browseros: Proxy failed to bind 0.0.0.0:" << port
-+               << " - " << net::ErrorToString(result);
-+    return false;
++  std::unique_ptr<net::TCPServerSocket> server_socket =
++      std::move(listen_socket);
++  if (!server_socket) {
++    server_socket =
++        std::make_unique<net::TCPServerSocket>(nullptr, net::NetLogSource());
++    int result =
++        server_socket->ListenWithAddressAndPort("0.0.0.0", port, kBackLog);
++    if (result != net::OK) {
++      LOG(ERROR) << "browseros: Proxy failed to bind 0.0.0.0:" << port
++                 << " - " << net::ErrorToString(result);
++      return false;
++    }
 +  }
 +
 +  server_ = std::make_unique<net::HttpServer>(std::move(server_socket), this);
@@ -99,18 +267,130 @@ index 0000000000000..7ffdb8f011b08
 +}
 +
 +void BrowserOSServerProxy::Stop() {
-+  pending_loaders_.clear();
++  weak_factory_.InvalidateWeakPtrs();
++  hold_timer_.Stop();
++  held_requests_.clear();
++  pending_streams_.clear();
++  FinishDrain();
++  tunnels_.clear();
++  devtools_sessions_.clear();
++  shared_payload_writer_.reset();
++  session_backends_.clear();
++  worker_connections_.clear();
++  fleet_reporter_.reset();
++  fleet_nodes_.Clear();
++  fleet_sessions_.Clear();
 +  if (server_) {
 +    LOG(INFO) << "browseros: Stopping MCP proxy on port " << bound_port_;
 +    server_.reset();
 +    bound_port_ = 0;
 +  }
-+  url_loader_factory_.reset();
++  backend_connections_.SetBackend(0, base::FilePath());
 +}
 +
-+void BrowserOSServerProxy::SetBackendPort(int port) {
++void BrowserOSServerProxy::SetBackend(int port,
++                                      const base::FilePath& socket_path) {
 +  backend_port_ = port;
-+  LOG(INFO) << "browseros: Proxy backend port set to " << port;
++  backend_connections_.SetBackend(port, socket_path);
++  LOG(INFO) << "browseros: Proxy backend set to port " << port
++            << (socket_path.empty() ? "" : ", socket ")
++            << socket_path.value();
++
++  if (backend_port_ > 0) {
++    ReplayHeldRequests();
++  }
++}
++
++void BrowserOSServerProxy::DrainPreviousBackend(base::TimeDelta timeout,
++                                                base::OnceClosure callback) {
++  FinishDrain();
++  drain_generation_ = backend_connections_.generation();
++  drain_callback_ = std::move(callback);
++  drain_timer_.Start(FROM_HERE, timeout, this,
++                     &BrowserOSServerProxy::FinishDrain);
++  MaybeFinishDrain();
++}
++
++void BrowserOSServerProxy::MaybeFinishDrain() {
++  if (!drain_callback_) {
++    return;
++  }
++  for (const auto& [connection_id, stream] : pending_streams_) {
++    if (stream->backend() == &backend_connections_ &&
++        stream->backend_generation() < drain_generation_) {
++      return;
++    }
++  }
++  FinishDrain();
++}
++
++void BrowserOSServerProxy::FinishDrain() {
++  drain_timer_.Stop();
++  if (drain_callback_) {
++    std::move(drain_callback_).Run();
++  }
++}
++
++void BrowserOSServerProxy::SetBackendActivityCallback(
++    base::RepeatingClosure callback) {
++  backend_activity_callback_ = std::move(callback);
++}
++
++void BrowserOSServerProxy::OnBackendActivity() {
++  if (!backend_activity_callback_) {
++    return;
++  }
++  const base::TimeTicks now = base::TimeTicks::Now();
++  if (!last_activity_report_.is_null() &&
++      now - last_activity_report_ < kBackendActivityReportInterval) {
++    return;
++  }
++  last_activity_report_ = now;
++  backend_activity_callback_.Run();
++}
++
++void BrowserOSServerProxy::SetWorkerBackends(const std::vector<int>& ports) {
++  std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>> kept;
++  std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>> dropped;
++  for (auto& pool : worker_connections_) {
++    if (base::Contains(ports, pool->port())) {
++      kept.push_back(std::move(pool));
++    } else {
++      dropped.push_back(std::move(pool));
++    }
++  }
++  for (int port : ports) {
++    if (!std::ranges::any_of(kept, [port](const auto& pool) {
++          return pool->port() == port;
++        })) {
++      auto pool = std::make_unique<BrowserOSBackendConnectionPool>();
++      pool->SetBackend(port, base::FilePath());
++      kept.push_back(std::move(pool));
++    }
++  }
++  worker_connections_ = std::move(kept);
++  DropBackends(std::move(dropped));
++
++  LOG(INFO) << "browseros: Proxy balancing across "
++            << worker_connections_.size() + 1 << " backend(s)";
++}
++
++void BrowserOSServerProxy::DropBackends(
++    std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>> dropped) {
++  for (const auto& pool : dropped) {
++    base::EraseIf(session_backends_, [&pool](const auto& session) {
++      return session.second == pool.get();
++    });
++    std::vector<int> connection_ids;
++    for (const auto& [connection_id, stream] : pending_streams_) {
++      if (stream->backend() == pool.get()) {
++        connection_ids.push_back(connection_id);
++      }
++    }
++    for (int connection_id : connection_ids) {
++      OnStreamComplete(connection_id, /*close_connection=*/true);
++    }
++  }
 +}
 +
 +void BrowserOSServerProxy::SetAllowRemote(bool allow) {
@@ -119,113 +399,672 @@ index 0000000000000..7ffdb8f011b08
 +            << (allow ? "true" : "false");
 +}
 +
++void BrowserOSServerProxy::SetDirectCallHandler(std::string token,
++                                                DirectCallHandler handler) {
++  direct_call_token_ = std::move(token);
++  direct_call_handler_ = std::move(handler);
++}
++
++void BrowserOSServerProxy::SetMcpFastPathEnabled(bool enabled) {
++  mcp_fast_path_enabled_ = enabled;
++  LOG(INFO) << "browseros: Proxy MCP fast path "
++            << (enabled ? "enabled" : "disabled");
++}
++
++void BrowserOSServerProxy::SetFleetConfig(const FleetConfig& config) {
++  fleet_reporter_.reset();
++  DropBackends(fleet_nodes_.TakeAll());
++  fleet_sessions_.Clear();
++  fleet_config_ = config;
++  if (fleet_config_.token.empty()) {
++    return;
++  }
++
++  LOG(INFO) << "browseros: Proxy fleet mode on, serving up to "
++            << fleet_config_.max_sessions << " session(s) locally";
++  if (fleet_config_.coordinator && server_) {
++    fleet_reporter_ = std::make_unique<BrowserOSFleetReporter>(
++        fleet_config_, bound_port_,
++        base::BindRepeating(&BrowserOSFleetSessions::CountActive,
++                            base::Unretained(&fleet_sessions_)));
++  }
++}
++
++void BrowserOSServerProxy::SetSharedPayloadDir(const base::FilePath& dir) {
++  shared_payload_writer_ = std::make_unique<BrowserOSSharedPayloadWriter>(dir);
++}
++
++void BrowserOSServerProxy::SetRequestHoldTime(base::TimeDelta hold_time) {
++  hold_time_ = hold_time;
++  LOG(INFO) << "browseros: Proxy request hold time set to "
++            << hold_time_.InSeconds() << "s";
++}
++
++ReleasedMemory BrowserOSServerProxy::ReleaseMemory() {
++  ReleasedMemory released;
++  released.items += backend_connections_.CloseIdleConnections();
++  for (auto& worker : worker_connections_) {
++    released.items += worker->CloseIdleConnections();
++  }
++  released.items += fleet_nodes_.CloseIdleConnections();
++  released.bytes += stats_.DropRecentRequests();
++  return released;
++}
++
 +void BrowserOSServerProxy::OnConnect(int connection_id) {}
 +
 +void BrowserOSServerProxy::OnHttpRequest(
 +    int connection_id,
 +    const net::HttpServerRequestInfo& info) {
-+  if (!allow_remote_ && !info.peer.address().IsLoopback()) {
-+    net::HttpServerResponseInfo response(net::HTTP_FORBIDDEN);
-+    response.SetBody("Remote connections not allowed", "text/plain");
-+    server_->SendResponse(connection_id, response,
-+                          GetProxyTrafficAnnotation());
-+    server_->Close(connection_id);
++  if (info.path == kStatsPath) {
++    ServeStats(connection_id, info);
++    return;
++  }
++
++  if (base::StartsWith(info.path, kDirectCallPathPrefix)) {
++    ServeDirectCall(connection_id, info);
++    return;
++  }
++
++  if (!CheckPeerAllowed(connection_id, info)) {
 +    return;
 +  }
 +
-+  ForwardRequest(connection_id, info);
++  if (info.path == kFleetRegisterPath) {
++    ServeFleetRegister(connection_id, info);
++    return;
++  }
++
++  if (MaybeServeMcpFastPath(connection_id, info)) {
++    return;
++  }
++
++  ForwardRequest(connection_id, info, base::TimeTicks::Now());
 +}
 +
 +void BrowserOSServerProxy::OnWebSocketRequest(
 +    int connection_id,
 +    const net::HttpServerRequestInfo& info) {
-+  server_->Close(connection_id);
++  if (info.path.substr(0, info.path.find('?')) == kDevToolsPath) {
++    AcceptDevToolsSession(connection_id, info);
++    return;
++  }
++
++  if (!CheckPeerAllowed(connection_id, info)) {
++    return;
++  }
++
++  if (backend_port_ <= 0) {
++    Send503(server_.get(), connection_id);
++    server_->Close(connection_id);
++    return;
++  }
++
++  auto tunnel = std::make_unique<BrowserOSWebSocketTunnel>(
++      base::BindRepeating(&BrowserOSServerProxy::OnTunnelMessage,
++                          base::Unretained(this), connection_id),
++      base::BindOnce(&BrowserOSServerProxy::OnTunnelClosed,
++                     base::Unretained(this), connection_id),
++      GetProxyTrafficAnnotation());
++  auto* tunnel_ptr = tunnel.get();
++  tunnels_[connection_id] = std::move(tunnel);
++  tunnel_ptr->Connect(
++      backend_connections_.CreateSocket(), backend_port_, info,
++      base::BindOnce(&BrowserOSServerProxy::OnTunnelConnected,
++                     base::Unretained(this), connection_id, info));
 +}
 +
 +void BrowserOSServerProxy::OnWebSocketMessage(int connection_id,
 +                                               std::string data) {
-+  server_->Close(connection_id);
++  if (auto session = devtools_sessions_.find(connection_id);
++      session != devtools_sessions_.end()) {
++    session->second->HandleMessage(data);
++    return;
++  }
++
++  auto it = tunnels_.find(connection_id);
++  if (it == tunnels_.end()) {
++    server_->Close(connection_id);
++    return;
++  }
++  it->second->Send(data);
 +}
 +
 +void BrowserOSServerProxy::OnClose(int connection_id) {
-+  pending_loaders_.erase(connection_id);
++  base::EraseIf(held_requests_, [connection_id](const HeldRequest& request) {
++    return request.connection_id == connection_id;
++  });
++  pending_streams_.erase(connection_id);
++  tunnels_.erase(connection_id);
++  devtools_sessions_.erase(connection_id);
++  MaybeFinishDrain();
 +}
 +
-+void BrowserOSServerProxy::ForwardRequest(
++bool BrowserOSServerProxy::CheckPeerAllowed(
 +    int connection_id,
 +    const net::HttpServerRequestInfo& info) {
-+  if (backend_port_ <= 0 || !url_loader_factory_) {
++  if (allow_remote_ || info.peer.address().IsLoopback()) {
++    return true;
++  }
++
++  net::HttpServerResponseInfo response(net::HTTP_FORBIDDEN);
++  response.SetBody("Remote connections not allowed", "text/plain");
++  server_->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
++  server_->Close(connection_id);
++  return false;
++}
++
++void BrowserOSServerProxy::OnTunnelConnected(
++    int connection_id,
++    const net::HttpServerRequestInfo& info,
++    bool connected) {
++  if (!server_) {
++    return;
++  }
++
++  if (!connected) {
++    tunnels_.erase(connection_id);
 +    Send503(server_.get(), connection_id);
++    server_->Close(connection_id);
 +    return;
 +  }
 +
-+  GURL backend_url("http://127.0.0.1:" + base::NumberToString(backend_port_) +
-+                    info.path);
++  server_->AcceptWebSocket(connection_id, info, GetProxyTrafficAnnotation());
++}
++
++void BrowserOSServerProxy::OnTunnelMessage(int connection_id,
++                                           std::string message) {
++  if (server_) {
++    server_->SendOverWebSocket(connection_id, message,
++                               GetProxyTrafficAnnotation());
++  }
++}
 +
-+  auto resource_request = std::make_unique<network::ResourceRequest>();
-+  resource_request->url = backend_url;
-+  resource_request->method = info.method;
-+  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++void BrowserOSServerProxy::OnTunnelClosed(int connection_id) {
++  tunnels_.erase(connection_id);
++  if (server_) {
++    server_->Close(connection_id);
++  }
++}
++
++void BrowserOSServerProxy::ForwardRequest(
++    int connection_id,
++    const net::HttpServerRequestInfo& info,
++    base::TimeTicks received_at) {
++  if (!server_) {
++    return;
++  }
++  if (backend_port_ <= 0) {
++    if (!HoldRequest(connection_id, info, received_at)) {
++      RejectRequest(connection_id, info, received_at);
++    }
++    return;
++  }
 +
++  std::vector<std::pair<std::string, std::string>> headers;
 +  for (const auto& [name, value] : info.headers) {
-+    if (name == "content-type" || name == "accept" || name == "authorization") {
-+      resource_request->headers.SetHeader(name, value);
++    if (name == "content-type" || name == "accept" ||
++        name == "authorization" || name == "mcp-session-id" ||
++        name == "last-event-id") {
++      headers.emplace_back(name, value);
 +    }
 +  }
 +
-+  auto loader = network::SimpleURLLoader::Create(std::move(resource_request),
-+                                                  GetProxyTrafficAnnotation());
++  ProxyRequestRecord record;
++  record.route = stats_.GetRoute(info.method, info.path);
++  record.received_at = received_at;
++  record.request_bytes = info.data.size();
 +
-+  if (!info.data.empty()) {
-+    loader->AttachStringForUpload(info.data);
++  auto stream = std::make_unique<BackendStream>(
++      this, connection_id, SelectBackend(info), std::move(record));
++  auto* stream_ptr = stream.get();
++  pending_streams_[connection_id] = std::move(stream);
++  stream_ptr->MarkDispatched();
++  stream_ptr->request().Start(info.method, info.path, headers, info.data,
++                              kBackendRequestTimeout);
++}
++
++BrowserOSBackendConnectionPool* BrowserOSServerProxy::SelectBackend(
++    const net::HttpServerRequestInfo& info) {
++  auto session = info.headers.find("mcp-session-id");
++  if (session != info.headers.end()) {
++    auto it = session_backends_.find(session->second);
++    // Sessions not seen by the proxy are the primary's
++    return it != session_backends_.end() ? it->second.get()
++                                         : &backend_connections_;
++  }
++
++  if (BrowserOSBackendConnectionPool* node = SelectFleetNode()) {
++    return node;
++  }
++  if (worker_connections_.empty()) {
++    return &backend_connections_;
 +  }
++  const size_t index = next_backend_++ % (worker_connections_.size() + 1);
++  return index == 0 ? &backend_connections_
++                    : worker_connections_[index - 1].get();
++}
 +
-+  loader->SetTimeoutDuration(base::Seconds(300));
++void BrowserOSServerProxy::BindSession(
++    const std::string& session_id,
++    BrowserOSBackendConnectionPool* backend) {
++  // Sessions of fleet nodes are served by their browsers
++  if (!fleet_nodes_.Contains(backend)) {
++    if (mcp_sessions_.size() >= kMaxTrackedSessions &&
++        !mcp_sessions_.contains(session_id)) {
++      mcp_sessions_.clear();
++    }
++    mcp_sessions_.insert(session_id);
++    if (!fleet_config_.token.empty()) {
++      fleet_sessions_.Touch(session_id);
++    }
++  }
 +
-+  auto* loader_ptr = loader.get();
-+  pending_loaders_[connection_id] = std::move(loader);
-+  loader_ptr->DownloadToString(
-+      url_loader_factory_.get(),
-+      base::BindOnce(&BrowserOSServerProxy::OnBackendResponse,
-+                     base::Unretained(this), connection_id),
-+      kMaxResponseBodySize);
++  if (worker_connections_.empty() && session_backends_.empty() &&
++      backend == &backend_connections_) {
++    return;  // Single backend, nothing to route
++  }
++  if (session_backends_.size() >= kMaxTrackedSessions &&
++      !session_backends_.contains(session_id)) {
++    LOG(WARNING) << "browseros: Too many MCP sessions tracked, resetting";
++    session_backends_.clear();
++  }
++  session_backends_[session_id] = backend;
 +}
 +
-+void BrowserOSServerProxy::OnBackendResponse(
++void BrowserOSServerProxy::RejectRequest(
 +    int connection_id,
-+    std::unique_ptr<std::string> response_body) {
-+  auto it = pending_loaders_.find(connection_id);
-+  if (it == pending_loaders_.end() || !server_) {
++    const net::HttpServerRequestInfo& info,
++    base::TimeTicks received_at) {
++  ProxyRequestRecord record;
++  record.route = stats_.GetRoute(info.method, info.path);
++  record.status = net::HTTP_SERVICE_UNAVAILABLE;
++  record.received_at = received_at;
++  record.completed_at = base::TimeTicks::Now();
++  record.request_bytes = info.data.size();
++  stats_.RecordStarted(record.route);
++  stats_.RecordFinished(record);
++
++  Send503(server_.get(), connection_id);
++}
++
++void BrowserOSServerProxy::ServeStats(
++    int connection_id,
++    const net::HttpServerRequestInfo& info) {
++  // Local only, even when remote MCP access is allowed
++  if (!info.peer.address().IsLoopback()) {
++    net::HttpServerResponseInfo response(net::HTTP_FORBIDDEN);
++    response.SetBody("Forbidden", "text/plain");
++    server_->SendResponse(connection_id, response,
++                          GetProxyTrafficAnnotation());
 +    return;
 +  }
 +
-+  auto loader = std::move(it->second);
-+  pending_loaders_.erase(it);
++  net::HttpServerResponseInfo response(net::HTTP_OK);
++  response.SetBody(base::WriteJson(GetStats()).value_or("{}"),
++                   "application/json");
++  response.AddHeader("Cache-Control", "no-store");
++  server_->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
++}
 +
-+  int response_code = 0;
-+  auto* response_info = loader->ResponseInfo();
-+  if (response_info && response_info->headers) {
-+    response_code = response_info->headers->response_code();
++base::Value::Dict BrowserOSServerProxy::GetStats() const {
++  base::Value::Dict stats = stats_.ToValue();
++  stats.Set("held_requests", static_cast<int>(held_requests_.size()));
++  stats.Set("in_flight", static_cast<int>(pending_streams_.size()));
++  stats.Set("websocket_sessions", static_cast<int>(tunnels_.size()));
++  stats.Set("backends", static_cast<int>(worker_connections_.size() + 1));
++  if (!fleet_config_.token.empty()) {
++    stats.Set("fleet_nodes", fleet_nodes_.ToValue());
 +  }
++  return stats;
++}
 +
-+  if (!response_body || response_code == 0) {
-+    Send503(server_.get(), connection_id);
++void BrowserOSServerProxy::ServeFleetRegister(
++    int connection_id,
++    const net::HttpServerRequestInfo& info) {
++  const std::string token = info.GetHeaderValue(kFleetTokenHeader);
++  if (fleet_config_.token.empty() || info.method != "POST" ||
++      !crypto::SecureMemEqual(base::as_byte_span(token),
++                              base::as_byte_span(fleet_config_.token))) {
++    net::HttpServerResponseInfo response(net::HTTP_FORBIDDEN);
++    response.SetBody("Forbidden", "text/plain");
++    server_->SendResponse(connection_id, response,
++                          GetProxyTrafficAnnotation());
++    return;
++  }
++
++  std::optional<base::Value::Dict> report =
++      base::JSONReader::ReadDict(info.data);
++  std::optional<int> port = report ? report->FindInt("port") : std::nullopt;
++  const base::Value::Dict* capacity_value =
++      report ? report->FindDict("capacity") : nullptr;
++  std::optional<FleetCapacity> capacity =
++      capacity_value ? FleetCapacity::FromValue(*capacity_value)
++                     : std::nullopt;
++  if (!port || *port <= 0 || *port > 65535 || !capacity) {
++    net::HttpServerResponseInfo response(net::HTTP_BAD_REQUEST);
++    response.SetBody("Bad Request", "text/plain");
++    server_->SendResponse(connection_id, response,
++                          GetProxyTrafficAnnotation());
++    return;
++  }
++
++  DropBackends(fleet_nodes_.TakeExpiredNodes());
++  fleet_nodes_.Register(
++      net::IPEndPoint(info.peer.address(), static_cast<uint16_t>(*port)),
++      *capacity);
++  net::HttpServerResponseInfo response(net::HTTP_OK);
++  response.SetBody("OK", "text/plain");
++  server_->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
++}
++
++BrowserOSBackendConnectionPool* BrowserOSServerProxy::SelectFleetNode() {
++  if (fleet_config_.token.empty() || fleet_nodes_.empty() ||
++      fleet_sessions_.CountActive() < fleet_config_.max_sessions) {
++    return nullptr;
++  }
++  DropBackends(fleet_nodes_.TakeExpiredNodes());
++  return fleet_nodes_.SelectNode();
++}
++
++bool BrowserOSServerProxy::IsDirectCallAuthorized(
++    const net::HttpServerRequestInfo& info) const {
++  // Local only, even when remote MCP access is allowed
++  if (!info.peer.address().IsLoopback() || direct_call_token_.empty() ||
++      !direct_call_handler_) {
++    return false;
++  }
++
++  std::string token = info.GetHeaderValue(kDirectCallTokenHeader);
++  if (token.empty()) {
++    net::GetValueForKeyInQuery(GURL("http://localhost" + info.path), "token",
++                               &token);
++  }
++  return crypto::SecureMemEqual(base::as_byte_span(token),
++                                base::as_byte_span(direct_call_token_));
++}
++
++void BrowserOSServerProxy::AcceptDevToolsSession(
++    int connection_id,
++    const net::HttpServerRequestInfo& info) {
++  // Pages in the browser could reach a loopback WebSocket; they always send
++  // an Origin, which DevTools clients don't
++  if (!IsDirectCallAuthorized(info) || !info.GetHeaderValue("origin").empty()) {
++    net::HttpServerResponseInfo response(net::HTTP_FORBIDDEN);
++    response.SetBody("Forbidden", "text/plain");
++    server_->SendResponse(connection_id, response,
++                          GetProxyTrafficAnnotation());
++    server_->Close(connection_id);
++    return;
++  }
++
++  devtools_sessions_[connection_id] =
++      std::make_unique<BrowserOSDevToolsSession>(
++          direct_call_handler_,
++          base::BindRepeating(&BrowserOSServerProxy::SendDevToolsMessage,
++                              base::Unretained(this), connection_id));
++  server_->AcceptWebSocket(connection_id, info, GetProxyTrafficAnnotation());
++  // Snapshots and screenshots outgrow the default send buffer
++  server_->SetSendBufferSize(connection_id, kMaxQueuedResponseBytes);
++}
++
++void BrowserOSServerProxy::SendDevToolsMessage(int connection_id,
++                                               std::string message) {
++  if (server_) {
++    server_->SendOverWebSocket(connection_id, message,
++                               GetProxyTrafficAnnotation());
++  }
++}
++
++void BrowserOSServerProxy::ServeDirectCall(
++    int connection_id,
++    const net::HttpServerRequestInfo& info) {
++  auto send_error = [&](net::HttpStatusCode status, std::string_view message) {
++    net::HttpServerResponseInfo response(status);
++    response.SetBody(std::string(message), "text/plain");
++    server_->SendResponse(connection_id, response,
++                          GetProxyTrafficAnnotation());
++  };
++
++  if (!IsDirectCallAuthorized(info)) {
++    send_error(net::HTTP_FORBIDDEN, "Forbidden");
++    return;
++  }
++
++  if (info.method != "POST") {
++    send_error(net::HTTP_METHOD_NOT_ALLOWED, "Method Not Allowed");
 +    return;
 +  }
 +
-+  std::string content_type = "application/json";
-+  if (response_info && response_info->headers) {
-+    std::optional<std::string> ct =
-+        response_info->headers->GetNormalizedHeader("content-type");
-+    if (ct.has_value()) {
-+      content_type = std::move(*ct);
++  const std::string function =
++      info.path.substr(std::size(kDirectCallPathPrefix) - 1);
++  if (function.empty() || !std::ranges::all_of(function, [](char c) {
++        return base::IsAsciiAlphaNumeric(c);
++      })) {
++    send_error(net::HTTP_NOT_FOUND, "Not Found");
++    return;
++  }
++
++  // The body is the function's argument list; empty means no arguments
++  base::Value::List args;
++  if (!info.data.empty()) {
++    std::optional<base::Value> parsed = base::JSONReader::Read(info.data);
++    if (!parsed || !parsed->is_list()) {
++      send_error(net::HTTP_BAD_REQUEST, "Body must be a JSON array");
++      return;
 +    }
++    args = std::move(*parsed).TakeList();
++  }
++
++  ProxyRequestRecord record;
++  record.route = stats_.GetRoute(info.method, info.path);
++  record.received_at = base::TimeTicks::Now();
++  record.dispatched_at = record.received_at;
++  record.request_bytes = info.data.size();
++  stats_.RecordStarted(record.route);
++
++  const bool shared_payload =
++      info.GetHeaderValue(kDirectCallPayloadHeader) == kSharedPayloadValue;
++
++  direct_call_handler_.Run(
++      function, std::move(args),
++      base::BindPostTaskToCurrentDefault(base::BindOnce(
++          &BrowserOSServerProxy::OnDirectCallComplete,
++          weak_factory_.GetWeakPtr(), connection_id, std::move(record),
++          shared_payload)));
++}
++
++void BrowserOSServerProxy::OnDirectCallComplete(int connection_id,
++                                                ProxyRequestRecord record,
++                                                bool shared_payload,
++                                                DirectCallResult result) {
++  base::Value::Dict body;
++  if (!result.has_value()) {
++    body.Set("error", std::move(result).error());
++    SendDirectCallResponse(connection_id, std::move(record), body, 0);
++    return;
++  }
++
++  body.Set("results", std::move(result).value());
++  if (shared_payload && shared_payload_writer_) {
++    shared_payload_writer_->Write(
++        base::Value(std::move(body)),
++        base::BindOnce(&BrowserOSServerProxy::OnSharedPayloadWritten,
++                       weak_factory_.GetWeakPtr(), connection_id,
++                       std::move(record)));
++    return;
++  }
++  SendDirectCallResponse(connection_id, std::move(record), body, 0);
++}
++
++void BrowserOSServerProxy::OnSharedPayloadWritten(
++    int connection_id,
++    ProxyRequestRecord record,
++    std::optional<SharedPayload> payload) {
++  base::Value::Dict body;
++  if (!payload) {
++    body.Set("error", "Failed to write shared payload");
++    SendDirectCallResponse(connection_id, std::move(record), body, 0);
++    return;
++  }
++
++  base::Value::Dict payload_dict;
++  payload_dict.Set("path", payload->path.AsUTF8Unsafe());
++  payload_dict.Set("length", static_cast<double>(payload->length));
++  payload_dict.Set("format", "cbor");
++  body.Set("payload", std::move(payload_dict));
++  SendDirectCallResponse(connection_id, std::move(record), body,
++                         payload->length);
++}
++
++void BrowserOSServerProxy::SendDirectCallResponse(
++    int connection_id,
++    ProxyRequestRecord record,
++    const base::Value::Dict& body,
++    size_t payload_bytes) {
++  const std::string json = base::WriteJson(body).value_or("{}");
++
++  record.status = net::HTTP_OK;
++  record.completed_at = base::TimeTicks::Now();
++  // Payload files count towards the response, so the stats stay comparable
++  record.response_bytes = json.size() + payload_bytes;
++  stats_.RecordFinished(record);
++
++  if (!server_) {
++    return;
++  }
++  net::HttpServerResponseInfo response(net::HTTP_OK);
++  response.SetBody(json, "application/json");
++  response.AddHeader("Cache-Control", "no-store");
++  // Screenshots and snapshots outgrow the default send buffer
++  server_->SetSendBufferSize(connection_id, kMaxQueuedResponseBytes);
++  server_->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
++}
++
++bool BrowserOSServerProxy::MaybeServeMcpFastPath(
++    int connection_id,
++    const net::HttpServerRequestInfo& info) {
++  if (info.path.substr(0, info.path.find('?')) != kMcpPath) {
++    return false;
++  }
++
++  const std::string session_id = info.GetHeaderValue("mcp-session-id");
++  if (info.method == "DELETE") {
++    // The client ends its session; the sidecar still gets the request
++    mcp_sessions_.erase(session_id);
++    fleet_sessions_.Remove(session_id);
++    return false;
++  }
++  if (!fleet_config_.token.empty() && mcp_sessions_.contains(session_id)) {
++    fleet_sessions_.Touch(session_id);
 +  }
 +
-+  net::HttpServerResponseInfo response(
-+      static_cast<net::HttpStatusCode>(response_code));
-+  response.SetBody(*response_body, content_type);
++  if (!mcp_fast_path_enabled_ || !direct_call_handler_ ||
++      info.method != "POST" || !mcp_sessions_.contains(session_id)) {
++    return false;
++  }
++
++  std::optional<McpFastPathCall> call = ParseMcpFastPathCall(info.data);
++  if (!call) {
++    return false;
++  }
++
++  ProxyRequestRecord record;
++  record.route = stats_.GetRoute("MCP", call->tool);
++  record.received_at = base::TimeTicks::Now();
++  record.dispatched_at = record.received_at;
++  record.request_bytes = info.data.size();
++  stats_.RecordStarted(record.route);
++
++  std::string function = call->function;
++  base::Value::List args = std::move(call->args);
++  direct_call_handler_.Run(
++      std::move(function), std::move(args),
++      base::BindPostTaskToCurrentDefault(base::BindOnce(
++          &BrowserOSServerProxy::OnMcpFastPathComplete,
++          weak_factory_.GetWeakPtr(), connection_id, std::move(record),
++          std::move(*call))));
++  return true;
++}
++
++void BrowserOSServerProxy::OnMcpFastPathComplete(int connection_id,
++                                                 ProxyRequestRecord record,
++                                                 McpFastPathCall call,
++                                                 DirectCallResult result) {
++  const std::string json = FormatMcpFastPathResponse(call, std::move(result));
++
++  record.status = net::HTTP_OK;
++  record.completed_at = base::TimeTicks::Now();
++  record.response_bytes = json.size();
++  stats_.RecordFinished(record);
++
++  if (!server_) {
++    return;
++  }
++  net::HttpServerResponseInfo response(net::HTTP_OK);
++  response.SetBody(json, "application/json");
++  response.AddHeader("Cache-Control", "no-store");
++  // Screenshots and snapshots outgrow the default send buffer
++  server_->SetSendBufferSize(connection_id, kMaxQueuedResponseBytes);
 +  server_->SendResponse(connection_id, response, GetProxyTrafficAnnotation());
 +}
 +
++bool BrowserOSServerProxy::HoldRequest(
++    int connection_id,
++    const net::HttpServerRequestInfo& info,
++    base::TimeTicks received_at) {
++  if (!hold_time_.is_positive() || held_requests_.size() >= kMaxHeldRequests) {
++    return false;
++  }
++
++  held_requests_.push_back({connection_id, info, received_at});
++  if (!hold_timer_.IsRunning()) {
++    hold_timer_.Start(FROM_HERE, hold_time_, this,
++                      &BrowserOSServerProxy::ExpireHeldRequests);
++  }
++  return true;
++}
++
++void BrowserOSServerProxy::ReplayHeldRequests() {
++  hold_timer_.Stop();
++  if (held_requests_.empty()) {
++    return;
++  }
++
++  VLOG(1) << "browseros: Replaying " << held_requests_.size()
++          << " held request(s)";
++  base::circular_deque<HeldRequest> requests = std::move(held_requests_);
++  held_requests_.clear();
++  for (const HeldRequest& request : requests) {
++    ForwardRequest(request.connection_id, request.info, request.held_at);
++  }
++}
++
++void BrowserOSServerProxy::ExpireHeldRequests() {
++  const base::TimeTicks now = base::TimeTicks::Now();
++  while (!held_requests_.empty() &&
++         now - held_requests_.front().held_at >= hold_time_) {
++    HeldRequest request = std::move(held_requests_.front());
++    held_requests_.pop_front();
++    if (server_) {
++      RejectRequest(request.connection_id, request.info, request.held_at);
++    }
++  }
++
++  if (!held_requests_.empty()) {
++    hold_timer_.Start(FROM_HERE,
++                      held_requests_.front().held_at + hold_time_ - now, this,
++                      &BrowserOSServerProxy::ExpireHeldRequests);
++  }
++}
++
++void BrowserOSServerProxy::OnStreamComplete(int connection_id,
++                                            bool close_connection) {
++  pending_streams_.erase(connection_id);
++  MaybeFinishDrain();
++  if (close_connection && server_) {
++    server_->Close(connection_id);
++  }
++}
++
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_proxy.h b/chrome/browser/browseros/server/browseros_server_proxy.h
 new file mode 100644
-index 0000000000000..30474fa5001df
+index 0000000000000..50ffcf160879b
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_proxy.h
-@@ -0,0 +1,78 @@
+@@ -0,0 +1,320 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,28 +12,92 @@ index 0000000000000..30474fa5001df
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_PROXY_H_
 +
 +#include <memory>
++#include <optional>
 +#include <string>
++#include <vector>
 +
++#include "base/containers/circular_deque.h"
 +#include "base/containers/flat_map.h"
-+#include "base/memory/scoped_refptr.h"
++#include "base/containers/flat_set.h"
++#include "base/functional/callback.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_direct_call.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "chrome/browser/browseros/server/browseros_backend_connection.h"
++#include "chrome/browser/browseros/server/browseros_mcp_fast_path.h"
++#include "chrome/browser/browseros/server/browseros_proxy_stats.h"
++#include "chrome/browser/browseros/server/browseros_server_fleet.h"
++#include "chrome/browser/browseros/server/browseros_shared_payload.h"
 +#include "net/server/http_server.h"
 +
-+namespace network {
-+class PendingSharedURLLoaderFactory;
-+class SharedURLLoaderFactory;
-+class SimpleURLLoader;
-+}  // namespace network
++namespace net {
++class TCPServerSocket;
++}  // namespace net
 +
 +namespace browseros {
 +
++class BrowserOSDevToolsSession;
++class BrowserOSWebSocketTunnel;
++
 +// HTTP proxy that binds a stable port and forwards all requests to the
-+// sidecar's ephemeral backend port. Returns 503 when no backend is configured.
++// sidecar's ephemeral backend port. The manager sets a backend only once the
++// sidecar answers /health, and clears it while the sidecar restarts. Requests
++// arriving without a backend are held for a while and replayed once one is
++// set, so short restarts don't surface to clients; 503 is returned when the
++// hold time runs out or too many requests are waiting.
++//
++// Threading: The entire proxy runs on the IO thread, with net::HttpServer
++// and the backend sockets on the same thread. Requests go to the backend
++// over keep-alive loopback connections from BrowserOSBackendConnectionPool
++// rather than through the network service.
++//
++// Backend responses are streamed: headers are sent as soon as the backend
++// answers and the body is relayed with chunked transfer encoding as it
++// arrives, so large tool results and SSE streams are not buffered whole.
++// WebSocket upgrades are tunnelled to the backend, one backend connection
++// per client session, with messages relayed as they arrive.
++//
++// With extra sidecar workers (SetWorkerBackends()), new MCP sessions are
++// spread round-robin across the primary backend and the workers. Requests
++// carrying an mcp-session-id stick to the backend that issued it.
++//
++// Successful primary backend responses are reported through
++// SetBackendActivityCallback() so the manager can skip /health probes while
++// traffic proves the sidecar is alive.
++//
++// Request counts, sizes and queue/backend/total latencies are kept per route
++// and served as JSON at /browseros/stats, to loopback clients only.
++//
++// POST /browseros/call/<function> runs a browserOS function in the browser
++// (SetDirectCallHandler()), so the sidecar skips the round trip through the
++// agent extension. Only loopback clients holding the per-launch token from
++// the sidecar config are served. The same functions are offered as a
++// BrowserOS protocol domain to DevTools-style clients over a WebSocket at
++// /browseros/devtools (BrowserOSDevToolsSession), with the token in the
++// header or a "token" query parameter.
++//
++// Direct calls sent with "X-BrowserOS-Payload: shared" get their result
++// written to a CBOR file in the shared payload directory
++// (SetSharedPayloadDir()) and only its path and length in the response, so
++// large snapshots and AX trees are read by the sidecar straight from a
++// mapped file instead of being serialized to JSON and copied through the
++// socket.
++//
++// With the MCP fast path on (SetMcpFastPathEnabled()), tools/call requests
++// to /mcp for the hottest tools (ParseMcpFastPathCall()) are answered by
++// the proxy through the direct call handler, saving the hops through the
++// sidecar and the agent extension. Only sessions the sidecar has issued
++// qualify, so clients still initialize, authenticate and list tools with
++// the sidecar; every other request is forwarded as before.
 +//
-+// Threading: The entire proxy runs on the IO thread. The manager obtains a
-+// SharedURLLoaderFactory on the UI thread, calls Clone() to get a
-+// PendingSharedURLLoaderFactory, and passes it to Start() on the IO thread.
-+// Start() binds it into a new SharedURLLoaderFactory usable from IO.
-+// This keeps net::HttpServer and SimpleURLLoader on the same thread.
++// In fleet mode (SetFleetConfig(), see browseros_server_fleet.h), the proxy
++// takes other instances' capacity reports at /browseros/fleet/register and
++// sends new MCP sessions to them once its own are used up, and reports its
++// own capacity to its coordinator, if it has one.
 +class BrowserOSServerProxy : public net::HttpServer::Delegate {
 + public:
 +  BrowserOSServerProxy();
@@ -42,19 +106,60 @@ index 0000000000000..30474fa5001df
 +  BrowserOSServerProxy(const BrowserOSServerProxy&) = delete;
 +  BrowserOSServerProxy& operator=(const BrowserOSServerProxy&) = delete;
 +
-+  // Bind proxy on the given port. |pending_factory| is a cloned factory
-+  // that will be bound on the current (IO) thread. Returns true on success.
++  // Bind proxy on the given port, or serve on |listen_socket| if it is
++  // already listening there. Returns true on success.
 +  bool Start(int port,
-+             std::unique_ptr<network::PendingSharedURLLoaderFactory>
-+                 pending_factory);
++             std::unique_ptr<net::TCPServerSocket> listen_socket = nullptr);
 +
 +  void Stop();
 +
-+  void SetBackendPort(int port);
++  // Points the proxy at a new backend. |socket_path| is the backend's Unix
++  // domain socket, or empty to forward to 127.0.0.1:|port|.
++  void SetBackend(int port, const base::FilePath& socket_path);
++  // Replaces the extra worker backends (TCP ports) balanced across along
++  // with the primary one. Requests in flight to a dropped worker are closed.
++  void SetWorkerBackends(const std::vector<int>& ports);
++  // Runs |callback| once the requests relayed to the primary backend before
++  // the last SetBackend() have finished, or after |timeout|. WebSocket
++  // tunnels are not waited for.
++  void DrainPreviousBackend(base::TimeDelta timeout,
++                            base::OnceClosure callback);
 +  void SetAllowRemote(bool allow);
 +
++  // |callback| runs, at most every few seconds, after the primary backend
++  // answers a request successfully.
++  void SetBackendActivityCallback(base::RepeatingClosure callback);
++
++  // Enables /browseros/call/ for requests carrying |token| in the
++  // X-BrowserOS-Token header. |handler| runs on the IO thread and replies
++  // there.
++  void SetDirectCallHandler(std::string token, DirectCallHandler handler);
++
++  // Serves hot MCP tools in-process through the direct call handler.
++  void SetMcpFastPathEnabled(bool enabled);
++
++  // Turns fleet mode on, or off with an empty token. Drops the nodes
++  // registered so far. Call after Start(), as nodes report the bound port.
++  void SetFleetConfig(const FleetConfig& config);
++
++  // Enables shared payload responses to direct calls, with the payload
++  // files kept in |dir|. The directory is emptied first.
++  void SetSharedPayloadDir(const base::FilePath& dir);
++
++  // How long requests are held while no backend is set. Zero answers 503
++  // right away.
++  void SetRequestHoldTime(base::TimeDelta hold_time);
++
 +  int GetPort() const { return bound_port_; }
 +
++  // Closes idle backend connections and drops the recent request log, on
++  // memory pressure. Requests in flight are left alone.
++  ReleasedMemory ReleaseMemory();
++
++  // What /browseros/stats serves: per-route latencies and the current
++  // held, in-flight and WebSocket counts
++  base::Value::Dict GetStats() const;
++
 + private:
 +  // net::HttpServer::Delegate
 +  void OnConnect(int connection_id) override;
@@ -65,18 +170,155 @@ index 0000000000000..30474fa5001df
 +  void OnWebSocketMessage(int connection_id, std::string data) override;
 +  void OnClose(int connection_id) override;
 +
++  // Relays one backend response to its connection
++  class BackendStream;
++
++  // |received_at| is when the request first reached the proxy
 +  void ForwardRequest(int connection_id,
-+                      const net::HttpServerRequestInfo& info);
-+  void OnBackendResponse(int connection_id,
-+                         std::unique_ptr<std::string> response_body);
++                      const net::HttpServerRequestInfo& info,
++                      base::TimeTicks received_at);
++
++  // Answers 503 and counts the request as failed
++  void RejectRequest(int connection_id,
++                     const net::HttpServerRequestInfo& info,
++                     base::TimeTicks received_at);
++
++  // Serves /browseros/stats
++  void ServeStats(int connection_id, const net::HttpServerRequestInfo& info);
++
++  // Serves /browseros/fleet/register
++  void ServeFleetRegister(int connection_id,
++                          const net::HttpServerRequestInfo& info);
++  // A fleet node for a new session once the local sessions are used up, or
++  // null to serve it here
++  BrowserOSBackendConnectionPool* SelectFleetNode();
++
++  // True if |info| comes from loopback and carries the direct call token
++  bool IsDirectCallAuthorized(const net::HttpServerRequestInfo& info) const;
++
++  // Accepts a /browseros/devtools WebSocket
++  void AcceptDevToolsSession(int connection_id,
++                             const net::HttpServerRequestInfo& info);
++  void SendDevToolsMessage(int connection_id, std::string message);
++
++  // Serves /browseros/call/<function>
++  void ServeDirectCall(int connection_id,
++                       const net::HttpServerRequestInfo& info);
++  void OnDirectCallComplete(int connection_id,
++                            ProxyRequestRecord record,
++                            bool shared_payload,
++                            DirectCallResult result);
++  void OnSharedPayloadWritten(int connection_id,
++                              ProxyRequestRecord record,
++                              std::optional<SharedPayload> payload);
++  // |payload_bytes| is the size of the payload file |body| points to, if any
++  void SendDirectCallResponse(int connection_id,
++                              ProxyRequestRecord record,
++                              const base::Value::Dict& body,
++                              size_t payload_bytes);
++
++  // Answers |info| through the MCP fast path if it qualifies. Returns false
++  // if the request should be forwarded instead.
++  bool MaybeServeMcpFastPath(int connection_id,
++                             const net::HttpServerRequestInfo& info);
++  void OnMcpFastPathComplete(int connection_id,
++                             ProxyRequestRecord record,
++                             McpFastPathCall call,
++                             DirectCallResult result);
++
++  // Picks the backend for |info|: the session's own, or for requests
++  // outside a session a fleet node or the next local one in turn.
++  BrowserOSBackendConnectionPool* SelectBackend(
++      const net::HttpServerRequestInfo& info);
++  // Forgets the sessions of |dropped| backends and closes the requests in
++  // flight to them, which can't be moved elsewhere
++  void DropBackends(
++      std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>> dropped);
++  // Routes later requests of |session_id| to |backend| and lets them use
++  // the MCP fast path
++  void BindSession(const std::string& session_id,
++                   BrowserOSBackendConnectionPool* backend);
++
++  // Request waiting for a backend
++  struct HeldRequest {
++    int connection_id;
++    net::HttpServerRequestInfo info;
++    base::TimeTicks held_at;
++  };
++
++  // Holds the request until a backend is set. Returns false if it can't be
++  // held.
++  bool HoldRequest(int connection_id,
++                   const net::HttpServerRequestInfo& info,
++                   base::TimeTicks received_at);
++  void ReplayHeldRequests();
++  // Answers 503 to requests held longer than the hold time
++  void ExpireHeldRequests();
++
++  void MaybeFinishDrain();
++  void FinishDrain();
++
++  // Called by a BackendStream after a successful primary backend response
++  void OnBackendActivity();
++
++  // Called by a BackendStream once its response is finished or failed.
++  // Deletes the stream.
++  void OnStreamComplete(int connection_id, bool close_connection);
++
++  // Accepts the client's upgrade once the backend accepted its own, or
++  // answers 503.
++  void OnTunnelConnected(int connection_id,
++                         const net::HttpServerRequestInfo& info,
++                         bool connected);
++  void OnTunnelMessage(int connection_id, std::string message);
++  void OnTunnelClosed(int connection_id);
++
++  // Rejects requests from other hosts unless remote access is allowed.
++  // Returns false after answering 403.
++  bool CheckPeerAllowed(int connection_id,
++                        const net::HttpServerRequestInfo& info);
 +
 +  std::unique_ptr<net::HttpServer> server_;
-+  base::flat_map<int, std::unique_ptr<network::SimpleURLLoader>>
-+      pending_loaders_;
-+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
++  // Declared before the streams, which record into it when destroyed
++  BrowserOSProxyStats stats_;
++  // Declared before the streams so in-flight requests are destroyed first
++  BrowserOSBackendConnectionPool backend_connections_;
++  std::vector<std::unique_ptr<BrowserOSBackendConnectionPool>>
++      worker_connections_;
++  // Declared before the streams too
++  BrowserOSFleetRegistry fleet_nodes_;
++  base::flat_map<std::string, raw_ptr<BrowserOSBackendConnectionPool>>
++      session_backends_;
++  size_t next_backend_ = 0;
++  // MCP sessions issued by a local backend and not deleted since
++  base::flat_set<std::string> mcp_sessions_;
++  // The active ones among them, in fleet mode
++  BrowserOSFleetSessions fleet_sessions_;
++  std::unique_ptr<BrowserOSFleetReporter> fleet_reporter_;
++  FleetConfig fleet_config_;
++  base::flat_map<int, std::unique_ptr<BackendStream>> pending_streams_;
++  base::flat_map<int, std::unique_ptr<BrowserOSWebSocketTunnel>> tunnels_;
++  base::flat_map<int, std::unique_ptr<BrowserOSDevToolsSession>>
++      devtools_sessions_;
++  base::circular_deque<HeldRequest> held_requests_;
++  base::OneShotTimer hold_timer_;
++  base::TimeDelta hold_time_;
++  base::RepeatingClosure backend_activity_callback_;
++  std::string direct_call_token_;
++  DirectCallHandler direct_call_handler_;
++  std::unique_ptr<BrowserOSSharedPayloadWriter> shared_payload_writer_;
++  // Pending DrainPreviousBackend(): streams to older primary generations
++  base::OnceClosure drain_callback_;
++  int drain_generation_ = 0;
++  base::OneShotTimer drain_timer_;
++  base::TimeTicks last_activity_report_;
 +  int backend_port_ = 0;
 +  int bound_port_ = 0;
 +  bool allow_remote_ = false;
++  bool mcp_fast_path_enabled_ = false;
++
++  // Direct call replies may arrive after the proxy is gone
++  base::WeakPtrFactory<BrowserOSServerProxy> weak_factory_{this};
 +};
 +
 +}  // namespace browseros
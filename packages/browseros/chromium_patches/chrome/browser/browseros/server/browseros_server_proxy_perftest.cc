@@ -0,0 +1,513 @@
+diff --git a/chrome/browser/browseros/server/browseros_server_proxy_perftest.cc b/chrome/browser/browseros/server/browseros_server_proxy_perftest.cc
+new file mode 100644
+index 0000000000000..54fc516e12b5f
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_server_proxy_perftest.cc
+@@ -0,0 +1,507 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++// Load test of BrowserOSServerProxy against a fake sidecar.
++//
++// The backend is an EmbeddedTestServer answering /load?bytes=N&latency_ms=M
++// with N bytes after M ms. Each case sends a fixed number of requests with a
++// fixed number in flight, each on its own client connection, once straight
++// to the backend and once through the proxy. Reported per case:
++//   - requests and response bytes per second through the proxy
++//   - p50/p95 latency through the proxy, and the p50 it adds over the
++//     direct requests
++//   - requests that failed (connect errors, non-200s, truncated bodies)
++//   - growth of the process's peak RSS per concurrent connection; cases run
++//     in increasing size so the growth belongs to the case, but it is still
++//     an upper bound
++// The small case runs with unit_tests. The sweeps are MANUAL_ and need
++// --run-manual; run them one per process for meaningful memory numbers.
++
++#include <algorithm>
++#include <memory>
++#include <string>
++#include <string_view>
++#include <utility>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/run_loop.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/strings/stringprintf.h"
++#include "base/task/single_thread_task_runner.h"
++#include "base/test/task_environment.h"
++#include "base/time/time.h"
++#include "base/timer/elapsed_timer.h"
++#include "build/build_config.h"
++#include "chrome/browser/browseros/server/browseros_server_proxy.h"
++#include "net/base/address_list.h"
++#include "net/base/io_buffer.h"
++#include "net/base/ip_endpoint.h"
++#include "net/base/net_errors.h"
++#include "net/base/url_util.h"
++#include "net/log/net_log_source.h"
++#include "net/socket/tcp_client_socket.h"
++#include "net/socket/tcp_server_socket.h"
++#include "net/test/embedded_test_server/embedded_test_server.h"
++#include "net/test/embedded_test_server/http_request.h"
++#include "net/test/embedded_test_server/http_response.h"
++#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++
++#if BUILDFLAG(IS_WIN)
++#include <windows.h>
++
++#include <psapi.h>
++#else
++#include <sys/resource.h>
++#endif
++
++namespace browseros {
++namespace {
++
++constexpr char kMetricPrefix[] = "BrowserOSServerProxy.";
++constexpr char kRequestsPerSecond[] = "requests_per_second";
++constexpr char kBytesPerSecond[] = "bytes_per_second";
++constexpr char kLatencyP50[] = "latency_p50";
++constexpr char kLatencyP95[] = "latency_p95";
++constexpr char kAddedLatencyP50[] = "added_latency_p50";
++constexpr char kFailures[] = "failures";
++constexpr char kMemoryPerConnection[] = "peak_rss_growth_per_connection";
++
++// Same backlog as the proxy's own listen socket
++constexpr int kBackLog = 10;
++
++constexpr size_t kReadBufferSize = 64 * 1024;
++
++// Cases whose bodies in flight would exceed this are skipped
++constexpr size_t kMaxBytesInFlight = 512 * 1024 * 1024;
++
++constexpr size_t kKB = 1024;
++constexpr size_t kMB = 1024 * 1024;
++
++// Peak resident set size of this process so far
++size_t GetPeakRssBytes() {
++#if BUILDFLAG(IS_WIN)
++  PROCESS_MEMORY_COUNTERS counters = {};
++  if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters,
++                              sizeof(counters))) {
++    return 0;
++  }
++  return counters.PeakWorkingSetSize;
++#else
++  struct rusage usage = {};
++  if (getrusage(RUSAGE_SELF, &usage) != 0) {
++    return 0;
++  }
++#if BUILDFLAG(IS_APPLE)
++  return static_cast<size_t>(usage.ru_maxrss);  // Bytes
++#else
++  return static_cast<size_t>(usage.ru_maxrss) * 1024;  // Kilobytes
++#endif
++#endif
++}
++
++// Fake sidecar: /load?bytes=N&latency_ms=M answers N bytes after M ms
++std::unique_ptr<net::test_server::HttpResponse> HandleLoadRequest(
++    const net::test_server::HttpRequest& request) {
++  const GURL url = request.GetURL();
++  if (url.path() != "/load") {
++    return nullptr;
++  }
++  std::string value;
++  size_t bytes = 0;
++  int latency_ms = 0;
++  if (net::GetValueForKeyInQuery(url, "bytes", &value)) {
++    base::StringToSizeT(value, &bytes);
++  }
++  if (net::GetValueForKeyInQuery(url, "latency_ms", &value)) {
++    base::StringToInt(value, &latency_ms);
++  }
++  auto response = std::make_unique<net::test_server::DelayedHttpResponse>(
++      base::Milliseconds(latency_ms));
++  response->set_content_type("application/json");
++  response->set_content(std::string(bytes, 'x'));
++  return response;
++}
++
++struct LoadCase {
++  size_t concurrency;
++  size_t body_bytes;
++  base::TimeDelta backend_latency;
++  // How long each client waits after connecting before it reads anything
++  base::TimeDelta read_delay;
++};
++
++std::string GetStory(const LoadCase& load_case) {
++  std::string story = base::StringPrintf(
++      "c%zu_%zukb_%dms", load_case.concurrency, load_case.body_bytes / kKB,
++      static_cast<int>(load_case.backend_latency.InMilliseconds()));
++  if (load_case.read_delay.is_positive()) {
++    story += "_slow_reader";
++  }
++  return story;
++}
++
++struct RequestResult {
++  bool ok = false;
++  base::TimeDelta latency;
++  size_t body_bytes = 0;
++};
++
++// One GET on its own connection. Reads the response, plain or chunked,
++// until it is complete or the connection closes.
++class LoadRequest {
++ public:
++  LoadRequest(const net::IPEndPoint& endpoint,
++              const std::string& path,
++              base::TimeDelta read_delay,
++              base::OnceCallback<void(RequestResult)> done)
++      : socket_(net::AddressList(endpoint),
++                nullptr,
++                nullptr,
++                nullptr,
++                net::NetLogSource()),
++        read_delay_(read_delay),
++        done_(std::move(done)) {
++    const std::string request = base::StringPrintf(
++        "GET %s HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n", path.c_str());
++    write_buffer_ = base::MakeRefCounted<net::DrainableIOBuffer>(
++        base::MakeRefCounted<net::StringIOBuffer>(request), request.size());
++    read_buffer_ = base::MakeRefCounted<net::IOBufferWithSize>(kReadBufferSize);
++  }
++
++  LoadRequest(const LoadRequest&) = delete;
++  LoadRequest& operator=(const LoadRequest&) = delete;
++
++  void Start() {
++    const int rv = socket_.Connect(
++        base::BindOnce(&LoadRequest::OnConnected, base::Unretained(this)));
++    if (rv != net::ERR_IO_PENDING) {
++      OnConnected(rv);
++    }
++  }
++
++ private:
++  void OnConnected(int rv) {
++    if (rv != net::OK) {
++      Finish(false);
++      return;
++    }
++    Write();
++  }
++
++  void Write() {
++    const int rv = socket_.Write(
++        write_buffer_.get(), write_buffer_->BytesRemaining(),
++        base::BindOnce(&LoadRequest::OnWritten, base::Unretained(this)),
++        TRAFFIC_ANNOTATION_FOR_TESTS);
++    if (rv != net::ERR_IO_PENDING) {
++      OnWritten(rv);
++    }
++  }
++
++  void OnWritten(int rv) {
++    if (rv <= 0) {
++      Finish(false);
++      return;
++    }
++    write_buffer_->DidConsume(rv);
++    if (write_buffer_->BytesRemaining() > 0) {
++      Write();
++      return;
++    }
++    if (read_delay_.is_positive()) {
++      base::SingleThreadTaskRunner::GetCurrentDefault()->PostDelayedTask(
++          FROM_HERE,
++          base::BindOnce(&LoadRequest::Read, base::Unretained(this)),
++          read_delay_);
++      return;
++    }
++    Read();
++  }
++
++  void Read() {
++    while (true) {
++      const int rv = socket_.Read(
++          read_buffer_.get(), read_buffer_->size(),
++          base::BindOnce(&LoadRequest::OnRead, base::Unretained(this)));
++      if (rv == net::ERR_IO_PENDING) {
++        return;
++      }
++      if (!HandleRead(rv)) {
++        return;
++      }
++    }
++  }
++
++  void OnRead(int rv) {
++    if (HandleRead(rv)) {
++      Read();
++    }
++  }
++
++  // Returns true to keep reading
++  bool HandleRead(int rv) {
++    if (rv <= 0) {
++      // Closed before the response was complete
++      Finish(false);
++      return false;
++    }
++    std::string_view data(read_buffer_->data(), static_cast<size_t>(rv));
++    if (!headers_done_) {
++      head_.append(data);
++      const size_t end = head_.find("\r\n\r\n");
++      if (end == std::string::npos) {
++        return true;
++      }
++      headers_done_ = true;
++      ok_status_ = head_.starts_with("HTTP/1.1 200");
++      const std::string headers = base::ToLowerASCII(head_.substr(0, end));
++      chunked_ =
++          headers.find("transfer-encoding: chunked") != std::string::npos;
++      const size_t length_at = headers.find("content-length: ");
++      if (length_at != std::string::npos) {
++        base::StringToSizeT(
++            std::string_view(headers).substr(
++                length_at + 16,
++                headers.find("\r\n", length_at) - length_at - 16),
++            &content_length_);
++      }
++      data = std::string_view(head_).substr(end + 4);
++    }
++
++    body_bytes_ += data.size();
++    if (chunked_) {
++      tail_.append(data);
++      if (tail_.size() > 5) {
++        tail_.erase(0, tail_.size() - 5);
++      }
++      if (tail_ == "0\r\n\r\n") {
++        Finish(ok_status_);
++        return false;
++      }
++      return true;
++    }
++    if (body_bytes_ >= content_length_) {
++      Finish(ok_status_);
++      return false;
++    }
++    return true;
++  }
++
++  void Finish(bool ok) {
++    RequestResult result;
++    result.ok = ok;
++    result.latency = timer_.Elapsed();
++    result.body_bytes = body_bytes_;
++    socket_.Disconnect();
++    // May delete this
++    std::move(done_).Run(result);
++  }
++
++  net::TCPClientSocket socket_;
++  const base::TimeDelta read_delay_;
++  base::OnceCallback<void(RequestResult)> done_;
++  scoped_refptr<net::DrainableIOBuffer> write_buffer_;
++  scoped_refptr<net::IOBufferWithSize> read_buffer_;
++  const base::ElapsedTimer timer_;
++  std::string head_;
++  std::string tail_;
++  bool headers_done_ = false;
++  bool ok_status_ = false;
++  bool chunked_ = false;
++  size_t content_length_ = 0;
++  size_t body_bytes_ = 0;
++};
++
++// Sends |total| requests to |endpoint|, |load_case.concurrency| at a time
++class LoadRunner {
++ public:
++  LoadRunner(const net::IPEndPoint& endpoint,
++             const LoadCase& load_case,
++             size_t total)
++      : endpoint_(endpoint), load_case_(load_case), total_(total) {
++    path_ = base::StringPrintf(
++        "/load?bytes=%zu&latency_ms=%d", load_case.body_bytes,
++        static_cast<int>(load_case.backend_latency.InMilliseconds()));
++  }
++
++  // Returns the results once every request has finished
++  std::vector<RequestResult> Run() {
++    base::RunLoop run_loop;
++    quit_ = run_loop.QuitClosure();
++    for (size_t i = 0; i < std::min(load_case_.concurrency, total_); ++i) {
++      StartNext();
++    }
++    run_loop.Run();
++    return std::move(results_);
++  }
++
++ private:
++  void StartNext() {
++    const size_t index = started_++;
++    requests_.push_back(std::make_unique<LoadRequest>(
++        endpoint_, path_, load_case_.read_delay,
++        base::BindOnce(&LoadRunner::OnRequestDone, base::Unretained(this),
++                       index)));
++    requests_.back()->Start();
++  }
++
++  void OnRequestDone(size_t index, RequestResult result) {
++    results_.push_back(result);
++    // The request is still on the stack; free it once it has returned
++    base::SingleThreadTaskRunner::GetCurrentDefault()->DeleteSoon(
++        FROM_HERE, std::move(requests_[index]));
++    if (started_ < total_) {
++      StartNext();
++    } else if (results_.size() == total_) {
++      std::move(quit_).Run();
++    }
++  }
++
++  const net::IPEndPoint endpoint_;
++  const LoadCase load_case_;
++  const size_t total_;
++  std::string path_;
++  size_t started_ = 0;
++  std::vector<std::unique_ptr<LoadRequest>> requests_;
++  std::vector<RequestResult> results_;
++  base::OnceClosure quit_;
++};
++
++base::TimeDelta Percentile(std::vector<base::TimeDelta> samples,
++                           double fraction) {
++  if (samples.empty()) {
++    return base::TimeDelta();
++  }
++  std::sort(samples.begin(), samples.end());
++  const size_t rank = static_cast<size_t>(samples.size() * fraction);
++  return samples[std::min(rank, samples.size() - 1)];
++}
++
++std::vector<base::TimeDelta> SuccessfulLatencies(
++    const std::vector<RequestResult>& results) {
++  std::vector<base::TimeDelta> latencies;
++  for (const RequestResult& result : results) {
++    if (result.ok) {
++      latencies.push_back(result.latency);
++    }
++  }
++  return latencies;
++}
++
++class BrowserOSServerProxyPerfTest : public testing::Test {
++ protected:
++  void SetUp() override {
++    backend_.RegisterRequestHandler(base::BindRepeating(&HandleLoadRequest));
++    ASSERT_TRUE(backend_.Start());
++
++    auto listen_socket =
++        std::make_unique<net::TCPServerSocket>(nullptr, net::NetLogSource());
++    ASSERT_EQ(net::OK, listen_socket->ListenWithAddressAndPort(
++                           "127.0.0.1", 0, kBackLog));
++    ASSERT_EQ(net::OK, listen_socket->GetLocalAddress(&proxy_endpoint_));
++    ASSERT_TRUE(
++        proxy_.Start(proxy_endpoint_.port(), std::move(listen_socket)));
++    proxy_.SetBackend(backend_.port(), base::FilePath());
++  }
++
++  void TearDown() override { proxy_.Stop(); }
++
++  void RunCase(const LoadCase& load_case) {
++    if (load_case.concurrency * load_case.body_bytes > kMaxBytesInFlight) {
++      LOG(INFO) << "Skipping " << GetStory(load_case)
++                << ": too many bytes in flight";
++      return;
++    }
++    // Enough requests per case for stable percentiles, fewer for big bodies
++    const size_t total = std::clamp<size_t>(
++        std::max<size_t>(load_case.concurrency * 4,
++                         kMaxBytesInFlight / 8 /
++                             std::max<size_t>(load_case.body_bytes, 1)),
++        load_case.concurrency, 2000);
++
++    const net::IPEndPoint backend_endpoint(net::IPAddress::IPv4Localhost(),
++                                           backend_.port());
++    const std::vector<RequestResult> direct =
++        LoadRunner(backend_endpoint, load_case, total).Run();
++
++    const size_t rss_before = GetPeakRssBytes();
++    base::ElapsedTimer timer;
++    const std::vector<RequestResult> proxied =
++        LoadRunner(proxy_endpoint_, load_case, total).Run();
++    const base::TimeDelta elapsed = timer.Elapsed();
++    const size_t rss_growth = GetPeakRssBytes() - rss_before;
++
++    size_t failures = 0;
++    size_t body_bytes = 0;
++    for (const RequestResult& result : proxied) {
++      failures += !result.ok;
++      body_bytes += result.body_bytes;
++    }
++    const std::vector<base::TimeDelta> latencies = SuccessfulLatencies(proxied);
++    const double seconds = std::max(elapsed.InSecondsF(), 1e-6);
++
++    perf_test::PerfResultReporter reporter(kMetricPrefix, GetStory(load_case));
++    reporter.RegisterImportantMetric(kRequestsPerSecond, "runs/s");
++    reporter.RegisterImportantMetric(kBytesPerSecond, "bytes/s");
++    reporter.RegisterImportantMetric(kLatencyP50, "ms");
++    reporter.RegisterImportantMetric(kLatencyP95, "ms");
++    reporter.RegisterImportantMetric(kAddedLatencyP50, "ms");
++    reporter.RegisterImportantMetric(kFailures, "count");
++    reporter.RegisterImportantMetric(kMemoryPerConnection, "bytes");
++    reporter.AddResult(kRequestsPerSecond, (total - failures) / seconds);
++    reporter.AddResult(kBytesPerSecond, body_bytes / seconds);
++    reporter.AddResult(kLatencyP50, Percentile(latencies, 0.5));
++    reporter.AddResult(kLatencyP95, Percentile(latencies, 0.95));
++    reporter.AddResult(kAddedLatencyP50,
++                       Percentile(latencies, 0.5) -
++                           Percentile(SuccessfulLatencies(direct), 0.5));
++    reporter.AddResult(kFailures, failures);
++    reporter.AddResult(kMemoryPerConnection,
++                       rss_growth / load_case.concurrency);
++  }
++
++ private:
++  base::test::TaskEnvironment task_environment_{
++      base::test::TaskEnvironment::MainThreadType::IO};
++  net::EmbeddedTestServer backend_;
++  BrowserOSServerProxy proxy_;
++  net::IPEndPoint proxy_endpoint_;
++};
++
++TEST_F(BrowserOSServerProxyPerfTest, SmallResponses) {
++  RunCase({8, kKB, base::TimeDelta(), base::TimeDelta()});
++}
++
++TEST_F(BrowserOSServerProxyPerfTest, MANUAL_ConcurrencySweep) {
++  for (base::TimeDelta latency : {base::TimeDelta(), base::Milliseconds(50)}) {
++    for (size_t concurrency : {1, 8, 32, 128, 512}) {
++      RunCase({concurrency, kKB, latency, base::TimeDelta()});
++    }
++  }
++}
++
++TEST_F(BrowserOSServerProxyPerfTest, MANUAL_BodySizeSweep) {
++  for (size_t concurrency : {1, 8, 32}) {
++    for (size_t body_bytes : {kKB, 64 * kKB, kMB, 5 * kMB, 20 * kMB}) {
++      RunCase({concurrency, body_bytes, base::TimeDelta(), base::TimeDelta()});
++    }
++  }
++}
++
++// Clients that don't read while a body larger than the proxy's queued
++// response limit (16 MB) streams in, as an overloaded sidecar client would
++TEST_F(BrowserOSServerProxyPerfTest, MANUAL_SlowReaders) {
++  for (size_t body_bytes : {8 * kMB, 20 * kMB}) {
++    RunCase({4, body_bytes, base::TimeDelta(), base::Seconds(2)});
++  }
++}
++
++}  // namespace
++}  // namespace browseros
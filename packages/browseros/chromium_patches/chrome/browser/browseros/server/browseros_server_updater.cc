@@ -1,48 +1,105 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_updater.cc b/chrome/browser/browseros/server/browseros_server_updater.cc
 new file mode 100644
-index 0000000000000..ced363ffbabc2
+index 0000000000000..b8478eb942145
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_updater.cc
-@@ -0,0 +1,1075 @@
+@@ -0,0 +1,1669 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_updater.h"
 +
++#include <map>
++#include <optional>
++
 +#include "base/base64.h"
 +#include "base/command_line.h"
 +#include "base/feature_list.h"
-+#include "base/files/file_enumerator.h"
 +#include "base/files/file_util.h"
++#include "base/files/important_file_writer.h"
++#include "base/files/memory_mapped_file.h"
 +#include "base/json/json_reader.h"
 +#include "base/logging.h"
++#include "base/memory/ref_counted.h"
++#include "base/notreached.h"
 +#include "base/path_service.h"
 +#include "base/process/launch.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/string_util.h"
++#include "base/synchronization/waitable_event.h"
 +#include "base/task/thread_pool.h"
 +#include "chrome/browser/browser_features.h"
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/core/browseros_update_scheduler.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +#include "chrome/browser/browseros/server/browseros_server_constants.h"
 +#include "chrome/browser/browseros/server/browseros_server_manager.h"
 +#include "chrome/browser/browseros/server/browseros_server_prefs.h"
++#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +#include "chrome/browser/net/system_network_context_manager.h"
 +#include "chrome/common/chrome_paths.h"
 +#include "components/prefs/pref_service.h"
++#include "crypto/sha2.h"
 +#include "net/base/net_errors.h"
++#include "net/http/http_byte_range.h"
++#include "net/http/http_request_headers.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
 +#include "net/traffic_annotation/network_traffic_annotation.h"
 +#include "services/network/public/cpp/resource_request.h"
 +#include "services/network/public/cpp/simple_url_loader.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
 +#include "third_party/boringssl/src/include/openssl/curve25519.h"
-+#include "third_party/zlib/google/zip.h"
 +#include "third_party/zlib/google/zip_reader.h"
++#include "ui/base/idle/idle.h"
 +#include "url/gurl.h"
 +
 +namespace browseros_server {
 +
++// Lets the UI thread hold back an extraction running on the thread pool.
++// The extraction waits between chunks while paused, for no more than
++// kMaxExtractionPause in total.
++class ExtractionThrottle
++    : public base::RefCountedThreadSafe<ExtractionThrottle> {
++ public:
++  ExtractionThrottle()
++      : resumed_(base::WaitableEvent::ResetPolicy::MANUAL,
++                 base::WaitableEvent::InitialState::SIGNALED) {}
++
++  ExtractionThrottle(const ExtractionThrottle&) = delete;
++  ExtractionThrottle& operator=(const ExtractionThrottle&) = delete;
++
++  void SetPaused(bool paused) {
++    if (paused) {
++      resumed_.Reset();
++    } else {
++      resumed_.Signal();
++    }
++  }
++
++  // Called by the extraction between chunks
++  void WaitWhilePaused() {
++    if (resumed_.IsSignaled() || paused_time_ >= kMaxExtractionPause) {
++      return;
++    }
++    const base::TimeTicks start = base::TimeTicks::Now();
++    resumed_.TimedWait(kMaxExtractionPause - paused_time_);
++    paused_time_ += base::TimeTicks::Now() - start;
++  }
++
++  // Only read once the extraction is done
++  base::TimeDelta paused_time() const { return paused_time_; }
++
++ private:
++  friend class base::RefCountedThreadSafe<ExtractionThrottle>;
++  ~ExtractionThrottle() = default;
++
++  base::WaitableEvent resumed_;
++  base::TimeDelta paused_time_;
++};
++
 +namespace {
 +
 +net::NetworkTrafficAnnotationTag GetAppcastTrafficAnnotation() {
@@ -52,7 +109,9 @@ index 0000000000000..ced363ffbabc2
 +      description:
 +        "Checks for updates to the BrowserOS server component by fetching "
 +        "an appcast XML feed."
-+      trigger: "Periodic check every 15 minutes while browser is running."
++      trigger:
++        "Periodic check about every 15 minutes while browser is running, "
++        "staggered against the browser's own update checks."
 +      data: "No user data sent, just an HTTP GET request."
 +      destination: OTHER
 +      internal {
@@ -76,7 +135,9 @@ index 0000000000000..ced363ffbabc2
 +      description:
 +        "Downloads a new version of the BrowserOS server component."
 +      trigger: "When a newer version is available in the appcast feed."
-+      data: "No user data sent, just an HTTP GET request for the ZIP package."
++      data:
++        "No user data sent, just an HTTP GET request for the ZIP package, "
++        "or for its remaining bytes when resuming an interrupted download."
 +      destination: OTHER
 +      internal {
 +        contacts {
@@ -146,18 +207,18 @@ index 0000000000000..ced363ffbabc2
 +    return false;
 +  }
 +
-+  // Read file contents
-+  std::string file_contents;
-+  if (!base::ReadFileToString(file_path, &file_contents)) {
-+    LOG(ERROR) << "browseros: Failed to read file for signature verification: "
++  // Map the file rather than copying it; the pages are shared with the
++  // concurrent extraction through the page cache
++  base::MemoryMappedFile file;
++  if (!file.Initialize(file_path) || !file.IsValid()) {
++    LOG(ERROR) << "browseros: Failed to map file for signature verification: "
 +               << file_path;
 +    return false;
 +  }
 +
 +  // Verify signature
-+  const uint8_t* message =
-+      reinterpret_cast<const uint8_t*>(file_contents.data());
-+  size_t message_len = file_contents.size();
++  const uint8_t* message = file.data();
++  size_t message_len = file.length();
 +  const uint8_t* sig = reinterpret_cast<const uint8_t*>(signature_bytes.data());
 +  const uint8_t* pub_key =
 +      reinterpret_cast<const uint8_t*>(public_key_bytes.data());
@@ -172,17 +233,46 @@ index 0000000000000..ced363ffbabc2
 +  return true;
 +}
 +
-+// Extracts ZIP file to destination directory.
++// Extracts ZIP file to destination directory, waiting on |throttle| after
++// every kExtractionChunkSize bytes written.
 +// Returns empty string on success, error message on failure.
 +std::string ExtractZipFile(const base::FilePath& zip_path,
-+                           const base::FilePath& dest_dir) {
++                           const base::FilePath& dest_dir,
++                           ExtractionThrottle* throttle) {
 +  // Ensure destination directory exists
 +  if (!base::CreateDirectory(dest_dir)) {
 +    return "Failed to create destination directory: " + dest_dir.AsUTF8Unsafe();
 +  }
 +
-+  // Use the zip::Unzip utility which handles the extraction properly
-+  if (!zip::Unzip(zip_path, dest_dir)) {
++  zip::ZipReader reader;
++  if (!reader.Open(zip_path)) {
++    return "Failed to open ZIP file";
++  }
++
++  int64_t chunk_bytes = 0;
++  while (const zip::ZipReader::Entry* entry = reader.Next()) {
++    if (entry->is_unsafe) {
++      return "Unsafe path in ZIP file: " + entry->path.AsUTF8Unsafe();
++    }
++    const base::FilePath target = dest_dir.Append(entry->path);
++    if (entry->is_directory) {
++      if (!base::CreateDirectory(target)) {
++        return "Failed to create directory: " + entry->path.AsUTF8Unsafe();
++      }
++      continue;
++    }
++    // Carries the executable bit over, as zip::Unzip() does
++    if (!reader.ExtractCurrentEntryToFilePath(target)) {
++      return "Failed to extract " + entry->path.AsUTF8Unsafe();
++    }
++
++    chunk_bytes += entry->original_size;
++    if (chunk_bytes >= kExtractionChunkSize) {
++      chunk_bytes = 0;
++      throttle->WaitWhilePaused();
++    }
++  }
++  if (!reader.ok()) {
 +    return "Failed to extract ZIP file";
 +  }
 +
@@ -190,6 +280,89 @@ index 0000000000000..ced363ffbabc2
 +  return "";  // Success
 +}
 +
++// Returns the hex SHA-256 of the file at |path|, or std::nullopt if it cannot
++// be read.
++std::optional<std::string> HashFileSha256(const base::FilePath& path) {
++  std::optional<int64_t> size = base::GetFileSize(path);
++  if (!size) {
++    return std::nullopt;
++  }
++  // Empty files cannot be mapped
++  if (*size == 0) {
++    return base::HexEncode(crypto::SHA256Hash(base::span<const uint8_t>()));
++  }
++  base::MemoryMappedFile file;
++  if (!file.Initialize(path) || !file.IsValid()) {
++    return std::nullopt;
++  }
++  return base::HexEncode(crypto::SHA256Hash(file.bytes()));
++}
++
++// Completes a delta package extracted to |staging_dir|. Its manifest maps
++// the relative path of every file in the new version to its SHA-256; files
++// the delta does not carry are copied unchanged from the installed version
++// in |base_dir|, and every file must then match its hash.
++// Returns empty string on success, error message on failure.
++std::string ApplyDeltaManifest(const base::FilePath& base_dir,
++                               const base::FilePath& staging_dir) {
++  const base::FilePath manifest_path =
++      staging_dir.AppendASCII(kDeltaManifestFileName);
++  std::string manifest_json;
++  if (!base::ReadFileToString(manifest_path, &manifest_json)) {
++    return "Delta package has no manifest";
++  }
++  base::DeleteFile(manifest_path);
++
++  std::optional<base::Value::Dict> manifest =
++      base::JSONReader::ReadDict(manifest_json);
++  const base::Value::Dict* files =
++      manifest ? manifest->FindDict("files") : nullptr;
++  if (!files || files->empty()) {
++    return "Invalid delta manifest";
++  }
++
++  std::map<base::FilePath, std::string> expected_hashes;
++  for (const auto [path, hash] : *files) {
++    base::FilePath relative =
++        base::FilePath::FromUTF8Unsafe(path).NormalizePathSeparators();
++    if (relative.empty() || relative.IsAbsolute() ||
++        relative.ReferencesParent() || !hash.is_string()) {
++      return "Invalid delta manifest entry: " + path;
++    }
++    expected_hashes[relative] = hash.GetString();
++  }
++
++  int copied = 0;
++  for (const auto& [relative, expected_hash] : expected_hashes) {
++    const base::FilePath target = staging_dir.Append(relative);
++    if (!base::PathExists(target)) {
++      // Unchanged since the installed version
++      const base::FilePath source = base_dir.Append(relative);
++      if (!base::CreateDirectory(target.DirName()) ||
++          !base::CopyFile(source, target)) {
++        return "Failed to copy unchanged file: " + relative.AsUTF8Unsafe();
++      }
++#if BUILDFLAG(IS_POSIX)
++      // CopyFile() does not carry the executable bit over
++      int mode = 0;
++      if (base::GetPosixFilePermissions(source, &mode)) {
++        base::SetPosixFilePermissions(target, mode);
++      }
++#endif
++      copied++;
++    }
++
++    std::optional<std::string> hash = HashFileSha256(target);
++    if (!hash || !base::EqualsCaseInsensitiveASCII(*hash, expected_hash)) {
++      return "Hash mismatch after applying delta: " + relative.AsUTF8Unsafe();
++    }
++  }
++
++  LOG(INFO) << "browseros: Applied delta, " << copied << " of "
++            << expected_hashes.size() << " files unchanged";
++  return "";  // Success
++}
++
 +// Runs binary with --version and captures output.
 +// Returns exit code and output via out parameters.
 +void RunBinaryVersionCheck(const base::FilePath& binary_path,
@@ -218,47 +391,137 @@ index 0000000000000..ced363ffbabc2
 +  }
 +}
 +
++// Returns the version recorded in the bundled server's build-time manifest,
++// or an empty string if there is none.
++std::string ReadServerManifestVersion(const base::FilePath& manifest_path) {
++  std::string manifest_json;
++  if (!base::ReadFileToString(manifest_path, &manifest_json)) {
++    return "";
++  }
++  std::optional<base::Value::Dict> manifest =
++      base::JSONReader::ReadDict(manifest_json);
++  const std::string* version =
++      manifest ? manifest->FindString("version") : nullptr;
++  if (!version || !base::Version(*version).IsValid()) {
++    return "";
++  }
++  return *version;
++}
++
++// Extraction running alongside signature verification
++struct ExtractJob {
++  base::WaitableEvent done;
++  std::string error;
++  base::TimeDelta duration;
++};
++
++void RunExtractJob(const base::FilePath& zip_path,
++                   const base::FilePath& dest_dir,
++                   ExtractionThrottle* throttle,
++                   ExtractJob* job) {
++  const base::TimeTicks start = base::TimeTicks::Now();
++  job->error = ExtractZipFile(zip_path, dest_dir, throttle);
++  job->duration = base::TimeTicks::Now() - start;
++  job->done.Signal();
++}
++
 +// Background task: verify signature + extract ZIP
 +struct VerifyExtractResult {
 +  bool success = false;
 +  std::string error;
 +};
 +
-+VerifyExtractResult DoVerifyAndExtract(const base::FilePath& zip_path,
-+                                       const std::string& signature,
-+                                       const base::FilePath& dest_dir) {
++// |base_dir| is the installed version a delta package applies to, or empty
++// for a full package.
++VerifyExtractResult DoVerifyAndExtract(
++    const base::FilePath& zip_path,
++    const std::string& signature,
++    const base::FilePath& dest_dir,
++    const base::FilePath& base_dir,
++    scoped_refptr<ExtractionThrottle> throttle) {
 +  VerifyExtractResult result;
-+
-+  // Step 1: Verify signature
-+  if (!VerifyEd25519Signature(zip_path, signature, kServerUpdatePublicKey)) {
-+    result.error = "Signature verification failed";
++  const base::TimeTicks start = base::TimeTicks::Now();
++  const int64_t zip_size = base::GetFileSize(zip_path).value_or(0);
++
++  // Ed25519 only answers once it has seen the whole archive, so it is
++  // extracted to a staging directory in parallel and moved into place only
++  // after the signature checks out. Unverified files never reach |dest_dir|.
++  const base::FilePath staging_dir = dest_dir.AddExtensionASCII("partial");
++  if (base::PathExists(staging_dir) &&
++      !base::DeletePathRecursively(staging_dir)) {
++    result.error = "Failed to clean stale staging directory";
 +    base::DeleteFile(zip_path);
 +    return result;
 +  }
 +
-+  // Step 2: Clean stale destination if exists (handles interrupted updates)
-+  if (base::PathExists(dest_dir)) {
-+    LOG(WARNING) << "browseros: Cleaning stale version directory: " << dest_dir;
-+    if (!base::DeletePathRecursively(dest_dir)) {
-+      result.error = "Failed to clean stale version directory";
-+      base::DeleteFile(zip_path);
-+      return result;
-+    }
++  // Step 1: Extract ZIP to staging while the signature is verified. At
++  // BEST_EFFORT this runs on a background thread, which also gets low I/O
++  // priority (THREAD_MODE_BACKGROUND_BEGIN on Windows, background QoS on
++  // macOS), so it doesn't compete with page loads for the disk.
++  ExtractJob extract;
++  base::ThreadPool::PostTask(
++      FROM_HERE,
++      {base::MayBlock(), base::WithBaseSyncPrimitives(),
++       base::TaskPriority::BEST_EFFORT},
++      base::BindOnce(&RunExtractJob, zip_path, staging_dir,
++                     base::Unretained(throttle.get()),
++                     base::Unretained(&extract)));
++
++  // Step 2: Verify signature
++  const base::TimeTicks verify_start = base::TimeTicks::Now();
++  const bool verified =
++      VerifyEd25519Signature(zip_path, signature, kServerUpdatePublicKey);
++  const base::TimeDelta verify_time = base::TimeTicks::Now() - verify_start;
++
++  // |extract| lives on this stack
++  extract.done.Wait();
++
++  // The delta manifest is only trusted once the signature is
++  std::string delta_error;
++  if (verified && extract.error.empty() && !base_dir.empty()) {
++    delta_error = ApplyDeltaManifest(base_dir, staging_dir);
 +  }
 +
-+  // Step 3: Extract ZIP
-+  std::string extract_error = ExtractZipFile(zip_path, dest_dir);
-+  if (!extract_error.empty()) {
-+    result.error = extract_error;
-+    // Cleanup partial extraction
-+    base::DeletePathRecursively(dest_dir);
-+    base::DeleteFile(zip_path);
-+    return result;
++  if (!verified) {
++    result.error = "Signature verification failed";
++  } else if (!extract.error.empty()) {
++    result.error = extract.error;
++  } else if (!delta_error.empty()) {
++    result.error = delta_error;
++  } else if (base::PathExists(dest_dir) &&
++             !base::DeletePathRecursively(dest_dir)) {
++    // Stale destination from an interrupted update
++    result.error = "Failed to clean stale version directory";
++  } else if (!base::Move(staging_dir, dest_dir)) {
++    result.error = "Failed to move extracted files into place";
++  } else {
++    result.success = true;
 +  }
 +
-+  // Success - delete the ZIP file (we have extracted contents)
++  if (!result.success) {
++    // Cleanup partial extraction
++    base::DeletePathRecursively(staging_dir);
++  }
++  // The ZIP is no longer needed either way
 +  base::DeleteFile(zip_path);
-+  result.success = true;
++
++  const base::TimeDelta total_time = base::TimeTicks::Now() - start;
++  LOG(INFO) << "browseros: Verify and extract took "
++            << total_time.InMilliseconds() << "ms (verify "
++            << verify_time.InMilliseconds() << "ms, extract "
++            << extract.duration.InMilliseconds() << "ms, of which paused "
++            << throttle->paused_time().InMilliseconds() << "ms)";
++
++  base::Value::Dict props;
++  props.Set("success", result.success);
++  props.Set("delta", !base_dir.empty());
++  props.Set("zip_mb", static_cast<double>(zip_size) / (1024 * 1024));
++  props.Set("verify_ms", verify_time.InMillisecondsF());
++  props.Set("extract_ms", extract.duration.InMillisecondsF());
++  props.Set("extract_paused_ms", throttle->paused_time().InMillisecondsF());
++  props.Set("total_ms", total_time.InMillisecondsF());
++  browseros_metrics::BrowserOSMetrics::Log("server.ota.verify_extract",
++                                           std::move(props));
 +  return result;
 +}
 +
@@ -266,7 +529,10 @@ index 0000000000000..ced363ffbabc2
 +
 +BrowserOSServerUpdater::BrowserOSServerUpdater(
 +    browseros::BrowserOSServerManager* manager)
-+    : manager_(manager) {}
++    : manager_(manager),
++      version_file_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
++           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})) {}
 +
 +BrowserOSServerUpdater::~BrowserOSServerUpdater() {
 +  Stop();
@@ -278,8 +544,13 @@ index 0000000000000..ced363ffbabc2
 +  // Load both version caches async, then start checking
 +  LoadVersionCachesAsync();
 +
-+  update_check_timer_.Start(FROM_HERE, kUpdateCheckInterval, this,
-+                            &BrowserOSServerUpdater::OnUpdateTimer);
++  // The scheduler keeps checks clear of startup and of the browser's own
++  // update checks
++  browseros::BrowserOSUpdateScheduler::GetInstance()->RegisterClient(
++      browseros::BrowserOSUpdateScheduler::Client::kServer,
++      kUpdateCheckInterval,
++      base::BindRepeating(&BrowserOSServerUpdater::OnScheduledCheck,
++                          weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSServerUpdater::LoadVersionCachesAsync() {
@@ -287,8 +558,9 @@ index 0000000000000..ced363ffbabc2
 +  base::FilePath version_file =
 +      GetExecutionDir().AppendASCII(kCurrentVersionFileName);
 +
-+  base::ThreadPool::PostTaskAndReplyWithResult(
-+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++  // Read once here; launches resolve the server from the cached versions
++  version_file_task_runner_->PostTaskAndReplyWithResult(
++      FROM_HERE,
 +      base::BindOnce(
 +          [](base::FilePath path) -> std::string {
 +            std::string content;
@@ -303,18 +575,29 @@ index 0000000000000..ced363ffbabc2
 +      base::BindOnce(&BrowserOSServerUpdater::OnDownloadedVersionLoaded,
 +                     weak_factory_.GetWeakPtr()));
 +
-+  // Get bundled version by running binary with --version
++  // Get bundled version from the manifest written at build time. Only
++  // builds without one (custom resources dir, cross-compiled without
++  // browseros_server_version) pay for running the binary with --version.
++  base::FilePath manifest_path =
++      GetBundledResourcesPath().AppendASCII(kServerManifestFileName);
 +  base::FilePath bundled_binary = GetBundledBinaryPath();
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
 +      base::BindOnce(
-+          [](base::FilePath path) -> std::pair<int, std::string> {
++          [](base::FilePath manifest_path,
++             base::FilePath path) -> std::pair<int, std::string> {
++            std::string version = ReadServerManifestVersion(manifest_path);
++            if (!version.empty()) {
++              return {0, version};
++            }
++            LOG(INFO) << "browseros: No version in " << manifest_path
++                      << ", running bundled binary with --version";
 +            int exit_code = 0;
 +            std::string output;
 +            RunBinaryVersionCheck(path, &exit_code, &output);
 +            return {exit_code, output};
 +          },
-+          bundled_binary),
++          manifest_path, bundled_binary),
 +      base::BindOnce(
 +          [](base::WeakPtr<BrowserOSServerUpdater> self,
 +             std::pair<int, std::string> result) {
@@ -372,13 +655,16 @@ index 0000000000000..ced363ffbabc2
 +    }
 +  }
 +
-+  // Now trigger the first check
-+  CheckNow();
++  // Leftovers of a cleanup cut short by shutdown, or a quota change
++  CleanupOldVersions();
++
++  // The first check is left to BrowserOSUpdateScheduler
 +}
 +
 +void BrowserOSServerUpdater::Stop() {
 +  LOG(INFO) << "browseros: Stopping server updater";
-+  update_check_timer_.Stop();
++  browseros::BrowserOSUpdateScheduler::GetInstance()->UnregisterClient(
++      browseros::BrowserOSUpdateScheduler::Client::kServer);
 +  appcast_loader_.reset();
 +  download_loader_.reset();
 +  status_loader_.reset();
@@ -403,7 +689,7 @@ index 0000000000000..ced363ffbabc2
 +  FetchAppcast();
 +}
 +
-+void BrowserOSServerUpdater::OnUpdateTimer() {
++void BrowserOSServerUpdater::OnScheduledCheck() {
 +  CheckNow();
 +}
 +
@@ -437,6 +723,19 @@ index 0000000000000..ced363ffbabc2
 +  request->method = "GET";
 +  request->credentials_mode = network::mojom::CredentialsMode::kOmit;
 +
++  // With a cached parse, the feed is only sent again once it changes
++  PrefService* prefs = g_browser_process->local_state();
++  if (prefs && GetCachedAppcastItem(appcast_url)) {
++    const base::Value::Dict& cache = prefs->GetDict(kServerAppcastCache);
++    if (const std::string* etag = cache.FindString("etag")) {
++      request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch, *etag);
++    }
++    if (const std::string* last_modified = cache.FindString("last_modified")) {
++      request->headers.SetHeader(net::HttpRequestHeaders::kIfModifiedSince,
++                                 *last_modified);
++    }
++  }
++
 +  appcast_loader_ = network::SimpleURLLoader::Create(
 +      std::move(request), GetAppcastTrafficAnnotation());
 +  appcast_loader_->SetTimeoutDuration(kAppcastFetchTimeout);
@@ -447,13 +746,26 @@ index 0000000000000..ced363ffbabc2
 +  appcast_loader_->DownloadToString(
 +      url_loader_factory,
 +      base::BindOnce(&BrowserOSServerUpdater::OnAppcastFetched,
-+                     weak_factory_.GetWeakPtr()),
++                     weak_factory_.GetWeakPtr(), appcast_url),
 +      kMaxAppcastSize);
 +}
 +
 +void BrowserOSServerUpdater::OnAppcastFetched(
++    const std::string& appcast_url,
 +    std::unique_ptr<std::string> response) {
 +  if (!response) {
++    const network::mojom::URLResponseHead* info =
++        appcast_loader_->ResponseInfo();
++    if (info && info->headers &&
++        info->headers->response_code() == net::HTTP_NOT_MODIFIED) {
++      std::optional<AppcastItem> cached = GetCachedAppcastItem(appcast_url);
++      if (cached) {
++        LOG(INFO) << "browseros: Appcast not modified, using cached parse";
++        OnAppcastItem(*cached);
++        return;
++      }
++    }
++
 +    int net_error = appcast_loader_->NetError();
 +    OnError("check",
 +            "Failed to fetch appcast: " + net::ErrorToString(net_error));
@@ -470,11 +782,70 @@ index 0000000000000..ced363ffbabc2
 +    return;
 +  }
 +
++  CacheAppcastItem(appcast_url, *item);
++  OnAppcastItem(*item);
++}
++
++std::optional<AppcastItem> BrowserOSServerUpdater::GetCachedAppcastItem(
++    const std::string& appcast_url) const {
++  PrefService* prefs = g_browser_process->local_state();
++  if (!prefs) {
++    return std::nullopt;
++  }
++  const base::Value::Dict& cache = prefs->GetDict(kServerAppcastCache);
++  const std::string* url = cache.FindString("url");
++  const base::Value::Dict* item = cache.FindDict("item");
++  if (!url || *url != appcast_url || !item) {
++    return std::nullopt;
++  }
++  return AppcastItem::FromValue(*item);
++}
++
++void BrowserOSServerUpdater::CacheAppcastItem(const std::string& appcast_url,
++                                              const AppcastItem& item) {
++  PrefService* prefs = g_browser_process->local_state();
++  if (!prefs) {
++    return;
++  }
++
++  const network::mojom::URLResponseHead* info =
++      appcast_loader_->ResponseInfo();
++  std::optional<std::string> etag;
++  std::optional<std::string> last_modified;
++  if (info && info->headers) {
++    etag = info->headers->GetNormalizedHeader("ETag");
++    last_modified = info->headers->GetNormalizedHeader("Last-Modified");
++  }
++  if (!etag && !last_modified) {
++    // Nothing to send a conditional request with
++    prefs->ClearPref(kServerAppcastCache);
++    return;
++  }
++
++  // Only this platform's enclosures are ever looked at again
++  AppcastItem cached_item = item;
++  std::erase_if(cached_item.enclosures, [](const AppcastEnclosure& enclosure) {
++    return !enclosure.MatchesCurrentPlatform();
++  });
++
++  base::Value::Dict cache;
++  cache.Set("url", appcast_url);
++  if (etag) {
++    cache.Set("etag", *etag);
++  }
++  if (last_modified) {
++    cache.Set("last_modified", *last_modified);
++  }
++  cache.Set("item", cached_item.ToValue());
++  prefs->SetDict(kServerAppcastCache, std::move(cache));
++}
++
++void BrowserOSServerUpdater::OnAppcastItem(const AppcastItem& item) {
 +  LOG(INFO) << "browseros: Latest version in appcast: "
-+            << item->version.GetString();
++            << item.version.GetString();
 +
 +  // Find enclosure for current platform
-+  const AppcastEnclosure* enclosure = item->GetEnclosureForCurrentPlatform();
++  const AppcastEnclosure* enclosure = item.GetEnclosureForCurrentPlatform();
 +  if (!enclosure) {
 +    OnError("check", "No enclosure found for current platform");
 +    return;
@@ -488,17 +859,32 @@ index 0000000000000..ced363ffbabc2
 +  LOG(INFO) << "browseros: Current version: "
 +            << (current.IsValid() ? current.GetString() : "(none)");
 +
-+  if (current.IsValid() && current >= item->version) {
++  if (current.IsValid() && current >= item.version) {
 +    LOG(INFO) << "browseros: Already up to date";
 +    ResetState();
 +    return;
 +  }
 +
 +  LOG(INFO) << "browseros: New version available: "
-+            << item->version.GetString();
-+  pending_item_ = *item;
++            << item.version.GetString();
++  pending_item_ = item;
++  pending_full_enclosure_ = *enclosure;
++  pending_delta_from_ = base::Version();
++
++  // Deltas apply to a version under versions/, not the bundled server
++  if (current.IsValid() && current == cached_downloaded_version_) {
++    const AppcastEnclosure* delta =
++        item.GetDeltaEnclosureForCurrentPlatform(current);
++    if (delta) {
++      LOG(INFO) << "browseros: Using delta from " << current.GetString()
++                << ": " << delta->url;
++      pending_delta_from_ = current;
++      enclosure = delta;
++    }
++  }
++
 +  pending_signature_ = enclosure->signature;
-+  CheckVersionAlreadyDownloaded(*enclosure, item->version);
++  CheckVersionAlreadyDownloaded(*enclosure, item.version);
 +}
 +
 +void BrowserOSServerUpdater::CheckVersionAlreadyDownloaded(
@@ -524,7 +910,12 @@ index 0000000000000..ced363ffbabc2
 +    return;
 +  }
 +
-+  StartDownload(enclosure, version);
++  // Waits while the machine is busy or on battery; the update stays in
++  // progress meanwhile, so scheduled checks skip
++  browseros::BrowserOSUpdateScheduler::GetInstance()->RunWhenIdle(
++      browseros::BrowserOSUpdateScheduler::Client::kServer,
++      base::BindOnce(&BrowserOSServerUpdater::StartDownload,
++                     weak_factory_.GetWeakPtr(), enclosure, version));
 +}
 +
 +void BrowserOSServerUpdater::StartDownload(const AppcastEnclosure& enclosure,
@@ -537,89 +928,228 @@ index 0000000000000..ced363ffbabc2
 +    return;
 +  }
 +
-+  // Prepare pending update directory
 +  base::FilePath pending_dir = GetPendingUpdateDir();
++  discard_partial_download_ = false;
++  download_file_.emplace(
++      base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_VISIBLE}),
++      pending_dir.AppendASCII(kDownloadFileName),
++      pending_dir.AppendASCII(kDownloadStateFileName));
++
++  // Keeps what an earlier attempt left of this package, clears the rest
++  download_file_.AsyncCall(&ResumableDownloadFile::Prepare)
++      .WithArgs(enclosure.url)
++      .Then(base::BindOnce(&BrowserOSServerUpdater::OnDownloadPrepared,
++                           weak_factory_.GetWeakPtr(), enclosure, version));
++}
 +
-+  // Clean up any previous pending update on background thread, then download
-+  base::ThreadPool::PostTaskAndReply(
-+      FROM_HERE, {base::MayBlock()},
-+      base::BindOnce(
-+          [](base::FilePath dir) {
-+            if (base::PathExists(dir)) {
-+              base::DeletePathRecursively(dir);
-+            }
-+            base::CreateDirectory(dir);
-+          },
-+          pending_dir),
-+      base::BindOnce(
-+          [](base::WeakPtr<BrowserOSServerUpdater> self,
-+             const AppcastEnclosure& enc, const base::Version& ver) {
-+            if (!self) {
-+              return;
-+            }
++void BrowserOSServerUpdater::OnDownloadPrepared(
++    const AppcastEnclosure& enclosure,
++    const base::Version& version,
++    ResumableDownloadFile::ResumePoint resume) {
++  if (state_ != State::kDownloading) {
++    return;  // Stopped meanwhile
++  }
 +
-+            GURL download_url(enc.url);
-+            LOG(INFO) << "browseros: Downloading " << download_url;
-+
-+            auto request = std::make_unique<network::ResourceRequest>();
-+            request->url = download_url;
-+            request->method = "GET";
-+            request->credentials_mode = network::mojom::CredentialsMode::kOmit;
-+
-+            self->download_loader_ = network::SimpleURLLoader::Create(
-+                std::move(request), GetDownloadTrafficAnnotation());
-+            self->download_loader_->SetTimeoutDuration(kDownloadTimeout);
-+
-+            // Add progress logging (visible with --vmodule=*browseros*=1)
-+            self->download_loader_->SetOnDownloadProgressCallback(
-+                base::BindRepeating([](uint64_t current) {
-+                  LOG(INFO) << "browseros: Download progress: "
-+                            << (current / 1024 / 1024) << " MB";
-+                }));
-+
-+            base::FilePath download_path =
-+                self->GetPendingUpdateDir().AppendASCII(kDownloadFileName);
-+
-+            auto* url_loader_factory =
-+                g_browser_process->system_network_context_manager()
-+                    ->GetURLLoaderFactory();
-+
-+            self->download_loader_->DownloadToFile(
-+                url_loader_factory,
-+                base::BindOnce(&BrowserOSServerUpdater::OnDownloadComplete,
-+                               self, ver),
-+                download_path);
-+          },
-+          weak_factory_.GetWeakPtr(), enclosure, version));
++  GURL download_url(enclosure.url);
++  LOG(INFO) << "browseros: Downloading " << download_url;
++
++  auto request = std::make_unique<network::ResourceRequest>();
++  request->url = download_url;
++  request->method = "GET";
++  request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++  if (resume.offset > 0) {
++    LOG(INFO) << "browseros: Resuming download at "
++              << (resume.offset / 1024 / 1024) << " MB";
++    request->headers.SetHeader(
++        net::HttpRequestHeaders::kRange,
++        net::HttpByteRange::RightUnbounded(resume.offset).GetHeaderValue());
++    // The server sends the whole package instead if it changed
++    request->headers.SetHeader("If-Range", resume.validator);
++  }
++
++  download_loader_ = network::SimpleURLLoader::Create(
++      std::move(request), GetDownloadTrafficAnnotation());
++  download_loader_->SetTimeoutDuration(kDownloadTimeout);
++
++  // Add progress logging (visible with --vmodule=*browseros*=1)
++  download_loader_->SetOnDownloadProgressCallback(base::BindRepeating(
++      [](int64_t offset, uint64_t current) {
++        LOG(INFO) << "browseros: Download progress: "
++                  << ((offset + current) / 1024 / 1024) << " MB";
++      },
++      resume.offset));
++  download_loader_->SetOnResponseStartedCallback(
++      base::BindOnce(&BrowserOSServerUpdater::OnDownloadResponseStarted,
++                     weak_factory_.GetWeakPtr(), resume.offset,
++                     enclosure.url));
++
++  auto* url_loader_factory = g_browser_process->system_network_context_manager()
++                                 ->GetURLLoaderFactory();
++  download_loader_->DownloadAsStream(url_loader_factory, this);
++}
++
++void BrowserOSServerUpdater::OnDownloadResponseStarted(
++    int64_t resume_offset,
++    const std::string& url,
++    const GURL& final_url,
++    const network::mojom::URLResponseHead& response_head) {
++  const net::HttpResponseHeaders* headers = response_head.headers.get();
++  const int status = headers ? headers->response_code() : 0;
++
++  int64_t offset = 0;
++  if (status == net::HTTP_PARTIAL_CONTENT) {
++    int64_t first_byte = -1;
++    int64_t last_byte = -1;
++    int64_t length = -1;
++    if (!headers->GetContentRangeFor206(&first_byte, &last_byte, &length) ||
++        first_byte != resume_offset) {
++      LOG(WARNING) << "browseros: Unexpected Content-Range, restarting "
++                   << "download from scratch";
++      discard_partial_download_ = true;
++      return;
++    }
++    offset = resume_offset;
++  } else if (status != net::HTTP_OK) {
++    // Fails the download; e.g. 416 for a partial file longer than the package
++    discard_partial_download_ = true;
++    return;
++  } else if (resume_offset > 0) {
++    LOG(INFO) << "browseros: Package changed since the interrupted download, "
++              << "starting over";
++  }
++
++  // If-Range only accepts strong ETags
++  std::string validator;
++  std::optional<std::string> etag = headers->GetNormalizedHeader("ETag");
++  if (etag && !base::StartsWith(*etag, "W/")) {
++    validator = *etag;
++  } else {
++    validator = headers->GetNormalizedHeader("Last-Modified").value_or("");
++  }
++
++  download_file_.AsyncCall(&ResumableDownloadFile::Begin)
++      .WithArgs(offset, url, std::move(validator));
++}
++
++void BrowserOSServerUpdater::OnDataReceived(std::string_view string_view,
++                                            base::OnceClosure resume) {
++  download_file_.AsyncCall(&ResumableDownloadFile::Write)
++      .WithArgs(std::string(string_view))
++      .Then(base::BindOnce(&BrowserOSServerUpdater::OnDownloadChunkWritten,
++                           weak_factory_.GetWeakPtr(), std::move(resume)));
++}
++
++void BrowserOSServerUpdater::OnDownloadChunkWritten(base::OnceClosure resume,
++                                                    bool success) {
++  if (!download_loader_) {
++    return;
++  }
++  if (!success) {
++    discard_partial_download_ = true;
++    FinishDownload("Failed to write download to disk");
++    return;
++  }
++  std::move(resume).Run();
++}
++
++void BrowserOSServerUpdater::OnComplete(bool success) {
++  if (success) {
++    FinishDownload(std::string());
++    return;
++  }
++  FinishDownload("Download failed: " +
++                 net::ErrorToString(download_loader_->NetError()));
++}
++
++void BrowserOSServerUpdater::OnRetry(base::OnceClosure start_retry) {
++  // No retries are configured on the download loader
++  NOTREACHED();
++}
++
++void BrowserOSServerUpdater::FinishDownload(const std::string& error) {
++  download_loader_.reset();
++  download_file_.AsyncCall(&ResumableDownloadFile::Finish)
++      .WithArgs(error.empty(), discard_partial_download_)
++      .Then(base::BindOnce(&BrowserOSServerUpdater::OnDownloadComplete,
++                           weak_factory_.GetWeakPtr(), pending_item_.version,
++                           error));
 +}
 +
 +void BrowserOSServerUpdater::OnDownloadComplete(const base::Version& version,
-+                                                base::FilePath zip_path) {
-+  if (zip_path.empty()) {
-+    int net_error = download_loader_->NetError();
-+    OnError("download", "Download failed: " + net::ErrorToString(net_error));
++                                                std::string error,
++                                                bool file_closed) {
++  if (state_ != State::kDownloading) {
++    return;  // Stopped meanwhile
++  }
++  download_file_.Reset();
++  if (error.empty() && !file_closed) {
++    error = "Download produced no file";
++  }
++  if (!error.empty()) {
++    if (!FallBackToFullPackage(error)) {
++      OnError("download", error);
++    }
 +    return;
 +  }
 +
++  base::FilePath zip_path =
++      GetPendingUpdateDir().AppendASCII(kDownloadFileName);
 +  LOG(INFO) << "browseros: Download complete: " << zip_path;
 +
 +  // Now verify and extract
 +  VerifyAndExtract(zip_path, pending_signature_, version);
 +}
 +
++bool BrowserOSServerUpdater::FallBackToFullPackage(const std::string& error) {
++  if (!pending_delta_from_.IsValid()) {
++    return false;
++  }
++
++  LOG(WARNING) << "browseros: Delta update failed (" << error
++               << "), downloading full package";
++
++  base::Value::Dict props;
++  props.Set("version", pending_item_.version.GetString());
++  props.Set("from_version", pending_delta_from_.GetString());
++  props.Set("error", error);
++  browseros_metrics::BrowserOSMetrics::Log("server.ota.delta_fallback",
++                                           std::move(props));
++
++  pending_delta_from_ = base::Version();
++  pending_signature_ = pending_full_enclosure_.signature;
++  StartDownload(pending_full_enclosure_, pending_item_.version);
++  return true;
++}
++
 +void BrowserOSServerUpdater::VerifyAndExtract(const base::FilePath& zip_path,
 +                                              const std::string& signature,
 +                                              const base::Version& version) {
 +  state_ = State::kVerifying;
 +
 +  base::FilePath dest_dir = GetVersionDir(version);
++  base::FilePath base_dir;
++  if (pending_delta_from_.IsValid()) {
++    base_dir = GetVersionDir(pending_delta_from_);
++  }
 +
 +  LOG(INFO) << "browseros: Verifying signature and extracting to " << dest_dir;
 +
-+  // Run verification and extraction on background thread
++  extraction_throttle_ = base::MakeRefCounted<ExtractionThrottle>();
++  UpdateExtractionThrottle();
++  extraction_throttle_timer_.Start(
++      FROM_HERE, kExtractionThrottleInterval, this,
++      &BrowserOSServerUpdater::UpdateExtractionThrottle);
++
++  // Run verification and extraction on background threads; the task waits
++  // for the extraction it starts. Nothing waits on the update, so both run
++  // at background priority.
 +  base::ThreadPool::PostTaskAndReplyWithResult(
-+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(&DoVerifyAndExtract, zip_path, signature, dest_dir),
++      FROM_HERE,
++      {base::MayBlock(), base::WithBaseSyncPrimitives(),
++       base::TaskPriority::BEST_EFFORT},
++      base::BindOnce(&DoVerifyAndExtract, zip_path, signature, dest_dir,
++                     base_dir, extraction_throttle_),
 +      base::BindOnce(
 +          [](base::WeakPtr<BrowserOSServerUpdater> self, base::Version version,
 +             VerifyExtractResult result) {
@@ -636,8 +1166,12 @@ index 0000000000000..ced363ffbabc2
 +    const base::Version& version,
 +    bool success,
 +    const std::string& error) {
++  StopExtractionThrottle();
++
 +  if (!success) {
-+    OnError("verify", error);
++    if (!FallBackToFullPackage(error)) {
++      OnError("verify", error);
++    }
 +    return;
 +  }
 +
@@ -647,15 +1181,86 @@ index 0000000000000..ced363ffbabc2
 +  TestBinary(version);
 +}
 +
++void BrowserOSServerUpdater::UpdateExtractionThrottle() {
++  // Recent input means the user is browsing; IsIdle() covers agents at
++  // work, battery and thermal pressure, as for downloads
++  const bool user_active =
++      base::Seconds(ui::CalculateIdleTime()) < kExtractionUserIdleTime;
++  extraction_throttle_->SetPaused(
++      user_active ||
++      !browseros::BrowserOSUpdateScheduler::GetInstance()->IsIdle());
++}
++
++void BrowserOSServerUpdater::StopExtractionThrottle() {
++  extraction_throttle_timer_.Stop();
++  if (extraction_throttle_) {
++    // Lets an extraction still running finish without waiting
++    extraction_throttle_->SetPaused(false);
++    extraction_throttle_.reset();
++  }
++}
++
 +void BrowserOSServerUpdater::TestBinary(const base::Version& version) {
 +  state_ = State::kTesting;
 +
 +  base::FilePath binary_path = GetDownloadedBinaryPath(version);
++  base::FilePath manifest_path =
++      GetDownloadedResourcesPath(version).AppendASCII(kServerManifestFileName);
++
++  // Reading the manifest saves spawning the server runtime just to learn
++  // its version. std::nullopt means the binary is missing altogether.
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(
++          [](base::FilePath binary_path,
++             base::FilePath manifest_path) -> std::optional<std::string> {
++            if (!base::PathExists(binary_path)) {
++              return std::nullopt;
++            }
++            return ReadServerManifestVersion(manifest_path);
++          },
++          binary_path, manifest_path),
++      base::BindOnce(&BrowserOSServerUpdater::OnServerManifestRead,
++                     weak_factory_.GetWeakPtr(), version));
++}
++
++void BrowserOSServerUpdater::OnServerManifestRead(
++    const base::Version& version,
++    std::optional<std::string> manifest_version) {
++  if (!manifest_version) {
++    DiscardBrokenVersion(version, "Server binary missing from package");
++    return;
++  }
++
++  if (!manifest_version->empty()) {
++    // The manifest came out of the signed package
++    if (base::Version(*manifest_version) != version) {
++      DiscardBrokenVersion(version, "Package manifest is for version " +
++                                        *manifest_version);
++      return;
++    }
++    LOG(INFO) << "browseros: Package manifest confirms version "
++              << version.GetString();
++    CheckServerStatus();
++    return;
++  }
++
++  // Packages from before the manifest. Nothing waits on the update, so the
++  // spawn is left for when the machine is idle.
++  LOG(INFO) << "browseros: No manifest in package, testing binary when idle";
++  browseros::BrowserOSUpdateScheduler::GetInstance()->RunWhenIdle(
++      browseros::BrowserOSUpdateScheduler::Client::kServer,
++      base::BindOnce(&BrowserOSServerUpdater::RunBinarySmokeTest,
++                     weak_factory_.GetWeakPtr(), version));
++}
++
++void BrowserOSServerUpdater::RunBinarySmokeTest(const base::Version& version) {
++  base::FilePath binary_path = GetDownloadedBinaryPath(version);
 +  LOG(INFO) << "browseros: Testing binary: " << binary_path;
 +
 +  // Run version check on background thread
 +  base::ThreadPool::PostTaskAndReplyWithResult(
-+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::BEST_EFFORT},
 +      base::BindOnce(
 +          [](base::FilePath path) -> std::pair<int, std::string> {
 +            int exit_code = 0;
@@ -681,16 +1286,7 @@ index 0000000000000..ced363ffbabc2
 +  if (exit_code != 0) {
 +    LOG(ERROR) << "browseros: Binary test failed with exit code " << exit_code
 +               << ": " << output;
-+
-+    // Delete the broken version
-+    base::FilePath version_dir = GetVersionDir(version);
-+    base::ThreadPool::PostTask(
-+        FROM_HERE, {base::MayBlock()},
-+        base::BindOnce(
-+            [](base::FilePath dir) { base::DeletePathRecursively(dir); },
-+            version_dir));
-+
-+    OnError("verify", "Binary --version check failed");
++    DiscardBrokenVersion(version, "Binary --version check failed");
 +    return;
 +  }
 +
@@ -700,6 +1296,18 @@ index 0000000000000..ced363ffbabc2
 +  CheckServerStatus();
 +}
 +
++void BrowserOSServerUpdater::DiscardBrokenVersion(const base::Version& version,
++                                                  const std::string& error) {
++  base::FilePath version_dir = GetVersionDir(version);
++  base::ThreadPool::PostTask(
++      FROM_HERE, {base::MayBlock()},
++      base::BindOnce(
++          [](base::FilePath dir) { base::DeletePathRecursively(dir); },
++          version_dir));
++
++  OnError("verify", error);
++}
++
 +void BrowserOSServerUpdater::CheckServerStatus() {
 +  GURL status_url("http://127.0.0.1:" +
 +                  base::NumberToString(manager_->GetServerPort()) + "/status");
@@ -862,18 +1470,23 @@ index 0000000000000..ced363ffbabc2
 +  base::FilePath version_file =
 +      GetExecutionDir().AppendASCII(kCurrentVersionFileName);
 +
++  // Written through a temp file and a rename, so a crash mid-write can't
++  // leave a truncated version that points the next launch nowhere
 +  if (version.IsValid()) {
-+    base::ThreadPool::PostTask(
-+        FROM_HERE, {base::MayBlock()},
++    version_file_task_runner_->PostTask(
++        FROM_HERE,
 +        base::BindOnce(
 +            [](base::FilePath path, std::string content) {
-+              base::WriteFile(path, content);
++              if (!base::ImportantFileWriter::WriteFileAtomically(path,
++                                                                  content)) {
++                LOG(ERROR) << "browseros: Failed to write " << path;
++              }
 +            },
 +            version_file, version.GetString()));
 +  } else {
 +    // Delete file when clearing downloaded version
-+    base::ThreadPool::PostTask(
-+        FROM_HERE, {base::MayBlock()},
++    version_file_task_runner_->PostTask(
++        FROM_HERE,
 +        base::BindOnce([](base::FilePath path) { base::DeleteFile(path); },
 +                       version_file));
 +  }
@@ -988,50 +1601,24 @@ index 0000000000000..ced363ffbabc2
 +}
 +
 +void BrowserOSServerUpdater::CleanupOldVersions() {
-+  base::FilePath versions_dir = GetVersionsDir();
-+
-+  base::ThreadPool::PostTask(
-+      FROM_HERE, {base::MayBlock()},
-+      base::BindOnce(
-+          [](base::FilePath dir, int max_to_keep) {
-+            if (!base::PathExists(dir)) {
-+              return;
-+            }
-+
-+            // Collect all version directories
-+            std::vector<std::pair<base::Version, base::FilePath>> versions;
-+            base::FileEnumerator enumerator(dir, false,
-+                                            base::FileEnumerator::DIRECTORIES);
-+            for (base::FilePath path = enumerator.Next(); !path.empty();
-+                 path = enumerator.Next()) {
-+              base::Version v(path.BaseName().AsUTF8Unsafe());
-+              if (v.IsValid()) {
-+                versions.emplace_back(v, path);
-+              }
-+            }
-+
-+            // Sort by version (newest first)
-+            std::sort(
-+                versions.begin(), versions.end(),
-+                [](const auto& a, const auto& b) { return a.first > b.first; });
-+
-+            // Delete old versions beyond the keep limit
-+            int deleted = 0;
-+            for (size_t i = max_to_keep; i < versions.size(); ++i) {
-+              LOG(INFO) << "browseros: Cleaning up old version: "
-+                        << versions[i].first.GetString();
-+              base::DeletePathRecursively(versions[i].second);
-+              deleted++;
-+            }
-+
-+            if (deleted > 0) {
-+              base::Value::Dict props;
-+              props.Set("deleted_count", deleted);
-+              browseros_metrics::BrowserOSMetrics::Log("server.ota.cleanup",
-+                                                       std::move(props));
-+            }
-+          },
-+          versions_dir, kMaxVersionsToKeep));
++  // Nothing waits on the cleanup, so it runs in the background and is simply
++  // picked up again on the next start if shutdown cuts it short
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&browseros::server_utils::PruneServerVersions,
++                     GetVersionsDir(), GetCurrentVersion(),
++                     static_cast<size_t>(kMaxVersionsToKeep),
++                     kVersionsDiskQuota),
++      base::BindOnce([](int deleted) {
++        if (deleted > 0) {
++          base::Value::Dict props;
++          props.Set("deleted_count", deleted);
++          browseros_metrics::BrowserOSMetrics::Log("server.ota.cleanup",
++                                                   std::move(props));
++        }
++      }));
 +}
 +
 +void BrowserOSServerUpdater::OnError(const std::string& stage,
@@ -1064,7 +1651,10 @@ index 0000000000000..ced363ffbabc2
 +            version_dir));
 +  }
 +
-+  CleanupPendingUpdate();
++  // A failed download keeps its partial file for resuming
++  if (stage != "download") {
++    CleanupPendingUpdate();
++  }
 +  ResetState();
 +}
 +
@@ -1073,9 +1663,13 @@ index 0000000000000..ced363ffbabc2
 +  update_in_progress_ = false;
 +  appcast_loader_.reset();
 +  download_loader_.reset();
++  download_file_.Reset();
 +  status_loader_.reset();
++  StopExtractionThrottle();
 +  pending_item_ = AppcastItem();
 +  pending_signature_.clear();
++  pending_full_enclosure_ = AppcastEnclosure();
++  pending_delta_from_ = base::Version();
 +}
 +
 +}  // namespace browseros_server
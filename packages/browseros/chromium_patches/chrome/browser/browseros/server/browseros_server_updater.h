@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_updater.h b/chrome/browser/browseros/server/browseros_server_updater.h
 new file mode 100644
-index 0000000000000..022b703a32e8d
+index 0000000000000..877d659fead73
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_updater.h
-@@ -0,0 +1,164 @@
+@@ -0,0 +1,243 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,19 +12,31 @@ index 0000000000000..022b703a32e8d
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_UPDATER_H_
 +
 +#include <memory>
++#include <optional>
 +#include <string>
++#include <string_view>
 +
 +#include "base/files/file_path.h"
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/threading/sequence_bound.h"
 +#include "base/timer/timer.h"
 +#include "base/version.h"
 +#include "chrome/browser/browseros/server/browseros_appcast_parser.h"
++#include "chrome/browser/browseros/server/resumable_download_file.h"
 +#include "chrome/browser/browseros/server/server_updater.h"
++#include "services/network/public/cpp/simple_url_loader_stream_consumer.h"
++
++class GURL;
 +
 +namespace network {
 +class SimpleURLLoader;
++namespace mojom {
++class URLResponseHead;
 +}
++}  // namespace network
 +
 +namespace browseros {
 +class BrowserOSServerManager;
@@ -32,18 +44,26 @@ index 0000000000000..022b703a32e8d
 +
 +namespace browseros_server {
 +
++class ExtractionThrottle;
++
 +// Manages automatic updates for the BrowserOS server binary.
 +//
 +// Update flow:
 +// 1. Fetch appcast XML from CDN
 +// 2. Parse and find matching platform enclosure
-+// 3. Download ZIP if newer version available
++// 3. Download ZIP if newer version available, preferring a delta against
++//    the installed version and falling back to the full package. An
++//    interrupted download is resumed with a range request on the next check.
 +// 4. Verify Ed25519 signature
-+// 5. Extract to versions/{version}/
-+// 6. Test binary with --version
++// 5. Extract to versions/{version}/ in the background, pausing while the
++//    user or an agent is busy. A delta is completed from the installed
++//    versions/{version}/ and checked against the manifest's file hashes.
++// 6. Check the version in the package's manifest (covered by the
++//    signature), or test the binary with --version if it has none
 +// 7. Update current_version file
 +// 8. Signal manager to use new binary on next restart
-+class BrowserOSServerUpdater : public browseros::ServerUpdater {
++class BrowserOSServerUpdater : public browseros::ServerUpdater,
++                               public network::SimpleURLLoaderStreamConsumer {
 + public:
 +  explicit BrowserOSServerUpdater(browseros::BrowserOSServerManager* manager);
 +  ~BrowserOSServerUpdater() override;
@@ -72,11 +92,20 @@ index 0000000000000..022b703a32e8d
 +    kTesting,
 +  };
 +
-+  void OnUpdateTimer();
++  // Called by BrowserOSUpdateScheduler
++  void OnScheduledCheck();
 +
 +  // Appcast flow
 +  void FetchAppcast();
-+  void OnAppcastFetched(std::unique_ptr<std::string> response);
++  void OnAppcastFetched(const std::string& appcast_url,
++                        std::unique_ptr<std::string> response);
++  void OnAppcastItem(const AppcastItem& item);
++
++  // Appcast cache (kServerAppcastCache), keyed by feed URL
++  std::optional<AppcastItem> GetCachedAppcastItem(
++      const std::string& appcast_url) const;
++  void CacheAppcastItem(const std::string& appcast_url,
++                        const AppcastItem& item);
 +
 +  // Download flow
 +  void CheckVersionAlreadyDownloaded(const AppcastEnclosure& enclosure,
@@ -86,8 +115,30 @@ index 0000000000000..022b703a32e8d
 +                            bool exists);
 +  void StartDownload(const AppcastEnclosure& enclosure,
 +                     const base::Version& version);
++  void OnDownloadPrepared(const AppcastEnclosure& enclosure,
++                          const base::Version& version,
++                          ResumableDownloadFile::ResumePoint resume);
++  void OnDownloadResponseStarted(
++      int64_t resume_offset,
++      const std::string& url,
++      const GURL& final_url,
++      const network::mojom::URLResponseHead& response_head);
++  void OnDownloadChunkWritten(base::OnceClosure resume, bool success);
++  // Closes the download file; an empty |error| means it finished.
++  void FinishDownload(const std::string& error);
 +  void OnDownloadComplete(const base::Version& version,
-+                          base::FilePath zip_path);
++                          std::string error,
++                          bool file_closed);
++
++  // network::SimpleURLLoaderStreamConsumer:
++  void OnDataReceived(std::string_view string_view,
++                      base::OnceClosure resume) override;
++  void OnComplete(bool success) override;
++  void OnRetry(base::OnceClosure start_retry) override;
++
++  // Restarts the download with the full package after a delta failed.
++  // Returns false if the failed download was not a delta.
++  bool FallBackToFullPackage(const std::string& error);
 +
 +  // Verification flow (runs on background thread)
 +  void VerifyAndExtract(const base::FilePath& zip_path,
@@ -96,12 +147,23 @@ index 0000000000000..022b703a32e8d
 +  void OnVerifyAndExtractComplete(const base::Version& version,
 +                                  bool success,
 +                                  const std::string& error);
++  // Holds the extraction back while the user or an agent is busy
++  void UpdateExtractionThrottle();
++  void StopExtractionThrottle();
 +
-+  // Binary testing
++  // Binary testing. The signed manifest in the package identifies the
++  // version; only packages without one have their binary run with
++  // --version, once the machine is idle.
 +  void TestBinary(const base::Version& version);
++  void OnServerManifestRead(const base::Version& version,
++                            std::optional<std::string> manifest_version);
++  void RunBinarySmokeTest(const base::Version& version);
 +  void OnBinaryTestComplete(const base::Version& version,
 +                            int exit_code,
 +                            const std::string& output);
++  // Deletes a version that failed its test and reports |error|
++  void DiscardBrokenVersion(const base::Version& version,
++                            const std::string& error);
 +
 +  // Hot-swap flow
 +  void CheckServerStatus();
@@ -142,8 +204,6 @@ index 0000000000000..022b703a32e8d
 +
 +  raw_ptr<browseros::BrowserOSServerManager> manager_;
 +
-+  base::RepeatingTimer update_check_timer_;
-+
 +  State state_ = State::kIdle;
 +  bool update_in_progress_ = false;
 +
@@ -152,9 +212,28 @@ index 0000000000000..022b703a32e8d
 +  std::unique_ptr<network::SimpleURLLoader> download_loader_;
 +  std::unique_ptr<network::SimpleURLLoader> status_loader_;
 +
++  // Download being streamed to disk, and whether its partial file must be
++  // dropped instead of kept for resuming (unexpected response, write error)
++  base::SequenceBound<ResumableDownloadFile> download_file_;
++  bool discard_partial_download_ = false;
++
++  // Shared with the extraction of the pending package, and the timer that
++  // keeps it up to date
++  scoped_refptr<ExtractionThrottle> extraction_throttle_;
++  base::RepeatingTimer extraction_throttle_timer_;
++
 +  // Pending update info
 +  AppcastItem pending_item_;
 +  std::string pending_signature_;
++  // Full package for the pending version, kept for delta fallback
++  AppcastEnclosure pending_full_enclosure_;
++  // Installed version the pending delta applies to; invalid when the full
++  // package is being downloaded
++  base::Version pending_delta_from_;
++
++  // Reads and writes of the current_version file, in order, so the file
++  // always ends up matching the last WriteCurrentVersionFile()
++  scoped_refptr<base::SequencedTaskRunner> version_file_task_runner_;
 +
 +  // Cached versions (loaded async at startup via --version)
 +  base::Version cached_bundled_version_;
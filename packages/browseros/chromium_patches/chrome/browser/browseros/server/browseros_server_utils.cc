@@ -1,22 +1,28 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils.cc b/chrome/browser/browseros/server/browseros_server_utils.cc
 new file mode 100644
-index 0000000000000..9aca12ed05475
+index 0000000000000..f0599dbba4f25
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils.cc
-@@ -0,0 +1,517 @@
+@@ -0,0 +1,797 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +
++#include <algorithm>
++#include <array>
 +#include <optional>
++#include <string_view>
++#include <utility>
++#include <vector>
 +
 +#include "base/command_line.h"
++#include "base/files/file_enumerator.h"
 +#include "base/files/file_util.h"
-+#include "base/json/json_reader.h"
-+#include "base/json/json_writer.h"
++#include "base/containers/span.h"
 +#include "base/logging.h"
++#include "base/numerics/byte_conversions.h"
 +#include "base/path_service.h"
 +#include "base/process/process.h"
 +#include "base/strings/string_number_conversions.h"
@@ -41,18 +47,38 @@ index 0000000000000..9aca12ed05475
 +
 +#if BUILDFLAG(IS_MAC)
 +#include <libproc.h>
++#include <mach/mach_time.h>
 +#include <sys/proc_info.h>
++#include <sys/resource.h>
 +#endif
 +
 +#if BUILDFLAG(IS_LINUX)
++#include <poll.h>
++#include <sys/syscall.h>
 +#include <sys/sysinfo.h>
++#include <unistd.h>
 +
 +#include "base/files/file_path.h"
++#include "base/files/scoped_file.h"
++#include "base/posix/eintr_wrapper.h"
++
++#ifndef __NR_pidfd_open
++#define __NR_pidfd_open 434
++#endif
++#endif
++
++#if BUILDFLAG(IS_MAC)
++#include <sys/event.h>
++
++#include "base/files/scoped_file.h"
++#include "base/posix/eintr_wrapper.h"
 +#endif
 +
 +#if BUILDFLAG(IS_WIN)
 +#include <windows.h>
 +
++#include <psapi.h>
++
 +#include "base/win/scoped_handle.h"
 +#endif
 +
@@ -68,6 +94,18 @@ index 0000000000000..9aca12ed05475
 +constexpr base::FilePath::CharType kLockFileName[] =
 +    FILE_PATH_LITERAL("server.lock");
 +
++// State file record: this magic (with the format version as its last byte),
++// then the pid and creation time as little-endian int64s
++constexpr std::string_view kStateRecordMagic("BOS\x01", 4);
++constexpr size_t kStateRecordSize =
++    kStateRecordMagic.size() + 2 * sizeof(int64_t);
++
++// Ports we never hand out, whether free or not
++bool IsPortAllowed(int port) {
++  return net::IsPortValid(port) && port != 0 && !net::IsWellKnownPort(port) &&
++         net::IsPortAllowedForScheme(port, "http");
++}
++
 +}  // namespace
 +
 +// =============================================================================
@@ -109,15 +147,7 @@ index 0000000000000..9aca12ed05475
 +}
 +
 +bool IsPortAvailable(int port, bool allow_reuse) {
-+  if (!net::IsPortValid(port) || port == 0) {
-+    return false;
-+  }
-+
-+  if (net::IsWellKnownPort(port)) {
-+    return false;
-+  }
-+
-+  if (!net::IsPortAllowedForScheme(port, "http")) {
++  if (!IsPortAllowed(port)) {
 +    return false;
 +  }
 +
@@ -166,6 +196,50 @@ index 0000000000000..9aca12ed05475
 +  return true;
 +}
 +
++std::unique_ptr<net::TCPServerSocket> ListenOnPort(int port, int backlog) {
++  if (!IsPortAllowed(port)) {
++    return nullptr;
++  }
++
++  auto socket =
++      std::make_unique<net::TCPServerSocket>(nullptr, net::NetLogSource());
++  if (socket->ListenWithAddressAndPort("0.0.0.0", port, backlog) != net::OK) {
++    return nullptr;
++  }
++  socket->DetachFromThread();
++  return socket;
++}
++
++std::unique_ptr<net::TCPServerSocket> ListenOnAvailablePort(
++    int starting_port,
++    const std::set<int>& excluded,
++    int backlog,
++    int* bound_port) {
++  for (int i = 0; i < kMaxPortAttempts; i++) {
++    int port_to_try = starting_port + i;
++
++    if (port_to_try > kMaxPort) {
++      break;
++    }
++
++    if (excluded.count(port_to_try) > 0) {
++      continue;
++    }
++
++    std::unique_ptr<net::TCPServerSocket> socket =
++        ListenOnPort(port_to_try, backlog);
++    if (socket) {
++      LOG(INFO) << "browseros: Listening on port " << port_to_try;
++      *bound_port = port_to_try;
++      return socket;
++    }
++  }
++
++  LOG(WARNING) << "browseros: Could not listen on any port after "
++               << kMaxPortAttempts << " attempts from " << starting_port;
++  return nullptr;
++}
++
 +// =============================================================================
 +// Path Utilities
 +// =============================================================================
@@ -261,9 +335,90 @@ index 0000000000000..9aca12ed05475
 +}
 +
 +// =============================================================================
++// Version Directories
++// =============================================================================
++
++int PruneServerVersions(const base::FilePath& versions_dir,
++                        const base::Version& current,
++                        size_t max_versions,
++                        int64_t quota_bytes) {
++  std::vector<std::pair<base::Version, base::FilePath>> older;
++  size_t kept_count = 0;
++  int64_t kept_bytes = 0;
++
++  base::FileEnumerator enumerator(versions_dir, /*recursive=*/false,
++                                  base::FileEnumerator::DIRECTORIES);
++  for (base::FilePath path = enumerator.Next(); !path.empty();
++       path = enumerator.Next()) {
++    base::Version version(path.BaseName().AsUTF8Unsafe());
++    if (!version.IsValid()) {
++      continue;
++    }
++    if (current.IsValid() && version >= current) {
++      kept_count++;
++      kept_bytes += base::ComputeDirectorySize(path);
++    } else {
++      older.emplace_back(std::move(version), path);
++    }
++  }
++
++  // Newest first, so rollback targets are the last to go
++  std::sort(older.begin(), older.end(),
++            [](const auto& a, const auto& b) { return a.first > b.first; });
++
++  // Once one doesn't fit, the older ones go too; rolling back past a gap
++  // isn't worth their space
++  int deleted = 0;
++  bool keeping = true;
++  for (const auto& [version, path] : older) {
++    if (keeping && kept_count < max_versions) {
++      const int64_t size = base::ComputeDirectorySize(path);
++      if (kept_bytes + size <= quota_bytes) {
++        kept_count++;
++        kept_bytes += size;
++        continue;
++      }
++    }
++    keeping = false;
++    LOG(INFO) << "browseros: Cleaning up old server version: "
++              << version.GetString();
++    if (!base::DeletePathRecursively(path)) {
++      LOG(WARNING) << "browseros: Failed to delete " << path;
++      continue;
++    }
++    deleted++;
++  }
++  return deleted;
++}
++
++// =============================================================================
 +// State File (Orphan Recovery)
 +// =============================================================================
 +
++std::string SerializeServerState(const ServerState& state) {
++  std::string record(kStateRecordMagic);
++  for (int64_t value : {static_cast<int64_t>(state.pid), state.creation_time}) {
++    std::array<uint8_t, 8> bytes = base::I64ToLittleEndian(value);
++    record.append(bytes.begin(), bytes.end());
++  }
++  return record;
++}
++
++std::optional<ServerState> ParseServerState(std::string_view record) {
++  if (record.size() != kStateRecordSize ||
++      !record.starts_with(kStateRecordMagic)) {
++    return std::nullopt;
++  }
++  base::span<const uint8_t> bytes =
++      base::as_byte_span(record).subspan(kStateRecordMagic.size());
++
++  ServerState state;
++  state.pid = static_cast<base::ProcessId>(
++      base::I64FromLittleEndian(bytes.first<8>()));
++  state.creation_time = base::I64FromLittleEndian(bytes.subspan<8, 8>());
++  return state;
++}
++
 +std::optional<ServerState> ReadStateFile() {
 +  base::FilePath state_path = GetStateFilePath();
 +  if (state_path.empty()) {
@@ -271,31 +426,22 @@ index 0000000000000..9aca12ed05475
 +  }
 +
 +  std::string contents;
-+  if (!base::ReadFileToString(state_path, &contents)) {
++  if (!base::ReadFileToStringWithMaxSize(state_path, &contents,
++                                         kStateRecordSize)) {
++    if (base::PathExists(state_path)) {
++      LOG(WARNING) << "browseros: Invalid state file format";
++    }
 +    return std::nullopt;
 +  }
 +
-+  std::optional<base::Value> parsed = base::JSONReader::Read(contents);
-+  if (!parsed || !parsed->is_dict()) {
++  std::optional<ServerState> state = ParseServerState(contents);
++  if (!state) {
 +    LOG(WARNING) << "browseros: Invalid state file format";
 +    return std::nullopt;
 +  }
 +
-+  const base::Value::Dict& dict = parsed->GetDict();
-+  std::optional<int> pid = dict.FindInt("pid");
-+  std::optional<double> creation_time = dict.FindDouble("creation_time");
-+
-+  if (!pid || !creation_time) {
-+    LOG(WARNING) << "browseros: State file missing required fields";
-+    return std::nullopt;
-+  }
-+
-+  ServerState state;
-+  state.pid = static_cast<base::ProcessId>(*pid);
-+  state.creation_time = static_cast<int64_t>(*creation_time);
-+
-+  LOG(INFO) << "browseros: Read state file - PID: " << state.pid
-+            << ", creation_time: " << state.creation_time;
++  LOG(INFO) << "browseros: Read state file - PID: " << state->pid
++            << ", creation_time: " << state->creation_time;
 +  return state;
 +}
 +
@@ -305,18 +451,14 @@ index 0000000000000..9aca12ed05475
 +    return false;
 +  }
 +
-+  base::Value::Dict dict;
-+  dict.Set("pid", static_cast<int>(state.pid));
-+  dict.Set("creation_time", static_cast<double>(state.creation_time));
-+
-+  std::optional<std::string> json_output = base::WriteJson(dict);
-+  if (!json_output.has_value()) {
-+    LOG(ERROR) << "browseros: Failed to serialize state to JSON";
-+    return false;
-+  }
-+
-+  if (!base::WriteFile(state_path, json_output.value())) {
++  // Replaced through a temp file so a crash mid-write leaves the previous
++  // record rather than a torn one. Not flushed: a power loss takes the
++  // server down too, leaving no orphan for the record to point at.
++  base::FilePath temp_path = state_path.AddExtensionASCII("tmp");
++  if (!base::WriteFile(temp_path, SerializeServerState(state)) ||
++      !base::ReplaceFile(temp_path, state_path, nullptr)) {
 +    LOG(ERROR) << "browseros: Failed to write state file: " << state_path;
++    base::DeleteFile(temp_path);
 +    return false;
 +  }
 +
@@ -433,6 +575,102 @@ index 0000000000000..9aca12ed05475
 +#endif
 +}
 +
++std::optional<ProcessResourceUsage> GetProcessResourceUsage(
++    base::ProcessId pid) {
++  ProcessResourceUsage usage;
++#if BUILDFLAG(IS_MAC)
++  rusage_info_v2 info;
++  if (proc_pid_rusage(pid, RUSAGE_INFO_V2,
++                      reinterpret_cast<rusage_info_t*>(&info)) != 0) {
++    return std::nullopt;
++  }
++  // CPU times are in Mach absolute time units
++  mach_timebase_info_data_t timebase;
++  if (mach_timebase_info(&timebase) != KERN_SUCCESS || timebase.denom == 0) {
++    return std::nullopt;
++  }
++  const uint64_t cpu_ns = (info.ri_user_time + info.ri_system_time) *
++                          timebase.numer / timebase.denom;
++  usage.resident_bytes = info.ri_resident_size;
++  usage.cpu_time = base::Nanoseconds(static_cast<int64_t>(cpu_ns));
++  return usage;
++
++#elif BUILDFLAG(IS_LINUX)
++  const std::string proc_dir = "/proc/" + base::NumberToString(pid);
++
++  // statm: size resident shared ... (in pages)
++  std::string statm;
++  if (!base::ReadFileToString(base::FilePath(proc_dir + "/statm"), &statm)) {
++    return std::nullopt;
++  }
++  std::vector<std::string> pages = base::SplitString(
++      statm, " ", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
++  uint64_t resident_pages = 0;
++  if (pages.size() < 2 || !base::StringToUint64(pages[1], &resident_pages)) {
++    return std::nullopt;
++  }
++
++  std::string stat;
++  if (!base::ReadFileToString(base::FilePath(proc_dir + "/stat"), &stat)) {
++    return std::nullopt;
++  }
++  size_t comm_end = stat.rfind(')');
++  if (comm_end == std::string::npos) {
++    return std::nullopt;
++  }
++  // utime and stime are fields 14 and 15, so 11 and 12 after (comm)
++  std::vector<std::string> fields =
++      base::SplitString(stat.substr(comm_end + 2), " ", base::KEEP_WHITESPACE,
++                        base::SPLIT_WANT_ALL);
++  int64_t utime = 0;
++  int64_t stime = 0;
++  if (fields.size() < 13 || !base::StringToInt64(fields[11], &utime) ||
++      !base::StringToInt64(fields[12], &stime)) {
++    return std::nullopt;
++  }
++
++  long ticks_per_sec = sysconf(_SC_CLK_TCK);
++  long page_size = sysconf(_SC_PAGESIZE);
++  if (ticks_per_sec <= 0 || page_size <= 0) {
++    return std::nullopt;
++  }
++  usage.resident_bytes = resident_pages * static_cast<uint64_t>(page_size);
++  usage.cpu_time =
++      base::Microseconds((utime + stime) * 1000000 / ticks_per_sec);
++  return usage;
++
++#elif BUILDFLAG(IS_WIN)
++  base::win::ScopedHandle handle(OpenProcess(
++      PROCESS_QUERY_LIMITED_INFORMATION | PROCESS_VM_READ, FALSE, pid));
++  if (!handle.IsValid()) {
++    return std::nullopt;
++  }
++
++  PROCESS_MEMORY_COUNTERS counters = {};
++  if (!GetProcessMemoryInfo(handle.Get(), &counters, sizeof(counters))) {
++    return std::nullopt;
++  }
++  FILETIME creation, exit, kernel, user;
++  if (!GetProcessTimes(handle.Get(), &creation, &exit, &kernel, &user)) {
++    return std::nullopt;
++  }
++
++  // FILETIME durations are in 100-nanosecond intervals
++  auto to_delta = [](const FILETIME& time) {
++    ULARGE_INTEGER uli;
++    uli.LowPart = time.dwLowDateTime;
++    uli.HighPart = time.dwHighDateTime;
++    return base::Microseconds(static_cast<int64_t>(uli.QuadPart / 10));
++  };
++  usage.resident_bytes = counters.WorkingSetSize;
++  usage.cpu_time = to_delta(kernel) + to_delta(user);
++  return usage;
++
++#else
++  return std::nullopt;
++#endif
++}
++
 +bool ProcessExists(base::ProcessId pid) {
 +#if BUILDFLAG(IS_POSIX)
 +  // kill with signal 0 checks if process exists without sending a signal
@@ -453,6 +691,52 @@ index 0000000000000..9aca12ed05475
 +#endif
 +}
 +
++#if BUILDFLAG(IS_POSIX)
++namespace {
++
++// Waits up to |timeout| for |pid| to exit, which need not be a child of
++// ours. Blocks on a pidfd (Linux) or kqueue (macOS) rather than polling.
++bool WaitForProcessGone(base::ProcessId pid, base::TimeDelta timeout) {
++#if BUILDFLAG(IS_LINUX)
++  base::ScopedFD pidfd(static_cast<int>(syscall(__NR_pidfd_open, pid, 0)));
++  if (pidfd.is_valid()) {
++    struct pollfd poll_fd = {pidfd.get(), POLLIN, 0};
++    return HANDLE_EINTR(poll(&poll_fd, 1,
++                             static_cast<int>(timeout.InMilliseconds()))) > 0;
++  }
++  if (errno == ESRCH) {
++    return true;
++  }
++#elif BUILDFLAG(IS_MAC)
++  base::ScopedFD kq(kqueue());
++  if (kq.is_valid()) {
++    struct kevent change;
++    EV_SET(&change, pid, EVFILT_PROC, EV_ADD | EV_ONESHOT, NOTE_EXIT, 0,
++           nullptr);
++    if (HANDLE_EINTR(kevent(kq.get(), &change, 1, nullptr, 0, nullptr)) != 0) {
++      return errno == ESRCH;
++    }
++    const struct timespec wait_time = timeout.ToTimeSpec();
++    struct kevent event;
++    return HANDLE_EINTR(kevent(kq.get(), nullptr, 0, &event, 1, &wait_time)) >
++           0;
++  }
++#endif
++
++  // No wait primitive available (old kernel); fall back to polling
++  base::TimeTicks deadline = base::TimeTicks::Now() + timeout;
++  while (ProcessExists(pid)) {
++    if (base::TimeTicks::Now() >= deadline) {
++      return false;
++    }
++    base::PlatformThread::Sleep(base::Milliseconds(50));
++  }
++  return true;
++}
++
++}  // namespace
++#endif
++
 +bool KillProcess(base::ProcessId pid, base::TimeDelta graceful_timeout) {
 +#if BUILDFLAG(IS_POSIX)
 +  // First try SIGTERM for graceful shutdown
@@ -464,15 +748,10 @@ index 0000000000000..9aca12ed05475
 +    return false;
 +  }
 +
-+  // Wait for graceful shutdown
-+  base::TimeTicks deadline = base::TimeTicks::Now() + graceful_timeout;
-+  while (base::TimeTicks::Now() < deadline) {
-+    if (!ProcessExists(pid)) {
-+      LOG(INFO) << "browseros: Process " << pid
-+                << " terminated gracefully after SIGTERM";
-+      return true;
-+    }
-+    base::PlatformThread::Sleep(base::Milliseconds(100));
++  if (WaitForProcessGone(pid, graceful_timeout)) {
++    LOG(INFO) << "browseros: Process " << pid
++              << " terminated gracefully after SIGTERM";
++    return true;
 +  }
 +
 +  // Still running, send SIGKILL
@@ -486,12 +765,13 @@ index 0000000000000..9aca12ed05475
 +    return false;
 +  }
 +
-+  // Wait briefly for SIGKILL to take effect
-+  base::PlatformThread::Sleep(base::Milliseconds(500));
-+  return !ProcessExists(pid);
++  // Returns as soon as SIGKILL takes effect
++  return WaitForProcessGone(pid, base::Milliseconds(500));
 +
 +#elif BUILDFLAG(IS_WIN)
-+  base::win::ScopedHandle handle(OpenProcess(PROCESS_TERMINATE, FALSE, pid));
++  // SYNCHRONIZE is needed to wait on the handle below
++  base::win::ScopedHandle handle(
++      OpenProcess(PROCESS_TERMINATE | SYNCHRONIZE, FALSE, pid));
 +  if (!handle.IsValid()) {
 +    DWORD error = GetLastError();
 +    if (error == ERROR_INVALID_PARAMETER) {
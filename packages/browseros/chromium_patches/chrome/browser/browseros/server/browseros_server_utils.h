@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils.h b/chrome/browser/browseros/server/browseros_server_utils.h
 new file mode 100644
-index 0000000000000..6251f1274bcc6
+index 0000000000000..eec1c2b871aac
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils.h
-@@ -0,0 +1,89 @@
+@@ -0,0 +1,144 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,13 +11,21 @@ index 0000000000000..6251f1274bcc6
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_UTILS_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_UTILS_H_
 +
++#include <cstdint>
++#include <memory>
 +#include <optional>
 +#include <set>
 +#include <string>
++#include <string_view>
 +
 +#include "base/files/file_path.h"
 +#include "base/process/process_handle.h"
 +#include "base/time/time.h"
++#include "base/version.h"
++
++namespace net {
++class TCPServerSocket;
++}  // namespace net
 +
 +namespace browseros::server_utils {
 +
@@ -37,6 +45,20 @@ index 0000000000000..6251f1274bcc6
 +// When |allow_reuse| is true, uses SO_REUSEADDR for the probe.
 +bool IsPortAvailable(int port, bool allow_reuse = false);
 +
++// Returns a socket listening on 0.0.0.0:|port| (with SO_REUSEADDR, like
++// net::HttpServer), or nullptr if the port can't be bound. The socket is
++// detached from the calling thread so it can be handed to the IO thread.
++std::unique_ptr<net::TCPServerSocket> ListenOnPort(int port, int backlog);
++
++// Like FindAvailablePort() with |allow_reuse|, but keeps the winning socket
++// listening so nothing can take the port between the probe and its use.
++// Sets |bound_port| on success; returns nullptr if no port could be bound.
++std::unique_ptr<net::TCPServerSocket> ListenOnAvailablePort(
++    int starting_port,
++    const std::set<int>& excluded,
++    int backlog,
++    int* bound_port);
++
 +// =============================================================================
 +// Path Utilities
 +// =============================================================================
@@ -58,6 +80,21 @@ index 0000000000000..6251f1274bcc6
 +base::FilePath GetStateFilePath();
 +
 +// =============================================================================
++// Version Directories
++// =============================================================================
++
++// Deletes downloaded server versions in |versions_dir| that are older than
++// |current|, oldest first, until at most |max_versions| are left and they
++// take up no more than |quota_bytes| of disk. |current| and anything newer
++// (an update still being extracted) are never deleted, even when they alone
++// exceed the quota. Walks the directories, so must run on a thread that
++// allows blocking. Returns the number of versions deleted.
++int PruneServerVersions(const base::FilePath& versions_dir,
++                        const base::Version& current,
++                        size_t max_versions,
++                        int64_t quota_bytes);
++
++// =============================================================================
 +// State File (Orphan Recovery)
 +// =============================================================================
 +
@@ -66,10 +103,16 @@ index 0000000000000..6251f1274bcc6
 +  int64_t creation_time = 0;  // Process creation time in milliseconds
 +};
 +
++// The state file is a fixed 20-byte binary record, cheap to read at every
++// startup and small enough to be replaced atomically.
++std::string SerializeServerState(const ServerState& state);
++// Returns nullopt if |record| isn't one written by SerializeServerState()
++std::optional<ServerState> ParseServerState(std::string_view record);
++
 +// Reads the state file. Returns nullopt if file doesn't exist or is invalid.
 +std::optional<ServerState> ReadStateFile();
 +
-+// Writes the state file with pid and creation_time.
++// Writes the state file with pid and creation_time, replacing it atomically.
 +bool WriteStateFile(const ServerState& state);
 +
 +// Deletes the state file.
@@ -83,11 +126,23 @@ index 0000000000000..6251f1274bcc6
 +// Platform-specific implementation (macOS/Linux/Windows).
 +std::optional<int64_t> GetProcessCreationTime(base::ProcessId pid);
 +
++struct ProcessResourceUsage {
++  uint64_t resident_bytes = 0;
++  // User plus system time since the process started
++  base::TimeDelta cpu_time;
++};
++
++// Returns the resident memory and CPU time of a running process. Reads
++// /proc on Linux, so must run on a thread that allows blocking.
++std::optional<ProcessResourceUsage> GetProcessResourceUsage(
++    base::ProcessId pid);
++
 +// Returns true if a process with the given PID exists.
 +bool ProcessExists(base::ProcessId pid);
 +
 +// Kills a process. First sends SIGTERM, waits for graceful_timeout,
-+// then sends SIGKILL if still running.
++// then sends SIGKILL if still running. Blocks until the process is gone or
++// the timeouts expire, so must run on a thread that allows blocking.
 +bool KillProcess(base::ProcessId pid, base::TimeDelta graceful_timeout);
 +
 +}  // namespace browseros::server_utils
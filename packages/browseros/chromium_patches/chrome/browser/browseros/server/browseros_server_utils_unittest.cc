@@ -1,20 +1,25 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_utils_unittest.cc b/chrome/browser/browseros/server/browseros_server_utils_unittest.cc
 new file mode 100644
-index 0000000000000..ad434d78b5e68
+index 0000000000000..be25d8754b229
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_utils_unittest.cc
-@@ -0,0 +1,91 @@
+@@ -0,0 +1,233 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_utils.h"
 +
++#include <optional>
 +#include <set>
++#include <string>
 +
 +#include "base/files/file_path.h"
 +#include "base/files/file_util.h"
 +#include "base/files/scoped_temp_dir.h"
++#include "base/process/process_handle.h"
++#include "base/version.h"
++#include "net/socket/tcp_server_socket.h"
 +#include "testing/gtest/include/gtest/gtest.h"
 +
 +namespace browseros::server_utils {
@@ -30,6 +35,33 @@ index 0000000000000..ad434d78b5e68
 +  EXPECT_EQ(0, state.creation_time);
 +}
 +
++TEST(ServerUtilsStateTest, StateRecordRoundTrips) {
++  ServerState state;
++  state.pid = 48213;
++  state.creation_time = 1760000000123;
++
++  std::string record = SerializeServerState(state);
++  EXPECT_EQ(20u, record.size());
++
++  std::optional<ServerState> parsed = ParseServerState(record);
++  ASSERT_TRUE(parsed.has_value());
++  EXPECT_EQ(state.pid, parsed->pid);
++  EXPECT_EQ(state.creation_time, parsed->creation_time);
++}
++
++TEST(ServerUtilsStateTest, ParseServerState_RejectsOtherContents) {
++  std::string record = SerializeServerState(ServerState());
++
++  EXPECT_FALSE(ParseServerState(""));
++  EXPECT_FALSE(ParseServerState(record.substr(0, record.size() - 1)));
++  EXPECT_FALSE(ParseServerState(record + "x"));
++  // Wrong format version
++  record[3] = 2;
++  EXPECT_FALSE(ParseServerState(record));
++  // JSON state files of older builds
++  EXPECT_FALSE(ParseServerState(R"({"pid":1,"creation_time":2})"));
++}
++
 +// =============================================================================
 +// Port Availability Tests
 +// =============================================================================
@@ -71,6 +103,24 @@ index 0000000000000..ad434d78b5e68
 +  EXPECT_GE(found, 10000);
 +}
 +
++TEST(ServerUtilsPortTest, ListenOnPort_RejectsWellKnownPorts) {
++  EXPECT_EQ(nullptr, ListenOnPort(80, /*backlog=*/1));
++}
++
++TEST(ServerUtilsPortTest, ListenOnAvailablePort_HoldsBoundPort) {
++  std::set<int> excluded;
++  excluded.insert(10100);
++
++  int bound_port = 0;
++  std::unique_ptr<net::TCPServerSocket> socket =
++      ListenOnAvailablePort(10100, excluded, /*backlog=*/1, &bound_port);
++
++  ASSERT_NE(nullptr, socket);
++  EXPECT_GT(bound_port, 10100);
++  // The port stays taken for as long as the socket is held
++  EXPECT_EQ(nullptr, ListenOnPort(bound_port, /*backlog=*/1));
++}
++
 +// =============================================================================
 +// Path Utility Tests
 +// =============================================================================
@@ -93,5 +143,97 @@ index 0000000000000..ad434d78b5e68
 +  }
 +}
 +
++// =============================================================================
++// Version Directory Tests
++// =============================================================================
++
++// Creates versions_dir/<version> holding |size| bytes
++void CreateVersionDir(const base::FilePath& versions_dir,
++                      const std::string& version,
++                      size_t size) {
++  base::FilePath dir = versions_dir.AppendASCII(version);
++  ASSERT_TRUE(base::CreateDirectory(dir));
++  ASSERT_TRUE(base::WriteFile(dir.AppendASCII("payload"),
++                              std::string(size, 'x')));
++}
++
++bool VersionDirExists(const base::FilePath& versions_dir,
++                      const std::string& version) {
++  return base::DirectoryExists(versions_dir.AppendASCII(version));
++}
++
++TEST(ServerUtilsVersionsTest, PruneServerVersions_KeepsNewestUpToCount) {
++  base::ScopedTempDir temp_dir;
++  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
++  const base::FilePath& dir = temp_dir.GetPath();
++  for (const char* version : {"1.0.0", "1.2.0", "1.10.0", "2.0.0"}) {
++    CreateVersionDir(dir, version, 10);
++  }
++
++  EXPECT_EQ(2, PruneServerVersions(dir, base::Version("2.0.0"), 2, 1000));
++  EXPECT_TRUE(VersionDirExists(dir, "2.0.0"));
++  EXPECT_TRUE(VersionDirExists(dir, "1.10.0"));
++  EXPECT_FALSE(VersionDirExists(dir, "1.2.0"));
++  EXPECT_FALSE(VersionDirExists(dir, "1.0.0"));
++}
++
++TEST(ServerUtilsVersionsTest, PruneServerVersions_NeverDeletesCurrentOrNewer) {
++  base::ScopedTempDir temp_dir;
++  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
++  const base::FilePath& dir = temp_dir.GetPath();
++  // 3.0.0 is an update still being extracted
++  for (const char* version : {"1.0.0", "2.0.0", "3.0.0"}) {
++    CreateVersionDir(dir, version, 100);
++  }
++
++  EXPECT_EQ(1, PruneServerVersions(dir, base::Version("2.0.0"), 1, 50));
++  EXPECT_TRUE(VersionDirExists(dir, "3.0.0"));
++  EXPECT_TRUE(VersionDirExists(dir, "2.0.0"));
++  EXPECT_FALSE(VersionDirExists(dir, "1.0.0"));
++}
++
++TEST(ServerUtilsVersionsTest, PruneServerVersions_EnforcesQuota) {
++  base::ScopedTempDir temp_dir;
++  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
++  const base::FilePath& dir = temp_dir.GetPath();
++  CreateVersionDir(dir, "1.0.0", 10);
++  CreateVersionDir(dir, "2.0.0", 100);
++  CreateVersionDir(dir, "3.0.0", 100);
++
++  // The rollback target 2.0.0 doesn't fit next to the current version, and
++  // older ones aren't kept in its place
++  EXPECT_EQ(2, PruneServerVersions(dir, base::Version("3.0.0"), 3, 150));
++  EXPECT_TRUE(VersionDirExists(dir, "3.0.0"));
++  EXPECT_FALSE(VersionDirExists(dir, "2.0.0"));
++  EXPECT_FALSE(VersionDirExists(dir, "1.0.0"));
++}
++
++TEST(ServerUtilsVersionsTest, PruneServerVersions_IgnoresOtherEntries) {
++  base::ScopedTempDir temp_dir;
++  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
++  const base::FilePath& dir = temp_dir.GetPath();
++  CreateVersionDir(dir, "1.0.0", 10);
++  CreateVersionDir(dir, "1.1.0", 10);
++  CreateVersionDir(dir, "not-a-version", 10);
++
++  EXPECT_EQ(1, PruneServerVersions(dir, base::Version("2.0.0"), 1, 1000));
++  EXPECT_TRUE(VersionDirExists(dir, "1.1.0"));
++  EXPECT_TRUE(VersionDirExists(dir, "not-a-version"));
++  EXPECT_EQ(0, PruneServerVersions(dir.AppendASCII("missing"),
++                                   base::Version("2.0.0"), 1, 1000));
++}
++
++// =============================================================================
++// Process Resource Usage Tests
++// =============================================================================
++
++TEST(ServerUtilsProcessTest, GetProcessResourceUsage_CurrentProcess) {
++  std::optional<ProcessResourceUsage> usage =
++      GetProcessResourceUsage(base::GetCurrentProcId());
++  ASSERT_TRUE(usage.has_value());
++  EXPECT_GT(usage->resident_bytes, 0u);
++  EXPECT_GE(usage->cpu_time, base::TimeDelta());
++}
++
 +}  // namespace
 +}  // namespace browseros::server_utils
@@ -0,0 +1,308 @@
+diff --git a/chrome/browser/browseros/server/browseros_server_workers.cc b/chrome/browser/browseros/server/browseros_server_workers.cc
+new file mode 100644
+index 0000000000000..0bcf577e46799
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_server_workers.cc
+@@ -0,0 +1,302 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_server_workers.h"
++
++#include <set>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/thread_pool.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/browseros/server/browseros_server_prefs.h"
++#include "chrome/browser/browseros/server/browseros_server_utils.h"
++#include "chrome/browser/browseros/server/health_checker.h"
++#include "chrome/browser/browseros/server/process_controller.h"
++
++namespace browseros {
++
++namespace {
++
++// How often a starting worker is probed until it answers /health
++constexpr base::TimeDelta kWorkerProbeInterval = base::Milliseconds(500);
++
++// A worker not healthy this long after launch is relaunched
++constexpr base::TimeDelta kWorkerStartupTimeout = base::Seconds(30);
++
++// Delay before retrying a worker whose launch failed
++constexpr base::TimeDelta kWorkerRetryDelay = base::Seconds(10);
++
++// Kills and reaps |process| off the UI thread, like the primary's restart
++// path does
++void TerminateInBackground(ProcessController* process_controller,
++                           base::Process process) {
++  base::ThreadPool::PostTask(
++      FROM_HERE,
++      {base::MayBlock(), base::WithBaseSyncPrimitives(),
++       base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(
++          [](ProcessController* process_controller, base::Process process) {
++            process_controller->Terminate(&process, /*wait=*/true);
++          },
++          base::Unretained(process_controller), std::move(process)));
++}
++
++}  // namespace
++
++struct BrowserOSServerWorkers::Worker {
++  explicit Worker(int index) : index(index) {}
++
++  const int index;
++  // Changes on every launch and termination; replies for an older one are
++  // dropped
++  int generation = 0;
++  base::Process process;
++  ServerPorts ports;
++  std::unique_ptr<HealthChecker> health_checker;
++  base::TimeTicks launch_time;
++  bool launching = false;
++  bool healthy = false;
++  base::OneShotTimer timer;
++};
++
++struct BrowserOSServerWorkers::LaunchedWorker {
++  ServerPorts ports;
++  LaunchResult result;
++};
++
++BrowserOSServerWorkers::BrowserOSServerWorkers(
++    ProcessController* process_controller,
++    HealthCheckerFactory health_checker_factory,
++    BackendsChangedCallback on_backends_changed)
++    : process_controller_(process_controller),
++      health_checker_factory_(std::move(health_checker_factory)),
++      on_backends_changed_(std::move(on_backends_changed)) {}
++
++BrowserOSServerWorkers::~BrowserOSServerWorkers() {
++  Stop();
++}
++
++void BrowserOSServerWorkers::Start(int count,
++                                   const ServerLaunchConfig& base_config) {
++  base_config_ = base_config;
++  // Workers are reached over TCP only; the socket path belongs to the
++  // primary
++  base_config_.paths.backend_socket.clear();
++
++  for (int index = static_cast<int>(workers_.size()) + 1; index < count;
++       ++index) {
++    workers_.push_back(std::make_unique<Worker>(index));
++  }
++
++  LOG(INFO) << "browseros: Starting " << workers_.size()
++            << " extra server worker(s)";
++  for (auto& worker : workers_) {
++    if (!worker->launching && !worker->process.IsValid()) {
++      LaunchWorker(worker.get());
++    }
++  }
++}
++
++void BrowserOSServerWorkers::Stop() {
++  bool had_healthy = false;
++  for (auto& worker : workers_) {
++    had_healthy |= worker->healthy;
++    TerminateWorker(*worker);
++  }
++  workers_.clear();
++  if (had_healthy) {
++    NotifyBackendsChanged();
++  }
++}
++
++void BrowserOSServerWorkers::CheckHealth() {
++  for (auto& worker : workers_) {
++    if (worker->healthy) {
++      ProbeWorker(worker->index);
++    }
++  }
++}
++
++void BrowserOSServerWorkers::CheckProcesses() {
++  for (auto& worker : workers_) {
++    if (!worker->process.IsValid()) {
++      continue;
++    }
++    int exit_code = 0;
++    if (worker->process.WaitForExitWithTimeout(base::TimeDelta(),
++                                               &exit_code)) {
++      LOG(WARNING) << "browseros: Server worker " << worker->index
++                   << " exited with code " << exit_code << ", relaunching";
++      worker->process = base::Process();
++      RestartWorker(*worker);
++    }
++  }
++}
++
++// static
++BrowserOSServerWorkers::LaunchedWorker
++BrowserOSServerWorkers::LaunchOnBackground(
++    ProcessController* process_controller,
++    ServerLaunchConfig config,
++    std::set<int> excluded_ports) {
++  LaunchedWorker launched;
++  config.ports.server = server_utils::FindAvailablePort(
++      browseros_server::kDefaultServerPort, excluded_ports);
++  excluded_ports.insert(config.ports.server);
++  config.ports.extension = server_utils::FindAvailablePort(
++      browseros_server::kDefaultExtensionPort, excluded_ports);
++  launched.ports = config.ports;
++  launched.result = process_controller->Launch(config);
++  return launched;
++}
++
++void BrowserOSServerWorkers::LaunchWorker(Worker* worker) {
++  worker->generation = ++next_generation_;
++  worker->launching = true;
++  worker->healthy = false;
++
++  ServerLaunchConfig config = base_config_;
++  config.worker_index = worker->index;
++
++  // Ports of the primary and of the other workers
++  std::set<int> excluded_ports = {base_config_.ports.cdp,
++                                  base_config_.ports.proxy,
++                                  base_config_.ports.server,
++                                  base_config_.ports.extension};
++  for (const auto& other : workers_) {
++    excluded_ports.insert(other->ports.server);
++    excluded_ports.insert(other->ports.extension);
++  }
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
++      base::BindOnce(&BrowserOSServerWorkers::LaunchOnBackground,
++                     base::Unretained(process_controller_.get()), config,
++                     std::move(excluded_ports)),
++      base::BindOnce(&BrowserOSServerWorkers::OnWorkerLaunched,
++                     weak_factory_.GetWeakPtr(), worker->index,
++                     worker->generation));
++}
++
++void BrowserOSServerWorkers::OnWorkerLaunched(int index,
++                                              int generation,
++                                              LaunchedWorker launched) {
++  Worker* worker = index <= static_cast<int>(workers_.size())
++                       ? workers_[index - 1].get()
++                       : nullptr;
++  if (!worker || worker->generation != generation) {
++    // Stopped while launching
++    if (launched.result.process.IsValid()) {
++      TerminateInBackground(process_controller_,
++                            std::move(launched.result.process));
++    }
++    return;
++  }
++
++  worker->launching = false;
++  if (!launched.result.process.IsValid()) {
++    LOG(ERROR) << "browseros: Failed to launch server worker " << index;
++    worker->timer.Start(FROM_HERE, kWorkerRetryDelay,
++                        base::BindOnce(&BrowserOSServerWorkers::LaunchWorker,
++                                       base::Unretained(this), worker));
++    return;
++  }
++
++  worker->process = std::move(launched.result.process);
++  worker->ports = launched.ports;
++  worker->launch_time = base::TimeTicks::Now();
++  worker->health_checker = health_checker_factory_.Run();
++  LOG(INFO) << "browseros: Server worker " << index
++            << " started with PID: " << worker->process.Pid()
++            << ", port: " << worker->ports.server;
++
++  worker->timer.Start(FROM_HERE, kWorkerProbeInterval,
++                      base::BindOnce(&BrowserOSServerWorkers::ProbeWorker,
++                                     base::Unretained(this), index));
++}
++
++void BrowserOSServerWorkers::ProbeWorker(int index) {
++  Worker& worker = *workers_[index - 1];
++  if (!worker.process.IsValid() || !worker.health_checker) {
++    return;
++  }
++
++  worker.health_checker->CheckHealth(
++      worker.ports.server,
++      base::BindOnce(&BrowserOSServerWorkers::OnWorkerHealthChecked,
++                     weak_factory_.GetWeakPtr(), index, worker.generation));
++}
++
++void BrowserOSServerWorkers::OnWorkerHealthChecked(int index,
++                                                   int generation,
++                                                   bool success) {
++  if (index > static_cast<int>(workers_.size())) {
++    return;
++  }
++  Worker& worker = *workers_[index - 1];
++  if (worker.generation != generation) {
++    return;
++  }
++
++  if (success) {
++    if (!worker.healthy) {
++      LOG(INFO) << "browseros: Server worker " << index << " ready after "
++                << (base::TimeTicks::Now() - worker.launch_time)
++                       .InMilliseconds()
++                << "ms";
++      worker.healthy = true;
++      NotifyBackendsChanged();
++    }
++    return;
++  }
++
++  if (!worker.healthy &&
++      base::TimeTicks::Now() - worker.launch_time < kWorkerStartupTimeout) {
++    worker.timer.Start(FROM_HERE, kWorkerProbeInterval,
++                       base::BindOnce(&BrowserOSServerWorkers::ProbeWorker,
++                                      base::Unretained(this), index));
++    return;
++  }
++
++  LOG(WARNING) << "browseros: Server worker " << index
++               << " health check failed, restarting";
++  RestartWorker(worker);
++}
++
++void BrowserOSServerWorkers::RestartWorker(Worker& worker) {
++  const bool was_healthy = worker.healthy;
++  TerminateWorker(worker);
++  if (was_healthy) {
++    NotifyBackendsChanged();
++  }
++  LaunchWorker(&worker);
++}
++
++void BrowserOSServerWorkers::TerminateWorker(Worker& worker) {
++  worker.generation = ++next_generation_;
++  worker.launching = false;
++  worker.healthy = false;
++  worker.timer.Stop();
++  worker.health_checker.reset();
++
++  if (worker.process.IsValid()) {
++    TerminateInBackground(process_controller_, std::move(worker.process));
++    worker.process = base::Process();
++  }
++}
++
++void BrowserOSServerWorkers::NotifyBackendsChanged() {
++  std::vector<int> ports;
++  for (const auto& worker : workers_) {
++    if (worker->healthy) {
++      ports.push_back(worker->ports.server);
++    }
++  }
++  on_backends_changed_.Run(std::move(ports));
++}
++
++}  // namespace browseros
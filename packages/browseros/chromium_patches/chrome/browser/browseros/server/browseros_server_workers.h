@@ -0,0 +1,96 @@
+diff --git a/chrome/browser/browseros/server/browseros_server_workers.h b/chrome/browser/browseros/server/browseros_server_workers.h
+new file mode 100644
+index 0000000000000..589a8ee990fff
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_server_workers.h
+@@ -0,0 +1,90 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_WORKERS_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_WORKERS_H_
++
++#include <memory>
++#include <set>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/weak_ptr.h"
++#include "chrome/browser/browseros/server/browseros_server_config.h"
++
++namespace browseros {
++
++class HealthChecker;
++class ProcessController;
++struct LaunchResult;
++
++// Extra sidecar server processes that share MCP traffic with the primary
++// one owned by BrowserOSServerManager. Each worker has its own backend and
++// extension ports and its own health checker. A worker is only handed to the
++// proxy once it answers /health, and is relaunched when it exits or fails a
++// health check.
++//
++// Lives on the UI thread.
++class BrowserOSServerWorkers {
++ public:
++  using HealthCheckerFactory =
++      base::RepeatingCallback<std::unique_ptr<HealthChecker>()>;
++  // Runs with the backend ports of the workers that are currently healthy
++  using BackendsChangedCallback =
++      base::RepeatingCallback<void(std::vector<int> ports)>;
++
++  BrowserOSServerWorkers(ProcessController* process_controller,
++                         HealthCheckerFactory health_checker_factory,
++                         BackendsChangedCallback on_backends_changed);
++  ~BrowserOSServerWorkers();
++
++  BrowserOSServerWorkers(const BrowserOSServerWorkers&) = delete;
++  BrowserOSServerWorkers& operator=(const BrowserOSServerWorkers&) = delete;
++
++  // Launches |count| workers configured like the primary's |base_config|.
++  void Start(int count, const ServerLaunchConfig& base_config);
++
++  // Shuts all workers down.
++  void Stop();
++
++  // Probes every running worker, restarting the ones that fail.
++  void CheckHealth();
++
++  // Relaunches workers whose process has exited.
++  void CheckProcesses();
++
++ private:
++  struct Worker;
++  struct LaunchedWorker;
++
++  // Picks ports for the worker and launches it. Blocking.
++  static LaunchedWorker LaunchOnBackground(
++      ProcessController* process_controller,
++      ServerLaunchConfig config,
++      std::set<int> excluded_ports);
++
++  void LaunchWorker(Worker* worker);
++  void OnWorkerLaunched(int index, int generation, LaunchedWorker launched);
++  void ProbeWorker(int index);
++  void OnWorkerHealthChecked(int index, int generation, bool success);
++  void RestartWorker(Worker& worker);
++  void TerminateWorker(Worker& worker);
++  void NotifyBackendsChanged();
++
++  raw_ptr<ProcessController> process_controller_;
++  HealthCheckerFactory health_checker_factory_;
++  BackendsChangedCallback on_backends_changed_;
++
++  ServerLaunchConfig base_config_;
++  std::vector<std::unique_ptr<Worker>> workers_;
++  // Source of Worker::generation, unique across Stop()/Start()
++  int next_generation_ = 0;
++
++  base::WeakPtrFactory<BrowserOSServerWorkers> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_WORKERS_H_
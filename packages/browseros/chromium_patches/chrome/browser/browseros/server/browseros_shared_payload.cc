@@ -0,0 +1,175 @@
+diff --git a/chrome/browser/browseros/server/browseros_shared_payload.cc b/chrome/browser/browseros/server/browseros_shared_payload.cc
+new file mode 100644
+index 0000000000000..ec4f1e2cc86e5
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_shared_payload.cc
+@@ -0,0 +1,169 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_shared_payload.h"
++
++#include <utility>
++
++#include "base/files/file_enumerator.h"
++#include "base/files/file_util.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "components/cbor/values.h"
++#include "components/cbor/writer.h"
++
++namespace browseros {
++
++namespace {
++
++// Snapshots and AX trees nest a good deal deeper than cbor::Writer's
++// default of 16
++constexpr size_t kMaxNestingLevel = 64;
++
++// Payload files older than this are assumed abandoned by the sidecar
++constexpr base::TimeDelta kMaxPayloadAge = base::Minutes(1);
++
++// Abandoned payloads are looked for at most this often
++constexpr base::TimeDelta kSweepInterval = base::Seconds(10);
++
++std::optional<cbor::Value> ToCborValue(const base::Value& value,
++                                       size_t depth) {
++  if (depth > kMaxNestingLevel) {
++    return std::nullopt;
++  }
++
++  switch (value.type()) {
++    case base::Value::Type::NONE:
++      return cbor::Value(cbor::Value::SimpleValue::NULL_VALUE);
++    case base::Value::Type::BOOLEAN:
++      return cbor::Value(value.GetBool());
++    case base::Value::Type::INTEGER:
++      return cbor::Value(static_cast<int64_t>(value.GetInt()));
++    case base::Value::Type::DOUBLE:
++      return cbor::Value(value.GetDouble());
++    case base::Value::Type::STRING:
++      return cbor::Value(value.GetString());
++    case base::Value::Type::BINARY:
++      return cbor::Value(value.GetBlob());
++    case base::Value::Type::DICT: {
++      std::vector<std::pair<cbor::Value, cbor::Value>> entries;
++      entries.reserve(value.GetDict().size());
++      for (const auto [key, item] : value.GetDict()) {
++        std::optional<cbor::Value> converted = ToCborValue(item, depth + 1);
++        if (!converted) {
++          return std::nullopt;
++        }
++        entries.emplace_back(cbor::Value(key), std::move(*converted));
++      }
++      return cbor::Value(cbor::Value::MapValue(std::move(entries)));
++    }
++    case base::Value::Type::LIST: {
++      cbor::Value::ArrayValue array;
++      array.reserve(value.GetList().size());
++      for (const base::Value& item : value.GetList()) {
++        std::optional<cbor::Value> converted = ToCborValue(item, depth + 1);
++        if (!converted) {
++          return std::nullopt;
++        }
++        array.push_back(std::move(*converted));
++      }
++      return cbor::Value(std::move(array));
++    }
++  }
++}
++
++// Deletes payload files the sidecar never picked up
++void SweepAbandonedPayloads(const base::FilePath& dir) {
++  const base::Time cutoff = base::Time::Now() - kMaxPayloadAge;
++  base::FileEnumerator files(dir, /*recursive=*/false,
++                             base::FileEnumerator::FILES);
++  for (base::FilePath path = files.Next(); !path.empty();
++       path = files.Next()) {
++    if (files.GetInfo().GetLastModifiedTime() < cutoff) {
++      base::DeleteFile(path);
++    }
++  }
++}
++
++void ResetPayloadDir(const base::FilePath& dir) {
++  base::DeletePathRecursively(dir);
++  if (!base::CreateDirectory(dir)) {
++    LOG(ERROR) << "browseros: Failed to create shared payload directory: "
++               << dir;
++  }
++}
++
++std::optional<SharedPayload> WritePayloadFile(base::FilePath path,
++                                              base::Value value,
++                                              bool sweep) {
++  if (sweep) {
++    SweepAbandonedPayloads(path.DirName());
++  }
++
++  std::optional<std::vector<uint8_t>> bytes = EncodeSharedPayload(value);
++  if (!bytes) {
++    LOG(WARNING) << "browseros: Direct call result too deeply nested for "
++                    "a shared payload";
++    return std::nullopt;
++  }
++  if (!base::WriteFile(path, *bytes)) {
++    LOG(WARNING) << "browseros: Failed to write shared payload " << path;
++    base::DeleteFile(path);
++    return std::nullopt;
++  }
++
++  SharedPayload payload;
++  payload.path = std::move(path);
++  payload.length = bytes->size();
++  return payload;
++}
++
++}  // namespace
++
++std::optional<std::vector<uint8_t>> EncodeSharedPayload(
++    const base::Value& value) {
++  std::optional<cbor::Value> converted = ToCborValue(value, 0);
++  if (!converted) {
++    return std::nullopt;
++  }
++  return cbor::Writer::Write(*converted, kMaxNestingLevel);
++}
++
++BrowserOSSharedPayloadWriter::BrowserOSSharedPayloadWriter(
++    const base::FilePath& dir)
++    : dir_(dir),
++      task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
++           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {
++  // Payloads of an earlier session are never read now
++  task_runner_->PostTask(FROM_HERE, base::BindOnce(&ResetPayloadDir, dir_));
++}
++
++BrowserOSSharedPayloadWriter::~BrowserOSSharedPayloadWriter() {
++  task_runner_->PostTask(
++      FROM_HERE,
++      base::BindOnce(base::IgnoreResult(&base::DeletePathRecursively), dir_));
++}
++
++void BrowserOSSharedPayloadWriter::Write(base::Value value,
++                                         WriteCallback callback) {
++  const base::TimeTicks now = base::TimeTicks::Now();
++  const bool sweep = now - last_sweep_ >= kSweepInterval;
++  if (sweep) {
++    last_sweep_ = now;
++  }
++
++  base::FilePath path = dir_.AppendASCII(
++      base::NumberToString(next_payload_id_++) + ".cbor");
++  task_runner_->PostTaskAndReplyWithResult(
++      FROM_HERE,
++      base::BindOnce(&WritePayloadFile, std::move(path), std::move(value),
++                     sweep),
++      std::move(callback));
++}
++
++}  // namespace browseros
@@ -0,0 +1,76 @@
+diff --git a/chrome/browser/browseros/server/browseros_shared_payload.h b/chrome/browser/browseros/server/browseros_shared_payload.h
+new file mode 100644
+index 0000000000000..cbbb4f48df003
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_shared_payload.h
+@@ -0,0 +1,70 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SHARED_PAYLOAD_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SHARED_PAYLOAD_H_
++
++#include <cstdint>
++#include <optional>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/time/time.h"
++#include "base/values.h"
++
++namespace base {
++class SequencedTaskRunner;
++}  // namespace base
++
++namespace browseros {
++
++// Payload file handed to the sidecar instead of an inline response body
++struct SharedPayload {
++  base::FilePath path;
++  uint64_t length = 0;
++};
++
++// Encodes |value| as CBOR (RFC 8949). Dicts become maps with string keys,
++// binary values byte strings and doubles floats, so the sidecar decodes the
++// payload without a schema. Returns nullopt if |value| nests too deeply.
++std::optional<std::vector<uint8_t>> EncodeSharedPayload(
++    const base::Value& value);
++
++// Writes large direct call results to files in a directory the sidecar
++// maps into memory, so only the file name and length cross the HTTP
++// connection. Each payload gets a file of its own; the sidecar deletes it
++// once read, and files it leaves behind are removed after a minute. The
++// directory is emptied when the writer is created and destroyed.
++//
++// Lives on the IO thread with BrowserOSServerProxy; encoding and file IO
++// run on a blocking sequence.
++class BrowserOSSharedPayloadWriter {
++ public:
++  // Runs with the written payload, or nullopt if it could not be written.
++  using WriteCallback =
++      base::OnceCallback<void(std::optional<SharedPayload>)>;
++
++  explicit BrowserOSSharedPayloadWriter(const base::FilePath& dir);
++  ~BrowserOSSharedPayloadWriter();
++
++  BrowserOSSharedPayloadWriter(const BrowserOSSharedPayloadWriter&) = delete;
++  BrowserOSSharedPayloadWriter& operator=(
++      const BrowserOSSharedPayloadWriter&) = delete;
++
++  // Encodes |value| into a new payload file. |callback| runs on the
++  // calling sequence.
++  void Write(base::Value value, WriteCallback callback);
++
++ private:
++  const base::FilePath dir_;
++  scoped_refptr<base::SequencedTaskRunner> task_runner_;
++  uint64_t next_payload_id_ = 0;
++  base::TimeTicks last_sweep_;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SHARED_PAYLOAD_H_
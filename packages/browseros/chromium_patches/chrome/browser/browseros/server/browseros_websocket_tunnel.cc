@@ -0,0 +1,306 @@
+diff --git a/chrome/browser/browseros/server/browseros_websocket_tunnel.cc b/chrome/browser/browseros/server/browseros_websocket_tunnel.cc
+new file mode 100644
+index 0000000000000..d0543cfae7e35
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_websocket_tunnel.cc
+@@ -0,0 +1,300 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/browseros_websocket_tunnel.h"
++
++#include <utility>
++
++#include "base/base64.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/rand_util.h"
++#include "base/strings/string_number_conversions.h"
++#include "net/base/io_buffer.h"
++#include "net/base/net_errors.h"
++#include "net/http/http_response_headers.h"
++#include "net/http/http_status_code.h"
++#include "net/http/http_util.h"
++#include "net/server/http_server_request_info.h"
++#include "net/server/web_socket_encoder.h"
++#include "net/server/web_socket_parse_result.h"
++#include "net/socket/stream_socket.h"
++#include "net/websockets/websocket_handshake_challenge.h"
++
++namespace browseros {
++
++namespace {
++
++constexpr int kReadBufferSize = 64 * 1024;
++
++// Larger handshake responses are treated as a broken backend
++constexpr size_t kMaxHandshakeResponseSize = 16 * 1024;
++
++// Bytes queued for the backend beyond this close the session rather than
++// growing without bound
++constexpr size_t kMaxQueuedWriteBytes = 16 * 1024 * 1024;  // 16 MB
++
++// Client request headers passed on to the backend's upgrade request
++constexpr const char* kForwardedRequestHeaders[] = {
++    "authorization",
++    "mcp-session-id",
++};
++
++int RandomMaskingKey() {
++  return static_cast<int>(base::RandUint64());
++}
++
++}  // namespace
++
++BrowserOSWebSocketTunnel::BrowserOSWebSocketTunnel(
++    MessageCallback on_message,
++    base::OnceClosure on_closed,
++    const net::NetworkTrafficAnnotationTag& traffic_annotation)
++    : on_message_(std::move(on_message)),
++      on_closed_(std::move(on_closed)),
++      traffic_annotation_(traffic_annotation) {}
++
++BrowserOSWebSocketTunnel::~BrowserOSWebSocketTunnel() = default;
++
++void BrowserOSWebSocketTunnel::Connect(
++    std::unique_ptr<net::StreamSocket> socket,
++    int backend_port,
++    const net::HttpServerRequestInfo& info,
++    ConnectedCallback callback) {
++  connected_callback_ = std::move(callback);
++
++  const std::string key = base::Base64Encode(base::RandBytesAsVector(16));
++  expected_accept_ = net::ComputeSecWebSocketAccept(key);
++
++  handshake_request_ = "GET " + info.path + " HTTP/1.1\r\n";
++  handshake_request_ +=
++      "Host: 127.0.0.1:" + base::NumberToString(backend_port) + "\r\n";
++  handshake_request_ += "Upgrade: websocket\r\n";
++  handshake_request_ += "Connection: Upgrade\r\n";
++  handshake_request_ += "Sec-WebSocket-Key: " + key + "\r\n";
++  handshake_request_ += "Sec-WebSocket-Version: 13\r\n";
++  for (const char* name : kForwardedRequestHeaders) {
++    auto it = info.headers.find(name);
++    if (it != info.headers.end()) {
++      handshake_request_ += std::string(name) + ": " + it->second + "\r\n";
++    }
++  }
++  handshake_request_ += "\r\n";
++
++  socket_ = std::move(socket);
++  int result = socket_->Connect(base::BindOnce(
++      &BrowserOSWebSocketTunnel::OnConnect, base::Unretained(this)));
++  if (result != net::ERR_IO_PENDING) {
++    OnConnect(result);
++  }
++}
++
++void BrowserOSWebSocketTunnel::Send(std::string_view message) {
++  if (!encoder_ || closed_) {
++    return;
++  }
++
++  std::string frame;
++  encoder_->EncodeTextFrame(message, RandomMaskingKey(), &frame);
++  QueueWrite(std::move(frame));
++}
++
++void BrowserOSWebSocketTunnel::OnConnect(int result) {
++  if (result != net::OK) {
++    LOG(WARNING) << "browseros: WebSocket backend connect failed - "
++                 << net::ErrorToString(result);
++    Close();
++    return;
++  }
++
++  read_buffer_ = base::MakeRefCounted<net::IOBufferWithSize>(kReadBufferSize);
++  base::WeakPtr<BrowserOSWebSocketTunnel> self = weak_factory_.GetWeakPtr();
++  QueueWrite(std::move(handshake_request_));
++  if (self && !closed_) {
++    DoRead();
++  }
++}
++
++void BrowserOSWebSocketTunnel::DoRead() {
++  // Reads that complete synchronously are handled in this loop rather than
++  // by recursing
++  while (true) {
++    int result = socket_->Read(
++        read_buffer_.get(), read_buffer_->size(),
++        base::BindOnce(&BrowserOSWebSocketTunnel::OnReadCompleted,
++                       base::Unretained(this)));
++    if (result == net::ERR_IO_PENDING || !HandleRead(result)) {
++      return;
++    }
++  }
++}
++
++void BrowserOSWebSocketTunnel::OnReadCompleted(int result) {
++  if (HandleRead(result)) {
++    DoRead();
++  }
++}
++
++bool BrowserOSWebSocketTunnel::HandleRead(int result) {
++  if (result <= 0) {
++    Close();
++    return false;
++  }
++
++  pending_read_.append(read_buffer_->data(), result);
++
++  base::WeakPtr<BrowserOSWebSocketTunnel> self = weak_factory_.GetWeakPtr();
++  if (!encoder_) {
++    if (pending_read_.find("\r\n\r\n") == std::string::npos) {
++      if (pending_read_.size() > kMaxHandshakeResponseSize) {
++        Close();
++        return false;
++      }
++      return true;  // Waiting for the rest of the response
++    }
++    if (!ProcessHandshakeResponse()) {
++      Close();
++      return false;
++    }
++    std::move(connected_callback_).Run(true);
++    if (!self) {
++      return false;
++    }
++  }
++
++  return ProcessFrames();
++}
++
++bool BrowserOSWebSocketTunnel::ProcessHandshakeResponse() {
++  const size_t header_end = pending_read_.find("\r\n\r\n") + 4;
++  auto headers = base::MakeRefCounted<net::HttpResponseHeaders>(
++      net::HttpUtil::AssembleRawHeaders(
++          std::string_view(pending_read_).substr(0, header_end)));
++  if (headers->response_code() != net::HTTP_SWITCHING_PROTOCOLS ||
++      headers->GetNormalizedHeader("sec-websocket-accept") !=
++          expected_accept_) {
++    LOG(WARNING) << "browseros: WebSocket backend rejected upgrade with "
++                 << headers->response_code();
++    return false;
++  }
++
++  pending_read_.erase(0, header_end);
++  // No extensions were offered, so frames are plain
++  encoder_ = net::WebSocketEncoder::CreateClient(std::string());
++  return true;
++}
++
++bool BrowserOSWebSocketTunnel::ProcessFrames() {
++  base::WeakPtr<BrowserOSWebSocketTunnel> self = weak_factory_.GetWeakPtr();
++  while (!pending_read_.empty()) {
++    int bytes_consumed = 0;
++    std::string payload;
++    net::WebSocketParseResult result =
++        encoder_->DecodeFrame(pending_read_, &bytes_consumed, &payload);
++    if (result == net::WebSocketParseResult::FRAME_INCOMPLETE) {
++      break;
++    }
++    pending_read_.erase(0, bytes_consumed);
++
++    switch (result) {
++      case net::WebSocketParseResult::FRAME_OK_MIDDLE:
++        pending_message_ += payload;
++        break;
++      case net::WebSocketParseResult::FRAME_OK_FINAL:
++        pending_message_ += payload;
++        on_message_.Run(std::exchange(pending_message_, std::string()));
++        break;
++      case net::WebSocketParseResult::FRAME_PING: {
++        std::string pong;
++        encoder_->EncodePongFrame(payload, RandomMaskingKey(), &pong);
++        QueueWrite(std::move(pong));
++        break;
++      }
++      case net::WebSocketParseResult::FRAME_PONG:
++        break;
++      default:
++        // Close frames and anything the encoder cannot decode end the
++        // session
++        Close();
++        return false;
++    }
++
++    if (!self || closed_) {
++      return false;
++    }
++  }
++  return true;
++}
++
++void BrowserOSWebSocketTunnel::QueueWrite(std::string data) {
++  if (write_queue_.size() + data.size() > kMaxQueuedWriteBytes) {
++    LOG(WARNING) << "browseros: WebSocket backend is not reading, closing";
++    Close();
++    return;
++  }
++
++  write_queue_ += data;
++  DoWrite();
++}
++
++void BrowserOSWebSocketTunnel::DoWrite() {
++  while (!closed_) {
++    if (!write_buffer_) {
++      if (write_queue_.empty()) {
++        return;
++      }
++      const int size = write_queue_.size();
++      write_buffer_ = base::MakeRefCounted<net::DrainableIOBuffer>(
++          base::MakeRefCounted<net::StringIOBuffer>(
++              std::exchange(write_queue_, std::string())),
++          size);
++    }
++
++    int result = socket_->Write(
++        write_buffer_.get(), write_buffer_->BytesRemaining(),
++        base::BindOnce(&BrowserOSWebSocketTunnel::OnWrite,
++                       base::Unretained(this)),
++        traffic_annotation_);
++    if (result == net::ERR_IO_PENDING) {
++      return;
++    }
++    if (result < 0) {
++      Close();
++      return;
++    }
++    write_buffer_->DidConsume(result);
++    if (write_buffer_->BytesRemaining() == 0) {
++      write_buffer_ = nullptr;
++    }
++  }
++}
++
++void BrowserOSWebSocketTunnel::OnWrite(int result) {
++  if (result < 0) {
++    Close();
++    return;
++  }
++
++  write_buffer_->DidConsume(result);
++  if (write_buffer_->BytesRemaining() == 0) {
++    write_buffer_ = nullptr;
++  }
++  DoWrite();
++}
++
++void BrowserOSWebSocketTunnel::Close() {
++  if (closed_) {
++    return;
++  }
++  closed_ = true;
++  socket_.reset();
++
++  if (connected_callback_) {
++    std::move(connected_callback_).Run(false);
++  } else if (on_closed_) {
++    std::move(on_closed_).Run();
++  }
++}
++
++}  // namespace browseros
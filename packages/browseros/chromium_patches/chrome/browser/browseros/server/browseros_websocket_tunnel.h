@@ -0,0 +1,112 @@
+diff --git a/chrome/browser/browseros/server/browseros_websocket_tunnel.h b/chrome/browser/browseros/server/browseros_websocket_tunnel.h
+new file mode 100644
+index 0000000000000..a8679a8040092
+--- /dev/null
++++ b/chrome/browser/browseros/server/browseros_websocket_tunnel.h
+@@ -0,0 +1,106 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_WEBSOCKET_TUNNEL_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_WEBSOCKET_TUNNEL_H_
++
++#include <memory>
++#include <string>
++#include <string_view>
++
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++
++namespace net {
++class DrainableIOBuffer;
++class HttpServerRequestInfo;
++class IOBufferWithSize;
++class StreamSocket;
++class WebSocketEncoder;
++}  // namespace net
++
++namespace browseros {
++
++// Client side of one WebSocket session from the proxy to the sidecar's
++// backend port. The proxy accepts the client's upgrade on its own
++// net::HttpServer and relays messages one by one: Send() frames a message
++// for the backend, and every message the backend sends is passed to the
++// message callback.
++//
++// Runs on the IO thread alongside BrowserOSServerProxy.
++class BrowserOSWebSocketTunnel {
++ public:
++  // Runs with true once the backend accepted the upgrade, or with false if
++  // the connection or handshake failed. |this| may be deleted from it.
++  using ConnectedCallback = base::OnceCallback<void(bool)>;
++  using MessageCallback = base::RepeatingCallback<void(std::string)>;
++
++  // |on_closed| runs when an established session ends from the backend
++  // side or fails. |this| may be deleted from it.
++  BrowserOSWebSocketTunnel(
++      MessageCallback on_message,
++      base::OnceClosure on_closed,
++      const net::NetworkTrafficAnnotationTag& traffic_annotation);
++  ~BrowserOSWebSocketTunnel();
++
++  BrowserOSWebSocketTunnel(const BrowserOSWebSocketTunnel&) = delete;
++  BrowserOSWebSocketTunnel& operator=(const BrowserOSWebSocketTunnel&) =
++      delete;
++
++  // Connects |socket| to the backend and upgrades |info|'s path, forwarding
++  // the client's auth headers. |backend_port| names the backend in the Host
++  // header.
++  void Connect(std::unique_ptr<net::StreamSocket> socket,
++               int backend_port,
++               const net::HttpServerRequestInfo& info,
++               ConnectedCallback callback);
++
++  // Sends |message| to the backend as a text frame. Only valid once
++  // connected.
++  void Send(std::string_view message);
++
++ private:
++  // The steps below may end up deleting |this| through a callback; the
++  // ones returning bool return false when the caller must stop.
++  void OnConnect(int result);
++  void DoRead();
++  void OnReadCompleted(int result);
++  bool HandleRead(int result);
++  bool ProcessHandshakeResponse();
++  bool ProcessFrames();
++
++  void QueueWrite(std::string data);
++  void DoWrite();
++  void OnWrite(int result);
++
++  // Drops the socket and reports the failure or close. |this| may be
++  // deleted on return.
++  void Close();
++
++  MessageCallback on_message_;
++  base::OnceClosure on_closed_;
++  ConnectedCallback connected_callback_;
++  const net::NetworkTrafficAnnotationTag traffic_annotation_;
++
++  std::unique_ptr<net::StreamSocket> socket_;
++  std::unique_ptr<net::WebSocketEncoder> encoder_;
++  std::string handshake_request_;
++  std::string expected_accept_;
++  bool closed_ = false;
++
++  scoped_refptr<net::IOBufferWithSize> read_buffer_;
++  std::string pending_read_;     // Received bytes not consumed yet
++  std::string pending_message_;  // Fragments of the message being received
++
++  scoped_refptr<net::DrainableIOBuffer> write_buffer_;
++  std::string write_queue_;  // Bytes waiting for |write_buffer_| to drain
++
++  base::WeakPtrFactory<BrowserOSWebSocketTunnel> weak_factory_{this};
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_WEBSOCKET_TUNNEL_H_
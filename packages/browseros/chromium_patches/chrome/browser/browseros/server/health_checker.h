@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/health_checker.h b/chrome/browser/browseros/server/health_checker.h
 new file mode 100644
-index 0000000000000..1cefa3ec91f42
+index 0000000000000..708bf62209978
 --- /dev/null
 +++ b/chrome/browser/browseros/server/health_checker.h
-@@ -0,0 +1,33 @@
+@@ -0,0 +1,37 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,6 +12,7 @@ index 0000000000000..1cefa3ec91f42
 +#define CHROME_BROWSER_BROWSEROS_SERVER_HEALTH_CHECKER_H_
 +
 +#include "base/functional/callback.h"
++#include "base/time/time.h"
 +
 +namespace browseros {
 +
@@ -32,6 +33,9 @@ index 0000000000000..1cefa3ec91f42
 +  virtual void RequestShutdown(
 +      int port,
 +      base::OnceCallback<void(bool success)> callback) = 0;
++
++  // Sets how long later CheckHealth() calls wait before failing.
++  virtual void SetHealthCheckTimeout(base::TimeDelta timeout) = 0;
 +};
 +
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/health_checker_impl.cc b/chrome/browser/browseros/server/health_checker_impl.cc
 new file mode 100644
-index 0000000000000..73ef5eaf9e8e3
+index 0000000000000..f3334e43316d8
 --- /dev/null
 +++ b/chrome/browser/browseros/server/health_checker_impl.cc
-@@ -0,0 +1,145 @@
+@@ -0,0 +1,152 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -25,11 +25,12 @@ index 0000000000000..73ef5eaf9e8e3
 +
 +namespace {
 +
-+constexpr base::TimeDelta kHealthCheckTimeout = base::Seconds(15);
++constexpr base::TimeDelta kDefaultHealthCheckTimeout = base::Seconds(15);
 +
 +}  // namespace
 +
-+HealthCheckerImpl::HealthCheckerImpl() = default;
++HealthCheckerImpl::HealthCheckerImpl()
++    : health_check_timeout_(kDefaultHealthCheckTimeout) {}
 +
 +HealthCheckerImpl::~HealthCheckerImpl() = default;
 +
@@ -47,7 +48,9 @@ index 0000000000000..73ef5eaf9e8e3
 +          description:
 +            "Checks if the BrowserOS MCP server is healthy by querying its "
 +            "/health endpoint."
-+          trigger: "Periodic health check every 30 seconds while server is running."
++          trigger:
++            "Periodic health check while the server is running, every 5 "
++            "seconds to 2 minutes depending on recent results."
 +          data: "No user data sent, just an HTTP GET request."
 +          destination: LOCAL
 +        }
@@ -66,7 +69,7 @@ index 0000000000000..73ef5eaf9e8e3
 +
 +  auto url_loader = network::SimpleURLLoader::Create(
 +      std::move(resource_request), traffic_annotation);
-+  url_loader->SetTimeoutDuration(kHealthCheckTimeout);
++  url_loader->SetTimeoutDuration(health_check_timeout_);
 +
 +  // Get URL loader factory from system network context
 +  auto* url_loader_factory =
@@ -80,6 +83,10 @@ index 0000000000000..73ef5eaf9e8e3
 +                     base::Unretained(this), std::move(callback)));
 +}
 +
++void HealthCheckerImpl::SetHealthCheckTimeout(base::TimeDelta timeout) {
++  health_check_timeout_ = timeout;
++}
++
 +void HealthCheckerImpl::RequestShutdown(
 +    int port,
 +    base::OnceCallback<void(bool success)> callback) {
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/health_checker_impl.h b/chrome/browser/browseros/server/health_checker_impl.h
 new file mode 100644
-index 0000000000000..7b1d0c8678540
+index 0000000000000..30769a79d47c3
 --- /dev/null
 +++ b/chrome/browser/browseros/server/health_checker_impl.h
-@@ -0,0 +1,49 @@
+@@ -0,0 +1,52 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,6 +14,7 @@ index 0000000000000..7b1d0c8678540
 +#include <memory>
 +
 +#include "base/memory/scoped_refptr.h"
++#include "base/time/time.h"
 +#include "chrome/browser/browseros/server/health_checker.h"
 +
 +namespace net {
@@ -41,6 +42,7 @@ index 0000000000000..7b1d0c8678540
 +                   base::OnceCallback<void(bool success)> callback) override;
 +  void RequestShutdown(int port,
 +                       base::OnceCallback<void(bool success)> callback) override;
++  void SetHealthCheckTimeout(base::TimeDelta timeout) override;
 +
 + private:
 +  void OnRequestComplete(
@@ -48,6 +50,7 @@ index 0000000000000..7b1d0c8678540
 +      scoped_refptr<net::HttpResponseHeaders> headers);
 +
 +  std::unique_ptr<network::SimpleURLLoader> url_loader_;
++  base::TimeDelta health_check_timeout_;
 +};
 +
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/process_controller_impl.cc b/chrome/browser/browseros/server/process_controller_impl.cc
 new file mode 100644
-index 0000000000000..a398856f672fd
+index 0000000000000..5622731ed159f
 --- /dev/null
 +++ b/chrome/browser/browseros/server/process_controller_impl.cc
-@@ -0,0 +1,210 @@
+@@ -0,0 +1,354 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -23,6 +23,17 @@ index 0000000000000..a398856f672fd
 +
 +#if BUILDFLAG(IS_POSIX)
 +#include <signal.h>
++#include <sys/resource.h>
++#endif
++
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++#include <sched.h>
++#endif
++
++#if BUILDFLAG(IS_WIN)
++#include <windows.h>
++
++#include "base/win/scoped_handle.h"
 +#endif
 +
 +namespace browseros {
@@ -39,6 +50,10 @@ index 0000000000000..a398856f672fd
 +base::FilePath WriteConfigJson(const ServerLaunchConfig& config,
 +                               const base::FilePath& actual_resources_dir) {
 +  base::FilePath config_path = config.paths.execution.Append(kConfigFileName);
++  if (config.worker_index > 0) {
++    config_path = config_path.InsertBeforeExtensionASCII(
++        "_worker" + base::NumberToString(config.worker_index));
++  }
 +
 +  base::Value::Dict root;
 +
@@ -55,9 +70,32 @@ index 0000000000000..a398856f672fd
 +  directories.Set("execution", config.paths.execution.AsUTF8Unsafe());
 +  root.Set("directories", std::move(directories));
 +
++  // ipc
++  base::Value::Dict ipc;
++  if (!config.paths.backend_socket.empty()) {
++    ipc.Set("server_socket", config.paths.backend_socket.AsUTF8Unsafe());
++  }
++  if (!config.direct_call_token.empty() && config.ports.proxy > 0) {
++    ipc.Set("direct_call_url",
++            "http://127.0.0.1:" + base::NumberToString(config.ports.proxy) +
++                "/browseros/call/");
++    ipc.Set("devtools_url",
++            "ws://127.0.0.1:" + base::NumberToString(config.ports.proxy) +
++                "/browseros/devtools");
++    ipc.Set("direct_call_token", config.direct_call_token);
++    if (!config.paths.shared_payloads.empty()) {
++      ipc.Set("shared_payload_dir",
++              config.paths.shared_payloads.AsUTF8Unsafe());
++    }
++  }
++  if (!ipc.empty()) {
++    root.Set("ipc", std::move(ipc));
++  }
++
 +  // flags
 +  base::Value::Dict flags;
 +  flags.Set("allow_remote_in_mcp", config.allow_remote_in_mcp);
++  flags.Set("worker_index", config.worker_index);
 +  root.Set("flags", std::move(flags));
 +
 +  // instance
@@ -82,6 +120,79 @@ index 0000000000000..a398856f672fd
 +  return config_path;
 +}
 +
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++// Applies priority and affinity in the child before exec, so every thread
++// the server starts inherits them. Only async-signal-safe calls here.
++class ResourceLimitsDelegate : public base::LaunchOptions::PreExecDelegate {
++ public:
++  explicit ResourceLimitsDelegate(const ServerResourceLimits& limits)
++      : nice_(limits.nice) {
++    CPU_ZERO(&cpu_set_);
++    for (int core : limits.cpu_affinity) {
++      if (core >= 0 && core < CPU_SETSIZE) {
++        CPU_SET(core, &cpu_set_);
++        has_affinity_ = true;
++      }
++    }
++  }
++
++  void RunAsyncSafe() override {
++    if (nice_ > 0) {
++      setpriority(PRIO_PROCESS, 0, nice_);
++    }
++    if (has_affinity_) {
++      sched_setaffinity(0, sizeof(cpu_set_), &cpu_set_);
++    }
++  }
++
++ private:
++  const int nice_;
++  cpu_set_t cpu_set_;
++  bool has_affinity_ = false;
++};
++#endif
++
++#if BUILDFLAG(IS_WIN)
++// Returns a job object enforcing |limits|, or an invalid handle if it
++// couldn't be set up. Processes stay in the job after the handle is closed.
++base::win::ScopedHandle CreateLimitsJob(const ServerResourceLimits& limits) {
++  base::win::ScopedHandle job(CreateJobObject(nullptr, nullptr));
++  if (!job.IsValid()) {
++    PLOG(WARNING) << "browseros: CreateJobObject failed";
++    return job;
++  }
++
++  JOBOBJECT_EXTENDED_LIMIT_INFORMATION info = {};
++  if (limits.nice > 0) {
++    info.BasicLimitInformation.LimitFlags |= JOB_OBJECT_LIMIT_PRIORITY_CLASS;
++    info.BasicLimitInformation.PriorityClass =
++        limits.nice >= 10 ? IDLE_PRIORITY_CLASS : BELOW_NORMAL_PRIORITY_CLASS;
++  }
++  if (limits.memory_limit_mb > 0) {
++    info.BasicLimitInformation.LimitFlags |= JOB_OBJECT_LIMIT_PROCESS_MEMORY;
++    info.ProcessMemoryLimit =
++        static_cast<SIZE_T>(limits.memory_limit_mb) * 1024 * 1024;
++  }
++  ULONG_PTR affinity = 0;
++  for (int core : limits.cpu_affinity) {
++    if (core >= 0 && core < static_cast<int>(sizeof(ULONG_PTR) * 8)) {
++      affinity |= ULONG_PTR{1} << core;
++    }
++  }
++  if (affinity != 0) {
++    info.BasicLimitInformation.LimitFlags |= JOB_OBJECT_LIMIT_AFFINITY;
++    info.BasicLimitInformation.Affinity = affinity;
++  }
++
++  if (!SetInformationJobObject(job.Get(), JobObjectExtendedLimitInformation,
++                               &info, sizeof(info))) {
++    PLOG(WARNING) << "browseros: Failed to set server job limits";
++    return base::win::ScopedHandle();
++  }
++  return job;
++}
++#endif
++
 +}  // namespace
 +
 +ProcessControllerImpl::ProcessControllerImpl() = default;
@@ -134,6 +245,11 @@ index 0000000000000..a398856f672fd
 +  cmd.AppendSwitchASCII("server-port", base::NumberToString(config.ports.server));
 +  cmd.AppendSwitchASCII("extension-port",
 +                        base::NumberToString(config.ports.extension));
++  if (!config.paths.backend_socket.empty()) {
++    // A socket file left by a crashed server would make its bind fail
++    base::DeleteFile(config.paths.backend_socket);
++    cmd.AppendSwitchPath("server-socket", config.paths.backend_socket);
++  }
 +
 +  // Set up launch options
 +  base::LaunchOptions options;
@@ -141,8 +257,36 @@ index 0000000000000..a398856f672fd
 +  options.start_hidden = true;
 +#endif
 +
++  const ServerResourceLimits& limits = config.limits;
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++  ResourceLimitsDelegate limits_delegate(limits);
++  if (limits.nice > 0 || !limits.cpu_affinity.empty()) {
++    options.pre_exec_delegate = &limits_delegate;
++  }
++#elif BUILDFLAG(IS_WIN)
++  base::win::ScopedHandle job;
++  if (!limits.IsEmpty()) {
++    job = CreateLimitsJob(limits);
++    if (job.IsValid()) {
++      options.job_handle = job.Get();
++    }
++  }
++#elif BUILDFLAG(IS_MAC)
++  if (!limits.cpu_affinity.empty()) {
++    LOG(WARNING) << "browseros: CPU affinity is not supported on macOS";
++  }
++#endif
++
 +  // Launch the process (blocking I/O)
 +  result.process = base::LaunchProcess(cmd, options);
++
++#if BUILDFLAG(IS_MAC)
++  // Niceness is per process on macOS, so it can be set after launch
++  if (result.process.IsValid() && limits.nice > 0 &&
++      setpriority(PRIO_PROCESS, result.process.Pid(), limits.nice) != 0) {
++    PLOG(WARNING) << "browseros: Failed to lower server priority";
++  }
++#endif
 +  return result;
 +}
 +
@@ -0,0 +1,99 @@
+diff --git a/chrome/browser/browseros/server/process_exit_watcher.cc b/chrome/browser/browseros/server/process_exit_watcher.cc
+new file mode 100644
+index 0000000000000..f482577557d0c
+--- /dev/null
++++ b/chrome/browser/browseros/server/process_exit_watcher.cc
+@@ -0,0 +1,93 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/process_exit_watcher.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++#include <sys/syscall.h>
++#include <unistd.h>
++
++#ifndef __NR_pidfd_open
++#define __NR_pidfd_open 434
++#endif
++#elif BUILDFLAG(IS_MAC)
++#include <errno.h>
++#include <sys/event.h>
++
++#include "base/posix/eintr_wrapper.h"
++#endif
++
++namespace browseros {
++
++ProcessExitWatcher::ProcessExitWatcher(base::Process process)
++    : process_(std::move(process)) {}
++
++ProcessExitWatcher::~ProcessExitWatcher() = default;
++
++bool ProcessExitWatcher::Watch(base::OnceClosure on_exit) {
++  if (!process_.IsValid()) {
++    return false;
++  }
++  on_exit_ = std::move(on_exit);
++
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++  // A pidfd becomes readable when the process exits (Linux 5.3+)
++  fd_.reset(static_cast<int>(syscall(__NR_pidfd_open, process_.Pid(), 0)));
++  if (!fd_.is_valid()) {
++    PLOG(WARNING) << "browseros: pidfd_open failed, polling for exit";
++    return false;
++  }
++#elif BUILDFLAG(IS_MAC)
++  fd_.reset(kqueue());
++  if (!fd_.is_valid()) {
++    PLOG(WARNING) << "browseros: kqueue failed, polling for exit";
++    return false;
++  }
++  struct kevent change;
++  EV_SET(&change, process_.Pid(), EVFILT_PROC, EV_ADD | EV_ONESHOT, NOTE_EXIT,
++         0, nullptr);
++  if (HANDLE_EINTR(kevent(fd_.get(), &change, 1, nullptr, 0, nullptr)) != 0) {
++    if (errno == ESRCH) {
++      OnExited();  // Already gone
++      return true;
++    }
++    PLOG(WARNING) << "browseros: kevent failed, polling for exit";
++    return false;
++  }
++#elif BUILDFLAG(IS_WIN)
++  return object_watcher_.StartWatchingOnce(process_.Handle(), this);
++#else
++  return false;
++#endif
++
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS) || BUILDFLAG(IS_MAC)
++  // A kqueue is itself readable once it has a pending event
++  fd_watcher_ = base::FileDescriptorWatcher::WatchReadable(
++      fd_.get(), base::BindRepeating(&ProcessExitWatcher::OnExited,
++                                     base::Unretained(this)));
++  return true;
++#endif
++}
++
++#if BUILDFLAG(IS_WIN)
++void ProcessExitWatcher::OnObjectSignaled(HANDLE object) {
++  OnExited();
++}
++#endif
++
++void ProcessExitWatcher::OnExited() {
++#if BUILDFLAG(IS_POSIX)
++  fd_watcher_.reset();
++#endif
++  if (on_exit_) {
++    std::move(on_exit_).Run();
++  }
++}
++
++}  // namespace browseros
@@ -0,0 +1,76 @@
+diff --git a/chrome/browser/browseros/server/process_exit_watcher.h b/chrome/browser/browseros/server/process_exit_watcher.h
+new file mode 100644
+index 0000000000000..cda2ae67004dc
+--- /dev/null
++++ b/chrome/browser/browseros/server/process_exit_watcher.h
+@@ -0,0 +1,70 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_EXIT_WATCHER_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_EXIT_WATCHER_H_
++
++#include <memory>
++
++#include "base/functional/callback.h"
++#include "base/process/process.h"
++#include "build/build_config.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include "base/files/file_descriptor_watcher_posix.h"
++#include "base/files/scoped_file.h"
++#elif BUILDFLAG(IS_WIN)
++#include "base/win/object_watcher.h"
++#endif
++
++namespace browseros {
++
++// Signals once a process has exited, without reaping it, so its exit code
++// can still be collected through base::Process afterwards. Uses a pidfd on
++// Linux, a kqueue on macOS and an object watcher on Windows.
++//
++// Lives on a ThreadPool sequence (see base::SequenceBound); |on_exit| runs
++// on that sequence.
++class ProcessExitWatcher
++#if BUILDFLAG(IS_WIN)
++    : public base::win::ObjectWatcher::Delegate
++#endif
++{
++ public:
++  explicit ProcessExitWatcher(base::Process process);
++#if BUILDFLAG(IS_WIN)
++  ~ProcessExitWatcher() override;
++#else
++  ~ProcessExitWatcher();
++#endif
++
++  ProcessExitWatcher(const ProcessExitWatcher&) = delete;
++  ProcessExitWatcher& operator=(const ProcessExitWatcher&) = delete;
++
++  // Starts watching. Returns false if exits can't be observed here (old
++  // kernel, unsupported platform), in which case the caller has to poll.
++  bool Watch(base::OnceClosure on_exit);
++
++ private:
++#if BUILDFLAG(IS_WIN)
++  // base::win::ObjectWatcher::Delegate:
++  void OnObjectSignaled(HANDLE object) override;
++#endif
++
++  void OnExited();
++
++  base::Process process_;
++  base::OnceClosure on_exit_;
++
++#if BUILDFLAG(IS_POSIX)
++  base::ScopedFD fd_;
++  std::unique_ptr<base::FileDescriptorWatcher::Controller> fd_watcher_;
++#elif BUILDFLAG(IS_WIN)
++  base::win::ObjectWatcher object_watcher_;
++#endif
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_PROCESS_EXIT_WATCHER_H_
@@ -0,0 +1,114 @@
+diff --git a/chrome/browser/browseros/server/resumable_download_file.cc b/chrome/browser/browseros/server/resumable_download_file.cc
+new file mode 100644
+index 0000000000000..f29e20906bea2
+--- /dev/null
++++ b/chrome/browser/browseros/server/resumable_download_file.cc
+@@ -0,0 +1,108 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/server/resumable_download_file.h"
++
++#include <optional>
++#include <utility>
++
++#include "base/containers/span.h"
++#include "base/files/file_util.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/values.h"
++
++namespace browseros_server {
++
++ResumableDownloadFile::ResumableDownloadFile(base::FilePath path,
++                                             base::FilePath state_path)
++    : path_(std::move(path)), state_path_(std::move(state_path)) {}
++
++ResumableDownloadFile::~ResumableDownloadFile() = default;
++
++ResumableDownloadFile::ResumePoint ResumableDownloadFile::Prepare(
++    const std::string& url) {
++  ResumePoint resume;
++
++  std::string state_json;
++  std::optional<int64_t> size = base::GetFileSize(path_);
++  if (size.value_or(0) > 0 &&
++      base::ReadFileToString(state_path_, &state_json)) {
++    std::optional<base::Value::Dict> state =
++        base::JSONReader::ReadDict(state_json);
++    const std::string* state_url = state ? state->FindString("url") : nullptr;
++    const std::string* validator =
++        state ? state->FindString("validator") : nullptr;
++    if (state_url && *state_url == url && validator && !validator->empty()) {
++      resume.offset = *size;
++      resume.validator = *validator;
++      return resume;
++    }
++  }
++
++  Discard();
++  base::CreateDirectory(path_.DirName());
++  return resume;
++}
++
++bool ResumableDownloadFile::Begin(int64_t offset,
++                                  const std::string& url,
++                                  const std::string& validator) {
++  if (offset == 0) {
++    file_.Initialize(path_,
++                     base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
++  } else {
++    file_.Initialize(path_, base::File::FLAG_OPEN | base::File::FLAG_WRITE);
++    if (file_.IsValid() && (file_.GetLength() != offset ||
++                            file_.Seek(base::File::FROM_BEGIN, offset) !=
++                                offset)) {
++      LOG(WARNING) << "browseros: Partial download changed on disk";
++      file_.Close();
++    }
++  }
++  if (!file_.IsValid()) {
++    LOG(ERROR) << "browseros: Failed to open download file " << path_ << ": "
++               << base::File::ErrorToString(file_.error_details());
++    return false;
++  }
++
++  // Written before any data, so the bytes on disk always belong to the
++  // recorded response
++  if (validator.empty()) {
++    base::DeleteFile(state_path_);
++    return true;
++  }
++  base::Value::Dict state;
++  state.Set("url", url);
++  state.Set("validator", validator);
++  std::optional<std::string> state_json = base::WriteJson(state);
++  if (!state_json || !base::WriteFile(state_path_, *state_json)) {
++    base::DeleteFile(state_path_);
++  }
++  return true;
++}
++
++bool ResumableDownloadFile::Write(std::string data) {
++  return file_.IsValid() &&
++         file_.WriteAtCurrentPosAndCheck(base::as_byte_span(data));
++}
++
++bool ResumableDownloadFile::Finish(bool complete, bool discard) {
++  const bool was_open = file_.IsValid();
++  file_.Close();
++  if (discard) {
++    Discard();
++  } else if (complete) {
++    base::DeleteFile(state_path_);
++  }
++  return was_open;
++}
++
++void ResumableDownloadFile::Discard() {
++  base::DeleteFile(state_path_);
++  base::DeleteFile(path_);
++}
++
++}  // namespace browseros_server
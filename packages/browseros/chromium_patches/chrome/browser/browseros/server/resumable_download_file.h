@@ -0,0 +1,70 @@
+diff --git a/chrome/browser/browseros/server/resumable_download_file.h b/chrome/browser/browseros/server/resumable_download_file.h
+new file mode 100644
+index 0000000000000..69fa455808df1
+--- /dev/null
++++ b/chrome/browser/browseros/server/resumable_download_file.h
+@@ -0,0 +1,64 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_SERVER_RESUMABLE_DOWNLOAD_FILE_H_
++#define CHROME_BROWSER_BROWSEROS_SERVER_RESUMABLE_DOWNLOAD_FILE_H_
++
++#include <cstdint>
++#include <string>
++
++#include "base/files/file.h"
++#include "base/files/file_path.h"
++
++namespace browseros_server {
++
++// An update package being downloaded to disk, kept across interrupted
++// transfers so the next attempt can continue with an HTTP range request.
++// Next to the file, a small JSON state file records the URL it comes from
++// and the validator (strong ETag, else Last-Modified) to send in If-Range,
++// so bytes from a since-replaced package are never stitched together.
++//
++// Lives on a ThreadPool sequence (see base::SequenceBound).
++class ResumableDownloadFile {
++ public:
++  // Where a download can continue; |offset| is 0 when it has to start over.
++  struct ResumePoint {
++    int64_t offset = 0;
++    std::string validator;
++  };
++
++  ResumableDownloadFile(base::FilePath path, base::FilePath state_path);
++  ~ResumableDownloadFile();
++
++  ResumableDownloadFile(const ResumableDownloadFile&) = delete;
++  ResumableDownloadFile& operator=(const ResumableDownloadFile&) = delete;
++
++  // Returns how much of |url| is already on disk. Anything that can't be
++  // resumed is discarded, leaving the directory ready for a fresh download.
++  ResumePoint Prepare(const std::string& url);
++
++  // Opens the file for a response starting at |offset|, truncating it when
++  // |offset| is 0. An empty |validator| makes the download non-resumable.
++  bool Begin(int64_t offset,
++             const std::string& url,
++             const std::string& validator);
++
++  bool Write(std::string data);
++
++  // Closes the file. A |complete| download no longer needs its resume state;
++  // with |discard| the partial file is deleted as well. Returns false if the
++  // file was not open.
++  bool Finish(bool complete, bool discard);
++
++ private:
++  void Discard();
++
++  const base::FilePath path_;
++  const base::FilePath state_path_;
++  base::File file_;
++};
++
++}  // namespace browseros_server
++
++#endif  // CHROME_BROWSER_BROWSEROS_SERVER_RESUMABLE_DOWNLOAD_FILE_H_
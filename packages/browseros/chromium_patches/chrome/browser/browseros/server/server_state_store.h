@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/server_state_store.h b/chrome/browser/browseros/server/server_state_store.h
 new file mode 100644
-index 0000000000000..634ed7b5fb6eb
+index 0000000000000..d0672938593f3
 --- /dev/null
 +++ b/chrome/browser/browseros/server/server_state_store.h
-@@ -0,0 +1,36 @@
+@@ -0,0 +1,38 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -24,16 +24,18 @@ index 0000000000000..634ed7b5fb6eb
 + public:
 +  virtual ~ServerStateStore() = default;
 +
-+  // Read state file.
++  // Read state file. Blocks, so must run on a thread that allows blocking.
 +  // Returns nullopt if file doesn't exist or has invalid format.
 +  virtual std::optional<server_utils::ServerState> Read() = 0;
 +
 +  // Write state file with pid and creation_time.
-+  // Returns true on success.
++  // Returns true on success, or once scheduled for stores that write in
++  // the background.
 +  virtual bool Write(const server_utils::ServerState& state) = 0;
 +
 +  // Delete state file.
-+  // Returns true on success (or if file didn't exist).
++  // Returns true on success (or if file didn't exist), or once scheduled
++  // for stores that write in the background.
 +  virtual bool Delete() = 0;
 +};
 +
@@ -1,18 +1,25 @@
 diff --git a/chrome/browser/browseros/server/server_state_store_impl.cc b/chrome/browser/browseros/server/server_state_store_impl.cc
 new file mode 100644
-index 0000000000000..76805b00dee0d
+index 0000000000000..1a62f0e992129
 --- /dev/null
 +++ b/chrome/browser/browseros/server/server_state_store_impl.cc
-@@ -0,0 +1,25 @@
+@@ -0,0 +1,37 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/server_state_store_impl.h"
 +
++#include "base/functional/bind.h"
++#include "base/functional/callback_helpers.h"
++#include "base/task/thread_pool.h"
++
 +namespace browseros {
 +
-+ServerStateStoreImpl::ServerStateStoreImpl() = default;
++ServerStateStoreImpl::ServerStateStoreImpl()
++    : task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
++           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})) {}
 +
 +ServerStateStoreImpl::~ServerStateStoreImpl() = default;
 +
@@ -21,11 +28,16 @@ index 0000000000000..76805b00dee0d
 +}
 +
 +bool ServerStateStoreImpl::Write(const server_utils::ServerState& state) {
-+  return server_utils::WriteStateFile(state);
++  // Failures are logged by WriteStateFile
++  return task_runner_->PostTask(
++      FROM_HERE,
++      base::BindOnce(base::IgnoreResult(&server_utils::WriteStateFile), state));
 +}
 +
 +bool ServerStateStoreImpl::Delete() {
-+  return server_utils::DeleteStateFile();
++  return task_runner_->PostTask(
++      FROM_HERE,
++      base::BindOnce(base::IgnoreResult(&server_utils::DeleteStateFile)));
 +}
 +
 +}  // namespace browseros
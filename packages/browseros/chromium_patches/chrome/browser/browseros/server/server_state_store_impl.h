@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/server_state_store_impl.h b/chrome/browser/browseros/server/server_state_store_impl.h
 new file mode 100644
-index 0000000000000..33b8015e18b03
+index 0000000000000..7521dd2e8c365
 --- /dev/null
 +++ b/chrome/browser/browseros/server/server_state_store_impl.h
-@@ -0,0 +1,30 @@
+@@ -0,0 +1,38 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,12 +11,17 @@ index 0000000000000..33b8015e18b03
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_SERVER_STATE_STORE_IMPL_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_SERVER_STATE_STORE_IMPL_H_
 +
++#include "base/memory/scoped_refptr.h"
++#include "base/task/sequenced_task_runner.h"
 +#include "chrome/browser/browseros/server/server_state_store.h"
 +
 +namespace browseros {
 +
 +// Production implementation of ServerStateStore.
-+// Uses server_utils functions to read/write state file on disk.
++// Uses server_utils functions to read/write state file on disk. Writes and
++// deletes are posted, in order, to a background sequence that finishes
++// them before shutdown, so server restarts do no disk I/O on the caller's
++// thread.
 +class ServerStateStoreImpl : public ServerStateStore {
 + public:
 +  ServerStateStoreImpl();
@@ -29,6 +34,9 @@ index 0000000000000..33b8015e18b03
 +  std::optional<server_utils::ServerState> Read() override;
 +  bool Write(const server_utils::ServerState& state) override;
 +  bool Delete() override;
++
++ private:
++  scoped_refptr<base::SequencedTaskRunner> task_runner_;
 +};
 +
 +}  // namespace browseros
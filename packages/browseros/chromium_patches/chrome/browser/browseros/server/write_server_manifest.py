@@ -0,0 +1,60 @@
+diff --git a/chrome/browser/browseros/server/write_server_manifest.py b/chrome/browser/browseros/server/write_server_manifest.py
+new file mode 100644
+index 0000000000000..b4ec5bc256e1f
+--- /dev/null
++++ b/chrome/browser/browseros/server/write_server_manifest.py
+@@ -0,0 +1,54 @@
++#!/usr/bin/env python3
++# Copyright 2025 The Chromium Authors
++# Use of this source code is governed by a BSD-style license that can be
++# found in the LICENSE file.
++
++"""Writes the manifest bundled next to the BrowserOS server binary.
++
++The browser reads the bundled server's version from this manifest instead of
++spawning the binary with --version at startup. The version comes from
++--version when given, otherwise from running the binary if the build host can
++execute it. When neither works the manifest has no version and the browser
++falls back to asking the binary at runtime.
++"""
++
++import argparse
++import json
++import subprocess
++import sys
++
++
++def get_binary_version(binary):
++  try:
++    result = subprocess.run([binary, "--version"],
++                            capture_output=True,
++                            text=True,
++                            timeout=30)
++  except (OSError, subprocess.TimeoutExpired) as e:
++    # Missing binary, or built for another OS or architecture
++    print(f"Note: Could not run {binary} --version: {e}")
++    return ""
++  if result.returncode != 0:
++    print(f"Note: {binary} --version exited with {result.returncode}")
++    return ""
++  return result.stdout.strip()
++
++
++parser = argparse.ArgumentParser(description=__doc__)
++parser.add_argument("--binary", required=True)
++parser.add_argument("--output", required=True)
++parser.add_argument("--version", default="")
++args = parser.parse_args()
++
++version = args.version or get_binary_version(args.binary)
++
++manifest = {}
++if version:
++  manifest["version"] = version
++
++with open(args.output, "w") as f:
++  json.dump(manifest, f)
++  f.write("\n")
++
++print(f"✓ BrowserOS server manifest written (version: {version or 'unknown'})")
++sys.exit(0)
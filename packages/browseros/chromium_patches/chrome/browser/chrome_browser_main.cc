@@ -63,18 +63,19 @@ index 03aef97f335b0..c6b111da5e01e 100644
  #if BUILDFLAG(IS_MAC)
  #if defined(ARCH_CPU_X86_64)
    // The use of Rosetta to run the x64 version of Chromium on Arm is neither
-@@ -1414,6 +1454,10 @@ int ChromeBrowserMainParts::PreMainMessageLoopRunImpl() {
+@@ -1414,6 +1454,11 @@ int ChromeBrowserMainParts::PreMainMessageLoopRunImpl() {
    // running.
    browser_process_->PreMainMessageLoopRun();
  
-+  // BrowserOS: Start the BrowserOS server after browser initialization
++  // BrowserOS: Start the BrowserOS server after browser initialization.
++  // Only the MCP port is reserved here; launching waits for startup to end.
 +  LOG(INFO) << "browseros: Starting BrowserOS server process";
 +  browseros::BrowserOSServerManager::GetInstance()->Start();
 +
  #if BUILDFLAG(IS_WIN)
    // If the command line specifies 'uninstall' then we need to work here
    // unless we detect another chrome browser running.
-@@ -1855,6 +1899,11 @@ void ChromeBrowserMainParts::PostMainMessageLoopRun() {
+@@ -1855,6 +1900,11 @@ void ChromeBrowserMainParts::PostMainMessageLoopRun() {
    for (auto& chrome_extra_part : chrome_extra_parts_)
      chrome_extra_part->PostMainMessageLoopRun();
  
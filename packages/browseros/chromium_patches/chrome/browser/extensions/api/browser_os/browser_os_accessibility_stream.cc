@@ -0,0 +1,263 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_accessibility_stream.cc b/chrome/browser/extensions/api/browser_os/browser_os_accessibility_stream.cc
+new file mode 100644
+index 0000000000000..6daadb3d53965
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_accessibility_stream.cc
+@@ -0,0 +1,257 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_accessibility_stream.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/containers/contains.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "content/public/browser/web_contents.h"
++#include "extensions/browser/event_router.h"
++#include "ui/accessibility/ax_node.h"
++#include "ui/accessibility/ax_tree.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++#include "ui/accessibility/platform/browser_accessibility_manager.h"
++
++namespace extensions {
++namespace api {
++
++// static
++void BrowserOSAccessibilityStream::Start(content::WebContents* web_contents,
++                                         Config config) {
++  Stop(web_contents);
++  CreateForWebContents(web_contents, std::move(config));
++}
++
++// static
++void BrowserOSAccessibilityStream::Stop(content::WebContents* web_contents) {
++  web_contents->RemoveUserData(UserDataKey());
++}
++
++BrowserOSAccessibilityStream::BrowserOSAccessibilityStream(
++    content::WebContents* web_contents,
++    Config config)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSAccessibilityStream>(
++          *web_contents),
++      config_(std::move(config)),
++      accessibility_mode_(web_contents->CreateScopedAccessibilityMode(
++          GetSnapshotAXMode(SnapshotProfile::kFull))),
++      start_time_(base::TimeTicks::Now()) {
++  LOG(INFO) << "[browseros] Accessibility stream started for tab "
++            << ExtensionTabUtil::GetTabId(web_contents) << " every "
++            << config_.interval.InMilliseconds() << " ms";
++  // Without a live tree yet, the renderer sends the whole tree as accessibility
++  // comes on, and the first update resets the stream then
++  QueueLiveTree();
++}
++
++BrowserOSAccessibilityStream::~BrowserOSAccessibilityStream() {
++  LOG(INFO) << "[browseros] Accessibility stream stopped after "
++            << batches_sent_ << " batches (" << nodes_sent_ << " nodes)";
++  browseros_metrics::BrowserOSMetrics::Log(
++      "accessibility_stream.stopped",
++      {{"batches_sent", base::Value(batches_sent_)},
++       {"nodes_sent", base::Value(nodes_sent_)},
++       {"duration_s",
++        base::Value(static_cast<int>(
++            (base::TimeTicks::Now() - start_time_).InSeconds()))}});
++}
++
++void BrowserOSAccessibilityStream::ResetTree(const ui::AXTreeID& tree_id) {
++  tree_id_ = tree_id;
++  root_id_ = ui::kInvalidAXNodeID;
++  root_changed_ = false;
++  reset_pending_ = true;
++  children_.clear();
++  parents_.clear();
++  pending_nodes_.clear();
++  detached_.clear();
++}
++
++void BrowserOSAccessibilityStream::QueueLiveTree() {
++  const ui::AXTreeID tree_id =
++      web_contents()->GetPrimaryMainFrame()->GetAXTreeID();
++  ui::BrowserAccessibilityManager* manager =
++      ui::BrowserAccessibilityManager::FromID(tree_id);
++  if (!manager || !manager->ax_tree() || !manager->ax_tree()->root()) {
++    return;
++  }
++
++  ResetTree(tree_id);
++  const ui::AXNode& root = *manager->ax_tree()->root();
++  root_id_ = root.id();
++  root_changed_ = true;
++  QueueSubtree(root);
++  ScheduleFlush();
++}
++
++void BrowserOSAccessibilityStream::QueueSubtree(const ui::AXNode& node) {
++  QueueNode(node.data());
++  for (const ui::AXNode* child : node.children()) {
++    QueueSubtree(*child);
++  }
++}
++
++void BrowserOSAccessibilityStream::QueueNode(const ui::AXNodeData& data) {
++  std::vector<ui::AXNodeID>& children = children_[data.id];
++  for (ui::AXNodeID child_id : children) {
++    auto parent = parents_.find(child_id);
++    if (parent != parents_.end() && parent->second == data.id &&
++        !base::Contains(data.child_ids, child_id)) {
++      parents_.erase(parent);
++      detached_.insert(child_id);
++    }
++  }
++  for (ui::AXNodeID child_id : data.child_ids) {
++    parents_[child_id] = data.id;
++  }
++  children = data.child_ids;
++  pending_nodes_.insert_or_assign(data.id, data);
++}
++
++void BrowserOSAccessibilityStream::ClearChildren(ui::AXNodeID node_id) {
++  auto it = children_.find(node_id);
++  if (it == children_.end()) {
++    return;
++  }
++  for (ui::AXNodeID child_id : it->second) {
++    auto parent = parents_.find(child_id);
++    if (parent != parents_.end() && parent->second == node_id) {
++      parents_.erase(parent);
++      detached_.insert(child_id);
++    }
++  }
++  it->second.clear();
++}
++
++void BrowserOSAccessibilityStream::ForgetSubtree(ui::AXNodeID node_id) {
++  auto it = children_.find(node_id);
++  if (it != children_.end()) {
++    const std::vector<ui::AXNodeID> children = std::move(it->second);
++    children_.erase(it);
++    for (ui::AXNodeID child_id : children) {
++      // Children moved elsewhere stay
++      auto parent = parents_.find(child_id);
++      if (parent != parents_.end() && parent->second == node_id) {
++        parents_.erase(parent);
++        ForgetSubtree(child_id);
++      }
++    }
++  }
++  pending_nodes_.erase(node_id);
++  detached_.erase(node_id);
++}
++
++void BrowserOSAccessibilityStream::ScheduleFlush() {
++  if (!flush_timer_.IsRunning()) {
++    // Unretained: the timer is owned by this object
++    flush_timer_.Start(FROM_HERE, config_.interval,
++                       base::BindOnce(&BrowserOSAccessibilityStream::Flush,
++                                      base::Unretained(this)));
++  }
++}
++
++void BrowserOSAccessibilityStream::Flush() {
++  // Nodes dropped from one parent and attached to another in the same
++  // interval were moved, not removed
++  std::vector<ui::AXNodeID> removed;
++  for (ui::AXNodeID node_id : detached_) {
++    if (!parents_.contains(node_id) && node_id != root_id_) {
++      removed.push_back(node_id);
++    }
++  }
++  std::ranges::sort(removed);
++  for (ui::AXNodeID node_id : removed) {
++    ForgetSubtree(node_id);
++  }
++  detached_.clear();
++
++  if (pending_nodes_.empty() && removed.empty() && !reset_pending_ &&
++      !root_changed_) {
++    return;
++  }
++
++  EventRouter* event_router =
++      EventRouter::Get(web_contents()->GetBrowserContext());
++  if (!event_router) {
++    pending_nodes_.clear();
++    return;
++  }
++
++  browser_os::AccessibilityUpdateBatch batch;
++  batch.tab_id = ExtensionTabUtil::GetTabId(web_contents());
++  batch.sequence = ++sequence_;
++  batch.reset = reset_pending_;
++  if (root_changed_) {
++    batch.root_id = root_id_;
++  }
++  for (const auto& [node_id, data] : pending_nodes_) {
++    batch.nodes.additional_properties.Set(
++        base::NumberToString(node_id),
++        SerializeAXNodeData(data, config_.attribute_filter));
++  }
++  batch.removed_node_ids.assign(removed.begin(), removed.end());
++  batch.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
++
++  nodes_sent_ += static_cast<int>(pending_nodes_.size());
++  batches_sent_++;
++  VLOG(1) << "[browseros] Accessibility batch " << sequence_ << ": "
++          << pending_nodes_.size() << " nodes, " << removed.size()
++          << " removed" << (reset_pending_ ? ", reset" : "");
++  pending_nodes_.clear();
++  reset_pending_ = false;
++  root_changed_ = false;
++
++  auto event = std::make_unique<Event>(
++      events::UNKNOWN, browser_os::OnAccessibilityUpdates::kEventName,
++      browser_os::OnAccessibilityUpdates::Create(batch),
++      web_contents()->GetBrowserContext());
++  event_router->DispatchEventToExtension(config_.extension_id,
++                                         std::move(event));
++}
++
++void BrowserOSAccessibilityStream::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  const ui::AXTreeID main_tree_id =
++      web_contents()->GetPrimaryMainFrame()->GetAXTreeID();
++  if (details.ax_tree_id != main_tree_id) {
++    return;
++  }
++  // A new document, whose first update is its whole tree
++  if (details.ax_tree_id != tree_id_) {
++    ResetTree(details.ax_tree_id);
++  }
++
++  for (const ui::AXTreeUpdate& update : details.updates) {
++    if (update.node_id_to_clear != ui::kInvalidAXNodeID) {
++      ClearChildren(update.node_id_to_clear);
++    }
++    if (update.root_id != ui::kInvalidAXNodeID && update.root_id != root_id_) {
++      root_id_ = update.root_id;
++      root_changed_ = true;
++      parents_.erase(root_id_);
++    }
++    for (const ui::AXNodeData& data : update.nodes) {
++      QueueNode(data);
++    }
++  }
++  ScheduleFlush();
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSAccessibilityStream);
++
++}  // namespace api
++}  // namespace extensions
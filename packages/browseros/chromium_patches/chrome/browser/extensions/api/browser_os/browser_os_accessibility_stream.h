@@ -0,0 +1,134 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_accessibility_stream.h b/chrome/browser/extensions/api/browser_os/browser_os_accessibility_stream.h
+new file mode 100644
+index 0000000000000..934187647b1b5
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_accessibility_stream.h
+@@ -0,0 +1,128 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACCESSIBILITY_STREAM_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACCESSIBILITY_STREAM_H_
++
++#include <map>
++#include <memory>
++#include <string>
++#include <unordered_map>
++#include <unordered_set>
++#include <vector>
++
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_id.h"
++
++namespace content {
++class ScopedAccessibilityMode;
++}  // namespace content
++
++namespace ui {
++class AXNode;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Pushes a tab's accessibility tree changes to the extension that started
++// the stream as browserOS.onAccessibilityUpdates events, so agents outside
++// the browser can keep a mirror of the tree without re-snapshotting. Changes
++// are coalesced for |interval| after the first one: each batch carries the
++// latest state of every node touched since the previous batch, and the
++// roots of the subtrees dropped from the tree.
++//
++// The first batch is the whole tree, and so is the first one after each
++// cross-document navigation, both marked as a reset. Like action recording,
++// only the main frame's tree is followed.
++class BrowserOSAccessibilityStream
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSAccessibilityStream> {
++ public:
++  struct Config {
++    std::string extension_id;
++    base::TimeDelta interval;
++    AXAttributeFilter attribute_filter;
++  };
++
++  // Starts or restarts the stream for |web_contents| with |config|
++  static void Start(content::WebContents* web_contents, Config config);
++
++  // Stops the stream for |web_contents|, if any
++  static void Stop(content::WebContents* web_contents);
++
++  BrowserOSAccessibilityStream(const BrowserOSAccessibilityStream&) = delete;
++  BrowserOSAccessibilityStream& operator=(
++      const BrowserOSAccessibilityStream&) = delete;
++  ~BrowserOSAccessibilityStream() override;
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSAccessibilityStream>;
++
++  BrowserOSAccessibilityStream(content::WebContents* web_contents,
++                               Config config);
++
++  // Drops what was sent for the previous tree and marks the next batch as a
++  // reset
++  void ResetTree(const ui::AXTreeID& tree_id);
++
++  // Queues the browser's current copy of the main frame tree, if it has one
++  void QueueLiveTree();
++  void QueueSubtree(const ui::AXNode& node);
++
++  // Records |data| as the latest state of its node, noting children it no
++  // longer has
++  void QueueNode(const ui::AXNodeData& data);
++
++  // Detaches |node_id|'s children, as an update's node_id_to_clear does
++  void ClearChildren(ui::AXNodeID node_id);
++
++  // Forgets |node_id| and the descendants still attached under it
++  void ForgetSubtree(ui::AXNodeID node_id);
++
++  void ScheduleFlush();
++  void Flush();
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++
++  const Config config_;
++  std::unique_ptr<content::ScopedAccessibilityMode> accessibility_mode_;
++
++  // Tree the state below belongs to
++  ui::AXTreeID tree_id_ = ui::AXTreeIDUnknown();
++  ui::AXNodeID root_id_ = ui::kInvalidAXNodeID;
++  bool root_changed_ = false;
++  bool reset_pending_ = false;
++
++  // Children and parent of every node the mirror holds, as of the latest
++  // update
++  std::unordered_map<ui::AXNodeID, std::vector<ui::AXNodeID>> children_;
++  std::unordered_map<ui::AXNodeID, ui::AXNodeID> parents_;
++
++  // Latest state of the nodes changed since the last batch
++  std::map<ui::AXNodeID, ui::AXNodeData> pending_nodes_;
++  // Nodes that lost their parent since the last batch. Those not attached
++  // elsewhere by the time of the batch are reported as removed.
++  std::unordered_set<ui::AXNodeID> detached_;
++
++  base::OneShotTimer flush_timer_;
++  int sequence_ = 0;
++  int batches_sent_ = 0;
++  int nodes_sent_ = 0;
++  base::TimeTicks start_time_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACCESSIBILITY_STREAM_H_
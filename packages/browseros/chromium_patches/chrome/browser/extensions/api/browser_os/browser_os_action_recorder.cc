@@ -0,0 +1,424 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_action_recorder.cc b/chrome/browser/extensions/api/browser_os/browser_os_action_recorder.cc
+new file mode 100644
+index 0000000000000..77a3d2e6f6954
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_action_recorder.cc
+@@ -0,0 +1,418 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_recorder.h"
++
++#include <iterator>
++#include <utility>
++
++#include "base/logging.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_script.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "content/public/browser/web_contents.h"
++#include "third_party/blink/public/common/input/web_input_event.h"
++#include "third_party/blink/public/common/input/web_keyboard_event.h"
++#include "third_party/blink/public/common/input/web_mouse_event.h"
++#include "third_party/blink/public/common/input/web_mouse_wheel_event.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++#include "ui/events/keycodes/dom/dom_key.h"
++#include "ui/events/keycodes/dom/keycode_converter.h"
++#include "ui/gfx/geometry/point_f.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Steps kept per recording; older ones are dropped beyond this
++constexpr size_t kMaxRecordedActions = 2000;
++
++// Wheel events closer together than this extend the same scroll step
++constexpr base::TimeDelta kScrollBurstGap = base::Seconds(1);
++
++// Named keys recorded as sendKeys steps. Backspace and Delete only edit
++// text, which the inputText step of the field already reflects.
++bool IsRecordedKey(const std::string& key) {
++  // Simple check instead of std::set to avoid exit-time destructor
++  return key == "Enter" || key == "Tab" || key == "Escape" ||
++         key == "ArrowUp" || key == "ArrowDown" || key == "ArrowLeft" ||
++         key == "ArrowRight" || key == "Home" || key == "End" ||
++         key == "PageUp" || key == "PageDown";
++}
++
++// Keys that only move the caret while a text field is focused
++bool IsCaretKey(const std::string& key) {
++  return key == "ArrowLeft" || key == "ArrowRight" || key == "Home" ||
++         key == "End";
++}
++
++// Entry of |web_contents|' latest snapshot for |ax_node_id| of the main
++// frame tree, or null
++const std::pair<const uint32_t, NodeInfo>* FindSnapshotNode(
++    content::WebContents* web_contents,
++    const ui::AXTreeID& tree_id,
++    int32_t ax_node_id) {
++  const TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(web_contents);
++  if (!mappings) {
++    return nullptr;
++  }
++  for (const auto& entry : mappings->nodes) {
++    if (entry.second.ax_node_id == ax_node_id &&
++        entry.second.ax_tree_id == tree_id) {
++      return &entry;
++    }
++  }
++  return nullptr;
++}
++
++// Smallest node of |web_contents|' latest snapshot in the viewport under
++// |point|, in CSS pixels, or null
++const std::pair<const uint32_t, NodeInfo>* FindSnapshotNodeAt(
++    content::WebContents* web_contents,
++    const gfx::PointF& point) {
++  const TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(web_contents);
++  if (!mappings) {
++    return nullptr;
++  }
++  const std::pair<const uint32_t, NodeInfo>* best = nullptr;
++  for (const auto& entry : mappings->nodes) {
++    const gfx::RectF& bounds = entry.second.bounds;
++    if (!entry.second.in_viewport || !bounds.InclusiveContains(point)) {
++      continue;
++    }
++    if (!best ||
++        bounds.size().GetArea() < best->second.bounds.size().GetArea()) {
++      best = &entry;
++    }
++  }
++  return best;
++}
++
++const ui::AXNodeData* FindUpdatedNode(const ui::AXTreeUpdate& update,
++                                      int32_t ax_node_id) {
++  for (const ui::AXNodeData& node : update.nodes) {
++    if (node.id == ax_node_id) {
++      return &node;
++    }
++  }
++  return nullptr;
++}
++
++}  // namespace
++
++// static
++void BrowserOSActionRecorder::Start(content::WebContents* web_contents) {
++  web_contents->RemoveUserData(UserDataKey());
++  CreateForWebContents(web_contents);
++}
++
++// static
++std::optional<browser_os::ActionLog> BrowserOSActionRecorder::Stop(
++    content::WebContents* web_contents) {
++  BrowserOSActionRecorder* recorder = FromWebContents(web_contents);
++  if (!recorder) {
++    return std::nullopt;
++  }
++
++  browser_os::ActionLog log;
++  log.tab_id = recorder->tab_id_;
++  log.start_time = recorder->start_time_.InMillisecondsFSinceUnixEpoch();
++  log.dropped_count = recorder->dropped_count_;
++  log.actions.assign(std::make_move_iterator(recorder->actions_.begin()),
++                     std::make_move_iterator(recorder->actions_.end()));
++  web_contents->RemoveUserData(UserDataKey());
++  return log;
++}
++
++BrowserOSActionRecorder::BrowserOSActionRecorder(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSActionRecorder>(*web_contents),
++      tab_id_(ExtensionTabUtil::GetTabId(web_contents)),
++      start_time_(base::Time::Now()),
++      start_ticks_(base::TimeTicks::Now()),
++      accessibility_mode_(web_contents->CreateScopedAccessibilityMode(
++          GetSnapshotAXMode(SnapshotProfile::kInteractive))) {
++  ObserveWidget(web_contents->GetPrimaryMainFrame()->GetRenderWidgetHost());
++  LOG(INFO) << "[browseros] Action recording started for tab " << tab_id_;
++}
++
++BrowserOSActionRecorder::~BrowserOSActionRecorder() {
++  ObserveWidget(nullptr);
++
++  const int recorded = static_cast<int>(actions_.size()) + dropped_count_;
++  LOG(INFO) << "[browseros] Action recording stopped after " << recorded
++            << " actions";
++  browseros_metrics::BrowserOSMetrics::Log(
++      "action_recorder.stopped",
++      {{"actions", base::Value(recorded)},
++       {"dropped", base::Value(dropped_count_)},
++       {"duration_s",
++        base::Value(static_cast<int>(
++            (base::TimeTicks::Now() - start_ticks_).InSeconds()))}});
++}
++
++void BrowserOSActionRecorder::Record(browser_os::RecordedAction action) {
++  action.time = (base::TimeTicks::Now() - start_ticks_).InMillisecondsF();
++  actions_.push_back(std::move(action));
++  if (actions_.size() > kMaxRecordedActions) {
++    actions_.pop_front();
++    dropped_count_++;
++  }
++}
++
++void BrowserOSActionRecorder::SetTarget(browser_os::RecordedAction& action,
++                                        int32_t ax_node_id,
++                                        const ui::AXNodeData* data) const {
++  if (const auto* entry = FindSnapshotNode(
++          web_contents(), web_contents()->GetPrimaryMainFrame()->GetAXTreeID(),
++          ax_node_id)) {
++    action.node_id = static_cast<int>(entry->first);
++    action.target = ToScriptTarget(entry->second);
++    return;
++  }
++  if (!data) {
++    return;
++  }
++  browser_os::ScriptTarget target;
++  target.role = ui::ToString(data->role);
++  if (data->HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    target.name = data->GetStringAttribute(ax::mojom::StringAttribute::kName);
++  }
++  action.target = std::move(target);
++}
++
++browser_os::RecordedAction* BrowserOSActionRecorder::LastActionOf(
++    browser_os::RecordedActionType type) {
++  if (actions_.empty() || actions_.back().type != type) {
++    return nullptr;
++  }
++  return &actions_.back();
++}
++
++void BrowserOSActionRecorder::ObserveWidget(content::RenderWidgetHost* widget) {
++  if (observed_widget_) {
++    observed_widget_->RemoveInputEventObserver(this);
++  }
++  observed_widget_ = widget;
++  if (observed_widget_) {
++    observed_widget_->AddInputEventObserver(this);
++  }
++}
++
++void BrowserOSActionRecorder::OnMouseDown(const blink::WebMouseEvent& event) {
++  if (event.button != blink::WebPointerProperties::Button::kLeft) {
++    return;
++  }
++
++  // Widget DIPs to the CSS pixels snapshot bounds are in
++  const gfx::PointF point = gfx::ScalePoint(
++      event.PositionInWidget(),
++      1.0f / CssToWidgetScale(web_contents(), observed_widget_));
++  browser_os::RecordedAction action;
++  action.type = browser_os::RecordedActionType::kClick;
++  action.x = point.x();
++  action.y = point.y();
++  if (const auto* entry = FindSnapshotNodeAt(web_contents(), point)) {
++    action.node_id = static_cast<int>(entry->first);
++    action.target = ToScriptTarget(entry->second);
++  }
++  Record(std::move(action));
++}
++
++void BrowserOSActionRecorder::OnKeyDown(const blink::WebKeyboardEvent& event) {
++  // Shortcuts have no sendKeys equivalent to replay them with
++  if (event.GetModifiers() &
++      (blink::WebInputEvent::kControlKey | blink::WebInputEvent::kAltKey |
++       blink::WebInputEvent::kMetaKey)) {
++    return;
++  }
++  const std::string key =
++      ui::KeycodeConverter::DomKeyToKeyString(ui::DomKey(event.dom_key));
++  if (!IsRecordedKey(key) || (focused_editable_ && IsCaretKey(key))) {
++    return;
++  }
++
++  browser_os::RecordedAction action;
++  action.type = browser_os::RecordedActionType::kSendKeys;
++  action.key = key;
++  Record(std::move(action));
++}
++
++void BrowserOSActionRecorder::OnWheel(const blink::WebMouseWheelEvent& event) {
++  const float scale = CssToWidgetScale(web_contents(), observed_widget_);
++  // Wheel deltas point the way the content moves, not the way it scrolls
++  const double delta_x = -event.delta_x / scale;
++  const double delta_y = -event.delta_y / scale;
++  if (delta_x == 0 && delta_y == 0) {
++    return;
++  }
++
++  const base::TimeTicks now = base::TimeTicks::Now();
++  browser_os::RecordedAction* last =
++      LastActionOf(browser_os::RecordedActionType::kScroll);
++  if (last && now - last_scroll_time_ < kScrollBurstGap) {
++    last->delta_x = last->delta_x.value_or(0) + delta_x;
++    last->delta_y = last->delta_y.value_or(0) + delta_y;
++  } else {
++    browser_os::RecordedAction action;
++    action.type = browser_os::RecordedActionType::kScroll;
++    action.delta_x = delta_x;
++    action.delta_y = delta_y;
++    Record(std::move(action));
++  }
++  last_scroll_time_ = now;
++}
++
++void BrowserOSActionRecorder::OnFocusChanged(int32_t ax_node_id,
++                                             const ui::AXNodeData* data) {
++  focused_node_id_ = ax_node_id;
++  focused_value_.reset();
++  const auto* entry = FindSnapshotNode(
++      web_contents(), web_contents()->GetPrimaryMainFrame()->GetAXTreeID(),
++      ax_node_id);
++  focused_editable_ =
++      data ? data->HasState(ax::mojom::State::kEditable)
++           : entry && entry->second.node_type ==
++                          browser_os::InteractiveNodeType::kTypeable;
++  if (data) {
++    focused_value_ =
++        data->GetStringAttribute(ax::mojom::StringAttribute::kValue);
++  }
++
++  // Focus going back to the document is a blur, not a step
++  if (data ? data->role == ax::mojom::Role::kRootWebArea : !entry) {
++    return;
++  }
++  browser_os::RecordedAction action;
++  action.type = browser_os::RecordedActionType::kFocus;
++  SetTarget(action, ax_node_id, data);
++  Record(std::move(action));
++}
++
++void BrowserOSActionRecorder::OnFocusedNodeUpdated(
++    const ui::AXNodeData& data) {
++  const std::string& value =
++      data.GetStringAttribute(ax::mojom::StringAttribute::kValue);
++  if (!focused_value_) {
++    // First time the node is seen; nothing to compare with yet
++    focused_value_ = value;
++    focused_editable_ = data.HasState(ax::mojom::State::kEditable);
++    return;
++  }
++  if (*focused_value_ == value) {
++    return;
++  }
++  focused_value_ = value;
++
++  const bool is_password = data.HasState(ax::mojom::State::kProtected);
++  browser_os::RecordedAction* last =
++      LastActionOf(browser_os::RecordedActionType::kInputText);
++  if (last && last_input_node_id_ == focused_node_id_) {
++    if (!is_password) {
++      last->text = value;
++    }
++    return;
++  }
++
++  browser_os::RecordedAction action;
++  action.type = browser_os::RecordedActionType::kInputText;
++  SetTarget(action, focused_node_id_, &data);
++  if (!is_password) {
++    action.text = value;
++  }
++  last_input_node_id_ = focused_node_id_;
++  Record(std::move(action));
++}
++
++void BrowserOSActionRecorder::OnInputEvent(
++    const content::RenderWidgetHost& widget,
++    const blink::WebInputEvent& event) {
++  switch (event.GetType()) {
++    case blink::WebInputEvent::Type::kMouseDown:
++      OnMouseDown(static_cast<const blink::WebMouseEvent&>(event));
++      break;
++    case blink::WebInputEvent::Type::kRawKeyDown:
++    case blink::WebInputEvent::Type::kKeyDown:
++      OnKeyDown(static_cast<const blink::WebKeyboardEvent&>(event));
++      break;
++    case blink::WebInputEvent::Type::kMouseWheel:
++      OnWheel(static_cast<const blink::WebMouseWheelEvent&>(event));
++      break;
++    default:
++      break;
++  }
++}
++
++void BrowserOSActionRecorder::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  // Iframes aren't followed; snapshots resolve main frame nodes only
++  if (details.ax_tree_id !=
++      web_contents()->GetPrimaryMainFrame()->GetAXTreeID()) {
++    return;
++  }
++
++  for (const ui::AXTreeUpdate& update : details.updates) {
++    if (update.has_tree_data &&
++        update.tree_data.focus_id != focused_node_id_) {
++      OnFocusChanged(update.tree_data.focus_id,
++                     FindUpdatedNode(update, update.tree_data.focus_id));
++    }
++    if (const ui::AXNodeData* focused =
++            FindUpdatedNode(update, focused_node_id_)) {
++      OnFocusedNodeUpdated(*focused);
++    }
++  }
++}
++
++void BrowserOSActionRecorder::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  if (!navigation_handle->IsInPrimaryMainFrame() ||
++      !navigation_handle->HasCommitted() ||
++      navigation_handle->IsErrorPage()) {
++    return;
++  }
++  if (!navigation_handle->IsSameDocument()) {
++    // The new document has a tree of its own
++    focused_node_id_ = 0;
++    focused_editable_ = false;
++    focused_value_.reset();
++  }
++
++  browser_os::RecordedAction action;
++  action.type = browser_os::RecordedActionType::kNavigate;
++  action.url = navigation_handle->GetURL().spec();
++  Record(std::move(action));
++}
++
++void BrowserOSActionRecorder::RenderFrameHostChanged(
++    content::RenderFrameHost* old_host,
++    content::RenderFrameHost* new_host) {
++  // A cross-process navigation swaps the widget input goes through
++  if (new_host && new_host->IsInPrimaryMainFrame()) {
++    ObserveWidget(new_host->GetRenderWidgetHost());
++  }
++}
++
++void BrowserOSActionRecorder::WebContentsDestroyed() {
++  ObserveWidget(nullptr);
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSActionRecorder);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,141 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_action_recorder.h b/chrome/browser/extensions/api/browser_os/browser_os_action_recorder.h
+new file mode 100644
+index 0000000000000..f142defa56178
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_action_recorder.h
+@@ -0,0 +1,135 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_RECORDER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_RECORDER_H_
++
++#include <cstdint>
++#include <deque>
++#include <memory>
++#include <optional>
++#include <string>
++
++#include "base/memory/raw_ptr.h"
++#include "base/time/time.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/render_widget_host.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace blink {
++class WebKeyboardEvent;
++class WebMouseEvent;
++class WebMouseWheelEvent;
++}  // namespace blink
++
++namespace content {
++class ScopedAccessibilityMode;
++}  // namespace content
++
++namespace ui {
++struct AXNodeData;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Records what the user does in a tab for teach mode, as a log of the steps
++// executeActions would need to replay it: clicks, focus changes, text
++// entered, special keys, scrolls and navigations. Replaces reconstructing
++// the steps from polled snapshots and screenshots.
++//
++// Input comes from the main frame widget's input event observer, element
++// state from the accessibility updates the renderer already sends. The
++// target of a step is given as the nodeId it has in the tab's latest
++// snapshot, so it resolves through the node mapping store, and described as an
++// action script target; nodes the snapshot doesn't hold are described by
++// role and name only.
++//
++// Typing into a field is coalesced into one inputText step carrying the
++// field's final value, wheel scrolling into one scroll step per burst.
++// Values of password fields are never recorded. Input browserOS dispatches
++// itself is recorded too.
++class BrowserOSActionRecorder
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSActionRecorder>,
++      public content::RenderWidgetHost::InputEventObserver {
++ public:
++  BrowserOSActionRecorder(const BrowserOSActionRecorder&) = delete;
++  BrowserOSActionRecorder& operator=(const BrowserOSActionRecorder&) = delete;
++  ~BrowserOSActionRecorder() override;
++
++  // Starts or restarts recording |web_contents|
++  static void Start(content::WebContents* web_contents);
++
++  // Stops recording |web_contents| and returns what was recorded, or
++  // std::nullopt if it wasn't being recorded
++  static std::optional<browser_os::ActionLog> Stop(
++      content::WebContents* web_contents);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSActionRecorder>;
++
++  explicit BrowserOSActionRecorder(content::WebContents* web_contents);
++
++  // Appends |action|, stamped with the time since recording started
++  void Record(browser_os::RecordedAction action);
++
++  // Fills in the target of |action|: its nodeId in the latest snapshot, and
++  // its description from there or from |data|
++  void SetTarget(browser_os::RecordedAction& action,
++                 int32_t ax_node_id,
++                 const ui::AXNodeData* data) const;
++
++  // The latest recorded action if it is of |type|, for coalescing
++  browser_os::RecordedAction* LastActionOf(
++      browser_os::RecordedActionType type);
++
++  void ObserveWidget(content::RenderWidgetHost* widget);
++
++  void OnMouseDown(const blink::WebMouseEvent& event);
++  void OnKeyDown(const blink::WebKeyboardEvent& event);
++  void OnWheel(const blink::WebMouseWheelEvent& event);
++  void OnFocusChanged(int32_t ax_node_id, const ui::AXNodeData* data);
++  void OnFocusedNodeUpdated(const ui::AXNodeData& data);
++
++  // content::RenderWidgetHost::InputEventObserver:
++  void OnInputEvent(const content::RenderWidgetHost& widget,
++                    const blink::WebInputEvent& event) override;
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void RenderFrameHostChanged(content::RenderFrameHost* old_host,
++                              content::RenderFrameHost* new_host) override;
++  void WebContentsDestroyed() override;
++
++  const int tab_id_;
++  const base::Time start_time_;
++  const base::TimeTicks start_ticks_;
++  std::unique_ptr<content::ScopedAccessibilityMode> accessibility_mode_;
++  raw_ptr<content::RenderWidgetHost> observed_widget_ = nullptr;
++
++  std::deque<browser_os::RecordedAction> actions_;
++  int dropped_count_ = 0;
++  // When the latest scroll step was last extended
++  base::TimeTicks last_scroll_time_;
++
++  // Focused node of the main frame's tree. Its value is unset until an
++  // update has carried the node.
++  int32_t focused_node_id_ = 0;
++  bool focused_editable_ = false;
++  std::optional<std::string> focused_value_;
++  // Node the latest inputText step was coalesced for
++  int32_t last_input_node_id_ = 0;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_RECORDER_H_
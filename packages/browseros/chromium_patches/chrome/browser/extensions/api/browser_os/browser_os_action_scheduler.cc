@@ -0,0 +1,178 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_action_scheduler.cc b/chrome/browser/extensions/api/browser_os/browser_os_action_scheduler.cc
+new file mode 100644
+index 0000000000000..4799a7664d92a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_action_scheduler.cc
+@@ -0,0 +1,172 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_scheduler.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// A queued background action waiting this long runs ahead of interactive
++// ones
++constexpr base::TimeDelta kMaxBackgroundWait = base::Seconds(5);
++
++}  // namespace
++
++BrowserOSActionScheduler::PendingAction::PendingAction(Task task,
++                                                       RequestLane lane,
++                                                       size_t depth_at_enqueue)
++    : task(std::move(task)),
++      lane(lane),
++      enqueue_time(base::TimeTicks::Now()),
++      depth_at_enqueue(depth_at_enqueue) {}
++BrowserOSActionScheduler::PendingAction::PendingAction(PendingAction&&) =
++    default;
++BrowserOSActionScheduler::PendingAction&
++BrowserOSActionScheduler::PendingAction::operator=(PendingAction&&) = default;
++BrowserOSActionScheduler::PendingAction::~PendingAction() = default;
++
++BrowserOSActionScheduler::TabQueue::TabQueue() = default;
++BrowserOSActionScheduler::TabQueue::TabQueue(TabQueue&&) = default;
++BrowserOSActionScheduler::TabQueue&
++BrowserOSActionScheduler::TabQueue::operator=(TabQueue&&) = default;
++BrowserOSActionScheduler::TabQueue::~TabQueue() = default;
++
++BrowserOSActionScheduler::PendingAction
++BrowserOSActionScheduler::TabQueue::PopNext() {
++  const bool background_overdue =
++      !background.empty() &&
++      base::TimeTicks::Now() - background.front().enqueue_time >=
++          kMaxBackgroundWait;
++  base::circular_deque<PendingAction>& lane =
++      interactive.empty() || background_overdue ? background : interactive;
++  PendingAction next = std::move(lane.front());
++  lane.pop_front();
++  return next;
++}
++
++// static
++BrowserOSActionScheduler* BrowserOSActionScheduler::GetInstance() {
++  static base::NoDestructor<BrowserOSActionScheduler> instance;
++  return instance.get();
++}
++
++BrowserOSActionScheduler::BrowserOSActionScheduler()
++    // Unretained: the scheduler is never destroyed
++    : profiler_registration_(browseros::AddStepProfilerSource(
++          "action_scheduler",
++          base::BindRepeating(&BrowserOSActionScheduler::ReportStepProfile,
++                              base::Unretained(this)))) {}
++BrowserOSActionScheduler::~BrowserOSActionScheduler() = default;
++
++void BrowserOSActionScheduler::Enqueue(int tab_id,
++                                       Task task,
++                                       RequestLane lane) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++
++  auto it = queues_.find(tab_id);
++  if (it == queues_.end()) {
++    queues_.emplace(tab_id, TabQueue());
++    Start(tab_id, PendingAction(std::move(task), lane, 0));
++    return;
++  }
++
++  TabQueue& queue = it->second;
++  const size_t depth = queue.size() + 1;
++  VLOG(1) << "[browseros] Queued "
++          << (lane == RequestLane::kBackground ? "background" : "interactive")
++          << " action for tab " << tab_id << " behind " << depth << " others";
++  (lane == RequestLane::kBackground ? queue.background : queue.interactive)
++      .emplace_back(std::move(task), lane, depth);
++}
++
++size_t BrowserOSActionScheduler::GetQueueDepth(int tab_id) const {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  auto it = queues_.find(tab_id);
++  return it == queues_.end() ? 0 : it->second.size() + 1;
++}
++
++void BrowserOSActionScheduler::Start(int tab_id, PendingAction action) {
++  const base::TimeTicks now = base::TimeTicks::Now();
++  const base::TimeDelta wait = now - action.enqueue_time;
++  if (action.depth_at_enqueue > 0) {
++    VLOG(1) << "[browseros] Starting action for tab " << tab_id << " after "
++            << wait.InMilliseconds() << "ms in queue";
++  }
++
++  // Every action records these, so they are aggregated rather than logged
++  browseros_metrics::BrowserOSMetrics::RecordLatency(
++      action.lane == RequestLane::kBackground ? "action.queue.wait.background"
++                                              : "action.queue.wait",
++      wait);
++  if (action.depth_at_enqueue > 0) {
++    browseros_metrics::BrowserOSMetrics::Count("action.queue.waited");
++  }
++
++  // Unretained is safe: the scheduler is never destroyed
++  std::move(action.task)
++      .Run(base::BindOnce(&BrowserOSActionScheduler::OnActionDone,
++                          base::Unretained(this), tab_id, now));
++}
++
++void BrowserOSActionScheduler::OnActionDone(int tab_id,
++                                            base::TimeTicks start_time) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++
++  auto it = queues_.find(tab_id);
++  if (it == queues_.end()) {
++    return;
++  }
++
++  VLOG(2) << "[browseros] Action for tab " << tab_id << " released after "
++          << (base::TimeTicks::Now() - start_time).InMilliseconds() << "ms";
++
++  if (it->second.empty()) {
++    queues_.erase(it);
++    return;
++  }
++
++  PendingAction next = it->second.PopNext();
++  // Post so the next action does not start inside the previous one's
++  // response
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(&BrowserOSActionScheduler::Start,
++                                base::Unretained(this), tab_id,
++                                std::move(next)));
++}
++
++void BrowserOSActionScheduler::ReportStepProfile(
++    base::OnceCallback<void(base::Value::Dict)> done) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  base::Value::Dict depths;
++  size_t interactive = 0;
++  size_t background = 0;
++  for (const auto& [tab_id, queue] : queues_) {
++    // The running action counts too, like GetQueueDepth()
++    depths.Set(base::NumberToString(tab_id),
++               static_cast<int>(queue.size() + 1));
++    interactive += queue.interactive.size();
++    background += queue.background.size();
++  }
++  std::move(done).Run(
++      base::Value::Dict()
++          .Set("activeTabs", static_cast<int>(queues_.size()))
++          .Set("queuedInteractive", static_cast<int>(interactive))
++          .Set("queuedBackground", static_cast<int>(background))
++          .Set("depthByTab", std::move(depths)));
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,118 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_action_scheduler.h b/chrome/browser/extensions/api/browser_os/browser_os_action_scheduler.h
+new file mode 100644
+index 0000000000000..36719bd72e1fa
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_action_scheduler.h
+@@ -0,0 +1,112 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_SCHEDULER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_SCHEDULER_H_
++
++#include <cstddef>
++#include <unordered_map>
++
++#include "base/containers/circular_deque.h"
++#include "base/functional/callback.h"
++#include "base/functional/callback_helpers.h"
++#include "base/no_destructor.h"
++#include "base/sequence_checker.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_request_priority.h"
++
++namespace extensions {
++namespace api {
++
++// Serializes browserOS interactions per tab. Each tab runs one action at a
++// time, so a click issued while an earlier click on the same tab is still
++// settling waits for it instead of interleaving. Tabs are independent: since
++// actions wait asynchronously, actions on different tabs overlap their waits
++// and a busy tab never holds up another one.
++// Each tab has a FIFO queue per RequestLane. Queued interactive actions run
++// before background ones, unless a background action has waited longer
++// than kMaxBackgroundWait, so a crawl sharing the tab cannot starve.
++// Lives on the UI thread.
++class BrowserOSActionScheduler {
++ public:
++  // Receives the closure that releases the tab's slot. It must be run once
++  // the action has fully completed; running it early lets the next queued
++  // action start.
++  using Task = base::OnceCallback<void(base::OnceClosure done)>;
++
++  static BrowserOSActionScheduler* GetInstance();
++
++  BrowserOSActionScheduler(const BrowserOSActionScheduler&) = delete;
++  BrowserOSActionScheduler& operator=(const BrowserOSActionScheduler&) =
++      delete;
++
++  // Runs |task| once the tab's running action has released its slot and the
++  // actions queued ahead of it in |lane| have run. Runs it synchronously if
++  // the tab is idle.
++  void Enqueue(int tab_id,
++               Task task,
++               RequestLane lane = RequestLane::kInteractive);
++
++  // Number of actions for |tab_id| that are running or waiting to run
++  size_t GetQueueDepth(int tab_id) const;
++
++  // Number of tabs with an action currently running
++  size_t active_tab_count() const { return queues_.size(); }
++
++ private:
++  friend class base::NoDestructor<BrowserOSActionScheduler>;
++
++  struct PendingAction {
++    PendingAction(Task task, RequestLane lane, size_t depth_at_enqueue);
++    PendingAction(PendingAction&&);
++    PendingAction& operator=(PendingAction&&);
++    ~PendingAction();
++
++    Task task;
++    RequestLane lane;
++    base::TimeTicks enqueue_time;
++    size_t depth_at_enqueue;
++  };
++
++  // Only tabs with a running action have an entry; the deques hold the
++  // actions queued behind it
++  struct TabQueue {
++    TabQueue();
++    TabQueue(TabQueue&&);
++    TabQueue& operator=(TabQueue&&);
++    ~TabQueue();
++
++    size_t size() const { return interactive.size() + background.size(); }
++    bool empty() const { return interactive.empty() && background.empty(); }
++
++    // Removes and returns the action to run next
++    PendingAction PopNext();
++
++    base::circular_deque<PendingAction> interactive;
++    base::circular_deque<PendingAction> background;
++  };
++
++  BrowserOSActionScheduler();
++  ~BrowserOSActionScheduler();
++
++  // Runs |action| for |tab_id|, whose slot must already be taken
++  void Start(int tab_id, PendingAction action);
++
++  // Releases |tab_id|'s slot and starts the next queued action, if any
++  void OnActionDone(int tab_id, base::TimeTicks start_time);
++
++  // Queue depths per tab, for chrome://browseros-internals
++  void ReportStepProfile(base::OnceCallback<void(base::Value::Dict)> done);
++
++  std::unordered_map<int, TabQueue> queues_;
++  base::ScopedClosureRunner profiler_registration_;
++
++  SEQUENCE_CHECKER(sequence_checker_);
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_SCHEDULER_H_
@@ -0,0 +1,311 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_action_script.cc b/chrome/browser/extensions/api/browser_os/browser_os_action_script.cc
+new file mode 100644
+index 0000000000000..b97bee6bf0f3a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_action_script.cc
+@@ -0,0 +1,305 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_script.h"
++
++#include <cmath>
++#include <string_view>
++#include <utility>
++
++#include "base/containers/flat_set.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_util.h"
++#include "base/strings/stringprintf.h"
++#include "chrome/browser/browseros/core/browseros_prefs.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_query.h"
++#include "components/prefs/pref_service.h"
++#include "components/prefs/scoped_user_pref_update.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "url/gurl.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Relative weight of each part of a target in ScoreScriptTarget()
++constexpr double kNameWeight = 2;
++constexpr double kRoleWeight = 1;
++constexpr double kAttributeWeight = 1;
++
++// Scores closer than this are equally good
++constexpr double kScoreEpsilon = 1e-6;
++
++// Attributes that tell similar nodes apart and tend to survive a reload
++constexpr NodeAttribute kTargetAttributes[] = {
++    NodeAttribute::kId,           NodeAttribute::kPlaceholder,
++    NodeAttribute::kInputType,    NodeAttribute::kHtmlTag,
++    NodeAttribute::kAutocomplete,
++};
++
++constexpr size_t kMaxScriptNameLength = 200;
++
++constexpr char kVariableStart[] = "{{";
++constexpr char kVariableEnd[] = "}}";
++
++// Dice coefficient of the two names' word sets
++double NameSimilarity(const std::string& a, const std::string& b) {
++  const base::flat_set<std::string> a_tokens(TokenizeName(a));
++  const base::flat_set<std::string> b_tokens(TokenizeName(b));
++  if (a_tokens.empty() || b_tokens.empty()) {
++    return a_tokens.empty() && b_tokens.empty() ? 1 : 0;
++  }
++  size_t common = 0;
++  for (const std::string& token : a_tokens) {
++    common += b_tokens.contains(token);
++  }
++  return 2.0 * common / (a_tokens.size() + b_tokens.size());
++}
++
++// The node's value for the attribute keyed |key| in
++// InteractiveNode.attributes, or null
++const std::string* FindAttribute(const NodeAttributes& attributes,
++                                 const std::string& key) {
++  for (const auto& [attribute, value] : attributes.string_attributes) {
++    if (key == NodeAttributeName(attribute)) {
++      return &value;
++    }
++  }
++  return nullptr;
++}
++
++double DistanceToTarget(const browser_os::Rect& target,
++                        const NodeInfo& node_info) {
++  const gfx::PointF center = node_info.bounds.CenterPoint();
++  return std::hypot(center.x() - (target.x + target.width / 2),
++                    center.y() - (target.y + target.height / 2));
++}
++
++bool NeedsTarget(browser_os::ScriptStepType type) {
++  switch (type) {
++    case browser_os::ScriptStepType::kClick:
++    case browser_os::ScriptStepType::kInputText:
++    case browser_os::ScriptStepType::kClear:
++    case browser_os::ScriptStepType::kWaitForNode:
++      return true;
++    default:
++      return false;
++  }
++}
++
++std::optional<std::string> ValidateStep(const browser_os::ScriptStep& step) {
++  const std::string type = browser_os::ToString(step.type);
++  if (step.type == browser_os::ScriptStepType::kNone) {
++    return std::string("unknown step type");
++  }
++  if (NeedsTarget(step.type) && !step.target) {
++    return type + " needs a target";
++  }
++  if (step.type == browser_os::ScriptStepType::kInputText && !step.text) {
++    return type + " needs text";
++  }
++  if (step.type == browser_os::ScriptStepType::kSendKeys && !step.key) {
++    return type + " needs a key";
++  }
++  if (step.type == browser_os::ScriptStepType::kNavigate &&
++      (!step.url || !GURL(*step.url).is_valid())) {
++    return type + " needs a valid url";
++  }
++  return std::nullopt;
++}
++
++}  // namespace
++
++browser_os::ScriptTarget ToScriptTarget(const NodeInfo& node_info) {
++  browser_os::ScriptTarget target;
++  target.type = node_info.node_type;
++  target.role = ui::ToString(node_info.attributes.role);
++  if (!node_info.name.empty()) {
++    target.name = node_info.name;
++  }
++
++  base::Value::Dict attributes;
++  for (NodeAttribute attribute : kTargetAttributes) {
++    if (node_info.attributes.Has(attribute)) {
++      attributes.Set(NodeAttributeName(attribute),
++                     node_info.attributes.Get(attribute));
++    }
++  }
++  if (!attributes.empty()) {
++    browser_os::ScriptTarget::Attributes target_attributes;
++    target_attributes.additional_properties = std::move(attributes);
++    target.attributes = std::move(target_attributes);
++  }
++
++  browser_os::Rect bounds;
++  bounds.x = node_info.bounds.x();
++  bounds.y = node_info.bounds.y();
++  bounds.width = node_info.bounds.width();
++  bounds.height = node_info.bounds.height();
++  target.bounds = std::move(bounds);
++  return target;
++}
++
++double ScoreScriptTarget(const browser_os::ScriptTarget& target,
++                         const NodeInfo& node_info) {
++  if (target.type != browser_os::InteractiveNodeType::kNone &&
++      target.type != node_info.node_type) {
++    return 0;
++  }
++
++  double weight = 0;
++  double score = 0;
++  if (target.role) {
++    weight += kRoleWeight;
++    if (ui::ToString(node_info.attributes.role) == *target.role) {
++      score += kRoleWeight;
++    }
++  }
++  if (target.name) {
++    weight += kNameWeight;
++    score += kNameWeight * NameSimilarity(*target.name, node_info.name);
++  }
++  if (target.attributes) {
++    for (const auto [key, value] : target.attributes->additional_properties) {
++      if (!value.is_string()) {
++        continue;
++      }
++      weight += kAttributeWeight;
++      const std::string* actual = FindAttribute(node_info.attributes, key);
++      if (actual && *actual == value.GetString()) {
++        score += kAttributeWeight;
++      }
++    }
++  }
++  return weight > 0 ? score / weight : 0;
++}
++
++std::optional<ScriptTargetMatch> MatchScriptTarget(
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings,
++    const browser_os::ScriptTarget& target) {
++  std::optional<ScriptTargetMatch> best;
++  const NodeInfo* best_info = nullptr;
++  for (const auto& [node_id, node_info] : node_mappings) {
++    const double score = ScoreScriptTarget(target, node_info);
++    if (score < kMinScriptTargetScore) {
++      continue;
++    }
++
++    bool better = !best || score > best->score + kScoreEpsilon;
++    if (best && !better && score > best->score - kScoreEpsilon) {
++      if (target.bounds) {
++        const double distance = DistanceToTarget(*target.bounds, node_info);
++        const double best_distance =
++            DistanceToTarget(*target.bounds, *best_info);
++        better = distance < best_distance ||
++                 (distance == best_distance && node_id < best->node_id);
++      } else {
++        better = node_id < best->node_id;
++      }
++    }
++    if (better) {
++      best = ScriptTargetMatch{node_id, score};
++      best_info = &node_info;
++    }
++  }
++  return best;
++}
++
++base::expected<std::string, std::string> ExpandScriptVariables(
++    const std::string& text,
++    const base::Value::Dict& variables) {
++  std::string expanded;
++  size_t position = 0;
++  while (true) {
++    const size_t start = text.find(kVariableStart, position);
++    const size_t end = start == std::string::npos
++                           ? std::string::npos
++                           : text.find(kVariableEnd, start);
++    if (end == std::string::npos) {
++      expanded.append(text, position);
++      return expanded;
++    }
++
++    expanded.append(text, position, start - position);
++    const std::string name(base::TrimWhitespaceASCII(
++        std::string_view(text).substr(start + 2, end - start - 2),
++        base::TRIM_ALL));
++    const std::string* value = variables.FindString(name);
++    if (!value) {
++      return base::unexpected("No value for variable " + name);
++    }
++    expanded.append(*value);
++    position = end + 2;
++  }
++}
++
++std::optional<std::string> SaveActionScript(
++    PrefService* prefs,
++    const browser_os::ActionScript& script) {
++  if (script.name.empty() || script.name.size() > kMaxScriptNameLength) {
++    return "Script name must have 1 to " +
++           base::NumberToString(kMaxScriptNameLength) + " characters";
++  }
++  if (script.steps.empty()) {
++    return std::string("Script has no steps");
++  }
++  if (script.steps.size() > kMaxActionScriptSteps) {
++    return "Too many steps; the maximum is " +
++           base::NumberToString(kMaxActionScriptSteps);
++  }
++  for (size_t i = 0; i < script.steps.size(); ++i) {
++    if (std::optional<std::string> error = ValidateStep(script.steps[i])) {
++      return base::StringPrintf("Step %zu: %s", i, error->c_str());
++    }
++  }
++
++  const base::Value::Dict& scripts =
++      prefs->GetDict(browseros::prefs::kActionScripts);
++  if (!scripts.contains(script.name) && scripts.size() >= kMaxActionScripts) {
++    return "Too many saved scripts; the maximum is " +
++           base::NumberToString(kMaxActionScripts);
++  }
++
++  ScopedDictPrefUpdate update(prefs, browseros::prefs::kActionScripts);
++  update->Set(script.name, script.ToValue());
++  return std::nullopt;
++}
++
++std::optional<browser_os::ActionScript> LoadActionScript(
++    PrefService* prefs,
++    const std::string& name) {
++  const base::Value::Dict* script =
++      prefs->GetDict(browseros::prefs::kActionScripts).FindDict(name);
++  if (!script) {
++    return std::nullopt;
++  }
++  return browser_os::ActionScript::FromValue(*script);
++}
++
++std::vector<browser_os::ActionScript> LoadActionScripts(PrefService* prefs) {
++  std::vector<browser_os::ActionScript> scripts;
++  // Dict keys iterate in sorted order
++  for (const auto [name, value] :
++       prefs->GetDict(browseros::prefs::kActionScripts)) {
++    if (!value.is_dict()) {
++      continue;
++    }
++    if (std::optional<browser_os::ActionScript> script =
++            browser_os::ActionScript::FromValue(value.GetDict())) {
++      scripts.push_back(std::move(*script));
++    }
++  }
++  return scripts;
++}
++
++void DeleteActionScript(PrefService* prefs, const std::string& name) {
++  ScopedDictPrefUpdate update(prefs, browseros::prefs::kActionScripts);
++  update->Remove(name);
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,88 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_action_script.h b/chrome/browser/extensions/api/browser_os/browser_os_action_script.h
+new file mode 100644
+index 0000000000000..538dfb21047ad
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_action_script.h
+@@ -0,0 +1,82 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_SCRIPT_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_SCRIPT_H_
++
++#include <cstdint>
++#include <optional>
++#include <string>
++#include <unordered_map>
++#include <vector>
++
++#include "base/types/expected.h"
++#include "base/values.h"
++#include "chrome/common/extensions/api/browser_os.h"
++
++class PrefService;
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++
++// Teach-mode action scripts: steps that describe their target node instead
++// of naming a nodeId, so they can be replayed on later visits to a page.
++// Scripts are kept in the profile under browseros::prefs::kActionScripts.
++
++inline constexpr size_t kMaxActionScripts = 100;
++inline constexpr size_t kMaxActionScriptSteps = 500;
++
++// Lowest ScoreScriptTarget() a node needs to be taken as a step's target
++inline constexpr double kMinScriptTargetScore = 0.6;
++
++// Describes |node_info| as a script target
++browser_os::ScriptTarget ToScriptTarget(const NodeInfo& node_info);
++
++// How well |node_info| matches |target|, from 0 to 1. A node of another
++// type scores 0. Otherwise role, name and each attribute that |target|
++// sets count towards the score: the name by the share of words the two
++// names have in common, the others only when equal. Bounds don't count.
++double ScoreScriptTarget(const browser_os::ScriptTarget& target,
++                         const NodeInfo& node_info);
++
++struct ScriptTargetMatch {
++  uint32_t node_id = 0;
++  double score = 0;
++};
++
++// Best match for |target| among |node_mappings| scoring at least
++// kMinScriptTargetScore, or std::nullopt. Equal scores go to the node
++// closest to |target|'s bounds, then to the lowest nodeId.
++std::optional<ScriptTargetMatch> MatchScriptTarget(
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings,
++    const browser_os::ScriptTarget& target);
++
++// |text| with every {{name}} replaced by the string variable |name|. Fails
++// on placeholders without a variable.
++base::expected<std::string, std::string> ExpandScriptVariables(
++    const std::string& text,
++    const base::Value::Dict& variables);
++
++// Checks |script| and saves it, replacing a script of the same name.
++// Returns an error if it is malformed or the limits would be exceeded.
++std::optional<std::string> SaveActionScript(
++    PrefService* prefs,
++    const browser_os::ActionScript& script);
++
++// The saved script called |name|, or std::nullopt
++std::optional<browser_os::ActionScript> LoadActionScript(
++    PrefService* prefs,
++    const std::string& name);
++
++// Every saved script, in name order
++std::vector<browser_os::ActionScript> LoadActionScripts(PrefService* prefs);
++
++void DeleteActionScript(PrefService* prefs, const std::string& name);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_SCRIPT_H_
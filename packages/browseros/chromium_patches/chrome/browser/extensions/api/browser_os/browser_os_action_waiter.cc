@@ -0,0 +1,114 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_action_waiter.cc b/chrome/browser/extensions/api/browser_os/browser_os_action_waiter.cc
+new file mode 100644
+index 0000000000000..0824a3b2322af
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_action_waiter.cc
+@@ -0,0 +1,108 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_waiter.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/sequenced_task_runner.h"
++#include "content/public/browser/focused_node_details.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Quiet period after the last scroll update before a scroll counts as done.
++// Smooth scrolling emits location changes every frame until it stops.
++constexpr base::TimeDelta kScrollSettleDelay = base::Milliseconds(50);
++
++}  // namespace
++
++// static
++void BrowserOSActionWaiter::Wait(content::WebContents* web_contents,
++                                 Condition condition,
++                                 base::TimeDelta timeout,
++                                 DoneCallback callback) {
++  // Owned by itself; deleted in Finish()
++  auto* waiter =
++      new BrowserOSActionWaiter(web_contents, condition, std::move(callback));
++  waiter->timeout_timer_.Start(
++      FROM_HERE, timeout,
++      base::BindOnce(&BrowserOSActionWaiter::Finish, base::Unretained(waiter),
++                     false));
++}
++
++BrowserOSActionWaiter::BrowserOSActionWaiter(
++    content::WebContents* web_contents,
++    Condition condition,
++    DoneCallback callback)
++    : content::WebContentsObserver(web_contents),
++      condition_(condition),
++      callback_(std::move(callback)) {}
++
++BrowserOSActionWaiter::~BrowserOSActionWaiter() = default;
++
++void BrowserOSActionWaiter::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  for (const auto& event : details.events) {
++    if (condition_ == Condition::kScrollSettled &&
++        (event.event_type == ax::mojom::Event::kScrollPositionChanged ||
++         event.event_type == ax::mojom::Event::kScrolledToAnchor ||
++         event.event_type == ax::mojom::Event::kLayoutComplete)) {
++      OnScrollActivity();
++      return;
++    }
++    if (condition_ == Condition::kFocusChanged &&
++        event.event_type == ax::mojom::Event::kFocus) {
++      VLOG(2) << "[browseros] Focus event received";
++      Finish(true);
++      return;
++    }
++  }
++}
++
++void BrowserOSActionWaiter::AccessibilityLocationChangesReceived(
++    const ui::AXTreeID& tree_id,
++    ui::AXLocationAndScrollUpdates& details) {
++  if (condition_ == Condition::kScrollSettled) {
++    OnScrollActivity();
++  }
++}
++
++void BrowserOSActionWaiter::OnFocusChangedInPage(
++    const content::FocusedNodeDetails& details) {
++  if (condition_ == Condition::kFocusChanged) {
++    VLOG(2) << "[browseros] Focus changed in page";
++    Finish(true);
++  }
++}
++
++void BrowserOSActionWaiter::WebContentsDestroyed() {
++  Finish(false);
++}
++
++void BrowserOSActionWaiter::OnScrollActivity() {
++  settle_timer_.Start(FROM_HERE, kScrollSettleDelay,
++                      base::BindOnce(&BrowserOSActionWaiter::Finish,
++                                     base::Unretained(this), true));
++}
++
++void BrowserOSActionWaiter::Finish(bool observed) {
++  VLOG(1) << "[browseros] Action wait finished: "
++          << (observed ? "observed" : "timed out");
++  // Post so callers never re-enter from inside an observer notification,
++  // and so a destroyed tab's WeakPtr is already invalid when they run
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(std::move(callback_), observed));
++  delete this;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,90 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_action_waiter.h b/chrome/browser/extensions/api/browser_os/browser_os_action_waiter.h
+new file mode 100644
+index 0000000000000..2bf51b0e6192a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_action_waiter.h
+@@ -0,0 +1,84 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_WAITER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_WAITER_H_
++
++#include "base/functional/callback.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "content/public/browser/web_contents_observer.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace ui {
++struct AXUpdatesAndEvents;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Waits for the page to react to an action that has no completion callback
++// of its own (scrolling a node into view, moving focus) without blocking the
++// UI thread. Completes on the matching signal or when the timeout expires,
++// whichever comes first, and deletes itself when done.
++class BrowserOSActionWaiter : public content::WebContentsObserver {
++ public:
++  enum class Condition {
++    // Location changes or scroll events arrived and then stopped for
++    // kScrollSettleDelay
++    kScrollSettled,
++    // Focus moved to a node in the page
++    kFocusChanged,
++  };
++
++  // |observed| is false if the timeout expired first or the tab went away.
++  using DoneCallback = base::OnceCallback<void(bool observed)>;
++
++  // Starts waiting for |condition| on |web_contents|. Start waiting right
++  // after dispatching the action; |callback| is always posted, never run
++  // synchronously.
++  static void Wait(content::WebContents* web_contents,
++                   Condition condition,
++                   base::TimeDelta timeout,
++                   DoneCallback callback);
++
++  BrowserOSActionWaiter(const BrowserOSActionWaiter&) = delete;
++  BrowserOSActionWaiter& operator=(const BrowserOSActionWaiter&) = delete;
++
++ private:
++  BrowserOSActionWaiter(content::WebContents* web_contents,
++                        Condition condition,
++                        DoneCallback callback);
++  ~BrowserOSActionWaiter() override;
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void AccessibilityLocationChangesReceived(
++      const ui::AXTreeID& tree_id,
++      ui::AXLocationAndScrollUpdates& details) override;
++  void OnFocusChangedInPage(
++      const content::FocusedNodeDetails& details) override;
++  void WebContentsDestroyed() override;
++
++  // Restarts the settle timer after scroll activity
++  void OnScrollActivity();
++
++  // Posts the callback and deletes this
++  void Finish(bool observed);
++
++  const Condition condition_;
++  DoneCallback callback_;
++
++  base::OneShotTimer timeout_timer_;
++  base::OneShotTimer settle_timer_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_ACTION_WAITER_H_
@@ -1,17 +1,20 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.cc b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
 new file mode 100644
-index 0000000000000..c08b705ef6869
+index 0000000000000..cfea43d12a44a
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
-@@ -0,0 +1,1437 @@
+@@ -0,0 +1,5132 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api.h"
 +
++#include <algorithm>
++#include <cinttypes>
 +#include <set>
 +#include <string>
++#include <string_view>
 +
 +#include "base/files/file_util.h"
 +#include "chrome/browser/platform_util.h"
@@ -28,24 +31,69 @@ index 0000000000000..c08b705ef6869
 +#include "components/prefs/pref_service.h"
 +#include "base/json/json_writer.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "base/strings/str_cat.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/strings/stringprintf.h"
 +#include "base/base64.h"
++#include "base/containers/flat_set.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
 +#include "base/time/time.h"
++#include "base/trace_event/trace_event.h"
 +#include "base/values.h"
 +#include "base/version_info/version_info.h"
++#include "chrome/browser/browseros/core/browseros_agent_activity.h"
++#include "chrome/browser/browseros/core/browseros_ax_snapshot_cache.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_accessibility_stream.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_recorder.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_script.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_scheduler.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_action_waiter.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_metrics.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_audio_capture.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_background_rendering.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_call_limiter.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_history.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_downloads.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_input_files.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_query.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_state.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_state.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_prefs.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_screencast.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_prefetcher.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_tab_budget.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_tab_pool.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_task_tabs.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_wire_format.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
++#include "chrome/browser/extensions/tab_helper.h"
 +#include "chrome/browser/extensions/window_controller.h"
 +#include "chrome/browser/ui/browser.h"
 +#include "chrome/browser/ui/browser_finder.h"
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
 +#include "chrome/common/extensions/api/browser_os.h"
++#include "chrome/common/pref_names.h"
++#include "extensions/browser/event_router.h"
++#include "extensions/browser/extension_api_frame_id_map.h"
++#include "extensions/common/mojom/code_injection.mojom.h"
++#include "extensions/common/mojom/execution_world.mojom-shared.h"
++#include "extensions/common/mojom/host_id.mojom.h"
++#include "extensions/common/mojom/match_origin_as_fallback.mojom-shared.h"
++#include "extensions/common/mojom/run_location.mojom-shared.h"
++#include "third_party/blink/public/mojom/script/script_evaluation_params.mojom-shared.h"
 +#include "content/browser/renderer_host/render_widget_host_impl.h"
++#include "content/public/browser/navigation_controller.h"
 +#include "content/public/browser/render_frame_host.h"
 +#include "content/public/browser/render_widget_host.h"
 +#include "content/public/browser/render_widget_host_view.h"
@@ -60,138 +108,165 @@ index 0000000000000..c08b705ef6869
 +#include "ui/accessibility/ax_role_properties.h"
 +#include "ui/accessibility/ax_tree_update.h"
 +#include "ui/base/ime/ime_text_span.h"
++#include "ui/base/page_transition_types.h"
 +#include "ui/events/base_event_utils.h"
 +#include "ui/events/keycodes/dom/dom_code.h"
 +#include "ui/events/keycodes/dom/dom_key.h"
 +#include "ui/events/keycodes/keyboard_codes.h"
 +#include "ui/gfx/geometry/point_f.h"
 +#include "ui/gfx/geometry/rect.h"
++#include "ui/gfx/geometry/rect_conversions.h"
 +#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/size_f.h"
 +#include "ui/gfx/range/range.h"
++#include "ui/gfx/codec/jpeg_codec.h"
 +#include "ui/gfx/codec/png_codec.h"
++#include "ui/gfx/codec/webp_codec.h"
 +#include "ui/gfx/image/image.h"
 +#include "ui/snapshot/snapshot.h"
++#include "url/gurl.h"
++#include "url/url_constants.h"
 +
 +namespace extensions {
 +namespace api {
 +
 +namespace {
 +
-+// Serializes ui::AXNodeData to base::Value::Dict with all fields
-+base::Value::Dict SerializeAXNodeData(const ui::AXNodeData& node) {
-+  base::Value::Dict dict;
-+
-+  // Core identity
-+  dict.Set("id", node.id);
-+  dict.Set("role", ui::ToString(node.role));
-+
-+  // Hierarchy
-+  if (!node.child_ids.empty()) {
-+    base::Value::List children;
-+    for (int32_t child_id : node.child_ids) {
-+      children.Append(child_id);
++// Interns the strings of a CompactAccessibilityTree
++class AXStringTable {
++ public:
++  int Intern(std::string_view value) {
++    auto [it, inserted] =
++        indices_.try_emplace(std::string(value), static_cast<int>(size_));
++    if (inserted) {
++      strings_.Append(value);
++      size_++;
 +    }
-+    dict.Set("childIds", std::move(children));
++    return it->second;
 +  }
 +
-+  // State bitfield converted to string array
-+  base::Value::List states;
-+  for (int i = static_cast<int>(ax::mojom::State::kMinValue);
-+       i <= static_cast<int>(ax::mojom::State::kMaxValue); ++i) {
-+    auto state = static_cast<ax::mojom::State>(i);
-+    if (node.HasState(state)) {
-+      states.Append(ui::ToString(state));
++  base::Value::List Take() { return std::move(strings_); }
++
++ private:
++  std::unordered_map<std::string, int> indices_;
++  base::Value::List strings_;
++  size_t size_ = 0;
++};
++
++// Serializes |update|'s nodes as a CompactAccessibilityTree. Each node adds
++// a handful of scalars to a few shared lists instead of a nested dictionary.
++base::Value::Dict SerializeCompactAXTree(const ui::AXTreeUpdate& update,
++                                         const AXAttributeFilter& filter) {
++  AXStringTable strings;
++  base::Value::List nodes;
++  base::Value::List child_ids;
++  base::Value::List attributes;
++  const bool keep_children = KeepsAttribute(filter, "childIds");
++  const bool keep_states = KeepsAttribute(filter, "states");
++  const bool keep_actions = KeepsAttribute(filter, "actions");
++
++  for (const ui::AXNodeData& node : update.nodes) {
++    const size_t attributes_before = attributes.size();
++    auto add = [&](std::string_view name, base::Value value) {
++      attributes.Append(strings.Intern(name));
++      attributes.Append(std::move(value));
++    };
++
++    if (keep_states) {
++      base::Value::List states;
++      for (int i = static_cast<int>(ax::mojom::State::kMinValue);
++           i <= static_cast<int>(ax::mojom::State::kMaxValue); ++i) {
++        auto state = static_cast<ax::mojom::State>(i);
++        if (node.HasState(state)) {
++          states.Append(strings.Intern(ui::ToString(state)));
++        }
++      }
++      if (!states.empty()) {
++        add("states", base::Value(std::move(states)));
++      }
 +    }
-+  }
-+  if (!states.empty()) {
-+    dict.Set("states", std::move(states));
-+  }
-+
-+  // Actions bitfield converted to string array
-+  base::Value::List actions;
-+  for (int i = static_cast<int>(ax::mojom::Action::kMinValue);
-+       i <= static_cast<int>(ax::mojom::Action::kMaxValue); ++i) {
-+    auto action = static_cast<ax::mojom::Action>(i);
-+    if (node.HasAction(action)) {
-+      actions.Append(ui::ToString(action));
++    if (keep_actions) {
++      base::Value::List actions;
++      for (int i = static_cast<int>(ax::mojom::Action::kMinValue);
++           i <= static_cast<int>(ax::mojom::Action::kMaxValue); ++i) {
++        auto action = static_cast<ax::mojom::Action>(i);
++        if (node.HasAction(action)) {
++          actions.Append(strings.Intern(ui::ToString(action)));
++        }
++      }
++      if (!actions.empty()) {
++        add("actions", base::Value(std::move(actions)));
++      }
 +    }
-+  }
-+  if (!actions.empty()) {
-+    dict.Set("actions", std::move(actions));
-+  }
 +
-+  // String attributes map with enum keys converted to strings
-+  if (node.string_attributes.size() > 0) {
-+    base::Value::Dict attrs;
 +    for (const auto& [key, value] : node.string_attributes) {
-+      attrs.Set(ui::ToString(key), value);
++      if (KeepsAttribute(filter, ui::ToString(key))) {
++        add(ui::ToString(key), base::Value(strings.Intern(value)));
++      }
 +    }
-+    dict.Set("stringAttributes", std::move(attrs));
-+  }
-+
-+  // Int attributes map
-+  if (node.int_attributes.size() > 0) {
-+    base::Value::Dict attrs;
 +    for (const auto& [key, value] : node.int_attributes) {
-+      attrs.Set(ui::ToString(key), value);
++      if (KeepsAttribute(filter, ui::ToString(key))) {
++        add(ui::ToString(key), base::Value(value));
++      }
 +    }
-+    dict.Set("intAttributes", std::move(attrs));
-+  }
-+
-+  // Float attributes map
-+  if (node.float_attributes.size() > 0) {
-+    base::Value::Dict attrs;
 +    for (const auto& [key, value] : node.float_attributes) {
-+      attrs.Set(ui::ToString(key), static_cast<double>(value));
++      if (KeepsAttribute(filter, ui::ToString(key))) {
++        add(ui::ToString(key), base::Value(static_cast<double>(value)));
++      }
++    }
++    if (node.bool_attributes) {
++      node.bool_attributes->ForEach(
++          [&](ax::mojom::BoolAttribute key, bool value) {
++            if (KeepsAttribute(filter, ui::ToString(key))) {
++              add(ui::ToString(key), base::Value(value));
++            }
++          });
 +    }
-+    dict.Set("floatAttributes", std::move(attrs));
-+  }
-+
-+  // Bool attributes map
-+  if (node.bool_attributes && node.bool_attributes->Size() > 0) {
-+    base::Value::Dict attrs;
-+    node.bool_attributes->ForEach([&attrs](ax::mojom::BoolAttribute key, bool value) {
-+      attrs.Set(ui::ToString(key), value);
-+    });
-+    dict.Set("boolAttributes", std::move(attrs));
-+  }
-+
-+  // IntList attributes map
-+  if (node.intlist_attributes.size() > 0) {
-+    base::Value::Dict attrs;
 +    for (const auto& [key, values] : node.intlist_attributes) {
++      if (!KeepsAttribute(filter, ui::ToString(key))) {
++        continue;
++      }
 +      base::Value::List list;
 +      for (int v : values) {
 +        list.Append(v);
 +      }
-+      attrs.Set(ui::ToString(key), std::move(list));
++      add(ui::ToString(key), base::Value(std::move(list)));
 +    }
-+    dict.Set("intListAttributes", std::move(attrs));
-+  }
-+
-+  // StringList attributes map
-+  if (node.stringlist_attributes.size() > 0) {
-+    base::Value::Dict attrs;
 +    for (const auto& [key, values] : node.stringlist_attributes) {
++      if (!KeepsAttribute(filter, ui::ToString(key))) {
++        continue;
++      }
 +      base::Value::List list;
 +      for (const auto& v : values) {
-+        list.Append(v);
++        list.Append(strings.Intern(v));
 +      }
-+      attrs.Set(ui::ToString(key), std::move(list));
++      add(ui::ToString(key), base::Value(std::move(list)));
 +    }
-+    dict.Set("stringListAttributes", std::move(attrs));
-+  }
-+
-+  // HTML attributes (name-value pairs)
-+  if (!node.html_attributes.empty()) {
-+    base::Value::Dict attrs;
 +    for (const auto& [name, value] : node.html_attributes) {
-+      attrs.Set(name, value);
++      if (KeepsAttribute(filter, name)) {
++        add(name, base::Value(strings.Intern(value)));
++      }
++    }
++
++    const size_t child_count = keep_children ? node.child_ids.size() : 0;
++    if (keep_children) {
++      for (int32_t child_id : node.child_ids) {
++        child_ids.Append(child_id);
++      }
 +    }
-+    dict.Set("htmlAttributes", std::move(attrs));
++
++    nodes.Append(node.id);
++    nodes.Append(strings.Intern(ui::ToString(node.role)));
++    nodes.Append(static_cast<int>(child_count));
++    nodes.Append(static_cast<int>((attributes.size() - attributes_before) / 2));
 +  }
 +
-+  return dict;
++  base::Value::Dict compact;
++  compact.Set("strings", strings.Take());
++  compact.Set("nodes", std::move(nodes));
++  compact.Set("childIds", std::move(child_ids));
++  compact.Set("attributes", std::move(attributes));
++  return compact;
 +}
 +
 +// Serializes ui::AXTreeData to base::Value::Dict
@@ -235,6 +310,73 @@ index 0000000000000..c08b705ef6869
 +  return dict;
 +}
 +
++// Builds the getAccessibilityTree result for |tree_update|. Touches no
++// browser state, so it runs on the ThreadPool.
++base::Value::Dict SerializeAccessibilityTree(
++    browseros::SharedAXTreeUpdate snapshot,
++    bool compact,
++    AXAttributeFilter filter) {
++  const ui::AXTreeUpdate& tree_update = snapshot->data;
++  base::Value::Dict tree;
++  tree.Set("rootId", tree_update.root_id);
++
++  if (compact) {
++    tree.Set("compact", SerializeCompactAXTree(tree_update, filter));
++  } else {
++    // Serialize all nodes with complete AX data
++    base::Value::Dict nodes;
++    for (const auto& node_data : tree_update.nodes) {
++      nodes.Set(base::NumberToString(node_data.id),
++                SerializeAXNodeData(node_data, filter));
++    }
++    tree.Set("nodes", std::move(nodes));
++  }
++
++  // Serialize tree-level metadata
++  tree.Set("treeData", SerializeAXTreeData(tree_update.tree_data));
++  return tree;
++}
++
++// Extracts getSnapshot's page content from |snapshot|, as changes against
++// |previous| item hashes if given. Runs on the ThreadPool.
++ContentSnapshot BuildPageContent(
++    ContentProcessor::Mode mode,
++    std::optional<std::vector<uint32_t>> previous,
++    bool url_table,
++    browseros::SharedAXTreeUpdate snapshot) {
++  base::Time start_time = base::Time::Now();
++  ContentSnapshot result;
++  browser_os::PageContent& content = result.content;
++  content.items = ContentProcessor::ExtractPageContent(snapshot->data, mode);
++
++  result.item_hashes.reserve(content.items.size());
++  for (browser_os::ContentItem& item : content.items) {
++    const uint32_t hash = ContentProcessor::HashItem(item);
++    item.hash = base::StringPrintf("%08x", hash);
++    result.item_hashes.push_back(hash);
++  }
++  content.content_hash = base::StringPrintf(
++      "%08x", ContentProcessor::HashItems(result.item_hashes));
++
++  // Hashed with their URLs, before those move into the table
++  if (url_table) {
++    const ui::AXTreeUpdate& update = snapshot->data;
++    content.urls = ContentProcessor::BuildUrlTable(
++        content.items, GURL(update.has_tree_data ? update.tree_data.url : ""));
++  }
++
++  if (previous) {
++    content.changes = ContentProcessor::DiffItems(*previous, content.items,
++                                                  result.item_hashes);
++    content.items.clear();
++  }
++
++  content.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
++  content.processing_time_ms =
++      (base::Time::Now() - start_time).InMilliseconds();
++  return result;
++}
++
 +// Helper to find which PrefService contains a preference
 +// Tries Local State first, then Profile prefs
 +PrefService* FindPrefService(const std::string& pref_name, Profile* profile) {
@@ -251,23 +393,293 @@ index 0000000000000..c08b705ef6869
 +  return nullptr;
 +}
 +
-+// Helper to determine preference type name from value
-+std::string GetPrefTypeName(const base::Value* value) {
-+  switch (value->type()) {
-+    case base::Value::Type::BOOLEAN:
-+      return "boolean";
-+    case base::Value::Type::INTEGER:
-+    case base::Value::Type::DOUBLE:
-+      return "number";
-+    case base::Value::Type::STRING:
-+      return "string";
-+    case base::Value::Type::LIST:
-+      return "list";
-+    case base::Value::Type::DICT:
-+      return "dictionary";
-+    default:
-+      return "unknown";
++// Maximum number of steps accepted by executeActions
++constexpr size_t kMaxBatchActions = 100;
++
++// Returns true for the special keys accepted by sendKeys
++bool IsSupportedKey(const std::string& key) {
++  // Simple check instead of std::set to avoid exit-time destructor
++  return key == "Enter" || key == "Delete" || key == "Backspace" ||
++         key == "Tab" || key == "Escape" || key == "ArrowUp" ||
++         key == "ArrowDown" || key == "ArrowLeft" || key == "ArrowRight" ||
++         key == "Home" || key == "End" || key == "PageUp" || key == "PageDown";
++}
++
++// Largest size with |content|'s aspect ratio that fits inside |bounds|
++gfx::Size FitInside(const gfx::Size& content, const gfx::Size& bounds) {
++  if (content.IsEmpty()) {
++    return bounds;
++  }
++  const float scale =
++      std::min(static_cast<float>(bounds.width()) / content.width(),
++               static_cast<float>(bounds.height()) / content.height());
++  gfx::Size fitted = gfx::ScaleToFlooredSize(content, scale);
++  fitted.SetToMax(gfx::Size(1, 1));
++  fitted.SetToMin(bounds);
++  return fitted;
++}
++
++// Largest part of |content| with |target|'s aspect ratio
++gfx::Size CropToAspectRatio(const gfx::Size& content,
++                            const gfx::Size& target) {
++  const int64_t content_cross =
++      static_cast<int64_t>(content.width()) * target.height();
++  const int64_t target_cross =
++      static_cast<int64_t>(target.width()) * content.height();
++  gfx::Size cropped = content;
++  if (content_cross > target_cross) {
++    // Wider than the target: keep the full height
++    cropped.set_width(
++        static_cast<int>(content.height() * int64_t{target.width()} /
++                         target.height()));
++  } else {
++    cropped.set_height(
++        static_cast<int>(content.width() * int64_t{target.height()} /
++                         target.width()));
++  }
++  cropped.SetToMax(gfx::Size(1, 1));
++  return cropped;
++}
++
++// Looks up the NodeInfo for |node_id| in |web_contents|' latest snapshot.
++// Returns nullptr and sets |error| if there is none.
++const NodeInfo* FindNodeInfo(content::WebContents* web_contents,
++                             int node_id,
++                             std::string* error) {
++  TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(web_contents);
++  if (!mappings) {
++    *error = "No snapshot data for this tab";
++    return nullptr;
++  }
++
++  auto node_it = mappings->nodes.find(node_id);
++  if (node_it == mappings->nodes.end()) {
++    *error = "Node ID not found";
++    return nullptr;
++  }
++  return &node_it->second;
++}
++
++// Error of snapshots and screenshots stopped through their
++// RequestCancellation
++constexpr char kRequestCancelledError[] = "Request was cancelled";
++
++// Lane asked for by |options|, if any
++std::optional<RequestLane> GetRequestedLane(
++    const std::optional<browser_os::InteractiveSnapshotOptions>& options) {
++  if (!options) {
++    return std::nullopt;
++  }
++  if (options->background.value_or(false)) {
++    return RequestLane::kBackground;
++  }
++  return ToRequestLane(options->priority);
++}
++
++// Converts the viewport, budget, priority and path fields of
++// InteractiveSnapshotOptions for SnapshotProcessor. Without a priority in
++// |options| that of |web_contents|, if given, applies.
++SnapshotOptions ToSnapshotOptions(
++    const std::optional<browser_os::InteractiveSnapshotOptions>& options,
++    content::WebContents* web_contents) {
++  SnapshotOptions snapshot_options;
++  snapshot_options.priority = GetTaskPriority(BrowserOSTabPriority::ResolveLane(
++      web_contents, GetRequestedLane(options)));
++  if (!options) {
++    return snapshot_options;
++  }
++
++  snapshot_options.viewport_only = options->viewport_only.value_or(false);
++  snapshot_options.viewport_margin =
++      std::max(0.0, options->viewport_margin.value_or(0.0));
++  snapshot_options.max_nodes =
++      static_cast<size_t>(std::max(0, options->max_nodes.value_or(0)));
++  snapshot_options.max_bytes =
++      static_cast<size_t>(std::max(0, options->max_bytes.value_or(0)));
++  if (options->attributes) {
++    snapshot_options.attributes =
++        NodeAttributeMask::FromNames(*options->attributes);
++  }
++  if (!options->include_paths.value_or(true)) {
++    snapshot_options.attributes.string_attributes.Remove(NodeAttribute::kPath);
++  }
++  return snapshot_options;
++}
++
++// Quiet period applied before a returnSnapshot capture when the caller did
++// not choose one, so the snapshot reflects the settled page
++constexpr base::TimeDelta kReturnSnapshotQuietPeriod = base::Milliseconds(100);
++
++// Longest wait an InteractionOptions field may ask for
++constexpr int kMaxInteractionWaitMs = 10000;
++
++// Converts InteractionOptions to the change detector's settle policy.
++// Unset or negative fields keep the defaults; waits are capped at
++// kMaxInteractionWaitMs.
++SettlePolicy SettlePolicyFromOptions(
++    const std::optional<browser_os::InteractionOptions>& options) {
++  SettlePolicy policy;
++  if (!options) {
++    return policy;
++  }
++
++  auto to_delta = [](int ms) {
++    return base::Milliseconds(std::min(ms, kMaxInteractionWaitMs));
++  };
++  if (options->change_timeout_ms && *options->change_timeout_ms >= 0) {
++    policy.change_timeout = to_delta(*options->change_timeout_ms);
++  }
++  if (options->quiet_period_ms && *options->quiet_period_ms >= 0) {
++    policy.quiet_period = to_delta(*options->quiet_period_ms);
++  }
++  if (options->max_wait_ms && *options->max_wait_ms >= 0) {
++    policy.max_wait = to_delta(*options->max_wait_ms);
++  }
++  policy.wait_for_network_idle = options->wait_for_network_idle.value_or(false);
++  return policy;
++}
++
++// Draws |highlights| onto a captured screenshot, encodes it, and base64s it
++// into a data URL if |as_data_url|. Runs on the ThreadPool: a full-viewport
++// PNG takes tens of milliseconds to encode. Returns nullopt without encoding
++// once |cancellation| is cancelled.
++std::optional<EncodedScreenshot> EncodeScreenshot(
++    const SkBitmap& captured,
++    const gfx::Size& output_size,
++    const std::vector<ScreenshotHighlight>& highlights,
++    const gfx::Vector2dF& css_to_bitmap,
++    browser_os::ImageFormat format,
++    int quality,
++    bool as_data_url,
++    scoped_refptr<RequestCancellation> cancellation) {
++  if (IsRequestCancelled(cancellation.get())) {
++    return std::nullopt;
++  }
++  TRACE_EVENT("browser", "BrowserOS::EncodeScreenshot", "width",
++              captured.width(), "height", captured.height());
++  SkBitmap bitmap = captured;
++  // A contain fit was scaled in the readback; only the padding is added here
++  if (!output_size.IsEmpty() &&
++      output_size != gfx::Size(bitmap.width(), bitmap.height())) {
++    bitmap = LetterboxScreenshot(bitmap, output_size);
++  }
++  if (!highlights.empty()) {
++    bitmap = DrawScreenshotHighlights(bitmap, highlights, css_to_bitmap);
++  }
++  if (IsRequestCancelled(cancellation.get())) {
++    return std::nullopt;
++  }
++
++  std::optional<std::vector<uint8_t>> encoded;
++  const char* mime_type = "image/png";
++  switch (format) {
++    case browser_os::ImageFormat::kJpeg:
++      encoded = gfx::JPEGCodec::Encode(bitmap, quality);
++      mime_type = "image/jpeg";
++      break;
++    case browser_os::ImageFormat::kWebp:
++      encoded = gfx::WebpCodec::Encode(bitmap, quality);
++      mime_type = "image/webp";
++      break;
++    case browser_os::ImageFormat::kNone:
++    case browser_os::ImageFormat::kPng:
++      encoded = gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false);
++      break;
++  }
++  if (!encoded) {
++    return std::nullopt;
++  }
++
++  EncodedScreenshot screenshot;
++  screenshot.mime_type = mime_type;
++  screenshot.width = bitmap.width();
++  screenshot.height = bitmap.height();
++  if (as_data_url) {
++    screenshot.data_url = base::StrCat(
++        {"data:", mime_type, ";base64,", base::Base64Encode(*encoded)});
++  } else {
++    screenshot.bytes = std::move(*encoded);
++  }
++  return screenshot;
++}
++
++// How long scrollUp/scrollDown wait for scroll activity to settle. With no
++// activity at all in this time the page is taken not to have moved.
++constexpr base::TimeDelta kScrollEndTimeout = base::Milliseconds(500);
++
++// Reads the main frame's scroll position and viewport size
++constexpr char16_t kViewportStateScript[] =
++    u"[window.scrollX, window.scrollY, window.innerWidth, "
++    u"window.innerHeight, document.documentElement.scrollHeight]";
++
++// Parses the result of kViewportStateScript. Returns nullopt if the script
++// did not run, e.g. because the tab went away.
++std::optional<browser_os::ViewportState> ParseViewportState(
++    const base::Value& result) {
++  if (!result.is_list() || result.GetList().size() != 5) {
++    return std::nullopt;
++  }
++  const base::Value::List& values = result.GetList();
++  for (const auto& value : values) {
++    if (!value.GetIfDouble()) {
++      return std::nullopt;
++    }
++  }
++
++  browser_os::ViewportState state;
++  state.scroll_x = *values[0].GetIfDouble();
++  state.scroll_y = *values[1].GetIfDouble();
++  state.width = *values[2].GetIfDouble();
++  state.height = *values[3].GetIfDouble();
++  state.document_height = *values[4].GetIfDouble();
++  return state;
++}
++
++// Runs kViewportStateScript in |web_contents|' main frame. Returns false,
++// without running |callback|, if there is no live frame to run it in.
++bool ReadViewportState(content::WebContents* web_contents,
++                       base::OnceCallback<void(base::Value)> callback) {
++  content::RenderFrameHost* rfh =
++      web_contents ? web_contents->GetPrimaryMainFrame() : nullptr;
++  if (!rfh || !rfh->IsRenderFrameLive()) {
++    return false;
++  }
++  rfh->ExecuteJavaScriptForTests(kViewportStateScript, std::move(callback),
++                                 /*honor_js_content_settings=*/false);
++  return true;
++}
++
++// Brings |tab_id|'s stored bounds up to date with the main frame scroll
++// position in |result|, a kViewportStateScript result
++void TrackScrollOffset(content::WebContents* web_contents,
++                       int tab_id,
++                       const base::Value& result) {
++  std::optional<browser_os::ViewportState> state = ParseViewportState(result);
++  if (!web_contents || !state) {
++    return;
 +  }
++  content::RenderWidgetHost* rwh =
++      web_contents->GetPrimaryMainFrame()->GetRenderWidgetHost();
++  BrowserOSNodeMappingStore* store =
++      BrowserOSNodeMappingStore::Get(web_contents->GetBrowserContext());
++  if (!store) {
++    return;
++  }
++  const float scale = CssToWidgetScale(web_contents, rwh);
++  store->UpdateScrollOffset(
++      tab_id, gfx::PointF(state->scroll_x * scale, state->scroll_y * scale),
++      gfx::SizeF(state->width * scale, state->height * scale));
++}
++
++// Calls with equal keys get the same snapshot of a tab
++std::string GetSnapshotCoalescingKey(const SnapshotOptions& options,
++                                     bool stable_node_ids) {
++  return base::StringPrintf(
++      "%d:%g:%zu:%zu:%d:%" PRIu64 ":%d", options.viewport_only,
++      options.viewport_margin, options.max_nodes, options.max_bytes,
++      static_cast<int>(options.priority), options.attributes.ToBitmask(),
++      stable_node_ids);
 +}
 +
 +}  // namespace
@@ -295,47 +707,77 @@ index 0000000000000..c08b705ef6869
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
 +
++  bool include_inline_text_boxes = false;
++  if (params->options) {
++    compact_ = params->options->encoding ==
++               browser_os::AccessibilityTreeEncoding::kCompact;
++    include_inline_text_boxes =
++        params->options->include_inline_text_boxes.value_or(false);
++    if (params->options->attributes) {
++      attribute_filter_ = base::flat_set<std::string>(
++          params->options->attributes->begin(),
++          params->options->attributes->end());
++    }
++  }
++
 +  // Enable accessibility if needed
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh) {
 +    return RespondNow(Error("No render frame"));
 +  }
 +
++  // Bounds how many trees agents make the browser hold at once
++  web_contents_ = web_contents->GetWeakPtr();
++  include_inline_text_boxes_ = include_inline_text_boxes;
++  if (!BrowserOSCallLimiter::GetInstance()->Admit(
++          extension_id(), tab_info->tab_id,
++          base::BindOnce(&BrowserOSGetAccessibilityTreeFunction::OnCallAdmitted,
++                         this))) {
++    return RespondNow(Error(kTooManyHeavyCallsError));
++  }
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSGetAccessibilityTreeFunction::OnCallAdmitted(
++    base::ScopedClosureRunner slot) {
++  call_slot_ = std::move(slot);
++  if (!web_contents_) {
++    Respond(Error("Web contents destroyed"));
++    return;
++  }
++
 +  // Request accessibility tree snapshot
 +  // Use WebContents with extended properties to get a full tree
-+  web_contents->RequestAXTreeSnapshot(
++  browseros::AXSnapshotCache::Request(
++      web_contents_.get(),
++      GetSnapshotAXMode(SnapshotProfile::kFull, include_inline_text_boxes_),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
++      /* timeout= */ base::TimeDelta(),
++      browseros::AXSnapshotCache::Freshness::kAny,
 +      base::BindOnce(
 +          &BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeReceived,
-+          this),
-+      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties |
-+                 ui::AXMode::kInlineTextBoxes),
-+      /* max_nodes= */ 0,  // No limit
-+      /* timeout= */ base::TimeDelta(),
-+      content::WebContents::AXTreeSnapshotPolicy::kAll);
-+
-+  return RespondLater();
++          this));
 +}
 +
 +void BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeReceived(
-+    ui::AXTreeUpdate& tree_update) {
-+  browser_os::AccessibilityTree result;
-+  result.root_id = tree_update.root_id;
-+
-+  // Serialize all nodes with complete AX data
-+  base::Value::Dict nodes;
-+  for (const auto& node_data : tree_update.nodes) {
-+    nodes.Set(base::NumberToString(node_data.id),
-+              SerializeAXNodeData(node_data));
-+  }
-+  result.nodes.additional_properties = std::move(nodes);
-+
-+  // Serialize tree-level metadata
-+  browser_os::AccessibilityTree::TreeData tree_data_obj;
-+  tree_data_obj.additional_properties = SerializeAXTreeData(tree_update.tree_data);
-+  result.tree_data = std::move(tree_data_obj);
++    browseros::SharedAXTreeUpdate snapshot) {
++  // Serializing large trees allocates heavily; keep it off the UI thread
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::TaskPriority::USER_VISIBLE,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&SerializeAccessibilityTree, std::move(snapshot),
++                     compact_, std::move(attribute_filter_)),
++      base::BindOnce(
++          &BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeSerialized,
++          this));
++}
 +
-+  Respond(ArgumentList(
-+      browser_os::GetAccessibilityTree::Results::Create(result)));
++void BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeSerialized(
++    base::Value::Dict tree) {
++  base::Value::List results;
++  results.Append(std::move(tree));
++  Respond(ArgumentList(std::move(results)));
 +}
 +
 +// Implementation of BrowserOSGetInteractiveSnapshotFunction
@@ -345,9 +787,22 @@ index 0000000000000..c08b705ef6869
 +      browser_os::GetInteractiveSnapshot::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
 +
++  return StartSnapshot(params->tab_id, params->options);
++}
++
++ExtensionFunction::ResponseAction
++BrowserOSGetInteractiveSnapshotFunction::StartSnapshot(
++    std::optional<int> tab_id,
++    const std::optional<browser_os::InteractiveSnapshotOptions>& options) {
++  browseros::NotifyAgentActivity();
++  profiled_call_ = browseros::ProfiledCall(name(), start_time_, "dispatch");
++  if (options && options->wire_format) {
++    wire_compression_ = options->wire_format->compression;
++  }
++
 +  // Get the target tab
 +  std::string error_message;
-+  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++  auto tab_info = GetTabFromOptionalId(tab_id, browser_context(),
 +                                       include_incognito_information(),
 +                                       &error_message);
 +  if (!tab_info) {
@@ -356,6 +811,7 @@ index 0000000000000..c08b705ef6869
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
 +  web_contents_ = web_contents->GetWeakPtr();
++  rendering_hold_ = BrowserOSBackgroundRendering::HoldIfHidden(web_contents);
 +  
 +  // Note: We don't need to get scale factors here!
 +  // The accessibility tree provides bounds in CSS pixels (logical pixels),
@@ -364,6 +820,7 @@ index 0000000000000..c08b705ef6869
 +  
 +  // Store tab ID for mapping
 +  tab_id_ = tab_info->tab_id;
++  profiled_call_.set_tab_id(tab_id_);
 +
 +  // Check frame stability before requesting snapshot
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
@@ -373,27 +830,123 @@ index 0000000000000..c08b705ef6869
 +    empty_snapshot.snapshot_id = next_snapshot_id_++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
-+    return RespondNow(ArgumentList(
-+        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
++    RespondWithSnapshot(std::move(empty_snapshot));
++    return did_respond() ? AlreadyResponded() : RespondLater();
 +  }
-+  
++
++  snapshot_options_ = ToSnapshotOptions(options, web_contents);
++  cancellation_ = BrowserOSRequestCanceller::Track(
++      web_contents, options ? options->request_id.value_or("") : "");
++  snapshot_options_.cancellation = cancellation_;
++
++  incremental_ = options && options->incremental.value_or(false);
++  stable_node_ids_ =
++      incremental_ ||
++      (options && options->stable_node_ids.value_or(false));
++  // Owns the tab's node mappings lifetime and the stable nodeId remap
++  BrowserOSSnapshotTracker::CreateForWebContents(web_contents);
++  BrowserOSSnapshotTracker* tracker =
++      BrowserOSSnapshotTracker::FromWebContents(web_contents);
++  if (options && options->prefetch) {
++    BrowserOSSnapshotPrefetcher::SetEnabled(web_contents, *options->prefetch);
++  } else if (BrowserOSSnapshotPrefetcher::IsEnabled(web_contents)) {
++    // Keeps the cache, and so the prefetch, alive while the agent works
++    tracker->EnsureAccessibilityEnabled();
++  }
++
++  if (incremental_) {
++    if (options->base_snapshot_id) {
++      base_snapshot_id_ =
++          static_cast<uint32_t>(*options->base_snapshot_id);
++    }
++
++    tracker->EnsureAccessibilityEnabled();
++
++    // Nothing changed since the caller's snapshot: answer with an empty delta
++    // without fetching the tree. The tab's node mappings are still valid.
++    if (base_snapshot_id_ && tracker->IsUnchangedSince(*base_snapshot_id_)) {
++      browser_os::InteractiveSnapshot delta_snapshot;
++      delta_snapshot.snapshot_id = next_snapshot_id_++;
++      delta_snapshot.timestamp =
++          base::Time::Now().InMillisecondsFSinceUnixEpoch();
++      delta_snapshot.processing_time_ms = 0;
++      delta_snapshot.base_snapshot_id = static_cast<int>(*base_snapshot_id_);
++      delta_snapshot.removed_node_ids.emplace();
++      tracker->RecordUnchangedSnapshot(delta_snapshot.snapshot_id);
++      VLOG(1) << "[browseros] Page unchanged since snapshot "
++              << *base_snapshot_id_ << ", returning empty delta";
++      RespondWithSnapshot(std::move(delta_snapshot));
++      return did_respond() ? AlreadyResponded() : RespondLater();
++    }
++
++    request_generation_ = tracker->generation();
++  } else {
++    // A caller asking for the same snapshot while one is being taken waits
++    // for it rather than rebuilding the node mappings under it. Calls that
++    // can be cancelled by id keep their own.
++    if (CanCoalesce() && !(options && options->request_id)) {
++      const std::string key =
++          GetSnapshotCoalescingKey(snapshot_options_, stable_node_ids_);
++      if (tracker->JoinPendingSnapshot(
++              key, base::BindOnce(&BrowserOSGetInteractiveSnapshotFunction::
++                                      OnPendingSnapshotReady,
++                                  this))) {
++        profiled_call_.StartPhase("coalesced_wait");
++        return RespondLater();
++      }
++      tracker->BeginPendingSnapshot(key);
++      pending_snapshot_key_ = key;
++    }
++
++    // A full snapshot rebuilds this tab's node mappings (and may renumber
++    // them), so the incremental base no longer matches.
++    tracker->Invalidate();
++  }
++
++  // Bounds how many trees agents make the browser hold at once
++  profiled_call_.StartPhase("admission");
++  if (!BrowserOSCallLimiter::GetInstance()->Admit(
++          extension_id(), tab_id_,
++          base::BindOnce(
++              &BrowserOSGetInteractiveSnapshotFunction::OnCallAdmitted,
++              this))) {
++    FinishPendingSnapshot(nullptr);
++    return RespondNow(Error(kTooManyHeavyCallsError));
++  }
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSGetInteractiveSnapshotFunction::OnCallAdmitted(
++    base::ScopedClosureRunner slot) {
++  call_slot_ = std::move(slot);
++  content::WebContents* web_contents = web_contents_.get();
++  if (!web_contents) {
++    FinishPendingSnapshot(nullptr);
++    Respond(Error("Web contents destroyed"));
++    return;
++  }
++  if (IsRequestCancelled(cancellation_.get())) {
++    FinishPendingSnapshot(nullptr);
++    Respond(Error(kRequestCancelledError));
++    return;
++  }
++
 +  // Request accessibility tree snapshot
-+  web_contents->RequestAXTreeSnapshot(
++  profiled_call_.StartPhase("ax_request");
++  browseros::AXSnapshotCache::Request(
++      web_contents,
++      GetSnapshotAXMode(SnapshotProfile::kInteractive),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
++      // content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants,
++      /* timeout= */ base::TimeDelta(),
++      browseros::AXSnapshotCache::Freshness::kAny,
 +      base::BindOnce(
 +          &BrowserOSGetInteractiveSnapshotFunction::OnAccessibilityTreeReceived,
-+          this),
-+      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties |
-+                 ui::AXMode::kInlineTextBoxes),
-+      /* max_nodes= */ 0,  // No limit
-+      /* timeout= */ base::TimeDelta(),
-+      content::WebContents::AXTreeSnapshotPolicy::kAll);
-+      // content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants);
-+
-+  return RespondLater();
++          this));
 +}
 +
 +void BrowserOSGetInteractiveSnapshotFunction::OnAccessibilityTreeReceived(
-+    ui::AXTreeUpdate& tree_update) {
++    browseros::SharedAXTreeUpdate snapshot) {
 +  // Double-check frame is still valid before processing
 +  if (!web_contents_) {
 +    LOG(WARNING) << "[browseros] WebContents gone during AX snapshot callback";
@@ -401,8 +954,7 @@ index 0000000000000..c08b705ef6869
 +    empty_snapshot.snapshot_id = next_snapshot_id_++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
-+    Respond(ArgumentList(
-+        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
++    RespondWithSnapshot(std::move(empty_snapshot));
 +    return;
 +  }
 +  
@@ -413,128 +965,2442 @@ index 0000000000000..c08b705ef6869
 +    empty_snapshot.snapshot_id = next_snapshot_id_++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
-+    Respond(ArgumentList(
-+        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
++    FinishPendingSnapshot(&empty_snapshot);
++    RespondWithSnapshot(std::move(empty_snapshot));
++    return;
++  }
++
++  if (IsRequestCancelled(cancellation_.get())) {
++    FinishPendingSnapshot(nullptr);
++    Respond(Error(kRequestCancelledError));
 +    return;
 +  }
 +  
++  // Stable nodeIds come from the tab's remap instead of 1..N numbering
++  SnapshotProcessor::NodeIdResolver node_id_resolver;
++  if (stable_node_ids_) {
++    if (auto* tracker =
++            BrowserOSSnapshotTracker::FromWebContents(web_contents_.get())) {
++      node_id_resolver = base::BindRepeating(&NodeIdRemap::Resolve,
++                                             tracker->node_id_remap());
++    }
++  }
++
 +  // Simple API layer - just delegates to the processor
++  const uint32_t snapshot_id = next_snapshot_id_++;
++  profiled_call_.StartPhase("processing");
 +  SnapshotProcessor::ProcessAccessibilityTree(
-+      tree_update,
++      snapshot,
 +      tab_id_,
-+      next_snapshot_id_++,
++      snapshot_id,
 +      web_contents_.get(),
++      snapshot_options_,
 +      base::BindOnce(
 +          &BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed,
-+          base::WrapRefCounted(this)));
++          base::WrapRefCounted(this)),
++      std::move(node_id_resolver),
++      CreateChunkCallback(snapshot_id));
 +}
 +
 +void BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed(
 +    SnapshotProcessingResult result) {
-+  Respond(ArgumentList(
-+      browser_os::GetInteractiveSnapshot::Results::Create(result.snapshot)));
++  if (result.cancelled) {
++    // The tab's node mappings were partly rebuilt, so no base matches them
++    if (web_contents_) {
++      if (auto* tracker =
++              BrowserOSSnapshotTracker::FromWebContents(web_contents_.get())) {
++        tracker->Invalidate();
++      }
++    }
++    FinishPendingSnapshot(nullptr);
++    Respond(Error(kRequestCancelledError));
++    return;
++  }
++
++  if (web_contents_) {
++    if (auto* tracker =
++            BrowserOSSnapshotTracker::FromWebContents(web_contents_.get())) {
++      // Kept from the full node mappings, before any delta is applied
++      tracker->RecordSnapshotForDiff(
++          static_cast<uint32_t>(result.snapshot.snapshot_id));
++      if (incremental_) {
++        tracker->ApplyDelta(base_snapshot_id_, request_generation_,
++                            result.snapshot);
++      }
++    }
++  }
++
++  FinishPendingSnapshot(&result.snapshot);
++  RecordBrowserOSSnapshotSize(name(), result.snapshot.elements.size(),
++                              result.estimated_bytes);
++  RespondWithSnapshot(std::move(result.snapshot));
 +}
 +
-+// Implementation of BrowserOSClickFunction
++void BrowserOSGetInteractiveSnapshotFunction::OnPendingSnapshotReady(
++    const browser_os::InteractiveSnapshot* snapshot) {
++  if (!snapshot) {
++    Respond(Error(kRequestCancelledError));
++    return;
++  }
++  RespondWithSnapshot(*snapshot);
++}
 +
-+ExtensionFunction::ResponseAction BrowserOSClickFunction::Run() {
-+  std::optional<browser_os::Click::Params> params =
-+      browser_os::Click::Params::Create(args());
-+  EXTENSION_FUNCTION_VALIDATE(params);
++void BrowserOSGetInteractiveSnapshotFunction::RespondWithSnapshot(
++    browser_os::InteractiveSnapshot snapshot) {
++  if (!wire_compression_) {
++    OnSnapshotPacked(std::move(snapshot));
++    return;
++  }
++  // Interning and compressing a large snapshot takes milliseconds
++  profiled_call_.StartPhase("encoding");
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {snapshot_options_.priority,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&PackInteractiveSnapshot, std::move(snapshot),
++                     *wire_compression_),
++      base::BindOnce(&BrowserOSGetInteractiveSnapshotFunction::OnSnapshotPacked,
++                     this));
++}
 +
-+  // Get the target tab
-+  std::string error_message;
-+  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
-+                                       include_incognito_information(),
-+                                       &error_message);
-+  if (!tab_info) {
-+    return RespondNow(Error(error_message));
++void BrowserOSGetInteractiveSnapshotFunction::OnSnapshotPacked(
++    base::expected<browser_os::InteractiveSnapshot, std::string> snapshot) {
++  if (!snapshot.has_value()) {
++    Respond(Error(snapshot.error()));
++    return;
 +  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  int tab_id = tab_info->tab_id;
++  RecordBrowserOSApiLatency(name(), base::TimeTicks::Now() - start_time_);
++  profiled_call_.Finish(true);
++  Respond(ArgumentList(CreateResults(*snapshot)));
++}
 +
-+  // Look up the AX node ID from our nodeId
-+  auto tab_it = GetNodeIdMappings().find(tab_id);
-+  if (tab_it == GetNodeIdMappings().end()) {
-+    return RespondNow(Error("No snapshot data for this tab"));
++void BrowserOSGetInteractiveSnapshotFunction::FinishPendingSnapshot(
++    const browser_os::InteractiveSnapshot* snapshot) {
++  if (pending_snapshot_key_.empty() || !web_contents_) {
++    return;
 +  }
-+  
-+  auto node_it = tab_it->second.find(params->node_id);
-+  if (node_it == tab_it->second.end()) {
-+    return RespondNow(Error("Node ID not found"));
++  if (auto* tracker =
++          BrowserOSSnapshotTracker::FromWebContents(web_contents_.get())) {
++    tracker->FinishPendingSnapshot(std::exchange(pending_snapshot_key_, {}),
++                                   snapshot);
 +  }
-+  
-+  const NodeInfo& node_info = node_it->second;
-+  
-+  // Perform click with change detection
-+  bool change_detected = ClickWithDetection(web_contents, node_info);
-+  
-+  // Create interaction response
-+  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::Click::Results::Create(response)));
 +}
 +
-+// Implementation of BrowserOSInputTextFunction
++void BrowserOSGetInteractiveSnapshotFunction::OnBrowserContextShutdown() {
++  if (cancellation_) {
++    cancellation_->Cancel();
++  }
++}
 +
-+ExtensionFunction::ResponseAction BrowserOSInputTextFunction::Run() {
-+  std::optional<browser_os::InputText::Params> params =
-+      browser_os::InputText::Params::Create(args());
-+  EXTENSION_FUNCTION_VALIDATE(params);
++base::Value::List BrowserOSGetInteractiveSnapshotFunction::CreateResults(
++    const browser_os::InteractiveSnapshot& snapshot) {
++  return browser_os::GetInteractiveSnapshot::Results::Create(snapshot);
++}
 +
-+  // Get the target tab
-+  std::string error_message;
-+  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
-+                                       include_incognito_information(),
-+                                       &error_message);
-+  if (!tab_info) {
-+    return RespondNow(Error(error_message));
-+  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  int tab_id = tab_info->tab_id;
++SnapshotProcessor::ChunkCallback
++BrowserOSGetInteractiveSnapshotFunction::CreateChunkCallback(
++    uint32_t snapshot_id) {
++  return SnapshotProcessor::ChunkCallback();
++}
 +
-+  // Look up the AX node ID from our nodeId
-+  auto tab_it = GetNodeIdMappings().find(tab_id);
-+  if (tab_it == GetNodeIdMappings().end()) {
-+    return RespondNow(Error("No snapshot data for this tab"));
++bool BrowserOSGetInteractiveSnapshotFunction::CanCoalesce() const {
++  return true;
++}
++
++// Implementation of BrowserOSGetInteractiveSnapshotsFunction
++
++namespace {
++
++// Most tabs accepted by one getInteractiveSnapshots call
++constexpr size_t kMaxSnapshotBatchTabs = 50;
++
++// Snapshot returned for a tab whose frame could not be captured
++browser_os::InteractiveSnapshot CreateEmptySnapshot() {
++  browser_os::InteractiveSnapshot snapshot;
++  snapshot.snapshot_id =
++      BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId();
++  snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
++  snapshot.processing_time_ms = 0;
++  return snapshot;
++}
++
++}  // namespace
++
++BrowserOSGetInteractiveSnapshotsFunction::
++    BrowserOSGetInteractiveSnapshotsFunction() = default;
++BrowserOSGetInteractiveSnapshotsFunction::
++    ~BrowserOSGetInteractiveSnapshotsFunction() = default;
++
++ExtensionFunction::ResponseAction
++BrowserOSGetInteractiveSnapshotsFunction::Run() {
++  std::optional<browser_os::GetInteractiveSnapshots::Params> params =
++      browser_os::GetInteractiveSnapshots::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  if (params->tab_ids.size() > kMaxSnapshotBatchTabs) {
++    return RespondNow(Error(base::StringPrintf(
++        "At most %zu tabs can be snapshotted at once", kMaxSnapshotBatchTabs)));
++  }
++  if (params->options && params->options->incremental.value_or(false)) {
++    return RespondNow(
++        Error("incremental is not supported for batch snapshots"));
++  }
++  if (params->options && params->options->wire_format) {
++    return RespondNow(
++        Error("wireFormat is not supported for batch snapshots"));
++  }
++
++  snapshot_options_ = ToSnapshotOptions(params->options, nullptr);
++  requested_lane_ = GetRequestedLane(params->options);
++  stable_node_ids_ =
++      params->options && params->options->stable_node_ids.value_or(false);
++
++  const size_t tab_count = params->tab_ids.size();
++  web_contents_.resize(tab_count);
++  results_.resize(tab_count);
++  cancellations_.resize(tab_count);
++  const std::string request_id =
++      params->options ? params->options->request_id.value_or("") : "";
++  pending_tabs_ = tab_count;
++  if (tab_count == 0) {
++    return RespondNow(ArgumentList(
++        browser_os::GetInteractiveSnapshots::Results::Create(results_)));
++  }
++
++  VLOG(1) << "[browseros] Taking interactive snapshots of " << tab_count
++          << " tabs";
++
++  // Issue every tree request before any of them is answered, so the tabs
++  // are captured concurrently rather than one after another
++  for (size_t i = 0; i < tab_count; ++i) {
++    results_[i].tab_id = params->tab_ids[i];
++
++    std::string error_message;
++    auto tab_info = GetTabFromOptionalId(params->tab_ids[i], browser_context(),
++                                         include_incognito_information(),
++                                         &error_message);
++    if (!tab_info) {
++      SetError(i, std::move(error_message));
++      continue;
++    }
++
++    content::WebContents* web_contents = tab_info->web_contents;
++    content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++    if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
++      LOG(WARNING) << "[browseros] Frame not stable for AX snapshot of tab "
++                   << tab_info->tab_id << " - skipping";
++      SetSnapshot(i, CreateEmptySnapshot());
++      continue;
++    }
++    web_contents_[i] = web_contents->GetWeakPtr();
++    cancellations_[i] =
++        BrowserOSRequestCanceller::Track(web_contents, request_id);
++    rendering_holds_.push_back(
++        BrowserOSBackgroundRendering::HoldIfHidden(web_contents));
++
++    // Each snapshot rebuilds its tab's node mappings, as
++    // getInteractiveSnapshot does
++    BrowserOSSnapshotTracker::CreateForWebContents(web_contents);
++    BrowserOSSnapshotTracker::FromWebContents(web_contents)->Invalidate();
++
++    browseros::AXSnapshotCache::Request(
++        web_contents,
++        GetSnapshotAXMode(SnapshotProfile::kInteractive),
++        content::WebContents::AXTreeSnapshotPolicy::kAll,
++        /* timeout= */ base::TimeDelta(),
++        browseros::AXSnapshotCache::Freshness::kAny,
++        base::BindOnce(
++            &BrowserOSGetInteractiveSnapshotsFunction::OnAccessibilityTreeReceived,
++            this, i));
++  }
++
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::OnAccessibilityTreeReceived(
++    size_t index,
++    browseros::SharedAXTreeUpdate snapshot) {
++  content::WebContents* web_contents = web_contents_[index].get();
++  content::RenderFrameHost* rfh =
++      web_contents ? web_contents->GetPrimaryMainFrame() : nullptr;
++  if (!rfh || !rfh->IsRenderFrameLive()) {
++    LOG(WARNING) << "[browseros] Tab " << results_[index].tab_id
++                 << " became unstable during AX snapshot callback";
++    SetSnapshot(index, CreateEmptySnapshot());
++    return;
++  }
++  if (IsRequestCancelled(cancellations_[index].get())) {
++    SetError(index, kRequestCancelledError);
++    return;
++  }
++
++  SnapshotProcessor::NodeIdResolver node_id_resolver;
++  if (stable_node_ids_) {
++    if (auto* tracker = BrowserOSSnapshotTracker::FromWebContents(web_contents)) {
++      node_id_resolver = base::BindRepeating(&NodeIdRemap::Resolve,
++                                             tracker->node_id_remap());
++    }
++  }
++
++  SnapshotOptions options = snapshot_options_;
++  options.cancellation = cancellations_[index];
++  options.priority = GetTaskPriority(
++      BrowserOSTabPriority::ResolveLane(web_contents, requested_lane_));
++
++  // Every tab goes through the same ThreadPool pipeline as a single
++  // snapshot, so the tabs are processed in parallel
++  SnapshotProcessor::ProcessAccessibilityTree(
++      snapshot,
++      results_[index].tab_id,
++      BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId(),
++      web_contents,
++      options,
++      base::BindOnce(
++          &BrowserOSGetInteractiveSnapshotsFunction::OnSnapshotProcessed,
++          base::WrapRefCounted(this), index),
++      std::move(node_id_resolver));
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::OnSnapshotProcessed(
++    size_t index,
++    SnapshotProcessingResult result) {
++  if (result.cancelled) {
++    SetError(index, kRequestCancelledError);
++    return;
++  }
++  if (content::WebContents* web_contents = web_contents_[index].get()) {
++    if (auto* tracker = BrowserOSSnapshotTracker::FromWebContents(web_contents)) {
++      tracker->RecordSnapshotForDiff(
++          static_cast<uint32_t>(result.snapshot.snapshot_id));
++    }
++  }
++  SetSnapshot(index, std::move(result.snapshot));
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::OnBrowserContextShutdown() {
++  for (const auto& cancellation : cancellations_) {
++    if (cancellation) {
++      cancellation->Cancel();
++    }
++  }
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::SetSnapshot(
++    size_t index,
++    browser_os::InteractiveSnapshot snapshot) {
++  results_[index].snapshot = std::move(snapshot);
++  OnTabDone();
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::SetError(size_t index,
++                                                        std::string error) {
++  results_[index].error = std::move(error);
++  OnTabDone();
++}
++
++void BrowserOSGetInteractiveSnapshotsFunction::OnTabDone() {
++  if (--pending_tabs_ > 0) {
++    return;
++  }
++  Respond(ArgumentList(
++      browser_os::GetInteractiveSnapshots::Results::Create(results_)));
++}
++
++// Implementation of BrowserOSGetInteractiveSnapshotStreamFunction
++
++ExtensionFunction::ResponseAction
++BrowserOSGetInteractiveSnapshotStreamFunction::Run() {
++  std::optional<browser_os::GetInteractiveSnapshotStream::Params> params =
++      browser_os::GetInteractiveSnapshotStream::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  if (params->options) {
++    if (params->options->incremental.value_or(false)) {
++      return RespondNow(
++          Error("incremental is not supported for streamed snapshots"));
++    }
++    if (params->options->max_bytes) {
++      return RespondNow(
++          Error("maxBytes is not supported for streamed snapshots"));
++    }
++    if (params->options->wire_format) {
++      return RespondNow(
++          Error("wireFormat is not supported for streamed snapshots"));
++    }
++  }
++
++  return StartSnapshot(params->tab_id, params->options);
++}
++
++base::Value::List BrowserOSGetInteractiveSnapshotStreamFunction::CreateResults(
++    const browser_os::InteractiveSnapshot& snapshot) {
++  browser_os::InteractiveSnapshotStreamSummary summary;
++  summary.snapshot_id = snapshot.snapshot_id;
++  summary.chunk_count = chunk_count_;
++  summary.node_count = node_count_;
++  summary.processing_time_ms = snapshot.processing_time_ms;
++  summary.truncated = snapshot.truncated;
++  return browser_os::GetInteractiveSnapshotStream::Results::Create(summary);
++}
++
++bool BrowserOSGetInteractiveSnapshotStreamFunction::CanCoalesce() const {
++  return false;
++}
++
++SnapshotProcessor::ChunkCallback
++BrowserOSGetInteractiveSnapshotStreamFunction::CreateChunkCallback(
++    uint32_t snapshot_id) {
++  return base::BindRepeating(
++      &BrowserOSGetInteractiveSnapshotStreamFunction::OnChunkReady,
++      base::WrapRefCounted(this), snapshot_id);
++}
++
++void BrowserOSGetInteractiveSnapshotStreamFunction::OnChunkReady(
++    uint32_t snapshot_id,
++    size_t chunk_index,
++    std::vector<browser_os::InteractiveNode> nodes) {
++  chunk_count_++;
++  node_count_ += static_cast<int>(nodes.size());
++
++  EventRouter* event_router =
++      browser_context() ? EventRouter::Get(browser_context()) : nullptr;
++  if (!event_router) {
++    return;
++  }
++
++  browser_os::InteractiveSnapshotChunk chunk;
++  chunk.snapshot_id = snapshot_id;
++  chunk.chunk_index = static_cast<int>(chunk_index);
++  chunk.elements = std::move(nodes);
++
++  auto event = std::make_unique<Event>(
++      events::UNKNOWN,
++      browser_os::OnInteractiveSnapshotChunk::kEventName,
++      browser_os::OnInteractiveSnapshotChunk::Create(chunk),
++      browser_context());
++  event_router->DispatchEventToExtension(extension_id(), std::move(event));
++}
++
++// Implementation of BrowserOSWaitForNodeFunction
++
++namespace {
++
++constexpr int kDefaultWaitForNodeTimeoutMs = 30000;
++constexpr int kMaxWaitForNodeTimeoutMs = 300000;
++// Coalesces bursts of AX events into one re-check
++constexpr base::TimeDelta kWaitForNodeRecheckDelay = base::Milliseconds(100);
++
++}  // namespace
++
++BrowserOSWaitForNodeFunction::BrowserOSWaitForNodeFunction() = default;
++BrowserOSWaitForNodeFunction::~BrowserOSWaitForNodeFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSWaitForNodeFunction::Run() {
++  std::optional<browser_os::WaitForNode::Params> params =
++      browser_os::WaitForNode::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  int timeout_ms = params->timeout_ms.value_or(kDefaultWaitForNodeTimeoutMs);
++  if (timeout_ms < 0) {
++    return RespondNow(Error("timeoutMs must not be negative"));
++  }
++  timeout_ms = std::min(timeout_ms, kMaxWaitForNodeTimeoutMs);
++
++  content::WebContents* web_contents = tab_info->web_contents;
++  tab_id_ = tab_info->tab_id;
++  web_contents_ = web_contents->GetWeakPtr();
++  query_ = std::move(params->query);
++
++  // Change events only arrive while accessibility stays enabled. Each check
++  // is a full snapshot, which renumbers the tab's nodes.
++  BrowserOSSnapshotTracker::CreateForWebContents(web_contents);
++  BrowserOSSnapshotTracker* tracker =
++      BrowserOSSnapshotTracker::FromWebContents(web_contents);
++  tracker->EnsureAccessibilityEnabled();
++  tracker->Invalidate();
++
++  watcher_ = std::make_unique<BrowserOSTreeChangeWatcher>(
++      web_contents, kWaitForNodeRecheckDelay,
++      base::BindRepeating(&BrowserOSWaitForNodeFunction::CheckForNode,
++                          base::Unretained(this)));
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE, base::BindOnce(&BrowserOSWaitForNodeFunction::OnTimeout, this),
++      base::Milliseconds(timeout_ms));
++
++  CheckForNode();
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSWaitForNodeFunction::CheckForNode() {
++  if (did_respond()) {
++    return;
++  }
++  if (!web_contents_) {
++    Finish(Error("Tab was closed"));
++    return;
++  }
++  if (checking_) {
++    recheck_needed_ = true;
++    return;
++  }
++
++  checking_ = true;
++  recheck_needed_ = false;
++  browseros::AXSnapshotCache::Request(
++      web_contents_.get(), GetSnapshotAXMode(SnapshotProfile::kInteractive),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
++      /* timeout= */ base::TimeDelta(),
++      browseros::AXSnapshotCache::Freshness::kAny,
++      base::BindOnce(
++          &BrowserOSWaitForNodeFunction::OnAccessibilityTreeReceived, this));
++}
++
++void BrowserOSWaitForNodeFunction::OnAccessibilityTreeReceived(
++    browseros::SharedAXTreeUpdate snapshot) {
++  if (did_respond()) {
++    return;
++  }
++  if (!web_contents_) {
++    Finish(Error("Tab was closed"));
++    return;
++  }
++  SnapshotProcessor::ProcessAccessibilityTree(
++      snapshot, tab_id_,
++      BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId(),
++      web_contents_.get(), SnapshotOptions(),
++      base::BindOnce(&BrowserOSWaitForNodeFunction::OnSnapshotProcessed,
++                     this));
++}
++
++void BrowserOSWaitForNodeFunction::OnSnapshotProcessed(
++    SnapshotProcessingResult result) {
++  checking_ = false;
++  if (did_respond()) {
++    return;
++  }
++
++  if (TabNodeMappings* mappings =
++          BrowserOSNodeMappingStore::FindForTab(web_contents_.get())) {
++    std::vector<uint32_t> node_ids = FindNodes(*mappings, query_);
++    if (!node_ids.empty()) {
++      Finish(ArgumentList(browser_os::WaitForNode::Results::Create(
++          NodeInfoToInteractiveNode(node_ids.front(),
++                                    mappings->nodes.at(node_ids.front())))));
++      return;
++    }
++  }
++
++  // The tree changed while this check ran; it may hold the node by now
++  if (recheck_needed_) {
++    CheckForNode();
++  }
++}
++
++void BrowserOSWaitForNodeFunction::OnTimeout() {
++  if (did_respond()) {
++    return;
++  }
++  Finish(Error("Timed out waiting for node"));
++}
++
++void BrowserOSWaitForNodeFunction::Finish(ResponseValue response) {
++  watcher_.reset();
++  Respond(std::move(response));
++}
++
++// Implementation of BrowserOSFindNodesFunction
++
++namespace {
++
++constexpr int kDefaultFindNodesLimit = 100;
++
++}  // namespace
++
++ExtensionFunction::ResponseAction BrowserOSFindNodesFunction::Run() {
++  std::optional<browser_os::FindNodes::Params> params =
++      browser_os::FindNodes::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(tab_info->web_contents);
++  if (!mappings) {
++    return RespondNow(Error("No snapshot data for this tab"));
++  }
++
++  const browser_os::NodeQuery& query = params->query;
++  int limit = query.limit.value_or(kDefaultFindNodesLimit);
++  if (limit <= 0) {
++    return RespondNow(Error("limit must be positive"));
++  }
++
++  std::vector<uint32_t> node_ids = FindNodes(*mappings, query);
++  if (node_ids.size() > static_cast<size_t>(limit)) {
++    node_ids.resize(limit);
++  }
++
++  std::vector<browser_os::InteractiveNode> nodes;
++  nodes.reserve(node_ids.size());
++  for (uint32_t node_id : node_ids) {
++    nodes.push_back(
++        NodeInfoToInteractiveNode(node_id, mappings->nodes.at(node_id)));
++  }
++  return RespondNow(
++      ArgumentList(browser_os::FindNodes::Results::Create(nodes)));
++}
++
++// Implementation of BrowserOSGetNodeStateFunction
++
++BrowserOSGetNodeStateFunction::BrowserOSGetNodeStateFunction() = default;
++BrowserOSGetNodeStateFunction::~BrowserOSGetNodeStateFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSGetNodeStateFunction::Run() {
++  std::optional<browser_os::GetNodeState::Params> params =
++      browser_os::GetNodeState::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(tab_info->web_contents);
++  if (!mappings) {
++    return RespondNow(Error("No snapshot data for this tab"));
++  }
++
++  if (std::optional<std::vector<browser_os::NodeState>> states =
++          ReadLiveNodeStates(params->node_ids, mappings->nodes)) {
++    return RespondNow(
++        ArgumentList(browser_os::GetNodeState::Results::Create(*states)));
++  }
++
++  // No live tree: fetch one now, and keep accessibility on so the next
++  // check can read the live tree instead
++  content::WebContents* web_contents = tab_info->web_contents;
++  BrowserOSSnapshotTracker::CreateForWebContents(web_contents);
++  BrowserOSSnapshotTracker::FromWebContents(web_contents)
++      ->EnsureAccessibilityEnabled();
++
++  web_contents_ = web_contents->GetWeakPtr();
++  node_ids_ = std::move(params->node_ids);
++  browseros::AXSnapshotCache::Request(
++      web_contents, GetSnapshotAXMode(SnapshotProfile::kInteractive),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
++      /* timeout= */ base::TimeDelta(),
++      browseros::AXSnapshotCache::Freshness::kRequestedAfterNow,
++      base::BindOnce(
++          &BrowserOSGetNodeStateFunction::OnAccessibilityTreeReceived, this));
++  return RespondLater();
++}
++
++void BrowserOSGetNodeStateFunction::OnAccessibilityTreeReceived(
++    browseros::SharedAXTreeUpdate snapshot) {
++  // The tab's mappings may have been dropped meanwhile
++  TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(web_contents_.get());
++  if (!mappings) {
++    Respond(Error("No snapshot data for this tab"));
++    return;
++  }
++  if (!snapshot) {
++    Respond(Error("Failed to read the accessibility tree"));
++    return;
++  }
++  Respond(ArgumentList(browser_os::GetNodeState::Results::Create(
++      ReadSnapshotNodeStates(node_ids_, mappings->nodes, snapshot->data))));
++}
++
++// Implementation of BrowserOSDiffSnapshotsFunction
++
++ExtensionFunction::ResponseAction BrowserOSDiffSnapshotsFunction::Run() {
++  std::optional<browser_os::DiffSnapshots::Params> params =
++      browser_os::DiffSnapshots::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  auto* tracker =
++      BrowserOSSnapshotTracker::FromWebContents(tab_info->web_contents);
++  if (!tracker) {
++    return RespondNow(Error("No snapshots kept for this tab"));
++  }
++
++  base::expected<browser_os::SnapshotDiff, std::string> diff =
++      tracker->DiffSnapshots(static_cast<uint32_t>(params->from_snapshot_id),
++                             static_cast<uint32_t>(params->to_snapshot_id));
++  if (!diff.has_value()) {
++    return RespondNow(Error(std::move(diff.error())));
++  }
++  return RespondNow(
++      ArgumentList(browser_os::DiffSnapshots::Results::Create(*diff)));
++}
++
++// Implementation of BrowserOSCancelRequestFunction
++
++ExtensionFunction::ResponseAction BrowserOSCancelRequestFunction::Run() {
++  std::optional<browser_os::CancelRequest::Params> params =
++      browser_os::CancelRequest::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  if (params->request_id.empty()) {
++    return RespondNow(Error("requestId must not be empty"));
++  }
++  return RespondNow(ArgumentList(browser_os::CancelRequest::Results::Create(
++      BrowserOSRequestCanceller::CancelRequest(params->request_id))));
++}
++
++// Implementation of BrowserOSInteractionFunction
++
++BrowserOSInteractionFunction::BrowserOSInteractionFunction() = default;
++BrowserOSInteractionFunction::~BrowserOSInteractionFunction() = default;
++
++std::optional<std::string> BrowserOSInteractionFunction::InitInteraction(
++    const TabInfo& tab_info,
++    const std::optional<browser_os::InteractionOptions>& options) {
++  web_contents_ = tab_info.web_contents->GetWeakPtr();
++  tab_id_ = tab_info.tab_id;
++  settle_policy_ = SettlePolicyFromOptions(options);
++  // A frozen page would never act on the input
++  BrowserOSTabBudget::Thaw(tab_info.web_contents);
++  lane_ = BrowserOSTabPriority::ResolveLane(
++      tab_info.web_contents,
++      options ? ToRequestLane(options->priority) : std::nullopt);
++
++  return_snapshot_ = options && options->return_snapshot.value_or(false);
++  if (!return_snapshot_) {
++    return std::nullopt;
++  }
++
++  const auto& snapshot_options = options->snapshot_options;
++  snapshot_options_ = ToSnapshotOptions(snapshot_options, nullptr);
++  // The returned snapshot runs in the action's lane unless it names its own
++  if (!GetRequestedLane(snapshot_options)) {
++    snapshot_options_.priority = GetTaskPriority(lane_);
++  }
++  incremental_ =
++      snapshot_options && snapshot_options->incremental.value_or(false);
++  stable_node_ids_ =
++      incremental_ ||
++      (snapshot_options && snapshot_options->stable_node_ids.value_or(false));
++  if (incremental_ && snapshot_options->base_snapshot_id) {
++    base_snapshot_id_ =
++        static_cast<uint32_t>(*snapshot_options->base_snapshot_id);
++  }
++  if (!options->quiet_period_ms) {
++    settle_policy_.quiet_period = kReturnSnapshotQuietPeriod;
++  }
++  return std::nullopt;
++}
++
++void BrowserOSInteractionFunction::ScheduleInteraction(
++    base::OnceClosure start) {
++  browseros::NotifyAgentActivity();
++  profiled_call_ = browseros::ProfiledCall(name(), start_time_, "queued");
++  profiled_call_.set_tab_id(tab_id_);
++  BrowserOSActionScheduler::GetInstance()->Enqueue(
++      tab_id_,
++      base::BindOnce(&BrowserOSInteractionFunction::OnSlotAcquired, this,
++                     std::move(start)),
++      lane_);
++}
++
++void BrowserOSInteractionFunction::OnSlotAcquired(base::OnceClosure start,
++                                                  base::OnceClosure done) {
++  action_slot_ = base::ScopedClosureRunner(std::move(done));
++  if (!web_contents_) {
++    action_slot_.RunAndReset();
++    Respond(Error("Tab was closed before the action could run"));
++    return;
++  }
++  change_recorder_ =
++      std::make_unique<BrowserOSChangeRecorder>(web_contents_.get());
++  // Input dispatch and the change-detection wait
++  profiled_call_.StartPhase("action");
++  std::move(start).Run();
++}
++
++void BrowserOSInteractionFunction::FinishInteraction(
++    browser_os::InteractionResponse response,
++    ResultsFactory create_results) {
++  // Stop recording before the snapshot, which is not part of the action
++  if (change_recorder_) {
++    response.changes = change_recorder_->ToSummary(tab_id_);
++    change_recorder_.reset();
++  }
++  pending_response_ = std::move(response);
++  create_results_ = create_results;
++
++  if (!return_snapshot_) {
++    RespondWithPendingResponse();
++    return;
++  }
++
++  content::RenderFrameHost* rfh =
++      web_contents_ ? web_contents_->GetPrimaryMainFrame() : nullptr;
++  if (!rfh || !rfh->IsRenderFrameLive()) {
++    LOG(WARNING) << "[browseros] Frame not stable after action, "
++                 << "responding without snapshot";
++    RespondWithPendingResponse();
++    return;
++  }
++
++  BrowserOSSnapshotTracker::CreateForWebContents(web_contents_.get());
++  BrowserOSSnapshotTracker* tracker =
++      BrowserOSSnapshotTracker::FromWebContents(web_contents_.get());
++  if (incremental_) {
++    tracker->EnsureAccessibilityEnabled();
++    request_generation_ = tracker->generation();
++  } else {
++    // The snapshot rebuilds this tab's node mappings, as
++    // getInteractiveSnapshot does, so any incremental base is stale afterwards
++    tracker->Invalidate();
++  }
++
++  // Must reflect the action, so never reuse an earlier snapshot
++  profiled_call_.StartPhase("ax_request");
++  browseros::AXSnapshotCache::Request(
++      web_contents_.get(),
++      GetSnapshotAXMode(SnapshotProfile::kInteractive),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
++      /* timeout= */ base::TimeDelta(),
++      browseros::AXSnapshotCache::Freshness::kRequestedAfterNow,
++      base::BindOnce(
++          &BrowserOSInteractionFunction::OnAccessibilityTreeReceived, this));
++}
++
++void BrowserOSInteractionFunction::OnAccessibilityTreeReceived(
++    browseros::SharedAXTreeUpdate snapshot) {
++  if (!web_contents_) {
++    LOG(WARNING) << "[browseros] WebContents gone during AX snapshot callback";
++    RespondWithPendingResponse();
++    return;
++  }
++
++  SnapshotProcessor::NodeIdResolver node_id_resolver;
++  if (stable_node_ids_) {
++    if (auto* tracker =
++            BrowserOSSnapshotTracker::FromWebContents(web_contents_.get())) {
++      node_id_resolver = base::BindRepeating(&NodeIdRemap::Resolve,
++                                             tracker->node_id_remap());
++    }
++  }
++
++  profiled_call_.StartPhase("processing");
++  SnapshotProcessor::ProcessAccessibilityTree(
++      snapshot,
++      tab_id_,
++      BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId(),
++      web_contents_.get(),
++      snapshot_options_,
++      base::BindOnce(&BrowserOSInteractionFunction::OnSnapshotProcessed,
++                     base::WrapRefCounted(this)),
++      std::move(node_id_resolver));
++}
++
++void BrowserOSInteractionFunction::OnSnapshotProcessed(
++    SnapshotProcessingResult result) {
++  if (incremental_ && web_contents_) {
++    if (auto* tracker =
++            BrowserOSSnapshotTracker::FromWebContents(web_contents_.get())) {
++      tracker->ApplyDelta(base_snapshot_id_, request_generation_,
++                          result.snapshot);
++    }
++  }
++  pending_response_.snapshot = std::move(result.snapshot);
++  RespondWithPendingResponse();
++}
++
++void BrowserOSInteractionFunction::RespondWithPendingResponse() {
++  // Let the next queued action on this tab start
++  action_slot_.RunAndReset();
++  RecordBrowserOSChangeDetected(name(), pending_response_.success);
++  RecordBrowserOSApiLatency(name(), base::TimeTicks::Now() - start_time_);
++  profiled_call_.Finish(true);
++  Respond(ArgumentList(create_results_(pending_response_)));
++}
++
++// Implementation of BrowserOSClickFunction
++
++ExtensionFunction::ResponseAction BrowserOSClickFunction::Run() {
++  std::optional<browser_os::Click::Params> params =
++      browser_os::Click::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  if (auto error = InitInteraction(*tab_info, params->options)) {
++    return RespondNow(Error(*error));
++  }
++
++  // Look up the AX node ID from our nodeId
++  TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(tab_info->web_contents);
++  if (!mappings) {
++    return RespondNow(Error("No snapshot data for this tab"));
++  }
++  
++  auto node_it = mappings->nodes.find(params->node_id);
++  if (node_it == mappings->nodes.end()) {
++    return RespondNow(Error("Node ID not found"));
++  }
++  
++  // Queue behind earlier actions on this tab. The node is copied so a
++  // snapshot taken meanwhile does not change what gets clicked.
++  ScheduleInteraction(base::BindOnce(&BrowserOSClickFunction::StartClick,
++                                     this, node_it->second));
++  
++  return RespondLater();
++}
++
++void BrowserOSClickFunction::StartClick(NodeInfo node_info) {
++  // Perform click with change detection; responds once the click settles
++  ClickWithDetection(
++      target_web_contents(), node_info, settle_policy(),
++      base::BindOnce(&BrowserOSClickFunction::OnClickCompleted, this));
++}
++
++void BrowserOSClickFunction::OnClickCompleted(bool change_detected) {
++  // Create interaction response
++  browser_os::InteractionResponse response;
++  response.success = change_detected;
++  
++  FinishInteraction(std::move(response),
++                    &browser_os::Click::Results::Create);
++}
++
++// Implementation of BrowserOSInputTextFunction
++
++ExtensionFunction::ResponseAction BrowserOSInputTextFunction::Run() {
++  std::optional<browser_os::InputText::Params> params =
++      browser_os::InputText::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  if (auto error = InitInteraction(*tab_info, params->options)) {
++    return RespondNow(Error(*error));
++  }
++
++  // Look up the AX node ID from our nodeId
++  TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(tab_info->web_contents);
++  if (!mappings) {
++    return RespondNow(Error("No snapshot data for this tab"));
++  }
++  
++  auto node_it = mappings->nodes.find(params->node_id);
++  if (node_it == mappings->nodes.end()) {
++    return RespondNow(Error("Node ID not found"));
++  }
++  
++  VLOG(1) << "[browseros] InputText: Starting input for nodeId: " << params->node_id;
++  
++  ScheduleInteraction(base::BindOnce(&BrowserOSInputTextFunction::StartInputText,
++                                     this, node_it->second,
++                                     std::move(params->text)));
++  
++  return RespondLater();
++}
++
++void BrowserOSInputTextFunction::StartInputText(NodeInfo node_info,
++                                                std::string text) {
++  // Use TypeWithDetection which tries both native and JavaScript methods
++  TypeWithDetection(
++      target_web_contents(), node_info, text,
++      settle_policy(),
++      base::BindOnce(&BrowserOSInputTextFunction::OnInputTextCompleted, this));
++}
++
++void BrowserOSInputTextFunction::OnInputTextCompleted(bool change_detected) {
++  if (!change_detected) {
++    LOG(WARNING) << "[browseros] InputText: No change detected after typing";
++  }
++  
++  // Create interaction response
++  browser_os::InteractionResponse response;
++  response.success = change_detected;
++  
++  FinishInteraction(std::move(response),
++                    &browser_os::InputText::Results::Create);
++}
++
++// Implementation of BrowserOSClearFunction
++
++ExtensionFunction::ResponseAction BrowserOSClearFunction::Run() {
++  std::optional<browser_os::Clear::Params> params =
++      browser_os::Clear::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  if (auto error = InitInteraction(*tab_info, params->options)) {
++    return RespondNow(Error(*error));
++  }
++
++  // Look up the AX node ID from our nodeId
++  TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(tab_info->web_contents);
++  if (!mappings) {
++    return RespondNow(Error("No snapshot data for this tab"));
++  }
++  
++  auto node_it = mappings->nodes.find(params->node_id);
++  if (node_it == mappings->nodes.end()) {
++    return RespondNow(Error("Node ID not found"));
++  }
++  
++  VLOG(1) << "[browseros] Clear: Clearing field for nodeId: " << params->node_id;
++  
++  ScheduleInteraction(base::BindOnce(&BrowserOSClearFunction::StartClear,
++                                     this, node_it->second));
++  
++  return RespondLater();
++}
++
++void BrowserOSClearFunction::StartClear(NodeInfo node_info) {
++  // Use ClearWithDetection which handles focus and clearing
++  ClearWithDetection(
++      target_web_contents(), node_info, settle_policy(),
++      base::BindOnce(&BrowserOSClearFunction::OnClearCompleted, this));
++}
++
++void BrowserOSClearFunction::OnClearCompleted(bool change_detected) {
++  if (!change_detected) {
++    LOG(WARNING) << "[browseros] Clear: No change detected after clearing";
++  }
++  
++  // Create interaction response
++  browser_os::InteractionResponse response;
++  response.success = change_detected;
++  
++  FinishInteraction(std::move(response),
++                    &browser_os::Clear::Results::Create);
++}
++
++// Implementation of BrowserOSGetPageLoadStatusFunction
++
++ExtensionFunction::ResponseAction BrowserOSGetPageLoadStatusFunction::Run() {
++  std::optional<browser_os::GetPageLoadStatus::Params> params =
++      browser_os::GetPageLoadStatus::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  content::WebContents* web_contents = tab_info->web_contents;
++  
++  // Get the primary main frame
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    return RespondNow(Error("No render frame"));
++  }
++
++  // Start reporting onPageStateChanged for this tab
++  BrowserOSPageState::CreateForWebContents(web_contents);
++
++  return RespondNow(ArgumentList(browser_os::GetPageLoadStatus::Results::Create(
++      BrowserOSPageState::GetStatus(web_contents))));
++}
++
++// Implementation of BrowserOSWaitForLoadStateFunction
++
++namespace {
++
++constexpr int kDefaultLoadStateTimeoutMs = 30000;
++constexpr int kMaxLoadStateTimeoutMs = 300000;
++
++}  // namespace
++
++BrowserOSWaitForLoadStateFunction::BrowserOSWaitForLoadStateFunction() =
++    default;
++BrowserOSWaitForLoadStateFunction::~BrowserOSWaitForLoadStateFunction() =
++    default;
++
++ExtensionFunction::ResponseAction BrowserOSWaitForLoadStateFunction::Run() {
++  std::optional<browser_os::WaitForLoadState::Params> params =
++      browser_os::WaitForLoadState::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  content::WebContents* web_contents = tab_info->web_contents;
++  int timeout_ms = params->timeout_ms.value_or(kDefaultLoadStateTimeoutMs);
++  if (timeout_ms < 0) {
++    return RespondNow(Error("timeoutMs must not be negative"));
++  }
++  timeout_ms = std::min(timeout_ms, kMaxLoadStateTimeoutMs);
++
++  web_contents_ = web_contents->GetWeakPtr();
++  BrowserOSPageState::CreateForWebContents(web_contents);
++  BrowserOSPageState::FromWebContents(web_contents)
++      ->WaitFor(params->state, base::Milliseconds(timeout_ms),
++                base::BindOnce(
++                    &BrowserOSWaitForLoadStateFunction::OnLoadStateReached,
++                    this));
++
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSWaitForLoadStateFunction::OnLoadStateReached(
++    BrowserOSPageState::WaitResult result) {
++  if (result == BrowserOSPageState::WaitResult::kTabClosed || !web_contents_) {
++    Respond(Error("Tab was closed"));
++    return;
++  }
++  if (result == BrowserOSPageState::WaitResult::kTimedOut) {
++    Respond(Error("Timed out waiting for load state"));
++    return;
++  }
++  Respond(ArgumentList(browser_os::WaitForLoadState::Results::Create(
++      BrowserOSPageState::GetStatus(web_contents_.get()))));
++}
++
++// Implementation of BrowserOSScrollPageFunction
++
++BrowserOSScrollPageFunction::BrowserOSScrollPageFunction() = default;
++BrowserOSScrollPageFunction::~BrowserOSScrollPageFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSScrollPageFunction::RunScroll(
++    std::optional<int> tab_id,
++    const std::optional<browser_os::InteractionOptions>& options,
++    bool down,
++    ResultsFactory create_results) {
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  if (auto error = InitInteraction(*tab_info, options)) {
++    return RespondNow(Error(*error));
++  }
++  down_ = down;
++  scroll_results_ = create_results;
++
++  ScheduleInteraction(
++      base::BindOnce(&BrowserOSScrollPageFunction::StartScroll, this));
++  // Responds synchronously if there is no view to scroll
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSScrollPageFunction::StartScroll() {
++  // Note where the page is first, so the stored bounds can follow the scroll
++  if (!ReadViewportState(
++          target_web_contents(),
++          base::BindOnce(&BrowserOSScrollPageFunction::OnStartStateRead,
++                         this))) {
++    OnStartStateRead(base::Value());
++  }
++}
++
++void BrowserOSScrollPageFunction::OnStartStateRead(base::Value result) {
++  content::WebContents* web_contents = target_web_contents();
++  TrackScrollOffset(web_contents, target_tab_id(), result);
++
++  // Scroll by approximately one page
++  if (!web_contents || !ScrollByPage(web_contents, down_)) {
++    LOG(WARNING) << "[browseros] No render widget host view to scroll";
++    OnViewportStateRead(base::Value());
++    return;
++  }
++  
++  // Wait for the scroll to come to rest instead of returning right after the
++  // wheel event; no scroll activity at all means the page could not move
++  BrowserOSActionWaiter::Wait(
++      web_contents, BrowserOSActionWaiter::Condition::kScrollSettled,
++      kScrollEndTimeout,
++      base::BindOnce(&BrowserOSScrollPageFunction::OnScrollSettled, this));
++}
++
++void BrowserOSScrollPageFunction::OnScrollSettled(bool scrolled) {
++  scrolled_ = scrolled;
++  VLOG(1) << "[browseros] Scroll " << (down_ ? "down" : "up")
++          << (scrolled ? " settled" : " had no effect");
++
++  if (!ReadViewportState(
++          target_web_contents(),
++          base::BindOnce(&BrowserOSScrollPageFunction::OnViewportStateRead,
++                         this))) {
++    OnViewportStateRead(base::Value());
++  }
++}
++
++void BrowserOSScrollPageFunction::OnViewportStateRead(base::Value result) {
++  TrackScrollOffset(target_web_contents(), target_tab_id(), result);
++
++  browser_os::InteractionResponse response;
++  response.success = scrolled_;
++  response.viewport = ParseViewportState(result);
++  
++  FinishInteraction(std::move(response), scroll_results_);
++}
++
++// Implementation of BrowserOSScrollUpFunction
++
++ExtensionFunction::ResponseAction BrowserOSScrollUpFunction::Run() {
++  std::optional<browser_os::ScrollUp::Params> params =
++      browser_os::ScrollUp::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  return RunScroll(params->tab_id, params->options, /*down=*/false,
++                   &browser_os::ScrollUp::Results::Create);
++}
++
++// Implementation of BrowserOSScrollDownFunction
++
++ExtensionFunction::ResponseAction BrowserOSScrollDownFunction::Run() {
++  std::optional<browser_os::ScrollDown::Params> params =
++      browser_os::ScrollDown::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  return RunScroll(params->tab_id, params->options, /*down=*/true,
++                   &browser_os::ScrollDown::Results::Create);
++}
++
++// Implementation of BrowserOSScrollToNodeFunction
++
++ExtensionFunction::ResponseAction BrowserOSScrollToNodeFunction::Run() {
++  std::optional<browser_os::ScrollToNode::Params> params =
++      browser_os::ScrollToNode::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  content::WebContents* web_contents = tab_info->web_contents;
++  int tab_id = tab_info->tab_id;
++  
++  // Look up the AX node ID from our nodeId
++  TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(web_contents);
++  if (!mappings) {
++    return RespondNow(Error("No snapshot data for this tab"));
++  }
++  
++  auto node_it = mappings->nodes.find(params->node_id);
++  if (node_it == mappings->nodes.end()) {
++    return RespondNow(Error("Node ID not found"));
++  }
++  
++  const NodeInfo& node_info = node_it->second;
++  
++  // Get viewport bounds to check if node is already in view
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    return RespondNow(Error("No render frame"));
++  }
++  
++  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
++  if (!rwh) {
++    return RespondNow(Error("No render widget host"));
++  }
++  
++  content::RenderWidgetHostView* rwhv = rwh->GetView();
++  if (!rwhv) {
++    return RespondNow(Error("No render widget host view"));
++  }
++  
++  gfx::Rect viewport_bounds = rwhv->GetViewBounds();
++  
++  // Check if the node is already visible in the viewport
++  // We consider it visible if any part of it is within the viewport
++  bool is_in_view = false;
++  if (node_info.bounds.y() < viewport_bounds.height() && 
++      node_info.bounds.bottom() > 0 &&
++      node_info.bounds.x() < viewport_bounds.width() &&
++      node_info.bounds.right() > 0) {
++    is_in_view = true;
++  }
++  
++  if (is_in_view) {
++    return RespondNow(ArgumentList(
++        browser_os::ScrollToNode::Results::Create(false)));
++  }
++  
++  web_contents_ = web_contents->GetWeakPtr();
++  tab_id_ = tab_id;
++  node_id_ = params->node_id;
++
++  // Note where the page is first, so the stored bounds can follow the scroll
++  if (!ReadViewportState(
++          web_contents,
++          base::BindOnce(&BrowserOSScrollToNodeFunction::OnStartStateRead,
++                         this))) {
++    OnStartStateRead(base::Value());
++  }
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSScrollToNodeFunction::OnStartStateRead(base::Value result) {
++  if (!web_contents_) {
++    Respond(Error("Tab was closed"));
++    return;
++  }
++  TrackScrollOffset(web_contents_.get(), tab_id_, result);
++
++  // Mappings may have been replaced by a snapshot meanwhile
++  std::string error;
++  const NodeInfo* node_info =
++      FindNodeInfo(web_contents_.get(), node_id_, &error);
++  if (!node_info) {
++    Respond(Error(error));
++    return;
++  }
++
++  // Scroll via accessibility and respond once the scroll has settled
++  ScrollNodeIntoView(
++      web_contents_.get(), *node_info,
++      base::BindOnce(&BrowserOSScrollToNodeFunction::OnScrollSettled, this));
++}
++
++void BrowserOSScrollToNodeFunction::OnScrollSettled() {
++  if (!ReadViewportState(
++          web_contents_.get(),
++          base::BindOnce(&BrowserOSScrollToNodeFunction::OnViewportStateRead,
++                         this))) {
++    OnViewportStateRead(base::Value());
++  }
++}
++
++void BrowserOSScrollToNodeFunction::OnViewportStateRead(base::Value result) {
++  TrackScrollOffset(web_contents_.get(), tab_id_, result);
++  Respond(ArgumentList(browser_os::ScrollToNode::Results::Create(true)));
++}
++
++// Implementation of BrowserOSSendKeysFunction
++
++ExtensionFunction::ResponseAction BrowserOSSendKeysFunction::Run() {
++  std::optional<browser_os::SendKeys::Params> params =
++      browser_os::SendKeys::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  if (auto error = InitInteraction(*tab_info, params->options)) {
++    return RespondNow(Error(*error));
++  }
++  
++  // Validate the key
++  if (!IsSupportedKey(params->key)) {
++    return RespondNow(Error("Unsupported key: " + params->key));
++  }
++  
++  VLOG(1) << "[browseros] SendKeys: Sending key '" << params->key << "'";
++  
++  ScheduleInteraction(base::BindOnce(&BrowserOSSendKeysFunction::StartSendKeys,
++                                     this, std::move(params->key)));
++  
++  return RespondLater();
++}
++
++void BrowserOSSendKeysFunction::StartSendKeys(std::string key) {
++  // Send the key with change detection
++  KeyPressWithDetection(
++      target_web_contents(), key, settle_policy(),
++      base::BindOnce(&BrowserOSSendKeysFunction::OnSendKeysCompleted, this));
++}
++
++void BrowserOSSendKeysFunction::OnSendKeysCompleted(bool change_detected) {
++  if (!change_detected) {
++    LOG(WARNING) << "[browseros] SendKeys: No change detected after key press";
++  }
++  
++  // Create interaction response
++  browser_os::InteractionResponse response;
++  response.success = change_detected;
++  
++  FinishInteraction(std::move(response),
++                    &browser_os::SendKeys::Results::Create);
++}
++
++// Implementation of BrowserOSCaptureScreenshotFunction
++
++namespace {
++
++// Copies of a hidden tab retried while it produces its first frame
++constexpr int kMaxHiddenTabCaptureAttempts = 5;
++constexpr base::TimeDelta kHiddenTabCaptureRetryDelay =
++    base::Milliseconds(100);
++
++}  // namespace
++
++BrowserOSCaptureScreenshotFunction::BrowserOSCaptureScreenshotFunction() = default;
++BrowserOSCaptureScreenshotFunction::~BrowserOSCaptureScreenshotFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSCaptureScreenshotFunction::Run() {
++  std::optional<browser_os::CaptureScreenshot::Params> params =
++      browser_os::CaptureScreenshot::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  return StartCapture(params->tab_id, params->thumbnail_size,
++                      params->show_highlights, params->width, params->height,
++                      params->options);
++}
++
++ExtensionFunction::ResponseAction
++BrowserOSCaptureScreenshotFunction::StartCapture(
++    std::optional<int> tab_id,
++    std::optional<int> thumbnail_size,
++    std::optional<bool> show_highlights,
++    std::optional<int> width,
++    std::optional<int> height,
++    const std::optional<browser_os::ScreenshotOptions>& options) {
++  profiled_call_ = browseros::ProfiledCall(name(), start_time_, "dispatch");
++  // Store whether to show highlights
++  show_highlights_ = show_highlights.value_or(false);
++
++  if (options) {
++    if (options->format != browser_os::ImageFormat::kNone) {
++      format_ = options->format;
++    }
++    if (options->quality) {
++      quality_ = std::clamp(*options->quality, 0, 100);
++    }
++  }
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  content::WebContents* web_contents = tab_info->web_contents;
++  web_contents_ = web_contents->GetWeakPtr();
++  tab_id_ = tab_info->tab_id;
++  cancellation_ = BrowserOSRequestCanceller::Track(
++      web_contents, options ? options->request_id.value_or("") : "");
++  task_priority_ = GetTaskPriority(BrowserOSTabPriority::ResolveLane(
++      web_contents, options ? ToRequestLane(options->priority) : std::nullopt));
++  
++  // Get the render widget host view
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    return RespondNow(Error("No render frame"));
++  }
++  
++  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
++  if (!rwh) {
++    return RespondNow(Error("No render widget host"));
++  }
++  
++  content::RenderWidgetHostView* rwhv = rwh->GetView();
++  if (!rwhv) {
++    return RespondNow(Error("No render widget host view"));
++  }
++  
++  // Get the view bounds to determine the size
++  gfx::Rect view_bounds = rwhv->GetViewBounds();
++
++  // Region captures crop on the GPU: the CSS rect is mapped to view DIPs and
++  // passed to CopyFromSurface as the source rect
++  source_rect_ = gfx::Rect();
++  const bool full_page = options && options->full_page.value_or(false);
++  if (options && (options->node_id || options->rect)) {
++    if (options->node_id && options->rect) {
++      return RespondNow(Error("Specify either nodeId or rect, not both"));
++    }
++    if (full_page) {
++      return RespondNow(Error("fullPage cannot be combined with a region"));
++    }
++
++    gfx::RectF css_rect;
++    if (options->node_id) {
++      const NodeInfo* node_info =
++          FindNodeInfo(web_contents, *options->node_id, &error_message);
++      if (!node_info) {
++        return RespondNow(Error(error_message));
++      }
++      css_rect = node_info->bounds;
++    } else {
++      css_rect = gfx::RectF(options->rect->x, options->rect->y,
++                            options->rect->width, options->rect->height);
++    }
++
++    source_rect_ = gfx::ToEnclosingRect(
++        gfx::ScaleRect(css_rect, CssToWidgetScale(web_contents, rwh)));
++    source_rect_.Intersect(gfx::Rect(view_bounds.size()));
++    if (source_rect_.IsEmpty()) {
++      return RespondNow(Error(
++          "Capture region is outside the viewport; scroll it into view"));
++    }
++    VLOG(1) << "[browseros] CaptureScreenshot: Cropping to "
++            << source_rect_.ToString();
++  }
++  const gfx::Size source_size =
++      source_rect_.IsEmpty() ? view_bounds.size() : source_rect_.size();
++
++  const browser_os::ScreenshotFit fit =
++      options ? options->fit : browser_os::ScreenshotFit::kNone;
++  if (fit != browser_os::ScreenshotFit::kNone) {
++    if (!width || !height || *width <= 0 || *height <= 0) {
++      return RespondNow(Error("fit needs a positive width and height"));
++    }
++    if (full_page) {
++      return RespondNow(Error("fit cannot be combined with fullPage"));
++    }
++  }
++  output_size_ = gfx::Size();
++
++  // Check if exact width and height are specified
++  if (width && height) {
++    use_exact_dimensions_ = true;
++    target_size_ = gfx::Size(static_cast<int>(*width), 
++                            static_cast<int>(*height));
++    const gfx::Rect area = source_rect_.IsEmpty()
++                               ? gfx::Rect(view_bounds.size())
++                               : source_rect_;
++    switch (fit) {
++      case browser_os::ScreenshotFit::kNone:
++      case browser_os::ScreenshotFit::kFill:
++        // Each axis scales on its own
++        break;
++      case browser_os::ScreenshotFit::kContain:
++        // The readback scales the whole area into the size; encoding pads
++        // it out to the exact size
++        output_size_ = target_size_;
++        target_size_ = FitInside(area.size(), output_size_);
++        break;
++      case browser_os::ScreenshotFit::kCover:
++        // The readback crops the area to the size's aspect ratio
++        source_rect_ = area;
++        source_rect_.ClampToCenteredSize(
++            CropToAspectRatio(area.size(), target_size_));
++        break;
++    }
++    VLOG(1) << "[browseros] CaptureScreenshot: Using exact dimensions: "
++            << target_size_.width() << "x" << target_size_.height() << " ("
++            << browser_os::ToString(fit) << ")";
++  } else {
++    // Fall back to original behavior with thumbnailSize
++    use_exact_dimensions_ = false;
++    
++    // Determine max thumbnail size
++    // If thumbnailSize is provided, use minimum of it and viewport dimensions
++    // Otherwise, use viewport size (no scaling)
++    int max_dimension;
++    if (thumbnail_size) {
++      // Take minimum of requested size and viewport dimensions
++      int viewport_max = std::max(source_size.width(), source_size.height());
++      max_dimension = std::min(static_cast<int>(*thumbnail_size), viewport_max);
++      VLOG(1) << "[browseros] CaptureScreenshot: Using thumbnail size: " << max_dimension 
++              << " (requested: " << *thumbnail_size 
++              << ", viewport max: " << viewport_max << ")";
++    } else {
++      // No thumbnail size specified, use viewport dimensions
++      max_dimension = std::max(source_size.width(), source_size.height());
++      VLOG(1) << "[browseros] CaptureScreenshot: Using viewport size: " << max_dimension;
++    }
++    
++    gfx::Size scaled_size = source_size;
++    
++    // Scale down proportionally if needed
++    if (scaled_size.width() > max_dimension || 
++        scaled_size.height() > max_dimension) {
++      float scale = std::min(
++          static_cast<float>(max_dimension) / scaled_size.width(),
++          static_cast<float>(max_dimension) / scaled_size.height());
++      scaled_size = gfx::ScaleToFlooredSize(scaled_size, scale);
++    }
++    
++    target_size_ = scaled_size;
++  }
++  
++  rendering_hold_ = BrowserOSBackgroundRendering::HoldIfHidden(web_contents);
++  full_page_ = full_page;
++  if (full_page) {
++    // Highlight bounds are viewport-relative, so they only fit the top tile
++    show_highlights_ = false;
++  }
++
++  // Bounds how many bitmaps agents make the browser hold at once
++  profiled_call_.set_tab_id(tab_id_);
++  profiled_call_.StartPhase("admission");
++  if (!BrowserOSCallLimiter::GetInstance()->Admit(
++          extension_id(), tab_id_,
++          base::BindOnce(&BrowserOSCaptureScreenshotFunction::OnCallAdmitted,
++                         this))) {
++    return RespondNow(Error(kTooManyHeavyCallsError));
++  }
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSCaptureScreenshotFunction::OnCallAdmitted(
++    base::ScopedClosureRunner slot) {
++  call_slot_ = std::move(slot);
++  if (full_page_) {
++    VLOG(1) << "[browseros] CaptureScreenshot: Capturing full page";
++    // Scrolling through the page must not interleave with interactions
++    profiled_call_.StartPhase("queued");
++    BrowserOSActionScheduler::GetInstance()->Enqueue(
++        tab_id_,
++        base::BindOnce(
++            &BrowserOSCaptureScreenshotFunction::StartFullPageCapture, this));
++    return;
++  }
++
++  // Highlights are drawn onto the captured bitmap, so there is nothing to
++  // wait for before capturing
++  CaptureScreenshotNow();
++}
++
++void BrowserOSCaptureScreenshotFunction::StartFullPageCapture(
++    base::OnceClosure done) {
++  full_page_slot_ = base::ScopedClosureRunner(std::move(done));
++
++  content::WebContents* web_contents = web_contents_.get();
++  if (!web_contents) {
++    full_page_slot_.RunAndReset();
++    Respond(Error("Tab was closed before the capture could run"));
++    return;
++  }
++  if (IsRequestCancelled(cancellation_.get())) {
++    full_page_slot_.RunAndReset();
++    Respond(Error(kRequestCancelledError));
++    return;
++  }
++
++  profiled_call_.StartPhase("capture");
++  full_page_capture_ = std::make_unique<BrowserOSFullPageCapture>(
++      web_contents, target_size_, cancellation_);
++  full_page_capture_->Start(
++      base::BindOnce(&BrowserOSCaptureScreenshotFunction::OnFullPageCaptured,
++                     this));
++}
++
++void BrowserOSCaptureScreenshotFunction::OnFullPageCaptured(
++    const SkBitmap& bitmap) {
++  full_page_capture_.reset();
++  full_page_slot_.RunAndReset();
++  OnScreenshotCaptured(bitmap);
++}
++
++void BrowserOSCaptureScreenshotFunction::CaptureScreenshotNow() {
++  content::WebContents* web_contents = web_contents_.get();
++  if (!web_contents) {
++    Respond(Error("Web contents destroyed"));
++    return;
++  }
++  if (IsRequestCancelled(cancellation_.get())) {
++    Respond(Error(kRequestCancelledError));
++    return;
++  }
++
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    Respond(Error("No render frame"));
++    return;
++  }
++  
++  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
++  if (!rwh) {
++    Respond(Error("No render widget host"));
++    return;
++  }
++  
++  content::RenderWidgetHostImpl* rwhi = 
++      static_cast<content::RenderWidgetHostImpl*>(rwh);
++  content::RenderWidgetHostView* view = rwhi->GetView();
++  if (!view) {
++    Respond(Error("No render widget host view"));
++    return;
++  }
++  
++  view_size_ = view->GetViewBounds().size();
++  css_to_widget_scale_ = CssToWidgetScale(web_contents, rwh);
++
++  // Retries stay in the first attempt's phase
++  if (capture_attempts_ == 0) {
++    profiled_call_.set_tab_id(tab_id_);
++    profiled_call_.StartPhase("capture");
++  }
++
++  // Request the screenshot
++  view->CopyFromSurface(
++      source_rect_,  // Empty rect means copy entire surface
++      target_size_,
++      base::BindOnce(&BrowserOSCaptureScreenshotFunction::OnScreenshotCaptured,
++                     this));
++}
++
++void BrowserOSCaptureScreenshotFunction::OnScreenshotCaptured(
++    const SkBitmap& bitmap) {
++  if (IsRequestCancelled(cancellation_.get())) {
++    rendering_hold_.RunAndReset();
++    Respond(Error(kRequestCancelledError));
++    return;
++  }
++
++  // A tab that was just made to render has no frame for the first copies
++  if (bitmap.empty() && rendering_hold_ &&
++      ++capture_attempts_ < kMaxHiddenTabCaptureAttempts) {
++    base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++        FROM_HERE,
++        base::BindOnce(&BrowserOSCaptureScreenshotFunction::CaptureScreenshotNow,
++                       this),
++        kHiddenTabCaptureRetryDelay);
++    return;
++  }
++  rendering_hold_.RunAndReset();
++  if (bitmap.empty()) {
++    Respond(Error("Failed to capture screenshot"));
++    return;
++  }
++
++  // Boxes are drawn onto the bitmap with the encoding, using the bounds of
++  // the tab's latest snapshot; the page itself is never touched
++  std::vector<ScreenshotHighlight> highlights;
++  gfx::Vector2dF css_to_bitmap;
++  if (show_highlights_) {
++    if (TabNodeMappings* mappings =
++            BrowserOSNodeMappingStore::FindForTab(web_contents_.get())) {
++      highlights = CollectScreenshotHighlights(mappings->nodes);
++    }
++    const gfx::Rect captured_area =
++        source_rect_.IsEmpty() ? gfx::Rect(view_size_) : source_rect_;
++    if (!captured_area.IsEmpty() && css_to_widget_scale_ > 0) {
++      css_to_bitmap.set_x(css_to_widget_scale_ * bitmap.width() /
++                          captured_area.width());
++      css_to_bitmap.set_y(css_to_widget_scale_ * bitmap.height() /
++                          captured_area.height());
++      // Make the boxes relative to the cropped region
++      const gfx::Vector2dF css_origin(
++          captured_area.x() / css_to_widget_scale_,
++          captured_area.y() / css_to_widget_scale_);
++      for (auto& highlight : highlights) {
++        highlight.bounds.Offset(-css_origin);
++      }
++      // And then to the letterboxed bitmap
++      if (!output_size_.IsEmpty()) {
++        const gfx::Vector2d letterbox = GetLetterboxOffset(
++            gfx::Size(bitmap.width(), bitmap.height()), output_size_);
++        const gfx::Vector2dF css_letterbox(letterbox.x() / css_to_bitmap.x(),
++                                           letterbox.y() / css_to_bitmap.y());
++        for (auto& highlight : highlights) {
++          highlight.bounds.Offset(css_letterbox);
++        }
++      }
++    }
++    VLOG(1) << "[browseros] Drawing " << highlights.size()
++            << " highlights onto screenshot";
++  }
++  
++  // Hash the pixels off the UI thread; an unchanged page with the same
++  // options can reuse the last encoding
++  profiled_call_.StartPhase("hashing");
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {task_priority_, base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&HashScreenshotPixels, bitmap),
++      base::BindOnce(&BrowserOSCaptureScreenshotFunction::OnScreenshotHashed,
++                     this, bitmap, std::move(highlights), css_to_bitmap));
++}
++
++void BrowserOSCaptureScreenshotFunction::OnScreenshotHashed(
++    const SkBitmap& bitmap,
++    std::vector<ScreenshotHighlight> highlights,
++    const gfx::Vector2dF& css_to_bitmap,
++    uint32_t pixel_hash) {
++  if (IsRequestCancelled(cancellation_.get())) {
++    Respond(Error(kRequestCancelledError));
++    return;
++  }
++
++  cache_key_.pixel_hash = pixel_hash;
++  cache_key_.width = bitmap.width();
++  cache_key_.height = bitmap.height();
++  cache_key_.output_size = output_size_;
++  cache_key_.highlights = highlights;
++  cache_key_.css_to_bitmap = css_to_bitmap;
++  cache_key_.format = format_;
++  cache_key_.quality = quality_;
++  cache_key_.as_data_url = WantsDataUrl();
++
++  if (web_contents_) {
++    if (auto* cache =
++            BrowserOSScreenshotCache::FromWebContents(web_contents_.get())) {
++      if (std::optional<EncodedScreenshot> cached = cache->Lookup(cache_key_)) {
++        VLOG(1) << "[browseros] CaptureScreenshot: Page unchanged, reusing "
++                << "cached " << cached->mime_type;
++        profiled_call_.Finish(true);
++        Respond(ArgumentList(CreateResults(std::move(*cached))));
++        return;
++      }
++    }
++  }
++
++  // Annotate, encode and base64 off the UI thread
++  profiled_call_.StartPhase("encoding");
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {task_priority_, base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&EncodeScreenshot, bitmap, output_size_,
++                     std::move(highlights), css_to_bitmap, format_, quality_,
++                     WantsDataUrl(),
++                     cancellation_),
++      base::BindOnce(&BrowserOSCaptureScreenshotFunction::OnScreenshotEncoded,
++                     this));
++}
++
++void BrowserOSCaptureScreenshotFunction::OnScreenshotEncoded(
++    std::optional<EncodedScreenshot> screenshot) {
++  if (!screenshot) {
++    Respond(Error(IsRequestCancelled(cancellation_.get())
++                      ? kRequestCancelledError
++                      : "Failed to encode screenshot"));
++    return;
++  }
++
++  if (web_contents_) {
++    BrowserOSScreenshotCache::CreateForWebContents(web_contents_.get());
++    BrowserOSScreenshotCache::FromWebContents(web_contents_.get())
++        ->Store(cache_key_, *screenshot);
++  }
++
++  RecordBrowserOSScreenshotSize(name(), screenshot->bytes.empty()
++                                            ? screenshot->data_url.size()
++                                            : screenshot->bytes.size());
++  RecordBrowserOSApiLatency(name(), base::TimeTicks::Now() - start_time_);
++  profiled_call_.Finish(true);
++  Respond(ArgumentList(CreateResults(std::move(*screenshot))));
++}
++
++void BrowserOSCaptureScreenshotFunction::OnBrowserContextShutdown() {
++  if (cancellation_) {
++    cancellation_->Cancel();
++  }
++}
++
++bool BrowserOSCaptureScreenshotFunction::WantsDataUrl() const {
++  return true;
++}
++
++base::Value::List BrowserOSCaptureScreenshotFunction::CreateResults(
++    EncodedScreenshot screenshot) {
++  return browser_os::CaptureScreenshot::Results::Create(screenshot.data_url);
++}
++
++// Implementation of BrowserOSCaptureScreenshotBinaryFunction
++
++ExtensionFunction::ResponseAction
++BrowserOSCaptureScreenshotBinaryFunction::Run() {
++  std::optional<browser_os::CaptureScreenshotBinary::Params> params =
++      browser_os::CaptureScreenshotBinary::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  return StartCapture(params->tab_id, params->thumbnail_size,
++                      params->show_highlights, params->width, params->height,
++                      params->options);
++}
++
++bool BrowserOSCaptureScreenshotBinaryFunction::WantsDataUrl() const {
++  return false;
++}
++
++base::Value::List BrowserOSCaptureScreenshotBinaryFunction::CreateResults(
++    EncodedScreenshot screenshot) {
++  browser_os::ScreenshotData data;
++  data.data = std::move(screenshot.bytes);
++  data.mime_type = std::move(screenshot.mime_type);
++  data.width = screenshot.width;
++  data.height = screenshot.height;
++  return browser_os::CaptureScreenshotBinary::Results::Create(data);
++}
++
++// Implementation of BrowserOSCapturePageStateFunction
++
++namespace {
++
++// Captures taken before a pair that changed in between is returned as is
++constexpr uint32_t kMaxPageCaptureAttempts = 3;
++
++// |view_size| scaled down to fit |thumbnail_size| on its longest side
++gfx::Size FitToThumbnail(const gfx::Size& view_size,
++                         std::optional<int> thumbnail_size) {
++  const int longest = std::max(view_size.width(), view_size.height());
++  if (!thumbnail_size || *thumbnail_size <= 0 || *thumbnail_size >= longest) {
++    return view_size;
++  }
++  return gfx::ScaleToFlooredSize(
++      view_size, static_cast<float>(*thumbnail_size) / longest);
++}
++
++}  // namespace
++
++BrowserOSCapturePageStateFunction::BrowserOSCapturePageStateFunction() =
++    default;
++BrowserOSCapturePageStateFunction::~BrowserOSCapturePageStateFunction() =
++    default;
++
++ExtensionFunction::ResponseAction BrowserOSCapturePageStateFunction::Run() {
++  std::optional<browser_os::CapturePageState::Params> params =
++      browser_os::CapturePageState::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++  browseros::NotifyAgentActivity();
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  std::optional<browser_os::InteractiveSnapshotOptions> snapshot_options;
++  std::optional<browser_os::ScreenshotOptions> screenshot_options;
++  if (params->options) {
++    snapshot_options = std::move(params->options->snapshot);
++    screenshot_options = std::move(params->options->screenshot);
++    thumbnail_size_ = params->options->thumbnail_size;
++    show_highlights_ = params->options->show_highlights.value_or(false);
++  }
++  if (snapshot_options && (snapshot_options->incremental.value_or(false) ||
++                           snapshot_options->wire_format)) {
++    return RespondNow(
++        Error("incremental and wireFormat are not supported here"));
++  }
++  stable_node_ids_ =
++      snapshot_options && snapshot_options->stable_node_ids.value_or(false);
++  std::optional<RequestLane> requested_lane;
++  std::string request_id;
++  if (screenshot_options) {
++    if (screenshot_options->node_id || screenshot_options->rect ||
++        screenshot_options->full_page.value_or(false) ||
++        screenshot_options->fit != browser_os::ScreenshotFit::kNone) {
++      return RespondNow(
++          Error("nodeId, rect, fullPage and fit are not supported here"));
++    }
++    if (screenshot_options->format != browser_os::ImageFormat::kNone) {
++      format_ = screenshot_options->format;
++    }
++    if (screenshot_options->quality) {
++      quality_ = std::clamp(*screenshot_options->quality, 0, 100);
++    }
++    requested_lane = ToRequestLane(screenshot_options->priority);
++    request_id = screenshot_options->request_id.value_or("");
++  }
++
++  content::WebContents* web_contents = tab_info->web_contents;
++  web_contents_ = web_contents->GetWeakPtr();
++  tab_id_ = tab_info->tab_id;
++  const RequestLane lane =
++      BrowserOSTabPriority::ResolveLane(web_contents, requested_lane);
++  task_priority_ = GetTaskPriority(lane);
++  snapshot_options_ = ToSnapshotOptions(snapshot_options, web_contents);
++  if (!snapshot_options || !GetRequestedLane(snapshot_options)) {
++    snapshot_options_.priority = task_priority_;
++  }
++  cancellation_ = BrowserOSRequestCanceller::Track(web_contents, request_id);
++  snapshot_options_.cancellation = cancellation_;
++
++  // Change events only arrive while accessibility stays enabled
++  BrowserOSSnapshotTracker::CreateForWebContents(web_contents);
++  BrowserOSSnapshotTracker::FromWebContents(web_contents)
++      ->EnsureAccessibilityEnabled();
++  rendering_hold_ = BrowserOSBackgroundRendering::HoldIfHidden(web_contents);
++
++  lane_ = lane;
++
++  // Bounds how many trees and bitmaps agents make the browser hold at once
++  profiled_call_ = browseros::ProfiledCall(name(), start_time_, "admission");
++  profiled_call_.set_tab_id(tab_id_);
++  if (!BrowserOSCallLimiter::GetInstance()->Admit(
++          extension_id(), tab_id_,
++          base::BindOnce(&BrowserOSCapturePageStateFunction::OnCallAdmitted,
++                         this))) {
++    return RespondNow(Error(kTooManyHeavyCallsError));
++  }
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSCapturePageStateFunction::OnCallAdmitted(
++    base::ScopedClosureRunner slot) {
++  call_slot_ = std::move(slot);
++  profiled_call_.StartPhase("queued");
++  BrowserOSActionScheduler::GetInstance()->Enqueue(
++      tab_id_,
++      base::BindOnce(&BrowserOSCapturePageStateFunction::OnSlotAcquired, this),
++      lane_);
++}
++
++void BrowserOSCapturePageStateFunction::OnSlotAcquired(
++    base::OnceClosure done) {
++  action_slot_ = base::ScopedClosureRunner(std::move(done));
++  // Snapshot and screenshot run side by side, so a single phase
++  profiled_call_.StartPhase("capture");
++  StartAttempt();
++}
++
++void BrowserOSCapturePageStateFunction::StartAttempt() {
++  content::WebContents* web_contents = web_contents_.get();
++  if (!web_contents) {
++    Fail("Tab was closed");
++    return;
++  }
++  if (IsRequestCancelled(cancellation_.get())) {
++    Fail(kRequestCancelledError);
++    return;
++  }
++  content::RenderWidgetHostView* view =
++      web_contents->GetRenderWidgetHostView();
++  if (!view) {
++    Fail("No render widget host view");
++    return;
++  }
++
++  ++attempt_;
++  copy_attempts_ = 0;
++  snapshot_.reset();
++  bitmap_.reset();
++  screenshot_.reset();
++  view_size_ = view->GetViewBounds().size();
++  css_to_widget_scale_ =
++      CssToWidgetScale(web_contents, view->GetRenderWidgetHost());
++
++  // A full snapshot rebuilds the tab's node mappings
++  BrowserOSSnapshotTracker* tracker =
++      BrowserOSSnapshotTracker::FromWebContents(web_contents);
++  tracker->Invalidate();
++  request_generation_ = tracker->generation();
++
++  // Requested back to back in one task, so both reflect the same frame
++  browseros::AXSnapshotCache::Request(
++      web_contents, GetSnapshotAXMode(SnapshotProfile::kInteractive),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
++      /* timeout= */ base::TimeDelta(),
++      browseros::AXSnapshotCache::Freshness::kRequestedAfterNow,
++      base::BindOnce(
++          &BrowserOSCapturePageStateFunction::OnAccessibilityTreeReceived,
++          this, attempt_));
++  CopySurface();
++}
++
++void BrowserOSCapturePageStateFunction::CopySurface() {
++  content::RenderWidgetHostView* view =
++      web_contents_ ? web_contents_->GetRenderWidgetHostView() : nullptr;
++  if (!view) {
++    Fail("No render widget host view");
++    return;
++  }
++  view->CopyFromSurface(
++      gfx::Rect(), FitToThumbnail(view_size_, thumbnail_size_),
++      base::BindOnce(&BrowserOSCapturePageStateFunction::OnScreenshotCaptured,
++                     this, attempt_));
++}
++
++void BrowserOSCapturePageStateFunction::OnAccessibilityTreeReceived(
++    uint32_t attempt,
++    browseros::SharedAXTreeUpdate snapshot) {
++  if (attempt != attempt_ || did_respond()) {
++    return;
++  }
++  if (!web_contents_) {
++    Fail("Tab was closed");
++    return;
++  }
++
++  SnapshotProcessor::NodeIdResolver node_id_resolver;
++  if (stable_node_ids_) {
++    if (auto* tracker =
++            BrowserOSSnapshotTracker::FromWebContents(web_contents_.get())) {
++      node_id_resolver = base::BindRepeating(&NodeIdRemap::Resolve,
++                                             tracker->node_id_remap());
++    }
++  }
++  SnapshotProcessor::ProcessAccessibilityTree(
++      snapshot, tab_id_,
++      BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId(),
++      web_contents_.get(), snapshot_options_,
++      base::BindOnce(&BrowserOSCapturePageStateFunction::OnSnapshotProcessed,
++                     this, attempt),
++      std::move(node_id_resolver));
++}
++
++void BrowserOSCapturePageStateFunction::OnSnapshotProcessed(
++    uint32_t attempt,
++    SnapshotProcessingResult result) {
++  if (attempt != attempt_ || did_respond()) {
++    return;
++  }
++  if (result.cancelled) {
++    Fail(kRequestCancelledError);
++    return;
++  }
++  snapshot_ = std::move(result.snapshot);
++  // Highlights label the nodes of this snapshot, so encoding waited for it
++  if (show_highlights_ && !bitmap_.empty()) {
++    EncodeBitmap();
++  }
++  MaybeFinish();
++}
++
++void BrowserOSCapturePageStateFunction::OnScreenshotCaptured(
++    uint32_t attempt,
++    const SkBitmap& bitmap) {
++  if (attempt != attempt_ || did_respond()) {
++    return;
++  }
++  if (IsRequestCancelled(cancellation_.get())) {
++    Fail(kRequestCancelledError);
++    return;
++  }
++  // A tab that was just made to render has no frame for the first copies
++  if (bitmap.empty() && rendering_hold_ &&
++      ++copy_attempts_ < kMaxHiddenTabCaptureAttempts) {
++    base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++        FROM_HERE,
++        base::BindOnce(&BrowserOSCapturePageStateFunction::CopySurface, this),
++        kHiddenTabCaptureRetryDelay);
++    return;
++  }
++  if (bitmap.empty()) {
++    Fail("Failed to capture screenshot");
++    return;
++  }
++
++  bitmap_ = bitmap;
++  // Without highlights the encoding runs alongside the snapshot processing
++  if (!show_highlights_ || snapshot_) {
++    EncodeBitmap();
++  }
++}
++
++void BrowserOSCapturePageStateFunction::EncodeBitmap() {
++  std::vector<ScreenshotHighlight> highlights;
++  gfx::Vector2dF css_to_bitmap;
++  if (show_highlights_) {
++    if (TabNodeMappings* mappings =
++            BrowserOSNodeMappingStore::FindForTab(web_contents_.get())) {
++      highlights = CollectScreenshotHighlights(mappings->nodes);
++    }
++    if (!view_size_.IsEmpty()) {
++      css_to_bitmap.set_x(css_to_widget_scale_ * bitmap_.width() /
++                          view_size_.width());
++      css_to_bitmap.set_y(css_to_widget_scale_ * bitmap_.height() /
++                          view_size_.height());
++    }
++  }
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {task_priority_, base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&EncodeScreenshot, bitmap_, gfx::Size(),
++                     std::move(highlights), css_to_bitmap, format_, quality_,
++                     /* as_data_url= */ true, cancellation_),
++      base::BindOnce(&BrowserOSCapturePageStateFunction::OnScreenshotEncoded,
++                     this, attempt_));
++}
++
++void BrowserOSCapturePageStateFunction::OnScreenshotEncoded(
++    uint32_t attempt,
++    std::optional<EncodedScreenshot> screenshot) {
++  if (attempt != attempt_ || did_respond()) {
++    return;
++  }
++  if (!screenshot) {
++    Fail(IsRequestCancelled(cancellation_.get())
++             ? kRequestCancelledError
++             : "Failed to encode screenshot");
++    return;
++  }
++  screenshot_ = std::move(screenshot);
++  MaybeFinish();
++}
++
++void BrowserOSCapturePageStateFunction::MaybeFinish() {
++  if (!snapshot_ || !screenshot_) {
++    return;
++  }
++  if (!web_contents_) {
++    Fail("Tab was closed");
++    return;
++  }
++
++  BrowserOSSnapshotTracker* tracker =
++      BrowserOSSnapshotTracker::FromWebContents(web_contents_.get());
++  const bool consistent =
++      !tracker || tracker->generation() == request_generation_;
++  if (!consistent && attempt_ < kMaxPageCaptureAttempts) {
++    VLOG(1) << "[browseros] CapturePageState: Page changed during attempt "
++            << attempt_ << ", capturing again";
++    StartAttempt();
++    return;
++  }
++  if (tracker) {
++    tracker->RecordSnapshotForDiff(
++        static_cast<uint32_t>(snapshot_->snapshot_id));
++  }
++
++  browser_os::PageCapture capture;
++  capture.snapshot = std::move(*snapshot_);
++  capture.screenshot = std::move(screenshot_->data_url);
++  capture.screenshot_width = screenshot_->width;
++  capture.screenshot_height = screenshot_->height;
++  capture.consistent = consistent;
++  action_slot_.RunAndReset();
++  rendering_hold_.RunAndReset();
++  RecordBrowserOSApiLatency(name(), base::TimeTicks::Now() - start_time_);
++  profiled_call_.Finish(true);
++  Respond(
++      ArgumentList(browser_os::CapturePageState::Results::Create(capture)));
++}
++
++void BrowserOSCapturePageStateFunction::Fail(std::string error) {
++  action_slot_.RunAndReset();
++  rendering_hold_.RunAndReset();
++  Respond(Error(std::move(error)));
++}
++
++void BrowserOSCapturePageStateFunction::OnBrowserContextShutdown() {
++  if (cancellation_) {
++    cancellation_->Cancel();
++  }
++}
++
++// Implementation of the screencast functions
++
++namespace {
++
++constexpr int kDefaultScreencastMaxSize = 1024;
++constexpr int kDefaultScreencastQuality = 60;
++constexpr double kDefaultScreencastMaxFps = 5;
++constexpr double kMaxScreencastFps = 30;
++
++}  // namespace
++
++ExtensionFunction::ResponseAction BrowserOSStartScreencastFunction::Run() {
++  std::optional<browser_os::StartScreencast::Params> params =
++      browser_os::StartScreencast::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  int max_size = kDefaultScreencastMaxSize;
++  int quality = kDefaultScreencastQuality;
++  double max_fps = kDefaultScreencastMaxFps;
++  if (params->options) {
++    max_size = params->options->max_size.value_or(max_size);
++    quality = std::clamp(params->options->quality.value_or(quality), 0, 100);
++    max_fps = params->options->max_fps.value_or(max_fps);
++  }
++  if (max_size <= 0 || max_fps <= 0) {
++    return RespondNow(Error("maxSize and maxFps must be positive"));
++  }
++  max_fps = std::min(max_fps, kMaxScreencastFps);
++
++  BrowserOSScreencast::Config config;
++  config.extension_id = extension_id();
++  config.max_size = gfx::Size(max_size, max_size);
++  config.quality = quality;
++  config.min_frame_interval = base::Seconds(1 / max_fps);
++  BrowserOSScreencast::Start(tab_info->web_contents, std::move(config));
++
++  return RespondNow(NoArguments());
++}
++
++ExtensionFunction::ResponseAction BrowserOSStopScreencastFunction::Run() {
++  std::optional<browser_os::StopScreencast::Params> params =
++      browser_os::StopScreencast::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  BrowserOSScreencast::Stop(tab_info->web_contents);
++  return RespondNow(NoArguments());
++}
++
++ExtensionFunction::ResponseAction BrowserOSAckScreencastFrameFunction::Run() {
++  std::optional<browser_os::AckScreencastFrame::Params> params =
++      browser_os::AckScreencastFrame::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  auto* screencast =
++      BrowserOSScreencast::FromWebContents(tab_info->web_contents);
++  if (!screencast) {
++    return RespondNow(Error("No screencast running for this tab"));
++  }
++  screencast->Ack(params->frame_number);
++  return RespondNow(NoArguments());
++}
++
++// Implementation of the accessibility stream functions
++
++namespace {
++
++constexpr int kDefaultAccessibilityStreamIntervalMs = 100;
++// Below a frame, batches would rarely hold more than one update
++constexpr int kMinAccessibilityStreamIntervalMs = 16;
++constexpr int kMaxAccessibilityStreamIntervalMs = 5000;
++
++}  // namespace
++
++ExtensionFunction::ResponseAction
++BrowserOSStartAccessibilityStreamFunction::Run() {
++  std::optional<browser_os::StartAccessibilityStream::Params> params =
++      browser_os::StartAccessibilityStream::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
 +  }
-+  
-+  auto node_it = tab_it->second.find(params->node_id);
-+  if (node_it == tab_it->second.end()) {
-+    return RespondNow(Error("Node ID not found"));
++
++  BrowserOSAccessibilityStream::Config config;
++  config.extension_id = extension_id();
++  int interval_ms = kDefaultAccessibilityStreamIntervalMs;
++  if (params->options) {
++    interval_ms = params->options->interval_ms.value_or(interval_ms);
++    if (params->options->attributes) {
++      config.attribute_filter = base::flat_set<std::string>(
++          params->options->attributes->begin(),
++          params->options->attributes->end());
++    }
 +  }
-+  
-+  const NodeInfo& node_info = node_it->second;
-+  
-+  LOG(INFO) << "[browseros] InputText: Starting input for nodeId: " << params->node_id;
-+  
-+  // Use TypeWithDetection which tries both native and JavaScript methods
-+  bool change_detected = TypeWithDetection(web_contents, node_info, params->text);
-+  
-+  if (!change_detected) {
-+    LOG(WARNING) << "[browseros] InputText: No change detected after typing";
++  if (interval_ms <= 0) {
++    return RespondNow(Error("intervalMs must be positive"));
 +  }
-+  
-+  // Create interaction response
-+  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::InputText::Results::Create(response)));
++  config.interval = base::Milliseconds(
++      std::clamp(interval_ms, kMinAccessibilityStreamIntervalMs,
++                 kMaxAccessibilityStreamIntervalMs));
++  BrowserOSAccessibilityStream::Start(tab_info->web_contents,
++                                      std::move(config));
++
++  return RespondNow(NoArguments());
 +}
 +
-+// Implementation of BrowserOSClearFunction
++ExtensionFunction::ResponseAction
++BrowserOSStopAccessibilityStreamFunction::Run() {
++  std::optional<browser_os::StopAccessibilityStream::Params> params =
++      browser_os::StopAccessibilityStream::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
 +
-+ExtensionFunction::ResponseAction BrowserOSClearFunction::Run() {
-+  std::optional<browser_os::Clear::Params> params =
-+      browser_os::Clear::Params::Create(args());
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  BrowserOSAccessibilityStream::Stop(tab_info->web_contents);
++  return RespondNow(NoArguments());
++}
++
++// Implementation of the audio capture functions
++
++namespace {
++
++constexpr int kDefaultAudioCaptureBitrate = 32000;
++constexpr int kDefaultAudioCaptureFrameMs = 100;
++constexpr int kOpusPacketMs = 20;
++
++}  // namespace
++
++ExtensionFunction::ResponseAction BrowserOSStartAudioCaptureFunction::Run() {
++  std::optional<browser_os::StartAudioCapture::Params> params =
++      browser_os::StartAudioCapture::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
 +
-+  // Get the target tab
 +  std::string error_message;
 +  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
 +                                       include_incognito_information(),
@@ -542,48 +3408,46 @@ index 0000000000000..c08b705ef6869
 +  if (!tab_info) {
 +    return RespondNow(Error(error_message));
 +  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  int tab_id = tab_info->tab_id;
 +
-+  // Look up the AX node ID from our nodeId
-+  auto tab_it = GetNodeIdMappings().find(tab_id);
-+  if (tab_it == GetNodeIdMappings().end()) {
-+    return RespondNow(Error("No snapshot data for this tab"));
++  // The policy ExtensionMediaAccessHandler honors for getUserMedia
++  if (!Profile::FromBrowserContext(browser_context())
++           ->GetPrefs()
++           ->GetBoolean(prefs::kAudioCaptureAllowed)) {
++    return RespondNow(Error("Audio capture is disabled by policy"));
 +  }
-+  
-+  auto node_it = tab_it->second.find(params->node_id);
-+  if (node_it == tab_it->second.end()) {
-+    return RespondNow(Error("Node ID not found"));
++
++  int bitrate = kDefaultAudioCaptureBitrate;
++  int frame_ms = kDefaultAudioCaptureFrameMs;
++  if (params->options) {
++    bitrate = params->options->bitrate.value_or(bitrate);
++    frame_ms = params->options->frame_duration_ms.value_or(frame_ms);
 +  }
-+  
-+  const NodeInfo& node_info = node_it->second;
-+  
-+  LOG(INFO) << "[browseros] Clear: Clearing field for nodeId: " << params->node_id;
-+  
-+  // Use ClearWithDetection which handles focus and clearing
-+  bool change_detected = ClearWithDetection(web_contents, node_info);
-+  
-+  if (!change_detected) {
-+    LOG(WARNING) << "[browseros] Clear: No change detected after clearing";
++  if (bitrate <= 0 || frame_ms < kOpusPacketMs) {
++    return RespondNow(Error(base::StringPrintf(
++        "bitrate must be positive and frameDurationMs at least %d",
++        kOpusPacketMs)));
 +  }
-+  
-+  // Create interaction response
-+  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::Clear::Results::Create(response)));
++
++  BrowserOSAudioCapture::Config config;
++  config.extension_id = extension_id();
++  config.bitrate = bitrate;
++  config.packets_per_frame = frame_ms / kOpusPacketMs;
++  BrowserOSAudioCapture::Start(
++      tab_info->web_contents, std::move(config),
++      base::BindOnce(&BrowserOSStartAudioCaptureFunction::OnStarted, this));
++  return RespondLater();
 +}
 +
-+// Implementation of BrowserOSGetPageLoadStatusFunction
++void BrowserOSStartAudioCaptureFunction::OnStarted(
++    std::optional<std::string> error) {
++  Respond(error ? Error(std::move(*error)) : NoArguments());
++}
 +
-+ExtensionFunction::ResponseAction BrowserOSGetPageLoadStatusFunction::Run() {
-+  std::optional<browser_os::GetPageLoadStatus::Params> params =
-+      browser_os::GetPageLoadStatus::Params::Create(args());
++ExtensionFunction::ResponseAction BrowserOSStopAudioCaptureFunction::Run() {
++  std::optional<browser_os::StopAudioCapture::Params> params =
++      browser_os::StopAudioCapture::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
 +
-+  // Get the target tab
 +  std::string error_message;
 +  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
 +                                       include_incognito_information(),
@@ -591,39 +3455,19 @@ index 0000000000000..c08b705ef6869
 +  if (!tab_info) {
 +    return RespondNow(Error(error_message));
 +  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  
-+  // Get the primary main frame
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh) {
-+    return RespondNow(Error("No render frame"));
-+  }
-+  
-+  // Build the status object
-+  browser_os::PageLoadStatus status;
-+  
-+  // Check if any resources are still loading
-+  status.is_resources_loading = web_contents->IsLoading();
-+  
-+  // Check if DOMContentLoaded has fired
-+  status.is_dom_content_loaded = rfh->IsDOMContentLoaded();
-+  
-+  // Check if onload has completed (all resources loaded)
-+  status.is_page_complete = rfh->IsDocumentOnLoadCompletedInMainFrame();
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::GetPageLoadStatus::Results::Create(status)));
++
++  BrowserOSAudioCapture::Stop(tab_info->web_contents);
++  return RespondNow(NoArguments());
 +}
 +
-+// Implementation of BrowserOSScrollUpFunction
++// Implementation of the action recording functions
 +
-+ExtensionFunction::ResponseAction BrowserOSScrollUpFunction::Run() {
-+  std::optional<browser_os::ScrollUp::Params> params =
-+      browser_os::ScrollUp::Params::Create(args());
++ExtensionFunction::ResponseAction
++BrowserOSStartActionRecordingFunction::Run() {
++  std::optional<browser_os::StartActionRecording::Params> params =
++      browser_os::StartActionRecording::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
 +
-+  // Get the target tab
 +  std::string error_message;
 +  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
 +                                       include_incognito_information(),
@@ -631,42 +3475,82 @@ index 0000000000000..c08b705ef6869
 +  if (!tab_info) {
 +    return RespondNow(Error(error_message));
 +  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  
-+  // Get viewport height to scroll by approximately one page
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh) {
-+    return RespondNow(Error("No render frame"));
++
++  BrowserOSActionRecorder::Start(tab_info->web_contents);
++  return RespondNow(NoArguments());
++}
++
++ExtensionFunction::ResponseAction BrowserOSStopActionRecordingFunction::Run() {
++  std::optional<browser_os::StopActionRecording::Params> params =
++      browser_os::StopActionRecording::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
 +  }
-+  
-+  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
-+  if (!rwh) {
-+    return RespondNow(Error("No render widget host"));
++
++  std::optional<browser_os::ActionLog> log =
++      BrowserOSActionRecorder::Stop(tab_info->web_contents);
++  if (!log) {
++    return RespondNow(Error("No action recording running for this tab"));
 +  }
-+  
-+  content::RenderWidgetHostView* rwhv = rwh->GetView();
-+  if (!rwhv) {
-+    return RespondNow(Error("No render widget host view"));
++  return RespondNow(
++      ArgumentList(browser_os::StopActionRecording::Results::Create(*log)));
++}
++
++// Implementation of the action script functions
++
++ExtensionFunction::ResponseAction BrowserOSSaveActionScriptFunction::Run() {
++  std::optional<browser_os::SaveActionScript::Params> params =
++      browser_os::SaveActionScript::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::optional<std::string> error = SaveActionScript(
++      Profile::FromBrowserContext(browser_context())->GetPrefs(),
++      params->script);
++  if (error) {
++    return RespondNow(Error(*error));
 +  }
-+  
-+  gfx::Rect viewport_bounds = rwhv->GetViewBounds();
-+  int scroll_amount = viewport_bounds.height() * 0.9;  // 90% of viewport height
-+  
-+  // Perform scroll up (negative delta_y)
-+  Scroll(web_contents, 0, -scroll_amount, true);
-+  
 +  return RespondNow(NoArguments());
 +}
 +
-+// Implementation of BrowserOSScrollDownFunction
++ExtensionFunction::ResponseAction BrowserOSGetActionScriptsFunction::Run() {
++  return RespondNow(
++      ArgumentList(browser_os::GetActionScripts::Results::Create(
++          LoadActionScripts(
++              Profile::FromBrowserContext(browser_context())->GetPrefs()))));
++}
 +
-+ExtensionFunction::ResponseAction BrowserOSScrollDownFunction::Run() {
-+  std::optional<browser_os::ScrollDown::Params> params =
-+      browser_os::ScrollDown::Params::Create(args());
++ExtensionFunction::ResponseAction BrowserOSDeleteActionScriptFunction::Run() {
++  std::optional<browser_os::DeleteActionScript::Params> params =
++      browser_os::DeleteActionScript::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  DeleteActionScript(Profile::FromBrowserContext(browser_context())->GetPrefs(),
++                     params->name);
++  return RespondNow(NoArguments());
++}
++
++namespace {
++
++constexpr int kDefaultScriptStepTimeoutMs = 10000;
++constexpr int kMaxScriptStepTimeoutMs = 120000;
++
++}  // namespace
++
++BrowserOSRunActionScriptFunction::BrowserOSRunActionScriptFunction() = default;
++BrowserOSRunActionScriptFunction::~BrowserOSRunActionScriptFunction() =
++    default;
++
++ExtensionFunction::ResponseAction BrowserOSRunActionScriptFunction::Run() {
++  std::optional<browser_os::RunActionScript::Params> params =
++      browser_os::RunActionScript::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
 +
-+  // Get the target tab
 +  std::string error_message;
 +  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
 +                                       include_incognito_information(),
@@ -674,42 +3558,295 @@ index 0000000000000..c08b705ef6869
 +  if (!tab_info) {
 +    return RespondNow(Error(error_message));
 +  }
-+  
++
++  std::optional<browser_os::ActionScript> script = LoadActionScript(
++      Profile::FromBrowserContext(browser_context())->GetPrefs(),
++      params->name);
++  if (!script) {
++    return RespondNow(Error("No action script named " + params->name));
++  }
++
++  int step_timeout_ms = kDefaultScriptStepTimeoutMs;
++  std::optional<RequestLane> requested_lane;
++  if (params->options) {
++    step_timeout_ms =
++        params->options->step_timeout_ms.value_or(step_timeout_ms);
++    if (params->options->variables) {
++      variables_ =
++          std::move(params->options->variables->additional_properties);
++    }
++    settle_policy_ = SettlePolicyFromOptions(params->options->interaction);
++    if (params->options->interaction) {
++      requested_lane = ToRequestLane(params->options->interaction->priority);
++    }
++  }
++  if (step_timeout_ms < 0) {
++    return RespondNow(Error("stepTimeoutMs must not be negative"));
++  }
++  step_timeout_ =
++      base::Milliseconds(std::min(step_timeout_ms, kMaxScriptStepTimeoutMs));
++
 +  content::WebContents* web_contents = tab_info->web_contents;
-+  
-+  // Get viewport height to scroll by approximately one page
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh) {
-+    return RespondNow(Error("No render frame"));
++  web_contents_ = web_contents->GetWeakPtr();
++  tab_id_ = tab_info->tab_id;
++  script_ = std::move(*script);
++  results_.reserve(script_.steps.size());
++  start_time_ = base::TimeTicks::Now();
++
++  VLOG(1) << "[browseros] RunActionScript: " << script_.name << ", "
++          << script_.steps.size() << " steps";
++
++  // Targets are matched against full snapshots, and the waits between them
++  // rely on change events, which only arrive while accessibility is on
++  BrowserOSSnapshotTracker::CreateForWebContents(web_contents);
++  BrowserOSSnapshotTracker::FromWebContents(web_contents)
++      ->EnsureAccessibilityEnabled();
++
++  BrowserOSActionScheduler::GetInstance()->Enqueue(
++      tab_id_,
++      base::BindOnce(&BrowserOSRunActionScriptFunction::OnSlotAcquired, this),
++      BrowserOSTabPriority::ResolveLane(web_contents, requested_lane));
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSRunActionScriptFunction::OnSlotAcquired(base::OnceClosure done) {
++  action_slot_ = base::ScopedClosureRunner(std::move(done));
++  RunNextStep();
++}
++
++void BrowserOSRunActionScriptFunction::RunNextStep() {
++  if (next_step_ >= script_.steps.size() ||
++      (!results_.empty() && !results_.back().success)) {
++    browser_os::RunActionScriptResponse response;
++    response.success = results_.size() == script_.steps.size() &&
++                       (results_.empty() || results_.back().success);
++    response.results = std::move(results_);
++    response.duration_ms =
++        (base::TimeTicks::Now() - start_time_).InMillisecondsF();
++    action_slot_.RunAndReset();
++    browseros_metrics::BrowserOSMetrics::Log(
++        "action_script.completed",
++        {{"steps", base::Value(static_cast<int>(script_.steps.size()))},
++         {"success", base::Value(response.success)}});
++    Respond(ArgumentList(
++        browser_os::RunActionScript::Results::Create(response)));
++    return;
 +  }
-+  
-+  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
-+  if (!rwh) {
-+    return RespondNow(Error("No render widget host"));
++
++  const size_t step = next_step_++;
++  step_result_ = browser_os::ScriptStepResult();
++  if (!web_contents_) {
++    FailStep("Tab was closed");
++    return;
 +  }
-+  
-+  content::RenderWidgetHostView* rwhv = rwh->GetView();
-+  if (!rwhv) {
-+    return RespondNow(Error("No render widget host view"));
++
++  if (!script_.steps[step].target) {
++    if (std::optional<std::string> error = DispatchStep(nullptr)) {
++      FailStep(std::move(*error));
++    }
++    return;
 +  }
-+  
-+  gfx::Rect viewport_bounds = rwhv->GetViewBounds();
-+  int scroll_amount = viewport_bounds.height() * 0.9;  // 90% of viewport height
-+  
-+  // Perform scroll down (positive delta_y)
-+  Scroll(web_contents, 0, scroll_amount, true);
-+  
-+  return RespondNow(NoArguments());
++
++  // Each check is a full snapshot, which renumbers the tab's nodes
++  BrowserOSSnapshotTracker::FromWebContents(web_contents_.get())
++      ->Invalidate();
++  watcher_ = std::make_unique<BrowserOSTreeChangeWatcher>(
++      web_contents_.get(), kWaitForNodeRecheckDelay,
++      base::BindRepeating(&BrowserOSRunActionScriptFunction::CheckTarget,
++                          base::Unretained(this)));
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&BrowserOSRunActionScriptFunction::OnStepTimeout, this,
++                     step),
++      step_timeout_);
++  CheckTarget();
++}
++
++void BrowserOSRunActionScriptFunction::CheckTarget() {
++  if (!watcher_) {
++    return;
++  }
++  if (!web_contents_) {
++    FailStep("Tab was closed");
++    return;
++  }
++  if (checking_) {
++    recheck_needed_ = true;
++    return;
++  }
++
++  checking_ = true;
++  recheck_needed_ = false;
++  browseros::AXSnapshotCache::Request(
++      web_contents_.get(), GetSnapshotAXMode(SnapshotProfile::kInteractive),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
++      /* timeout= */ base::TimeDelta(),
++      browseros::AXSnapshotCache::Freshness::kAny,
++      base::BindOnce(
++          &BrowserOSRunActionScriptFunction::OnAccessibilityTreeReceived,
++          this));
++}
++
++void BrowserOSRunActionScriptFunction::OnAccessibilityTreeReceived(
++    browseros::SharedAXTreeUpdate snapshot) {
++  if (!watcher_) {
++    checking_ = false;
++    return;
++  }
++  if (!web_contents_) {
++    checking_ = false;
++    FailStep("Tab was closed");
++    return;
++  }
++  SnapshotProcessor::ProcessAccessibilityTree(
++      snapshot, tab_id_,
++      BrowserOSGetInteractiveSnapshotFunction::AllocateSnapshotId(),
++      web_contents_.get(), SnapshotOptions(),
++      base::BindOnce(&BrowserOSRunActionScriptFunction::OnSnapshotProcessed,
++                     this));
++}
++
++void BrowserOSRunActionScriptFunction::OnSnapshotProcessed(
++    SnapshotProcessingResult result) {
++  checking_ = false;
++  if (!watcher_) {
++    return;
++  }
++
++  if (TabNodeMappings* mappings =
++          BrowserOSNodeMappingStore::FindForTab(web_contents_.get())) {
++    const browser_os::ScriptStep& step = script_.steps[next_step_ - 1];
++    if (std::optional<ScriptTargetMatch> match =
++            MatchScriptTarget(mappings->nodes, *step.target)) {
++      watcher_.reset();
++      step_result_.node_id = match->node_id;
++      step_result_.match_score = match->score;
++      if (std::optional<std::string> error =
++              DispatchStep(&mappings->nodes.at(match->node_id))) {
++        FailStep(std::move(*error));
++      }
++      return;
++    }
++  }
++
++  // The tree changed while this check ran; it may hold the target by now
++  if (recheck_needed_) {
++    CheckTarget();
++  }
++}
++
++void BrowserOSRunActionScriptFunction::OnStepTimeout(size_t step) {
++  // Only a step still looking for its target can time out
++  if (!watcher_ || next_step_ != step + 1) {
++    return;
++  }
++  FailStep("No node matched the target");
++}
++
++std::optional<std::string> BrowserOSRunActionScriptFunction::DispatchStep(
++    const NodeInfo* node_info) {
++  const browser_os::ScriptStep& step = script_.steps[next_step_ - 1];
++  content::WebContents* web_contents = web_contents_.get();
++  auto on_detected =
++      base::BindOnce(&BrowserOSRunActionScriptFunction::OnStepCompleted, this);
++
++  switch (step.type) {
++    case browser_os::ScriptStepType::kClick:
++      ClickWithDetection(web_contents, *node_info, settle_policy_,
++                         std::move(on_detected));
++      return std::nullopt;
++
++    case browser_os::ScriptStepType::kInputText: {
++      base::expected<std::string, std::string> text =
++          ExpandScriptVariables(step.text.value_or(""), variables_);
++      if (!text.has_value()) {
++        return text.error();
++      }
++      TypeWithDetection(web_contents, *node_info, *text, settle_policy_,
++                        std::move(on_detected));
++      return std::nullopt;
++    }
++
++    case browser_os::ScriptStepType::kClear:
++      ClearWithDetection(web_contents, *node_info, settle_policy_,
++                         std::move(on_detected));
++      return std::nullopt;
++
++    case browser_os::ScriptStepType::kSendKeys:
++      if (!step.key || !IsSupportedKey(*step.key)) {
++        return "Unsupported key: " + step.key.value_or("");
++      }
++      KeyPressWithDetection(web_contents, *step.key, settle_policy_,
++                            std::move(on_detected));
++      return std::nullopt;
++
++    case browser_os::ScriptStepType::kScrollUp:
++    case browser_os::ScriptStepType::kScrollDown: {
++      const bool down = step.type == browser_os::ScriptStepType::kScrollDown;
++      BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++          web_contents,
++          [web_contents, down]() { ScrollByPage(web_contents, down); },
++          std::move(on_detected), base::Milliseconds(300), settle_policy_);
++      return std::nullopt;
++    }
++
++    case browser_os::ScriptStepType::kNavigate: {
++      const GURL url(step.url.value_or(""));
++      if (!url.is_valid()) {
++        return "Invalid url: " + step.url.value_or("");
++      }
++      // The next step's target usually only exists once the page has loaded
++      SettlePolicy policy = settle_policy_;
++      policy.wait_for_network_idle = true;
++      BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++          web_contents,
++          [web_contents, url]() {
++            web_contents->GetController().LoadURL(
++                url, content::Referrer(), ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
++                std::string());
++          },
++          std::move(on_detected), base::Milliseconds(300), policy);
++      return std::nullopt;
++    }
++
++    case browser_os::ScriptStepType::kWaitForNode:
++      // Resolving the target was the whole step
++      step_result_.success = true;
++      results_.push_back(std::move(step_result_));
++      RunNextStep();
++      return std::nullopt;
++
++    case browser_os::ScriptStepType::kNone:
++      break;
++  }
++  return "Unknown step type";
 +}
 +
-+// Implementation of BrowserOSScrollToNodeFunction
++void BrowserOSRunActionScriptFunction::OnStepCompleted(bool page_changed) {
++  VLOG(1) << "[browseros] RunActionScript: step " << results_.size()
++          << (page_changed ? " changed the page" : " had no effect");
++  step_result_.success = true;
++  step_result_.page_changed = page_changed;
++  results_.push_back(std::move(step_result_));
++  RunNextStep();
++}
 +
-+ExtensionFunction::ResponseAction BrowserOSScrollToNodeFunction::Run() {
-+  std::optional<browser_os::ScrollToNode::Params> params =
-+      browser_os::ScrollToNode::Params::Create(args());
++void BrowserOSRunActionScriptFunction::FailStep(std::string error) {
++  LOG(WARNING) << "[browseros] RunActionScript: step " << results_.size()
++               << " of " << script_.name << " failed: " << error;
++  watcher_.reset();
++  step_result_.success = false;
++  step_result_.error = std::move(error);
++  results_.push_back(std::move(step_result_));
++  RunNextStep();
++}
++
++ExtensionFunction::ResponseAction
++BrowserOSSetBackgroundRenderingFunction::Run() {
++  std::optional<browser_os::SetBackgroundRendering::Params> params =
++      browser_os::SetBackgroundRendering::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
 +
-+  // Get the target tab
 +  std::string error_message;
 +  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
 +                                       include_incognito_information(),
@@ -717,77 +3854,23 @@ index 0000000000000..c08b705ef6869
 +  if (!tab_info) {
 +    return RespondNow(Error(error_message));
 +  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  int tab_id = tab_info->tab_id;
-+  
-+  // Look up the AX node ID from our nodeId
-+  auto tab_it = GetNodeIdMappings().find(tab_id);
-+  if (tab_it == GetNodeIdMappings().end()) {
-+    return RespondNow(Error("No snapshot data for this tab"));
-+  }
-+  
-+  auto node_it = tab_it->second.find(params->node_id);
-+  if (node_it == tab_it->second.end()) {
-+    return RespondNow(Error("Node ID not found"));
-+  }
-+  
-+  const NodeInfo& node_info = node_it->second;
-+  
-+  // Get viewport bounds to check if node is already in view
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh) {
-+    return RespondNow(Error("No render frame"));
-+  }
-+  
-+  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
-+  if (!rwh) {
-+    return RespondNow(Error("No render widget host"));
-+  }
-+  
-+  content::RenderWidgetHostView* rwhv = rwh->GetView();
-+  if (!rwhv) {
-+    return RespondNow(Error("No render widget host view"));
-+  }
-+  
-+  gfx::Rect viewport_bounds = rwhv->GetViewBounds();
-+  
-+  // Check if the node is already visible in the viewport
-+  // We consider it visible if any part of it is within the viewport
-+  bool is_in_view = false;
-+  if (node_info.bounds.y() < viewport_bounds.height() && 
-+      node_info.bounds.bottom() > 0 &&
-+      node_info.bounds.x() < viewport_bounds.width() &&
-+      node_info.bounds.right() > 0) {
-+    is_in_view = true;
-+  }
-+  
-+  if (!is_in_view) {
-+    // Use accessibility action to scroll
-+    if (rfh) {
-+      ui::AXActionData action_data;
-+      action_data.action = ax::mojom::Action::kScrollToMakeVisible;
-+      action_data.target_node_id = node_info.ax_node_id;
-+      action_data.horizontal_scroll_alignment = ax::mojom::ScrollAlignment::kScrollAlignmentCenter;
-+      action_data.vertical_scroll_alignment = ax::mojom::ScrollAlignment::kScrollAlignmentCenter;
-+      action_data.scroll_behavior = ax::mojom::ScrollBehavior::kScrollIfVisible;
-+      
-+      rfh->AccessibilityPerformAction(action_data);
-+    }
-+  }
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::ScrollToNode::Results::Create(!is_in_view)));
-+}
 +
-+// Implementation of BrowserOSSendKeysFunction
++  VLOG(1) << "[browseros] Background rendering "
++          << (params->enabled ? "enabled" : "disabled") << " for tab "
++          << tab_info->tab_id;
++  BrowserOSBackgroundRendering::SetEnabled(tab_info->web_contents,
++                                           params->enabled);
++  return RespondNow(NoArguments());
++}
 +
-+ExtensionFunction::ResponseAction BrowserOSSendKeysFunction::Run() {
-+  std::optional<browser_os::SendKeys::Params> params =
-+      browser_os::SendKeys::Params::Create(args());
++ExtensionFunction::ResponseAction BrowserOSSetTabPriorityFunction::Run() {
++  std::optional<browser_os::SetTabPriority::Params> params =
++      browser_os::SetTabPriority::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
 +
-+  // Get the target tab
++  std::optional<RequestLane> lane = ToRequestLane(params->priority);
++  EXTENSION_FUNCTION_VALIDATE(lane);
++
 +  std::string error_message;
 +  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
 +                                       include_incognito_information(),
@@ -795,51 +3878,23 @@ index 0000000000000..c08b705ef6869
 +  if (!tab_info) {
 +    return RespondNow(Error(error_message));
 +  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  
-+  // Validate the key - use a simple check instead of std::set to avoid exit-time destructor
-+  const std::string& key = params->key;
-+  bool is_supported = (key == "Enter" || key == "Delete" || key == "Backspace" ||
-+                       key == "Tab" || key == "Escape" || key == "ArrowUp" ||
-+                       key == "ArrowDown" || key == "ArrowLeft" || key == "ArrowRight" ||
-+                       key == "Home" || key == "End" || key == "PageUp" || key == "PageDown");
-+  
-+  if (!is_supported) {
-+    return RespondNow(Error("Unsupported key: " + params->key));
-+  }
-+  
-+  LOG(INFO) << "[browseros] SendKeys: Sending key '" << params->key << "'";
-+  
-+  // Send the key with change detection
-+  bool change_detected = KeyPressWithDetection(web_contents, params->key);
-+  
-+  if (!change_detected) {
-+    LOG(WARNING) << "[browseros] SendKeys: No change detected after key press";
-+  }
-+  
-+  // Create interaction response
-+  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::SendKeys::Results::Create(response)));
-+}
-+
-+// Implementation of BrowserOSCaptureScreenshotFunction
 +
-+BrowserOSCaptureScreenshotFunction::BrowserOSCaptureScreenshotFunction() = default;
-+BrowserOSCaptureScreenshotFunction::~BrowserOSCaptureScreenshotFunction() = default;
++  VLOG(1) << "[browseros] Tab " << tab_info->tab_id << " priority set to "
++          << browser_os::ToString(params->priority);
++  BrowserOSTabPriority::SetLane(tab_info->web_contents, *lane);
++  return RespondNow(NoArguments());
++}
 +
-+ExtensionFunction::ResponseAction BrowserOSCaptureScreenshotFunction::Run() {
-+  std::optional<browser_os::CaptureScreenshot::Params> params =
-+      browser_os::CaptureScreenshot::Params::Create(args());
++ExtensionFunction::ResponseAction BrowserOSSetAutomationTabFunction::Run() {
++  std::optional<browser_os::SetAutomationTab::Params> params =
++      browser_os::SetAutomationTab::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
-+  
-+  // Store whether to show highlights
-+  show_highlights_ = params->show_highlights.value_or(false);
 +
-+  // Get the target tab
++  std::optional<TabBudget> budget = ToTabBudget(params->budget);
++  if (!budget) {
++    return RespondNow(Error("Budget limits must be positive"));
++  }
++
 +  std::string error_message;
 +  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
 +                                       include_incognito_information(),
@@ -847,171 +3902,136 @@ index 0000000000000..c08b705ef6869
 +  if (!tab_info) {
 +    return RespondNow(Error(error_message));
 +  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  web_contents_ = web_contents->GetWeakPtr();
-+  tab_id_ = tab_info->tab_id;
-+  
-+  // Get the render widget host view
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh) {
-+    return RespondNow(Error("No render frame"));
-+  }
-+  
-+  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
-+  if (!rwh) {
-+    return RespondNow(Error("No render widget host"));
-+  }
-+  
-+  content::RenderWidgetHostView* rwhv = rwh->GetView();
-+  if (!rwhv) {
-+    return RespondNow(Error("No render widget host view"));
++
++  if (!params->automation) {
++    VLOG(1) << "[browseros] Tab " << tab_info->tab_id
++            << " no longer an automation tab";
++    BrowserOSTabBudget::Clear(tab_info->web_contents);
++    return RespondNow(NoArguments());
 +  }
-+  
-+  // Get the view bounds to determine the size
-+  gfx::Rect view_bounds = rwhv->GetViewBounds();
-+  
-+  // Check if exact width and height are specified
-+  if (params->width && params->height) {
-+    // Use exact dimensions without preserving aspect ratio
-+    use_exact_dimensions_ = true;
-+    target_size_ = gfx::Size(static_cast<int>(*params->width), 
-+                            static_cast<int>(*params->height));
-+    LOG(INFO) << "[browseros] CaptureScreenshot: Using exact dimensions: "
-+              << target_size_.width() << "x" << target_size_.height();
++
++  VLOG(1) << "[browseros] Tab " << tab_info->tab_id
++          << " is an automation tab, budget " << budget->cpu_percent
++          << "% cpu, " << budget->memory_mb << " MB";
++  BrowserOSTabBudget::SetBudget(tab_info->web_contents, *budget);
++  return RespondNow(NoArguments());
++}
++
++ExtensionFunction::ResponseAction BrowserOSGetTabResourceUsageFunction::Run() {
++  std::optional<browser_os::GetTabResourceUsage::Params> params =
++      browser_os::GetTabResourceUsage::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::vector<int> tab_ids;
++  if (params->tab_ids) {
++    tab_ids = *params->tab_ids;
 +  } else {
-+    // Fall back to original behavior with thumbnailSize
-+    use_exact_dimensions_ = false;
-+    
-+    // Determine max thumbnail size
-+    // If thumbnailSize is provided, use minimum of it and viewport dimensions
-+    // Otherwise, use viewport size (no scaling)
-+    int max_dimension;
-+    if (params->thumbnail_size) {
-+      // Take minimum of requested size and viewport dimensions
-+      int viewport_max = std::max(view_bounds.width(), view_bounds.height());
-+      max_dimension = std::min(static_cast<int>(*params->thumbnail_size), viewport_max);
-+      LOG(INFO) << "[browseros] CaptureScreenshot: Using thumbnail size: " << max_dimension 
-+                << " (requested: " << *params->thumbnail_size 
-+                << ", viewport max: " << viewport_max << ")";
-+    } else {
-+      // No thumbnail size specified, use viewport dimensions
-+      max_dimension = std::max(view_bounds.width(), view_bounds.height());
-+      LOG(INFO) << "[browseros] CaptureScreenshot: Using viewport size: " << max_dimension;
-+    }
-+    
-+    gfx::Size thumbnail_size = view_bounds.size();
-+    
-+    // Scale down proportionally if needed
-+    if (thumbnail_size.width() > max_dimension || 
-+        thumbnail_size.height() > max_dimension) {
-+      float scale = std::min(
-+          static_cast<float>(max_dimension) / thumbnail_size.width(),
-+          static_cast<float>(max_dimension) / thumbnail_size.height());
-+      thumbnail_size = gfx::ScaleToFlooredSize(thumbnail_size, scale);
++    for (content::WebContents* web_contents :
++         BrowserOSTabBudget::GetAutomationTabs()) {
++      tab_ids.push_back(ExtensionTabUtil::GetTabId(web_contents));
 +    }
-+    
-+    target_size_ = thumbnail_size;
++    std::sort(tab_ids.begin(), tab_ids.end());
 +  }
-+  
-+  // Store target size for later use
-+  
-+  // Draw highlights first, then capture after a short delay
-+  DrawHighlightsAndCapture();
-+  
-+  return RespondLater();
-+}
 +
-+void BrowserOSCaptureScreenshotFunction::DrawHighlightsAndCapture() {
-+  // Only draw highlights if requested via the showHighlights flag
-+  if (show_highlights_) {
-+    // Check if we have snapshot data for this tab to draw highlights
-+    auto tab_it = GetNodeIdMappings().find(tab_id_);
-+    if (tab_it != GetNodeIdMappings().end() && !tab_it->second.empty()) {
-+      LOG(INFO) << "[browseros] Drawing highlights for screenshot with " 
-+                << tab_it->second.size() << " interactive elements";
-+      if (web_contents_) {
-+        ShowHighlights(web_contents_.get(), tab_it->second, true /* show_labels */);
++  std::vector<browser_os::TabResourceUsage> usage;
++  for (int tab_id : tab_ids) {
++    std::string error_message;
++    auto tab_info = GetTabFromOptionalId(tab_id, browser_context(),
++                                         include_incognito_information(),
++                                         &error_message);
++    if (!tab_info) {
++      // Automation tabs of other profiles are left out of the default list
++      if (!params->tab_ids) {
++        continue;
 +      }
-+    } else {
-+      LOG(INFO) << "[browseros] No snapshot data available for highlighting";
++      return RespondNow(Error(error_message));
 +    }
-+    
-+    // Use PostDelayedTask to allow the renderer to paint the highlights
-+    // This lets the event loop run and process the DOM changes
-+    // Use scoped_refptr to keep the function alive
-+    base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
-+        FROM_HERE,
-+        base::BindOnce(&BrowserOSCaptureScreenshotFunction::CaptureScreenshotNow,
-+                       base::WrapRefCounted(this)),
-+        base::Milliseconds(1000));  // Give enough time for JS execution and paint
-+  } else {
-+    // No highlights needed, capture immediately
-+    CaptureScreenshotNow();
++    BrowserOSTabBudget* tab_budget =
++        BrowserOSTabBudget::FromWebContents(tab_info->web_contents);
++    if (!tab_budget) {
++      return RespondNow(Error(
++          base::StrCat({"Tab ", base::NumberToString(tab_id),
++                        " is not an automation tab"})));
++    }
++    usage.push_back(tab_budget->ToResourceUsage(tab_id));
 +  }
++  return RespondNow(
++      ArgumentList(browser_os::GetTabResourceUsage::Results::Create(usage)));
 +}
 +
-+void BrowserOSCaptureScreenshotFunction::CaptureScreenshotNow() {
-+  content::WebContents* web_contents = web_contents_.get();
-+  if (!web_contents) {
-+    Respond(Error("Web contents destroyed"));
-+    return;
++ExtensionFunction::ResponseAction BrowserOSAcquireTabFunction::Run() {
++  std::optional<browser_os::AcquireTab::Params> params =
++      browser_os::AcquireTab::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  GURL url(params->url.value_or(url::kAboutBlankURL));
++  if (!url.is_valid()) {
++    return RespondNow(Error("Invalid URL"));
 +  }
 +
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh) {
-+    Respond(Error("No render frame"));
-+    return;
++  Profile* profile = Profile::FromBrowserContext(browser_context());
++  Browser* browser = chrome::FindLastActiveWithProfile(profile);
++  if (!browser) {
++    return RespondNow(Error("No browser window"));
 +  }
-+  
-+  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
-+  if (!rwh) {
-+    Respond(Error("No render widget host"));
-+    return;
++
++  // With sharing on, a task's first tab still comes from the pool and later
++  // ones join its browsing instance
++  std::unique_ptr<content::WebContents> web_contents;
++  const bool share_renderers =
++      params->task_id && BrowserOSTaskTabs::IsSharingEnabled(profile);
++  if (share_renderers) {
++    if (content::WebContents* task_tab =
++            BrowserOSTaskTabs::FindTaskTab(profile, *params->task_id)) {
++      web_contents = BrowserOSTabPool::GetInstance()->CreateRelated(task_tab);
++    }
 +  }
-+  
-+  content::RenderWidgetHostImpl* rwhi = 
-+      static_cast<content::RenderWidgetHostImpl*>(rwh);
-+  content::RenderWidgetHostView* view = rwhi->GetView();
-+  if (!view) {
-+    Respond(Error("No render widget host view"));
-+    return;
++  if (!web_contents) {
++    web_contents = BrowserOSTabPool::GetInstance()->Take(profile);
 +  }
-+  
-+  // Request the screenshot
-+  view->CopyFromSurface(
-+      gfx::Rect(),  // Empty rect means copy entire surface
-+      target_size_,
-+      base::BindOnce(&BrowserOSCaptureScreenshotFunction::OnScreenshotCaptured,
-+                     this));
++  content::WebContents* contents = web_contents.get();
++  if (share_renderers) {
++    BrowserOSTaskTabs::SetTask(contents, *params->task_id);
++  }
++  browser->tab_strip_model()->AppendWebContents(
++      std::move(web_contents), params->active.value_or(false));
++
++  if (!url.IsAboutBlank()) {
++    contents->GetController().LoadURL(url, content::Referrer(),
++                                      ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
++                                      std::string());
++  }
++
++  return RespondNow(ArgumentList(browser_os::AcquireTab::Results::Create(
++      ExtensionTabUtil::GetTabId(contents))));
 +}
 +
-+void BrowserOSCaptureScreenshotFunction::OnScreenshotCaptured(
-+    const SkBitmap& bitmap) {
-+  // Clean up the highlights immediately after capture (only if we added them)
-+  if (show_highlights_ && web_contents_) {
-+    RemoveHighlights(web_contents_.get());
++ExtensionFunction::ResponseAction BrowserOSReleaseTabFunction::Run() {
++  std::optional<browser_os::ReleaseTab::Params> params =
++      browser_os::ReleaseTab::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
 +  }
-+  
-+  if (bitmap.empty()) {
-+    Respond(Error("Failed to capture screenshot"));
-+    return;
++
++  Browser* browser = chrome::FindBrowserWithTab(tab_info->web_contents);
++  if (!browser) {
++    return RespondNow(Error("Tab is not in a window"));
 +  }
-+  
-+  // Convert bitmap to PNG
-+  auto png_data = gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false);
-+  if (!png_data.has_value()) {
-+    Respond(Error("Failed to encode screenshot"));
-+    return;
++  TabStripModel* tab_strip = browser->tab_strip_model();
++  const int index = tab_strip->GetIndexOfWebContents(tab_info->web_contents);
++  if (index == TabStripModel::kNoTab) {
++    return RespondNow(Error("Tab not found"));
 +  }
-+  
-+  // Convert to base64 data URL
-+  std::string base64_data = base::Base64Encode(png_data.value());
-+  
-+  std::string data_url = "data:image/png;base64," + base64_data;
-+  
-+  Respond(ArgumentList(
-+      browser_os::CaptureScreenshot::Results::Create(data_url)));
++
++  BrowserOSTabPool::GetInstance()->Return(
++      tab_strip->DetachWebContentsAtForInsertion(index));
++  return RespondNow(NoArguments());
 +}
 +
 +// BrowserOSGetSnapshotFunction implementation
@@ -1029,37 +4049,87 @@ index 0000000000000..c08b705ef6869
 +  }
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
++
++  web_contents_ = web_contents->GetWeakPtr();
++  if (params->options) {
++    if (params->options->mode == browser_os::PageContentMode::kMainContent) {
++      content_mode_ = ContentProcessor::Mode::kMainContent;
++    }
++    url_table_ = params->options->url_table.value_or(false);
++    if (params->options->wire_format) {
++      wire_compression_ = params->options->wire_format->compression;
++    }
++    if (params->options->since_snapshot_id || params->options->since_hash) {
++      auto* history = BrowserOSContentHistory::FromWebContents(web_contents);
++      if (const BrowserOSContentHistory::Entry* entry =
++              history ? history->Find(content_mode_,
++                                      params->options->since_snapshot_id,
++                                      params->options->since_hash)
++                      : nullptr) {
++        previous_item_hashes_ = entry->item_hashes;
++      }
++    }
++  }
 +  
 +  // Request accessibility tree snapshot
-+  web_contents->RequestAXTreeSnapshot(
-+      base::BindOnce(&BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived,
-+                     this),
-+      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties),
-+      /* max_nodes= */ 0,  // No limit
++  browseros::AXSnapshotCache::Request(
++      web_contents,
++      GetSnapshotAXMode(SnapshotProfile::kContent),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
 +      /* timeout= */ base::TimeDelta(),
-+      content::WebContents::AXTreeSnapshotPolicy::kAll);
++      browseros::AXSnapshotCache::Freshness::kAny,
++      base::BindOnce(&BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived,
++                     this));
 +  
 +  return RespondLater();
 +}
 +
 +void BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived(
-+    ui::AXTreeUpdate& tree_update) {
++    browseros::SharedAXTreeUpdate snapshot) {
 +  if (!has_callback()) {
 +    return;
 +  }
 +
-+  // Extract page content using the processor
-+  base::Time start_time = base::Time::Now();
-+  auto items = ContentProcessor::ExtractPageContent(tree_update);
++  // Extraction walks every node; keep it off the UI thread
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::TaskPriority::USER_VISIBLE,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&BuildPageContent, content_mode_,
++                     std::move(previous_item_hashes_), url_table_,
++                     std::move(snapshot)),
++      base::BindOnce(&BrowserOSGetSnapshotFunction::OnPageContentBuilt, this));
++}
 +
-+  // Build result
-+  browser_os::PageContent result;
-+  result.items = std::move(items);
-+  result.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
-+  result.processing_time_ms =
-+      (base::Time::Now() - start_time).InMilliseconds();
++void BrowserOSGetSnapshotFunction::OnPageContentBuilt(ContentSnapshot result) {
++  if (web_contents_) {
++    BrowserOSContentHistory::CreateForWebContents(web_contents_.get());
++    result.content.snapshot_id =
++        BrowserOSContentHistory::FromWebContents(web_contents_.get())
++            ->Store(content_mode_, result.content.content_hash,
++                    std::move(result.item_hashes));
++  }
++  if (!wire_compression_) {
++    OnPageContentPacked(std::move(result.content));
++    return;
++  }
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::TaskPriority::USER_VISIBLE,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(&PackPageContent, std::move(result.content),
++                     *wire_compression_),
++      base::BindOnce(&BrowserOSGetSnapshotFunction::OnPageContentPacked,
++                     this));
++}
 +
-+  Respond(ArgumentList(browser_os::GetSnapshot::Results::Create(result)));
++void BrowserOSGetSnapshotFunction::OnPageContentPacked(
++    base::expected<browser_os::PageContent, std::string> content) {
++  if (!content.has_value()) {
++    Respond(Error(content.error()));
++    return;
++  }
++  Respond(ArgumentList(browser_os::GetSnapshot::Results::Create(*content)));
 +}
 +
 +// BrowserOSGetPrefFunction
@@ -1075,19 +4145,8 @@ index 0000000000000..c08b705ef6869
 +    return RespondNow(Error("Preference not found: " + params->name));
 +  }
 +
-+  browser_os::PrefObject pref_obj;
-+  pref_obj.key = params->name;
-+
-+  const base::Value* value = prefs->GetUserPrefValue(params->name);
-+  if (!value) {
-+    value = prefs->GetDefaultPrefValue(params->name);
-+  }
-+
-+  pref_obj.type = GetPrefTypeName(value);
-+  pref_obj.value = value->Clone();
-+
-+  return RespondNow(ArgumentList(
-+      browser_os::GetPref::Results::Create(pref_obj)));
++  return RespondNow(ArgumentList(browser_os::GetPref::Results::Create(
++      BuildPrefObject(prefs, params->name))));
 +}
 +
 +// BrowserOSSetPrefFunction
@@ -1114,44 +4173,61 @@ index 0000000000000..c08b705ef6869
 +      browser_os::SetPref::Results::Create(true)));
 +}
 +
-+// BrowserOSGetAllPrefsFunction
-+ExtensionFunction::ResponseAction BrowserOSGetAllPrefsFunction::Run() {
-+  Profile* profile = Profile::FromBrowserContext(browser_context());
-+  PrefService* profile_prefs = profile->GetPrefs();
-+  PrefService* local_state = g_browser_process->local_state();
++// BrowserOSSetPrefsFunction
++ExtensionFunction::ResponseAction BrowserOSSetPrefsFunction::Run() {
++  std::optional<browser_os::SetPrefs::Params> params =
++      browser_os::SetPrefs::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
 +
-+  // Build a combined browseros prefs dict from both sources
-+  base::Value::Dict combined_browseros;
++  Profile* profile = Profile::FromBrowserContext(browser_context());
++  const base::Value::Dict& values = params->prefs.additional_properties;
 +
-+  // Lambda to merge browseros prefs from a PrefService
-+  auto merge_prefs_from_service = [&](PrefService* prefs, const std::string& source_name) {
++  // Validate the whole batch first, so a bad entry leaves every pref as it
++  // was
++  for (const auto [name, value] : values) {
++    if (!name.starts_with("browseros.")) {
++      return RespondNow(Error("Only browseros.* preferences can be modified"));
++    }
++    PrefService* prefs = FindPrefService(name, profile);
 +    if (!prefs) {
-+      return;
++      return RespondNow(Error("Preference not found: " + name));
++    }
++    if (prefs->FindPreference(name)->GetType() != value.type()) {
++      return RespondNow(Error("Wrong value type for preference: " + name));
 +    }
++  }
 +
-+    // Get all preference values (returns nested Dict structure)
-+    base::Value::Dict pref_dict = prefs->GetPreferenceValues(
-+        PrefService::INCLUDE_DEFAULTS);
++  // Each pref notifies its observers once; the writes reach disk together
++  // instead of on each store's own schedule
++  std::set<PrefService*> touched;
++  for (const auto [name, value] : values) {
++    PrefService* prefs = FindPrefService(name, profile);
++    prefs->Set(name, value);
++    touched.insert(prefs);
++  }
++  for (PrefService* prefs : touched) {
++    prefs->CommitPendingWrite();
++  }
 +
-+    // Look for "browseros" key in the top-level dict
-+    const base::Value* browseros_value = pref_dict.Find("browseros");
-+    if (browseros_value && browseros_value->is_dict()) {
-+      // Merge this browseros dict into combined
-+      combined_browseros.Merge(browseros_value->GetDict().Clone());
-+      LOG(INFO) << "[browseros] GetAllPrefs: Found browseros.* prefs in " << source_name;
-+    }
-+  };
++  return RespondNow(ArgumentList(
++      browser_os::SetPrefs::Results::Create(true)));
++}
 +
-+  // Merge from both Local State and Profile prefs
-+  merge_prefs_from_service(local_state, "local_state");
-+  merge_prefs_from_service(profile_prefs, "profile_prefs");
++// BrowserOSGetAllPrefsFunction
++ExtensionFunction::ResponseAction BrowserOSGetAllPrefsFunction::Run() {
++  // Served from BrowserOSPrefsAPI's cache, rebuilt only after a
++  // browseros.* pref changes
++  BrowserOSPrefsAPI* prefs_api = BrowserOSPrefsAPI::Get(browser_context());
++  if (!prefs_api) {
++    return RespondNow(Error("Preferences are not available"));
++  }
 +
-+  // Create single PrefObject with the entire browseros dict
++  // Single PrefObject with the entire browseros dict
 +  std::vector<browser_os::PrefObject> pref_objects;
 +  browser_os::PrefObject pref_obj;
 +  pref_obj.key = "browseros";
 +  pref_obj.type = "dictionary";
-+  pref_obj.value = base::Value(std::move(combined_browseros));
++  pref_obj.value = base::Value(prefs_api->GetAllPrefs().Clone());
 +  pref_objects.push_back(std::move(pref_obj));
 +
 +  return RespondNow(ArgumentList(
@@ -1205,6 +4281,15 @@ index 0000000000000..c08b705ef6869
 +      browser_os::GetBrowserosVersionNumber::Results::Create(version)));
 +}
 +
++namespace {
++
++// executeJavaScript limits when the caller does not choose them
++constexpr int kDefaultScriptTimeoutMs = 30000;
++constexpr int kMaxScriptTimeoutMs = 300000;
++constexpr size_t kDefaultMaxScriptResultBytes = 10000000;
++
++}  // namespace
++
 +// BrowserOSExecuteJavaScriptFunction
 +ExtensionFunction::ResponseAction BrowserOSExecuteJavaScriptFunction::Run() {
 +  std::optional<browser_os::ExecuteJavaScript::Params> params =
@@ -1221,43 +4306,116 @@ index 0000000000000..c08b705ef6869
 +  }
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
-+  
-+  // Get the primary main frame
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh) {
-+    return RespondNow(Error("No render frame"));
++  const std::optional<browser_os::ExecuteJavaScriptOptions>& options =
++      params->options;
++
++  // Resolve the target frame, the main frame by default
++  const int frame_id = options && options->frame_id
++                           ? *options->frame_id
++                           : ExtensionApiFrameIdMap::kTopFrameId;
++  if (!ExtensionApiFrameIdMap::GetRenderFrameHostById(web_contents,
++                                                      frame_id)) {
++    return RespondNow(Error(base::StringPrintf("No frame with id %d", frame_id)));
 +  }
-+  
-+  LOG(INFO) << "[browseros] ExecuteJavaScript: Executing code in tab " << tab_info->tab_id;
-+  
-+  // Convert JavaScript code string to UTF16
-+  std::u16string js_code = base::UTF8ToUTF16(params->code);
-+  
-+  // Execute the JavaScript code using ExecuteJavaScriptForTests
-+  // This will return the result of the execution
-+  rfh->ExecuteJavaScriptForTests(
-+      js_code,
++
++  TabHelper* tab_helper = TabHelper::FromWebContents(web_contents);
++  if (!tab_helper || !tab_helper->script_executor()) {
++    return RespondNow(Error("Cannot execute JavaScript in this tab"));
++  }
++
++  const mojom::ExecutionWorld world =
++      options && options->world == browser_os::ScriptWorld::kIsolated
++          ? mojom::ExecutionWorld::kIsolated
++          : mojom::ExecutionWorld::kMain;
++  const blink::mojom::PromiseResultOption wait_for_promise =
++      options && options->await_promise.value_or(false)
++          ? blink::mojom::PromiseResultOption::kAwait
++          : blink::mojom::PromiseResultOption::kDoNotWait;
++
++  int timeout_ms = kDefaultScriptTimeoutMs;
++  if (options && options->timeout_ms && *options->timeout_ms > 0) {
++    timeout_ms = std::min(*options->timeout_ms, kMaxScriptTimeoutMs);
++  }
++  max_result_bytes_ = kDefaultMaxScriptResultBytes;
++  if (options && options->max_result_bytes && *options->max_result_bytes > 0) {
++    max_result_bytes_ = static_cast<size_t>(*options->max_result_bytes);
++  }
++
++  VLOG(1) << "[browseros] ExecuteJavaScript: Executing code in tab "
++          << tab_info->tab_id << ", frame " << frame_id;
++
++  // Give up on code that never finishes; a late result is dropped
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&BrowserOSExecuteJavaScriptFunction::OnTimeout, this),
++      base::Milliseconds(timeout_ms));
++
++  // Inject through the extension script pipeline, like
++  // chrome.scripting.executeScript, so the code runs in the chosen world
++  // and frame without blocking on the page
++  std::vector<mojom::JSSourcePtr> sources;
++  sources.push_back(mojom::JSSource::New(params->code, GURL()));
++  tab_helper->script_executor()->ExecuteScript(
++      mojom::HostID(mojom::HostID::HostType::kExtensions, extension_id()),
++      mojom::CodeInjection::NewJs(mojom::JSInjection::New(
++          std::move(sources), world, /*world_id=*/std::nullopt,
++          blink::mojom::WantResultOption::kWantResult,
++          blink::mojom::UserActivationOption::kDoNotActivate,
++          wait_for_promise)),
++      ScriptExecutor::SPECIFIED_FRAMES, {frame_id},
++      mojom::MatchOriginAsFallbackBehavior::kMatchForAboutSchemeAndClimbTree,
++      mojom::RunLocation::kDocumentStart, ScriptExecutor::DEFAULT_PROCESS,
++      /*webview_src=*/GURL(),
 +      base::BindOnce(&BrowserOSExecuteJavaScriptFunction::OnJavaScriptExecuted,
-+                     this),
-+      /*honor_js_content_settings=*/false);
-+  
-+  return RespondLater();
++                     this));
++
++  return did_respond() ? AlreadyResponded() : RespondLater();
 +}
 +
-+void BrowserOSExecuteJavaScriptFunction::OnJavaScriptExecuted(base::Value result) {
-+  LOG(INFO) << "[browseros] ExecuteJavaScript: Execution completed";
++void BrowserOSExecuteJavaScriptFunction::OnJavaScriptExecuted(
++    std::vector<ScriptExecutor::FrameResult> results) {
++  if (did_respond()) {
++    // Already timed out
++    return;
++  }
++
++  VLOG(1) << "[browseros] ExecuteJavaScript: Execution completed";
++
++  if (results.empty() || !results[0].frame_responded) {
++    Respond(Error("Frame was removed before the script finished"));
++    return;
++  }
++  if (!results[0].error.empty()) {
++    Respond(Error(results[0].error));
++    return;
++  }
 +
++  base::Value result = std::move(results[0].value);
 +  if (result.is_none()) {
 +      // JavaScript returned undefined or execution failed
 +      // Return an empty object instead of NONE to satisfy the validator
 +      result = base::Value(base::Value::Type::DICT);
 +  }
 +  
++  std::optional<std::string> json = base::WriteJson(result);
++  if (!json || json->size() > max_result_bytes_) {
++    Respond(Error("Result too large"));
++    return;
++  }
++
 +  // Return the result directly
 +  Respond(ArgumentList(
 +      browser_os::ExecuteJavaScript::Results::Create(result)));
 +}
 +
++void BrowserOSExecuteJavaScriptFunction::OnTimeout() {
++  if (did_respond()) {
++    return;
++  }
++  LOG(WARNING) << "[browseros] ExecuteJavaScript: Script timed out";
++  Respond(Error("Script timed out"));
++}
++
 +// Implementation of BrowserOSClickCoordinatesFunction
 +ExtensionFunction::ResponseAction BrowserOSClickCoordinatesFunction::Run() {
 +  std::optional<browser_os::ClickCoordinates::Params> params =
@@ -1277,26 +4435,44 @@ index 0000000000000..c08b705ef6869
 +        browser_os::ClickCoordinates::Results::Create(response)));
 +  }
 +  
-+  content::WebContents* web_contents = tab_info->web_contents;
++  if (auto error = InitInteraction(*tab_info, params->options)) {
++    return RespondNow(Error(*error));
++  }
 +  
 +  // Create the click point from the coordinates
 +  gfx::PointF click_point(params->x, params->y);
 +  
-+  LOG(INFO) << "[browseros] ClickCoordinates: Clicking at (" 
-+            << params->x << ", " << params->y << ")";
++  VLOG(1) << "[browseros] ClickCoordinates: Clicking at (" 
++          << params->x << ", " << params->y << ")";
 +  
-+  // Perform the click with change detection
-+  bool success = ClickCoordinatesWithDetection(web_contents, click_point);
++  ScheduleInteraction(base::BindOnce(
++      &BrowserOSClickCoordinatesFunction::StartClickCoordinates, this,
++      click_point));
 +  
++  return RespondLater();
++}
++
++void BrowserOSClickCoordinatesFunction::StartClickCoordinates(
++    gfx::PointF point) {
++  // Perform the click with change detection
++  ClickCoordinatesWithDetection(
++      target_web_contents(), point, settle_policy(),
++      base::BindOnce(
++          &BrowserOSClickCoordinatesFunction::OnClickCoordinatesCompleted,
++          this));
++}
++
++void BrowserOSClickCoordinatesFunction::OnClickCoordinatesCompleted(
++    bool success) {
 +  // Prepare the response
 +  browser_os::InteractionResponse response;
 +  response.success = success;
 +  
-+  LOG(INFO) << "[browseros] ClickCoordinates: Result = " 
-+            << (success ? "success" : "no change detected");
++  VLOG(1) << "[browseros] ClickCoordinates: Result = " 
++          << (success ? "success" : "no change detected");
 +  
-+  return RespondNow(ArgumentList(
-+      browser_os::ClickCoordinates::Results::Create(response)));
++  FinishInteraction(std::move(response),
++                    &browser_os::ClickCoordinates::Results::Create);
 +}
 +
 +// Implementation of BrowserOSTypeAtCoordinatesFunction  
@@ -1318,26 +4494,391 @@ index 0000000000000..c08b705ef6869
 +        browser_os::TypeAtCoordinates::Results::Create(response)));
 +  }
 +  
-+  content::WebContents* web_contents = tab_info->web_contents;
++  if (auto error = InitInteraction(*tab_info, params->options)) {
++    return RespondNow(Error(*error));
++  }
 +  
 +  // Create the click point from the coordinates
 +  gfx::PointF click_point(params->x, params->y);
 +  
-+  LOG(INFO) << "[browseros] TypeAtCoordinates: Clicking at (" 
-+            << params->x << ", " << params->y << ") and typing: " << params->text;
++  VLOG(1) << "[browseros] TypeAtCoordinates: Clicking at (" 
++          << params->x << ", " << params->y << ")";
 +  
-+  // Perform the click and type operation
-+  bool success = TypeAtCoordinatesWithDetection(web_contents, click_point, params->text);
++  ScheduleInteraction(base::BindOnce(
++      &BrowserOSTypeAtCoordinatesFunction::StartTypeAtCoordinates, this,
++      click_point, std::move(params->text)));
 +  
++  return RespondLater();
++}
++
++void BrowserOSTypeAtCoordinatesFunction::StartTypeAtCoordinates(
++    gfx::PointF point,
++    std::string text) {
++  // Perform the click and type operation
++  TypeAtCoordinatesWithDetection(
++      target_web_contents(), point, text,
++      settle_policy(),
++      base::BindOnce(
++          &BrowserOSTypeAtCoordinatesFunction::OnTypeAtCoordinatesCompleted,
++          this));
++}
++
++void BrowserOSTypeAtCoordinatesFunction::OnTypeAtCoordinatesCompleted(
++    bool success) {
 +  // Prepare the response
 +  browser_os::InteractionResponse response;
 +  response.success = success;
 +  
-+  LOG(INFO) << "[browseros] TypeAtCoordinates: Result = " 
-+            << (success ? "success" : "failed");
++  VLOG(1) << "[browseros] TypeAtCoordinates: Result = " 
++          << (success ? "success" : "failed");
 +  
-+  return RespondNow(ArgumentList(
-+      browser_os::TypeAtCoordinates::Results::Create(response)));
++  FinishInteraction(std::move(response),
++                    &browser_os::TypeAtCoordinates::Results::Create);
++}
++
++// Implementation of BrowserOSDispatchInputFunction
++
++namespace {
++
++constexpr size_t kMaxInputEvents = 1000;
++constexpr int kMaxInputEventDelayMs = 10000;
++
++blink::WebPointerProperties::Button ToPointerButton(
++    browser_os::MouseButton button) {
++  switch (button) {
++    case browser_os::MouseButton::kMiddle:
++      return blink::WebPointerProperties::Button::kMiddle;
++    case browser_os::MouseButton::kRight:
++      return blink::WebPointerProperties::Button::kRight;
++    case browser_os::MouseButton::kLeft:
++    case browser_os::MouseButton::kNone:
++      return blink::WebPointerProperties::Button::kLeft;
++  }
++}
++
++// Converts one InputEvent into |step|. Returns an error if the event is
++// missing the fields its type needs.
++std::optional<std::string> ToInputStep(const browser_os::InputEvent& event,
++                                       InputStep* step) {
++  const bool has_point = event.x && event.y;
++  const gfx::PointF point(event.x.value_or(0), event.y.value_or(0));
++  const int click_count = std::max(1, event.click_count.value_or(1));
++  switch (event.type) {
++    case browser_os::InputEventType::kMouseMove:
++      *step = InputStep::MouseMove(point);
++      break;
++    case browser_os::InputEventType::kMouseDown:
++      *step = InputStep::MouseDown(point, ToPointerButton(event.button),
++                                   click_count);
++      break;
++    case browser_os::InputEventType::kMouseUp:
++      *step = InputStep::MouseUp(point, ToPointerButton(event.button),
++                                 click_count);
++      break;
++    case browser_os::InputEventType::kWheel:
++      *step = InputStep::Wheel(
++          point,
++          gfx::Vector2dF(event.delta_x.value_or(0), event.delta_y.value_or(0)),
++          event.precise.value_or(false));
++      break;
++    case browser_os::InputEventType::kKeyDown:
++    case browser_os::InputEventType::kKeyUp:
++      if (!event.key || !IsSupportedInputKey(*event.key)) {
++        return "Unsupported key: " + event.key.value_or("");
++      }
++      *step = event.type == browser_os::InputEventType::kKeyDown
++                  ? InputStep::KeyDown(*event.key)
++                  : InputStep::KeyUp(*event.key);
++      break;
++    case browser_os::InputEventType::kNone:
++      return "Missing input event type";
++  }
++  if (!has_point && step->key.empty()) {
++    return "Mouse and wheel events need x and y";
++  }
++  step->delay = base::Milliseconds(
++      std::clamp(event.delay_ms.value_or(0), 0, kMaxInputEventDelayMs));
++  return std::nullopt;
++}
++
++}  // namespace
++
++BrowserOSDispatchInputFunction::BrowserOSDispatchInputFunction() = default;
++BrowserOSDispatchInputFunction::~BrowserOSDispatchInputFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSDispatchInputFunction::Run() {
++  std::optional<browser_os::DispatchInput::Params> params =
++      browser_os::DispatchInput::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  if (params->events.size() > kMaxInputEvents) {
++    return RespondNow(Error(base::StringPrintf(
++        "At most %zu input events can be sent at once", kMaxInputEvents)));
++  }
++  steps_.reserve(params->events.size());
++  for (const auto& event : params->events) {
++    InputStep step;
++    if (auto error = ToInputStep(event, &step)) {
++      return RespondNow(Error(*error));
++    }
++    steps_.push_back(std::move(step));
++  }
++
++  if (auto error = InitInteraction(*tab_info, params->options)) {
++    return RespondNow(Error(*error));
++  }
++
++  ScheduleInteraction(base::BindOnce(
++      &BrowserOSDispatchInputFunction::StartDispatchInput, this));
++
++  return RespondLater();
++}
++
++void BrowserOSDispatchInputFunction::StartDispatchInput() {
++  content::WebContents* web_contents = target_web_contents();
++  if (!web_contents) {
++    OnInputDispatched(false);
++    return;
++  }
++  DispatchInputSteps(
++      web_contents->GetWeakPtr(), std::move(steps_),
++      base::BindOnce(&BrowserOSDispatchInputFunction::OnInputDispatched,
++                     this));
++}
++
++void BrowserOSDispatchInputFunction::OnInputDispatched(bool success) {
++  if (!success) {
++    LOG(WARNING) << "[browseros] DispatchInput: Tab could not receive input";
++  }
++
++  browser_os::InteractionResponse response;
++  response.success = success;
++  FinishInteraction(std::move(response),
++                    &browser_os::DispatchInput::Results::Create);
++}
++
++// Implementation of BrowserOSExecuteActionsFunction
++
++BrowserOSExecuteActionsFunction::BrowserOSExecuteActionsFunction() = default;
++BrowserOSExecuteActionsFunction::~BrowserOSExecuteActionsFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSExecuteActionsFunction::Run() {
++  std::optional<browser_os::ExecuteActions::Params> params =
++      browser_os::ExecuteActions::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  if (params->actions.empty()) {
++    return RespondNow(Error("No actions to execute"));
++  }
++  if (params->actions.size() > kMaxBatchActions) {
++    return RespondNow(Error("Too many actions; the maximum is " +
++                            base::NumberToString(kMaxBatchActions)));
++  }
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  web_contents_ = tab_info->web_contents->GetWeakPtr();
++  tab_id_ = tab_info->tab_id;
++  actions_ = std::move(params->actions);
++  std::optional<RequestLane> requested_lane;
++  if (params->options) {
++    detect_each_step_ = params->options->detect_each_step.value_or(false);
++    continue_on_error_ = params->options->continue_on_error.value_or(false);
++    settle_policy_ = SettlePolicyFromOptions(params->options->interaction);
++    if (params->options->interaction) {
++      requested_lane = ToRequestLane(params->options->interaction->priority);
++    }
++  }
++  results_.reserve(actions_.size());
++
++  VLOG(1) << "[browseros] ExecuteActions: " << actions_.size()
++          << " steps, detection "
++          << (detect_each_step_ ? "per step" : "after last step");
++
++  // The whole batch holds the tab, so other calls cannot interleave with it
++  BrowserOSActionScheduler::GetInstance()->Enqueue(
++      tab_id_,
++      base::BindOnce(&BrowserOSExecuteActionsFunction::OnSlotAcquired, this),
++      BrowserOSTabPriority::ResolveLane(tab_info->web_contents,
++                                        requested_lane));
++  // Steps that complete synchronously may already have responded
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSExecuteActionsFunction::OnSlotAcquired(base::OnceClosure done) {
++  action_slot_ = base::ScopedClosureRunner(std::move(done));
++  RunNextStep();
++}
++
++void BrowserOSExecuteActionsFunction::RunNextStep() {
++  const bool stop = !results_.empty() && !results_.back().success &&
++                    results_.back().error && !continue_on_error_;
++  if (next_step_ >= actions_.size() || stop) {
++    browser_os::ExecuteActionsResponse response;
++    response.success = results_.size() == actions_.size();
++    for (const auto& result : results_) {
++      response.success &= result.success;
++    }
++    response.results = std::move(results_);
++    action_slot_.RunAndReset();
++    Respond(ArgumentList(
++        browser_os::ExecuteActions::Results::Create(response)));
++    return;
++  }
++
++  const size_t step = next_step_++;
++  const bool detect = detect_each_step_ || next_step_ == actions_.size();
++
++  std::optional<std::string> error;
++  if (!web_contents_) {
++    error = "Tab was closed";
++  } else {
++    error = StartStep(actions_[step], detect);
++  }
++
++  if (error) {
++    LOG(WARNING) << "[browseros] ExecuteActions: step " << step
++                 << " failed: " << *error;
++    browser_os::ActionResult result;
++    result.success = false;
++    result.error = std::move(*error);
++    results_.push_back(std::move(result));
++    // Nothing more can run once the tab is gone
++    if (!web_contents_) {
++      continue_on_error_ = false;
++    }
++    RunNextStep();
++  }
++}
++
++std::optional<std::string> BrowserOSExecuteActionsFunction::StartStep(
++    const browser_os::Action& action,
++    bool detect) {
++  content::WebContents* web_contents = web_contents_.get();
++  auto on_detected =
++      base::BindOnce(&BrowserOSExecuteActionsFunction::OnStepCompleted, this);
++  auto on_dispatched = base::BindOnce(
++      &BrowserOSExecuteActionsFunction::OnStepCompleted, this, true);
++
++  // Resolve the target node for node-based steps
++  const NodeInfo* node_info = nullptr;
++  switch (action.type) {
++    case browser_os::ActionType::kClick:
++    case browser_os::ActionType::kInputText:
++    case browser_os::ActionType::kClear:
++    case browser_os::ActionType::kScrollToNode: {
++      if (!action.node_id) {
++        return "nodeId is required for " +
++               std::string(browser_os::ToString(action.type));
++      }
++      std::string error;
++      node_info =
++          FindNodeInfo(web_contents_.get(), *action.node_id, &error);
++      if (!node_info) {
++        return error;
++      }
++      break;
++    }
++    default:
++      break;
++  }
++
++  switch (action.type) {
++    case browser_os::ActionType::kClick:
++      if (detect) {
++        ClickWithDetection(web_contents, *node_info, settle_policy_,
++                           std::move(on_detected));
++      } else {
++        ClickNode(web_contents, *node_info, std::move(on_dispatched));
++      }
++      return std::nullopt;
++
++    case browser_os::ActionType::kInputText:
++      if (!action.text) {
++        return "text is required for inputText";
++      }
++      if (detect) {
++        TypeWithDetection(web_contents, *node_info, *action.text,
++                          settle_policy_, std::move(on_detected));
++      } else {
++        TypeIntoNode(web_contents, *node_info, *action.text,
++                     std::move(on_dispatched));
++      }
++      return std::nullopt;
++
++    case browser_os::ActionType::kClear:
++      if (detect) {
++        ClearWithDetection(web_contents, *node_info, settle_policy_,
++                           std::move(on_detected));
++      } else {
++        HtmlClear(web_contents, *node_info);
++        std::move(on_dispatched).Run();
++      }
++      return std::nullopt;
++
++    case browser_os::ActionType::kSendKeys:
++      if (!action.key || !IsSupportedKey(*action.key)) {
++        return "Unsupported key: " + action.key.value_or("");
++      }
++      if (detect) {
++        KeyPressWithDetection(web_contents, *action.key, settle_policy_,
++                              std::move(on_detected));
++      } else {
++        KeyPress(web_contents, *action.key);
++        std::move(on_dispatched).Run();
++      }
++      return std::nullopt;
++
++    case browser_os::ActionType::kScrollUp:
++    case browser_os::ActionType::kScrollDown: {
++      const bool down = action.type == browser_os::ActionType::kScrollDown;
++      if (detect) {
++        BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++            web_contents,
++            [web_contents, down]() { ScrollByPage(web_contents, down); },
++            std::move(on_detected), base::Milliseconds(300), settle_policy_);
++        return std::nullopt;
++      }
++      if (!ScrollByPage(web_contents, down)) {
++        return "No render widget host view";
++      }
++      std::move(on_dispatched).Run();
++      return std::nullopt;
++    }
++
++    case browser_os::ActionType::kScrollToNode:
++      // Scrolling is confirmed by its own wait; no detection window needed
++      ScrollNodeIntoView(web_contents, *node_info, std::move(on_dispatched));
++      return std::nullopt;
++
++    case browser_os::ActionType::kNone:
++      break;
++  }
++  return "Unknown action type";
++}
++
++void BrowserOSExecuteActionsFunction::OnStepCompleted(bool success) {
++  VLOG(1) << "[browseros] ExecuteActions: step " << results_.size()
++          << (success ? " succeeded" : " had no effect");
++  browser_os::ActionResult result;
++  result.success = success;
++  results_.push_back(std::move(result));
++  RunNextStep();
 +}
 +
 +// BrowserOSChoosePathFunction implementation
@@ -1439,5 +4980,159 @@ index 0000000000000..c08b705ef6869
 +  Release();
 +}
 +
++// Implementation of BrowserOSSetInputFilesFunction
++
++namespace {
++
++// Returns why |paths| can't be uploaded, if they can't. Runs on the
++// ThreadPool.
++std::optional<std::string> CheckInputFiles(
++    const std::vector<base::FilePath>& paths) {
++  for (const base::FilePath& path : paths) {
++    if (!base::PathExists(path) || base::DirectoryExists(path)) {
++      return "Not an existing file: " + path.AsUTF8Unsafe();
++    }
++  }
++  return std::nullopt;
++}
++
++}  // namespace
++
++BrowserOSSetInputFilesFunction::BrowserOSSetInputFilesFunction() = default;
++BrowserOSSetInputFilesFunction::~BrowserOSSetInputFilesFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSSetInputFilesFunction::Run() {
++  std::optional<browser_os::SetInputFiles::Params> params =
++      browser_os::SetInputFiles::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  if (auto error = InitInteraction(*tab_info, params->options)) {
++    return RespondNow(Error(*error));
++  }
++
++  const NodeInfo* node_info =
++      FindNodeInfo(tab_info->web_contents, params->node_id,
++                   &error_message);
++  if (!node_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  for (const std::string& path : params->paths) {
++    base::FilePath file_path = base::FilePath::FromUTF8Unsafe(path);
++    if (!file_path.IsAbsolute()) {
++      return RespondNow(Error("Paths must be absolute: " + path));
++    }
++    paths_.push_back(std::move(file_path));
++  }
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&CheckInputFiles, paths_),
++      base::BindOnce(&BrowserOSSetInputFilesFunction::OnPathsChecked, this,
++                     *node_info));
++  return RespondLater();
++}
++
++void BrowserOSSetInputFilesFunction::OnPathsChecked(
++    NodeInfo node_info,
++    std::optional<std::string> error) {
++  if (error) {
++    Respond(Error(*error));
++    return;
++  }
++  ScheduleInteraction(
++      base::BindOnce(&BrowserOSSetInputFilesFunction::StartSetFiles, this,
++                     std::move(node_info)));
++}
++
++void BrowserOSSetInputFilesFunction::StartSetFiles(NodeInfo node_info) {
++  BrowserOSInputFilesSetter::Set(
++      target_web_contents(), node_info, paths_,
++      base::BindOnce(&BrowserOSSetInputFilesFunction::OnFilesSet, this));
++}
++
++void BrowserOSSetInputFilesFunction::OnFilesSet(
++    std::optional<std::string> error) {
++  if (error) {
++    Respond(Error(*error));
++    return;
++  }
++
++  browser_os::InteractionResponse response;
++  response.success = true;
++  FinishInteraction(std::move(response),
++                    &browser_os::SetInputFiles::Results::Create);
++}
++
++// Implementation of BrowserOSDownloadFunction
++
++BrowserOSDownloadFunction::BrowserOSDownloadFunction() = default;
++BrowserOSDownloadFunction::~BrowserOSDownloadFunction() = default;
++
++ExtensionFunction::ResponseAction BrowserOSDownloadFunction::Run() {
++  std::optional<browser_os::Download::Params> params =
++      browser_os::Download::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  GURL url(params->url);
++  if (!url.is_valid()) {
++    return RespondNow(Error("Invalid URL: " + params->url));
++  }
++
++  base::FilePath path;
++  if (params->options) {
++    if (params->options->path) {
++      path = base::FilePath::FromUTF8Unsafe(*params->options->path);
++      if (!path.IsAbsolute()) {
++        return RespondNow(Error("Path must be absolute: " +
++                                *params->options->path));
++      }
++    }
++    wait_for_completion_ =
++        params->options->wait_for_completion.value_or(false);
++  }
++
++  BrowserOSDownloadTracker::Start(
++      tab_info->web_contents, url, path,
++      base::BindOnce(&BrowserOSDownloadFunction::OnDownloadStarted, this),
++      wait_for_completion_
++          ? base::BindOnce(&BrowserOSDownloadFunction::OnDownloadFinished,
++                           this)
++          : BrowserOSDownloadTracker::FinishedCallback());
++  return RespondLater();
++}
++
++void BrowserOSDownloadFunction::OnDownloadStarted(
++    base::expected<browser_os::DownloadInfo, std::string> download) {
++  if (!download.has_value()) {
++    Respond(Error(download.error()));
++    return;
++  }
++  if (!wait_for_completion_) {
++    Respond(ArgumentList(browser_os::Download::Results::Create(*download)));
++  }
++}
++
++void BrowserOSDownloadFunction::OnDownloadFinished(
++    const browser_os::DownloadInfo& download) {
++  Respond(ArgumentList(browser_os::Download::Results::Create(download)));
++}
++
 +}  // namespace api
 +}  // namespace extensions
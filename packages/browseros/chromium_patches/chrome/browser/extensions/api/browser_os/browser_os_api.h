@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.h b/chrome/browser/extensions/api/browser_os/browser_os_api.h
 new file mode 100644
-index 0000000000000..2e2f5f0253f86
+index 0000000000000..4cd1e522f4867
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.h
-@@ -0,0 +1,369 @@
+@@ -0,0 +1,1376 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,14 +12,36 @@ index 0000000000000..2e2f5f0253f86
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_H_
 +
 +#include <cstdint>
-+
++#include <memory>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/containers/flat_set.h"
++#include "base/files/file_path.h"
++#include "base/functional/callback_helpers.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/types/expected.h"
 +#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_ax_snapshot_cache.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_history.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_input_dispatch.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_state.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_request_priority.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
 +#include "extensions/browser/extension_function.h"
++#include "extensions/browser/script_executor.h"
 +#include "third_party/skia/include/core/SkBitmap.h"
++#include "ui/gfx/geometry/point_f.h"
++#include "ui/gfx/geometry/rect.h"
 +#include "ui/shell_dialogs/select_file_dialog.h"
 +
 +namespace content {
@@ -48,7 +70,18 @@ index 0000000000000..2e2f5f0253f86
 +  ResponseAction Run() override;
 +
 + private:
-+  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++  // Requests the tree once BrowserOSCallLimiter gave the call a slot
++  void OnCallAdmitted(base::ScopedClosureRunner slot);
++  void OnAccessibilityTreeReceived(browseros::SharedAXTreeUpdate snapshot);
++  void OnAccessibilityTreeSerialized(base::Value::Dict tree);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  bool include_inline_text_boxes_ = false;
++  bool compact_ = false;
++  // Attribute names to keep; unset keeps all
++  std::optional<base::flat_set<std::string>> attribute_filter_;
++  // BrowserOSCallLimiter slot, held for the rest of the call
++  base::ScopedClosureRunner call_slot_;
 +};
 +
 +class BrowserOSGetInteractiveSnapshotFunction : public ExtensionFunction {
@@ -58,15 +91,47 @@ index 0000000000000..2e2f5f0253f86
 +
 +  BrowserOSGetInteractiveSnapshotFunction();
 +
++  // Hands out the next snapshotId, shared by every function that returns
++  // an InteractiveSnapshot
++  static uint32_t AllocateSnapshotId() { return next_snapshot_id_++; }
++
 + protected:
 +  ~BrowserOSGetInteractiveSnapshotFunction() override;
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++  void OnBrowserContextShutdown() override;
++
++  // Shared by getInteractiveSnapshot and getInteractiveSnapshotStream
++  ResponseAction StartSnapshot(
++      std::optional<int> tab_id,
++      const std::optional<browser_os::InteractiveSnapshotOptions>& options);
++
++  // Builds the function's result from the finished snapshot
++  virtual base::Value::List CreateResults(
++      const browser_os::InteractiveSnapshot& snapshot);
++
++  // Returns a callback to stream nodes batch by batch; null by default
++  virtual SnapshotProcessor::ChunkCallback CreateChunkCallback(
++      uint32_t snapshot_id);
++
++  // Whether the call may share an identical snapshot of the tab that is
++  // already being taken (see BrowserOSSnapshotTracker)
++  virtual bool CanCoalesce() const;
 +
 + private:
-+  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++  // Requests the tree once BrowserOSCallLimiter gave the call a slot
++  void OnCallAdmitted(base::ScopedClosureRunner slot);
++  void OnAccessibilityTreeReceived(browseros::SharedAXTreeUpdate snapshot);
 +  void OnSnapshotProcessed(SnapshotProcessingResult result);
++  // Answers a coalesced call with the snapshot it waited for
++  void OnPendingSnapshotReady(const browser_os::InteractiveSnapshot* snapshot);
++  // Hands the result to the calls coalesced with this one, if any
++  void FinishPendingSnapshot(const browser_os::InteractiveSnapshot* snapshot);
++  // Responds with |snapshot|, packed first if a wire format was requested
++  void RespondWithSnapshot(browser_os::InteractiveSnapshot snapshot);
++  void OnSnapshotPacked(
++      base::expected<browser_os::InteractiveSnapshot, std::string> snapshot);
 +  
 +  // Counter for snapshot IDs
 +  static uint32_t next_snapshot_id_;
@@ -76,9 +141,275 @@ index 0000000000000..2e2f5f0253f86
 +  
 +  // Web contents for processing and drawing
 +  base::WeakPtr<content::WebContents> web_contents_;
++
++  // Viewport scoping and node/byte budgets from the options
++  SnapshotOptions snapshot_options_;
++
++  // Set if the result goes out in the compact wire form
++  std::optional<browser_os::WireCompression> wire_compression_;
++
++  // Set on navigation, tab close, cancelRequest or shutdown
++  scoped_refptr<RequestCancellation> cancellation_;
++
++  // Incremental snapshot state (see BrowserOSSnapshotTracker)
++  bool stable_node_ids_ = false;
++  bool incremental_ = false;
++  std::optional<uint32_t> base_snapshot_id_;
++  uint64_t request_generation_ = 0;
++
++  // Set while identical calls may join this one
++  std::string pending_snapshot_key_;
++
++  // Keeps a hidden tab rendering for the snapshot
++  base::ScopedClosureRunner rendering_hold_;
++  // BrowserOSCallLimiter slot, held for the rest of the call
++  base::ScopedClosureRunner call_slot_;
++
++  // For the Latency histogram
++  const base::TimeTicks start_time_ = base::TimeTicks::Now();
++  // Phases for chrome://browseros-internals
++  browseros::ProfiledCall profiled_call_;
++};
++
++// Takes interactive snapshots of several tabs concurrently: every tree is
++// requested up front and processed on the ThreadPool in parallel.
++class BrowserOSGetInteractiveSnapshotsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getInteractiveSnapshots",
++                             BROWSER_OS_GETINTERACTIVESNAPSHOTS)
++
++  BrowserOSGetInteractiveSnapshotsFunction();
++
++ protected:
++  ~BrowserOSGetInteractiveSnapshotsFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++  void OnBrowserContextShutdown() override;
++
++ private:
++  void OnAccessibilityTreeReceived(size_t index,
++                                   browseros::SharedAXTreeUpdate snapshot);
++  void OnSnapshotProcessed(size_t index, SnapshotProcessingResult result);
++
++  // Stores the snapshot of tab |index| and responds once every tab has one
++  void SetSnapshot(size_t index, browser_os::InteractiveSnapshot snapshot);
++  void SetError(size_t index, std::string error);
++  void OnTabDone();
++
++  // Web contents per requested tab, in the order of |results_|
++  std::vector<base::WeakPtr<content::WebContents>> web_contents_;
++  // Keep hidden tabs rendering until every snapshot is done
++  std::vector<base::ScopedClosureRunner> rendering_holds_;
++  std::vector<browser_os::TabInteractiveSnapshot> results_;
++  // Per tab, so navigating one tab only cancels its own snapshot
++  std::vector<scoped_refptr<RequestCancellation>> cancellations_;
++  size_t pending_tabs_ = 0;
++
++  SnapshotOptions snapshot_options_;
++  // Lane from the options; each tab's own priority applies if unset
++  std::optional<RequestLane> requested_lane_;
++  bool stable_node_ids_ = false;
++};
++
++// Streams a snapshot through browserOS.onInteractiveSnapshotChunk events as
++// batches finish, then responds with a summary.
++class BrowserOSGetInteractiveSnapshotStreamFunction
++    : public BrowserOSGetInteractiveSnapshotFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getInteractiveSnapshotStream",
++                             BROWSER_OS_GETINTERACTIVESNAPSHOTSTREAM)
++
++  BrowserOSGetInteractiveSnapshotStreamFunction() = default;
++
++ protected:
++  ~BrowserOSGetInteractiveSnapshotStreamFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++  // BrowserOSGetInteractiveSnapshotFunction:
++  base::Value::List CreateResults(
++      const browser_os::InteractiveSnapshot& snapshot) override;
++  SnapshotProcessor::ChunkCallback CreateChunkCallback(
++      uint32_t snapshot_id) override;
++  // Waiting callers would miss the chunk events
++  bool CanCoalesce() const override;
++
++ private:
++  void OnChunkReady(uint32_t snapshot_id,
++                    size_t chunk_index,
++                    std::vector<browser_os::InteractiveNode> nodes);
++
++  int chunk_count_ = 0;
++  int node_count_ = 0;
++};
++
++// Waits until a node matching a query shows up in the tab. The page is
++// re-snapshotted only when its accessibility tree changes, never polled.
++class BrowserOSWaitForNodeFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.waitForNode", BROWSER_OS_WAITFORNODE)
++
++  BrowserOSWaitForNodeFunction();
++
++ protected:
++  ~BrowserOSWaitForNodeFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  // Snapshots the tab and looks for a match, unless a check is running
++  void CheckForNode();
++  void OnAccessibilityTreeReceived(browseros::SharedAXTreeUpdate snapshot);
++  void OnSnapshotProcessed(SnapshotProcessingResult result);
++  void OnTimeout();
++
++  // Stops watching the tab and responds
++  void Finish(ResponseValue response);
++
++  int tab_id_ = -1;
++  base::WeakPtr<content::WebContents> web_contents_;
++  browser_os::NodeQuery query_;
++  std::unique_ptr<BrowserOSTreeChangeWatcher> watcher_;
++
++  // A snapshot is being taken, and whether the tree changed again meanwhile
++  bool checking_ = false;
++  bool recheck_needed_ = false;
++};
++
++// Answers element queries from the tab's cached interactive snapshot,
++// without reading the accessibility tree again.
++class BrowserOSFindNodesFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.findNodes", BROWSER_OS_FINDNODES)
++
++  BrowserOSFindNodesFunction() = default;
++
++ protected:
++  ~BrowserOSFindNodesFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
 +};
 +
-+class BrowserOSClickFunction : public ExtensionFunction {
++class BrowserOSGetNodeStateFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getNodeState",
++                             BROWSER_OS_GETNODESTATE)
++
++  BrowserOSGetNodeStateFunction();
++
++ protected:
++  ~BrowserOSGetNodeStateFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnAccessibilityTreeReceived(browseros::SharedAXTreeUpdate snapshot);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  std::vector<int> node_ids_;
++};
++
++class BrowserOSDiffSnapshotsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.diffSnapshots",
++                             BROWSER_OS_DIFFSNAPSHOTS)
++
++  BrowserOSDiffSnapshotsFunction() = default;
++
++ protected:
++  ~BrowserOSDiffSnapshotsFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSCancelRequestFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.cancelRequest",
++                             BROWSER_OS_CANCELREQUEST)
++
++  BrowserOSCancelRequestFunction() = default;
++
++ protected:
++  ~BrowserOSCancelRequestFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++// Base for the interaction methods that take InteractionOptions. Holds the
++// settle policy and, with returnSnapshot, captures an interactive snapshot
++// once the action has finished so agents get both in one call.
++class BrowserOSInteractionFunction : public ExtensionFunction {
++ protected:
++  // Generated Results::Create of the concrete function
++  using ResultsFactory =
++      base::Value::List (*)(const browser_os::InteractionResponse&);
++
++  BrowserOSInteractionFunction();
++  ~BrowserOSInteractionFunction() override;
++
++  // Records the target tab and reads |options|. Returns an error if the
++  // options are invalid.
++  std::optional<std::string> InitInteraction(
++      const TabInfo& tab_info,
++      const std::optional<browser_os::InteractionOptions>& options);
++
++  const SettlePolicy& settle_policy() const { return settle_policy_; }
++
++  // Target tab; null if it was closed while the action was queued
++  content::WebContents* target_web_contents() const {
++    return web_contents_.get();
++  }
++  int target_tab_id() const { return tab_id_; }
++
++  // Runs |start| through BrowserOSActionScheduler once earlier actions on
++  // the tab have finished. The tab stays reserved until this responds.
++  void ScheduleInteraction(base::OnceClosure start);
++
++  // Responds with |response|, after attaching the observed changes and a
++  // snapshot if one was requested
++  void FinishInteraction(browser_os::InteractionResponse response,
++                         ResultsFactory create_results);
++
++ private:
++  void OnSlotAcquired(base::OnceClosure start, base::OnceClosure done);
++  void OnAccessibilityTreeReceived(browseros::SharedAXTreeUpdate snapshot);
++  void OnSnapshotProcessed(SnapshotProcessingResult result);
++  void RespondWithPendingResponse();
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  int tab_id_ = -1;
++  SettlePolicy settle_policy_;
++  RequestLane lane_ = RequestLane::kInteractive;
++  // Releases the tab's scheduler slot; also runs if this is destroyed
++  // without responding
++  base::ScopedClosureRunner action_slot_;
++  // Records InteractionResponse.changes while the action runs
++  std::unique_ptr<BrowserOSChangeRecorder> change_recorder_;
++
++  // returnSnapshot state
++  bool return_snapshot_ = false;
++  bool stable_node_ids_ = false;
++  bool incremental_ = false;
++  std::optional<uint32_t> base_snapshot_id_;
++  uint64_t request_generation_ = 0;
++  SnapshotOptions snapshot_options_;
++  browser_os::InteractionResponse pending_response_;
++  ResultsFactory create_results_ = nullptr;
++
++  // For the Latency histogram; includes time queued behind earlier actions
++  const base::TimeTicks start_time_ = base::TimeTicks::Now();
++  // Phases for chrome://browseros-internals
++  browseros::ProfiledCall profiled_call_;
++};
++
++class BrowserOSClickFunction : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.click", BROWSER_OS_CLICK)
 +
@@ -89,9 +420,13 @@ index 0000000000000..2e2f5f0253f86
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void StartClick(NodeInfo node_info);
++  void OnClickCompleted(bool change_detected);
 +};
 +
-+class BrowserOSInputTextFunction : public ExtensionFunction {
++class BrowserOSInputTextFunction : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.inputText", BROWSER_OS_INPUTTEXT)
 +
@@ -102,9 +437,13 @@ index 0000000000000..2e2f5f0253f86
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void StartInputText(NodeInfo node_info, std::string text);
++  void OnInputTextCompleted(bool change_detected);
 +};
 +
-+class BrowserOSClearFunction : public ExtensionFunction {
++class BrowserOSClearFunction : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.clear", BROWSER_OS_CLEAR)
 +
@@ -115,6 +454,10 @@ index 0000000000000..2e2f5f0253f86
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void StartClear(NodeInfo node_info);
++  void OnClearCompleted(bool change_detected);
 +};
 +
 +class BrowserOSGetPageLoadStatusFunction : public ExtensionFunction {
@@ -131,7 +474,51 @@ index 0000000000000..2e2f5f0253f86
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSScrollUpFunction : public ExtensionFunction {
++class BrowserOSWaitForLoadStateFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.waitForLoadState",
++                             BROWSER_OS_WAITFORLOADSTATE)
++
++  BrowserOSWaitForLoadStateFunction();
++
++ protected:
++  ~BrowserOSWaitForLoadStateFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnLoadStateReached(BrowserOSPageState::WaitResult result);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++};
++
++// Shared implementation of scrollUp and scrollDown. Scrolls by about one
++// viewport height, waits for the scroll to come to rest and reports the new
++// viewport state.
++class BrowserOSScrollPageFunction : public BrowserOSInteractionFunction {
++ protected:
++  BrowserOSScrollPageFunction();
++  ~BrowserOSScrollPageFunction() override;
++
++  ResponseAction RunScroll(
++      std::optional<int> tab_id,
++      const std::optional<browser_os::InteractionOptions>& options,
++      bool down,
++      ResultsFactory create_results);
++
++ private:
++  void StartScroll();
++  void OnStartStateRead(base::Value result);
++  void OnScrollSettled(bool scrolled);
++  void OnViewportStateRead(base::Value result);
++
++  bool down_ = false;
++  bool scrolled_ = false;
++  ResultsFactory scroll_results_ = nullptr;
++};
++
++class BrowserOSScrollUpFunction : public BrowserOSScrollPageFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.scrollUp", BROWSER_OS_SCROLLUP)
 +
@@ -144,7 +531,7 @@ index 0000000000000..2e2f5f0253f86
 +  ResponseAction Run() override;
 +};
 +
-+class BrowserOSScrollDownFunction : public ExtensionFunction {
++class BrowserOSScrollDownFunction : public BrowserOSScrollPageFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.scrollDown", BROWSER_OS_SCROLLDOWN)
 +
@@ -168,9 +555,18 @@ index 0000000000000..2e2f5f0253f86
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void OnStartStateRead(base::Value result);
++  void OnScrollSettled();
++  void OnViewportStateRead(base::Value result);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  int tab_id_ = -1;
++  int node_id_ = 0;
 +};
 +
-+class BrowserOSSendKeysFunction : public ExtensionFunction {
++class BrowserOSSendKeysFunction : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.sendKeys", BROWSER_OS_SENDKEYS)
 +
@@ -181,6 +577,10 @@ index 0000000000000..2e2f5f0253f86
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void StartSendKeys(std::string key);
++  void OnSendKeysCompleted(bool change_detected);
 +};
 +
 +class BrowserOSCaptureScreenshotFunction : public ExtensionFunction {
@@ -194,18 +594,487 @@ index 0000000000000..2e2f5f0253f86
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++  void OnBrowserContextShutdown() override;
++
++  // Shared by captureScreenshot and captureScreenshotBinary
++  ResponseAction StartCapture(
++      std::optional<int> tab_id,
++      std::optional<int> thumbnail_size,
++      std::optional<bool> show_highlights,
++      std::optional<int> width,
++      std::optional<int> height,
++      const std::optional<browser_os::ScreenshotOptions>& options);
++
++  // Whether the encoding task should also build a base64 data URL
++  virtual bool WantsDataUrl() const;
++
++  // Builds the function's result from the encoded screenshot
++  virtual base::Value::List CreateResults(EncodedScreenshot screenshot);
 +  
 + private:
-+  void DrawHighlightsAndCapture();
++  // Captures once BrowserOSCallLimiter gave the call a slot
++  void OnCallAdmitted(base::ScopedClosureRunner slot);
 +  void CaptureScreenshotNow();
++  // Runs once the tab's action slot is free; |done| releases it
++  void StartFullPageCapture(base::OnceClosure done);
++  void OnFullPageCaptured(const SkBitmap& bitmap);
 +  void OnScreenshotCaptured(const SkBitmap& bitmap);
++  void OnScreenshotHashed(const SkBitmap& bitmap,
++                          std::vector<ScreenshotHighlight> highlights,
++                          const gfx::Vector2dF& css_to_bitmap,
++                          uint32_t pixel_hash);
++  void OnScreenshotEncoded(std::optional<EncodedScreenshot> screenshot);
 +  
 +  // Store web contents and tab id for highlight operations
 +  base::WeakPtr<content::WebContents> web_contents_;
 +  int tab_id_ = -1;
 +  gfx::Size target_size_;
++  // Size a contain fit is letterboxed to after the readback; empty if none
++  gfx::Size output_size_;
++  // Region to copy in view DIPs; empty copies the whole view
++  gfx::Rect source_rect_;
 +  bool show_highlights_ = false;
 +  bool use_exact_dimensions_ = false;
++  bool full_page_ = false;
++  // View size and CSS-to-DIP scale at capture time, to map highlight bounds
++  // onto the bitmap
++  gfx::Size view_size_;
++  float css_to_widget_scale_ = 1.0f;
++  browser_os::ImageFormat format_ = browser_os::ImageFormat::kPng;
++  int quality_ = 80;
++  // Identifies the capture being encoded, for the tab's screenshot cache
++  ScreenshotCacheKey cache_key_;
++  // Set while a fullPage capture is scrolling through the page
++  std::unique_ptr<BrowserOSFullPageCapture> full_page_capture_;
++  base::ScopedClosureRunner full_page_slot_;
++  // BrowserOSCallLimiter slot, held for the rest of the call
++  base::ScopedClosureRunner call_slot_;
++  // Keeps a hidden tab rendering until the capture is done
++  base::ScopedClosureRunner rendering_hold_;
++  // Set on navigation, tab close, cancelRequest or shutdown
++  scoped_refptr<RequestCancellation> cancellation_;
++  // Of the hashing and encoding tasks
++  base::TaskPriority task_priority_ = base::TaskPriority::USER_VISIBLE;
++  int capture_attempts_ = 0;
++  // For the Latency histogram
++  const base::TimeTicks start_time_ = base::TimeTicks::Now();
++  // Phases for chrome://browseros-internals
++  browseros::ProfiledCall profiled_call_;
++};
++
++// Returns the encoded screenshot bytes as an ArrayBuffer, skipping base64
++class BrowserOSCaptureScreenshotBinaryFunction
++    : public BrowserOSCaptureScreenshotFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.captureScreenshotBinary",
++                             BROWSER_OS_CAPTURESCREENSHOTBINARY)
++
++  BrowserOSCaptureScreenshotBinaryFunction() = default;
++
++ protected:
++  ~BrowserOSCaptureScreenshotBinaryFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++  // BrowserOSCaptureScreenshotFunction:
++  bool WantsDataUrl() const override;
++  base::Value::List CreateResults(EncodedScreenshot screenshot) override;
++};
++
++// Captures an interactive snapshot and a screenshot of the same frame.
++// Both are requested in one task while the tab's action slot is held, so
++// no interaction runs in between; BrowserOSSnapshotTracker's change count
++// tells whether the page changed anyway, in which case the pair is taken
++// again.
++class BrowserOSCapturePageStateFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.capturePageState",
++                             BROWSER_OS_CAPTUREPAGESTATE)
++
++  BrowserOSCapturePageStateFunction();
++
++ protected:
++  ~BrowserOSCapturePageStateFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++  void OnBrowserContextShutdown() override;
++
++ private:
++  // Queues for the tab once BrowserOSCallLimiter gave the call a slot
++  void OnCallAdmitted(base::ScopedClosureRunner slot);
++  // Called by BrowserOSActionScheduler once the tab is free
++  void OnSlotAcquired(base::OnceClosure done);
++
++  // Requests the tree and the surface copy together
++  void StartAttempt();
++  void CopySurface();
++
++  void OnAccessibilityTreeReceived(uint32_t attempt,
++                                   browseros::SharedAXTreeUpdate snapshot);
++  void OnSnapshotProcessed(uint32_t attempt, SnapshotProcessingResult result);
++  void OnScreenshotCaptured(uint32_t attempt, const SkBitmap& bitmap);
++  // Encodes |bitmap_|, with the highlights of |snapshot_| if requested
++  void EncodeBitmap();
++  void OnScreenshotEncoded(uint32_t attempt,
++                           std::optional<EncodedScreenshot> screenshot);
++
++  // Responds once both halves are in, or starts another attempt if the page
++  // changed meanwhile
++  void MaybeFinish();
++  void Fail(std::string error);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  int tab_id_ = -1;
++  SnapshotOptions snapshot_options_;
++  bool stable_node_ids_ = false;
++  bool show_highlights_ = false;
++  std::optional<int> thumbnail_size_;
++  browser_os::ImageFormat format_ = browser_os::ImageFormat::kPng;
++  int quality_ = 80;
++  base::TaskPriority task_priority_ = base::TaskPriority::USER_VISIBLE;
++  RequestLane lane_ = RequestLane::kInteractive;
++  scoped_refptr<RequestCancellation> cancellation_;
++
++  // Counts attempts; results of an earlier attempt are dropped
++  uint32_t attempt_ = 0;
++  int copy_attempts_ = 0;
++  // BrowserOSSnapshotTracker::generation() when the attempt started
++  uint64_t request_generation_ = 0;
++  // View size and CSS-to-DIP scale at capture time, for the highlights
++  gfx::Size view_size_;
++  float css_to_widget_scale_ = 1.0f;
++
++  std::optional<browser_os::InteractiveSnapshot> snapshot_;
++  SkBitmap bitmap_;
++  std::optional<EncodedScreenshot> screenshot_;
++
++  // Holds the tab, and keeps a hidden tab rendering, until the capture is
++  // done
++  base::ScopedClosureRunner action_slot_;
++  base::ScopedClosureRunner rendering_hold_;
++  // BrowserOSCallLimiter slot, held for the rest of the call
++  base::ScopedClosureRunner call_slot_;
++  // For the Latency histogram
++  const base::TimeTicks start_time_ = base::TimeTicks::Now();
++  // Phases for chrome://browseros-internals
++  browseros::ProfiledCall profiled_call_;
++};
++
++class BrowserOSStartScreencastFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.startScreencast",
++                             BROWSER_OS_STARTSCREENCAST)
++
++  BrowserOSStartScreencastFunction() = default;
++
++ protected:
++  ~BrowserOSStartScreencastFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSStopScreencastFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.stopScreencast",
++                             BROWSER_OS_STOPSCREENCAST)
++
++  BrowserOSStopScreencastFunction() = default;
++
++ protected:
++  ~BrowserOSStopScreencastFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSAckScreencastFrameFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.ackScreencastFrame",
++                             BROWSER_OS_ACKSCREENCASTFRAME)
++
++  BrowserOSAckScreencastFrameFunction() = default;
++
++ protected:
++  ~BrowserOSAckScreencastFrameFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSStartAccessibilityStreamFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.startAccessibilityStream",
++                             BROWSER_OS_STARTACCESSIBILITYSTREAM)
++
++  BrowserOSStartAccessibilityStreamFunction() = default;
++
++ protected:
++  ~BrowserOSStartAccessibilityStreamFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSStopAccessibilityStreamFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.stopAccessibilityStream",
++                             BROWSER_OS_STOPACCESSIBILITYSTREAM)
++
++  BrowserOSStopAccessibilityStreamFunction() = default;
++
++ protected:
++  ~BrowserOSStopAccessibilityStreamFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSStartAudioCaptureFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.startAudioCapture",
++                             BROWSER_OS_STARTAUDIOCAPTURE)
++
++  BrowserOSStartAudioCaptureFunction() = default;
++
++ protected:
++  ~BrowserOSStartAudioCaptureFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnStarted(std::optional<std::string> error);
++};
++
++class BrowserOSStopAudioCaptureFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.stopAudioCapture",
++                             BROWSER_OS_STOPAUDIOCAPTURE)
++
++  BrowserOSStopAudioCaptureFunction() = default;
++
++ protected:
++  ~BrowserOSStopAudioCaptureFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSStartActionRecordingFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.startActionRecording",
++                             BROWSER_OS_STARTACTIONRECORDING)
++
++  BrowserOSStartActionRecordingFunction() = default;
++
++ protected:
++  ~BrowserOSStartActionRecordingFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSStopActionRecordingFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.stopActionRecording",
++                             BROWSER_OS_STOPACTIONRECORDING)
++
++  BrowserOSStopActionRecordingFunction() = default;
++
++ protected:
++  ~BrowserOSStopActionRecordingFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSSaveActionScriptFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.saveActionScript",
++                             BROWSER_OS_SAVEACTIONSCRIPT)
++
++  BrowserOSSaveActionScriptFunction() = default;
++
++ protected:
++  ~BrowserOSSaveActionScriptFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSGetActionScriptsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getActionScripts",
++                             BROWSER_OS_GETACTIONSCRIPTS)
++
++  BrowserOSGetActionScriptsFunction() = default;
++
++ protected:
++  ~BrowserOSGetActionScriptsFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSDeleteActionScriptFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.deleteActionScript",
++                             BROWSER_OS_DELETEACTIONSCRIPT)
++
++  BrowserOSDeleteActionScriptFunction() = default;
++
++ protected:
++  ~BrowserOSDeleteActionScriptFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++// Replays a saved action script. Each step re-snapshots the tab and matches
++// its target by description, waiting on accessibility changes until a node
++// matches or the step times out.
++class BrowserOSRunActionScriptFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.runActionScript",
++                             BROWSER_OS_RUNACTIONSCRIPT)
++
++  BrowserOSRunActionScriptFunction();
++
++ protected:
++  ~BrowserOSRunActionScriptFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  // Called by BrowserOSActionScheduler once the tab is free
++  void OnSlotAcquired(base::OnceClosure done);
++
++  // Starts the step at |next_step_|, or responds once no steps are left
++  void RunNextStep();
++
++  // Snapshots the tab and matches the current step's target, unless a
++  // check is running
++  void CheckTarget();
++  void OnAccessibilityTreeReceived(browseros::SharedAXTreeUpdate snapshot);
++  void OnSnapshotProcessed(SnapshotProcessingResult result);
++  void OnStepTimeout(size_t step);
++
++  // Runs the current step against |node_info|, which is null for steps
++  // without a target. Returns an error if the step cannot run; otherwise
++  // OnStepCompleted() is called once it finishes.
++  std::optional<std::string> DispatchStep(const NodeInfo* node_info);
++
++  void OnStepCompleted(bool page_changed);
++
++  // Records a failed step and responds
++  void FailStep(std::string error);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  int tab_id_ = -1;
++  browser_os::ActionScript script_;
++  base::Value::Dict variables_;
++  base::TimeDelta step_timeout_;
++  SettlePolicy settle_policy_;
++  base::TimeTicks start_time_;
++
++  size_t next_step_ = 0;
++  std::vector<browser_os::ScriptStepResult> results_;
++  // Result of the step in flight, filled in as it resolves
++  browser_os::ScriptStepResult step_result_;
++
++  // Watches for the current step's target while it has not matched
++  std::unique_ptr<BrowserOSTreeChangeWatcher> watcher_;
++  bool checking_ = false;
++  bool recheck_needed_ = false;
++
++  // Holds the tab for the whole script
++  base::ScopedClosureRunner action_slot_;
++};
++
++class BrowserOSSetBackgroundRenderingFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.setBackgroundRendering",
++                             BROWSER_OS_SETBACKGROUNDRENDERING)
++
++  BrowserOSSetBackgroundRenderingFunction() = default;
++
++ protected:
++  ~BrowserOSSetBackgroundRenderingFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSSetTabPriorityFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.setTabPriority",
++                             BROWSER_OS_SETTABPRIORITY)
++
++  BrowserOSSetTabPriorityFunction() = default;
++
++ protected:
++  ~BrowserOSSetTabPriorityFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSSetAutomationTabFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.setAutomationTab",
++                             BROWSER_OS_SETAUTOMATIONTAB)
++
++  BrowserOSSetAutomationTabFunction() = default;
++
++ protected:
++  ~BrowserOSSetAutomationTabFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSGetTabResourceUsageFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getTabResourceUsage",
++                             BROWSER_OS_GETTABRESOURCEUSAGE)
++
++  BrowserOSGetTabResourceUsageFunction() = default;
++
++ protected:
++  ~BrowserOSGetTabResourceUsageFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSAcquireTabFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.acquireTab", BROWSER_OS_ACQUIRETAB)
++
++  BrowserOSAcquireTabFunction() = default;
++
++ protected:
++  ~BrowserOSAcquireTabFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSReleaseTabFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.releaseTab", BROWSER_OS_RELEASETAB)
++
++  BrowserOSReleaseTabFunction() = default;
++
++ protected:
++  ~BrowserOSReleaseTabFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
 +};
 +
 +class BrowserOSGetSnapshotFunction : public ExtensionFunction {
@@ -221,7 +1090,18 @@ index 0000000000000..2e2f5f0253f86
 +  ResponseAction Run() override;
 +
 + private:
-+  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++  void OnAccessibilityTreeReceived(browseros::SharedAXTreeUpdate snapshot);
++  void OnPageContentBuilt(ContentSnapshot result);
++  void OnPageContentPacked(
++      base::expected<browser_os::PageContent, std::string> content);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  ContentProcessor::Mode content_mode_ = ContentProcessor::Mode::kAll;
++  bool url_table_ = false;
++  // Set if the result goes out in the compact wire form
++  std::optional<browser_os::WireCompression> wire_compression_;
++  // Item hashes of the snapshot the caller asked for changes since
++  std::optional<std::vector<uint32_t>> previous_item_hashes_;
 +};
 +
 +// Settings API functions
@@ -251,6 +1131,19 @@ index 0000000000000..2e2f5f0253f86
 +  ResponseAction Run() override;
 +};
 +
++class BrowserOSSetPrefsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.setPrefs", BROWSER_OS_SETPREFS)
++
++  BrowserOSSetPrefsFunction() = default;
++
++ protected:
++  ~BrowserOSSetPrefsFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
 +class BrowserOSGetAllPrefsFunction : public ExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.getAllPrefs", BROWSER_OS_GETALLPREFS)
@@ -316,10 +1209,14 @@ index 0000000000000..2e2f5f0253f86
 +  ResponseAction Run() override;
 +  
 + private:
-+  void OnJavaScriptExecuted(base::Value result);
++  void OnJavaScriptExecuted(std::vector<ScriptExecutor::FrameResult> results);
++  void OnTimeout();
++
++  size_t max_result_bytes_ = 0;
 +};
 +
-+class BrowserOSClickCoordinatesFunction : public ExtensionFunction {
++class BrowserOSClickCoordinatesFunction
++    : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.clickCoordinates", BROWSER_OS_CLICKCOORDINATES)
 +
@@ -330,9 +1227,14 @@ index 0000000000000..2e2f5f0253f86
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void StartClickCoordinates(gfx::PointF point);
++  void OnClickCoordinatesCompleted(bool success);
 +};
 +
-+class BrowserOSTypeAtCoordinatesFunction : public ExtensionFunction {
++class BrowserOSTypeAtCoordinatesFunction
++    : public BrowserOSInteractionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.typeAtCoordinates", BROWSER_OS_TYPEATCOORDINATES)
 +
@@ -343,6 +1245,70 @@ index 0000000000000..2e2f5f0253f86
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  void StartTypeAtCoordinates(gfx::PointF point, std::string text);
++  void OnTypeAtCoordinatesCompleted(bool success);
++};
++
++class BrowserOSDispatchInputFunction : public BrowserOSInteractionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.dispatchInput",
++                             BROWSER_OS_DISPATCHINPUT)
++
++  BrowserOSDispatchInputFunction();
++
++ protected:
++  ~BrowserOSDispatchInputFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void StartDispatchInput();
++  void OnInputDispatched(bool success);
++
++  std::vector<InputStep> steps_;
++};
++
++class BrowserOSExecuteActionsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.executeActions",
++                             BROWSER_OS_EXECUTEACTIONS)
++
++  BrowserOSExecuteActionsFunction();
++
++ protected:
++  ~BrowserOSExecuteActionsFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  // Starts the step at |next_step_|, or responds once no steps are left
++  void RunNextStep();
++
++  // Dispatches |action|, with change detection if |detect|. Returns an
++  // error if the step cannot run; otherwise OnStepCompleted() is called
++  // once it finishes.
++  std::optional<std::string> StartStep(const browser_os::Action& action,
++                                       bool detect);
++
++  void OnStepCompleted(bool success);
++
++  // Called by BrowserOSActionScheduler once the tab is free
++  void OnSlotAcquired(base::OnceClosure done);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  int tab_id_ = -1;
++  std::vector<browser_os::Action> actions_;
++  size_t next_step_ = 0;
++  bool detect_each_step_ = false;
++  bool continue_on_error_ = false;
++  SettlePolicy settle_policy_;
++  std::vector<browser_os::ActionResult> results_;
++  // Holds the tab for the whole batch
++  base::ScopedClosureRunner action_slot_;
 +};
 +
 +class BrowserOSChoosePathFunction : public ExtensionFunction,
@@ -369,6 +1335,47 @@ index 0000000000000..2e2f5f0253f86
 +  scoped_refptr<ui::SelectFileDialog> select_file_dialog_;
 +};
 +
++class BrowserOSSetInputFilesFunction : public BrowserOSInteractionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.setInputFiles",
++                             BROWSER_OS_SETINPUTFILES)
++
++  BrowserOSSetInputFilesFunction();
++
++ protected:
++  ~BrowserOSSetInputFilesFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnPathsChecked(NodeInfo node_info, std::optional<std::string> error);
++  void StartSetFiles(NodeInfo node_info);
++  void OnFilesSet(std::optional<std::string> error);
++
++  std::vector<base::FilePath> paths_;
++};
++
++class BrowserOSDownloadFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.download", BROWSER_OS_DOWNLOAD)
++
++  BrowserOSDownloadFunction();
++
++ protected:
++  ~BrowserOSDownloadFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnDownloadStarted(
++      base::expected<browser_os::DownloadInfo, std::string> download);
++  void OnDownloadFinished(const browser_os::DownloadInfo& download);
++
++  bool wait_for_completion_ = false;
++};
++
 +}  // namespace api
 +}  // namespace extensions
 +
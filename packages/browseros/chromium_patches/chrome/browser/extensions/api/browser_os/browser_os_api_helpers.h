@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h
 new file mode 100644
-index 0000000000000..2000fa3235290
+index 0000000000000..45d36051a8546
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h
-@@ -0,0 +1,137 @@
+@@ -0,0 +1,182 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -26,12 +26,16 @@ index 0000000000000..2000fa3235290
 +namespace api {
 +
 +struct NodeInfo;
++struct SettlePolicy;
 +
 +// Returns the multiplicative factor that converts CSS pixels (frame
 +// coordinates) to widget DIPs for input events. This matches DevTools'
 +// InputHandler::ScaleFactor(): browser zoom × CSS zoom × page scale. The
 +// device scale factor (DSF) is NOT included because compositor handles it and
 +// input expects widget DIPs (we also set screen = widget).
++// For the primary main frame widget this comes from BrowserOSTabGeometry,
++// which reads it again after any zoom, pinch or resize, so it is never a
++// snapshot-time value.
 +float CssToWidgetScale(content::WebContents* web_contents,
 +                       content::RenderWidgetHost* rwh);
 +
@@ -95,47 +99,88 @@ index 0000000000000..2000fa3235290
 +                    const NodeInfo& node_info,
 +                    const std::string& text);
 +
++// Helper to focus an input field and clear it using JavaScript
++void HtmlClear(content::WebContents* web_contents,
++               const NodeInfo& node_info);
++
++// The *WithDetection helpers below report through |callback| and never block
++// the UI thread. |settle_policy| decides how long each attempt waits for the
++// page to react and settle (see BrowserOSChangeDetector).
++
 +// Helper to perform a click with change detection and retrying
-+// Returns true if the click caused a change in the page
-+bool ClickWithDetection(content::WebContents* web_contents,
-+                        const NodeInfo& node_info);
++// Scrolls the node into view first if needed, without blocking the UI thread
++// Runs |callback| with true if the click caused a change in the page
++void ClickWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        const SettlePolicy& settle_policy,
++                        base::OnceCallback<void(bool)> callback);
 +
 +// Helper to perform typing with change detection
-+// Returns true if the typing caused a change in the page
-+bool TypeWithDetection(content::WebContents* web_contents,
-+                      const NodeInfo& node_info,
-+                      const std::string& text);
++// Scrolls and focuses the node first, waiting for each step asynchronously
++// Runs |callback| with true if the typing caused a change in the page
++void TypeWithDetection(content::WebContents* web_contents,
++                       const NodeInfo& node_info,
++                       const std::string& text,
++                       const SettlePolicy& settle_policy,
++                       base::OnceCallback<void(bool)> callback);
 +
 +// Helper to clear an input field with change detection
-+// Returns true if the clear caused a change in the page
-+bool ClearWithDetection(content::WebContents* web_contents,
-+                       const NodeInfo& node_info);
++// Runs |callback| with true if the clear caused a change in the page
++void ClearWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        const SettlePolicy& settle_policy,
++                        base::OnceCallback<void(bool)> callback);
 +
 +// Helper to send a key press with change detection
-+// Returns true if the key press caused a change in the page
-+bool KeyPressWithDetection(content::WebContents* web_contents,
-+                          const std::string& key);
-+
-+// Helper to show highlights for clickable, typeable, and selectable elements that are in viewport
-+// Only highlights elements that are actually visible and interactable
-+void ShowHighlights(content::WebContents* web_contents,
-+                                 const std::unordered_map<uint32_t, NodeInfo>& node_mappings,
-+                                 bool show_labels = true);
-+
-+// Helper to remove all bounding box highlights from the page
-+void RemoveHighlights(content::WebContents* web_contents);
++// Runs |callback| with true if the key press caused a change in the page
++void KeyPressWithDetection(content::WebContents* web_contents,
++                           const std::string& key,
++                           const SettlePolicy& settle_policy,
++                           base::OnceCallback<void(bool)> callback);
 +
 +// Helper to click at specific coordinates with change detection
-+// Returns true if the click caused a detectable change in the page
-+bool ClickCoordinatesWithDetection(content::WebContents* web_contents,
-+                                   const gfx::PointF& point);
++// Runs |callback| with true if the click caused a detectable change in the
++// page
++void ClickCoordinatesWithDetection(content::WebContents* web_contents,
++                                   const gfx::PointF& point,
++                                   const SettlePolicy& settle_policy,
++                                   base::OnceCallback<void(bool)> callback);
 +
 +// Helper to type text after clicking at coordinates to focus element
 +// First clicks at the coordinates to focus an element, then types the text
-+// Returns true if the operation succeeded
-+bool TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
++// once focus has moved
++// Runs |callback| with true if the operation succeeded
++void TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
 +                                    const gfx::PointF& point,
-+                                    const std::string& text);
++                                    const std::string& text,
++                                    const SettlePolicy& settle_policy,
++                                    base::OnceCallback<void(bool)> callback);
++
++// Helpers for batched actions. Each performs only the primary method of the
++// matching *WithDetection helper, with the same scroll and focus waits but
++// without change detection or fallbacks. |done| runs once the input has been
++// dispatched.
++
++// Clicks the node's center, scrolling it into view first if needed
++void ClickNode(content::WebContents* web_contents,
++               const NodeInfo& node_info,
++               base::OnceClosure done);
++
++// Focuses the node, scrolling it into view first if needed, and types |text|
++// with native key events
++void TypeIntoNode(content::WebContents* web_contents,
++                  const NodeInfo& node_info,
++                  const std::string& text,
++                  base::OnceClosure done);
++
++// Scrolls the node into view and waits for the scroll to settle
++void ScrollNodeIntoView(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        base::OnceClosure done);
++
++// Scrolls the page down (or up) by 90% of the viewport height
++// Returns false if the tab has no view to scroll
++bool ScrollByPage(content::WebContents* web_contents, bool down);
 +
 +}  // namespace api
 +}  // namespace extensions
@@ -0,0 +1,97 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_metrics.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_metrics.cc
+new file mode 100644
+index 0000000000000..4d8268e2f31e3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_api_metrics.cc
+@@ -0,0 +1,91 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_metrics.h"
++
++#include <string>
++
++#include "base/command_line.h"
++#include "base/metrics/histogram_functions.h"
++#include "base/strings/strcat.h"
++#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/metrics/browseros_daily_usage.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr std::string_view kFunctionPrefix = "browserOS.";
++
++// "browserOS.click" -> "click"
++std::string_view GetShortName(std::string_view function_name) {
++  if (function_name.starts_with(kFunctionPrefix)) {
++    function_name.remove_prefix(kFunctionPrefix.size());
++  }
++  return function_name;
++}
++
++std::string GetHistogramName(std::string_view function_name,
++                             std::string_view metric) {
++  return base::StrCat(
++      {"Extensions.BrowserOS.", GetShortName(function_name), ".", metric});
++}
++
++bool IsRollupEnabled() {
++  static const bool enabled = base::CommandLine::ForCurrentProcess()->HasSwitch(
++      browseros::kApiMetricsRollup);
++  return enabled;
++}
++
++std::string GetRollupName(std::string_view function_name,
++                          std::string_view metric) {
++  return base::StrCat({"api.", GetShortName(function_name), ".", metric});
++}
++
++}  // namespace
++
++void RecordBrowserOSApiLatency(std::string_view function_name,
++                               base::TimeDelta latency) {
++  base::UmaHistogramMediumTimes(GetHistogramName(function_name, "Latency"),
++                                latency);
++  browseros_metrics::BrowserOSDailyUsage::GetInstance()->RecordAgentCall();
++  if (IsRollupEnabled()) {
++    browseros_metrics::BrowserOSMetrics::RecordLatency(
++        GetRollupName(function_name, "latency"), latency);
++  }
++}
++
++void RecordBrowserOSSnapshotSize(std::string_view function_name,
++                                 size_t node_count,
++                                 size_t payload_bytes) {
++  base::UmaHistogramCounts100000(GetHistogramName(function_name, "NodeCount"),
++                                 static_cast<int>(node_count));
++  base::UmaHistogramMemoryKB(GetHistogramName(function_name, "PayloadSize"),
++                             static_cast<int>(payload_bytes / 1024));
++  if (IsRollupEnabled()) {
++    browseros_metrics::BrowserOSMetrics::Count(
++        GetRollupName(function_name, "nodes"), node_count);
++  }
++}
++
++void RecordBrowserOSScreenshotSize(std::string_view function_name,
++                                   size_t payload_bytes) {
++  base::UmaHistogramMemoryKB(GetHistogramName(function_name, "PayloadSize"),
++                             static_cast<int>(payload_bytes / 1024));
++}
++
++void RecordBrowserOSChangeDetected(std::string_view function_name,
++                                   bool change_detected) {
++  base::UmaHistogramBoolean(GetHistogramName(function_name, "ChangeDetected"),
++                            change_detected);
++  if (IsRollupEnabled() && change_detected) {
++    browseros_metrics::BrowserOSMetrics::Count(
++        GetRollupName(function_name, "changed"));
++  }
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,51 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_metrics.h b/chrome/browser/extensions/api/browser_os/browser_os_api_metrics.h
+new file mode 100644
+index 0000000000000..ff826a1e3cce0
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_api_metrics.h
+@@ -0,0 +1,45 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_METRICS_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_METRICS_H_
++
++#include <stddef.h>
++
++#include <string_view>
++
++#include "base/time/time.h"
++
++namespace extensions {
++namespace api {
++
++// Field telemetry for browserOS API calls, recorded as UMA histograms named
++// Extensions.BrowserOS.<function>.<metric>, where <function> is the API
++// method without its "browserOS." prefix. With --browseros-api-metrics-
++// rollup the same samples also feed aggregated BrowserOSMetrics events of
++// the form api.<function>.<metric>.
++
++// Records how long one call of |function_name| took, from dispatch until
++// its response was sent. Also counts the call for the daily usage report.
++void RecordBrowserOSApiLatency(std::string_view function_name,
++                               base::TimeDelta latency);
++
++// Records the nodes and estimated serialized size of an interactive
++// snapshot returned by |function_name|.
++void RecordBrowserOSSnapshotSize(std::string_view function_name,
++                                 size_t node_count,
++                                 size_t payload_bytes);
++
++// Records the encoded size of a screenshot returned by |function_name|.
++void RecordBrowserOSScreenshotSize(std::string_view function_name,
++                                   size_t payload_bytes);
++
++// Records whether an interaction of |function_name| changed the page.
++void RecordBrowserOSChangeDetected(std::string_view function_name,
++                                   bool change_detected);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_METRICS_H_
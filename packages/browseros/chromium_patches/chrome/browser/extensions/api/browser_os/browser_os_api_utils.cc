@@ -1,17 +1,20 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
 new file mode 100644
-index 0000000000000..0c3a060fc70de
+index 0000000000000..38d870bc48460
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
-@@ -0,0 +1,167 @@
+@@ -0,0 +1,338 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +
++#include <array>
++#include <string_view>
++
 +#include "base/hash/hash.h"
-+#include "base/no_destructor.h"
++#include "base/logging.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
@@ -20,6 +23,8 @@ index 0000000000000..0c3a060fc70de
 +#include "chrome/browser/ui/browser_finder.h"
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
 +#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_enums.mojom.h"
 +#include "ui/accessibility/ax_role_properties.h"
 +
 +namespace extensions {
@@ -33,13 +38,23 @@ index 0000000000000..0c3a060fc70de
 +NodeInfo::NodeInfo(NodeInfo&&) = default;
 +NodeInfo& NodeInfo::operator=(NodeInfo&&) = default;
 +
-+// Global node ID mappings storage
-+// Use NoDestructor to avoid exit-time destructor
-+std::unordered_map<int, std::unordered_map<uint32_t, NodeInfo>>& 
-+GetNodeIdMappings() {
-+  static base::NoDestructor<std::unordered_map<int, std::unordered_map<uint32_t, NodeInfo>>> 
-+      g_node_id_mappings;
-+  return *g_node_id_mappings;
++ui::AXMode GetSnapshotAXMode(SnapshotProfile profile,
++                             bool include_inline_text_boxes) {
++  ui::AXMode mode(ui::AXMode::kWebContents);
++  switch (profile) {
++    case SnapshotProfile::kInteractive:
++    case SnapshotProfile::kFull:
++      // HTML tags and attributes come with extended properties
++      mode |= ui::AXMode::kExtendedProperties;
++      break;
++    case SnapshotProfile::kContent:
++      // Roles, names, values and urls are all in the basic mode
++      break;
++  }
++  if (include_inline_text_boxes) {
++    mode |= ui::AXMode::kInlineTextBoxes;
++  }
++  return mode;
 +}
 +
 +std::optional<TabInfo> GetTabFromOptionalId(
@@ -87,6 +102,25 @@ index 0000000000000..0c3a060fc70de
 +  return TabInfo(web_contents, tab_id);
 +}
 +
++namespace {
++
++// Roles classified as selectable even when IsSelectable() misses them, e.g.
++// combobox and list options
++constexpr auto kSelectableFallbackRoles = [] {
++  using Role = ax::mojom::Role;
++  std::array<bool, static_cast<size_t>(Role::kMaxValue) + 1> table{};
++  for (Role role : {Role::kComboBoxSelect, Role::kComboBoxMenuButton,
++                    Role::kComboBoxGrouping, Role::kListBox,
++                    Role::kListBoxOption, Role::kMenuListOption,
++                    Role::kMenuItem, Role::kMenuItemCheckBox,
++                    Role::kMenuItemRadio}) {
++    table[static_cast<size_t>(role)] = true;
++  }
++  return table;
++}();
++
++}  // namespace
++
 +// Helper to determine if a node is interactive (clickable/typeable/selectable)
 +browser_os::InteractiveNodeType GetInteractiveNodeType(
 +    const ui::AXNodeData& node_data) {
@@ -116,16 +150,7 @@ index 0000000000000..0c3a060fc70de
 +  }
 +  
 +  // Additional check for combobox and list options which might not be caught by IsSelectable
-+  using Role = ax::mojom::Role;
-+  if (node_data.role == Role::kComboBoxSelect ||
-+      node_data.role == Role::kComboBoxMenuButton ||
-+      node_data.role == Role::kComboBoxGrouping ||
-+      node_data.role == Role::kListBox ||
-+      node_data.role == Role::kListBoxOption ||
-+      node_data.role == Role::kMenuListOption ||
-+      node_data.role == Role::kMenuItem ||
-+      node_data.role == Role::kMenuItemCheckBox ||
-+      node_data.role == Role::kMenuItemRadio) {
++  if (kSelectableFallbackRoles[static_cast<size_t>(node_data.role)]) {
 +    return browser_os::InteractiveNodeType::kSelectable;
 +  }
 +  
@@ -169,5 +194,151 @@ index 0000000000000..0c3a060fc70de
 +  }
 +}
 +
++bool KeepsAttribute(const AXAttributeFilter& filter, std::string_view name) {
++  return !filter || filter->contains(name);
++}
++
++// Serializes ui::AXNodeData to base::Value::Dict with all fields that pass
++// |filter|
++base::Value::Dict SerializeAXNodeData(const ui::AXNodeData& node,
++                                      const AXAttributeFilter& filter) {
++  base::Value::Dict dict;
++
++  // Core identity
++  dict.Set("id", node.id);
++  dict.Set("role", ui::ToString(node.role));
++
++  // Hierarchy
++  if (!node.child_ids.empty() && KeepsAttribute(filter, "childIds")) {
++    base::Value::List children;
++    for (int32_t child_id : node.child_ids) {
++      children.Append(child_id);
++    }
++    dict.Set("childIds", std::move(children));
++  }
++
++  // State bitfield converted to string array
++  base::Value::List states;
++  if (KeepsAttribute(filter, "states")) {
++    for (int i = static_cast<int>(ax::mojom::State::kMinValue);
++         i <= static_cast<int>(ax::mojom::State::kMaxValue); ++i) {
++      auto state = static_cast<ax::mojom::State>(i);
++      if (node.HasState(state)) {
++        states.Append(ui::ToString(state));
++      }
++    }
++  }
++  if (!states.empty()) {
++    dict.Set("states", std::move(states));
++  }
++
++  // Actions bitfield converted to string array
++  base::Value::List actions;
++  if (KeepsAttribute(filter, "actions")) {
++    for (int i = static_cast<int>(ax::mojom::Action::kMinValue);
++         i <= static_cast<int>(ax::mojom::Action::kMaxValue); ++i) {
++      auto action = static_cast<ax::mojom::Action>(i);
++      if (node.HasAction(action)) {
++        actions.Append(ui::ToString(action));
++      }
++    }
++  }
++  if (!actions.empty()) {
++    dict.Set("actions", std::move(actions));
++  }
++
++  // String attributes map with enum keys converted to strings
++  base::Value::Dict string_attrs;
++  for (const auto& [key, value] : node.string_attributes) {
++    if (KeepsAttribute(filter, ui::ToString(key))) {
++      string_attrs.Set(ui::ToString(key), value);
++    }
++  }
++  if (!string_attrs.empty()) {
++    dict.Set("stringAttributes", std::move(string_attrs));
++  }
++
++  // Int attributes map
++  base::Value::Dict int_attrs;
++  for (const auto& [key, value] : node.int_attributes) {
++    if (KeepsAttribute(filter, ui::ToString(key))) {
++      int_attrs.Set(ui::ToString(key), value);
++    }
++  }
++  if (!int_attrs.empty()) {
++    dict.Set("intAttributes", std::move(int_attrs));
++  }
++
++  // Float attributes map
++  base::Value::Dict float_attrs;
++  for (const auto& [key, value] : node.float_attributes) {
++    if (KeepsAttribute(filter, ui::ToString(key))) {
++      float_attrs.Set(ui::ToString(key), static_cast<double>(value));
++    }
++  }
++  if (!float_attrs.empty()) {
++    dict.Set("floatAttributes", std::move(float_attrs));
++  }
++
++  // Bool attributes map
++  base::Value::Dict bool_attrs;
++  if (node.bool_attributes) {
++    node.bool_attributes->ForEach(
++        [&bool_attrs, &filter](ax::mojom::BoolAttribute key, bool value) {
++          if (KeepsAttribute(filter, ui::ToString(key))) {
++            bool_attrs.Set(ui::ToString(key), value);
++          }
++        });
++  }
++  if (!bool_attrs.empty()) {
++    dict.Set("boolAttributes", std::move(bool_attrs));
++  }
++
++  // IntList attributes map
++  base::Value::Dict intlist_attrs;
++  for (const auto& [key, values] : node.intlist_attributes) {
++    if (!KeepsAttribute(filter, ui::ToString(key))) {
++      continue;
++    }
++    base::Value::List list;
++    for (int v : values) {
++      list.Append(v);
++    }
++    intlist_attrs.Set(ui::ToString(key), std::move(list));
++  }
++  if (!intlist_attrs.empty()) {
++    dict.Set("intListAttributes", std::move(intlist_attrs));
++  }
++
++  // StringList attributes map
++  base::Value::Dict stringlist_attrs;
++  for (const auto& [key, values] : node.stringlist_attributes) {
++    if (!KeepsAttribute(filter, ui::ToString(key))) {
++      continue;
++    }
++    base::Value::List list;
++    for (const auto& v : values) {
++      list.Append(v);
++    }
++    stringlist_attrs.Set(ui::ToString(key), std::move(list));
++  }
++  if (!stringlist_attrs.empty()) {
++    dict.Set("stringListAttributes", std::move(stringlist_attrs));
++  }
++
++  // HTML attributes (name-value pairs)
++  base::Value::Dict html_attrs;
++  for (const auto& [name, value] : node.html_attributes) {
++    if (KeepsAttribute(filter, name)) {
++      html_attrs.Set(name, value);
++    }
++  }
++  if (!html_attrs.empty()) {
++    dict.Set("htmlAttributes", std::move(html_attrs));
++  }
++
++  return dict;
++}
++
 +}  // namespace api
 +}  // namespace extensions
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h
 new file mode 100644
-index 0000000000000..f4fdcb73186cd
+index 0000000000000..22f055b8c19c0
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h
-@@ -0,0 +1,80 @@
+@@ -0,0 +1,108 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,11 +13,14 @@ index 0000000000000..f4fdcb73186cd
 +
 +#include <optional>
 +#include <string>
-+#include <unordered_map>
++#include <string_view>
 +
++#include "base/containers/flat_set.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
 +#include "chrome/common/extensions/api/browser_os.h"
++#include "ui/accessibility/ax_mode.h"
 +#include "ui/accessibility/ax_node_data.h"
 +#include "ui/accessibility/ax_tree_id.h"
 +#include "ui/gfx/geometry/rect_f.h"
@@ -55,14 +58,28 @@ index 0000000000000..f4fdcb73186cd
 +  int32_t ax_node_id;
 +  ui::AXTreeID ax_tree_id;  // Tree ID for change detection
 +  gfx::RectF bounds;  // Absolute bounds in CSS pixels
-+  std::unordered_map<std::string, std::string> attributes;  // All computed attributes
++  std::string name;  // Accessible name, for findNodes
++  NodeAttributes attributes;  // All computed attributes
 +  browser_os::InteractiveNodeType node_type;  // Cached node type to avoid recomputation
 +  bool in_viewport;  // Whether the node is currently visible in viewport
 +};
 +
-+// Global node ID mappings storage
-+std::unordered_map<int, std::unordered_map<uint32_t, NodeInfo>>& 
-+GetNodeIdMappings();
++// What an API needs from the accessibility tree. Each profile maps to the
++// smallest AXMode that serves it; inline text boxes roughly triple the node
++// count on text-heavy pages, so no profile requests them by default.
++enum class SnapshotProfile {
++  // Interactive elements for getInteractiveSnapshot and interactions
++  kInteractive,
++  // Readable page content for getSnapshot
++  kContent,
++  // Every node and attribute for getAccessibilityTree
++  kFull,
++};
++
++// Returns the AXMode to request for |profile|, plus inline text boxes when
++// the caller opted into them
++ui::AXMode GetSnapshotAXMode(SnapshotProfile profile,
++                             bool include_inline_text_boxes = false);
 +
 +// Helper to get WebContents and tab ID from optional tab_id parameter
 +// Returns nullptr if tab is not found, with error message set
@@ -79,6 +96,17 @@ index 0000000000000..f4fdcb73186cd
 +// Helper to get the HTML tag name from AX role
 +std::string GetTagFromRole(ax::mojom::Role role);
 +
++// Attribute names kept by getAccessibilityTree; nullopt keeps all of them
++using AXAttributeFilter = std::optional<base::flat_set<std::string>>;
++
++bool KeepsAttribute(const AXAttributeFilter& filter, std::string_view name);
++
++// Serializes ui::AXNodeData to base::Value::Dict with all fields that pass
++// |filter|, the node layout of getAccessibilityTree and
++// onAccessibilityUpdates
++base::Value::Dict SerializeAXNodeData(const ui::AXNodeData& node,
++                                      const AXAttributeFilter& filter);
++
 +
 +}  // namespace api
 +}  // namespace extensions
@@ -0,0 +1,325 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_audio_capture.cc b/chrome/browser/extensions/api/browser_os/browser_os_audio_capture.cc
+new file mode 100644
+index 0000000000000..b94fe3a917910
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_audio_capture.cc
+@@ -0,0 +1,319 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_audio_capture.h"
++
++#include <array>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/numerics/byte_conversions.h"
++#include "base/task/bind_post_task.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "chrome/browser/media/webrtc/media_capture_devices_dispatcher.h"
++#include "chrome/browser/media/webrtc/media_stream_capture_indicator.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/audio_service.h"
++#include "content/public/browser/media_stream_request.h"
++#include "content/public/browser/web_contents.h"
++#include "extensions/browser/event_router.h"
++#include "media/audio/audio_device_description.h"
++#include "media/audio/audio_opus_encoder.h"
++#include "media/audio/audio_system.h"
++#include "media/base/audio_bus.h"
++#include "media/base/audio_capturer_source.h"
++#include "media/base/audio_encoder.h"
++#include "media/base/audio_glitch_info.h"
++#include "media/base/channel_layout.h"
++#include "mojo/public/cpp/bindings/pending_remote.h"
++#include "services/audio/public/cpp/device_factory.h"
++#include "third_party/blink/public/common/mediastream/media_stream_request.h"
++#include "third_party/blink/public/mojom/mediastream/media_stream.mojom.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Opus packet length. 20 ms is what Opus is tuned for and what WebRTC uses.
++constexpr base::TimeDelta kPacketDuration = base::Milliseconds(20);
++
++// Device buffers of 10 ms, as WebRTC uses
++constexpr int kBuffersPerSecond = 100;
++
++}  // namespace
++
++// Lives on the encoding sequence. Capture() runs on the audio thread and
++// only copies the samples; after capturer_->Stop() in the destructor it is
++// no longer called, and samples it already posted are dropped by the weak
++// pointer.
++class BrowserOSAudioCapture::Session
++    : public media::AudioCapturerSource::CaptureCallback {
++ public:
++  using FrameCallback = base::RepeatingCallback<
++      void(std::vector<uint8_t>, int, base::TimeTicks)>;
++  using ErrorCallback = base::RepeatingCallback<void(std::string)>;
++
++  Session(const media::AudioParameters& params,
++          int bitrate,
++          int packets_per_frame,
++          mojo::PendingRemote<media::mojom::AudioStreamFactory> stream_factory,
++          FrameCallback on_frame,
++          ErrorCallback on_error)
++      : task_runner_(base::SequencedTaskRunner::GetCurrentDefault()),
++        packets_per_frame_(packets_per_frame),
++        on_frame_(std::move(on_frame)),
++        on_error_(std::move(on_error)) {
++    weak_this_ = weak_factory_.GetWeakPtr();
++
++    media::AudioEncoder::Options options;
++    options.codec = media::AudioCodec::kOpus;
++    options.channels = params.channels();
++    options.sample_rate = params.sample_rate();
++    options.bitrate = bitrate;
++    media::AudioEncoder::OpusOptions opus;
++    opus.frame_duration = kPacketDuration;
++    options.opus = opus;
++    encoder_.Initialize(
++        options, base::BindRepeating(&Session::OnEncoded, weak_this_),
++        base::BindOnce(&Session::OnEncoderStatus, weak_this_));
++
++    capturer_ = audio::CreateInputDevice(
++        std::move(stream_factory),
++        media::AudioDeviceDescription::kDefaultDeviceId,
++        audio::DeadStreamDetection::kEnabled);
++    capturer_->Initialize(params, this);
++    capturer_->Start();
++  }
++
++  Session(const Session&) = delete;
++  Session& operator=(const Session&) = delete;
++
++  ~Session() override { capturer_->Stop(); }
++
++  // media::AudioCapturerSource::CaptureCallback:
++  void OnCaptureStarted() override {}
++  void Capture(const media::AudioBus* audio_source,
++               base::TimeTicks audio_capture_time,
++               const media::AudioGlitchInfo& glitch_info,
++               double volume) override {
++    std::unique_ptr<media::AudioBus> samples = media::AudioBus::Create(
++        audio_source->channels(), audio_source->frames());
++    audio_source->CopyTo(samples.get());
++    task_runner_->PostTask(
++        FROM_HERE, base::BindOnce(&Session::Encode, weak_this_,
++                                  std::move(samples), audio_capture_time));
++  }
++  void OnCaptureError(media::AudioCapturerSource::ErrorCode code,
++                      const std::string& message) override {
++    task_runner_->PostTask(
++        FROM_HERE, base::BindOnce(&Session::ReportError, weak_this_,
++                                  "Microphone failed: " + message));
++  }
++  void OnCaptureMuted(bool is_muted) override {}
++
++ private:
++  void Encode(std::unique_ptr<media::AudioBus> samples,
++              base::TimeTicks capture_time) {
++    encoder_.Encode(std::move(samples), capture_time,
++                    base::BindOnce(&Session::OnEncoderStatus, weak_this_));
++  }
++
++  void OnEncoderStatus(media::EncoderStatus status) {
++    if (!status.is_ok()) {
++      ReportError("Opus encoding failed");
++    }
++  }
++
++  // Appends the packet to the pending frame, prefixed with its length
++  void OnEncoded(media::EncodedAudioBuffer output,
++                 std::optional<media::AudioEncoder::CodecDescription> desc) {
++    base::span<const uint8_t> packet = output.encoded_data.as_span();
++    if (pending_packets_ == 0) {
++      pending_capture_time_ = output.timestamp;
++    }
++    const std::array<uint8_t, 2> length =
++        base::U16ToLittleEndian(static_cast<uint16_t>(packet.size()));
++    pending_.insert(pending_.end(), length.begin(), length.end());
++    pending_.insert(pending_.end(), packet.begin(), packet.end());
++
++    if (++pending_packets_ < packets_per_frame_) {
++      return;
++    }
++    on_frame_.Run(std::exchange(pending_, {}), pending_packets_,
++                  pending_capture_time_);
++    pending_packets_ = 0;
++  }
++
++  // Reports only the first error; the owner stops capturing on it
++  void ReportError(std::string message) {
++    if (failed_) {
++      return;
++    }
++    failed_ = true;
++    on_error_.Run(std::move(message));
++  }
++
++  const scoped_refptr<base::SequencedTaskRunner> task_runner_;
++  const int packets_per_frame_;
++  const FrameCallback on_frame_;
++  const ErrorCallback on_error_;
++
++  media::AudioOpusEncoder encoder_;
++  scoped_refptr<media::AudioCapturerSource> capturer_;
++
++  std::vector<uint8_t> pending_;
++  int pending_packets_ = 0;
++  base::TimeTicks pending_capture_time_;
++  bool failed_ = false;
++
++  // Bound here, handed to the audio thread to post back with
++  base::WeakPtr<Session> weak_this_;
++  base::WeakPtrFactory<Session> weak_factory_{this};
++};
++
++// static
++void BrowserOSAudioCapture::Start(content::WebContents* web_contents,
++                                  Config config,
++                                  StartCallback callback) {
++  // Release the device of any running capture first
++  Stop(web_contents);
++  CreateForWebContents(web_contents, std::move(config), std::move(callback));
++}
++
++// static
++void BrowserOSAudioCapture::Stop(content::WebContents* web_contents) {
++  web_contents->RemoveUserData(UserDataKey());
++}
++
++BrowserOSAudioCapture::BrowserOSAudioCapture(content::WebContents* web_contents,
++                                             Config config,
++                                             StartCallback callback)
++    : content::WebContentsUserData<BrowserOSAudioCapture>(*web_contents),
++      config_(std::move(config)),
++      start_callback_(std::move(callback)),
++      audio_system_(content::CreateAudioSystemForAudioService()),
++      start_time_(base::TimeTicks::Now()) {
++  audio_system_->GetInputStreamParameters(
++      media::AudioDeviceDescription::kDefaultDeviceId,
++      base::BindOnce(&BrowserOSAudioCapture::OnInputParameters,
++                     weak_factory_.GetWeakPtr()));
++}
++
++BrowserOSAudioCapture::~BrowserOSAudioCapture() {
++  if (start_callback_) {
++    std::move(start_callback_).Run("Audio capture was stopped");
++    return;
++  }
++
++  LOG(INFO) << "[browseros] Audio capture stopped after " << frames_sent_
++            << " frames";
++  browseros_metrics::BrowserOSMetrics::Log(
++      "audio_capture.stopped",
++      {{"frames_sent", base::Value(frames_sent_)},
++       {"failed", base::Value(!error_.empty())},
++       {"duration_s",
++        base::Value(static_cast<int>(
++            (base::TimeTicks::Now() - start_time_).InSeconds()))}});
++}
++
++void BrowserOSAudioCapture::OnInputParameters(
++    const std::optional<media::AudioParameters>& params) {
++  if (!params || !params->IsValid()) {
++    OnError("No microphone available");
++    return;
++  }
++
++  // Mono at the device's own rate, so the audio service doesn't resample
++  // and the encoder only has to resample once, to Opus' 48 kHz
++  const media::AudioParameters capture_params(
++      media::AudioParameters::AUDIO_PCM_LOW_LATENCY,
++      media::ChannelLayoutConfig::Mono(), params->sample_rate(),
++      params->sample_rate() / kBuffersPerSecond);
++
++  mojo::PendingRemote<media::mojom::AudioStreamFactory> stream_factory;
++  content::GetAudioServiceStreamFactoryBinder().Run(
++      stream_factory.InitWithNewPipeAndPassReceiver());
++  session_ = base::SequenceBound<Session>(
++      base::ThreadPool::CreateSequencedTaskRunner(
++          {base::TaskPriority::USER_VISIBLE, base::MayBlock(),
++           base::WithBaseSyncPrimitives(),
++           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}),
++      capture_params, config_.bitrate, config_.packets_per_frame,
++      std::move(stream_factory),
++      base::BindPostTaskToCurrentDefault(base::BindRepeating(
++          &BrowserOSAudioCapture::OnFrame, weak_factory_.GetWeakPtr())),
++      base::BindPostTaskToCurrentDefault(base::BindRepeating(
++          &BrowserOSAudioCapture::OnError, weak_factory_.GetWeakPtr())));
++  audio_system_.reset();
++
++  blink::mojom::StreamDevices devices;
++  devices.audio_device = blink::MediaStreamDevice(
++      blink::mojom::MediaStreamType::DEVICE_AUDIO_CAPTURE,
++      media::AudioDeviceDescription::kDefaultDeviceId, "Default");
++  capture_ui_ = MediaCaptureDevicesDispatcher::GetInstance()
++                    ->GetMediaStreamCaptureIndicator()
++                    ->RegisterMediaStream(&GetWebContents(), devices);
++  capture_ui_->OnStarted(
++      base::BindPostTaskToCurrentDefault(
++          base::BindRepeating(&BrowserOSAudioCapture::OnStopRequested,
++                              weak_factory_.GetWeakPtr())),
++      content::MediaStreamUI::SourceCallback(), /*label=*/std::string(),
++      /*screen_capture_ids=*/{}, content::MediaStreamUI::StateChangeCallback());
++
++  LOG(INFO) << "[browseros] Audio capture started for tab "
++            << ExtensionTabUtil::GetTabId(&GetWebContents()) << " at "
++            << params->sample_rate() << " Hz, " << config_.bitrate << " bps";
++  std::move(start_callback_).Run(std::nullopt);
++}
++
++void BrowserOSAudioCapture::OnFrame(std::vector<uint8_t> data,
++                                    int packet_count,
++                                    base::TimeTicks capture_time) {
++  EventRouter* event_router =
++      EventRouter::Get(GetWebContents().GetBrowserContext());
++  if (!event_router) {
++    return;
++  }
++
++  browser_os::AudioCaptureFrame frame;
++  frame.tab_id = ExtensionTabUtil::GetTabId(&GetWebContents());
++  frame.sequence = ++frames_sent_;
++  frame.data = std::move(data);
++  frame.packet_count = packet_count;
++  const base::TimeDelta age = base::TimeTicks::Now() - capture_time;
++  frame.timestamp = (base::Time::Now() - age).InMillisecondsFSinceUnixEpoch();
++
++  auto event = std::make_unique<Event>(
++      events::UNKNOWN, browser_os::OnAudioCaptureFrame::kEventName,
++      browser_os::OnAudioCaptureFrame::Create(frame),
++      GetWebContents().GetBrowserContext());
++  event_router->DispatchEventToExtension(config_.extension_id,
++                                         std::move(event));
++}
++
++void BrowserOSAudioCapture::OnError(std::string message) {
++  LOG(WARNING) << "[browseros] Audio capture: " << message;
++  error_ = message;
++  if (start_callback_) {
++    std::move(start_callback_).Run(std::move(message));
++  }
++  // Deletes |this|
++  Stop(&GetWebContents());
++}
++
++void BrowserOSAudioCapture::OnStopRequested() {
++  // Deletes |this|
++  Stop(&GetWebContents());
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSAudioCapture);
++
++}  // namespace api
++}  // namespace extensions
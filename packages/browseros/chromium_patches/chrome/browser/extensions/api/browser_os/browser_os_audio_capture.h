@@ -0,0 +1,111 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_audio_capture.h b/chrome/browser/extensions/api/browser_os/browser_os_audio_capture.h
+new file mode 100644
+index 0000000000000..cb08b0f4c7b96
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_audio_capture.h
+@@ -0,0 +1,105 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AUDIO_CAPTURE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AUDIO_CAPTURE_H_
++
++#include <cstdint>
++#include <memory>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/threading/sequence_bound.h"
++#include "base/time/time.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "media/base/audio_parameters.h"
++
++namespace content {
++class MediaStreamUI;
++}  // namespace content
++
++namespace media {
++class AudioSystem;
++}  // namespace media
++
++namespace extensions {
++namespace api {
++
++// Teach mode microphone capture, pushed to the extension that started it as
++// browserOS.onAudioCaptureFrame events for it to forward to the server over
++// its port. Replaces capturing and encoding in the extension's JS.
++//
++// The default input device is opened through the audio service. Its
++// callbacks arrive on the audio thread, which only copies the samples over
++// to a ThreadPool sequence where they are Opus-encoded into 20 ms packets;
++// the UI thread only sees finished frames of a few packets each. The tab
++// shows the usual microphone indicator while capturing.
++class BrowserOSAudioCapture
++    : public content::WebContentsUserData<BrowserOSAudioCapture> {
++ public:
++  struct Config {
++    std::string extension_id;
++    // Opus bitrate, in bits per second
++    int bitrate = 0;
++    // Opus packets per onAudioCaptureFrame event
++    int packets_per_frame = 0;
++  };
++
++  // Called once the device is open, with an error if it couldn't be
++  using StartCallback =
++      base::OnceCallback<void(std::optional<std::string> error)>;
++
++  // Starts or restarts capturing for |web_contents| with |config|
++  static void Start(content::WebContents* web_contents,
++                    Config config,
++                    StartCallback callback);
++
++  // Stops capturing for |web_contents|, if it is
++  static void Stop(content::WebContents* web_contents);
++
++  BrowserOSAudioCapture(const BrowserOSAudioCapture&) = delete;
++  BrowserOSAudioCapture& operator=(const BrowserOSAudioCapture&) = delete;
++  ~BrowserOSAudioCapture() override;
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSAudioCapture>;
++
++  // Owns the device and the encoder, on the encoding sequence
++  class Session;
++
++  BrowserOSAudioCapture(content::WebContents* web_contents,
++                        Config config,
++                        StartCallback callback);
++
++  void OnInputParameters(const std::optional<media::AudioParameters>& params);
++  void OnFrame(std::vector<uint8_t> data,
++               int packet_count,
++               base::TimeTicks capture_time);
++  void OnError(std::string message);
++  // Stops capturing, from the tab's capture indicator
++  void OnStopRequested();
++
++  const Config config_;
++  StartCallback start_callback_;
++
++  std::unique_ptr<media::AudioSystem> audio_system_;
++  base::SequenceBound<Session> session_;
++  std::unique_ptr<content::MediaStreamUI> capture_ui_;
++
++  int frames_sent_ = 0;
++  std::string error_;
++  base::TimeTicks start_time_;
++
++  base::WeakPtrFactory<BrowserOSAudioCapture> weak_factory_{this};
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AUDIO_CAPTURE_H_
@@ -0,0 +1,75 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_background_rendering.cc b/chrome/browser/extensions/api/browser_os/browser_os_background_rendering.cc
+new file mode 100644
+index 0000000000000..88bb3b47bf0c7
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_background_rendering.cc
+@@ -0,0 +1,69 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_background_rendering.h"
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_tab_budget.h"
++#include "content/public/browser/visibility.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/gfx/geometry/size.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++base::ScopedClosureRunner IncrementCapturerCount(
++    content::WebContents* web_contents) {
++  // An empty size keeps the view at its own size. |stay_hidden| would keep
++  // the renderer throttled, which is what this works around.
++  return web_contents->IncrementCapturerCount(gfx::Size(),
++                                              /*stay_hidden=*/false,
++                                              /*stay_awake=*/true,
++                                              /*is_activity=*/false);
++}
++
++}  // namespace
++
++BrowserOSBackgroundRendering::BrowserOSBackgroundRendering(
++    content::WebContents* web_contents)
++    : content::WebContentsUserData<BrowserOSBackgroundRendering>(
++          *web_contents),
++      capturer_hold_(IncrementCapturerCount(web_contents)) {}
++
++BrowserOSBackgroundRendering::~BrowserOSBackgroundRendering() = default;
++
++// static
++void BrowserOSBackgroundRendering::SetEnabled(
++    content::WebContents* web_contents,
++    bool enabled) {
++  if (enabled) {
++    CreateForWebContents(web_contents);
++  } else {
++    web_contents->RemoveUserData(UserDataKey());
++  }
++}
++
++// static
++bool BrowserOSBackgroundRendering::IsEnabled(
++    content::WebContents* web_contents) {
++  return FromWebContents(web_contents) != nullptr;
++}
++
++// static
++base::ScopedClosureRunner BrowserOSBackgroundRendering::HoldIfHidden(
++    content::WebContents* web_contents) {
++  // Captures of a tab frozen for its budget would never get a frame
++  BrowserOSTabBudget::Thaw(web_contents);
++  if (web_contents->GetVisibility() == content::Visibility::VISIBLE ||
++      IsEnabled(web_contents)) {
++    return base::ScopedClosureRunner();
++  }
++  return IncrementCapturerCount(web_contents);
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSBackgroundRendering);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,60 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_background_rendering.h b/chrome/browser/extensions/api/browser_os/browser_os_background_rendering.h
+new file mode 100644
+index 0000000000000..78897fba38392
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_background_rendering.h
+@@ -0,0 +1,54 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BACKGROUND_RENDERING_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BACKGROUND_RENDERING_H_
++
++#include "base/functional/callback_helpers.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Keeps a background or occluded tab rendering like a visible one, so AX
++// snapshots and screenshots of it are neither empty nor throttled. Uses the
++// same capturer count tab capture uses: the renderer keeps producing frames
++// and runs at foreground priority, and the page sees itself as visible.
++// Attached by setBackgroundRendering for tabs under automation; one-shot
++// captures take a HoldIfHidden() instead.
++class BrowserOSBackgroundRendering
++    : public content::WebContentsUserData<BrowserOSBackgroundRendering> {
++ public:
++  BrowserOSBackgroundRendering(const BrowserOSBackgroundRendering&) = delete;
++  BrowserOSBackgroundRendering& operator=(
++      const BrowserOSBackgroundRendering&) = delete;
++  ~BrowserOSBackgroundRendering() override;
++
++  // Keeps |web_contents| rendering until disabled or the tab closes
++  static void SetEnabled(content::WebContents* web_contents, bool enabled);
++  static bool IsEnabled(content::WebContents* web_contents);
++
++  // Returns a hold that keeps |web_contents| rendering while it is alive,
++  // or an empty one if the tab is visible or already kept rendering
++  [[nodiscard]] static base::ScopedClosureRunner HoldIfHidden(
++      content::WebContents* web_contents);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSBackgroundRendering>;
++
++  explicit BrowserOSBackgroundRendering(content::WebContents* web_contents);
++
++  base::ScopedClosureRunner capturer_hold_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_BACKGROUND_RENDERING_H_
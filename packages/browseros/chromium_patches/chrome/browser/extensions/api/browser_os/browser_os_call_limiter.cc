@@ -0,0 +1,185 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_call_limiter.cc b/chrome/browser/extensions/api/browser_os/browser_os_call_limiter.cc
+new file mode 100644
+index 0000000000000..3297c567ef340
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_call_limiter.cc
+@@ -0,0 +1,179 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_call_limiter.h"
++
++#include <utility>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/sequenced_task_runner.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSCallLimiter::PendingCall::PendingCall(int tab_id, StartCallback start)
++    : tab_id(tab_id),
++      start(std::move(start)),
++      enqueue_time(base::TimeTicks::Now()) {}
++BrowserOSCallLimiter::PendingCall::PendingCall(PendingCall&&) = default;
++BrowserOSCallLimiter::PendingCall&
++BrowserOSCallLimiter::PendingCall::operator=(PendingCall&&) = default;
++BrowserOSCallLimiter::PendingCall::~PendingCall() = default;
++
++BrowserOSCallLimiter::CallerState::CallerState() = default;
++BrowserOSCallLimiter::CallerState::CallerState(CallerState&&) = default;
++BrowserOSCallLimiter::CallerState&
++BrowserOSCallLimiter::CallerState::operator=(CallerState&&) = default;
++BrowserOSCallLimiter::CallerState::~CallerState() = default;
++
++// static
++BrowserOSCallLimiter* BrowserOSCallLimiter::GetInstance() {
++  static base::NoDestructor<BrowserOSCallLimiter> instance;
++  return instance.get();
++}
++
++BrowserOSCallLimiter::BrowserOSCallLimiter()
++    // Unretained: the limiter is never destroyed
++    : profiler_registration_(browseros::AddStepProfilerSource(
++          "call_limiter",
++          base::BindRepeating(&BrowserOSCallLimiter::ReportStepProfile,
++                              base::Unretained(this)))) {}
++BrowserOSCallLimiter::~BrowserOSCallLimiter() = default;
++
++bool BrowserOSCallLimiter::Admit(const std::string& caller,
++                                 int tab_id,
++                                 StartCallback start) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++
++  CallerState& state = callers_[caller];
++  if (HasCapacity(state, tab_id)) {
++    Start(caller, tab_id, std::move(start));
++    return true;
++  }
++
++  if (state.queue.size() >= kMaxQueuedHeavyCalls) {
++    rejected_count_++;
++    LOG(WARNING) << "[browseros] Rejecting heavy call for tab " << tab_id
++                 << ": " << state.queue.size() << " already queued";
++    browseros_metrics::BrowserOSMetrics::Count("heavy_call.rejected");
++    if (state.running == 0 && state.queue.empty()) {
++      callers_.erase(caller);
++    }
++    return false;
++  }
++
++  VLOG(1) << "[browseros] Queued heavy call for tab " << tab_id << " behind "
++          << state.running << " running, " << state.queue.size() << " queued";
++  state.queue.emplace_back(tab_id, std::move(start));
++  return true;
++}
++
++bool BrowserOSCallLimiter::HasCapacity(const CallerState& state,
++                                       int tab_id) const {
++  if (state.running >= kMaxHeavyCallsPerCaller) {
++    return false;
++  }
++  auto it = running_by_tab_.find(tab_id);
++  return it == running_by_tab_.end() || it->second < kMaxHeavyCallsPerTab;
++}
++
++void BrowserOSCallLimiter::Start(const std::string& caller,
++                                 int tab_id,
++                                 StartCallback start) {
++  callers_[caller].running++;
++  running_by_tab_[tab_id]++;
++  RunWithSlot(caller, tab_id, std::move(start));
++}
++
++void BrowserOSCallLimiter::RunWithSlot(const std::string& caller,
++                                       int tab_id,
++                                       StartCallback start) {
++  // Unretained is safe: the limiter is never destroyed
++  std::move(start).Run(base::ScopedClosureRunner(
++      base::BindOnce(&BrowserOSCallLimiter::OnCallDone,
++                     base::Unretained(this), caller, tab_id)));
++}
++
++void BrowserOSCallLimiter::OnCallDone(const std::string& caller, int tab_id) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++
++  auto tab_it = running_by_tab_.find(tab_id);
++  if (tab_it != running_by_tab_.end() && --tab_it->second == 0) {
++    running_by_tab_.erase(tab_it);
++  }
++  auto caller_it = callers_.find(caller);
++  if (caller_it == callers_.end()) {
++    return;
++  }
++  caller_it->second.running--;
++
++  // Slots are released from destructors, so queued calls start in a task
++  // of their own
++  if (!start_posted_) {
++    start_posted_ = true;
++    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++        FROM_HERE, base::BindOnce(&BrowserOSCallLimiter::StartQueuedCalls,
++                                  base::Unretained(this)));
++  }
++}
++
++void BrowserOSCallLimiter::StartQueuedCalls() {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  start_posted_ = false;
++
++  // Each caller's calls start in order, skipping ones whose tab is busy.
++  // Slots are taken first and the calls run afterwards, as a call may
++  // finish or admit another one while it starts.
++  std::vector<std::pair<std::string, PendingCall>> ready;
++  for (auto it = callers_.begin(); it != callers_.end();) {
++    auto& [caller, state] = *it;
++    for (auto call_it = state.queue.begin(); call_it != state.queue.end();) {
++      if (!HasCapacity(state, call_it->tab_id)) {
++        ++call_it;
++        continue;
++      }
++      state.running++;
++      running_by_tab_[call_it->tab_id]++;
++      ready.emplace_back(caller, std::move(*call_it));
++      call_it = state.queue.erase(call_it);
++    }
++    if (state.running == 0 && state.queue.empty()) {
++      it = callers_.erase(it);
++    } else {
++      ++it;
++    }
++  }
++
++  for (auto& [caller, call] : ready) {
++    browseros_metrics::BrowserOSMetrics::RecordLatency(
++        "heavy_call.queue.wait", base::TimeTicks::Now() - call.enqueue_time);
++    RunWithSlot(caller, call.tab_id, std::move(call.start));
++  }
++}
++
++void BrowserOSCallLimiter::ReportStepProfile(
++    base::OnceCallback<void(base::Value::Dict)> done) {
++  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
++  base::Value::Dict by_caller;
++  for (const auto& [caller, state] : callers_) {
++    by_caller.Set(caller.empty() ? "(direct)" : caller,
++                  base::Value::Dict()
++                      .Set("running", static_cast<int>(state.running))
++                      .Set("queued", static_cast<int>(state.queue.size())));
++  }
++  std::move(done).Run(
++      base::Value::Dict()
++          .Set("maxPerCaller", static_cast<int>(kMaxHeavyCallsPerCaller))
++          .Set("maxPerTab", static_cast<int>(kMaxHeavyCallsPerTab))
++          .Set("maxQueued", static_cast<int>(kMaxQueuedHeavyCalls))
++          .Set("rejected", static_cast<double>(rejected_count_))
++          .Set("callers", std::move(by_caller)));
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,129 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_call_limiter.h b/chrome/browser/extensions/api/browser_os/browser_os_call_limiter.h
+new file mode 100644
+index 0000000000000..339b4482545a8
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_call_limiter.h
+@@ -0,0 +1,123 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CALL_LIMITER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CALL_LIMITER_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <map>
++#include <string>
++#include <unordered_map>
++
++#include "base/containers/circular_deque.h"
++#include "base/functional/callback.h"
++#include "base/functional/callback_helpers.h"
++#include "base/no_destructor.h"
++#include "base/sequence_checker.h"
++#include "base/time/time.h"
++#include "base/values.h"
++
++namespace extensions {
++namespace api {
++
++// Heavy calls of one caller that run at once, across its tabs
++inline constexpr size_t kMaxHeavyCallsPerCaller = 8;
++// Heavy calls that run at once on one tab, across callers
++inline constexpr size_t kMaxHeavyCallsPerTab = 2;
++// Heavy calls one caller may have waiting; more are rejected
++inline constexpr size_t kMaxQueuedHeavyCalls = 64;
++
++inline constexpr char kTooManyHeavyCallsError[] =
++    "Too many snapshot and screenshot calls in flight; wait for some to "
++    "finish";
++
++// Bounds the browserOS calls that hold a whole AX tree or bitmap while they
++// run: interactive snapshots, accessibility trees, screenshots and page
++// state captures. Without it an agent firing hundreds of them at once makes
++// the browser hold hundreds of trees and bitmaps.
++//
++// A call runs once its caller (the extension, or the direct call server)
++// and its tab are under kMaxHeavyCallsPerCaller and kMaxHeavyCallsPerTab.
++// Until then it waits in its caller's FIFO queue, where a call for a busy
++// tab does not hold up the caller's calls for other tabs. A caller already
++// queueing kMaxQueuedHeavyCalls calls is rejected right away, so the
++// agent backs off instead of the browser running out of memory.
++//
++// Lives on the UI thread.
++class BrowserOSCallLimiter {
++ public:
++  // Receives the call's slot, which is released when the runner goes away.
++  // Callers keep it for as long as they hold the tree or bitmap.
++  using StartCallback = base::OnceCallback<void(base::ScopedClosureRunner)>;
++
++  static BrowserOSCallLimiter* GetInstance();
++
++  BrowserOSCallLimiter(const BrowserOSCallLimiter&) = delete;
++  BrowserOSCallLimiter& operator=(const BrowserOSCallLimiter&) = delete;
++
++  // Runs |start| once |caller| and |tab_id| have a free slot, synchronously
++  // if they have one now. Returns false without running |start| if the
++  // caller's queue is full.
++  [[nodiscard]] bool Admit(const std::string& caller,
++                           int tab_id,
++                           StartCallback start);
++
++ private:
++  friend class base::NoDestructor<BrowserOSCallLimiter>;
++
++  struct PendingCall {
++    PendingCall(int tab_id, StartCallback start);
++    PendingCall(PendingCall&&);
++    PendingCall& operator=(PendingCall&&);
++    ~PendingCall();
++
++    int tab_id;
++    StartCallback start;
++    base::TimeTicks enqueue_time;
++  };
++
++  struct CallerState {
++    CallerState();
++    CallerState(CallerState&&);
++    CallerState& operator=(CallerState&&);
++    ~CallerState();
++
++    size_t running = 0;
++    base::circular_deque<PendingCall> queue;
++  };
++
++  BrowserOSCallLimiter();
++  ~BrowserOSCallLimiter();
++
++  bool HasCapacity(const CallerState& state, int tab_id) const;
++
++  // Takes a slot and runs |start| with it
++  void Start(const std::string& caller, int tab_id, StartCallback start);
++  // Runs |start| with the slot it was given
++  void RunWithSlot(const std::string& caller,
++                   int tab_id,
++                   StartCallback start);
++
++  void OnCallDone(const std::string& caller, int tab_id);
++
++  // Starts every queued call that has a slot now, and forgets idle callers
++  void StartQueuedCalls();
++
++  // Running and queued calls, for chrome://browseros-internals
++  void ReportStepProfile(base::OnceCallback<void(base::Value::Dict)> done);
++
++  std::map<std::string, CallerState> callers_;
++  std::unordered_map<int, size_t> running_by_tab_;
++  uint64_t rejected_count_ = 0;
++  bool start_posted_ = false;
++  base::ScopedClosureRunner profiler_registration_;
++
++  SEQUENCE_CHECKER(sequence_checker_);
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CALL_LIMITER_H_
@@ -1,27 +1,49 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
 new file mode 100644
-index 0000000000000..ea45bebcce461
+index 0000000000000..da47a51a8e553
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
-@@ -0,0 +1,205 @@
+@@ -0,0 +1,386 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
 +
++#include <algorithm>
++#include <utility>
++
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
-+#include "base/run_loop.h"
++#include "base/no_destructor.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/trace_event/trace_event.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
 +#include "content/public/browser/focused_node_details.h"
 +#include "content/public/browser/navigation_handle.h"
 +#include "content/public/browser/render_frame_host.h"
 +#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_enum_util.h"
 +#include "ui/accessibility/ax_updates_and_events.h"
 +
 +namespace extensions {
 +namespace api {
 +
++namespace {
++
++// Most AX nodes a BrowserOSChangeRecorder tracks. Past this the summary is
++// marked truncated; a change that large calls for a new snapshot anyway.
++constexpr size_t kMaxRecordedDirtiedNodes = 1000;
++
++base::RepeatingCallback<void(base::TimeDelta)>& GetWaitObserver() {
++  static base::NoDestructor<base::RepeatingCallback<void(base::TimeDelta)>>
++      observer;
++  return *observer;
++}
++
++}  // namespace
++
 +BrowserOSChangeDetector::BrowserOSChangeDetector(content::WebContents* web_contents)
 +    : content::WebContentsObserver(web_contents) {}
 +
@@ -29,24 +51,23 @@ index 0000000000000..ea45bebcce461
 +  timeout_timer_.Stop();
 +}
 +
-+// Static method for synchronous detection
-+bool BrowserOSChangeDetector::ExecuteWithDetection(
-+    content::WebContents* web_contents,
-+    std::function<void()> action,
-+    base::TimeDelta timeout) {
-+  auto detector = std::make_unique<BrowserOSChangeDetector>(web_contents);
-+  return detector->ExecuteAndWait(std::move(action), timeout);
-+}
-+
 +// Static method for asynchronous detection
 +void BrowserOSChangeDetector::ExecuteWithDetectionAsync(
 +    content::WebContents* web_contents,
 +    std::function<void()> action,
 +    base::OnceCallback<void(bool)> callback,
-+    base::TimeDelta timeout) {
++    base::TimeDelta timeout,
++    const SettlePolicy& policy) {
 +  // Create detector on heap - it will delete itself when done
 +  auto* detector = new BrowserOSChangeDetector(web_contents);
-+  detector->ExecuteAndNotify(std::move(action), std::move(callback), timeout);
++  detector->ExecuteAndNotify(std::move(action), std::move(callback), timeout,
++                             policy);
++}
++
++// static
++void BrowserOSChangeDetector::SetWaitObserverForTesting(
++    base::RepeatingCallback<void(base::TimeDelta)> observer) {
++  GetWaitObserver() = std::move(observer);
 +}
 +
 +void BrowserOSChangeDetector::StartMonitoring() {
@@ -55,104 +76,128 @@ index 0000000000000..ea45bebcce461
 +  VLOG(1) << "[browseros] Started monitoring for changes";
 +}
 +
-+bool BrowserOSChangeDetector::ExecuteAndWait(std::function<void()> action,
-+                                             base::TimeDelta timeout) {
-+  StartMonitoring();
-+  
-+  // Execute the action
-+  action();
-+  
-+  // If change already detected (synchronously), return immediately
-+  if (change_detected_) {
-+    VLOG(1) << "[browseros] Change detected immediately";
-+    return true;
-+  }
-+  
-+  // Set up run loop to wait for changes
-+  base::RunLoop run_loop(base::RunLoop::Type::kNestableTasksAllowed);
-+  wait_callback_ = run_loop.QuitClosure();
-+  
-+  // Start timeout timer
-+  timeout_timer_.Start(FROM_HERE, timeout,
-+                      base::BindOnce(&BrowserOSChangeDetector::OnTimeout,
-+                                    weak_factory_.GetWeakPtr()));
-+  
-+  // Wait for change or timeout
-+  run_loop.Run();
-+  
-+  // Clean up
-+  timeout_timer_.Stop();
-+  wait_callback_.Reset();
-+  monitoring_ = false;
-+  
-+  VLOG(1) << "[browseros] Change detection result: " << change_detected_;
-+  return change_detected_;
-+}
-+
 +void BrowserOSChangeDetector::ExecuteAndNotify(
 +    std::function<void()> action,
 +    base::OnceCallback<void(bool)> callback,
-+    base::TimeDelta timeout) {
++    base::TimeDelta timeout,
++    const SettlePolicy& policy) {
++  policy_ = policy;
++  start_time_ = base::TimeTicks::Now();
++  TRACE_EVENT_BEGIN("browser", "BrowserOS::WaitForChange",
++                    perfetto::Track::FromPointer(this));
 +  StartMonitoring();
 +  result_callback_ = std::move(callback);
 +  
 +  // Execute the action
++  running_action_ = true;
 +  action();
++  running_action_ = false;
 +  
-+  // If change already detected, notify immediately
++  // If change already detected, notify right away (or keep settling)
 +  if (change_detected_) {
-+    VLOG(1) << "[browseros] Change detected immediately (async)";
-+    std::move(result_callback_).Run(true);
-+    delete this;  // Self-delete
++    VLOG(1) << "[browseros] Change detected immediately";
++    if (!NeedsSettle()) {
++      Finish(true);
++    }
 +    return;
 +  }
 +  
 +  // Start timeout timer
++  const base::TimeDelta change_timeout =
++      std::min(policy_.change_timeout.value_or(timeout), policy_.max_wait);
 +  timeout_timer_.Start(
-+      FROM_HERE, timeout,
++      FROM_HERE, change_timeout,
 +      base::BindOnce(&BrowserOSChangeDetector::OnTimeout,
 +                    weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSChangeDetector::OnChangeDetected() {
-+  if (!monitoring_ || change_detected_) {
++  if (!monitoring_) {
 +    return;
 +  }
 +  
-+  change_detected_ = true;
-+  monitoring_ = false;
-+  
-+  VLOG(1) << "[browseros] Change detected";
-+  
-+  // Stop the timeout timer
-+  timeout_timer_.Stop();
-+  
-+  // If synchronous wait, quit the run loop
-+  if (wait_callback_) {
-+    std::move(wait_callback_).Run();
++  if (!change_detected_) {
++    change_detected_ = true;
++    
++    VLOG(1) << "[browseros] Change detected";
++    
++    // Stop the timeout timer
++    timeout_timer_.Stop();
++    
++    if (!NeedsSettle()) {
++      monitoring_ = false;
++      // Change seen while the action itself is still running;
++      // ExecuteAndNotify reports it once the action returns
++      if (running_action_) {
++        return;
++      }
++      Finish(true);
++      return;
++    }
++    
++    // Keep watching until the page goes quiet, but never past max_wait
++    const base::TimeDelta remaining =
++        policy_.max_wait - (base::TimeTicks::Now() - start_time_);
++    settle_deadline_timer_.Start(
++        FROM_HERE, std::max(remaining, base::TimeDelta()),
++        base::BindOnce(&BrowserOSChangeDetector::OnSettleDeadline,
++                       weak_factory_.GetWeakPtr()));
 +  }
 +  
-+  // If async, notify callback and self-delete
-+  if (result_callback_) {
-+    std::move(result_callback_).Run(true);
-+    delete this;  // Self-delete for async mode
-+  }
++  // Every further change restarts the quiet window
++  quiet_ = false;
++  quiet_timer_.Start(
++      FROM_HERE, policy_.quiet_period,
++      base::BindOnce(&BrowserOSChangeDetector::OnQuietPeriodElapsed,
++                     weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSChangeDetector::OnTimeout() {
 +  VLOG(1) << "[browseros] Change detection timeout";
 +  monitoring_ = false;
-+  
-+  // If synchronous wait, quit the run loop
-+  if (wait_callback_) {
-+    std::move(wait_callback_).Run();
++  Finish(false);
++}
++
++bool BrowserOSChangeDetector::NeedsSettle() const {
++  return policy_.quiet_period.is_positive() || policy_.wait_for_network_idle;
++}
++
++void BrowserOSChangeDetector::OnQuietPeriodElapsed() {
++  quiet_ = true;
++  MaybeFinishSettled();
++}
++
++void BrowserOSChangeDetector::MaybeFinishSettled() {
++  if (policy_.wait_for_network_idle && web_contents() &&
++      web_contents()->IsLoading()) {
++    VLOG(2) << "[browseros] Page quiet, waiting for loading to stop";
++    return;
 +  }
 +  
-+  // If async, notify callback with false and self-delete
-+  if (result_callback_) {
-+    std::move(result_callback_).Run(false);
-+    delete this;  // Self-delete for async mode
++  VLOG(1) << "[browseros] Page settled after "
++          << (base::TimeTicks::Now() - start_time_).InMilliseconds() << "ms";
++  monitoring_ = false;
++  Finish(true);
++}
++
++void BrowserOSChangeDetector::OnSettleDeadline() {
++  VLOG(1) << "[browseros] Page did not settle within max wait";
++  monitoring_ = false;
++  Finish(true);
++}
++
++void BrowserOSChangeDetector::Finish(bool changed) {
++  VLOG(1) << "[browseros] Change detection result: " << changed;
++  TRACE_EVENT_END("browser", perfetto::Track::FromPointer(this), "changed",
++                  changed);
++  if (const auto& observer = GetWaitObserver()) {
++    observer.Run(base::TimeTicks::Now() - start_time_);
 +  }
++  // Post so the next fallback attempt or the extension response does not
++  // run inside an observer notification
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(std::move(result_callback_), changed));
++  delete this;  // Self-delete
 +}
 +
 +// WebContentsObserver overrides - any of these counts as a "change"
@@ -184,6 +229,15 @@ index 0000000000000..ea45bebcce461
 +  OnChangeDetected();
 +}
 +
++void BrowserOSChangeDetector::DidStopLoading() {
++  if (!monitoring_ || !quiet_) {
++    return;
++  }
++  
++  VLOG(2) << "[browseros] Loading stopped";
++  MaybeFinishSettled();
++}
++
 +void BrowserOSChangeDetector::OnFocusChangedInPage(
 +    const content::FocusedNodeDetails& details) {
 +  if (!monitoring_) return;
@@ -207,6 +261,133 @@ index 0000000000000..ea45bebcce461
 +  OnChangeDetected();
 +}
 +
++// BrowserOSChangeRecorder implementation
++
++BrowserOSChangeRecorder::BrowserOSChangeRecorder(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents) {}
++
++BrowserOSChangeRecorder::~BrowserOSChangeRecorder() = default;
++
++browser_os::ChangeSummary BrowserOSChangeRecorder::ToSummary(
++    int tab_id) const {
++  browser_os::ChangeSummary summary;
++  summary.navigated = navigated_;
++  summary.dom_content_loaded = dom_content_loaded_;
++  summary.focus_changed = focus_changed_;
++  summary.new_window_opened = new_window_opened_;
++  summary.event_types.assign(event_types_.begin(), event_types_.end());
++  summary.dirtied_node_count = static_cast<int>(dirtied_nodes_.size());
++  if (truncated_) {
++    summary.truncated = true;
++  }
++
++  // Translate AX ids to the nodeIds the caller knows from its snapshot
++  BrowserOSNodeMappingStore* store =
++      web_contents()
++          ? BrowserOSNodeMappingStore::Get(web_contents()->GetBrowserContext())
++          : nullptr;
++  const TabNodeMappings* mappings = store ? store->Find(tab_id) : nullptr;
++  if (mappings && !dirtied_nodes_.empty()) {
++    for (const auto& [node_id, node_info] : mappings->nodes) {
++      if (dirtied_nodes_.count({node_info.ax_tree_id, node_info.ax_node_id})) {
++        summary.changed_node_ids.push_back(static_cast<int>(node_id));
++      }
++    }
++    std::sort(summary.changed_node_ids.begin(),
++              summary.changed_node_ids.end());
++  }
++  return summary;
++}
++
++void BrowserOSChangeRecorder::AddDirtiedNode(const ui::AXTreeID& tree_id,
++                                             int32_t ax_node_id) {
++  if (dirtied_nodes_.size() >= kMaxRecordedDirtiedNodes) {
++    truncated_ = true;
++    return;
++  }
++  dirtied_nodes_.emplace(tree_id, ax_node_id);
++}
++
++void BrowserOSChangeRecorder::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  for (const auto& update : details.updates) {
++    for (const auto& node : update.nodes) {
++      AddDirtiedNode(details.ax_tree_id, node.id);
++    }
++  }
++  for (const auto& event : details.events) {
++    event_types_.insert(ui::ToString(event.event_type));
++    AddDirtiedNode(details.ax_tree_id, event.id);
++  }
++}
++
++void BrowserOSChangeRecorder::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  if (navigation_handle->HasCommitted()) {
++    navigated_ = true;
++  }
++}
++
++void BrowserOSChangeRecorder::DOMContentLoaded(
++    content::RenderFrameHost* render_frame_host) {
++  dom_content_loaded_ = true;
++}
++
++void BrowserOSChangeRecorder::OnFocusChangedInPage(
++    const content::FocusedNodeDetails& details) {
++  focus_changed_ = true;
++}
++
++void BrowserOSChangeRecorder::DidOpenRequestedURL(
++    content::WebContents* new_contents,
++    content::RenderFrameHost* source_render_frame_host,
++    const GURL& url,
++    const content::Referrer& referrer,
++    WindowOpenDisposition disposition,
++    ui::PageTransition transition,
++    bool started_from_context_menu,
++    bool renderer_initiated) {
++  if (disposition != WindowOpenDisposition::CURRENT_TAB) {
++    new_window_opened_ = true;
++  }
++}
++
++BrowserOSTreeChangeWatcher::BrowserOSTreeChangeWatcher(
++    content::WebContents* web_contents,
++    base::TimeDelta delay,
++    base::RepeatingClosure on_change)
++    : content::WebContentsObserver(web_contents),
++      delay_(delay),
++      on_change_(std::move(on_change)) {}
++
++BrowserOSTreeChangeWatcher::~BrowserOSTreeChangeWatcher() = default;
++
++void BrowserOSTreeChangeWatcher::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  ScheduleCallback();
++}
++
++void BrowserOSTreeChangeWatcher::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  if (navigation_handle->IsInPrimaryMainFrame() &&
++      navigation_handle->HasCommitted()) {
++    ScheduleCallback();
++  }
++}
++
++void BrowserOSTreeChangeWatcher::WebContentsDestroyed() {
++  ScheduleCallback();
++}
++
++void BrowserOSTreeChangeWatcher::ScheduleCallback() {
++  // A running timer already covers this change; restarting it would starve
++  // the callback on a page that never stops changing
++  if (!timer_.IsRunning()) {
++    timer_.Start(FROM_HERE, delay_, on_change_);
++  }
++}
++
 +}  // namespace api
 +}  // namespace extensions
 \ No newline at end of file
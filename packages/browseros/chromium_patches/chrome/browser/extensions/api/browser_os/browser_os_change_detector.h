@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h
 new file mode 100644
-index 0000000000000..a45117498c829
+index 0000000000000..2c18ac14b1148
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h
-@@ -0,0 +1,108 @@
+@@ -0,0 +1,236 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,13 +11,20 @@ index 0000000000000..a45117498c829
 +#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_DETECTOR_H_
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_DETECTOR_H_
 +
++#include <cstdint>
 +#include <functional>
++#include <optional>
++#include <set>
++#include <string>
++#include <utility>
 +
 +#include "base/functional/callback.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/time/time.h"
 +#include "base/timer/timer.h"
++#include "chrome/common/extensions/api/browser_os.h"
 +#include "content/public/browser/web_contents_observer.h"
++#include "ui/accessibility/ax_tree_id.h"
 +
 +namespace content {
 +class WebContents;
@@ -30,24 +37,45 @@ index 0000000000000..a45117498c829
 +namespace extensions {
 +namespace api {
 +
++// Controls when BrowserOSChangeDetector considers an action finished. The
++// default policy reports on the first observed change.
++struct SettlePolicy {
++  // How long to wait for a first change before the attempt counts as having
++  // no effect. Unset uses the timeout passed by the caller.
++  std::optional<base::TimeDelta> change_timeout;
++  // After the first change, keep waiting until no further change has been
++  // observed for this long. Zero reports right after the first change.
++  base::TimeDelta quiet_period;
++  // Upper bound on the whole wait, including |change_timeout| and the quiet
++  // period
++  base::TimeDelta max_wait = base::Seconds(2);
++  // Also wait for the tab to stop loading before reporting a change
++  bool wait_for_network_idle = false;
++};
++
 +// Change detector that monitors if any change occurred in the web content
 +// after an action is performed. This is used to verify that actions like
 +// click, type, clear, etc. actually had an effect on the page.
++// Detection never blocks the UI thread: the result is delivered through a
++// callback once a change is seen or the timeout expires.
 +class BrowserOSChangeDetector : public content::WebContentsObserver {
 + public:
 +  // Execute an action and detect if it causes any change in the page
-+  // Returns true if any change was detected within the timeout period
-+  static bool ExecuteWithDetection(
-+      content::WebContents* web_contents,
-+      std::function<void()> action,
-+      base::TimeDelta timeout = base::Milliseconds(300));
-+
-+  // Alternative async version that doesn't block
++  // |callback| runs with true if any change was detected within the timeout
++  // period, once the page has settled according to |policy|. It is always
++  // posted, never run before this returns.
 +  static void ExecuteWithDetectionAsync(
 +      content::WebContents* web_contents,
 +      std::function<void()> action,
 +      base::OnceCallback<void(bool)> callback,
-+      base::TimeDelta timeout = base::Milliseconds(300));
++      base::TimeDelta timeout = base::Milliseconds(300),
++      const SettlePolicy& policy = SettlePolicy());
++
++  // Runs |observer| with the length of every detection from now on, from
++  // the start of the action until the result is known. A null callback
++  // stops it. Lets perf tests split a step into waiting and work.
++  static void SetWaitObserverForTesting(
++      base::RepeatingCallback<void(base::TimeDelta)> observer);
 +
 +  // Constructor and destructor are public for use by factory methods
 +  explicit BrowserOSChangeDetector(content::WebContents* web_contents);
@@ -60,13 +88,11 @@ index 0000000000000..a45117498c829
 +  // Start monitoring for changes
 +  void StartMonitoring();
 +
-+  // Execute the action and wait for changes
-+  bool ExecuteAndWait(std::function<void()> action, base::TimeDelta timeout);
-+
 +  // Execute the action and notify via callback
 +  void ExecuteAndNotify(std::function<void()> action,
 +                        base::OnceCallback<void(bool)> callback,
-+                        base::TimeDelta timeout);
++                        base::TimeDelta timeout,
++                        const SettlePolicy& policy);
 +
 +  // WebContentsObserver overrides - we monitor any of these as "changes"
 +  void AccessibilityEventReceived(
@@ -75,6 +101,7 @@ index 0000000000000..a45117498c829
 +      content::NavigationHandle* navigation_handle) override;
 +  void DOMContentLoaded(
 +      content::RenderFrameHost* render_frame_host) override;
++  void DidStopLoading() override;
 +  void OnFocusChangedInPage(
 +      const content::FocusedNodeDetails& details) override;
 +  void DidOpenRequestedURL(
@@ -93,21 +120,122 @@ index 0000000000000..a45117498c829
 +  // Called when timeout expires
 +  void OnTimeout();
 +
++  // Whether |policy_| asks to keep waiting after the first change
++  bool NeedsSettle() const;
++
++  // Called once no change has been seen for the quiet period
++  void OnQuietPeriodElapsed();
++
++  // Reports the change unless still waiting for the tab to stop loading
++  void MaybeFinishSettled();
++
++  // Called when |policy_.max_wait| expires while settling
++  void OnSettleDeadline();
++
++  // Posts the result callback and deletes this
++  void Finish(bool changed);
++
 +  // Simple state tracking
 +  bool monitoring_ = false;
 +  bool change_detected_ = false;
++  bool running_action_ = false;
++  bool quiet_ = false;
++
++  SettlePolicy policy_;
++  base::TimeTicks start_time_;
 +  
-+  // Callbacks
-+  base::OnceClosure wait_callback_;
++  // Callback
 +  base::OnceCallback<void(bool)> result_callback_;
 +  
 +  // Timer for timeout
 +  base::OneShotTimer timeout_timer_;
++
++  // Timers used while settling after the first change
++  base::OneShotTimer quiet_timer_;
++  base::OneShotTimer settle_deadline_timer_;
 +  
 +  // Weak pointer factory
 +  base::WeakPtrFactory<BrowserOSChangeDetector> weak_factory_{this};
 +};
 +
++// Records what the page did while an interaction ran, for
++// InteractionResponse.changes. Unlike BrowserOSChangeDetector it does not
++// decide anything; it observes for as long as it is alive, across every
++// fallback attempt of the action.
++class BrowserOSChangeRecorder : public content::WebContentsObserver {
++ public:
++  explicit BrowserOSChangeRecorder(content::WebContents* web_contents);
++  ~BrowserOSChangeRecorder() override;
++
++  BrowserOSChangeRecorder(const BrowserOSChangeRecorder&) = delete;
++  BrowserOSChangeRecorder& operator=(const BrowserOSChangeRecorder&) = delete;
++
++  // Builds the summary. Dirtied nodes are reported as nodeIds of |tab_id|'s
++  // node mappings, in the store of the observed tab's profile.
++  browser_os::ChangeSummary ToSummary(int tab_id) const;
++
++ private:
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void DOMContentLoaded(
++      content::RenderFrameHost* render_frame_host) override;
++  void OnFocusChangedInPage(
++      const content::FocusedNodeDetails& details) override;
++  void DidOpenRequestedURL(
++      content::WebContents* new_contents,
++      content::RenderFrameHost* source_render_frame_host,
++      const GURL& url,
++      const content::Referrer& referrer,
++      WindowOpenDisposition disposition,
++      ui::PageTransition transition,
++      bool started_from_context_menu,
++      bool renderer_initiated) override;
++
++  // Adds a dirtied node unless the cap has been reached
++  void AddDirtiedNode(const ui::AXTreeID& tree_id, int32_t ax_node_id);
++
++  bool navigated_ = false;
++  bool dom_content_loaded_ = false;
++  bool focus_changed_ = false;
++  bool new_window_opened_ = false;
++  bool truncated_ = false;
++  std::set<std::string> event_types_;
++  std::set<std::pair<ui::AXTreeID, int32_t>> dirtied_nodes_;
++};
++
++// Runs a callback when the page's accessibility tree may have changed, for
++// callers that re-evaluate the page instead of polling it. Bursts of events
++// are coalesced: the callback runs at most once per |delay|, |delay| after
++// the first change it covers. Also runs once the tab is destroyed.
++class BrowserOSTreeChangeWatcher : public content::WebContentsObserver {
++ public:
++  BrowserOSTreeChangeWatcher(content::WebContents* web_contents,
++                             base::TimeDelta delay,
++                             base::RepeatingClosure on_change);
++  ~BrowserOSTreeChangeWatcher() override;
++
++  BrowserOSTreeChangeWatcher(const BrowserOSTreeChangeWatcher&) = delete;
++  BrowserOSTreeChangeWatcher& operator=(const BrowserOSTreeChangeWatcher&) =
++      delete;
++
++ private:
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void WebContentsDestroyed() override;
++
++  void ScheduleCallback();
++
++  const base::TimeDelta delay_;
++  const base::RepeatingClosure on_change_;
++  base::OneShotTimer timer_;
++};
++
 +}  // namespace api
 +}  // namespace extensions
 +
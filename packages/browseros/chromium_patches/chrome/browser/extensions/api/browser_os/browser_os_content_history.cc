@@ -0,0 +1,64 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_history.cc b/chrome/browser/extensions/api/browser_os/browser_os_content_history.cc
+new file mode 100644
+index 0000000000000..7baf98ea9fafe
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_content_history.cc
+@@ -0,0 +1,58 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_history.h"
++
++#include <utility>
++
++namespace extensions {
++namespace api {
++
++ContentSnapshot::ContentSnapshot() = default;
++ContentSnapshot::ContentSnapshot(ContentSnapshot&&) = default;
++ContentSnapshot& ContentSnapshot::operator=(ContentSnapshot&&) = default;
++ContentSnapshot::~ContentSnapshot() = default;
++
++BrowserOSContentHistory::Entry::Entry() = default;
++BrowserOSContentHistory::Entry::Entry(const Entry&) = default;
++BrowserOSContentHistory::Entry& BrowserOSContentHistory::Entry::operator=(
++    const Entry&) = default;
++BrowserOSContentHistory::Entry::~Entry() = default;
++
++BrowserOSContentHistory::BrowserOSContentHistory(
++    content::WebContents* web_contents)
++    : content::WebContentsUserData<BrowserOSContentHistory>(*web_contents) {}
++
++BrowserOSContentHistory::~BrowserOSContentHistory() = default;
++
++const BrowserOSContentHistory::Entry* BrowserOSContentHistory::Find(
++    ContentProcessor::Mode mode,
++    std::optional<int> snapshot_id,
++    const std::optional<std::string>& content_hash) const {
++  if (!last_ || last_->mode != mode) {
++    return nullptr;
++  }
++  if ((snapshot_id && *snapshot_id == last_->snapshot_id) ||
++      (content_hash && *content_hash == last_->content_hash)) {
++    return &*last_;
++  }
++  return nullptr;
++}
++
++int BrowserOSContentHistory::Store(ContentProcessor::Mode mode,
++                                   std::string content_hash,
++                                   std::vector<uint32_t> item_hashes) {
++  Entry entry;
++  entry.snapshot_id = next_snapshot_id_++;
++  entry.mode = mode;
++  entry.content_hash = std::move(content_hash);
++  entry.item_hashes = std::move(item_hashes);
++  last_ = std::move(entry);
++  return last_->snapshot_id;
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSContentHistory);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,85 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_history.h b/chrome/browser/extensions/api/browser_os/browser_os_content_history.h
+new file mode 100644
+index 0000000000000..2119a11934d71
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_content_history.h
+@@ -0,0 +1,79 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_HISTORY_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_HISTORY_H_
++
++#include <cstdint>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace extensions {
++namespace api {
++
++// A getSnapshot result built on the ThreadPool, with the item hashes to
++// remember for it
++struct ContentSnapshot {
++  ContentSnapshot();
++  ContentSnapshot(ContentSnapshot&&);
++  ContentSnapshot& operator=(ContentSnapshot&&);
++  ~ContentSnapshot();
++
++  browser_os::PageContent content;
++  std::vector<uint32_t> item_hashes;
++};
++
++// Remembers the last getSnapshot result of a tab, as item hashes, so that
++// the next call can return only what changed since. Holds one entry per
++// tab and goes away with the tab.
++class BrowserOSContentHistory
++    : public content::WebContentsUserData<BrowserOSContentHistory> {
++ public:
++  struct Entry {
++    Entry();
++    Entry(const Entry&);
++    Entry& operator=(const Entry&);
++    ~Entry();
++
++    int snapshot_id = 0;
++    ContentProcessor::Mode mode = ContentProcessor::Mode::kAll;
++    std::string content_hash;
++    std::vector<uint32_t> item_hashes;
++  };
++
++  BrowserOSContentHistory(const BrowserOSContentHistory&) = delete;
++  BrowserOSContentHistory& operator=(const BrowserOSContentHistory&) = delete;
++  ~BrowserOSContentHistory() override;
++
++  // Returns the last entry if it was taken in |mode| and is named by
++  // |snapshot_id| or |content_hash|
++  const Entry* Find(ContentProcessor::Mode mode,
++                    std::optional<int> snapshot_id,
++                    const std::optional<std::string>& content_hash) const;
++
++  // Replaces the last entry and returns its new snapshot id
++  int Store(ContentProcessor::Mode mode,
++            std::string content_hash,
++            std::vector<uint32_t> item_hashes);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSContentHistory>;
++
++  explicit BrowserOSContentHistory(content::WebContents* web_contents);
++
++  int next_snapshot_id_ = 1;
++  std::optional<Entry> last_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_HISTORY_H_
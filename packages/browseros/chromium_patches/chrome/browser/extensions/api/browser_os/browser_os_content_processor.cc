@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc
 new file mode 100644
-index 0000000000000..4166f1a38737c
+index 0000000000000..68b96081e2bd1
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc
-@@ -0,0 +1,247 @@
+@@ -0,0 +1,497 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,15 +11,25 @@ index 0000000000000..4166f1a38737c
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
 +
 +#include <algorithm>
++#include <optional>
++#include <string>
++#include <unordered_map>
++#include <utility>
 +
++#include "base/containers/span.h"
++#include "base/hash/hash.h"
 +#include "base/logging.h"
++#include "base/memory/raw_ref.h"
++#include "base/strings/string_number_conversions.h"
 +#include "base/strings/string_util.h"
++#include "chrome/browser/browseros/core/browseros_ax_tree_walker.h"
 +#include "ui/accessibility/ax_enum_util.h"
 +#include "ui/accessibility/ax_enums.mojom.h"
 +#include "ui/accessibility/ax_node_data.h"
 +#include "ui/accessibility/ax_role_properties.h"
 +#include "ui/gfx/geometry/rect.h"
 +#include "ui/gfx/geometry/rect_conversions.h"
++#include "url/gurl.h"
 +
 +namespace extensions {
 +namespace api {
@@ -48,11 +58,103 @@ index 0000000000000..4166f1a38737c
 +  return result;
 +}
 +
++// Main content scoring weights
++constexpr double kLandmarkBonus = 1.5;
++// A child keeps the descent going while it holds this share of its
++// parent's score
++constexpr double kDominantShare = 0.7;
++
++// Text length and link text length of a subtree
++struct SubtreeText {
++  size_t chars = 0;
++  size_t link_chars = 0;
++};
++
 +}  // namespace
 +
++// Collects ContentItems through VisitNode
++class ContentProcessor::ItemSink : public browseros::AXContentSink {
++ public:
++  ItemSink(std::vector<browser_os::ContentItem>& items, bool skip_boilerplate)
++      : items_(items), skip_boilerplate_(skip_boilerplate) {}
++
++  // browseros::AXContentSink:
++  bool EnterNode(const ui::AXNodeData& node) override {
++    if (skip_boilerplate_ && IsBoilerplate(node)) {
++      return false;
++    }
++    return VisitNode(node, *items_);
++  }
++
++ private:
++  const raw_ref<std::vector<browser_os::ContentItem>> items_;
++  const bool skip_boilerplate_;
++};
++
++// Scores every container in post-order: text and link lengths are summed
++// up the tree on the way out.
++class ContentProcessor::MainContentScorer : public browseros::AXContentSink {
++ public:
++  MainContentScorer() { open_.emplace_back(); }
++
++  // Subtree scores of the containers, by AX id
++  const std::unordered_map<int32_t, double>& scores() const { return scores_; }
++
++  // browseros::AXContentSink:
++  bool EnterNode(const ui::AXNodeData& node) override {
++    if (IsBoilerplate(node)) {
++      return false;
++    }
++
++    // Same terminal nodes as VisitNode; they count towards their container
++    if (!node.IsIgnored() &&
++        (ui::IsHeading(node.role) || ui::IsLink(node.role) ||
++         ui::IsText(node.role))) {
++      const size_t chars = GetAccessibleName(node).size();
++      open_.back().chars += chars;
++      if (ui::IsLink(node.role)) {
++        open_.back().link_chars += chars;
++      }
++      return false;
++    }
++    if (!node.IsIgnored() &&
++        (ui::IsImage(node.role) || node.role == ax::mojom::Role::kVideo)) {
++      return false;
++    }
++
++    open_.emplace_back();
++    return true;
++  }
++
++  void ExitNode(const ui::AXNodeData& node) override {
++    const SubtreeText text = open_.back();
++    open_.pop_back();
++    open_.back().chars += text.chars;
++    open_.back().link_chars += text.link_chars;
++
++    double score = 0;
++    if (text.chars > 0) {
++      const double link_density =
++          static_cast<double>(text.link_chars) / text.chars;
++      score = text.chars * (1.0 - link_density);
++    }
++    if (node.role == ax::mojom::Role::kMain ||
++        node.role == ax::mojom::Role::kArticle) {
++      score *= kLandmarkBonus;
++    }
++    scores_[node.id] = score;
++  }
++
++ private:
++  // Totals of the containers being walked; the first entry is a sentinel
++  std::vector<SubtreeText> open_;
++  std::unordered_map<int32_t, double> scores_;
++};
++
 +// static
 +std::vector<browser_os::ContentItem> ContentProcessor::ExtractPageContent(
-+    const ui::AXTreeUpdate& tree_update) {
++    const ui::AXTreeUpdate& tree_update,
++    Mode mode) {
 +
 +  std::vector<browser_os::ContentItem> items;
 +
@@ -63,14 +165,12 @@ index 0000000000000..4166f1a38737c
 +
 +  LOG(INFO) << "browseros: ExtractPageContent - processing " << tree_update.nodes.size() << " nodes";
 +
-+  // Build node map for O(1) lookup
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  for (const auto& node : tree_update.nodes) {
-+    node_map[node.id] = node;
-+  }
-+
-+  // Start DFS from root
-+  TraverseDFS(tree_update.root_id, node_map, items);
++  browseros::AXTreeWalker walker(tree_update);
++  const bool main_content = mode == Mode::kMainContent;
++  const int32_t root_id =
++      main_content ? FindMainContentRoot(walker) : walker.root_id();
++  ItemSink sink(items, /*skip_boilerplate=*/main_content);
++  walker.Walk(root_id, sink);
 +
 +  LOG(INFO) << "browseros: ExtractPageContent - extracted " << items.size() << " items";
 +
@@ -78,47 +178,199 @@ index 0000000000000..4166f1a38737c
 +}
 +
 +// static
-+void ContentProcessor::TraverseDFS(
-+    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+    std::vector<browser_os::ContentItem>& items) {
++uint32_t ContentProcessor::HashItem(const browser_os::ContentItem& item) {
++  // Fields are NUL separated so that moving text between them changes the
++  // hash
++  std::string key = base::NumberToString(static_cast<int>(item.type));
++  for (const std::optional<std::string>* field :
++       {&item.text, &item.url, &item.alt}) {
++    key.push_back('\0');
++    if (field->has_value()) {
++      key.append(**field);
++    }
++  }
++  key.push_back('\0');
++  if (item.level) {
++    key.append(base::NumberToString(*item.level));
++  }
++  return base::FastHash(key);
++}
++
++// static
++uint32_t ContentProcessor::HashItems(const std::vector<uint32_t>& item_hashes) {
++  return base::FastHash(base::as_byte_span(item_hashes));
++}
++
++// static
++std::vector<std::string> ContentProcessor::BuildUrlTable(
++    std::vector<browser_os::ContentItem>& items,
++    const GURL& document_url) {
++  std::vector<std::string> urls;
++  // Raw item URL -> index in |urls|
++  std::unordered_map<std::string, size_t> indices;
++  // Resolved URL -> index, so spellings of the same URL share an entry
++  std::unordered_map<std::string, size_t> resolved_indices;
++
++  for (browser_os::ContentItem& item : items) {
++    if (!item.url) {
++      continue;
++    }
++
++    auto it = indices.find(*item.url);
++    if (it == indices.end()) {
++      GURL url(*item.url);
++      if (!url.is_valid() && document_url.is_valid()) {
++        url = document_url.Resolve(*item.url);
++      }
++      std::string resolved = url.is_valid() ? url.spec() : *item.url;
++      auto [resolved_it, inserted] =
++          resolved_indices.try_emplace(std::move(resolved), urls.size());
++      if (inserted) {
++        urls.push_back(resolved_it->first);
++      }
++      it = indices.emplace(*item.url, resolved_it->second).first;
++    }
++
++    item.url_index = static_cast<int>(it->second);
++    item.url.reset();
++  }
++
++  return urls;
++}
++
++// static
++std::vector<browser_os::ContentItemChange> ContentProcessor::DiffItems(
++    const std::vector<uint32_t>& previous,
++    const std::vector<browser_os::ContentItem>& items,
++    const std::vector<uint32_t>& item_hashes) {
++  auto make_change = [](browser_os::ContentChangeType type, size_t index,
++                        const browser_os::ContentItem* item) {
++    browser_os::ContentItemChange change;
++    change.type = type;
++    change.index = static_cast<int>(index);
++    if (item) {
++      change.item = item->Clone();
++    }
++    return change;
++  };
++
++  size_t prefix = 0;
++  while (prefix < previous.size() && prefix < item_hashes.size() &&
++         previous[prefix] == item_hashes[prefix]) {
++    ++prefix;
++  }
++  size_t suffix = 0;
++  while (suffix < previous.size() - prefix &&
++         suffix < item_hashes.size() - prefix &&
++         previous[previous.size() - 1 - suffix] ==
++             item_hashes[item_hashes.size() - 1 - suffix]) {
++    ++suffix;
++  }
++
++  const size_t previous_end = previous.size() - suffix;
++  const size_t current_end = item_hashes.size() - suffix;
++  std::vector<browser_os::ContentItemChange> changes;
++  size_t i = prefix;
++  for (; i < previous_end && i < current_end; ++i) {
++    if (previous[i] != item_hashes[i]) {
++      changes.push_back(make_change(browser_os::ContentChangeType::kChanged, i,
++                                    &items[i]));
++    }
++  }
++  for (size_t j = i; j < previous_end; ++j) {
++    changes.push_back(
++        make_change(browser_os::ContentChangeType::kRemoved, j, nullptr));
++  }
++  for (size_t j = i; j < current_end; ++j) {
++    changes.push_back(make_change(browser_os::ContentChangeType::kInserted, j,
++                                  &items[j]));
++  }
++  return changes;
++}
++
++// static
++int32_t ContentProcessor::FindMainContentRoot(
++    const browseros::AXTreeWalker& walker) {
++  MainContentScorer scorer;
++  walker.Walk(scorer);
++  const std::unordered_map<int32_t, double>& scores = scorer.scores();
++
++  int32_t current_id = walker.root_id();
++  double current_score = 0;
++  if (auto it = scores.find(current_id); it != scores.end()) {
++    current_score = it->second;
++  }
 +
-+  auto it = node_map.find(node_id);
-+  if (it == node_map.end()) {
-+    return;
++  while (const ui::AXNodeData* node = walker.Find(current_id)) {
++    int32_t best_id = 0;
++    double best_score = 0;
++    for (int32_t child_id : node->child_ids) {
++      auto it = scores.find(child_id);
++      if (it != scores.end() && it->second > best_score) {
++        best_id = child_id;
++        best_score = it->second;
++      }
++    }
++    if (best_score <= 0 || best_score < current_score * kDominantShare) {
++      break;
++    }
++    current_id = best_id;
++    current_score = best_score;
 +  }
 +
-+  const ui::AXNodeData& node = it->second;
++  VLOG(1) << "[browseros] Main content root " << current_id << " of "
++          << walker.root_id();
++  return current_id;
++}
++
++// static
++bool ContentProcessor::IsBoilerplate(const ui::AXNodeData& node) {
++  switch (node.role) {
++    case ax::mojom::Role::kNavigation:
++    case ax::mojom::Role::kBanner:
++    case ax::mojom::Role::kContentInfo:
++    case ax::mojom::Role::kComplementary:
++    case ax::mojom::Role::kSearch:
++    case ax::mojom::Role::kDialog:
++    case ax::mojom::Role::kAlertDialog:
++    case ax::mojom::Role::kMenu:
++    case ax::mojom::Role::kMenuBar:
++    case ax::mojom::Role::kToolbar:
++      return true;
++    default:
++      return false;
++  }
++}
 +
-+  // Skip extracting from ignored nodes, but still recurse to children
++// static
++bool ContentProcessor::VisitNode(const ui::AXNodeData& node,
++                                 std::vector<browser_os::ContentItem>& items) {
++  // Skip extracting from ignored nodes, but still descend to children
 +  if (node.IsIgnored()) {
-+    for (int32_t child_id : node.child_ids) {
-+      TraverseDFS(child_id, node_map, items);
-+    }
-+    return;
++    return true;
 +  }
 +
 +  // Extract content at semantic boundaries
-+  // Don't recurse into these - their children are just formatting
++  // Don't descend into these - their children are just formatting
 +
 +  if (ui::IsHeading(node.role)) {
 +    items.push_back(ExtractHeading(node));
-+    return;
++    return false;
 +  }
 +
 +  if (ui::IsLink(node.role)) {
 +    items.push_back(ExtractLink(node));
-+    return;
++    return false;
 +  }
 +
 +  if (ui::IsImage(node.role)) {
 +    items.push_back(ExtractImage(node));
-+    return;
++    return false;
 +  }
 +
 +  if (node.role == ax::mojom::Role::kVideo) {
 +    items.push_back(ExtractVideo(node));
-+    return;
++    return false;
 +  }
 +
 +  if (ui::IsText(node.role)) {
@@ -127,13 +379,11 @@ index 0000000000000..4166f1a38737c
 +    if (item.text.has_value() && !item.text->empty()) {
 +      items.push_back(std::move(item));
 +    }
-+    return;
++    return false;
 +  }
 +
-+  // For container nodes (divs, sections, etc.), recurse to children
-+  for (int32_t child_id : node.child_ids) {
-+    TraverseDFS(child_id, node_map, items);
-+  }
++  // For container nodes (divs, sections, etc.), descend to children
++  return true;
 +}
 +
 +// static
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_processor.h b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.h
 new file mode 100644
-index 0000000000000..472c7b114fe97
+index 0000000000000..93fe93a77bc6e
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.h
-@@ -0,0 +1,57 @@
+@@ -0,0 +1,107 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,14 +11,20 @@ index 0000000000000..472c7b114fe97
 +#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_PROCESSOR_H_
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CONTENT_PROCESSOR_H_
 +
++#include <cstdint>
 +#include <string>
-+#include <unordered_map>
 +#include <vector>
 +
 +#include "chrome/common/extensions/api/browser_os.h"
 +#include "ui/accessibility/ax_tree_update.h"
 +#include "ui/gfx/geometry/size.h"
 +
++class GURL;
++
++namespace browseros {
++class AXTreeWalker;
++}  // namespace browseros
++
 +namespace ui {
 +struct AXNodeData;
 +}  // namespace ui
@@ -27,24 +33,68 @@ index 0000000000000..472c7b114fe97
 +namespace api {
 +
 +// Extracts page content (headings, text, links, images, videos) from
-+// accessibility tree in document order using depth-first traversal.
++// accessibility tree in document order, walked by browseros::AXTreeWalker.
++// Touches no browser state, so it can run on the ThreadPool.
 +class ContentProcessor {
 + public:
 +  ContentProcessor() = delete;
 +  ContentProcessor(const ContentProcessor&) = delete;
 +  ContentProcessor& operator=(const ContentProcessor&) = delete;
 +
++  enum class Mode {
++    // Everything, including navigation, footers and banners
++    kAll,
++    // Only the main content region; see FindMainContentRoot()
++    kMainContent,
++  };
++
 +  // Extracts page content in document order.
 +  // Returns content items preserving the order they appear in the document.
 +  static std::vector<browser_os::ContentItem> ExtractPageContent(
-+      const ui::AXTreeUpdate& tree_update);
++      const ui::AXTreeUpdate& tree_update,
++      Mode mode = Mode::kAll);
++
++  // Returns a hash of |item|'s content, stable across snapshots.
++  static uint32_t HashItem(const browser_os::ContentItem& item);
++
++  // Returns the hash of a whole item list, from its item hashes.
++  static uint32_t HashItems(const std::vector<uint32_t>& item_hashes);
++
++  // Moves the URLs of |items| into a table of distinct URLs, which is
++  // returned, and points each item at its entry through url_index.
++  // Relative URLs are resolved against |document_url|, once per distinct
++  // URL.
++  static std::vector<std::string> BuildUrlTable(
++      std::vector<browser_os::ContentItem>& items,
++      const GURL& document_url);
++
++  // Returns the changes from the items hashed in |previous| to |items|.
++  // Common leading and trailing items are matched first, so one contiguous
++  // insertion or removal is reported exactly; the items in between are
++  // compared by position.
++  static std::vector<browser_os::ContentItemChange> DiffItems(
++      const std::vector<uint32_t>& previous,
++      const std::vector<browser_os::ContentItem>& items,
++      const std::vector<uint32_t>& item_hashes);
 +
 + private:
-+  // DFS traversal to extract content in document order
-+  static void TraverseDFS(
-+      int32_t node_id,
-+      const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+      std::vector<browser_os::ContentItem>& items);
++  class ItemSink;
++  class MainContentScorer;
++
++  // Returns the root of the region holding most of the page's text.
++  // Subtrees are scored by text length, discounted by link density, with a
++  // bonus for main and article landmarks; boilerplate landmarks (navigation,
++  // banners, footers, dialogs) score nothing. Starting at the page root,
++  // descends into the best child as long as it keeps most of the score.
++  static int32_t FindMainContentRoot(const browseros::AXTreeWalker& walker);
++
++  // Returns true for landmarks left out of main content extraction
++  static bool IsBoilerplate(const ui::AXNodeData& node);
++
++  // Appends the content of |node| to |items| if it is a semantic boundary.
++  // Returns true if the traversal should continue into its children.
++  static bool VisitNode(const ui::AXNodeData& node,
++                        std::vector<browser_os::ContentItem>& items);
 +
 +  // Content extraction helpers
 +  static browser_os::ContentItem ExtractHeading(const ui::AXNodeData& node);
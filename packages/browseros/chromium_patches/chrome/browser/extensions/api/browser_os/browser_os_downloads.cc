@@ -0,0 +1,190 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_downloads.cc b/chrome/browser/extensions/api/browser_os/browser_os_downloads.cc
+new file mode 100644
+index 0000000000000..b5ffe8aa0316c
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_downloads.cc
+@@ -0,0 +1,184 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_downloads.h"
++
++#include <memory>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/str_cat.h"
++#include "components/download/public/common/download_interrupt_reasons_utils.h"
++#include "components/download/public/common/download_url_parameters.h"
++#include "content/public/browser/browser_context.h"
++#include "content/public/browser/download_item_utils.h"
++#include "content/public/browser/download_manager.h"
++#include "content/public/browser/download_request_utils.h"
++#include "content/public/browser/web_contents.h"
++#include "extensions/browser/event_router.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++#include "url/gurl.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
++    net::DefineNetworkTrafficAnnotation("browseros_agent_download", R"(
++        semantics {
++          sender: "BrowserOS Agent Download"
++          description:
++            "Downloads a file on behalf of the BrowserOS agent, in the "
++            "context of the tab it is working in."
++          trigger: "The agent calls browserOS.download."
++          data: "The tab's cookies for the URL, as for a user download."
++          destination: WEBSITE
++        }
++        policy {
++          cookies_allowed: YES
++          cookies_store: "user"
++          setting: "Controlled via command-line flags or enterprise policies."
++          policy_exception_justification: "BrowserOS feature."
++        })");
++
++browser_os::DownloadState ToDownloadState(
++    download::DownloadItem::DownloadState state) {
++  switch (state) {
++    case download::DownloadItem::IN_PROGRESS:
++      return browser_os::DownloadState::kInProgress;
++    case download::DownloadItem::COMPLETE:
++      return browser_os::DownloadState::kComplete;
++    case download::DownloadItem::CANCELLED:
++      return browser_os::DownloadState::kCancelled;
++    case download::DownloadItem::INTERRUPTED:
++      return browser_os::DownloadState::kInterrupted;
++    case download::DownloadItem::MAX_DOWNLOAD_STATE:
++      break;
++  }
++  return browser_os::DownloadState::kInterrupted;
++}
++
++}  // namespace
++
++browser_os::DownloadInfo ToDownloadInfo(download::DownloadItem* item) {
++  browser_os::DownloadInfo info;
++  info.download_id = static_cast<int>(item->GetId());
++  info.url = item->GetURL().spec();
++  info.path = item->GetTargetFilePath().AsUTF8Unsafe();
++  info.state = ToDownloadState(item->GetState());
++  info.received_bytes = static_cast<double>(item->GetReceivedBytes());
++  if (item->GetTotalBytes() > 0) {
++    info.total_bytes = static_cast<double>(item->GetTotalBytes());
++  }
++  if (item->GetState() == download::DownloadItem::INTERRUPTED) {
++    info.error = download::DownloadInterruptReasonToString(
++        item->GetLastReason());
++  }
++  return info;
++}
++
++// static
++void BrowserOSDownloadTracker::Start(content::WebContents* web_contents,
++                                     const GURL& url,
++                                     const base::FilePath& path,
++                                     StartedCallback started,
++                                     FinishedCallback finished) {
++  std::unique_ptr<download::DownloadUrlParameters> params =
++      content::DownloadRequestUtils::CreateDownloadForWebContentsMainFrame(
++          web_contents, url, kTrafficAnnotation);
++  // A forced path skips the save dialog and the download directory
++  if (!path.empty()) {
++    params->set_file_path(path);
++  }
++  params->set_prompt(false);
++  params->set_download_source(download::DownloadSource::EXTENSION_API);
++  params->set_callback(base::BindOnce(
++      &BrowserOSDownloadTracker::OnDownloadStarted, std::move(started),
++      std::move(finished)));
++  web_contents->GetBrowserContext()->GetDownloadManager()->DownloadUrl(
++      std::move(params));
++}
++
++// static
++void BrowserOSDownloadTracker::OnDownloadStarted(
++    StartedCallback started,
++    FinishedCallback finished,
++    download::DownloadItem* item,
++    download::DownloadInterruptReason reason) {
++  if (!item || reason != download::DOWNLOAD_INTERRUPT_REASON_NONE) {
++    std::move(started).Run(base::unexpected(
++        base::StrCat({"Download failed to start: ",
++                      download::DownloadInterruptReasonToString(reason)})));
++    return;
++  }
++
++  VLOG(1) << "[browseros] Download " << item->GetId() << " started for "
++          << item->GetURL().spec();
++  std::move(started).Run(ToDownloadInfo(item));
++  // Owns itself until the download is done
++  auto* tracker = new BrowserOSDownloadTracker(item, std::move(finished));
++  if (item->IsDone()) {
++    tracker->Finish(item);
++  }
++}
++
++BrowserOSDownloadTracker::BrowserOSDownloadTracker(
++    download::DownloadItem* item,
++    FinishedCallback finished)
++    : item_(item), finished_(std::move(finished)) {
++  item_->AddObserver(this);
++}
++
++BrowserOSDownloadTracker::~BrowserOSDownloadTracker() {
++  if (item_) {
++    item_->RemoveObserver(this);
++  }
++}
++
++void BrowserOSDownloadTracker::OnDownloadUpdated(
++    download::DownloadItem* item) {
++  // Interrupted downloads that will resume on their own are not done yet
++  if (item->IsDone()) {
++    Finish(item);
++  }
++}
++
++void BrowserOSDownloadTracker::OnDownloadDestroyed(
++    download::DownloadItem* item) {
++  // Removed before it finished, e.g. with its profile
++  item_->RemoveObserver(this);
++  item_ = nullptr;
++  Finish(item);
++}
++
++void BrowserOSDownloadTracker::Finish(download::DownloadItem* item) {
++  browser_os::DownloadInfo info = ToDownloadInfo(item);
++  if (!item->IsDone()) {
++    info.state = browser_os::DownloadState::kCancelled;
++  }
++  VLOG(1) << "[browseros] Download " << info.download_id << " finished: "
++          << browser_os::ToString(info.state);
++
++  content::BrowserContext* browser_context =
++      content::DownloadItemUtils::GetBrowserContext(item);
++  EventRouter* event_router =
++      browser_context ? EventRouter::Get(browser_context) : nullptr;
++  if (event_router && event_router->HasEventListener(
++                          browser_os::OnDownloadComplete::kEventName)) {
++    auto event = std::make_unique<Event>(
++        events::UNKNOWN, browser_os::OnDownloadComplete::kEventName,
++        browser_os::OnDownloadComplete::Create(info), browser_context);
++    event_router->BroadcastEvent(std::move(event));
++  }
++
++  if (finished_) {
++    std::move(finished_).Run(info);
++  }
++  delete this;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,89 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_downloads.h b/chrome/browser/extensions/api/browser_os/browser_os_downloads.h
+new file mode 100644
+index 0000000000000..e2a3f8a85eaa6
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_downloads.h
+@@ -0,0 +1,83 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_DOWNLOADS_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_DOWNLOADS_H_
++
++#include <string>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/raw_ptr.h"
++#include "base/types/expected.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "components/download/public/common/download_interrupt_reasons.h"
++#include "components/download/public/common/download_item.h"
++
++class GURL;
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Downloads a URL for the download function and follows it to the end.
++// The download runs through the profile's DownloadManager like any other,
++// so it shows in the downloads UI and goes through the same safety checks,
++// but without a save dialog. Once it completes, fails or is cancelled,
++// onDownloadComplete is broadcast. Deletes itself when done.
++class BrowserOSDownloadTracker : public download::DownloadItem::Observer {
++ public:
++  // Runs with the download just started, or why it could not start
++  using StartedCallback = base::OnceCallback<void(
++      base::expected<browser_os::DownloadInfo, std::string>)>;
++  // Runs with the download in its final state
++  using FinishedCallback =
++      base::OnceCallback<void(const browser_os::DownloadInfo&)>;
++
++  // Downloads |url| with the cookies and referrer of |web_contents|' main
++  // frame. Saves to |path| if it is set, replacing any file there, or to the
++  // download directory otherwise. |finished| may be null. |started| is not
++  // run if the download manager shuts down before the download starts.
++  static void Start(content::WebContents* web_contents,
++                    const GURL& url,
++                    const base::FilePath& path,
++                    StartedCallback started,
++                    FinishedCallback finished);
++
++  BrowserOSDownloadTracker(const BrowserOSDownloadTracker&) = delete;
++  BrowserOSDownloadTracker& operator=(const BrowserOSDownloadTracker&) =
++      delete;
++
++ private:
++  BrowserOSDownloadTracker(download::DownloadItem* item,
++                           FinishedCallback finished);
++  ~BrowserOSDownloadTracker() override;
++
++  static void OnDownloadStarted(StartedCallback started,
++                                FinishedCallback finished,
++                                download::DownloadItem* item,
++                                download::DownloadInterruptReason reason);
++
++  // download::DownloadItem::Observer:
++  void OnDownloadUpdated(download::DownloadItem* item) override;
++  void OnDownloadDestroyed(download::DownloadItem* item) override;
++
++  // Reports |item|'s final state and deletes this. A download removed
++  // before it finished counts as cancelled.
++  void Finish(download::DownloadItem* item);
++
++  raw_ptr<download::DownloadItem> item_;
++  FinishedCallback finished_;
++};
++
++// The DownloadInfo reported for |item|
++browser_os::DownloadInfo ToDownloadInfo(download::DownloadItem* item);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_DOWNLOADS_H_
@@ -0,0 +1,234 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.cc b/chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.cc
+new file mode 100644
+index 0000000000000..c051cee930aec
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.cc
+@@ -0,0 +1,228 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.h"
++
++#include <algorithm>
++#include <cmath>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/str_cat.h"
++#include "base/strings/utf_string_conversions.h"
++#include "base/task/sequenced_task_runner.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_widget_host.h"
++#include "content/public/browser/render_widget_host_view.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/gfx/geometry/size_conversions.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Caps the stitched bitmap at 64MB (4 bytes per pixel)
++constexpr double kMaxFullPagePixels = 16 * 1024 * 1024;
++
++// Largest dimension every output format can encode (WebP's limit)
++constexpr int kMaxFullPageDimension = 16383;
++
++// Bounds the number of scroll-and-copy round trips on endless pages
++constexpr int kMaxFullPageTiles = 40;
++
++// Reads the scroll position, viewport height and document height
++constexpr char16_t kPageMetricsScript[] =
++    u"[window.scrollX, window.scrollY, window.innerHeight, "
++    u"document.documentElement.scrollHeight]";
++
++// Scrolls the main frame without smooth scrolling and returns the offset the
++// page actually ended up at, which is clamped for the last tile
++std::u16string ScrollToScript(double x, double y) {
++  return base::UTF8ToUTF16(base::StrCat(
++      {"window.scrollTo({left: ", base::NumberToString(x),
++       ", top: ", base::NumberToString(y),
++       ", behavior: 'instant'}); window.scrollY"}));
++}
++
++}  // namespace
++
++BrowserOSFullPageCapture::BrowserOSFullPageCapture(
++    content::WebContents* web_contents,
++    const gfx::Size& tile_size,
++    scoped_refptr<RequestCancellation> cancellation)
++    : web_contents_(web_contents->GetWeakPtr()),
++      tile_size_(tile_size),
++      cancellation_(std::move(cancellation)) {}
++
++BrowserOSFullPageCapture::~BrowserOSFullPageCapture() = default;
++
++void BrowserOSFullPageCapture::Start(DoneCallback callback) {
++  callback_ = std::move(callback);
++
++  content::RenderFrameHost* rfh =
++      web_contents_ ? web_contents_->GetPrimaryMainFrame() : nullptr;
++  if (!rfh) {
++    Finish(false);
++    return;
++  }
++
++  rfh->ExecuteJavaScriptForTests(
++      kPageMetricsScript,
++      base::BindOnce(&BrowserOSFullPageCapture::OnPageMetricsRead,
++                     weak_factory_.GetWeakPtr()),
++      /*honor_js_content_settings=*/false);
++}
++
++void BrowserOSFullPageCapture::OnPageMetricsRead(base::Value result) {
++  if (!result.is_list() || result.GetList().size() != 4) {
++    Finish(false);
++    return;
++  }
++  const base::Value::List& metrics = result.GetList();
++  original_scroll_x_ = metrics[0].GetIfDouble().value_or(0);
++  original_scroll_y_ = metrics[1].GetIfDouble().value_or(0);
++  viewport_height_ = metrics[2].GetIfDouble().value_or(0);
++  document_height_ = metrics[3].GetIfDouble().value_or(0);
++  if (viewport_height_ <= 0 || tile_size_.IsEmpty()) {
++    Finish(false);
++    return;
++  }
++  document_height_ = std::max(document_height_, viewport_height_);
++
++  // Shrink the tiles so the stitched page stays within the bounds
++  const double page_height =
++      tile_size_.height() * document_height_ / viewport_height_;
++  double scale = 1.0;
++  scale = std::min(scale, kMaxFullPageDimension / page_height);
++  scale = std::min(scale, std::sqrt(kMaxFullPagePixels /
++                                    (tile_size_.width() * page_height)));
++  if (scale < 1.0) {
++    tile_size_ = gfx::ScaleToFlooredSize(tile_size_, scale);
++    LOG(INFO) << "[browseros] FullPageCapture: Page too large, capturing "
++              << "tiles at " << tile_size_.ToString();
++  }
++
++  LOG(INFO) << "[browseros] FullPageCapture: Document height "
++            << document_height_ << ", viewport height " << viewport_height_;
++
++  next_scroll_y_ = 0;
++  ScrollToNextTile();
++}
++
++void BrowserOSFullPageCapture::ScrollToNextTile() {
++  content::RenderFrameHost* rfh =
++      web_contents_ ? web_contents_->GetPrimaryMainFrame() : nullptr;
++  if (!rfh || IsRequestCancelled(cancellation_.get())) {
++    Finish(false);
++    return;
++  }
++
++  rfh->ExecuteJavaScriptForTests(
++      ScrollToScript(original_scroll_x_, next_scroll_y_),
++      base::BindOnce(&BrowserOSFullPageCapture::OnTileScrolled,
++                     weak_factory_.GetWeakPtr()),
++      /*honor_js_content_settings=*/false);
++}
++
++void BrowserOSFullPageCapture::OnTileScrolled(base::Value result) {
++  content::RenderFrameHost* rfh =
++      web_contents_ ? web_contents_->GetPrimaryMainFrame() : nullptr;
++  if (!rfh || !result.GetIfDouble()) {
++    Finish(false);
++    return;
++  }
++  tile_scroll_y_ = *result.GetIfDouble();
++
++  // Copy only once a frame with the new scroll offset has been submitted
++  rfh->InsertVisualStateCallback(
++      base::BindOnce(&BrowserOSFullPageCapture::OnTileVisible,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSFullPageCapture::OnTileVisible(bool visible) {
++  content::RenderFrameHost* rfh =
++      web_contents_ ? web_contents_->GetPrimaryMainFrame() : nullptr;
++  content::RenderWidgetHostView* view =
++      rfh ? rfh->GetRenderWidgetHost()->GetView() : nullptr;
++  if (!visible || !view) {
++    Finish(false);
++    return;
++  }
++
++  view->CopyFromSurface(
++      gfx::Rect(), tile_size_,
++      base::BindOnce(&BrowserOSFullPageCapture::OnTileCaptured,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSFullPageCapture::OnTileCaptured(const SkBitmap& tile) {
++  if (tile.empty()) {
++    Finish(false);
++    return;
++  }
++
++  if (bitmap_.isNull()) {
++    output_scale_ = tile.height() / viewport_height_;
++    const int height = std::min(
++        static_cast<int>(std::ceil(document_height_ * output_scale_)),
++        kMaxFullPageDimension);
++    if (!bitmap_.tryAllocPixels(tile.info().makeWH(tile.width(), height))) {
++      LOG(WARNING) << "[browseros] FullPageCapture: Failed to allocate "
++                   << tile.width() << "x" << height << " bitmap";
++      Finish(false);
++      return;
++    }
++    bitmap_.eraseColor(SK_ColorWHITE);
++  }
++
++  // Clips at the bitmap's bottom edge; a clamped last tile overlaps the
++  // previous one
++  bitmap_.writePixels(tile.pixmap(), 0,
++                      static_cast<int>(std::round(tile_scroll_y_ *
++                                                  output_scale_)));
++  tile_count_++;
++
++  next_scroll_y_ = tile_scroll_y_ + viewport_height_;
++  if (next_scroll_y_ >= document_height_ || tile_count_ >= kMaxFullPageTiles) {
++    VLOG(1) << "[browseros] FullPageCapture: Stitched " << tile_count_
++            << " tiles";
++    Finish(true);
++    return;
++  }
++  ScrollToNextTile();
++}
++
++void BrowserOSFullPageCapture::Finish(bool success) {
++  if (tile_count_ > 0 && web_contents_) {
++    if (content::RenderFrameHost* rfh = web_contents_->GetPrimaryMainFrame()) {
++      rfh->ExecuteJavaScriptForTests(
++          ScrollToScript(original_scroll_x_, original_scroll_y_),
++          base::NullCallback(),
++          /*honor_js_content_settings=*/false);
++    }
++  }
++
++  SkBitmap bitmap;
++  if (success) {
++    bitmap_.setImmutable();
++    bitmap = std::move(bitmap_);
++  }
++  // Post so Start() never runs the callback synchronously
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE,
++      base::BindOnce(
++          [](base::WeakPtr<BrowserOSFullPageCapture> self, SkBitmap bitmap) {
++            if (self) {
++              std::move(self->callback_).Run(bitmap);
++            }
++          },
++          weak_factory_.GetWeakPtr(), std::move(bitmap)));
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,95 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.h b/chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.h
+new file mode 100644
+index 0000000000000..84299c5c995e0
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_full_page_capture.h
+@@ -0,0 +1,89 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_FULL_PAGE_CAPTURE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_FULL_PAGE_CAPTURE_H_
++
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/values.h"
++#include "third_party/skia/include/core/SkBitmap.h"
++#include "ui/gfx/geometry/size.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++class RequestCancellation;
++
++// Captures a whole page by scrolling the main frame one viewport at a time
++// and copying each tile from the compositor, so no renderer resize is
++// needed. Tiles are written straight into one output bitmap whose size is
++// bounded: pages that would exceed kMaxFullPagePixels or the largest
++// encodable dimension are captured at a lower scale instead. The original
++// scroll position is restored afterwards.
++class BrowserOSFullPageCapture {
++ public:
++  // |bitmap| is empty on failure, e.g. when the tab went away mid-capture
++  using DoneCallback = base::OnceCallback<void(const SkBitmap& bitmap)>;
++
++  // |tile_size| is the output size of one full viewport tile. Once
++  // |cancellation| (optional) is cancelled no further tile is captured and
++  // the capture fails.
++  BrowserOSFullPageCapture(
++      content::WebContents* web_contents,
++      const gfx::Size& tile_size,
++      scoped_refptr<RequestCancellation> cancellation = nullptr);
++
++  BrowserOSFullPageCapture(const BrowserOSFullPageCapture&) = delete;
++  BrowserOSFullPageCapture& operator=(const BrowserOSFullPageCapture&) =
++      delete;
++
++  ~BrowserOSFullPageCapture();
++
++  // Starts capturing. |callback| is always run asynchronously and never after
++  // this object is destroyed.
++  void Start(DoneCallback callback);
++
++ private:
++  void OnPageMetricsRead(base::Value result);
++  void ScrollToNextTile();
++  void OnTileScrolled(base::Value result);
++  void OnTileVisible(bool visible);
++  void OnTileCaptured(const SkBitmap& tile);
++  // Restores the scroll position and hands |bitmap_| (or an empty bitmap) to
++  // the callback
++  void Finish(bool success);
++
++  base::WeakPtr<content::WebContents> web_contents_;
++  gfx::Size tile_size_;
++  scoped_refptr<RequestCancellation> cancellation_;
++  DoneCallback callback_;
++
++  // Page geometry in CSS pixels, read once before the first tile
++  double original_scroll_x_ = 0;
++  double original_scroll_y_ = 0;
++  double viewport_height_ = 0;
++  double document_height_ = 0;
++
++  // Scroll offset of the tile being captured and the next one to capture
++  double tile_scroll_y_ = 0;
++  double next_scroll_y_ = 0;
++  int tile_count_ = 0;
++
++  // Output pixels per CSS pixel, fixed by the first tile
++  double output_scale_ = 0;
++  SkBitmap bitmap_;
++
++  base::WeakPtrFactory<BrowserOSFullPageCapture> weak_factory_{this};
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_FULL_PAGE_CAPTURE_H_
@@ -0,0 +1,392 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_input_dispatch.cc b/chrome/browser/extensions/api/browser_os/browser_os_input_dispatch.cc
+new file mode 100644
+index 0000000000000..32ae59dc716d1
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_input_dispatch.cc
+@@ -0,0 +1,386 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_input_dispatch.h"
++
++#include <optional>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/strings/string_util.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/trace_event/trace_event.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
++#include "components/input/native_web_keyboard_event.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_widget_host.h"
++#include "content/public/browser/render_widget_host_view.h"
++#include "content/public/browser/web_contents.h"
++#include "third_party/blink/public/common/input/web_input_event.h"
++#include "third_party/blink/public/common/input/web_mouse_event.h"
++#include "third_party/blink/public/common/input/web_mouse_wheel_event.h"
++#include "ui/events/base_event_utils.h"
++#include "ui/events/keycodes/dom/dom_code.h"
++#include "ui/events/keycodes/dom/dom_key.h"
++#include "ui/events/keycodes/keyboard_codes.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++struct KeyDefinition {
++  ui::KeyboardCode windows_key_code = ui::VKEY_UNKNOWN;
++  ui::DomCode dom_code = ui::DomCode::NONE;
++  ui::DomKey dom_key = ui::DomKey::NONE;
++  // Character sent with the key down, if any
++  char16_t text = 0;
++};
++
++// Named keys, then single printable ASCII characters
++std::optional<KeyDefinition> LookupKey(const std::string& key) {
++  // Use if-else chain to avoid static initialization
++  if (key == "Enter") {
++    // Inputs on web pages expect the '\r' char event to trigger submit
++    return KeyDefinition{ui::VKEY_RETURN, ui::DomCode::ENTER,
++                         ui::DomKey::ENTER, u'\r'};
++  } else if (key == "Delete") {
++    return KeyDefinition{ui::VKEY_DELETE, ui::DomCode::DEL, ui::DomKey::DEL};
++  } else if (key == "Backspace") {
++    return KeyDefinition{ui::VKEY_BACK, ui::DomCode::BACKSPACE,
++                         ui::DomKey::BACKSPACE};
++  } else if (key == "Tab") {
++    return KeyDefinition{ui::VKEY_TAB, ui::DomCode::TAB, ui::DomKey::TAB};
++  } else if (key == "Escape") {
++    return KeyDefinition{ui::VKEY_ESCAPE, ui::DomCode::ESCAPE,
++                         ui::DomKey::ESCAPE};
++  } else if (key == "ArrowUp") {
++    return KeyDefinition{ui::VKEY_UP, ui::DomCode::ARROW_UP,
++                         ui::DomKey::ARROW_UP};
++  } else if (key == "ArrowDown") {
++    return KeyDefinition{ui::VKEY_DOWN, ui::DomCode::ARROW_DOWN,
++                         ui::DomKey::ARROW_DOWN};
++  } else if (key == "ArrowLeft") {
++    return KeyDefinition{ui::VKEY_LEFT, ui::DomCode::ARROW_LEFT,
++                         ui::DomKey::ARROW_LEFT};
++  } else if (key == "ArrowRight") {
++    return KeyDefinition{ui::VKEY_RIGHT, ui::DomCode::ARROW_RIGHT,
++                         ui::DomKey::ARROW_RIGHT};
++  } else if (key == "Home") {
++    return KeyDefinition{ui::VKEY_HOME, ui::DomCode::HOME, ui::DomKey::HOME};
++  } else if (key == "End") {
++    return KeyDefinition{ui::VKEY_END, ui::DomCode::END, ui::DomKey::END};
++  } else if (key == "PageUp") {
++    return KeyDefinition{ui::VKEY_PRIOR, ui::DomCode::PAGE_UP,
++                         ui::DomKey::PAGE_UP};
++  } else if (key == "PageDown") {
++    return KeyDefinition{ui::VKEY_NEXT, ui::DomCode::PAGE_DOWN,
++                         ui::DomKey::PAGE_DOWN};
++  }
++
++  if (key.size() != 1 || !base::IsAsciiPrintable(key[0])) {
++    return std::nullopt;
++  }
++  const char c = key[0];
++  KeyDefinition definition;
++  definition.dom_key = ui::DomKey::FromCharacter(c);
++  definition.text = c;
++  if (base::IsAsciiAlpha(c)) {
++    definition.windows_key_code = static_cast<ui::KeyboardCode>(
++        ui::VKEY_A + (base::ToUpperASCII(c) - 'A'));
++  } else if (base::IsAsciiDigit(c)) {
++    definition.windows_key_code =
++        static_cast<ui::KeyboardCode>(ui::VKEY_0 + (c - '0'));
++  } else if (c == ' ') {
++    definition.windows_key_code = ui::VKEY_SPACE;
++    definition.dom_code = ui::DomCode::SPACE;
++  }
++  return definition;
++}
++
++int ButtonModifier(blink::WebPointerProperties::Button button) {
++  switch (button) {
++    case blink::WebPointerProperties::Button::kLeft:
++      return blink::WebInputEvent::kLeftButtonDown;
++    case blink::WebPointerProperties::Button::kMiddle:
++      return blink::WebInputEvent::kMiddleButtonDown;
++    case blink::WebPointerProperties::Button::kRight:
++      return blink::WebInputEvent::kRightButtonDown;
++    default:
++      return 0;
++  }
++}
++
++// The button a move reports while buttons are held, as a real mouse would
++blink::WebPointerProperties::Button HeldButton(int held_buttons) {
++  if (held_buttons & blink::WebInputEvent::kLeftButtonDown) {
++    return blink::WebPointerProperties::Button::kLeft;
++  }
++  if (held_buttons & blink::WebInputEvent::kMiddleButtonDown) {
++    return blink::WebPointerProperties::Button::kMiddle;
++  }
++  if (held_buttons & blink::WebInputEvent::kRightButtonDown) {
++    return blink::WebPointerProperties::Button::kRight;
++  }
++  return blink::WebPointerProperties::Button::kNoButton;
++}
++
++input::NativeWebKeyboardEvent CreateKeyEvent(
++    blink::WebInputEvent::Type type,
++    const KeyDefinition& definition) {
++  input::NativeWebKeyboardEvent event(
++      type, blink::WebInputEvent::kNoModifiers, ui::EventTimeForNow());
++  event.windows_key_code = definition.windows_key_code;
++  event.native_key_code = definition.windows_key_code;
++  event.dom_code = static_cast<int>(definition.dom_code);
++  event.dom_key = static_cast<int>(definition.dom_key);
++  return event;
++}
++
++// Sends one step. |held_buttons| tracks the mouse buttons pressed so far.
++void ForwardStep(content::RenderWidgetHost* rwh,
++                 float scale,
++                 const InputStep& step,
++                 int* held_buttons) {
++  // The step's point is in CSS pixels. Convert CSS → widget DIPs using the
++  // same scale chain as DevTools. Screen position equals widget position to
++  // avoid unit-mixing on HiDPI; the compositor handles DSF.
++  const gfx::PointF widget_point(step.point.x() * scale,
++                                 step.point.y() * scale);
++
++  switch (step.type) {
++    case InputStep::Type::kMouseMove:
++    case InputStep::Type::kMouseDown:
++    case InputStep::Type::kMouseUp: {
++      blink::WebMouseEvent mouse_event;
++      if (step.type == InputStep::Type::kMouseMove) {
++        mouse_event.SetType(blink::WebInputEvent::Type::kMouseMove);
++        mouse_event.button = HeldButton(*held_buttons);
++      } else if (step.type == InputStep::Type::kMouseDown) {
++        mouse_event.SetType(blink::WebInputEvent::Type::kMouseDown);
++        mouse_event.button = step.button;
++        mouse_event.click_count = step.click_count;
++        *held_buttons |= ButtonModifier(step.button);
++      } else {
++        mouse_event.SetType(blink::WebInputEvent::Type::kMouseUp);
++        mouse_event.button = step.button;
++        mouse_event.click_count = step.click_count;
++        *held_buttons &= ~ButtonModifier(step.button);
++      }
++      mouse_event.SetPositionInWidget(widget_point.x(), widget_point.y());
++      mouse_event.SetPositionInScreen(widget_point.x(), widget_point.y());
++      mouse_event.SetTimeStamp(ui::EventTimeForNow());
++      mouse_event.SetModifiers(*held_buttons);
++      rwh->ForwardMouseEvent(mouse_event);
++      return;
++    }
++    case InputStep::Type::kWheel: {
++      blink::WebMouseWheelEvent wheel_event;
++      wheel_event.SetType(blink::WebInputEvent::Type::kMouseWheel);
++      wheel_event.SetPositionInWidget(widget_point.x(), widget_point.y());
++      wheel_event.SetPositionInScreen(widget_point.x(), widget_point.y());
++      wheel_event.SetTimeStamp(ui::EventTimeForNow());
++      wheel_event.SetModifiers(*held_buttons);
++      wheel_event.delta_x = step.wheel_delta.x();
++      wheel_event.delta_y = step.wheel_delta.y();
++      // 120 = one notch
++      wheel_event.wheel_ticks_x = step.wheel_delta.x() / 120.0f;
++      wheel_event.wheel_ticks_y = step.wheel_delta.y() / 120.0f;
++      wheel_event.phase = blink::WebMouseWheelEvent::kPhaseBegan;
++      // Precise scrolling for touchpad (pixels), non-precise for mouse wheel
++      // (lines)
++      wheel_event.delta_units =
++          step.precise ? ui::ScrollGranularity::kScrollByPrecisePixel
++                       : ui::ScrollGranularity::kScrollByLine;
++      rwh->ForwardWheelEvent(wheel_event);
++
++      // Phase ended event for smooth scrolling
++      wheel_event.phase = blink::WebMouseWheelEvent::kPhaseEnded;
++      wheel_event.delta_x = 0;
++      wheel_event.delta_y = 0;
++      wheel_event.wheel_ticks_x = 0;
++      wheel_event.wheel_ticks_y = 0;
++      rwh->ForwardWheelEvent(wheel_event);
++      return;
++    }
++    case InputStep::Type::kKeyDown:
++    case InputStep::Type::kKeyUp: {
++      std::optional<KeyDefinition> definition = LookupKey(step.key);
++      if (!definition) {
++        return;  // Unsupported key
++      }
++      if (step.type == InputStep::Type::kKeyUp) {
++        rwh->ForwardKeyboardEvent(
++            CreateKeyEvent(blink::WebInputEvent::Type::kKeyUp, *definition));
++        return;
++      }
++      rwh->ForwardKeyboardEvent(
++          CreateKeyEvent(blink::WebInputEvent::Type::kKeyDown, *definition));
++      if (definition->text) {
++        input::NativeWebKeyboardEvent char_event =
++            CreateKeyEvent(blink::WebInputEvent::Type::kChar, *definition);
++        char_event.text[0] = definition->text;
++        char_event.unmodified_text[0] = definition->text;
++        rwh->ForwardKeyboardEvent(char_event);
++      }
++      return;
++    }
++  }
++}
++
++// Forwards steps [|begin|, |end|) of |steps|. Returns false without sending
++// anything if the tab has no widget.
++bool ForwardStepRange(content::WebContents* web_contents,
++                      const std::vector<InputStep>& steps,
++                      size_t begin,
++                      size_t end,
++                      int* held_buttons) {
++  TRACE_EVENT("browser", "BrowserOS::DispatchInput", "steps", end - begin);
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    return false;
++  }
++  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
++  if (!rwh || !rwh->GetView()) {
++    return false;
++  }
++
++  // Read once per batch: zoom cannot change between steps of one task
++  const float scale = CssToWidgetScale(web_contents, rwh);
++  for (size_t i = begin; i < end; ++i) {
++    ForwardStep(rwh, scale, steps[i], held_buttons);
++  }
++  return true;
++}
++
++// Sends the steps from |next| up to the next delayed one, then schedules
++// the rest
++void DispatchFrom(base::WeakPtr<content::WebContents> web_contents,
++                  std::vector<InputStep> steps,
++                  size_t next,
++                  int held_buttons,
++                  base::OnceCallback<void(bool)> callback) {
++  if (!web_contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++
++  size_t end = next + 1;
++  while (end < steps.size() && steps[end].delay.is_zero()) {
++    ++end;
++  }
++  if (!ForwardStepRange(web_contents.get(), steps, next, end,
++                        &held_buttons)) {
++    std::move(callback).Run(false);
++    return;
++  }
++  if (end == steps.size()) {
++    std::move(callback).Run(true);
++    return;
++  }
++
++  const base::TimeDelta delay = steps[end].delay;
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&DispatchFrom, std::move(web_contents), std::move(steps),
++                     end, held_buttons, std::move(callback)),
++      delay);
++}
++
++}  // namespace
++
++// static
++InputStep InputStep::MouseMove(const gfx::PointF& point) {
++  InputStep step;
++  step.type = Type::kMouseMove;
++  step.point = point;
++  return step;
++}
++
++// static
++InputStep InputStep::MouseDown(const gfx::PointF& point,
++                               blink::WebPointerProperties::Button button,
++                               int click_count) {
++  InputStep step;
++  step.type = Type::kMouseDown;
++  step.point = point;
++  step.button = button;
++  step.click_count = click_count;
++  return step;
++}
++
++// static
++InputStep InputStep::MouseUp(const gfx::PointF& point,
++                             blink::WebPointerProperties::Button button,
++                             int click_count) {
++  InputStep step = MouseDown(point, button, click_count);
++  step.type = Type::kMouseUp;
++  return step;
++}
++
++// static
++InputStep InputStep::Wheel(const gfx::PointF& point,
++                           const gfx::Vector2dF& delta,
++                           bool precise) {
++  InputStep step;
++  step.type = Type::kWheel;
++  step.point = point;
++  step.wheel_delta = delta;
++  step.precise = precise;
++  return step;
++}
++
++// static
++InputStep InputStep::KeyDown(const std::string& key) {
++  InputStep step;
++  step.type = Type::kKeyDown;
++  step.key = key;
++  return step;
++}
++
++// static
++InputStep InputStep::KeyUp(const std::string& key) {
++  InputStep step = KeyDown(key);
++  step.type = Type::kKeyUp;
++  return step;
++}
++
++InputStep::InputStep() = default;
++InputStep::InputStep(const InputStep&) = default;
++InputStep::InputStep(InputStep&&) = default;
++InputStep& InputStep::operator=(const InputStep&) = default;
++InputStep& InputStep::operator=(InputStep&&) = default;
++InputStep::~InputStep() = default;
++
++bool IsSupportedInputKey(const std::string& key) {
++  return LookupKey(key).has_value();
++}
++
++bool ForwardInputSteps(content::WebContents* web_contents,
++                       const std::vector<InputStep>& steps) {
++  int held_buttons = 0;
++  return ForwardStepRange(web_contents, steps, 0, steps.size(),
++                          &held_buttons);
++}
++
++void DispatchInputSteps(base::WeakPtr<content::WebContents> web_contents,
++                        std::vector<InputStep> steps,
++                        base::OnceCallback<void(bool)> callback) {
++  if (steps.empty()) {
++    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++        FROM_HERE, base::BindOnce(std::move(callback), true));
++    return;
++  }
++
++  // A delay on the first step applies too
++  const base::TimeDelta delay = steps.front().delay;
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&DispatchFrom, std::move(web_contents), std::move(steps),
++                     0, /*held_buttons=*/0, std::move(callback)),
++      delay);
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,104 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_input_dispatch.h b/chrome/browser/extensions/api/browser_os/browser_os_input_dispatch.h
+new file mode 100644
+index 0000000000000..e776a21cd9a28
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_input_dispatch.h
+@@ -0,0 +1,98 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_INPUT_DISPATCH_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_INPUT_DISPATCH_H_
++
++#include <string>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "third_party/blink/public/common/input/web_pointer_properties.h"
++#include "ui/gfx/geometry/point_f.h"
++#include "ui/gfx/geometry/vector2d_f.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// One synthetic input event. Every mouse, wheel and key event browserOS
++// sends is described this way and forwarded by ForwardInputSteps.
++struct InputStep {
++  enum class Type {
++    kMouseMove,
++    kMouseDown,
++    kMouseUp,
++    // A wheel tick followed by its phase-ended event
++    kWheel,
++    // Also sends the key's character, if it has one
++    kKeyDown,
++    kKeyUp,
++  };
++
++  static InputStep MouseMove(const gfx::PointF& point);
++  static InputStep MouseDown(
++      const gfx::PointF& point,
++      blink::WebPointerProperties::Button button =
++          blink::WebPointerProperties::Button::kLeft,
++      int click_count = 1);
++  static InputStep MouseUp(
++      const gfx::PointF& point,
++      blink::WebPointerProperties::Button button =
++          blink::WebPointerProperties::Button::kLeft,
++      int click_count = 1);
++  static InputStep Wheel(const gfx::PointF& point,
++                         const gfx::Vector2dF& delta,
++                         bool precise);
++  static InputStep KeyDown(const std::string& key);
++  static InputStep KeyUp(const std::string& key);
++
++  InputStep();
++  InputStep(const InputStep&);
++  InputStep(InputStep&&);
++  InputStep& operator=(const InputStep&);
++  InputStep& operator=(InputStep&&);
++  ~InputStep();
++
++  Type type = Type::kMouseMove;
++  // CSS pixels from the viewport origin (mouse and wheel steps)
++  gfx::PointF point;
++  blink::WebPointerProperties::Button button =
++      blink::WebPointerProperties::Button::kLeft;
++  int click_count = 1;
++  gfx::Vector2dF wheel_delta;
++  // Wheel deltas are pixels rather than lines
++  bool precise = false;
++  // Named key such as "Enter", or a single character (key steps)
++  std::string key;
++  // Wait before this step, only honored by DispatchInputSteps
++  base::TimeDelta delay;
++};
++
++// Whether |key| can be sent by a key step
++bool IsSupportedInputKey(const std::string& key);
++
++// Forwards |steps| to |web_contents|' main frame widget right away, in
++// order, ignoring their delays. Held mouse buttons carry over from one
++// mouse step to the next, so a move after a down is a drag. Returns false
++// if the tab has no widget to send to.
++bool ForwardInputSteps(content::WebContents* web_contents,
++                       const std::vector<InputStep>& steps);
++
++// Forwards |steps|, honoring their delays: steps up to the next delay go
++// out together in one task. |callback| runs with false if the tab went
++// away or lost its widget before every step was sent.
++void DispatchInputSteps(base::WeakPtr<content::WebContents> web_contents,
++                        std::vector<InputStep> steps,
++                        base::OnceCallback<void(bool)> callback);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_INPUT_DISPATCH_H_
@@ -0,0 +1,197 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_input_files.cc b/chrome/browser/extensions/api/browser_os/browser_os_input_files.cc
+new file mode 100644
+index 0000000000000..940c7505d80b3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_input_files.cc
+@@ -0,0 +1,191 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_input_files.h"
++
++#include <utility>
++
++#include "base/containers/span.h"
++#include "base/functional/bind.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/str_cat.h"
++#include "base/task/sequenced_task_runner.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_helpers.h"
++#include "content/public/browser/devtools_agent_host.h"
++#include "content/public/browser/web_contents.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Both commands run in the renderer, so a busy page holds them up
++constexpr base::TimeDelta kSetInputFilesTimeout = base::Seconds(10);
++
++// Finds the file input of a PageHelperTarget. Upload buttons are often a
++// styled label or wrapper around a hidden input, so the input inside or
++// labelled by the element will do, and failing that the page's only one.
++constexpr char kFindFileInputScript[] = R"JS(
++((target) => {
++  const isFileInput = (element) =>
++      element && element.tagName === 'INPUT' && element.type === 'file';
++  let element = target.id ? document.getElementById(target.id) : null;
++  if (!element && target.tag && target.classes.length > 0) {
++    try {
++      element = document.querySelector(target.tag +
++          target.classes.map((name) => '.' + CSS.escape(name)).join(''));
++    } catch (e) {
++      // Not a valid selector
++    }
++  }
++  if (isFileInput(element)) {
++    return element;
++  }
++  const inner = element &&
++      (element.control || element.querySelector('input[type=file]'));
++  if (isFileInput(inner)) {
++    return inner;
++  }
++  const inputs = document.querySelectorAll('input[type=file]');
++  return inputs.length === 1 ? inputs[0] : null;
++})
++)JS";
++
++}  // namespace
++
++// static
++void BrowserOSInputFilesSetter::Set(content::WebContents* web_contents,
++                                    const NodeInfo& node_info,
++                                    std::vector<base::FilePath> paths,
++                                    DoneCallback callback) {
++  // Owns itself until Finish()
++  auto* setter = new BrowserOSInputFilesSetter(std::move(paths),
++                                               std::move(callback));
++  setter->Start(web_contents, node_info);
++}
++
++BrowserOSInputFilesSetter::BrowserOSInputFilesSetter(
++    std::vector<base::FilePath> paths,
++    DoneCallback callback)
++    : paths_(std::move(paths)), callback_(std::move(callback)) {}
++
++BrowserOSInputFilesSetter::~BrowserOSInputFilesSetter() = default;
++
++void BrowserOSInputFilesSetter::Start(content::WebContents* web_contents,
++                                      const NodeInfo& node_info) {
++  agent_host_ = content::DevToolsAgentHost::GetOrCreateForTab(web_contents);
++  if (!agent_host_ || !agent_host_->AttachClient(this)) {
++    agent_host_ = nullptr;
++    Finish("Could not attach to the tab");
++    return;
++  }
++  timeout_timer_.Start(
++      FROM_HERE, kSetInputFilesTimeout,
++      base::BindOnce(&BrowserOSInputFilesSetter::Finish,
++                     base::Unretained(this),
++                     std::optional<std::string>("Timed out setting files")));
++
++  // JSON is a valid JavaScript expression, so the target needs no escaping
++  base::Value::List args;
++  args.Append(PageHelperTarget(node_info, /*tag_fallback=*/false));
++  std::string args_json = base::WriteJson(args).value_or("[]");
++  SendCommand("Runtime.evaluate",
++              base::Value::Dict()
++                  .Set("expression", base::StrCat({kFindFileInputScript, "(...",
++                                                   args_json, ")"}))
++                  .Set("returnByValue", false));
++}
++
++void BrowserOSInputFilesSetter::SendCommand(const char* method,
++                                            base::Value::Dict params) {
++  pending_command_id_ = next_command_id_++;
++  std::string message =
++      base::WriteJson(base::Value::Dict()
++                          .Set("id", pending_command_id_)
++                          .Set("method", method)
++                          .Set("params", std::move(params)))
++          .value_or("{}");
++  agent_host_->DispatchProtocolMessage(this, base::as_byte_span(message));
++}
++
++void BrowserOSInputFilesSetter::DispatchProtocolMessage(
++    content::DevToolsAgentHost* agent_host,
++    base::span<const uint8_t> message) {
++  // Handled in a task of its own, as Finish() detaches from the host
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(&BrowserOSInputFilesSetter::OnMessage,
++                                weak_factory_.GetWeakPtr(),
++                                std::string(base::as_string_view(message))));
++}
++
++void BrowserOSInputFilesSetter::AgentHostClosed(
++    content::DevToolsAgentHost* agent_host) {
++  // Already detached; finish outside the host's own notification
++  agent_host_ = nullptr;
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(&BrowserOSInputFilesSetter::Finish,
++                                weak_factory_.GetWeakPtr(),
++                                std::optional<std::string>("Tab was closed")));
++}
++
++void BrowserOSInputFilesSetter::OnMessage(std::string message) {
++  std::optional<base::Value::Dict> reply = base::JSONReader::ReadDict(message);
++  // Events, and replies to commands of other clients, are not ours
++  if (!reply || reply->FindInt("id") != pending_command_id_) {
++    return;
++  }
++
++  if (const base::Value::Dict* error = reply->FindDict("error")) {
++    const std::string* error_message = error->FindString("message");
++    Finish(error_message ? *error_message : "DevTools command failed");
++    return;
++  }
++  const base::Value::Dict* result = reply->FindDict("result");
++  if (!result) {
++    Finish("DevTools command failed");
++    return;
++  }
++
++  if (!setting_files_) {
++    OnElementFound(*result);
++    return;
++  }
++  VLOG(1) << "[browseros] Set " << paths_.size() << " files on file input";
++  Finish(std::nullopt);
++}
++
++void BrowserOSInputFilesSetter::OnElementFound(
++    const base::Value::Dict& result) {
++  const std::string* object_id =
++      result.FindStringByDottedPath("result.objectId");
++  if (result.Find("exceptionDetails") || !object_id) {
++    Finish("No file input found for this node");
++    return;
++  }
++
++  base::Value::List files;
++  for (const base::FilePath& path : paths_) {
++    files.Append(path.AsUTF8Unsafe());
++  }
++  setting_files_ = true;
++  SendCommand("DOM.setFileInputFiles", base::Value::Dict()
++                                           .Set("files", std::move(files))
++                                           .Set("objectId", *object_id));
++}
++
++void BrowserOSInputFilesSetter::Finish(std::optional<std::string> error) {
++  if (agent_host_) {
++    agent_host_->DetachClient(this);
++    agent_host_ = nullptr;
++  }
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(std::move(callback_), std::move(error)));
++  delete this;
++}
++
++}  // namespace api
++}  // namespace extensions
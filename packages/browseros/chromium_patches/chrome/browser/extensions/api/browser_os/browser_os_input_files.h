@@ -0,0 +1,93 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_input_files.h b/chrome/browser/extensions/api/browser_os/browser_os_input_files.h
+new file mode 100644
+index 0000000000000..b8724f438879d
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_input_files.h
+@@ -0,0 +1,87 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_INPUT_FILES_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_INPUT_FILES_H_
++
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
++#include "content/public/browser/devtools_agent_host_client.h"
++
++namespace content {
++class DevToolsAgentHost;
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++
++// Sets the files of an <input type=file> without opening the file chooser,
++// for setInputFiles. The page sees the same input and change events as for
++// files picked in the chooser. This goes through a DevTools session on the
++// tab (DOM.setFileInputFiles), which grants the renderer read access to the
++// files the way the chooser does. Deletes itself when done.
++class BrowserOSInputFilesSetter : public content::DevToolsAgentHostClient {
++ public:
++  // |error| is std::nullopt once the files are set
++  using DoneCallback =
++      base::OnceCallback<void(std::optional<std::string> error)>;
++
++  // Sets |paths|, which must be existing files, on the file input of
++  // |node_info| in |web_contents|' main frame. |callback| is always posted.
++  static void Set(content::WebContents* web_contents,
++                  const NodeInfo& node_info,
++                  std::vector<base::FilePath> paths,
++                  DoneCallback callback);
++
++  BrowserOSInputFilesSetter(const BrowserOSInputFilesSetter&) = delete;
++  BrowserOSInputFilesSetter& operator=(const BrowserOSInputFilesSetter&) =
++      delete;
++
++ private:
++  BrowserOSInputFilesSetter(std::vector<base::FilePath> paths,
++                            DoneCallback callback);
++  ~BrowserOSInputFilesSetter() override;
++
++  void Start(content::WebContents* web_contents, const NodeInfo& node_info);
++  void SendCommand(const char* method, base::Value::Dict params);
++  void OnMessage(std::string message);
++  void OnElementFound(const base::Value::Dict& result);
++
++  // Detaches, posts the callback and deletes this
++  void Finish(std::optional<std::string> error);
++
++  // content::DevToolsAgentHostClient:
++  void DispatchProtocolMessage(content::DevToolsAgentHost* agent_host,
++                               base::span<const uint8_t> message) override;
++  void AgentHostClosed(content::DevToolsAgentHost* agent_host) override;
++
++  std::vector<base::FilePath> paths_;
++  DoneCallback callback_;
++  scoped_refptr<content::DevToolsAgentHost> agent_host_;
++  // Id of the command awaiting its reply
++  int pending_command_id_ = 0;
++  int next_command_id_ = 1;
++  // The element was found and DOM.setFileInputFiles sent
++  bool setting_files_ = false;
++  // Gives up on a renderer that doesn't answer
++  base::OneShotTimer timeout_timer_;
++
++  base::WeakPtrFactory<BrowserOSInputFilesSetter> weak_factory_{this};
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_INPUT_FILES_H_
@@ -0,0 +1,233 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_interaction_perf_browsertest.cc b/chrome/browser/extensions/api/browser_os/browser_os_interaction_perf_browsertest.cc
+new file mode 100644
+index 0000000000000..4747b42c1384c
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_interaction_perf_browsertest.cc
+@@ -0,0 +1,227 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++// Step latencies of an agent's snapshot, click, type, snapshot sequence
++// through the browserOS API.
++//
++// The pages under chrome/test/data/browseros/perf are saved copies of common
++// page types with their scripts reduced to what the steps trigger. They are
++// served by the embedded test server, so every run replays the same bytes
++// without touching the network. Each story runs the sequence kIterations
++// times on a freshly loaded page and reports the p50 and p95 of every step.
++// For click and type it also reports how much of the step was spent waiting
++// in BrowserOSChangeDetector and how much was the work around it.
++
++#include <algorithm>
++#include <optional>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/strings/stringprintf.h"
++#include "base/time/time.h"
++#include "base/timer/elapsed_timer.h"
++#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "chrome/browser/ui/browser.h"
++#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "chrome/test/base/in_process_browser_test.h"
++#include "chrome/test/base/ui_test_utils.h"
++#include "content/public/test/browser_test.h"
++#include "extensions/browser/api_test_utils.h"
++#include "extensions/common/extension_builder.h"
++#include "net/test/embedded_test_server/embedded_test_server.h"
++#include "testing/perf/perf_result_reporter.h"
++
++namespace extensions {
++namespace api {
++namespace {
++
++constexpr char kMetricPrefix[] = "BrowserOSInteraction.";
++constexpr char kSnapshotBefore[] = "snapshot_before";
++constexpr char kClick[] = "click";
++constexpr char kType[] = "type";
++constexpr char kSnapshotAfter[] = "snapshot_after";
++
++constexpr int kIterations = 10;
++
++struct Story {
++  const char* name;
++  const char* path;
++  // Accessible name of the clickable node to click
++  const char* click_target;
++  // Accessible name of the typeable node to type into
++  const char* type_target;
++  const char* text;
++};
++
++constexpr Story kSearchStory = {"search", "/browseros/perf/search.html",
++                                "Filters", "Search query", "weather"};
++constexpr Story kLoginStory = {"login", "/browseros/perf/login.html",
++                               "Use a passkey", "Email", "user@example.com"};
++constexpr Story kTodoStory = {"todo", "/browseros/perf/todo.html",
++                              "Show completed", "New task", "Task 1"};
++
++// Samples of one step across the iterations of a story
++struct StepSamples {
++  std::vector<base::TimeDelta> total;
++  std::vector<base::TimeDelta> waiting;
++};
++
++// Nearest-rank percentile of |samples|
++base::TimeDelta Percentile(std::vector<base::TimeDelta> samples,
++                           double fraction) {
++  std::sort(samples.begin(), samples.end());
++  const size_t rank = static_cast<size_t>(samples.size() * fraction);
++  return samples[std::min(rank, samples.size() - 1)];
++}
++
++// nodeId of the first element of |snapshot| of |type| named |name|
++std::optional<int> FindNode(const base::Value& snapshot,
++                            const std::string& type,
++                            const std::string& name) {
++  if (!snapshot.is_dict()) {
++    return std::nullopt;
++  }
++  const base::Value::List* elements =
++      snapshot.GetDict().FindList("elements");
++  if (!elements) {
++    return std::nullopt;
++  }
++  for (const base::Value& element : *elements) {
++    const base::Value::Dict& node = element.GetDict();
++    const std::string* node_type = node.FindString("type");
++    const std::string* node_name = node.FindString("name");
++    if (node_type && *node_type == type && node_name && *node_name == name) {
++      return node.FindInt("nodeId");
++    }
++  }
++  return std::nullopt;
++}
++
++class BrowserOSInteractionPerfTest : public InProcessBrowserTest {
++ protected:
++  void SetUpOnMainThread() override {
++    InProcessBrowserTest::SetUpOnMainThread();
++    ASSERT_TRUE(embedded_test_server()->Start());
++    extension_ = ExtensionBuilder("BrowserOS interaction perf").Build();
++    BrowserOSChangeDetector::SetWaitObserverForTesting(base::BindRepeating(
++        &BrowserOSInteractionPerfTest::OnDetectionWait,
++        base::Unretained(this)));
++  }
++
++  void TearDownOnMainThread() override {
++    BrowserOSChangeDetector::SetWaitObserverForTesting(base::NullCallback());
++    InProcessBrowserTest::TearDownOnMainThread();
++  }
++
++  void RunStory(const Story& story) {
++    StepSamples snapshot_before;
++    StepSamples click;
++    StepSamples type;
++    StepSamples snapshot_after;
++
++    for (int i = 0; i < kIterations; ++i) {
++      ASSERT_TRUE(ui_test_utils::NavigateToURL(
++          browser(), embedded_test_server()->GetURL(story.path)));
++      const int tab_id = ExtensionTabUtil::GetTabId(
++          browser()->tab_strip_model()->GetActiveWebContents());
++
++      base::Value snapshot = RunStep(
++          base::MakeRefCounted<BrowserOSGetInteractiveSnapshotFunction>(),
++          base::StringPrintf("[%d]", tab_id), snapshot_before);
++      std::optional<int> click_node =
++          FindNode(snapshot, "clickable", story.click_target);
++      std::optional<int> type_node =
++          FindNode(snapshot, "typeable", story.type_target);
++      ASSERT_TRUE(click_node) << story.click_target;
++      ASSERT_TRUE(type_node) << story.type_target;
++
++      RunStep(base::MakeRefCounted<BrowserOSClickFunction>(),
++              base::StringPrintf("[%d, %d]", tab_id, *click_node), click);
++      RunStep(base::MakeRefCounted<BrowserOSInputTextFunction>(),
++              base::StringPrintf("[%d, %d, \"%s\"]", tab_id, *type_node,
++                                 story.text),
++              type);
++      RunStep(base::MakeRefCounted<BrowserOSGetInteractiveSnapshotFunction>(),
++              base::StringPrintf("[%d]", tab_id), snapshot_after);
++    }
++
++    perf_test::PerfResultReporter reporter(kMetricPrefix, story.name);
++    Report(reporter, kSnapshotBefore, snapshot_before,
++           /*report_waiting=*/false);
++    Report(reporter, kClick, click, /*report_waiting=*/true);
++    Report(reporter, kType, type, /*report_waiting=*/true);
++    Report(reporter, kSnapshotAfter, snapshot_after, /*report_waiting=*/false);
++  }
++
++ private:
++  // Runs |function| with |args| and adds its timings to |samples|
++  base::Value RunStep(scoped_refptr<ExtensionFunction> function,
++                      const std::string& args,
++                      StepSamples& samples) {
++    function->set_extension(extension_);
++    detection_wait_ = base::TimeDelta();
++    base::ElapsedTimer timer;
++    std::optional<base::Value> result =
++        api_test_utils::RunFunctionAndReturnSingleResult(
++            function.get(), args, browser()->profile());
++    samples.total.push_back(timer.Elapsed());
++    samples.waiting.push_back(detection_wait_);
++    EXPECT_TRUE(result) << function->name();
++    return result ? std::move(*result) : base::Value();
++  }
++
++  void Report(perf_test::PerfResultReporter& reporter,
++              const std::string& step,
++              const StepSamples& samples,
++              bool report_waiting) {
++    const std::string p50 = step + "_p50";
++    const std::string p95 = step + "_p95";
++    reporter.RegisterImportantMetric(p50, "ms");
++    reporter.RegisterImportantMetric(p95, "ms");
++    reporter.AddResult(p50, Percentile(samples.total, 0.5));
++    reporter.AddResult(p95, Percentile(samples.total, 0.95));
++    if (!report_waiting) {
++      return;
++    }
++
++    std::vector<base::TimeDelta> work;
++    for (size_t i = 0; i < samples.total.size(); ++i) {
++      work.push_back(samples.total[i] - samples.waiting[i]);
++    }
++    const std::string wait = step + "_detection_wait_p50";
++    const std::string work_p50 = step + "_work_p50";
++    reporter.RegisterImportantMetric(wait, "ms");
++    reporter.RegisterImportantMetric(work_p50, "ms");
++    reporter.AddResult(wait, Percentile(samples.waiting, 0.5));
++    reporter.AddResult(work_p50, Percentile(std::move(work), 0.5));
++  }
++
++  // Detections of a step run one after another, so their waits add up
++  void OnDetectionWait(base::TimeDelta wait) { detection_wait_ += wait; }
++
++  scoped_refptr<const Extension> extension_;
++  base::TimeDelta detection_wait_;
++};
++
++IN_PROC_BROWSER_TEST_F(BrowserOSInteractionPerfTest, Search) {
++  RunStory(kSearchStory);
++}
++
++IN_PROC_BROWSER_TEST_F(BrowserOSInteractionPerfTest, Login) {
++  RunStory(kLoginStory);
++}
++
++IN_PROC_BROWSER_TEST_F(BrowserOSInteractionPerfTest, Todo) {
++  RunStory(kTodoStory);
++}
++
++}  // namespace
++}  // namespace api
++}  // namespace extensions
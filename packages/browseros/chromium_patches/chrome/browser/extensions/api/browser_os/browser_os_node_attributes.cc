@@ -0,0 +1,151 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.cc
+new file mode 100644
+index 0000000000000..b3c12534abbfe
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.cc
+@@ -0,0 +1,145 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++
++#include "base/no_destructor.h"
++#include "base/notreached.h"
++#include "base/strings/string_number_conversions.h"
++#include "ui/accessibility/ax_enum_util.h"
++
++namespace extensions {
++namespace api {
++
++const char* NodeAttributeName(NodeAttribute attribute) {
++  switch (attribute) {
++    case NodeAttribute::kValue:
++      return "value";
++    case NodeAttribute::kHtmlTag:
++      return "html-tag";
++    case NodeAttribute::kRoleDescription:
++      return "role-description";
++    case NodeAttribute::kInputType:
++      return "input-type";
++    case NodeAttribute::kTooltip:
++      return "tooltip";
++    case NodeAttribute::kPlaceholder:
++      return "placeholder";
++    case NodeAttribute::kDescription:
++      return "description";
++    case NodeAttribute::kCheckedState:
++      return "checked-state";
++    case NodeAttribute::kAutocomplete:
++      return "autocomplete";
++    case NodeAttribute::kId:
++      return "id";
++    case NodeAttribute::kClass:
++      return "class";
++    case NodeAttribute::kContext:
++      return "context";
++    case NodeAttribute::kPath:
++      return "path";
++  }
++  NOTREACHED();
++}
++
++namespace {
++
++constexpr char kRoleKey[] = "role";
++constexpr char kDepthKey[] = "depth";
++constexpr char kInViewportKey[] = "in_viewport";
++
++}  // namespace
++
++// static
++NodeAttributeMask NodeAttributeMask::All() {
++  return NodeAttributeMask();
++}
++
++// static
++NodeAttributeMask NodeAttributeMask::FromNames(
++    const std::vector<std::string>& names) {
++  NodeAttributeMask mask;
++  mask.string_attributes.Clear();
++  mask.role = mask.depth = mask.in_viewport = false;
++  for (const std::string& name : names) {
++    if (name == kRoleKey) {
++      mask.role = true;
++    } else if (name == kDepthKey) {
++      mask.depth = true;
++    } else if (name == kInViewportKey) {
++      mask.in_viewport = true;
++    } else {
++      for (NodeAttribute attribute : StringAttributes::All()) {
++        if (name == NodeAttributeName(attribute)) {
++          mask.string_attributes.Put(attribute);
++        }
++      }
++    }
++  }
++  return mask;
++}
++
++uint64_t NodeAttributeMask::ToBitmask() const {
++  return string_attributes.ToEnumBitmask() << 3 | role << 2 | depth << 1 |
++         in_viewport;
++}
++
++NodeAttributes::NodeAttributes() = default;
++NodeAttributes::NodeAttributes(const NodeAttributes&) = default;
++NodeAttributes::NodeAttributes(NodeAttributes&&) = default;
++NodeAttributes& NodeAttributes::operator=(const NodeAttributes&) = default;
++NodeAttributes& NodeAttributes::operator=(NodeAttributes&&) = default;
++NodeAttributes::~NodeAttributes() = default;
++
++void NodeAttributes::Set(NodeAttribute attribute, std::string value) {
++  for (auto& [key, existing] : string_attributes) {
++    if (key == attribute) {
++      existing = std::move(value);
++      return;
++    }
++  }
++  string_attributes.emplace_back(attribute, std::move(value));
++}
++
++const std::string& NodeAttributes::Get(NodeAttribute attribute) const {
++  for (const auto& [key, value] : string_attributes) {
++    if (key == attribute) {
++      return value;
++    }
++  }
++  static const base::NoDestructor<std::string> kEmpty;
++  return *kEmpty;
++}
++
++bool NodeAttributes::Has(NodeAttribute attribute) const {
++  for (const auto& [key, value] : string_attributes) {
++    if (key == attribute) {
++      return true;
++    }
++  }
++  return false;
++}
++
++base::Value::Dict NodeAttributes::ToDict(const NodeAttributeMask& mask) const {
++  base::Value::Dict dict;
++  if (mask.role) {
++    dict.Set(kRoleKey, ui::ToString(role));
++  }
++  for (const auto& [key, value] : string_attributes) {
++    if (mask.Has(key)) {
++      dict.Set(NodeAttributeName(key), value);
++    }
++  }
++  if (mask.depth) {
++    dict.Set(kDepthKey, base::NumberToString(depth));
++  }
++  if (mask.in_viewport) {
++    dict.Set(kInViewportKey, in_viewport ? "true" : "false");
++  }
++  return dict;
++}
++
++}  // namespace api
++}  // namespace extensions
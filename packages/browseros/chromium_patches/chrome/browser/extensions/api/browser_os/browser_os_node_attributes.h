@@ -0,0 +1,110 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h
+new file mode 100644
+index 0000000000000..9703c11e9e0ed
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h
+@@ -0,0 +1,104 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_ATTRIBUTES_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_ATTRIBUTES_H_
++
++#include <cstdint>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/containers/enum_set.h"
++#include "base/values.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++
++namespace extensions {
++namespace api {
++
++// String attributes computed for a snapshot node. Each one is emitted under
++// the key returned by NodeAttributeName().
++enum class NodeAttribute : uint8_t {
++  kValue,
++  kHtmlTag,
++  kRoleDescription,
++  kInputType,
++  kTooltip,
++  kPlaceholder,
++  kDescription,
++  kCheckedState,
++  kAutocomplete,
++  kId,
++  kClass,
++  kContext,
++  kPath,
++};
++
++// Returns the key used for |attribute| in InteractiveNode.attributes
++const char* NodeAttributeName(NodeAttribute attribute);
++
++// Which InteractiveNode.attributes a snapshot computes and returns, from
++// InteractiveSnapshotOptions.attributes. String attributes left out are
++// never read from the tree; role is always kept for browser-side lookups
++// but only serialized if asked for.
++struct NodeAttributeMask {
++  using StringAttributes =
++      base::EnumSet<NodeAttribute, NodeAttribute::kValue, NodeAttribute::kPath>;
++
++  // Every attribute, the default
++  static NodeAttributeMask All();
++
++  // The attributes keyed |names| in InteractiveNode.attributes. Unknown
++  // names are ignored.
++  static NodeAttributeMask FromNames(const std::vector<std::string>& names);
++
++  bool Has(NodeAttribute attribute) const {
++    return string_attributes.Has(attribute);
++  }
++
++  // Packs the mask into an integer, e.g. for cache keys
++  uint64_t ToBitmask() const;
++
++  StringAttributes string_attributes = StringAttributes::All();
++  bool role = true;
++  bool depth = true;
++  bool in_viewport = true;
++};
++
++// Typed attribute record for a snapshot node.
++// Role, depth and viewport state are stored as plain values; string
++// attributes are kept as a short enum-keyed list (like
++// ui::AXNodeData::string_attributes) holding only the attributes the node
++// actually has. The string dictionary sent to the extension is only built
++// by ToDict() when serializing.
++struct NodeAttributes {
++  NodeAttributes();
++  NodeAttributes(const NodeAttributes&);
++  NodeAttributes(NodeAttributes&&);
++  NodeAttributes& operator=(const NodeAttributes&);
++  NodeAttributes& operator=(NodeAttributes&&);
++  ~NodeAttributes();
++
++  // Sets |attribute|, replacing any previous value
++  void Set(NodeAttribute attribute, std::string value);
++
++  // Returns the value of |attribute|, or an empty string if it is not set
++  const std::string& Get(NodeAttribute attribute) const;
++  bool Has(NodeAttribute attribute) const;
++
++  // Builds the InteractiveNode.attributes dictionary from the attributes in
++  // |mask|
++  base::Value::Dict ToDict(
++      const NodeAttributeMask& mask = NodeAttributeMask::All()) const;
++
++  ax::mojom::Role role = ax::mojom::Role::kUnknown;
++  int depth = 0;
++  bool in_viewport = false;
++  std::vector<std::pair<NodeAttribute, std::string>> string_attributes;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_ATTRIBUTES_H_
@@ -0,0 +1,46 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_index.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_index.cc
+new file mode 100644
+index 0000000000000..1cac6c6f37420
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_index.cc
+@@ -0,0 +1,40 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_index.h"
++
++#include <utility>
++
++namespace extensions {
++namespace api {
++
++AXNodeIndex::AXNodeIndex(browseros::SharedAXTreeUpdate snapshot)
++    : snapshot_(std::move(snapshot)) {
++  const std::vector<ui::AXNodeData>& all_nodes = nodes();
++  positions_.reserve(all_nodes.size());
++  for (size_t i = 0; i < all_nodes.size(); ++i) {
++    positions_[all_nodes[i].id] = i;
++  }
++}
++
++AXNodeIndex::~AXNodeIndex() = default;
++
++const ui::AXNodeData* AXNodeIndex::Find(int32_t ax_id) const {
++  auto it = positions_.find(ax_id);
++  if (it == positions_.end()) {
++    return nullptr;
++  }
++  return &nodes()[it->second];
++}
++
++std::optional<size_t> AXNodeIndex::FindPosition(int32_t ax_id) const {
++  auto it = positions_.find(ax_id);
++  if (it == positions_.end()) {
++    return std::nullopt;
++  }
++  return it->second;
++}
++
++}  // namespace api
++}  // namespace extensions
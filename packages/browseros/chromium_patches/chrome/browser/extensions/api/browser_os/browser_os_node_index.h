@@ -0,0 +1,65 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_index.h b/chrome/browser/extensions/api/browser_os/browser_os_node_index.h
+new file mode 100644
+index 0000000000000..874a7c13326c1
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_index.h
+@@ -0,0 +1,59 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_INDEX_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_INDEX_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <optional>
++#include <unordered_map>
++#include <vector>
++
++#include "base/memory/ref_counted.h"
++#include "chrome/browser/browseros/core/browseros_ax_snapshot_cache.h"
++#include "ui/accessibility/ax_node_data.h"
++
++namespace extensions {
++namespace api {
++
++// Read-only flat index over the nodes of an AXTreeUpdate.
++// Positions are the node order of the update, with an AX id -> position
++// table on top. The index keeps a reference to the shared snapshot instead
++// of copying its nodes, and is immutable after construction, so a single
++// instance can be shared by reference across ThreadPool workers.
++class AXNodeIndex : public base::RefCountedThreadSafe<AXNodeIndex> {
++ public:
++  explicit AXNodeIndex(browseros::SharedAXTreeUpdate snapshot);
++
++  AXNodeIndex(const AXNodeIndex&) = delete;
++  AXNodeIndex& operator=(const AXNodeIndex&) = delete;
++
++  // Returns the node with the given AX id, or nullptr if it is not indexed.
++  const ui::AXNodeData* Find(int32_t ax_id) const;
++  // Position of the node with the given AX id, if it is indexed.
++  std::optional<size_t> FindPosition(int32_t ax_id) const;
++
++  // Positional access, in tree-update order.
++  const ui::AXNodeData& at(size_t position) const { return nodes()[position]; }
++  size_t size() const { return nodes().size(); }
++  bool empty() const { return nodes().empty(); }
++  const std::vector<ui::AXNodeData>& nodes() const {
++    return snapshot_->data.nodes;
++  }
++
++  const browseros::SharedAXTreeUpdate& snapshot() const { return snapshot_; }
++
++ private:
++  friend class base::RefCountedThreadSafe<AXNodeIndex>;
++  ~AXNodeIndex();
++
++  const browseros::SharedAXTreeUpdate snapshot_;
++  std::unordered_map<int32_t, size_t> positions_;  // AX id -> index in nodes()
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_INDEX_H_
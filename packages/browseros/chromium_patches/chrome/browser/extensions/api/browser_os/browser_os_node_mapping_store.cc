@@ -0,0 +1,245 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.cc
+new file mode 100644
+index 0000000000000..1ca0a59723293
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.cc
+@@ -0,0 +1,239 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
++
++#include <utility>
++
++#include "base/containers/contains.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "content/public/browser/browser_context.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/vector2d_f.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++size_t EstimateMemoryUsage(const TabNodeMappings& mappings) {
++  size_t bytes = 0;
++  for (const auto& [node_id, info] : mappings.nodes) {
++    bytes += sizeof(std::pair<const uint32_t, NodeInfo>) + info.name.capacity();
++    for (const auto& [attribute, value] : info.attributes.string_attributes) {
++      bytes += sizeof(std::pair<NodeAttribute, std::string>) +
++               value.capacity();
++    }
++  }
++  for (const auto& [token, node_ids] : mappings.name_index) {
++    bytes += sizeof(std::pair<const std::string, std::vector<uint32_t>>) +
++             token.capacity() + node_ids.capacity() * sizeof(uint32_t);
++  }
++  return bytes;
++}
++
++}  // namespace
++
++TabNodeMappings::TabNodeMappings() = default;
++TabNodeMappings::~TabNodeMappings() = default;
++TabNodeMappings::TabNodeMappings(TabNodeMappings&&) = default;
++TabNodeMappings& TabNodeMappings::operator=(TabNodeMappings&&) = default;
++
++BrowserOSNodeMappingStore::BrowserOSNodeMappingStore(
++    content::BrowserContext* context)
++    // Unretained: the registration goes away with the store
++    : pressure_registration_(browseros::AddMemoryPressureHandler(
++          "node_mappings",
++          base::BindRepeating(&BrowserOSNodeMappingStore::OnMemoryPressure,
++                              base::Unretained(this)))),
++      profiler_registration_(browseros::AddStepProfilerSource(
++          "node_mappings",
++          base::BindRepeating(&BrowserOSNodeMappingStore::ReportStepProfile,
++                              base::Unretained(this)))) {}
++
++BrowserOSNodeMappingStore::~BrowserOSNodeMappingStore() = default;
++
++// static
++BrowserContextKeyedAPIFactory<BrowserOSNodeMappingStore>*
++BrowserOSNodeMappingStore::GetFactoryInstance() {
++  static base::NoDestructor<
++      BrowserContextKeyedAPIFactory<BrowserOSNodeMappingStore>>
++      instance;
++  return instance.get();
++}
++
++// static
++BrowserOSNodeMappingStore* BrowserOSNodeMappingStore::Get(
++    content::BrowserContext* context) {
++  return BrowserContextKeyedAPIFactory<BrowserOSNodeMappingStore>::Get(
++      context);
++}
++
++// static
++TabNodeMappings* BrowserOSNodeMappingStore::FindForTab(
++    content::WebContents* web_contents) {
++  if (!web_contents) {
++    return nullptr;
++  }
++  BrowserOSNodeMappingStore* store = Get(web_contents->GetBrowserContext());
++  return store ? store->Find(ExtensionTabUtil::GetTabId(web_contents))
++               : nullptr;
++}
++
++// static
++void BrowserOSNodeMappingStore::ClearForTab(
++    content::WebContents* web_contents) {
++  if (BrowserOSNodeMappingStore* store =
++          Get(web_contents->GetBrowserContext())) {
++    store->Clear(ExtensionTabUtil::GetTabId(web_contents));
++  }
++}
++
++TabNodeMappings* BrowserOSNodeMappingStore::Find(int tab_id) {
++  auto it = mappings_.find(tab_id);
++  return it != mappings_.end() ? &it->second : nullptr;
++}
++
++TabNodeMappings& BrowserOSNodeMappingStore::Reset(int tab_id) {
++  TabNodeMappings& mappings = mappings_[tab_id];
++  mappings = TabNodeMappings();
++  recency_.remove(tab_id);
++  recency_.push_back(tab_id);
++
++  // Evict the least recently snapshotted tabs over the cap
++  while (recency_.size() > kMaxNodeIdMappingTabs) {
++    Evict(recency_.front());
++  }
++  return mappings;
++}
++
++void BrowserOSNodeMappingStore::Clear(int tab_id) {
++  mappings_.erase(tab_id);
++  recency_.remove(tab_id);
++}
++
++void BrowserOSNodeMappingStore::OnSnapshotStored(int tab_id) {
++  TabNodeMappings* mappings = Find(tab_id);
++  if (!mappings) {
++    return;
++  }
++  mappings->memory_usage = EstimateMemoryUsage(*mappings);
++
++  size_t total = GetMemoryUsage();
++  while (total > kMaxNodeIdMappingBytes && recency_.front() != tab_id) {
++    const int evicted_tab_id = recency_.front();
++    total -= mappings_[evicted_tab_id].memory_usage;
++    Evict(evicted_tab_id);
++  }
++}
++
++void BrowserOSNodeMappingStore::UpdateScrollOffset(
++    int tab_id,
++    const gfx::PointF& offset,
++    const gfx::SizeF& viewport) {
++  TabNodeMappings* mappings = Find(tab_id);
++  if (!mappings) {
++    return;
++  }
++
++  if (!mappings->scroll_offset) {
++    mappings->scroll_offset = offset;
++    return;
++  }
++  const gfx::Vector2dF delta = offset - *mappings->scroll_offset;
++  mappings->scroll_offset = offset;
++  if (delta.IsZero()) {
++    return;
++  }
++
++  // Bounds are relative to the viewport, so content moves against the scroll
++  const gfx::RectF viewport_rect(viewport);
++  for (auto& [node_id, info] : mappings->nodes) {
++    info.bounds.Offset(-delta);
++    // Nodes without a box keep what the snapshot said
++    if (!info.bounds.IsEmpty()) {
++      info.in_viewport = viewport_rect.Intersects(info.bounds);
++    }
++  }
++  VLOG(1) << "[browseros] Shifted " << mappings->nodes.size()
++          << " node bounds in tab " << tab_id << " by scroll "
++          << delta.ToString();
++}
++
++size_t BrowserOSNodeMappingStore::GetNodeCount() const {
++  size_t count = 0;
++  for (const auto& [tab_id, mappings] : mappings_) {
++    count += mappings.nodes.size();
++  }
++  return count;
++}
++
++size_t BrowserOSNodeMappingStore::GetMemoryUsage() const {
++  size_t bytes = 0;
++  for (const auto& [tab_id, mappings] : mappings_) {
++    bytes += mappings.memory_usage;
++  }
++  return bytes;
++}
++
++void BrowserOSNodeMappingStore::Shutdown() {
++  pressure_registration_.RunAndReset();
++  profiler_registration_.RunAndReset();
++  mappings_.clear();
++  recency_.clear();
++}
++
++void BrowserOSNodeMappingStore::Evict(int tab_id) {
++  auto it = mappings_.find(tab_id);
++  if (it != mappings_.end()) {
++    LOG(INFO) << "[browseros] Evicting node mappings for tab " << tab_id
++              << " (" << it->second.nodes.size() << " nodes)";
++    mappings_.erase(it);
++  }
++  recency_.remove(tab_id);
++}
++
++void BrowserOSNodeMappingStore::ReportStepProfile(
++    base::OnceCallback<void(base::Value::Dict)> done) {
++  std::move(done).Run(
++      base::Value::Dict()
++          .Set("tabs", static_cast<int>(tab_count()))
++          .Set("nodes", static_cast<int>(GetNodeCount()))
++          .Set("bytes", static_cast<double>(GetMemoryUsage())));
++}
++
++void BrowserOSNodeMappingStore::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level,
++    base::OnceCallback<void(browseros::ReleasedMemory)> done) {
++  const bool keep_latest =
++      level != base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL &&
++      !recency_.empty();
++  const int latest_tab_id = keep_latest ? recency_.back() : -1;
++
++  browseros::ReleasedMemory released;
++  for (auto it = mappings_.begin(); it != mappings_.end();) {
++    if (keep_latest && it->first == latest_tab_id) {
++      ++it;
++      continue;
++    }
++    released.items += it->second.nodes.size();
++    released.bytes += EstimateMemoryUsage(it->second);
++    it = mappings_.erase(it);
++  }
++  std::erase_if(recency_,
++                [&](int tab_id) { return !base::Contains(mappings_, tab_id); });
++
++  if (released.items > 0) {
++    LOG(INFO) << "[browseros] Dropped " << released.items
++              << " node mappings on memory pressure";
++  }
++  std::move(done).Run(released);
++}
++
++}  // namespace api
++}  // namespace extensions
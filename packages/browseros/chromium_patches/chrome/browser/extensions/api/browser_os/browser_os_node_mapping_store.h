@@ -0,0 +1,164 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h b/chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h
+new file mode 100644
+index 0000000000000..470a1f4baa2fa
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h
+@@ -0,0 +1,158 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_MAPPING_STORE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_MAPPING_STORE_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <list>
++#include <optional>
++#include <string>
++#include <unordered_map>
++#include <vector>
++
++#include "base/functional/callback_helpers.h"
++#include "base/memory/weak_ptr.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "extensions/browser/browser_context_keyed_api_factory.h"
++#include "ui/gfx/geometry/point_f.h"
++#include "ui/gfx/geometry/size_f.h"
++
++namespace content {
++class BrowserContext;
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Maximum number of tabs whose node ID mappings a profile keeps at once.
++// Beyond this the least recently snapshotted tab's mappings are evicted.
++inline constexpr size_t kMaxNodeIdMappingTabs = 64;
++
++// Maximum estimated heap bytes of node mappings a profile keeps. Beyond this
++// the least recently snapshotted tabs are evicted, never the tab just
++// snapshotted.
++inline constexpr size_t kMaxNodeIdMappingBytes = 32 * 1024 * 1024;
++
++// Lowercased name token -> nodeIds whose name contains it
++using NodeNameIndex = std::unordered_map<std::string, std::vector<uint32_t>>;
++
++// What a tab's latest interactive snapshot leaves behind for the calls that
++// act on its nodeIds
++struct TabNodeMappings {
++  TabNodeMappings();
++  ~TabNodeMappings();
++  TabNodeMappings(TabNodeMappings&&);
++  TabNodeMappings& operator=(TabNodeMappings&&);
++
++  std::unordered_map<uint32_t, NodeInfo> nodes;
++  NodeNameIndex name_index;
++  // Main frame scroll offset the bounds in |nodes| are relative to, once
++  // one was recorded
++  std::optional<gfx::PointF> scroll_offset;
++  // Estimated heap bytes, as of the end of the snapshot
++  size_t memory_usage = 0;
++};
++
++// Node ID mappings of one profile's tabs. Incognito profiles have their own
++// store, so profiles running agents side by side don't share, or evict from,
++// each other's mappings. Tabs are evicted least recently snapshotted first,
++// over kMaxNodeIdMappingTabs or kMaxNodeIdMappingBytes.
++//
++// UI thread only.
++class BrowserOSNodeMappingStore : public BrowserContextKeyedAPI {
++ public:
++  explicit BrowserOSNodeMappingStore(content::BrowserContext* context);
++  ~BrowserOSNodeMappingStore() override;
++
++  BrowserOSNodeMappingStore(const BrowserOSNodeMappingStore&) = delete;
++  BrowserOSNodeMappingStore& operator=(const BrowserOSNodeMappingStore&) =
++      delete;
++
++  static BrowserContextKeyedAPIFactory<BrowserOSNodeMappingStore>*
++  GetFactoryInstance();
++  static BrowserOSNodeMappingStore* Get(content::BrowserContext* context);
++
++  // The mappings of |web_contents|' latest snapshot, from its profile's
++  // store, or null if there are none
++  static TabNodeMappings* FindForTab(content::WebContents* web_contents);
++
++  // Drops |web_contents|' mappings (tab closed or navigated to a new page)
++  static void ClearForTab(content::WebContents* web_contents);
++
++  // |tab_id|'s mappings, or null if it has none
++  TabNodeMappings* Find(int tab_id);
++
++  // Clears |tab_id|'s mappings ahead of a new snapshot, marks the tab as the
++  // most recently snapshotted one and evicts tabs over kMaxNodeIdMappingTabs
++  TabNodeMappings& Reset(int tab_id);
++
++  // Drops all mappings for |tab_id|
++  void Clear(int tab_id);
++
++  // Updates |tab_id|'s memory estimate once its snapshot has been stored,
++  // then evicts other tabs while the store is over kMaxNodeIdMappingBytes
++  void OnSnapshotStored(int tab_id);
++
++  // Records |tab_id|'s main frame scroll offset and viewport size, in widget
++  // pixels. The first offset recorded after a snapshot is taken as the one
++  // its bounds were captured at; later ones shift the stored bounds by the
++  // distance scrolled since and recompute in_viewport, so nodes can be
++  // clicked after a scroll without a new snapshot. Only the main frame's
++  // scroll is tracked: nodes in a scrolled inner container, or fixed to the
++  // viewport, keep stale bounds until the next snapshot.
++  void UpdateScrollOffset(int tab_id,
++                          const gfx::PointF& offset,
++                          const gfx::SizeF& viewport);
++
++  size_t tab_count() const { return mappings_.size(); }
++  // Total number of NodeInfo entries held across the profile's tabs
++  size_t GetNodeCount() const;
++  size_t GetMemoryUsage() const;
++
++  base::WeakPtr<BrowserOSNodeMappingStore> GetWeakPtr() {
++    return weak_factory_.GetWeakPtr();
++  }
++
++  // KeyedService:
++  void Shutdown() override;
++
++ private:
++  friend class BrowserContextKeyedAPIFactory<BrowserOSNodeMappingStore>;
++
++  // BrowserContextKeyedAPI:
++  static const char* service_name() { return "BrowserOSNodeMappingStore"; }
++  static const bool kServiceIsNULLWhileTesting = false;
++  static const bool kServiceRedirectedInIncognito = false;
++  static const bool kServiceHasOwnInstanceInIncognito = true;
++
++  void Evict(int tab_id);
++
++  // Moderate pressure keeps the most recently snapshotted tab, which the
++  // agent is most likely still acting on; critical pressure drops all tabs.
++  // Agents re-snapshot a tab whose mappings are gone.
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(browseros::ReleasedMemory)> done);
++
++  // Store sizes, for chrome://browseros-internals
++  void ReportStepProfile(base::OnceCallback<void(base::Value::Dict)> done);
++
++  std::unordered_map<int, TabNodeMappings> mappings_;
++  // Tab IDs in snapshot order, least recently snapshotted first
++  std::list<int> recency_;
++  base::ScopedClosureRunner pressure_registration_;
++  base::ScopedClosureRunner profiler_registration_;
++
++  base::WeakPtrFactory<BrowserOSNodeMappingStore> weak_factory_{this};
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_MAPPING_STORE_H_
@@ -0,0 +1,191 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_query.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_query.cc
+new file mode 100644
+index 0000000000000..8bd217a8f0382
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_query.cc
+@@ -0,0 +1,185 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_query.h"
++
++#include <algorithm>
++#include <optional>
++#include <string>
++#include <utility>
++
++#include "base/containers/flat_set.h"
++#include "base/strings/string_util.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
++#include "ui/accessibility/ax_enum_util.h"
++
++namespace extensions {
++namespace api {
++
++std::vector<std::string> TokenizeName(std::string_view text) {
++  std::vector<std::string> tokens;
++  std::string token;
++  for (char c : text) {
++    // Bytes of multi-byte UTF-8 sequences stay part of the token
++    if (base::IsAsciiAlphaNumeric(c) || !base::IsAscii(c)) {
++      token.push_back(base::ToLowerASCII(c));
++    } else if (!token.empty()) {
++      tokens.push_back(std::move(token));
++      token.clear();
++    }
++  }
++  if (!token.empty()) {
++    tokens.push_back(std::move(token));
++  }
++  return tokens;
++}
++
++namespace {
++
++// Returns the nodeIds whose name has a token containing each of the query
++// name's tokens. Scans the token vocabulary, not the nodes.
++base::flat_set<uint32_t> FindNameCandidates(const NodeNameIndex& index,
++                                            std::string_view name) {
++  std::optional<base::flat_set<uint32_t>> candidates;
++  for (const std::string& query_token : TokenizeName(name)) {
++    std::vector<uint32_t> matches;
++    for (const auto& [token, node_ids] : index) {
++      if (token.find(query_token) != std::string::npos) {
++        matches.insert(matches.end(), node_ids.begin(), node_ids.end());
++      }
++    }
++    base::flat_set<uint32_t> token_matches(std::move(matches));
++    if (!candidates) {
++      candidates = std::move(token_matches);
++    } else {
++      base::EraseIf(*candidates, [&](uint32_t node_id) {
++        return !token_matches.contains(node_id);
++      });
++    }
++    if (candidates->empty()) {
++      break;
++    }
++  }
++  return candidates.value_or(base::flat_set<uint32_t>());
++}
++
++bool MatchesAttributes(const NodeAttributes& attributes,
++                       const base::Value::Dict& expected) {
++  for (const auto [key, value] : expected) {
++    if (key == "role") {
++      if (!value.is_string() ||
++          ui::ToString(attributes.role) != value.GetString()) {
++        return false;
++      }
++      continue;
++    }
++    auto it = std::ranges::find_if(
++        attributes.string_attributes, [&key](const auto& attribute) {
++          return key == NodeAttributeName(attribute.first);
++        });
++    if (it == attributes.string_attributes.end() || !value.is_string() ||
++        it->second != value.GetString()) {
++      return false;
++    }
++  }
++  return true;
++}
++
++bool MatchesQuery(const NodeInfo& node_info,
++                  const browser_os::NodeQuery& query) {
++  if (query.type != browser_os::InteractiveNodeType::kNone &&
++      node_info.node_type != query.type) {
++    return false;
++  }
++  if (query.role && ui::ToString(node_info.attributes.role) != *query.role) {
++    return false;
++  }
++  if (query.in_viewport && node_info.in_viewport != *query.in_viewport) {
++    return false;
++  }
++  // The index only matches whole tokens; the name must also contain the
++  // query as a whole, e.g. "sign in" must not match "in, sign"
++  if (query.name &&
++      base::ToLowerASCII(node_info.name).find(base::ToLowerASCII(
++          *query.name)) == std::string::npos) {
++    return false;
++  }
++  if (query.attributes &&
++      !MatchesAttributes(node_info.attributes,
++                         query.attributes->additional_properties)) {
++    return false;
++  }
++  return true;
++}
++
++}  // namespace
++
++void IndexNodeName(TabNodeMappings& mappings,
++                   uint32_t node_id,
++                   std::string_view name) {
++  if (name.empty()) {
++    return;
++  }
++  for (std::string& token : TokenizeName(name)) {
++    std::vector<uint32_t>& node_ids = mappings.name_index[std::move(token)];
++    // A name repeating a word lists the node once
++    if (node_ids.empty() || node_ids.back() != node_id) {
++      node_ids.push_back(node_id);
++    }
++  }
++}
++
++std::vector<uint32_t> FindNodes(const TabNodeMappings& mappings,
++                                const browser_os::NodeQuery& query) {
++  std::vector<uint32_t> node_ids;
++  const std::unordered_map<uint32_t, NodeInfo>& node_mappings = mappings.nodes;
++
++  if (query.name && !TokenizeName(*query.name).empty()) {
++    for (uint32_t node_id :
++         FindNameCandidates(mappings.name_index, *query.name)) {
++      // Nodes dropped by a byte budget keep their index entries
++      auto node_it = node_mappings.find(node_id);
++      if (node_it != node_mappings.end() &&
++          MatchesQuery(node_it->second, query)) {
++        node_ids.push_back(node_id);
++      }
++    }
++    // flat_set iteration is already in nodeId order
++    return node_ids;
++  }
++
++  for (const auto& [node_id, node_info] : node_mappings) {
++    if (MatchesQuery(node_info, query)) {
++      node_ids.push_back(node_id);
++    }
++  }
++  std::ranges::sort(node_ids);
++  return node_ids;
++}
++
++browser_os::InteractiveNode NodeInfoToInteractiveNode(
++    uint32_t node_id,
++    const NodeInfo& node_info) {
++  browser_os::InteractiveNode interactive_node;
++  interactive_node.node_id = node_id;
++  interactive_node.type = node_info.node_type;
++  interactive_node.name = node_info.name;
++
++  browser_os::Rect rect;
++  rect.x = node_info.bounds.x();
++  rect.y = node_info.bounds.y();
++  rect.width = node_info.bounds.width();
++  rect.height = node_info.bounds.height();
++  interactive_node.rect = std::move(rect);
++
++  browser_os::InteractiveNode::Attributes attributes;
++  attributes.additional_properties = node_info.attributes.ToDict();
++  interactive_node.attributes = std::move(attributes);
++
++  return interactive_node;
++}
++
++}  // namespace api
++}  // namespace extensions
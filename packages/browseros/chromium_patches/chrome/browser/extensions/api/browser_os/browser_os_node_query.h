@@ -0,0 +1,51 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_query.h b/chrome/browser/extensions/api/browser_os/browser_os_node_query.h
+new file mode 100644
+index 0000000000000..b324a9f71f09f
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_query.h
+@@ -0,0 +1,45 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_QUERY_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_QUERY_H_
++
++#include <cstdint>
++#include <string>
++#include <string_view>
++#include <vector>
++
++#include "chrome/common/extensions/api/browser_os.h"
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++struct TabNodeMappings;
++
++// Splits |text| into lowercased runs of letters and digits. Bytes of
++// multi-byte UTF-8 sequences stay part of the token.
++std::vector<std::string> TokenizeName(std::string_view text);
++
++// Adds |name|'s lowercased word tokens for |node_id| to the name index of
++// |mappings|. Called as snapshot nodes are stored in them.
++void IndexNodeName(TabNodeMappings& mappings,
++                   uint32_t node_id,
++                   std::string_view name);
++
++// Returns the nodeIds of |mappings| (a tab's cached snapshot) that match
++// |query|, in nodeId order. Name matches are narrowed through the name index
++// first, so only candidate nodes are inspected.
++std::vector<uint32_t> FindNodes(const TabNodeMappings& mappings,
++                                const browser_os::NodeQuery& query);
++
++// Builds the InteractiveNode reported for a cached node
++browser_os::InteractiveNode NodeInfoToInteractiveNode(
++    uint32_t node_id,
++    const NodeInfo& node_info);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_QUERY_H_
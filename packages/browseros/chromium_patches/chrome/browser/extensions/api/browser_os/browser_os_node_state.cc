@@ -0,0 +1,141 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_state.cc b/chrome/browser/extensions/api/browser_os/browser_os_node_state.cc
+new file mode 100644
+index 0000000000000..5c77e10c16d42
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_state.cc
+@@ -0,0 +1,135 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_state.h"
++
++#include "base/containers/flat_map.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/platform/browser_accessibility.h"
++#include "ui/accessibility/platform/browser_accessibility_manager.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++browser_os::NodeState ToNodeState(uint32_t node_id,
++                                  const ui::AXNodeData& data,
++                                  bool focused) {
++  browser_os::NodeState state;
++  state.node_id = node_id;
++  state.exists = true;
++  state.focused = focused;
++  state.disabled = data.GetRestriction() == ax::mojom::Restriction::kDisabled;
++
++  if (data.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    state.name = data.GetStringAttribute(ax::mojom::StringAttribute::kName);
++  }
++  if (data.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
++    state.value = data.GetStringAttribute(ax::mojom::StringAttribute::kValue);
++  }
++
++  // Only set where the state applies to the node
++  switch (data.GetCheckedState()) {
++    case ax::mojom::CheckedState::kNone:
++      break;
++    case ax::mojom::CheckedState::kFalse:
++      state.checked = "false";
++      break;
++    case ax::mojom::CheckedState::kTrue:
++      state.checked = "true";
++      break;
++    case ax::mojom::CheckedState::kMixed:
++      state.checked = "mixed";
++      break;
++  }
++  if (data.HasState(ax::mojom::State::kExpanded)) {
++    state.expanded = true;
++  } else if (data.HasState(ax::mojom::State::kCollapsed)) {
++    state.expanded = false;
++  }
++  if (data.HasBoolAttribute(ax::mojom::BoolAttribute::kSelected)) {
++    state.selected = data.GetBoolAttribute(ax::mojom::BoolAttribute::kSelected);
++  }
++  return state;
++}
++
++browser_os::NodeState MissingNodeState(uint32_t node_id) {
++  browser_os::NodeState state;
++  state.node_id = node_id;
++  state.exists = false;
++  return state;
++}
++
++const NodeInfo* FindMapping(
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings,
++    int node_id) {
++  auto it = node_mappings.find(node_id);
++  return it != node_mappings.end() ? &it->second : nullptr;
++}
++
++}  // namespace
++
++std::optional<std::vector<browser_os::NodeState>> ReadLiveNodeStates(
++    const std::vector<int>& node_ids,
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings) {
++  std::vector<browser_os::NodeState> states;
++  states.reserve(node_ids.size());
++  for (int node_id : node_ids) {
++    const NodeInfo* info = FindMapping(node_mappings, node_id);
++    if (!info) {
++      states.push_back(MissingNodeState(node_id));
++      continue;
++    }
++
++    ui::BrowserAccessibilityManager* manager =
++        ui::BrowserAccessibilityManager::FromID(info->ax_tree_id);
++    if (!manager) {
++      return std::nullopt;
++    }
++    ui::BrowserAccessibility* node = manager->GetFromID(info->ax_node_id);
++    states.push_back(node ? ToNodeState(node_id, node->GetData(),
++                                        manager->GetFocus() == node)
++                          : MissingNodeState(node_id));
++  }
++  return states;
++}
++
++std::vector<browser_os::NodeState> ReadSnapshotNodeStates(
++    const std::vector<int>& node_ids,
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings,
++    const ui::AXTreeUpdate& snapshot) {
++  // One pass over the tree for all the requested nodes
++  base::flat_map<int32_t, const ui::AXNodeData*> wanted;
++  for (int node_id : node_ids) {
++    if (const NodeInfo* info = FindMapping(node_mappings, node_id)) {
++      wanted.emplace(info->ax_node_id, nullptr);
++    }
++  }
++  for (const ui::AXNodeData& data : snapshot.nodes) {
++    auto it = wanted.find(data.id);
++    if (it != wanted.end()) {
++      it->second = &data;
++    }
++  }
++
++  std::vector<browser_os::NodeState> states;
++  states.reserve(node_ids.size());
++  for (int node_id : node_ids) {
++    const NodeInfo* info = FindMapping(node_mappings, node_id);
++    const ui::AXNodeData* data =
++        info && info->ax_tree_id == snapshot.tree_data.tree_id
++            ? wanted.at(info->ax_node_id)
++            : nullptr;
++    states.push_back(data ? ToNodeState(node_id, *data,
++                                        snapshot.tree_data.focus_id == data->id)
++                          : MissingNodeState(node_id));
++  }
++  return states;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,48 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_node_state.h b/chrome/browser/extensions/api/browser_os/browser_os_node_state.h
+new file mode 100644
+index 0000000000000..4af5af368de78
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_node_state.h
+@@ -0,0 +1,42 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_STATE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_STATE_H_
++
++#include <cstdint>
++#include <optional>
++#include <unordered_map>
++#include <vector>
++
++#include "chrome/common/extensions/api/browser_os.h"
++#include "ui/accessibility/ax_tree_update.h"
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++
++// Reads the current state of snapshot nodes for getNodeState, without
++// processing a new snapshot. |node_mappings| is the tab's last snapshot;
++// nodeIds it doesn't have, and nodes gone from the page since, are reported
++// with |exists| false. States are in the order of |node_ids|.
++
++// Reads from the browser's own copy of the accessibility tree, which needs
++// no renderer round trip. Returns std::nullopt if a node's tree is not
++// there, i.e. the tab does not have accessibility enabled.
++std::optional<std::vector<browser_os::NodeState>> ReadLiveNodeStates(
++    const std::vector<int>& node_ids,
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings);
++
++// Reads from |snapshot|, a tree fetched because there was no live one
++std::vector<browser_os::NodeState> ReadSnapshotNodeStates(
++    const std::vector<int>& node_ids,
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings,
++    const ui::AXTreeUpdate& snapshot);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_NODE_STATE_H_
@@ -0,0 +1,193 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_helpers.cc b/chrome/browser/extensions/api/browser_os/browser_os_page_helpers.cc
+new file mode 100644
+index 0000000000000..e1160a0329068
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_helpers.cc
+@@ -0,0 +1,187 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_helpers.h"
++
++#include <string>
++#include <utility>
++
++#include "base/json/json_writer.h"
++#include "base/strings/str_cat.h"
++#include "base/strings/string_split.h"
++#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++#include "chrome/common/chrome_isolated_world_ids.h"
++#include "content/public/browser/document_user_data.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Installs the helpers as a non-enumerable global of the isolated world.
++// Keep in sync with the function list in the header.
++constexpr char kPageHelperLibrary[] = R"JS(
++(() => {
++  const find = (target) => {
++    if (target.id) {
++      const element = document.getElementById(target.id);
++      if (element) {
++        return [element, 'id'];
++      }
++    }
++    if (target.tag && target.classes.length > 0) {
++      try {
++        const selector = target.tag +
++            target.classes.map((name) => '.' + CSS.escape(name)).join('');
++        const element = document.querySelector(selector);
++        if (element) {
++          return [element, 'class and tag'];
++        }
++      } catch (e) {
++        // Not a valid selector
++      }
++    }
++    if (target.tag && target.tagFallback) {
++      const element = document.getElementsByTagName(target.tag)[0];
++      if (element) {
++        return [element, 'tag'];
++      }
++    }
++    return [null, ''];
++  };
++
++  const notifyInput = (element) => {
++    element.dispatchEvent(new Event('input', {bubbles: true}));
++    element.dispatchEvent(new Event('change', {bubbles: true}));
++  };
++
++  const setText = (element, text) => {
++    if (element.value !== undefined) {
++      element.value = text;
++    } else if (element.isContentEditable) {
++      element.textContent = text;
++    }
++  };
++
++  Object.defineProperty(globalThis, '__browserosHelpers', {value: {
++    click(target) {
++      const [element, by] = find(target);
++      if (!element) {
++        return 'no element found';
++      }
++      element.click();
++      return 'clicked by ' + by;
++    },
++    focus(target) {
++      const [element, by] = find(target);
++      if (!element) {
++        return 'no element found';
++      }
++      element.focus();
++      if (element.select) {
++        element.select();
++      }
++      return 'focused by ' + by;
++    },
++    setValue(target, text) {
++      const [element, by] = find(target);
++      if (!element) {
++        return 'no element found';
++      }
++      setText(element, text);
++      notifyInput(element);
++      return 'set by ' + by;
++    },
++    clearFocused() {
++      const element = document.activeElement;
++      if (!element) {
++        return 'no element focused';
++      }
++      setText(element, '');
++      notifyInput(element);
++      return 'cleared';
++    },
++    setFocusedValue(text) {
++      const element = document.activeElement;
++      if (!element || !(element.tagName === 'INPUT' ||
++                        element.tagName === 'TEXTAREA' ||
++                        element.isContentEditable)) {
++        return false;
++      }
++      setText(element, text);
++      notifyInput(element);
++      return true;
++    },
++  }});
++})();
++)JS";
++
++// Marks a document that already has the helper library. Goes away with
++// the document, so the next document gets the library installed again.
++class PageHelpersInstalled
++    : public content::DocumentUserData<PageHelpersInstalled> {
++ public:
++  ~PageHelpersInstalled() override = default;
++
++ private:
++  explicit PageHelpersInstalled(content::RenderFrameHost* rfh)
++      : DocumentUserData(rfh) {}
++
++  friend DocumentUserData;
++  DOCUMENT_USER_DATA_KEY_DECL();
++};
++
++DOCUMENT_USER_DATA_KEY_IMPL(PageHelpersInstalled);
++
++}  // namespace
++
++base::Value::Dict PageHelperTarget(const NodeInfo& node_info,
++                                   bool tag_fallback) {
++  base::Value::List classes;
++  for (std::string& name : base::SplitString(
++           node_info.attributes.Get(NodeAttribute::kClass),
++           base::kWhitespaceASCII, base::TRIM_WHITESPACE,
++           base::SPLIT_WANT_NONEMPTY)) {
++    classes.Append(std::move(name));
++  }
++
++  return base::Value::Dict()
++      .Set("id", node_info.attributes.Get(NodeAttribute::kId))
++      .Set("tag", node_info.attributes.Get(NodeAttribute::kHtmlTag))
++      .Set("classes", std::move(classes))
++      .Set("tagFallback", tag_fallback);
++}
++
++void RunPageHelper(content::RenderFrameHost* rfh,
++                   std::string_view function,
++                   base::Value::List args,
++                   content::RenderFrameHost::JavaScriptResultCallback callback) {
++  if (!rfh) {
++    if (callback) {
++      std::move(callback).Run(base::Value());
++    }
++    return;
++  }
++
++  // Scripts on one frame run in order, so the call below sees the library
++  if (!PageHelpersInstalled::GetForCurrentDocument(rfh)) {
++    rfh->ExecuteJavaScriptInIsolatedWorld(base::UTF8ToUTF16(kPageHelperLibrary),
++                                          base::NullCallback(),
++                                          ISOLATED_WORLD_ID_CHROME_INTERNAL);
++    PageHelpersInstalled::CreateForCurrentDocument(rfh);
++  }
++
++  // JSON is a valid JavaScript expression, so the arguments need no
++  // escaping of their own
++  std::string args_json = base::WriteJson(args).value_or("[]");
++  rfh->ExecuteJavaScriptInIsolatedWorld(
++      base::UTF8ToUTF16(base::StrCat(
++          {"__browserosHelpers.", function, "(...", args_json, ")"})),
++      std::move(callback), ISOLATED_WORLD_ID_CHROME_INTERNAL);
++}
++
++}  // namespace api
++}  // namespace extensions
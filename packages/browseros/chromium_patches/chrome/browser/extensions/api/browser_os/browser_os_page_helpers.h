@@ -0,0 +1,54 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_helpers.h b/chrome/browser/extensions/api/browser_os/browser_os_page_helpers.h
+new file mode 100644
+index 0000000000000..7c0ac8157b09d
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_helpers.h
+@@ -0,0 +1,48 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_HELPERS_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_HELPERS_H_
++
++#include <string_view>
++
++#include "base/functional/callback_helpers.h"
++#include "base/values.h"
++#include "content/public/browser/render_frame_host.h"
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++
++// The page helper library holds the JavaScript the HTML fallbacks of the
++// interaction functions run (click, focus, set value, clear). It is
++// installed once per document, in an isolated world so page scripts can
++// neither see nor replace it, and each action then only sends a one-line
++// call with JSON arguments. That keeps V8 from parsing the helpers again
++// for every action and needs no hand-written escaping.
++//
++// Functions, all taking a target from PageHelperTarget and returning a
++// short status string:
++//   click(target), focus(target), setValue(target, text)
++// and, working on document.activeElement:
++//   clearFocused(), setFocusedValue(text) -> bool
++
++// Describes how the helpers find the element of |node_info|: by HTML id,
++// then by tag and classes, then, if |tag_fallback|, by tag alone.
++base::Value::Dict PageHelperTarget(const NodeInfo& node_info,
++                                   bool tag_fallback);
++
++// Calls the helper |function| with |args| in the document of |rfh|,
++// installing the library first if this document does not have it yet.
++void RunPageHelper(content::RenderFrameHost* rfh,
++                   std::string_view function,
++                   base::Value::List args,
++                   content::RenderFrameHost::JavaScriptResultCallback
++                       callback = base::NullCallback());
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_HELPERS_H_
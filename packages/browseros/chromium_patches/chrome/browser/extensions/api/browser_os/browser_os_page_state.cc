@@ -0,0 +1,192 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_state.cc b/chrome/browser/extensions/api/browser_os/browser_os_page_state.cc
+new file mode 100644
+index 0000000000000..4aa728183a54f
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_state.cc
+@@ -0,0 +1,186 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_page_state.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "content/public/browser/global_request_id.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/web_contents.h"
++#include "extensions/browser/event_router.h"
++#include "third_party/blink/public/mojom/loader/resource_load_info.mojom.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSPageState::BrowserOSPageState(content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSPageState>(*web_contents) {}
++
++BrowserOSPageState::~BrowserOSPageState() = default;
++
++// static
++browser_os::PageLoadStatus BrowserOSPageState::GetStatus(
++    content::WebContents* web_contents) {
++  browser_os::PageLoadStatus status;
++  status.is_resources_loading = web_contents->IsLoading();
++  if (content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame()) {
++    status.is_dom_content_loaded = rfh->IsDOMContentLoaded();
++    status.is_page_complete = rfh->IsDocumentOnLoadCompletedInMainFrame();
++  }
++
++  // Without a tracker nothing was seen loading besides the current load
++  base::TimeDelta since_activity = base::TimeDelta::Max();
++  BrowserOSPageState* page_state = FromWebContents(web_contents);
++  if (page_state && !page_state->last_network_activity_.is_null()) {
++    since_activity =
++        base::TimeTicks::Now() - page_state->last_network_activity_;
++    status.ms_since_network_activity = since_activity.InMillisecondsF();
++  }
++  status.network_idle =
++      !status.is_resources_loading && since_activity >= kNetworkIdleTime;
++  return status;
++}
++
++// static
++bool BrowserOSPageState::HasReached(const browser_os::PageLoadStatus& status,
++                                    browser_os::PageLoadState state) {
++  switch (state) {
++    case browser_os::PageLoadState::kLoading:
++      return status.is_resources_loading;
++    case browser_os::PageLoadState::kDomContentLoaded:
++      return status.is_dom_content_loaded;
++    case browser_os::PageLoadState::kLoad:
++      return status.is_page_complete;
++    case browser_os::PageLoadState::kIdle:
++      return status.is_page_complete && !status.is_resources_loading;
++    case browser_os::PageLoadState::kNetworkIdle:
++      return status.network_idle;
++    case browser_os::PageLoadState::kNone:
++      return true;
++  }
++}
++
++void BrowserOSPageState::WaitFor(browser_os::PageLoadState state,
++                                 base::TimeDelta timeout,
++                                 WaitCallback callback) {
++  if (HasReached(GetStatus(web_contents()), state)) {
++    std::move(callback).Run(WaitResult::kReached);
++    return;
++  }
++
++  auto waiter = std::make_unique<Waiter>();
++  waiter->state = state;
++  waiter->callback = std::move(callback);
++  waiter->timeout_timer.Start(
++      FROM_HERE, timeout,
++      base::BindOnce(&BrowserOSPageState::OnWaitTimeout,
++                     base::Unretained(this), waiter.get()));
++  waiters_.push_back(std::move(waiter));
++}
++
++void BrowserOSPageState::DidStartLoading() {
++  OnNetworkActivity();
++  OnStateChanged(browser_os::PageLoadState::kLoading);
++}
++
++void BrowserOSPageState::DOMContentLoaded(
++    content::RenderFrameHost* render_frame_host) {
++  if (render_frame_host->IsInPrimaryMainFrame()) {
++    OnStateChanged(browser_os::PageLoadState::kDomContentLoaded);
++  }
++}
++
++void BrowserOSPageState::DocumentOnLoadCompletedInPrimaryMainFrame() {
++  OnStateChanged(browser_os::PageLoadState::kLoad);
++}
++
++void BrowserOSPageState::DidStopLoading() {
++  // The idle window counts from the load finishing
++  OnNetworkActivity();
++  OnStateChanged(browser_os::PageLoadState::kIdle);
++}
++
++void BrowserOSPageState::ResourceLoadComplete(
++    content::RenderFrameHost* render_frame_host,
++    const content::GlobalRequestID& request_id,
++    const blink::mojom::ResourceLoadInfo& resource_load_info) {
++  OnNetworkActivity();
++}
++
++void BrowserOSPageState::OnNetworkActivity() {
++  last_network_activity_ = base::TimeTicks::Now();
++  network_idle_timer_.Start(FROM_HERE, kNetworkIdleTime, this,
++                            &BrowserOSPageState::OnNetworkIdleTimer);
++}
++
++void BrowserOSPageState::OnNetworkIdleTimer() {
++  // Resumes from DidStopLoading() if a load is still running
++  if (!web_contents()->IsLoading()) {
++    OnStateChanged(browser_os::PageLoadState::kNetworkIdle);
++  }
++}
++
++void BrowserOSPageState::WebContentsDestroyed() {
++  // Nothing still waiting will be reached
++  std::vector<std::unique_ptr<Waiter>> waiters = std::move(waiters_);
++  for (auto& waiter : waiters) {
++    std::move(waiter->callback).Run(WaitResult::kTabClosed);
++  }
++}
++
++void BrowserOSPageState::OnStateChanged(browser_os::PageLoadState state) {
++  const browser_os::PageLoadStatus status = GetStatus(web_contents());
++
++  EventRouter* event_router =
++      EventRouter::Get(web_contents()->GetBrowserContext());
++  if (event_router && event_router->HasEventListener(
++                          browser_os::OnPageStateChanged::kEventName)) {
++    browser_os::PageStateChange change;
++    change.tab_id = ExtensionTabUtil::GetTabId(web_contents());
++    change.state = state;
++    change.url = web_contents()->GetLastCommittedURL().spec();
++    change.status = status.Clone();
++    auto event = std::make_unique<Event>(
++        events::UNKNOWN, browser_os::OnPageStateChanged::kEventName,
++        browser_os::OnPageStateChanged::Create(change),
++        web_contents()->GetBrowserContext());
++    event_router->BroadcastEvent(std::move(event));
++  }
++
++  // Collect first: a callback may start a new wait on this tab
++  std::vector<Waiter*> reached;
++  for (const auto& waiter : waiters_) {
++    if (HasReached(status, waiter->state)) {
++      reached.push_back(waiter.get());
++    }
++  }
++  for (Waiter* waiter : reached) {
++    FinishWaiter(waiter, WaitResult::kReached);
++  }
++}
++
++void BrowserOSPageState::OnWaitTimeout(Waiter* waiter) {
++  FinishWaiter(waiter, WaitResult::kTimedOut);
++}
++
++void BrowserOSPageState::FinishWaiter(Waiter* waiter, WaitResult result) {
++  auto it = std::ranges::find(waiters_, waiter, &std::unique_ptr<Waiter>::get);
++  if (it == waiters_.end()) {
++    return;
++  }
++  std::unique_ptr<Waiter> finished = std::move(*it);
++  waiters_.erase(it);
++  std::move(finished->callback).Run(result);
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSPageState);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,114 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_page_state.h b/chrome/browser/extensions/api/browser_os/browser_os_page_state.h
+new file mode 100644
+index 0000000000000..d7642ffce7798
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_page_state.h
+@@ -0,0 +1,108 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_STATE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_STATE_H_
++
++#include <memory>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace extensions {
++namespace api {
++
++// Tracks a tab's load state for browserOS.waitForLoadState and fires
++// browserOS.onPageStateChanged as it changes, from the same
++// WebContentsObserver hooks BrowserOSChangeDetector watches. Attached to a
++// tab the first time getPageLoadStatus or waitForLoadState is called on
++// it.
++//
++// Network idleness comes from ResourceLoadComplete(): the tab is idle once
++// it stopped loading and no subresource finished for kNetworkIdleTime.
++// WebContentsObserver has no hook for a request starting, so a request
++// that stays open, like a long poll or an event stream, doesn't keep the
++// tab busy, much as if a couple of requests were allowed in flight.
++class BrowserOSPageState
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSPageState> {
++ public:
++  enum class WaitResult {
++    kReached,
++    kTimedOut,
++    kTabClosed,
++  };
++  using WaitCallback = base::OnceCallback<void(WaitResult)>;
++
++  BrowserOSPageState(const BrowserOSPageState&) = delete;
++  BrowserOSPageState& operator=(const BrowserOSPageState&) = delete;
++  ~BrowserOSPageState() override;
++
++  // How long the tab must go without loading anything to be network idle
++  static constexpr base::TimeDelta kNetworkIdleTime = base::Milliseconds(500);
++
++  // Reads the load status of |web_contents|' primary main frame
++  static browser_os::PageLoadStatus GetStatus(
++      content::WebContents* web_contents);
++
++  // Whether |status| has reached |state|
++  static bool HasReached(const browser_os::PageLoadStatus& status,
++                         browser_os::PageLoadState state);
++
++  // Runs |callback| once the tab reaches |state|, right away if it already
++  // has, or with kTimedOut after |timeout|
++  void WaitFor(browser_os::PageLoadState state,
++               base::TimeDelta timeout,
++               WaitCallback callback);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSPageState>;
++
++  struct Waiter {
++    browser_os::PageLoadState state;
++    WaitCallback callback;
++    base::OneShotTimer timeout_timer;
++  };
++
++  explicit BrowserOSPageState(content::WebContents* web_contents);
++
++  // content::WebContentsObserver:
++  void DidStartLoading() override;
++  void DOMContentLoaded(content::RenderFrameHost* render_frame_host) override;
++  void DocumentOnLoadCompletedInPrimaryMainFrame() override;
++  void DidStopLoading() override;
++  void ResourceLoadComplete(
++      content::RenderFrameHost* render_frame_host,
++      const content::GlobalRequestID& request_id,
++      const blink::mojom::ResourceLoadInfo& resource_load_info) override;
++  void WebContentsDestroyed() override;
++
++  // Restarts the network idle window
++  void OnNetworkActivity();
++  void OnNetworkIdleTimer();
++
++  // Fires onPageStateChanged and resolves the waiters |state| satisfies
++  void OnStateChanged(browser_os::PageLoadState state);
++  void OnWaitTimeout(Waiter* waiter);
++
++  // Removes |waiter| and runs its callback with |result|
++  void FinishWaiter(Waiter* waiter, WaitResult result);
++
++  std::vector<std::unique_ptr<Waiter>> waiters_;
++
++  base::TimeTicks last_network_activity_;
++  base::OneShotTimer network_idle_timer_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PAGE_STATE_H_
@@ -0,0 +1,177 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_prefs.cc b/chrome/browser/extensions/api/browser_os/browser_os_prefs.cc
+new file mode 100644
+index 0000000000000..98d72c9029b3d
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_prefs.cc
+@@ -0,0 +1,171 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_prefs.h"
++
++#include <memory>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "chrome/browser/browser_process.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/prefs/pref_service.h"
++#include "extensions/browser/event_router_factory.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr char kBrowserOSPrefPrefix[] = "browseros.";
++
++std::string GetPrefTypeName(const base::Value* value) {
++  switch (value->type()) {
++    case base::Value::Type::BOOLEAN:
++      return "boolean";
++    case base::Value::Type::INTEGER:
++    case base::Value::Type::DOUBLE:
++      return "number";
++    case base::Value::Type::STRING:
++      return "string";
++    case base::Value::Type::LIST:
++      return "list";
++    case base::Value::Type::DICT:
++      return "dictionary";
++    default:
++      return "unknown";
++  }
++}
++
++// Merges the "browseros" subtree of |prefs| into |combined|
++void MergeBrowserOSPrefs(PrefService* prefs, base::Value::Dict& combined) {
++  if (!prefs) {
++    return;
++  }
++  base::Value::Dict pref_dict =
++      prefs->GetPreferenceValues(PrefService::INCLUDE_DEFAULTS);
++  if (base::Value::Dict* browseros = pref_dict.FindDict("browseros")) {
++    combined.Merge(std::move(*browseros));
++  }
++}
++
++}  // namespace
++
++browser_os::PrefObject BuildPrefObject(PrefService* prefs,
++                                       const std::string& name) {
++  const base::Value* value = prefs->GetUserPrefValue(name);
++  if (!value) {
++    value = prefs->GetDefaultPrefValue(name);
++  }
++
++  browser_os::PrefObject pref;
++  pref.key = name;
++  pref.type = GetPrefTypeName(value);
++  pref.value = value->Clone();
++  return pref;
++}
++
++BrowserOSPrefsAPI::BrowserOSPrefsAPI(content::BrowserContext* context)
++    : browser_context_(context) {
++  EventRouter::Get(browser_context_)
++      ->RegisterObserver(this, browser_os::OnPrefChanged::kEventName);
++}
++
++BrowserOSPrefsAPI::~BrowserOSPrefsAPI() = default;
++
++// static
++BrowserContextKeyedAPIFactory<BrowserOSPrefsAPI>*
++BrowserOSPrefsAPI::GetFactoryInstance() {
++  static base::NoDestructor<BrowserContextKeyedAPIFactory<BrowserOSPrefsAPI>>
++      instance;
++  return instance.get();
++}
++
++// static
++BrowserOSPrefsAPI* BrowserOSPrefsAPI::Get(content::BrowserContext* context) {
++  return BrowserContextKeyedAPIFactory<BrowserOSPrefsAPI>::Get(context);
++}
++
++const base::Value::Dict& BrowserOSPrefsAPI::GetAllPrefs() {
++  StartWatching();
++  if (!cached_prefs_) {
++    base::Value::Dict combined;
++    MergeBrowserOSPrefs(g_browser_process->local_state(), combined);
++    MergeBrowserOSPrefs(Profile::FromBrowserContext(browser_context_)
++                            ->GetPrefs(),
++                        combined);
++    cached_prefs_ = std::move(combined);
++  }
++  return *cached_prefs_;
++}
++
++void BrowserOSPrefsAPI::Shutdown() {
++  EventRouter::Get(browser_context_)->UnregisterObserver(this);
++  profile_registrar_.RemoveAll();
++  local_state_registrar_.RemoveAll();
++  watching_ = false;
++  cached_prefs_.reset();
++}
++
++void BrowserOSPrefsAPI::OnListenerAdded(const EventListenerInfo& details) {
++  StartWatching();
++}
++
++void BrowserOSPrefsAPI::StartWatching() {
++  if (watching_) {
++    return;
++  }
++  watching_ = true;
++  WatchPrefs(g_browser_process->local_state(), local_state_registrar_);
++  WatchPrefs(Profile::FromBrowserContext(browser_context_)->GetPrefs(),
++             profile_registrar_);
++  VLOG(1) << "[browseros] Watching browseros.* prefs";
++}
++
++void BrowserOSPrefsAPI::WatchPrefs(PrefService* prefs,
++                                   PrefChangeRegistrar& registrar) {
++  if (!prefs) {
++    return;
++  }
++  registrar.Init(prefs);
++  prefs->IteratePreferenceValues(base::BindRepeating(
++      [](BrowserOSPrefsAPI* api, PrefService* prefs,
++         PrefChangeRegistrar* registrar, const std::string& name,
++         const base::Value&) {
++        if (name.starts_with(kBrowserOSPrefPrefix)) {
++          registrar->Add(name,
++                         base::BindRepeating(&BrowserOSPrefsAPI::OnPrefChanged,
++                                             base::Unretained(api), prefs));
++        }
++      },
++      base::Unretained(this), base::Unretained(prefs),
++      base::Unretained(&registrar)));
++}
++
++void BrowserOSPrefsAPI::OnPrefChanged(PrefService* prefs,
++                                      const std::string& name) {
++  cached_prefs_.reset();
++
++  EventRouter* event_router = EventRouter::Get(browser_context_);
++  if (!event_router->HasEventListener(browser_os::OnPrefChanged::kEventName)) {
++    return;
++  }
++  auto event = std::make_unique<Event>(
++      events::UNKNOWN, browser_os::OnPrefChanged::kEventName,
++      browser_os::OnPrefChanged::Create(BuildPrefObject(prefs, name)),
++      browser_context_);
++  event_router->BroadcastEvent(std::move(event));
++}
++
++}  // namespace api
++
++template <>
++void BrowserContextKeyedAPIFactory<
++    api::BrowserOSPrefsAPI>::DeclareFactoryDependencies() {
++  DependsOn(EventRouterFactory::GetInstance());
++}
++
++}  // namespace extensions
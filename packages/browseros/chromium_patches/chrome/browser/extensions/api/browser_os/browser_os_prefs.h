@@ -0,0 +1,96 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_prefs.h b/chrome/browser/extensions/api/browser_os/browser_os_prefs.h
+new file mode 100644
+index 0000000000000..5e00699f4b3f5
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_prefs.h
+@@ -0,0 +1,90 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PREFS_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PREFS_H_
++
++#include <optional>
++#include <string>
++
++#include "base/memory/raw_ptr.h"
++#include "base/values.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "components/prefs/pref_change_registrar.h"
++#include "extensions/browser/browser_context_keyed_api_factory.h"
++#include "extensions/browser/event_router.h"
++
++class PrefService;
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Builds the PrefObject reported for |name|: its user value in |prefs|, or
++// its default
++browser_os::PrefObject BuildPrefObject(PrefService* prefs,
++                                       const std::string& name);
++
++// Watches the browseros.* prefs of a profile and of Local State, so the
++// agent extension is pushed changes through browserOS.onPrefChanged rather
++// than polling getAllPrefs. Also caches the merged dictionary getAllPrefs
++// returns until one of the prefs changes.
++//
++// Watching starts with the first onPrefChanged listener or getAllPrefs call;
++// until then the service costs nothing.
++class BrowserOSPrefsAPI : public BrowserContextKeyedAPI,
++                          public EventRouter::Observer {
++ public:
++  explicit BrowserOSPrefsAPI(content::BrowserContext* context);
++  ~BrowserOSPrefsAPI() override;
++
++  BrowserOSPrefsAPI(const BrowserOSPrefsAPI&) = delete;
++  BrowserOSPrefsAPI& operator=(const BrowserOSPrefsAPI&) = delete;
++
++  static BrowserContextKeyedAPIFactory<BrowserOSPrefsAPI>*
++  GetFactoryInstance();
++  static BrowserOSPrefsAPI* Get(content::BrowserContext* context);
++
++  // Every browseros.* pref as one nested dictionary, Local State values
++  // overridden by the profile's
++  const base::Value::Dict& GetAllPrefs();
++
++  // KeyedService:
++  void Shutdown() override;
++
++  // EventRouter::Observer:
++  void OnListenerAdded(const EventListenerInfo& details) override;
++
++ private:
++  friend class BrowserContextKeyedAPIFactory<BrowserOSPrefsAPI>;
++
++  // BrowserContextKeyedAPI:
++  static const char* service_name() { return "BrowserOSPrefsAPI"; }
++  static const bool kServiceIsNULLWhileTesting = true;
++  static const bool kServiceRedirectedInIncognito = true;
++
++  // Registers every browseros.* pref with the registrars, once
++  void StartWatching();
++  void WatchPrefs(PrefService* prefs, PrefChangeRegistrar& registrar);
++  void OnPrefChanged(PrefService* prefs, const std::string& name);
++
++  raw_ptr<content::BrowserContext> browser_context_;
++  PrefChangeRegistrar profile_registrar_;
++  PrefChangeRegistrar local_state_registrar_;
++  bool watching_ = false;
++  std::optional<base::Value::Dict> cached_prefs_;
++};
++
++}  // namespace api
++
++template <>
++void BrowserContextKeyedAPIFactory<
++    api::BrowserOSPrefsAPI>::DeclareFactoryDependencies();
++
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PREFS_H_
@@ -0,0 +1,243 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_prune_rules.cc b/chrome/browser/extensions/api/browser_os/browser_os_prune_rules.cc
+new file mode 100644
+index 0000000000000..aa68e6fd10961
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_prune_rules.cc
+@@ -0,0 +1,237 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_prune_rules.h"
++
++#include <optional>
++#include <string_view>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "chrome/browser/browseros/core/browseros_prefs.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/prefs/pref_service.h"
++#include "third_party/re2/src/re2/re2.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "url/gurl.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Hosts compiled beyond this are dropped wholesale
++constexpr size_t kMaxCachedPruneHosts = 128;
++
++size_t RoleIndex(ax::mojom::Role role) {
++  return static_cast<size_t>(role);
++}
++
++// Compiles a case-insensitive pattern, or returns null and logs why
++std::unique_ptr<re2::RE2> CompilePattern(const std::string& pattern) {
++  re2::RE2::Options options;
++  options.set_case_sensitive(false);
++  options.set_log_errors(false);
++  auto re = std::make_unique<re2::RE2>(pattern, options);
++  if (!re->ok()) {
++    LOG(WARNING) << "[browseros] Skipping prune rule with invalid pattern '"
++                 << pattern << "': " << re->error();
++    return nullptr;
++  }
++  return re;
++}
++
++bool MatchesPattern(const re2::RE2* pattern,
++                    const ui::AXNodeData& node,
++                    ax::mojom::StringAttribute attribute) {
++  return !pattern ||
++         re2::RE2::PartialMatch(node.GetStringAttribute(attribute), *pattern);
++}
++
++}  // namespace
++
++// SnapshotPruneMatcher implementation
++
++SnapshotPruneMatcher::Rule::Rule() = default;
++SnapshotPruneMatcher::Rule::Rule(Rule&&) = default;
++SnapshotPruneMatcher::Rule& SnapshotPruneMatcher::Rule::operator=(Rule&&) =
++    default;
++SnapshotPruneMatcher::Rule::~Rule() = default;
++
++SnapshotPruneMatcher::SnapshotPruneMatcher() = default;
++SnapshotPruneMatcher::~SnapshotPruneMatcher() = default;
++
++// static
++scoped_refptr<const SnapshotPruneMatcher> SnapshotPruneMatcher::Compile(
++    const std::vector<const base::Value::List*>& rules) {
++  auto matcher = base::WrapRefCounted(new SnapshotPruneMatcher());
++  for (const base::Value::List* list : rules) {
++    size_t count = 0;
++    for (const base::Value& value : *list) {
++      if (++count > kMaxPruneRulesPerHost) {
++        LOG(WARNING) << "[browseros] Only the first " << kMaxPruneRulesPerHost
++                     << " prune rules of a site are used";
++        break;
++      }
++      const base::Value::Dict* dict = value.GetIfDict();
++      if (!dict) {
++        continue;
++      }
++      const std::string* role_name = dict->FindString("role");
++      const std::string* name = dict->FindString("name");
++      const std::string* html_id = dict->FindString("htmlId");
++      if (!role_name && !name && !html_id) {
++        continue;
++      }
++
++      Rule rule;
++      if (role_name) {
++        std::optional<ax::mojom::Role> role =
++            ui::MaybeParseAXEnum<ax::mojom::Role>(role_name->c_str());
++        if (!role || *role == ax::mojom::Role::kNone) {
++          LOG(WARNING) << "[browseros] Skipping prune rule with unknown role '"
++                       << *role_name << "'";
++          continue;
++        }
++        rule.roles.set(RoleIndex(*role));
++      }
++      if (name) {
++        rule.name = CompilePattern(*name);
++        if (!rule.name) {
++          continue;
++        }
++      }
++      if (html_id) {
++        rule.html_id = CompilePattern(*html_id);
++        if (!rule.html_id) {
++          continue;
++        }
++      }
++
++      if (!rule.name && !rule.html_id) {
++        matcher->pruned_roles_ |= rule.roles;
++        matcher->role_only_count_++;
++        continue;
++      }
++      if (rule.roles.none()) {
++        matcher->has_any_role_patterns_ = true;
++      }
++      matcher->pattern_roles_ |= rule.roles;
++      matcher->rules_.push_back(std::move(rule));
++    }
++  }
++
++  if (matcher->rule_count() == 0) {
++    return nullptr;
++  }
++  return matcher;
++}
++
++bool SnapshotPruneMatcher::Matches(const ui::AXNodeData& node) const {
++  const size_t role = RoleIndex(node.role);
++  if (pruned_roles_.test(role)) {
++    return true;
++  }
++  if (!has_any_role_patterns_ && !pattern_roles_.test(role)) {
++    return false;
++  }
++  for (const Rule& rule : rules_) {
++    if (rule.roles.any() && !rule.roles.test(role)) {
++      continue;
++    }
++    if (MatchesPattern(rule.name.get(), node,
++                       ax::mojom::StringAttribute::kName) &&
++        MatchesPattern(rule.html_id.get(), node,
++                       ax::mojom::StringAttribute::kHtmlId)) {
++      return true;
++    }
++  }
++  return false;
++}
++
++// BrowserOSPruneRules implementation
++
++BrowserOSPruneRules::BrowserOSPruneRules(content::BrowserContext* context) {
++  registrar_.Init(Profile::FromBrowserContext(context)->GetPrefs());
++  // Unretained: the registrar goes away with the service
++  registrar_.Add(browseros::prefs::kSnapshotPruneRules,
++                 base::BindRepeating(&BrowserOSPruneRules::OnRulesChanged,
++                                     base::Unretained(this)));
++}
++
++BrowserOSPruneRules::~BrowserOSPruneRules() = default;
++
++// static
++BrowserContextKeyedAPIFactory<BrowserOSPruneRules>*
++BrowserOSPruneRules::GetFactoryInstance() {
++  static base::NoDestructor<BrowserContextKeyedAPIFactory<BrowserOSPruneRules>>
++      instance;
++  return instance.get();
++}
++
++// static
++BrowserOSPruneRules* BrowserOSPruneRules::Get(
++    content::BrowserContext* context) {
++  return BrowserContextKeyedAPIFactory<BrowserOSPruneRules>::Get(context);
++}
++
++scoped_refptr<const SnapshotPruneMatcher> BrowserOSPruneRules::ForUrl(
++    const GURL& url) {
++  if (!url.SchemeIsHTTPOrHTTPS()) {
++    return nullptr;
++  }
++  const base::Value::Dict& sites =
++      registrar_.prefs()->GetDict(browseros::prefs::kSnapshotPruneRules);
++  if (sites.empty()) {
++    return nullptr;
++  }
++
++  const std::string host = url.host();
++  auto it = matchers_.find(host);
++  if (it != matchers_.end()) {
++    return it->second;
++  }
++
++  // The host's own rules, those of its parent domains, then the global ones
++  std::vector<const base::Value::List*> rules;
++  std::string_view domain = host;
++  while (!domain.empty()) {
++    if (const base::Value::List* list = sites.FindList(domain)) {
++      rules.push_back(list);
++    }
++    const size_t dot = domain.find('.');
++    domain = dot == std::string_view::npos ? std::string_view()
++                                           : domain.substr(dot + 1);
++  }
++  if (const base::Value::List* list = sites.FindList(kPruneAnyHost)) {
++    rules.push_back(list);
++  }
++
++  scoped_refptr<const SnapshotPruneMatcher> matcher =
++      rules.empty() ? nullptr : SnapshotPruneMatcher::Compile(rules);
++  if (matcher) {
++    VLOG(1) << "[browseros] Compiled " << matcher->rule_count()
++            << " prune rule(s) for " << host;
++  }
++  if (matchers_.size() >= kMaxCachedPruneHosts) {
++    matchers_.clear();
++  }
++  matchers_.emplace(host, matcher);
++  return matcher;
++}
++
++void BrowserOSPruneRules::Shutdown() {
++  registrar_.RemoveAll();
++  matchers_.clear();
++}
++
++void BrowserOSPruneRules::OnRulesChanged() {
++  matchers_.clear();
++}
++
++}  // namespace api
++}  // namespace extensions
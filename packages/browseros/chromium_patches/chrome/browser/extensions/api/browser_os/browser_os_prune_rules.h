@@ -0,0 +1,146 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_prune_rules.h b/chrome/browser/extensions/api/browser_os/browser_os_prune_rules.h
+new file mode 100644
+index 0000000000000..b0aeb5f5261f1
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_prune_rules.h
+@@ -0,0 +1,140 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PRUNE_RULES_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PRUNE_RULES_H_
++
++#include <bitset>
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/containers/flat_map.h"
++#include "base/memory/ref_counted.h"
++#include "base/values.h"
++#include "components/prefs/pref_change_registrar.h"
++#include "extensions/browser/browser_context_keyed_api_factory.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++
++class GURL;
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace re2 {
++class RE2;
++}  // namespace re2
++
++namespace ui {
++struct AXNodeData;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Site-specific snapshot pruning, for pages whose ad iframes, mega-menus or
++// tracking widgets would otherwise fill every snapshot. Rules are kept in
++// the profile under browseros::prefs::kSnapshotPruneRules, keyed by host:
++//
++//   {"example.com": [{"role": "iframe"},
++//                    {"name": "^Sponsored", "htmlId": "^ad-"}],
++//    "*": [...]}
++//
++// A key applies to its host and the subdomains of it, "*" to every site.
++// A rule matches a node when all its fields do: "role" the role name, as
++// ui::ToString() spells it, "name" and "htmlId" case-insensitive RE2
++// patterns searched in the node's name and html id. A matching node is
++// left out of the snapshot with its whole subtree.
++inline constexpr char kPruneAnyHost[] = "*";
++inline constexpr size_t kMaxPruneRulesPerHost = 64;
++
++// The rules of one site, compiled once and then matched from any thread
++class SnapshotPruneMatcher
++    : public base::RefCountedThreadSafe<SnapshotPruneMatcher> {
++ public:
++  // Compiles |rules|. Rules with an unknown role, an invalid pattern or no
++  // field at all are skipped with a warning. Returns null if none is left.
++  static scoped_refptr<const SnapshotPruneMatcher> Compile(
++      const std::vector<const base::Value::List*>& rules);
++
++  SnapshotPruneMatcher(const SnapshotPruneMatcher&) = delete;
++  SnapshotPruneMatcher& operator=(const SnapshotPruneMatcher&) = delete;
++
++  bool Matches(const ui::AXNodeData& node) const;
++
++  size_t rule_count() const { return role_only_count_ + rules_.size(); }
++
++ private:
++  friend class base::RefCountedThreadSafe<SnapshotPruneMatcher>;
++
++  using RoleSet =
++      std::bitset<static_cast<size_t>(ax::mojom::Role::kMaxValue) + 1>;
++
++  struct Rule {
++    Rule();
++    Rule(Rule&&);
++    Rule& operator=(Rule&&);
++    ~Rule();
++
++    // Any role when empty
++    RoleSet roles;
++    std::unique_ptr<re2::RE2> name;
++    std::unique_ptr<re2::RE2> html_id;
++  };
++
++  SnapshotPruneMatcher();
++  ~SnapshotPruneMatcher();
++
++  // Roles pruned whatever the name and id, checked with one lookup before
++  // any pattern runs
++  RoleSet pruned_roles_;
++  size_t role_only_count_ = 0;
++  // The rules with patterns, with the roles of those that name one, so a
++  // node of another role skips every pattern
++  std::vector<Rule> rules_;
++  RoleSet pattern_roles_;
++  bool has_any_role_patterns_ = false;
++};
++
++// Compiles and caches the prune rules of a profile's sites. The cache is
++// dropped whenever the pref changes.
++class BrowserOSPruneRules : public BrowserContextKeyedAPI {
++ public:
++  explicit BrowserOSPruneRules(content::BrowserContext* context);
++  ~BrowserOSPruneRules() override;
++
++  BrowserOSPruneRules(const BrowserOSPruneRules&) = delete;
++  BrowserOSPruneRules& operator=(const BrowserOSPruneRules&) = delete;
++
++  static BrowserContextKeyedAPIFactory<BrowserOSPruneRules>*
++  GetFactoryInstance();
++  static BrowserOSPruneRules* Get(content::BrowserContext* context);
++
++  // The matcher for |url|'s host, or null if no rule applies to it
++  scoped_refptr<const SnapshotPruneMatcher> ForUrl(const GURL& url);
++
++  // KeyedService:
++  void Shutdown() override;
++
++ private:
++  friend class BrowserContextKeyedAPIFactory<BrowserOSPruneRules>;
++
++  // BrowserContextKeyedAPI:
++  static const char* service_name() { return "BrowserOSPruneRules"; }
++  static const bool kServiceIsNULLWhileTesting = true;
++  static const bool kServiceRedirectedInIncognito = true;
++
++  void OnRulesChanged();
++
++  PrefChangeRegistrar registrar_;
++  // Host -> its matcher, null for hosts without rules
++  base::flat_map<std::string, scoped_refptr<const SnapshotPruneMatcher>>
++      matchers_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_PRUNE_RULES_H_
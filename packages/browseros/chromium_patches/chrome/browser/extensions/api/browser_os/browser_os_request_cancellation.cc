@@ -0,0 +1,115 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.cc b/chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.cc
+new file mode 100644
+index 0000000000000..2f73e02bd4760
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.cc
+@@ -0,0 +1,109 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.h"
++
++
++#include "base/containers/flat_set.h"
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "content/public/browser/browser_thread.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Every live canceller, so a requestId can be looked up across tabs. UI
++// thread only.
++base::flat_set<BrowserOSRequestCanceller*>& GetCancellers() {
++  static base::NoDestructor<base::flat_set<BrowserOSRequestCanceller*>>
++      cancellers;
++  return *cancellers;
++}
++
++}  // namespace
++
++RequestCancellation::RequestCancellation() = default;
++RequestCancellation::~RequestCancellation() = default;
++
++BrowserOSRequestCanceller::BrowserOSRequestCanceller(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSRequestCanceller>(*web_contents) {
++  GetCancellers().insert(this);
++}
++
++BrowserOSRequestCanceller::~BrowserOSRequestCanceller() {
++  CancelAll("tab destroyed");
++  GetCancellers().erase(this);
++}
++
++// static
++scoped_refptr<RequestCancellation> BrowserOSRequestCanceller::Track(
++    content::WebContents* web_contents,
++    const std::string& request_id) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  CreateForWebContents(web_contents);
++  BrowserOSRequestCanceller* canceller = FromWebContents(web_contents);
++  canceller->PruneFinished();
++
++  auto cancellation = base::MakeRefCounted<RequestCancellation>();
++  canceller->requests_.emplace_back(request_id, cancellation);
++  return cancellation;
++}
++
++// static
++bool BrowserOSRequestCanceller::CancelRequest(const std::string& request_id) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  if (request_id.empty()) {
++    return false;
++  }
++
++  bool found = false;
++  for (BrowserOSRequestCanceller* canceller : GetCancellers()) {
++    canceller->PruneFinished();
++    for (const auto& [id, cancellation] : canceller->requests_) {
++      if (id == request_id) {
++        cancellation->Cancel();
++        found = true;
++      }
++    }
++  }
++  VLOG(1) << "[browseros] cancelRequest " << request_id
++          << (found ? "" : ": no request in flight");
++  return found;
++}
++
++void BrowserOSRequestCanceller::PrimaryPageChanged(content::Page& page) {
++  CancelAll("navigation");
++}
++
++void BrowserOSRequestCanceller::WebContentsDestroyed() {
++  CancelAll("tab closed");
++}
++
++void BrowserOSRequestCanceller::CancelAll(const char* reason) {
++  PruneFinished();
++  if (requests_.empty()) {
++    return;
++  }
++  VLOG(1) << "[browseros] Cancelling " << requests_.size()
++          << " request(s) in flight on " << reason;
++  for (const auto& [id, cancellation] : requests_) {
++    cancellation->Cancel();
++  }
++  requests_.clear();
++}
++
++void BrowserOSRequestCanceller::PruneFinished() {
++  std::erase_if(requests_, [](const auto& request) {
++    return request.second->HasOneRef();
++  });
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSRequestCanceller);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,102 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.h b/chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.h
+new file mode 100644
+index 0000000000000..62eab3bef0a6a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.h
+@@ -0,0 +1,96 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_REQUEST_CANCELLATION_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_REQUEST_CANCELLATION_H_
++
++#include <atomic>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/memory/ref_counted.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace extensions {
++namespace api {
++
++// Shared by a snapshot or screenshot request and the ThreadPool work done
++// for it. Set once the result is no longer wanted; workers check it between
++// node ranges and stages and stop early.
++class RequestCancellation
++    : public base::RefCountedThreadSafe<RequestCancellation> {
++ public:
++  RequestCancellation();
++
++  RequestCancellation(const RequestCancellation&) = delete;
++  RequestCancellation& operator=(const RequestCancellation&) = delete;
++
++  // Callable from any thread
++  void Cancel() { cancelled_.store(true, std::memory_order_relaxed); }
++  bool IsCancelled() const {
++    return cancelled_.load(std::memory_order_relaxed);
++  }
++
++ private:
++  friend class base::RefCountedThreadSafe<RequestCancellation>;
++  ~RequestCancellation();
++
++  std::atomic<bool> cancelled_{false};
++};
++
++// True if |cancellation| is set and was cancelled
++inline bool IsRequestCancelled(const RequestCancellation* cancellation) {
++  return cancellation && cancellation->IsCancelled();
++}
++
++// Tracks the snapshot and screenshot requests in flight for a tab, and
++// cancels them when the tab navigates to another page or is closed.
++// Requests started with a requestId can also be cancelled by the caller
++// through browserOS.cancelRequest.
++class BrowserOSRequestCanceller
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSRequestCanceller> {
++ public:
++  BrowserOSRequestCanceller(const BrowserOSRequestCanceller&) = delete;
++  BrowserOSRequestCanceller& operator=(const BrowserOSRequestCanceller&) =
++      delete;
++  ~BrowserOSRequestCanceller() override;
++
++  // Returns the cancellation of a new request on |web_contents|.
++  // |request_id| may be empty.
++  static scoped_refptr<RequestCancellation> Track(
++      content::WebContents* web_contents,
++      const std::string& request_id);
++
++  // Cancels every request in flight started with |request_id|, in any tab.
++  // Returns false if there was none.
++  static bool CancelRequest(const std::string& request_id);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSRequestCanceller>;
++
++  explicit BrowserOSRequestCanceller(content::WebContents* web_contents);
++
++  // content::WebContentsObserver:
++  void PrimaryPageChanged(content::Page& page) override;
++  void WebContentsDestroyed() override;
++
++  void CancelAll(const char* reason);
++
++  // Drops requests that have finished, i.e. only this list still refers to
++  void PruneFinished();
++
++  // Requests in flight with their requestId, possibly empty
++  std::vector<std::pair<std::string, scoped_refptr<RequestCancellation>>>
++      requests_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_REQUEST_CANCELLATION_H_
@@ -0,0 +1,67 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_request_priority.cc b/chrome/browser/extensions/api/browser_os/browser_os_request_priority.cc
+new file mode 100644
+index 0000000000000..fff07df5f535c
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_request_priority.cc
+@@ -0,0 +1,61 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_request_priority.h"
++
++namespace extensions {
++namespace api {
++
++base::TaskPriority GetTaskPriority(RequestLane lane) {
++  switch (lane) {
++    case RequestLane::kInteractive:
++      return base::TaskPriority::USER_VISIBLE;
++    case RequestLane::kBackground:
++      return base::TaskPriority::BEST_EFFORT;
++  }
++}
++
++std::optional<RequestLane> ToRequestLane(
++    browser_os::RequestPriority priority) {
++  switch (priority) {
++    case browser_os::RequestPriority::kNone:
++      return std::nullopt;
++    case browser_os::RequestPriority::kInteractive:
++      return RequestLane::kInteractive;
++    case browser_os::RequestPriority::kBackground:
++      return RequestLane::kBackground;
++  }
++}
++
++BrowserOSTabPriority::BrowserOSTabPriority(content::WebContents* web_contents)
++    : content::WebContentsUserData<BrowserOSTabPriority>(*web_contents) {}
++
++BrowserOSTabPriority::~BrowserOSTabPriority() = default;
++
++// static
++void BrowserOSTabPriority::SetLane(content::WebContents* web_contents,
++                                   RequestLane lane) {
++  CreateForWebContents(web_contents);
++  FromWebContents(web_contents)->lane_ = lane;
++}
++
++// static
++RequestLane BrowserOSTabPriority::ResolveLane(
++    content::WebContents* web_contents,
++    std::optional<RequestLane> requested) {
++  if (requested) {
++    return *requested;
++  }
++  if (web_contents) {
++    if (auto* tab_priority = FromWebContents(web_contents)) {
++      return tab_priority->lane_;
++    }
++  }
++  return RequestLane::kInteractive;
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSTabPriority);
++
++}  // namespace api
++}  // namespace extensions
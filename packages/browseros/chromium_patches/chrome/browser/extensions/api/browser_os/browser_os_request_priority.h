@@ -0,0 +1,66 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_request_priority.h b/chrome/browser/extensions/api/browser_os/browser_os_request_priority.h
+new file mode 100644
+index 0000000000000..a822d84ef26fc
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_request_priority.h
+@@ -0,0 +1,60 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_REQUEST_PRIORITY_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_REQUEST_PRIORITY_H_
++
++#include <optional>
++
++#include "base/task/task_traits.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace extensions {
++namespace api {
++
++// Lane a browserOS request runs in. Interactive requests come from an agent
++// a user is waiting on; background ones from crawls and batch work that can
++// yield to them.
++enum class RequestLane {
++  kInteractive,
++  kBackground,
++};
++
++// ThreadPool priority of the work done for a request in |lane|
++base::TaskPriority GetTaskPriority(RequestLane lane);
++
++// Returns nullopt for browser_os::RequestPriority::kNone
++std::optional<RequestLane> ToRequestLane(browser_os::RequestPriority priority);
++
++// Default lane of the requests on a tab, set through
++// browserOS.setTabPriority. Requests that name a priority in their options
++// override it.
++class BrowserOSTabPriority
++    : public content::WebContentsUserData<BrowserOSTabPriority> {
++ public:
++  BrowserOSTabPriority(const BrowserOSTabPriority&) = delete;
++  BrowserOSTabPriority& operator=(const BrowserOSTabPriority&) = delete;
++  ~BrowserOSTabPriority() override;
++
++  static void SetLane(content::WebContents* web_contents, RequestLane lane);
++
++  // |requested| if set, otherwise the tab's lane, otherwise interactive
++  static RequestLane ResolveLane(content::WebContents* web_contents,
++                                 std::optional<RequestLane> requested);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSTabPriority>;
++
++  explicit BrowserOSTabPriority(content::WebContents* web_contents);
++
++  RequestLane lane_ = RequestLane::kInteractive;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_REQUEST_PRIORITY_H_
@@ -0,0 +1,224 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_screencast.cc b/chrome/browser/extensions/api/browser_os/browser_os_screencast.cc
+new file mode 100644
+index 0000000000000..b4bac5c2cfe74
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_screencast.cc
+@@ -0,0 +1,218 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_screencast.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/memory/read_only_shared_memory_region.h"
++#include "base/task/thread_pool.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_widget_host_view.h"
++#include "content/public/browser/web_contents.h"
++#include "extensions/browser/event_router.h"
++#include "media/base/video_types.h"
++#include "media/capture/mojom/video_capture_buffer.mojom.h"
++#include "mojo/public/cpp/bindings/remote.h"
++#include "third_party/skia/include/core/SkBitmap.h"
++#include "third_party/skia/include/core/SkPixmap.h"
++#include "ui/gfx/codec/jpeg_codec.h"
++#include "ui/gfx/geometry/skia_conversions.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Frames sent without an ackScreencastFrame before new ones are dropped
++constexpr int kMaxUnackedFrames = 2;
++
++}  // namespace
++
++// static
++void BrowserOSScreencast::Start(content::WebContents* web_contents,
++                                Config config) {
++  // Drop any running screencast first so its capturer is torn down
++  Stop(web_contents);
++  CreateForWebContents(web_contents, std::move(config));
++}
++
++// static
++void BrowserOSScreencast::Stop(content::WebContents* web_contents) {
++  web_contents->RemoveUserData(UserDataKey());
++}
++
++BrowserOSScreencast::BrowserOSScreencast(content::WebContents* web_contents,
++                                         Config config)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSScreencast>(*web_contents),
++      config_(std::move(config)),
++      start_time_(base::TimeTicks::Now()) {
++  LOG(INFO) << "[browseros] Screencast started for tab "
++            << ExtensionTabUtil::GetTabId(web_contents) << " at up to "
++            << config_.max_size.ToString();
++  StartCapturer();
++}
++
++BrowserOSScreencast::~BrowserOSScreencast() {
++  if (capturer_) {
++    capturer_->Stop();
++  }
++
++  LOG(INFO) << "[browseros] Screencast stopped after " << frames_sent_
++            << " frames (" << frames_dropped_ << " dropped)";
++  browseros_metrics::BrowserOSMetrics::Log(
++      "screencast.stopped",
++      {{"frames_sent", base::Value(frames_sent_)},
++       {"frames_dropped", base::Value(frames_dropped_)},
++       {"duration_s",
++        base::Value(static_cast<int>(
++            (base::TimeTicks::Now() - start_time_).InSeconds()))}});
++}
++
++void BrowserOSScreencast::Ack(int frame_number) {
++  last_acked_frame_ = std::max(last_acked_frame_, frame_number);
++}
++
++void BrowserOSScreencast::StartCapturer() {
++  if (capturer_) {
++    capturer_->Stop();
++    capturer_.reset();
++  }
++
++  content::RenderWidgetHostView* view =
++      web_contents()->GetRenderWidgetHostView();
++  if (!view) {
++    LOG(WARNING) << "[browseros] Screencast: No view to capture yet";
++    return;
++  }
++
++  capturer_ = view->CreateVideoCapturer();
++  capturer_->SetFormat(media::PIXEL_FORMAT_ARGB);
++  capturer_->SetMinCapturePeriod(config_.min_frame_interval);
++  capturer_->SetMinSizeChangePeriod(base::TimeDelta());
++  capturer_->SetResolutionConstraints(gfx::Size(1, 1), config_.max_size,
++                                      /*use_fixed_aspect_ratio=*/true);
++  // Refresh only on damage; a static page produces no frames
++  capturer_->SetAutoThrottlingEnabled(false);
++  capturer_->Start(this, viz::mojom::BufferFormatPreference::kDefault);
++}
++
++void BrowserOSScreencast::RenderFrameHostChanged(
++    content::RenderFrameHost* old_host,
++    content::RenderFrameHost* new_host) {
++  // A cross-process navigation swaps the view the capturer is attached to
++  if (new_host && new_host->IsInPrimaryMainFrame()) {
++    StartCapturer();
++  }
++}
++
++void BrowserOSScreencast::OnFrameCaptured(
++    media::mojom::VideoBufferHandlePtr data,
++    media::mojom::VideoFrameInfoPtr info,
++    const gfx::Rect& content_rect,
++    mojo::PendingRemote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
++        callbacks) {
++  mojo::Remote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
++      callbacks_remote(std::move(callbacks));
++
++  // Backpressure: never queue frames behind a slow encoder or consumer
++  if (encoding_ || last_sent_frame_ - last_acked_frame_ >= kMaxUnackedFrames) {
++    frames_dropped_++;
++    callbacks_remote->Done();
++    return;
++  }
++
++  if (!data->is_read_only_shmem_region() ||
++      info->pixel_format != media::PIXEL_FORMAT_ARGB) {
++    callbacks_remote->Done();
++    return;
++  }
++  base::ReadOnlySharedMemoryMapping mapping =
++      data->get_read_only_shmem_region().Map();
++  if (!mapping.IsValid()) {
++    callbacks_remote->Done();
++    return;
++  }
++  base::span<const uint8_t> pixels = mapping.GetMemoryAsSpan<uint8_t>();
++
++  // Copy the visible part out so the capture buffer goes straight back to
++  // the pool
++  const SkImageInfo coded_info = SkImageInfo::Make(
++      info->coded_size.width(), info->coded_size.height(),
++      kBGRA_8888_SkColorType, kPremul_SkAlphaType);
++  SkPixmap coded(coded_info, pixels.data(), coded_info.minRowBytes());
++  SkPixmap visible;
++  SkBitmap bitmap;
++  if (coded.computeByteSize() > pixels.size() ||
++      !coded.extractSubset(&visible, gfx::RectToSkIRect(content_rect)) ||
++      !bitmap.tryAllocPixels(visible.info()) ||
++      !bitmap.writePixels(visible, 0, 0)) {
++    callbacks_remote->Done();
++    return;
++  }
++  callbacks_remote->Done();
++  bitmap.setImmutable();
++
++  encoding_ = true;
++  const int width = bitmap.width();
++  const int height = bitmap.height();
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::TaskPriority::USER_VISIBLE,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(
++          [](const SkBitmap& bitmap, int quality) {
++            return gfx::JPEGCodec::Encode(bitmap, quality);
++          },
++          std::move(bitmap), config_.quality),
++      base::BindOnce(&BrowserOSScreencast::OnFrameEncoded,
++                     weak_factory_.GetWeakPtr(), width, height,
++                     base::Time::Now()));
++}
++
++void BrowserOSScreencast::OnFrameEncoded(
++    int width,
++    int height,
++    base::Time capture_time,
++    std::optional<std::vector<uint8_t>> jpeg) {
++  encoding_ = false;
++  if (!jpeg) {
++    return;
++  }
++
++  EventRouter* event_router =
++      EventRouter::Get(web_contents()->GetBrowserContext());
++  if (!event_router) {
++    return;
++  }
++
++  browser_os::ScreencastFrame frame;
++  frame.tab_id = ExtensionTabUtil::GetTabId(web_contents());
++  frame.frame_number = ++last_sent_frame_;
++  frame.data = std::move(*jpeg);
++  frame.width = width;
++  frame.height = height;
++  frame.timestamp = capture_time.InMillisecondsFSinceUnixEpoch();
++  frames_sent_++;
++
++  auto event = std::make_unique<Event>(
++      events::UNKNOWN, browser_os::OnScreencastFrame::kEventName,
++      browser_os::OnScreencastFrame::Create(frame),
++      web_contents()->GetBrowserContext());
++  event_router->DispatchEventToExtension(config_.extension_id,
++                                         std::move(event));
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSScreencast);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,111 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_screencast.h b/chrome/browser/extensions/api/browser_os/browser_os_screencast.h
+new file mode 100644
+index 0000000000000..f08c302467289
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_screencast.h
+@@ -0,0 +1,105 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENCAST_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENCAST_H_
++
++#include <cstdint>
++#include <memory>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "components/viz/host/client_frame_sink_video_capturer.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "services/viz/privileged/mojom/compositing/frame_sink_video_capture.mojom.h"
++#include "ui/gfx/geometry/size.h"
++
++namespace extensions {
++namespace api {
++
++// Pushes a tab's frames to the extension that started the screencast as
++// browserOS.onScreencastFrame events. Uses the compositor's frame sink video
++// capturer, the same path as DevTools screencasts: frames are only produced
++// on damage, at most once per |min_frame_interval|, and are downscaled on
++// the GPU. JPEG encoding runs on the ThreadPool.
++// Frames arriving while one is being encoded, or while kMaxUnackedFrames are
++// waiting for ackScreencastFrame, are dropped rather than queued.
++class BrowserOSScreencast
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSScreencast>,
++      public viz::mojom::FrameSinkVideoConsumer {
++ public:
++  struct Config {
++    std::string extension_id;
++    gfx::Size max_size;
++    int quality = 0;
++    base::TimeDelta min_frame_interval;
++  };
++
++  // Starts or restarts the screencast for |web_contents| with |config|
++  static void Start(content::WebContents* web_contents, Config config);
++
++  // Stops the screencast for |web_contents|, if any
++  static void Stop(content::WebContents* web_contents);
++
++  BrowserOSScreencast(const BrowserOSScreencast&) = delete;
++  BrowserOSScreencast& operator=(const BrowserOSScreencast&) = delete;
++  ~BrowserOSScreencast() override;
++
++  // Marks every frame up to |frame_number| as consumed
++  void Ack(int frame_number);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSScreencast>;
++
++  BrowserOSScreencast(content::WebContents* web_contents, Config config);
++
++  // (Re)creates the capturer on the tab's current view
++  void StartCapturer();
++
++  void OnFrameEncoded(int width,
++                      int height,
++                      base::Time capture_time,
++                      std::optional<std::vector<uint8_t>> jpeg);
++
++  // content::WebContentsObserver:
++  void RenderFrameHostChanged(content::RenderFrameHost* old_host,
++                              content::RenderFrameHost* new_host) override;
++
++  // viz::mojom::FrameSinkVideoConsumer:
++  void OnFrameCaptured(
++      media::mojom::VideoBufferHandlePtr data,
++      media::mojom::VideoFrameInfoPtr info,
++      const gfx::Rect& content_rect,
++      mojo::PendingRemote<viz::mojom::FrameSinkVideoConsumerFrameCallbacks>
++          callbacks) override;
++  void OnNewSubCaptureTargetVersion(
++      uint32_t sub_capture_target_version) override {}
++  void OnFrameWithEmptyRegionCapture() override {}
++  void OnStopped() override {}
++  void OnLog(const std::string& message) override {}
++
++  const Config config_;
++  std::unique_ptr<viz::ClientFrameSinkVideoCapturer> capturer_;
++
++  bool encoding_ = false;
++  int last_sent_frame_ = 0;
++  int last_acked_frame_ = 0;
++  int frames_sent_ = 0;
++  int frames_dropped_ = 0;
++  base::TimeTicks start_time_;
++
++  base::WeakPtrFactory<BrowserOSScreencast> weak_factory_{this};
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENCAST_H_
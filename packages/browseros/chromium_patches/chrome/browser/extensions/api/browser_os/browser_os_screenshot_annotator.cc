@@ -0,0 +1,174 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.cc b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.cc
+new file mode 100644
+index 0000000000000..424a6425583c6
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.cc
+@@ -0,0 +1,168 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.h"
++
++#include <algorithm>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/strings/string_number_conversions.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "skia/ext/font_utils.h"
++#include "third_party/skia/include/core/SkCanvas.h"
++#include "third_party/skia/include/core/SkColor.h"
++#include "third_party/skia/include/core/SkFont.h"
++#include "third_party/skia/include/core/SkPaint.h"
++#include "third_party/skia/include/core/SkPathBuilder.h"
++#include "third_party/skia/include/core/SkRRect.h"
++#include "third_party/skia/include/core/SkRect.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Same look as the page overlay this replaces
++constexpr SkColor kBoxColor = SkColorSetRGB(0x1E, 0x40, 0xAF);
++constexpr SkColor kLabelColor = SkColorSetARGB(0xE6, 0x25, 0x63, 0xEB);
++constexpr float kBoxStrokeWidth = 2.0f;
++constexpr float kLabelFontSize = 14.0f;
++constexpr float kLabelPaddingX = 7.0f;
++constexpr float kLabelPaddingY = 3.0f;
++constexpr float kLabelCornerRadius = 3.0f;
++// Keeps labels readable on small thumbnails
++constexpr float kMinLabelFontSize = 9.0f;
++
++}  // namespace
++
++std::vector<ScreenshotHighlight> CollectScreenshotHighlights(
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings) {
++  std::vector<ScreenshotHighlight> highlights;
++  for (const auto& [node_id, node_info] : node_mappings) {
++    if (!node_info.in_viewport || node_info.bounds.IsEmpty()) {
++      continue;
++    }
++    if (node_info.node_type == browser_os::InteractiveNodeType::kClickable ||
++        node_info.node_type == browser_os::InteractiveNodeType::kTypeable ||
++        node_info.node_type == browser_os::InteractiveNodeType::kSelectable) {
++      highlights.push_back({node_id, node_info.bounds});
++    }
++  }
++  // Map order changes as mappings are rebuilt. A fixed order keeps the
++  // screenshot cache key of an unchanged page stable, and the labels that
++  // overlap stacked the same way from one capture to the next.
++  std::sort(highlights.begin(), highlights.end(),
++            [](const ScreenshotHighlight& a, const ScreenshotHighlight& b) {
++              return a.node_id < b.node_id;
++            });
++  return highlights;
++}
++
++SkBitmap DrawScreenshotHighlights(
++    const SkBitmap& bitmap,
++    const std::vector<ScreenshotHighlight>& highlights,
++    const gfx::Vector2dF& css_to_bitmap) {
++  // The captured bitmap may be immutable; draw into a copy
++  SkBitmap annotated;
++  if (!annotated.tryAllocPixels(bitmap.info()) ||
++      !bitmap.readPixels(annotated.pixmap())) {
++    return bitmap;
++  }
++
++  SkCanvas canvas(annotated);
++
++  SkPaint box_paint;
++  box_paint.setStyle(SkPaint::kStroke_Style);
++  box_paint.setStrokeWidth(kBoxStrokeWidth);
++  box_paint.setColor(kBoxColor);
++  box_paint.setAntiAlias(true);
++
++  SkPaint label_paint;
++  label_paint.setColor(kLabelColor);
++  label_paint.setAntiAlias(true);
++
++  SkPaint text_paint;
++  text_paint.setColor(SK_ColorWHITE);
++  text_paint.setAntiAlias(true);
++
++  const float label_scale = std::min(css_to_bitmap.x(), css_to_bitmap.y());
++  SkFont font = skia::DefaultFont();
++  font.setSize(std::max(kLabelFontSize * label_scale, kMinLabelFontSize));
++  SkFontMetrics metrics;
++  font.getMetrics(&metrics);
++  const float text_height = metrics.fDescent - metrics.fAscent;
++  const float padding_x = kLabelPaddingX * label_scale;
++  const float padding_y = kLabelPaddingY * label_scale;
++
++  // All boxes are stroked as one path, then the labels go on top so no box
++  // runs through a label
++  const SkRect bitmap_rect = SkRect::Make(annotated.dimensions());
++  std::vector<std::pair<uint32_t, SkRect>> boxes;
++  boxes.reserve(highlights.size());
++  SkPathBuilder box_path;
++  for (const auto& highlight : highlights) {
++    const SkRect box = SkRect::MakeXYWH(
++        highlight.bounds.x() * css_to_bitmap.x(),
++        highlight.bounds.y() * css_to_bitmap.y(),
++        highlight.bounds.width() * css_to_bitmap.x(),
++        highlight.bounds.height() * css_to_bitmap.y());
++    // Nodes in the viewport but out of a cropped capture
++    if (!SkRect::Intersects(box, bitmap_rect)) {
++      continue;
++    }
++    // Inset by half the stroke, like box-sizing: border-box
++    box_path.addRect(box.makeInset(kBoxStrokeWidth / 2, kBoxStrokeWidth / 2));
++    boxes.emplace_back(highlight.node_id, box);
++  }
++  canvas.drawPath(box_path.detach(), box_paint);
++
++  for (const auto& [node_id, box] : boxes) {
++    // Label above the box, or inside it at the top edge of the bitmap
++    const std::string label = base::NumberToString(node_id);
++    const float text_width =
++        font.measureText(label.data(), label.size(), SkTextEncoding::kUTF8);
++    const float label_height = text_height + 2 * padding_y;
++    const float label_top = std::max(box.top() - label_height, 0.0f);
++    const SkRect label_rect = SkRect::MakeXYWH(
++        box.left(), label_top, text_width + 2 * padding_x, label_height);
++    canvas.drawRRect(SkRRect::MakeRectXY(label_rect, kLabelCornerRadius,
++                                         kLabelCornerRadius),
++                     label_paint);
++    canvas.drawSimpleText(label.data(), label.size(), SkTextEncoding::kUTF8,
++                          label_rect.left() + padding_x,
++                          label_top + padding_y - metrics.fAscent, font,
++                          text_paint);
++  }
++
++  annotated.setImmutable();
++  return annotated;
++}
++
++gfx::Vector2d GetLetterboxOffset(const gfx::Size& content,
++                                 const gfx::Size& size) {
++  return gfx::Vector2d(std::max((size.width() - content.width()) / 2, 0),
++                       std::max((size.height() - content.height()) / 2, 0));
++}
++
++SkBitmap LetterboxScreenshot(const SkBitmap& bitmap, const gfx::Size& size) {
++  SkBitmap letterboxed;
++  if (!letterboxed.tryAllocPixels(
++          bitmap.info().makeWH(size.width(), size.height()))) {
++    return bitmap;
++  }
++  letterboxed.eraseColor(SK_ColorBLACK);
++
++  const gfx::Vector2d offset = GetLetterboxOffset(
++      gfx::Size(bitmap.width(), bitmap.height()), size);
++  if (!letterboxed.writePixels(bitmap.pixmap(), offset.x(), offset.y())) {
++    return bitmap;
++  }
++  letterboxed.setImmutable();
++  return letterboxed;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,64 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.h b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.h
+new file mode 100644
+index 0000000000000..3f792c7088be7
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.h
+@@ -0,0 +1,58 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_ANNOTATOR_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_ANNOTATOR_H_
++
++#include <cstdint>
++#include <unordered_map>
++#include <vector>
++
++#include "third_party/skia/include/core/SkBitmap.h"
++#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/size.h"
++#include "ui/gfx/geometry/vector2d.h"
++#include "ui/gfx/geometry/vector2d_f.h"
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++
++// One node box drawn onto a screenshot with showHighlights
++struct ScreenshotHighlight {
++  friend bool operator==(const ScreenshotHighlight&,
++                         const ScreenshotHighlight&) = default;
++
++  uint32_t node_id;
++  gfx::RectF bounds;  // CSS pixels, relative to the viewport
++};
++
++// Returns the in-viewport clickable, typeable and selectable nodes of
++// |node_mappings|, the ones showHighlights labels.
++std::vector<ScreenshotHighlight> CollectScreenshotHighlights(
++    const std::unordered_map<uint32_t, NodeInfo>& node_mappings);
++
++// Returns a copy of |bitmap| with a box and nodeId label drawn for each of
++// |highlights|. |css_to_bitmap| maps CSS pixels to bitmap pixels on each
++// axis. Touches no browser state, so it can run on the ThreadPool.
++SkBitmap DrawScreenshotHighlights(
++    const SkBitmap& bitmap,
++    const std::vector<ScreenshotHighlight>& highlights,
++    const gfx::Vector2dF& css_to_bitmap);
++
++// Where a |content| sized bitmap goes when letterboxed onto |size|: centered,
++// and at the origin on any axis it overflows
++gfx::Vector2d GetLetterboxOffset(const gfx::Size& content,
++                                 const gfx::Size& size);
++
++// Returns |bitmap| letterboxed onto a black bitmap of |size|. The pixels are
++// copied as they are, never resampled. Touches no browser state, so it can
++// run on the ThreadPool.
++SkBitmap LetterboxScreenshot(const SkBitmap& bitmap, const gfx::Size& size);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_ANNOTATOR_H_
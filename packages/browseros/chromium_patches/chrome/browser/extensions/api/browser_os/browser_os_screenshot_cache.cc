@@ -0,0 +1,60 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.cc b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.cc
+new file mode 100644
+index 0000000000000..382eaf697ebd3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.cc
+@@ -0,0 +1,54 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h"
++
++#include "base/hash/hash.h"
++#include "ui/gfx/skia_span_util.h"
++
++namespace extensions {
++namespace api {
++
++EncodedScreenshot::EncodedScreenshot() = default;
++EncodedScreenshot::EncodedScreenshot(const EncodedScreenshot&) = default;
++EncodedScreenshot& EncodedScreenshot::operator=(const EncodedScreenshot&) =
++    default;
++EncodedScreenshot::EncodedScreenshot(EncodedScreenshot&&) = default;
++EncodedScreenshot& EncodedScreenshot::operator=(EncodedScreenshot&&) = default;
++EncodedScreenshot::~EncodedScreenshot() = default;
++
++ScreenshotCacheKey::ScreenshotCacheKey() = default;
++ScreenshotCacheKey::ScreenshotCacheKey(const ScreenshotCacheKey&) = default;
++ScreenshotCacheKey& ScreenshotCacheKey::operator=(const ScreenshotCacheKey&) =
++    default;
++ScreenshotCacheKey::~ScreenshotCacheKey() = default;
++
++uint32_t HashScreenshotPixels(const SkBitmap& bitmap) {
++  return base::FastHash(gfx::SkPixmapToSpan(bitmap.pixmap()));
++}
++
++BrowserOSScreenshotCache::BrowserOSScreenshotCache(
++    content::WebContents* web_contents)
++    : content::WebContentsUserData<BrowserOSScreenshotCache>(*web_contents) {}
++
++BrowserOSScreenshotCache::~BrowserOSScreenshotCache() = default;
++
++std::optional<EncodedScreenshot> BrowserOSScreenshotCache::Lookup(
++    const ScreenshotCacheKey& key) const {
++  if (!key_ || *key_ != key) {
++    return std::nullopt;
++  }
++  return screenshot_;
++}
++
++void BrowserOSScreenshotCache::Store(const ScreenshotCacheKey& key,
++                                     const EncodedScreenshot& screenshot) {
++  key_ = key;
++  screenshot_ = screenshot;
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSScreenshotCache);
++
++}  // namespace api
++}  // namespace extensions
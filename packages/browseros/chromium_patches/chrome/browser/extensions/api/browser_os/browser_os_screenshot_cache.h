@@ -0,0 +1,108 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h
+new file mode 100644
+index 0000000000000..6db0b3bf5aafc
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h
+@@ -0,0 +1,102 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_CACHE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_CACHE_H_
++
++#include <cstdint>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_screenshot_annotator.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "third_party/skia/include/core/SkBitmap.h"
++#include "ui/gfx/geometry/size.h"
++#include "ui/gfx/geometry/vector2d_f.h"
++
++namespace extensions {
++namespace api {
++
++// Screenshot encoded off the UI thread by captureScreenshot and
++// captureScreenshotBinary
++struct EncodedScreenshot {
++  EncodedScreenshot();
++  EncodedScreenshot(const EncodedScreenshot&);
++  EncodedScreenshot& operator=(const EncodedScreenshot&);
++  EncodedScreenshot(EncodedScreenshot&&);
++  EncodedScreenshot& operator=(EncodedScreenshot&&);
++  ~EncodedScreenshot();
++
++  // Encoded image; moved into |data_url| when one was requested
++  std::vector<uint8_t> bytes;
++  std::string data_url;
++  std::string mime_type;
++  int width = 0;
++  int height = 0;
++};
++
++// Everything that determines the encoded output of a capture. The copied
++// pixels are identified by a hash, since the compositor does not expose a
++// frame token for the view's surface on the browser side.
++struct ScreenshotCacheKey {
++  ScreenshotCacheKey();
++  ScreenshotCacheKey(const ScreenshotCacheKey&);
++  ScreenshotCacheKey& operator=(const ScreenshotCacheKey&);
++  ~ScreenshotCacheKey();
++
++  friend bool operator==(const ScreenshotCacheKey&,
++                         const ScreenshotCacheKey&) = default;
++
++  uint32_t pixel_hash = 0;
++  int width = 0;
++  int height = 0;
++  // Letterboxed size of a contain fit
++  gfx::Size output_size;
++  std::vector<ScreenshotHighlight> highlights;
++  gfx::Vector2dF css_to_bitmap;
++  browser_os::ImageFormat format = browser_os::ImageFormat::kNone;
++  int quality = 0;
++  bool as_data_url = false;
++};
++
++// Hashes the pixels of |bitmap|. Touches no browser state, so it can run on
++// the ThreadPool.
++uint32_t HashScreenshotPixels(const SkBitmap& bitmap);
++
++// Remembers the last screenshot encoded for a tab, so that capturing an
++// unchanged page again, e.g. a retry or a plain screenshot followed by an
++// annotated one with the same options, skips annotating and encoding.
++// Holds one entry per tab and goes away with the tab.
++class BrowserOSScreenshotCache
++    : public content::WebContentsUserData<BrowserOSScreenshotCache> {
++ public:
++  BrowserOSScreenshotCache(const BrowserOSScreenshotCache&) = delete;
++  BrowserOSScreenshotCache& operator=(const BrowserOSScreenshotCache&) =
++      delete;
++  ~BrowserOSScreenshotCache() override;
++
++  // Returns the cached screenshot if it was encoded for |key|
++  std::optional<EncodedScreenshot> Lookup(const ScreenshotCacheKey& key) const;
++
++  // Replaces the cached screenshot
++  void Store(const ScreenshotCacheKey& key,
++             const EncodedScreenshot& screenshot);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSScreenshotCache>;
++
++  explicit BrowserOSScreenshotCache(content::WebContents* web_contents);
++
++  std::optional<ScreenshotCacheKey> key_;
++  EncodedScreenshot screenshot_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_CACHE_H_
@@ -0,0 +1,387 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_perftest.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_perftest.cc
+new file mode 100644
+index 0000000000000..3e0d6db15463b
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_perftest.cc
+@@ -0,0 +1,381 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++// Stage-by-stage timings for interactive snapshot and content extraction.
++//
++// The trees are generated to mimic the shape of real pages (article text,
++// product grids, deeply nested app UIs) at fixed sizes, so results are
++// comparable between builds. The 1k cases run with unit_tests; the larger
++// ones are MANUAL_ and need --run-manual.
++
++#include <memory>
++#include <string>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/notreached.h"
++#include "base/run_loop.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/timer/elapsed_timer.h"
++#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_index.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_prune_rules.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_wire_format.h"
++#include "chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h"
++#include "content/public/test/browser_task_environment.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree.h"
++#include "ui/accessibility/ax_tree_id.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/gfx/geometry/rect_f.h"
++
++namespace extensions {
++namespace api {
++namespace {
++
++constexpr char kMetricPrefix[] = "BrowserOSSnapshot.";
++constexpr char kIndexBuild[] = "index_build";
++constexpr char kTreeBuild[] = "ax_tree_build";
++constexpr char kFiltering[] = "filtering";
++constexpr char kFilteringWithPruneRules[] = "filtering_prune_rules";
++constexpr char kBounds[] = "bounds_table";
++constexpr char kBatches[] = "batch_processing";
++constexpr char kBatchesWithoutPaths[] = "batch_processing_no_paths";
++constexpr char kBatchesWithTemplates[] = "batch_processing_templates";
++constexpr char kIdlConversion[] = "idl_conversion";
++constexpr char kWirePacking[] = "wire_packing";
++constexpr char kEndToEnd[] = "end_to_end";
++constexpr char kContentExtraction[] = "content_processor";
++constexpr char kMainContentExtraction[] = "content_processor_main";
++constexpr char kSimpleExtraction[] = "simple_page_extractor";
++
++enum class PageShape {
++  kNews,      // Long article: paragraphs of text with inline links
++  kCommerce,  // Product grid: image, link, price and button per card
++  kSpa,       // App UI: deep nesting, toolbars, inputs and menus
++};
++
++// Builds an AXTreeUpdate of roughly |target| nodes. Parents are always
++// added before their children, as AXTree::Unserialize expects.
++class SyntheticTreeBuilder {
++ public:
++  explicit SyntheticTreeBuilder(size_t target) : target_(target) {
++    root_id_ = Add(/*parent_id=*/0, ax::mojom::Role::kRootWebArea, "Page",
++                   gfx::RectF(0, 0, 1280, 800));
++  }
++
++  bool full() const { return update_.nodes.size() >= target_; }
++  int32_t root_id() const { return root_id_; }
++
++  int32_t Add(int32_t parent_id,
++              ax::mojom::Role role,
++              const std::string& name,
++              const gfx::RectF& bounds) {
++    ui::AXNodeData node;
++    node.id = next_id_++;
++    node.role = role;
++    if (!name.empty()) {
++      node.AddStringAttribute(ax::mojom::StringAttribute::kName, name);
++    }
++    node.relative_bounds.bounds = bounds;
++    if (parent_id) {
++      node.relative_bounds.offset_container_id = parent_id;
++      // Ids are assigned sequentially from 1, so the parent is at id - 1
++      update_.nodes[parent_id - 1].child_ids.push_back(node.id);
++    }
++    update_.nodes.push_back(std::move(node));
++    return next_id_ - 1;
++  }
++
++  ui::AXTreeUpdate Build() {
++    update_.root_id = root_id_;
++    update_.has_tree_data = true;
++    update_.tree_data.tree_id = ui::AXTreeID::CreateNewAXTreeID();
++    return std::move(update_);
++  }
++
++ private:
++  const size_t target_;
++  int32_t next_id_ = 1;
++  int32_t root_id_ = 0;
++  ui::AXTreeUpdate update_;
++};
++
++ui::AXTreeUpdate BuildNewsPage(size_t node_count) {
++  SyntheticTreeBuilder builder(node_count);
++  int32_t article = builder.Add(builder.root_id(), ax::mojom::Role::kArticle,
++                                "", gfx::RectF(0, 0, 800, 100000));
++  for (int i = 0; !builder.full(); ++i) {
++    const float y = i * 120.0f;
++    if (i % 10 == 0) {
++      builder.Add(article, ax::mojom::Role::kHeading,
++                  "Section " + base::NumberToString(i / 10),
++                  gfx::RectF(0, y, 800, 40));
++    }
++    int32_t paragraph = builder.Add(article, ax::mojom::Role::kParagraph, "",
++                                    gfx::RectF(0, y + 40, 800, 80));
++    builder.Add(paragraph, ax::mojom::Role::kStaticText,
++                "Lorem ipsum dolor sit amet, consectetur adipiscing elit.",
++                gfx::RectF(0, 0, 600, 20));
++    builder.Add(paragraph, ax::mojom::Role::kLink,
++                "Related story " + base::NumberToString(i),
++                gfx::RectF(600, 0, 200, 20));
++  }
++  return builder.Build();
++}
++
++ui::AXTreeUpdate BuildCommercePage(size_t node_count) {
++  SyntheticTreeBuilder builder(node_count);
++  int32_t grid = builder.Add(builder.root_id(), ax::mojom::Role::kList, "",
++                             gfx::RectF(0, 0, 1280, 100000));
++  for (int i = 0; !builder.full(); ++i) {
++    const gfx::RectF card_bounds((i % 4) * 320.0f, (i / 4) * 400.0f, 300, 380);
++    int32_t card = builder.Add(grid, ax::mojom::Role::kListItem, "",
++                               card_bounds);
++    builder.Add(card, ax::mojom::Role::kImage, "Product photo",
++                gfx::RectF(0, 0, 300, 240));
++    builder.Add(card, ax::mojom::Role::kLink,
++                "Product " + base::NumberToString(i),
++                gfx::RectF(0, 250, 300, 30));
++    builder.Add(card, ax::mojom::Role::kStaticText, "$19.99",
++                gfx::RectF(0, 290, 100, 20));
++    builder.Add(card, ax::mojom::Role::kButton, "Add to cart",
++                gfx::RectF(0, 330, 150, 40));
++  }
++  return builder.Build();
++}
++
++ui::AXTreeUpdate BuildSpaPage(size_t node_count) {
++  constexpr int kNestingDepth = 20;
++  SyntheticTreeBuilder builder(node_count);
++  for (int i = 0; !builder.full(); ++i) {
++    // Each pane is a deep chain of wrappers, as produced by UI frameworks
++    int32_t parent = builder.root_id();
++    for (int depth = 0; depth < kNestingDepth && !builder.full(); ++depth) {
++      const gfx::RectF bounds =
++          depth == 0 ? gfx::RectF(0, i * 300.0f, 1200, 290)
++                     : gfx::RectF(2, 2, 1200, 290);
++      parent = builder.Add(parent, ax::mojom::Role::kGenericContainer, "",
++                           bounds);
++    }
++    builder.Add(parent, ax::mojom::Role::kTextField, "Search mail",
++                gfx::RectF(0, 0, 400, 32));
++    int32_t toolbar = builder.Add(parent, ax::mojom::Role::kToolbar, "",
++                                  gfx::RectF(0, 40, 1200, 40));
++    for (int button = 0; button < 6; ++button) {
++      builder.Add(toolbar, ax::mojom::Role::kButton,
++                  "Action " + base::NumberToString(button),
++                  gfx::RectF(button * 48.0f, 0, 40, 40));
++    }
++    int32_t menu = builder.Add(parent, ax::mojom::Role::kMenu, "",
++                               gfx::RectF(0, 90, 200, 200));
++    for (int item = 0; item < 5; ++item) {
++      builder.Add(menu, ax::mojom::Role::kMenuItem,
++                  "Folder " + base::NumberToString(item),
++                  gfx::RectF(0, item * 40.0f, 200, 40));
++    }
++  }
++  return builder.Build();
++}
++
++ui::AXTreeUpdate BuildPage(PageShape shape, size_t node_count) {
++  switch (shape) {
++    case PageShape::kNews:
++      return BuildNewsPage(node_count);
++    case PageShape::kCommerce:
++      return BuildCommercePage(node_count);
++    case PageShape::kSpa:
++      return BuildSpaPage(node_count);
++  }
++  NOTREACHED();
++}
++
++class BrowserOSSnapshotPerfTest : public testing::Test {
++ protected:
++  void RunStages(const std::string& story,
++                 PageShape shape,
++                 size_t node_count) {
++    auto snapshot =
++        base::MakeRefCounted<base::RefCountedData<ui::AXTreeUpdate>>(
++            BuildPage(shape, node_count));
++    const ui::AXTreeUpdate& tree_update = snapshot->data;
++    perf_test::PerfResultReporter reporter(kMetricPrefix, story);
++    for (const char* metric :
++         {kIndexBuild, kTreeBuild, kFiltering, kFilteringWithPruneRules,
++          kBounds, kBatches, kBatchesWithoutPaths, kBatchesWithTemplates,
++          kIdlConversion, kWirePacking, kEndToEnd, kContentExtraction,
++          kMainContentExtraction, kSimpleExtraction}) {
++      reporter.RegisterImportantMetric(metric, "ms");
++    }
++
++    base::ElapsedTimer timer;
++    auto node_index = base::MakeRefCounted<AXNodeIndex>(snapshot);
++    reporter.AddResult(kIndexBuild, timer.Elapsed());
++
++    timer = base::ElapsedTimer();
++    auto ax_tree = std::make_unique<ui::AXTree>(tree_update);
++    reporter.AddResult(kTreeBuild, timer.Elapsed());
++
++    timer = base::ElapsedTimer();
++    auto node_types =
++        base::MakeRefCounted<SnapshotProcessor::NodeTypeTable>();
++    std::vector<size_t> positions =
++        SnapshotProcessor::CollectCandidatePositions(*node_index, *node_types);
++    reporter.AddResult(kFiltering, timer.Elapsed());
++    ASSERT_FALSE(positions.empty());
++
++    // A typical site's rules: a role pruned outright and name and id
++    // patterns that each node of the role is tested against
++    base::Value::List rules;
++    rules.Append(base::Value::Dict().Set("role", "iframe"));
++    rules.Append(
++        base::Value::Dict().Set("role", "link").Set("name", "^sponsored"));
++    rules.Append(base::Value::Dict().Set("htmlId", "^(ad|promo)-"));
++    scoped_refptr<const SnapshotPruneMatcher> prune_rules =
++        SnapshotPruneMatcher::Compile({&rules});
++    ASSERT_TRUE(prune_rules);
++    timer = base::ElapsedTimer();
++    auto pruned_node_types =
++        base::MakeRefCounted<SnapshotProcessor::NodeTypeTable>();
++    std::vector<size_t> pruned_positions =
++        SnapshotProcessor::CollectCandidatePositions(
++            *node_index, *pruned_node_types, prune_rules.get());
++    reporter.AddResult(kFilteringWithPruneRules, timer.Elapsed());
++    EXPECT_LE(pruned_positions.size(), positions.size());
++
++    timer = base::ElapsedTimer();
++    scoped_refptr<const SnapshotProcessor::BoundsTable> bounds_table =
++        SnapshotProcessor::ComputeBoundsTable(std::move(ax_tree), node_index,
++                                              positions);
++    reporter.AddResult(kBounds, timer.Elapsed());
++
++    timer = base::ElapsedTimer();
++    std::vector<SnapshotProcessor::ProcessedNode> processed =
++        SnapshotProcessor::ProcessNodeBatch(node_index, bounds_table,
++                                            node_types, positions,
++                                            /*start_node_id=*/1);
++    reporter.AddResult(kBatches, timer.Elapsed());
++    EXPECT_EQ(positions.size(), processed.size());
++
++    timer = base::ElapsedTimer();
++    NodeAttributeMask without_paths;
++    without_paths.string_attributes.Remove(NodeAttribute::kPath);
++    SnapshotProcessor::ProcessNodeBatch(node_index, bounds_table, node_types,
++                                        positions, /*start_node_id=*/1,
++                                        without_paths);
++    reporter.AddResult(kBatchesWithoutPaths, timer.Elapsed());
++
++    // A later snapshot of the site, whose templates the first one added
++    auto templates = base::MakeRefCounted<SnapshotTemplates>();
++    templates->Resolve(*node_index, positions);
++    timer = base::ElapsedTimer();
++    std::vector<SnapshotProcessor::ProcessedNode> templated =
++        SnapshotProcessor::ProcessNodeBatch(
++            node_index, bounds_table, node_types, positions,
++            /*start_node_id=*/1, NodeAttributeMask::All(),
++            templates->Resolve(*node_index, positions));
++    reporter.AddResult(kBatchesWithTemplates, timer.Elapsed());
++    ASSERT_EQ(processed.size(), templated.size());
++    for (size_t i = 0; i < processed.size(); ++i) {
++      EXPECT_EQ(processed[i].attributes.Get(NodeAttribute::kPath),
++                templated[i].attributes.Get(NodeAttribute::kPath));
++      EXPECT_EQ(processed[i].attributes.depth, templated[i].attributes.depth);
++    }
++
++    timer = base::ElapsedTimer();
++    browser_os::InteractiveSnapshot snapshot;
++    snapshot.elements.reserve(processed.size());
++    for (const auto& node : processed) {
++      snapshot.elements.push_back(SnapshotProcessor::ToInteractiveNode(node));
++    }
++    base::Value::Dict serialized = snapshot.ToValue();
++    reporter.AddResult(kIdlConversion, timer.Elapsed());
++    EXPECT_FALSE(serialized.empty());
++
++    timer = base::ElapsedTimer();
++    auto packed = PackInteractiveSnapshot(snapshot.Clone(),
++                                          browser_os::WireCompression::kNone);
++    reporter.AddResult(kWirePacking, timer.Elapsed());
++    ASSERT_TRUE(packed.has_value());
++
++    timer = base::ElapsedTimer();
++    base::RunLoop run_loop;
++    SnapshotProcessingResult result;
++    SnapshotProcessor::ProcessAccessibilityTree(
++        snapshot, /*tab_id=*/1, /*snapshot_id=*/1,
++        /*web_contents=*/nullptr, SnapshotOptions(),
++        base::BindOnce(
++            [](SnapshotProcessingResult* out, base::OnceClosure quit,
++               SnapshotProcessingResult result) {
++              *out = std::move(result);
++              std::move(quit).Run();
++            },
++            &result, run_loop.QuitClosure()));
++    run_loop.Run();
++    reporter.AddResult(kEndToEnd, timer.Elapsed());
++    EXPECT_EQ(positions.size(), result.snapshot.elements.size());
++
++    timer = base::ElapsedTimer();
++    ContentProcessor::ExtractPageContent(tree_update);
++    reporter.AddResult(kContentExtraction, timer.Elapsed());
++
++    timer = base::ElapsedTimer();
++    ContentProcessor::ExtractPageContent(tree_update,
++                                         ContentProcessor::Mode::kMainContent);
++    reporter.AddResult(kMainContentExtraction, timer.Elapsed());
++
++    timer = base::ElapsedTimer();
++    BrowserOSSimplePageExtractor::ExtractStructuredText(tree_update);
++    reporter.AddResult(kSimpleExtraction, timer.Elapsed());
++  }
++
++ private:
++  content::BrowserTaskEnvironment task_environment_;
++};
++
++TEST_F(BrowserOSSnapshotPerfTest, News1k) {
++  RunStages("news_1k", PageShape::kNews, 1000);
++}
++
++TEST_F(BrowserOSSnapshotPerfTest, Commerce1k) {
++  RunStages("commerce_1k", PageShape::kCommerce, 1000);
++}
++
++TEST_F(BrowserOSSnapshotPerfTest, Spa1k) {
++  RunStages("spa_1k", PageShape::kSpa, 1000);
++}
++
++TEST_F(BrowserOSSnapshotPerfTest, MANUAL_News10k) {
++  RunStages("news_10k", PageShape::kNews, 10000);
++}
++
++TEST_F(BrowserOSSnapshotPerfTest, MANUAL_Commerce10k) {
++  RunStages("commerce_10k", PageShape::kCommerce, 10000);
++}
++
++TEST_F(BrowserOSSnapshotPerfTest, MANUAL_Spa10k) {
++  RunStages("spa_10k", PageShape::kSpa, 10000);
++}
++
++TEST_F(BrowserOSSnapshotPerfTest, MANUAL_News50k) {
++  RunStages("news_50k", PageShape::kNews, 50000);
++}
++
++TEST_F(BrowserOSSnapshotPerfTest, MANUAL_Commerce50k) {
++  RunStages("commerce_50k", PageShape::kCommerce, 50000);
++}
++
++TEST_F(BrowserOSSnapshotPerfTest, MANUAL_Spa50k) {
++  RunStages("spa_50k", PageShape::kSpa, 50000);
++}
++
++}  // namespace
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,125 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_prefetcher.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_prefetcher.cc
+new file mode 100644
+index 0000000000000..2894f56597a16
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_prefetcher.cc
+@@ -0,0 +1,119 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_prefetcher.h"
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_background_rendering.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSSnapshotPrefetcher::BrowserOSSnapshotPrefetcher(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSSnapshotPrefetcher>(
++          *web_contents) {}
++
++BrowserOSSnapshotPrefetcher::~BrowserOSSnapshotPrefetcher() = default;
++
++// static
++void BrowserOSSnapshotPrefetcher::SetEnabled(
++    content::WebContents* web_contents,
++    bool enabled) {
++  if (!enabled) {
++    web_contents->RemoveUserData(UserDataKey());
++    return;
++  }
++
++  BrowserOSSnapshotTracker::CreateForWebContents(web_contents);
++  BrowserOSSnapshotTracker::FromWebContents(web_contents)
++      ->EnsureAccessibilityEnabled();
++  CreateForWebContents(web_contents);
++}
++
++// static
++bool BrowserOSSnapshotPrefetcher::IsEnabled(
++    content::WebContents* web_contents) {
++  return !!FromWebContents(web_contents);
++}
++
++void BrowserOSSnapshotPrefetcher::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  if (!details.updates.empty() || !details.events.empty()) {
++    OnPageChanged();
++  }
++}
++
++void BrowserOSSnapshotPrefetcher::AccessibilityLocationChangesReceived(
++    const ui::AXTreeID& tree_id,
++    ui::AXLocationAndScrollUpdates& details) {
++  OnPageChanged();
++}
++
++void BrowserOSSnapshotPrefetcher::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  if (navigation_handle->IsInPrimaryMainFrame() &&
++      navigation_handle->HasCommitted()) {
++    OnPageChanged();
++  }
++}
++
++void BrowserOSSnapshotPrefetcher::DidStopLoading() {
++  OnPageChanged();
++}
++
++void BrowserOSSnapshotPrefetcher::OnPageChanged() {
++  // A prefetch in flight is dropped by the cache, which saw the same change
++  quiet_timer_.Start(FROM_HERE, kSnapshotPrefetchQuietPeriod,
++                     base::BindOnce(&BrowserOSSnapshotPrefetcher::Prefetch,
++                                    base::Unretained(this)));
++}
++
++void BrowserOSSnapshotPrefetcher::Prefetch() {
++  auto* tracker = BrowserOSSnapshotTracker::FromWebContents(web_contents());
++  if (!tracker || !tracker->accessibility_enabled()) {
++    // Without change events a cached tree cannot be trusted, so the cache
++    // would not keep it
++    VLOG(1) << "[browseros] Accessibility went idle, stopping snapshot "
++            << "prefetch";
++    web_contents()->RemoveUserData(UserDataKey());  // Deletes this
++    return;
++  }
++
++  content::RenderFrameHost* rfh = web_contents()->GetPrimaryMainFrame();
++  if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
++    return;
++  }
++
++  // Same mode and policy as getInteractiveSnapshot, so it finds the tree.
++  // Returns right away if the cache still holds a current one.
++  rendering_hold_ = BrowserOSBackgroundRendering::HoldIfHidden(web_contents());
++  browseros::AXSnapshotCache::Request(
++      web_contents(), GetSnapshotAXMode(SnapshotProfile::kInteractive),
++      content::WebContents::AXTreeSnapshotPolicy::kAll,
++      /* timeout= */ base::TimeDelta(),
++      browseros::AXSnapshotCache::Freshness::kAny,
++      base::BindOnce(&BrowserOSSnapshotPrefetcher::OnPrefetched,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSSnapshotPrefetcher::OnPrefetched(
++    browseros::SharedAXTreeUpdate snapshot) {
++  rendering_hold_.RunAndReset();
++  VLOG(1) << "[browseros] Prefetched AX tree ("
++          << snapshot->data.nodes.size() << " nodes)";
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSSnapshotPrefetcher);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,93 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_prefetcher.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_prefetcher.h
+new file mode 100644
+index 0000000000000..69c50785da46c
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_prefetcher.h
+@@ -0,0 +1,87 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PREFETCHER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PREFETCHER_H_
++
++#include "base/functional/callback_helpers.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/browseros/core/browseros_ax_snapshot_cache.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// How long a tab with prefetch on must go without an accessibility change,
++// navigation or load before its tree is fetched in the background
++inline constexpr base::TimeDelta kSnapshotPrefetchQuietPeriod =
++    base::Milliseconds(100);
++
++// Fetches a tab's accessibility tree in the background once the page
++// settles after a navigation or change, since the agent almost always asks
++// for a snapshot next. The tree lands in the tab's AXSnapshotCache, so the
++// next getInteractiveSnapshot skips the renderer round trip. A change
++// arriving before the prefetched tree, or after it, drops it there like any
++// cached snapshot.
++//
++// Only the tree is prefetched: processing it rebuilds the node mappings the
++// agent is acting on, so that still happens when the snapshot is asked for.
++//
++// Turned on per tab with InteractiveSnapshotOptions.prefetch. Cached trees
++// are only kept while the tab has accessibility on, so prefetching lapses
++// with the tab's accessibility mode once snapshots stop being requested.
++class BrowserOSSnapshotPrefetcher
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSSnapshotPrefetcher> {
++ public:
++  BrowserOSSnapshotPrefetcher(const BrowserOSSnapshotPrefetcher&) = delete;
++  BrowserOSSnapshotPrefetcher& operator=(const BrowserOSSnapshotPrefetcher&) =
++      delete;
++  ~BrowserOSSnapshotPrefetcher() override;
++
++  // Starts or stops prefetching for |web_contents|. Enabling also turns on
++  // the tab's accessibility mode, which change events and the cache need.
++  static void SetEnabled(content::WebContents* web_contents, bool enabled);
++  static bool IsEnabled(content::WebContents* web_contents);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSSnapshotPrefetcher>;
++
++  explicit BrowserOSSnapshotPrefetcher(content::WebContents* web_contents);
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void AccessibilityLocationChangesReceived(
++      const ui::AXTreeID& tree_id,
++      ui::AXLocationAndScrollUpdates& details) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++  void DidStopLoading() override;
++
++  // Restarts the quiet period
++  void OnPageChanged();
++  void Prefetch();
++  void OnPrefetched(browseros::SharedAXTreeUpdate snapshot);
++
++  base::OneShotTimer quiet_timer_;
++  // Keeps a hidden tab rendering while its tree is fetched
++  base::ScopedClosureRunner rendering_hold_;
++
++  base::WeakPtrFactory<BrowserOSSnapshotPrefetcher> weak_factory_{this};
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PREFETCHER_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
 new file mode 100644
-index 0000000000000..885942336dcd6
+index 0000000000000..6436b0ce4ae21
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
-@@ -0,0 +1,648 @@
+@@ -0,0 +1,1319 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,13 +11,17 @@ index 0000000000000..885942336dcd6
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
 +
 +#include <algorithm>
++#include <array>
 +#include <atomic>
 +#include <cctype>
++#include <cstring>
 +#include <functional>
++#include <iterator>
 +#include <future>
 +#include <memory>
 +#include <queue>
 +#include <sstream>
++#include <string_view>
 +#include <unordered_set>
 +#include <utility>
 +
@@ -26,12 +30,22 @@ index 0000000000000..885942336dcd6
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/ref_counted.h"
 +#include "base/strings/string_util.h"
++#include "base/strings/utf_string_conversion_utils.h"
++#include "base/system/sys_info.h"
++#include "base/task/bind_post_task.h"
++#include "base/task/post_job.h"
 +#include "base/task/thread_pool.h"
 +#include "base/time/time.h"
++#include "base/trace_event/trace_event.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_index.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_prune_rules.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_tab_geometry.h"
 +#include "content/public/browser/browser_thread.h"
-+#include "content/public/browser/render_widget_host_view.h"
-+#include "content/browser/renderer_host/render_widget_host_view_base.h"
++#include "content/public/browser/render_frame_host.h"
 +#include "content/public/browser/web_contents.h"
 +#include "ui/accessibility/ax_clipping_behavior.h"
 +#include "ui/accessibility/ax_coordinate_system.h"
@@ -103,37 +117,68 @@ index 0000000000000..885942336dcd6
 +
 +namespace {
 +
-+// Helper to sanitize strings to ensure valid UTF-8 by keeping only printable ASCII
-+std::string SanitizeStringForOutput(const std::string& input) {
-+  std::string output;
-+  output.reserve(input.size());
-+  
-+  for (char c : input) {
-+    // Only include printable ASCII and whitespace
-+    if ((c >= 32 && c <= 126) || c == '\t' || c == '\n') {
-+      output.push_back(c);
-+    } else {
-+      output.push_back(' ');  // Replace non-printable with space
++// Whether any byte of |word| is outside printable ASCII: below 0x20, DEL,
++// or part of a multibyte sequence. Checks 8 bytes at once, like
++// base::IsStringASCII.
++bool HasNonPrintableAsciiByte(uint64_t word) {
++  constexpr uint64_t kOnes = 0x0101010101010101ULL;
++  constexpr uint64_t kHighBits = 0x8080808080808080ULL;
++  const uint64_t below_space = (word - kOnes * 0x20) & ~word & kHighBits;
++  const uint64_t del = word ^ (kOnes * 0x7F);
++  const uint64_t is_del = (del - kOnes) & ~del & kHighBits;
++  return (below_space | is_del | (word & kHighBits)) != 0;
++}
++
++bool IsPrintableAsciiString(std::string_view input) {
++  size_t i = 0;
++  for (; i + sizeof(uint64_t) <= input.size(); i += sizeof(uint64_t)) {
++    uint64_t word;
++    memcpy(&word, input.data() + i, sizeof(word));
++    if (HasNonPrintableAsciiByte(word)) {
++      return false;
 +    }
 +  }
-+  
-+  return output;
++  for (; i < input.size(); ++i) {
++    const unsigned char c = input[i];
++    if (c < 0x20 || c >= 0x7F) {
++      return false;
++    }
++  }
++  return true;
 +}
 +
-+// Helper to determine if a node should be skipped for the interactive snapshot
-+bool ShouldSkipNode(const ui::AXNodeData& node_data) {
-+  // Skip invisible or ignored nodes
-+  if (node_data.IsInvisibleOrIgnored()) {
-+    return true;
++// C0 and C1 controls and DEL, except tab and newline
++bool IsStrippedControl(base_icu::UChar32 code_point) {
++  if (code_point == '\t' || code_point == '\n') {
++    return false;
 +  }
-+  
-+  // Get the interactive type and skip if it's not interactive
-+  browser_os::InteractiveNodeType node_type = GetInteractiveNodeType(node_data);
-+  if (node_type == browser_os::InteractiveNodeType::kOther) {
-+    return true;
++  return code_point < 0x20 || (code_point >= 0x7F && code_point <= 0x9F);
++}
++
++// Helper to sanitize strings for output: keeps valid UTF-8, including
++// multibyte text, and replaces control characters and invalid sequences
++// with a space. Clean printable ASCII, the common case, is returned as is.
++std::string SanitizeStringForOutput(std::string input) {
++  if (IsPrintableAsciiString(input)) {
++    return input;
 +  }
-+  
-+  return false;
++
++  std::string output;
++  output.reserve(input.size());
++  const char* src = input.data();
++  const size_t length = input.size();
++  for (size_t i = 0; i < length; ++i) {
++    const size_t start = i;
++    base_icu::UChar32 code_point;
++    // Advances |i| to the last byte of the character, valid or not
++    if (!base::ReadUnicodeCharacter(src, length, &i, &code_point) ||
++        IsStrippedControl(code_point)) {
++      output.push_back(' ');
++      continue;
++    }
++    output.append(src + start, i - start + 1);
++  }
++  return output;
 +}
 +
 +}  // namespace
@@ -142,11 +187,20 @@ index 0000000000000..885942336dcd6
 +struct SnapshotProcessor::ProcessingContext 
 +    : public base::RefCountedThreadSafe<ProcessingContext> {
 +  browser_os::InteractiveSnapshot snapshot;
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  std::unordered_map<int32_t, int32_t> parent_map;  // child_id -> parent_id  
-+  std::unordered_map<int32_t, std::vector<int32_t>> children_map;  // parent_id -> child_ids
-+  std::unique_ptr<ui::AXTree> ax_tree;  // AXTree for computing accurate bounds
++  // Shared read-only node storage. Also keeps ProcessedNode::node_data
++  // pointers valid until the last batch has been merged.
++  scoped_refptr<const AXNodeIndex> node_index;
++  // Positions in |node_index| of the nodes that go into the snapshot
++  std::vector<size_t> candidate_positions;
++  // Interactive type of each node, from the filter pass
++  scoped_refptr<const NodeTypeTable> node_types;
++  // The site's templates, if the snapshot reuses them. Also keeps the
++  // templates the batches read alive.
++  scoped_refptr<SnapshotTemplates> templates;
 +  int tab_id;
++  // Store of the tab's profile the nodes are mapped into. Null without a
++  // WebContents, as in perftests, or once the profile is gone.
++  base::WeakPtr<BrowserOSNodeMappingStore> mapping_store;
 +  ui::AXTreeID tree_id;  // Tree ID for change detection
 +  float device_scale_factor = 1.0f;  // For converting physical to CSS pixels
 +  gfx::Size viewport_size;  // For visibility checks
@@ -154,6 +208,19 @@ index 0000000000000..885942336dcd6
 +  size_t total_nodes;
 +  size_t processed_batches;
 +  size_t total_batches;
++  // Nodes per batch; batch i fills the slots of snapshot.elements from
++  // i * batch_size on, so elements are in document order however the
++  // batches finish
++  size_t batch_size = 0;
++  std::vector<bool> finished_batches;
++  // Optional stable nodeId assignment, run on the UI thread
++  NodeIdResolver node_id_resolver;
++  SnapshotOptions options;
++  bool truncated = false;  // Nodes were dropped by |options|
++  // Streaming: finished batches wait in their slots until all earlier ones
++  // were sent
++  ChunkCallback chunk_callback;
++  size_t next_chunk_index = 0;
 +  base::OnceCallback<void(SnapshotProcessingResult)> callback;
 +  
 + private:
@@ -164,11 +231,10 @@ index 0000000000000..885942336dcd6
 +// Helper to collect text from a node's subtree
 +std::string CollectTextFromNode(
 +    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
++    const AXNodeIndex& node_index,
 +    int max_chars = 200) {
 +  
-+  auto node_it = node_map.find(node_id);
-+  if (node_it == node_map.end()) {
++  if (!node_index.Find(node_id)) {
 +    return "";
 +  }
 +  
@@ -183,17 +249,17 @@ index 0000000000000..885942336dcd6
 +    int32_t current_id = queue.front();
 +    queue.pop();
 +    
-+    auto current_it = node_map.find(current_id);
-+    if (current_it == node_map.end()) continue;
++    const ui::AXNodeData* current_ptr = node_index.Find(current_id);
++    if (!current_ptr) continue;
 +    
-+    const ui::AXNodeData& current = current_it->second;
++    const ui::AXNodeData& current = *current_ptr;
 +    
 +    // Collect text from this node
 +    if (current.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
 +      std::string text = current.GetStringAttribute(ax::mojom::StringAttribute::kName);
 +      text = std::string(base::TrimWhitespaceASCII(text, base::TRIM_ALL));
 +      if (!text.empty()) {
-+        std::string clean_text = SanitizeStringForOutput(text);
++        std::string clean_text = SanitizeStringForOutput(std::move(text));
 +        if (!clean_text.empty()) {
 +          text_parts.push_back(clean_text);
 +          chars_collected += clean_text.length();
@@ -209,87 +275,109 @@ index 0000000000000..885942336dcd6
 +  
 +  std::string result = base::JoinString(text_parts, " ");
 +  if (result.length() > static_cast<size_t>(max_chars)) {
-+    result = result.substr(0, max_chars - 3) + "...";
++    // Cut on a character boundary so multibyte text stays valid UTF-8
++    base::TruncateUTF8ToByteSize(result, max_chars - 3, &result);
++    result += "...";
 +  }
 +  return result;
 +}
 +
-+// Helper to build path using offset_container_id and return depth
++// Helper to build path using offset_container_id and return depth.
++// Role names are static strings, so the walk only records pointers to them;
++// the path is measured and written into a single allocation afterwards,
++// and not built at all unless |include_path| is set.
 +std::pair<std::string, int> BuildPathAndDepth(
 +    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map) {
-+  
-+  std::vector<std::string> path_parts;
++    const AXNodeIndex& node_index,
++    bool include_path) {
++  std::array<std::string_view, kMaxPathDepth> roles;
 +  int32_t current_id = node_id;
 +  int depth = 0;
-+  const int max_depth = 10;
-+  
-+  while (current_id >= 0 && depth < max_depth) {
-+    auto node_it = node_map.find(current_id);
-+    if (node_it == node_map.end()) break;
-+    
-+    const ui::AXNodeData& node = node_it->second;
-+    
-+    // Just append the role
-+    path_parts.push_back(ui::ToString(node.role));
-+    
++  size_t length = 0;
++
++  while (current_id >= 0 && depth < kMaxPathDepth) {
++    const ui::AXNodeData* node_ptr = node_index.Find(current_id);
++    if (!node_ptr) break;
++
++    roles[depth] = ui::ToString(node_ptr->role);
++    length += roles[depth].size();
++
 +    // Move to offset container
-+    current_id = node.relative_bounds.offset_container_id;
++    current_id = node_ptr->relative_bounds.offset_container_id;
 +    depth++;
 +  }
-+  
-+  // Reverse to get top-down path
-+  std::reverse(path_parts.begin(), path_parts.end());
-+  return std::make_pair(base::JoinString(path_parts, " > "), depth);
++
++  std::string path;
++  if (!include_path || depth == 0) {
++    return std::make_pair(std::move(path), depth);
++  }
++
++  // Written top-down, from the outermost container to the node
++  path.reserve(length + kPathSeparator.size() * (depth - 1));
++  for (int i = depth - 1; i >= 0; --i) {
++    path.append(roles[i]);
++    if (i > 0) {
++      path.append(kPathSeparator);
++    }
++  }
++  return std::make_pair(std::move(path), depth);
 +}
 +
-+// Helper to populate all attributes for a node
++// Helper to populate the attributes in |mask| for a node
 +void PopulateNodeAttributes(
 +    const ui::AXNodeData& node_data,
-+    std::unordered_map<std::string, std::string>& attributes) {
++    const NodeAttributeMask& mask,
++    NodeAttributes& attributes) {
 +  
-+  // Add role as string
-+  attributes["role"] = ui::ToString(node_data.role);
++  // Role is kept as the enum and only stringified when serializing
++  attributes.role = node_data.role;
 +  
 +  // Add value attribute for inputs
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
++  if (mask.Has(NodeAttribute::kValue) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
 +    std::string value = node_data.GetStringAttribute(ax::mojom::StringAttribute::kValue);
-+    attributes["value"] = SanitizeStringForOutput(value);
++    attributes.Set(NodeAttribute::kValue, SanitizeStringForOutput(std::move(value)));
 +  }
 +  
 +  // Add HTML tag if available
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kHtmlTag)) {
-+    attributes["html-tag"] = node_data.GetStringAttribute(ax::mojom::StringAttribute::kHtmlTag);
++  if (mask.Has(NodeAttribute::kHtmlTag) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kHtmlTag)) {
++    attributes.Set(NodeAttribute::kHtmlTag, node_data.GetStringAttribute(ax::mojom::StringAttribute::kHtmlTag));
 +  }
 +  
 +  // Add role description
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kRoleDescription)) {
++  if (mask.Has(NodeAttribute::kRoleDescription) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kRoleDescription)) {
 +    std::string role_desc = node_data.GetStringAttribute(ax::mojom::StringAttribute::kRoleDescription);
-+    attributes["role-description"] = SanitizeStringForOutput(role_desc);
++    attributes.Set(NodeAttribute::kRoleDescription, SanitizeStringForOutput(std::move(role_desc)));
 +  }
 +  
 +  // Add input type
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kInputType)) {
++  if (mask.Has(NodeAttribute::kInputType) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kInputType)) {
 +    std::string input_type = node_data.GetStringAttribute(ax::mojom::StringAttribute::kInputType);
-+    attributes["input-type"] = SanitizeStringForOutput(input_type);
++    attributes.Set(NodeAttribute::kInputType, SanitizeStringForOutput(std::move(input_type)));
 +  }
 +  
 +  // Add tooltip
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kTooltip)) {
++  if (mask.Has(NodeAttribute::kTooltip) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kTooltip)) {
 +    std::string tooltip = node_data.GetStringAttribute(ax::mojom::StringAttribute::kTooltip);
-+    attributes["tooltip"] = SanitizeStringForOutput(tooltip);
++    attributes.Set(NodeAttribute::kTooltip, SanitizeStringForOutput(std::move(tooltip)));
 +  }
 +  
 +  // Add placeholder for input fields
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kPlaceholder)) {
++  if (mask.Has(NodeAttribute::kPlaceholder) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kPlaceholder)) {
 +    std::string placeholder = node_data.GetStringAttribute(ax::mojom::StringAttribute::kPlaceholder);
-+    attributes["placeholder"] = SanitizeStringForOutput(placeholder);
++    attributes.Set(NodeAttribute::kPlaceholder, SanitizeStringForOutput(std::move(placeholder)));
 +  }
 +  
 +  // Add description for more context
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kDescription)) {
++  if (mask.Has(NodeAttribute::kDescription) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kDescription)) {
 +    std::string description = node_data.GetStringAttribute(ax::mojom::StringAttribute::kDescription);
-+    attributes["description"] = SanitizeStringForOutput(description);
++    attributes.Set(NodeAttribute::kDescription, SanitizeStringForOutput(std::move(description)));
 +  }
 +  
 +  // Add URL for links
@@ -299,56 +387,283 @@ index 0000000000000..885942336dcd6
 +  // }
 +  
 +  // Add checked state description
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kCheckedStateDescription)) {
++  if (mask.Has(NodeAttribute::kCheckedState) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kCheckedStateDescription)) {
 +    std::string checked_desc = node_data.GetStringAttribute(ax::mojom::StringAttribute::kCheckedStateDescription);
-+    attributes["checked-state"] = SanitizeStringForOutput(checked_desc);
++    attributes.Set(NodeAttribute::kCheckedState, SanitizeStringForOutput(std::move(checked_desc)));
 +  }
 +  
 +  // Add autocomplete hint
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kAutoComplete)) {
++  if (mask.Has(NodeAttribute::kAutocomplete) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kAutoComplete)) {
 +    std::string autocomplete = node_data.GetStringAttribute(ax::mojom::StringAttribute::kAutoComplete);
-+    attributes["autocomplete"] = SanitizeStringForOutput(autocomplete);
++    attributes.Set(NodeAttribute::kAutocomplete, SanitizeStringForOutput(std::move(autocomplete)));
 +  }
 +  
 +  // Add HTML ID for form associations
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kHtmlId)) {
++  if (mask.Has(NodeAttribute::kId) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kHtmlId)) {
 +    std::string html_id = node_data.GetStringAttribute(ax::mojom::StringAttribute::kHtmlId);
-+    attributes["id"] = SanitizeStringForOutput(html_id);
++    attributes.Set(NodeAttribute::kId, SanitizeStringForOutput(std::move(html_id)));
 +  }
 +  
 +  // Add HTML class names
-+  if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kClassName)) {
++  if (mask.Has(NodeAttribute::kClass) &&
++      node_data.HasStringAttribute(ax::mojom::StringAttribute::kClassName)) {
 +    std::string class_name = node_data.GetStringAttribute(ax::mojom::StringAttribute::kClassName);
-+    attributes["class"] = SanitizeStringForOutput(class_name);
++    attributes.Set(NodeAttribute::kClass, SanitizeStringForOutput(std::move(class_name)));
++  }
++}
++
++// static
++const ui::AXNode* SnapshotProcessor::GetChildFrameRoot(const ui::AXNode* node) {
++  // Combined snapshots (AXTreeSnapshotPolicy::kAll) attach the root web area
++  // of each child frame below its iframe node
++  for (; node; node = node->GetParent()) {
++    if (node->GetRole() == ax::mojom::Role::kRootWebArea && node->GetParent()) {
++      return node;
++    }
++  }
++  return nullptr;
++}
++
++// static
++const SnapshotProcessor::FrameTransform& SnapshotProcessor::GetFrameTransform(
++    ui::AXTree* tree,
++    const ui::AXNode* frame_root,
++    float device_scale_factor,
++    FrameTransformCache& cache) {
++  auto it = cache.find(frame_root->id());
++  if (it != cache.end()) {
++    return it->second;
++  }
++
++  // Node bounds in a child frame are relative to that frame, the combined
++  // tree does not offset them by the iframe. Place the frame at its host
++  // node, which may itself sit inside another child frame.
++  const ui::AXNode* host = frame_root->GetParent();
++  FrameTransform transform;
++  transform.offset =
++      GetNodeBounds(tree, host, ui::AXCoordinateSystem::kFrame,
++                    ui::AXClippingBehavior::kUnclipped, device_scale_factor)
++          .OffsetFromOrigin();
++  transform.clip =
++      GetNodeBounds(tree, host, ui::AXCoordinateSystem::kFrame,
++                    ui::AXClippingBehavior::kClipped, device_scale_factor);
++  if (const ui::AXNode* outer_root = GetChildFrameRoot(host)) {
++    const FrameTransform& outer =
++        GetFrameTransform(tree, outer_root, device_scale_factor, cache);
++    transform.offset += outer.offset;
++    transform.clip.Offset(outer.offset);
++    transform.clip.Intersect(outer.clip);
++  }
++
++  return cache.emplace(frame_root->id(), transform).first->second;
++}
++
++// Compute bounds for all candidate nodes in one pass over the AXTree
++// static
++scoped_refptr<const SnapshotProcessor::BoundsTable>
++SnapshotProcessor::ComputeBoundsTable(
++    std::unique_ptr<ui::AXTree> ax_tree,
++    scoped_refptr<const AXNodeIndex> node_index,
++    std::vector<size_t> positions,
++    float device_scale_factor,
++    bool include_unclipped) {
++  auto bounds_table = base::MakeRefCounted<BoundsTable>();
++  bounds_table->data.resize(node_index->size());
++  // Child frames met so far, by frame root id
++  FrameTransformCache frame_transforms;
++
++  for (size_t position : positions) {
++    const ui::AXNodeData& node_data = node_index->at(position);
++    ui::AXNode* ax_node = ax_tree->GetFromId(node_data.id);
++    if (!ax_node) {
++      // Node not found in AXTree, skip bounds computation
++      VLOG(3) << "[browseros] Node " << node_data.id
++              << " not found in AXTree, skipping bounds";
++      continue;
++    }
++
++    NodeBounds& entry = bounds_table->data[position];
++    // GetNodeBounds returns CSS pixels directly, relative to the node's own
++    // frame for nodes inside child frames
++    entry.bounds = GetNodeBounds(
++        ax_tree.get(),
++        ax_node,
++        ui::AXCoordinateSystem::kFrame,
++        // Use clipped bounds so the center lies within the visible area of
++        // scrolled/clip containers. This matches how clicks should target
++        // on-screen rects.
++        ui::AXClippingBehavior::kClipped,
++        device_scale_factor,  // Pass DSF for CSS pixel conversion
++        &entry.offscreen);
++    if (include_unclipped) {
++      entry.unclipped_bounds = GetNodeBounds(
++          ax_tree.get(), ax_node, ui::AXCoordinateSystem::kFrame,
++          ui::AXClippingBehavior::kUnclipped, device_scale_factor);
++    }
++
++    if (const ui::AXNode* frame_root = GetChildFrameRoot(ax_node)) {
++      const FrameTransform& frame = GetFrameTransform(
++          ax_tree.get(), frame_root, device_scale_factor, frame_transforms);
++      entry.bounds.Offset(frame.offset);
++      entry.unclipped_bounds.Offset(frame.offset);
++      // Content scrolled out of its iframe is not visible on the page
++      const bool was_empty = entry.bounds.IsEmpty();
++      entry.bounds.Intersect(frame.clip);
++      if (!was_empty && entry.bounds.IsEmpty()) {
++        entry.offscreen = true;
++      }
++    }
++
++    VLOG(3) << "[browseros] Node " << node_data.id
++            << " CSS bounds: " << entry.bounds.ToString()
++            << " offscreen: " << entry.offscreen;
++  }
++
++  return bounds_table;
++}
++
++// Lower value = kept first when a snapshot is over budget
++int GetNodeTypePriority(browser_os::InteractiveNodeType node_type) {
++  switch (node_type) {
++    case browser_os::InteractiveNodeType::kTypeable:
++      return 0;
++    case browser_os::InteractiveNodeType::kClickable:
++      return 1;
++    case browser_os::InteractiveNodeType::kSelectable:
++      return 2;
++    default:
++      return 3;
++  }
++}
++
++// Rough size of a node once serialized to JSON for the extension
++size_t EstimateSerializedSize(const browser_os::InteractiveNode& node) {
++  // nodeId, type and rect plus keys and punctuation
++  size_t size = 96;
++  if (node.name) {
++    size += node.name->size();
++  }
++  if (node.attributes) {
++    for (const auto [key, value] : node.attributes->additional_properties) {
++      size += key.size() + 6;
++      if (value.is_string()) {
++        size += value.GetString().size();
++      }
++    }
++  }
++  return size;
++}
++
++// static
++std::vector<size_t> SnapshotProcessor::ApplyViewportAndNodeBudget(
++    const NodeTypeTable& node_types,
++    const BoundsTable& bounds_table,
++    std::vector<size_t> positions,
++    const SnapshotOptions& options,
++    const gfx::SizeF& viewport_size,
++    bool* truncated) {
++  const size_t candidate_count = positions.size();
++
++  if (options.viewport_only) {
++    gfx::RectF viewport(viewport_size);
++    viewport.Outset(options.viewport_margin);
++    const bool use_margin =
++        options.viewport_margin > 0.0f && !viewport.IsEmpty();
++
++    std::erase_if(positions, [&](size_t position) {
++      const NodeBounds& node_bounds = bounds_table.data[position];
++      if (!node_bounds.offscreen) {
++        return false;  // At least partially visible
++      }
++      return !use_margin ||
++             !viewport.Intersects(node_bounds.unclipped_bounds);
++    });
++  }
++
++  if (options.max_nodes > 0 && positions.size() > options.max_nodes) {
++    // Keep the highest-priority nodes, earlier nodes first within a type
++    std::stable_sort(positions.begin(), positions.end(),
++                     [&](size_t a, size_t b) {
++                       return GetNodeTypePriority(node_types.data[a]) <
++                              GetNodeTypePriority(node_types.data[b]);
++                     });
++    positions.resize(options.max_nodes);
++    std::sort(positions.begin(), positions.end());
 +  }
++
++  if (truncated && positions.size() < candidate_count) {
++    *truncated = true;
++  }
++  return positions;
++}
++
++// static
++std::vector<uint32_t> SnapshotProcessor::ApplyByteBudget(
++    browser_os::InteractiveSnapshot& snapshot,
++    size_t max_bytes) {
++  std::vector<size_t> order(snapshot.elements.size());
++  for (size_t i = 0; i < order.size(); ++i) {
++    order[i] = i;
++  }
++  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
++    return GetNodeTypePriority(snapshot.elements[a].type) <
++           GetNodeTypePriority(snapshot.elements[b].type);
++  });
++
++  // Take nodes in priority order until the first one that does not fit
++  std::vector<bool> keep(snapshot.elements.size(), false);
++  size_t total_bytes = 0;
++  for (size_t index : order) {
++    total_bytes += EstimateSerializedSize(snapshot.elements[index]);
++    if (total_bytes > max_bytes) {
++      break;
++    }
++    keep[index] = true;
++  }
++
++  std::vector<uint32_t> dropped_node_ids;
++  std::vector<browser_os::InteractiveNode> kept;
++  for (size_t i = 0; i < snapshot.elements.size(); ++i) {
++    if (keep[i]) {
++      kept.push_back(std::move(snapshot.elements[i]));
++    } else {
++      dropped_node_ids.push_back(
++          static_cast<uint32_t>(snapshot.elements[i].node_id));
++    }
++  }
++  snapshot.elements = std::move(kept);
++  return dropped_node_ids;
 +}
 +
 +// Process a batch of nodes
 +std::vector<SnapshotProcessor::ProcessedNode> SnapshotProcessor::ProcessNodeBatch(
-+    const std::vector<ui::AXNodeData>& nodes_to_process,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+    ui::AXTree* ax_tree,
++    scoped_refptr<const AXNodeIndex> node_index,
++    scoped_refptr<const BoundsTable> bounds_table,
++    scoped_refptr<const NodeTypeTable> node_types,
++    std::vector<size_t> batch_positions,
 +    uint32_t start_node_id,
-+    float device_scale_factor) {
++    const NodeAttributeMask& attributes,
++    scoped_refptr<const SnapshotTemplates::Table> node_templates) {
++  TRACE_EVENT("browser", "BrowserOS::ProcessNodeBatch", "nodes",
++              batch_positions.size());
 +  std::vector<ProcessedNode> results;
-+  results.reserve(nodes_to_process.size());
++  results.reserve(batch_positions.size());
 +  
 +  uint32_t current_node_id = start_node_id;
 +  
-+  for (const auto& node_data : nodes_to_process) {
-+    // Skip invisible, ignored, or non-interactive elements
-+    if (ShouldSkipNode(node_data)) {
-+      continue;
-+    }
-+    
-+    // Double-check invisibility (already done in ShouldSkipNode, but being explicit)
-+    if (node_data.IsInvisibleOrIgnored()) {
++  for (size_t position : batch_positions) {
++    const ui::AXNodeData& node_data = node_index->at(position);
++
++    // Classified by the filter pass; kOther means not a candidate
++    const browser_os::InteractiveNodeType node_type =
++        node_types->data[position];
++    if (node_type == browser_os::InteractiveNodeType::kOther) {
 +      continue;
 +    }
-+    
-+    // Get the interactive node type
-+    browser_os::InteractiveNodeType node_type = GetInteractiveNodeType(node_data);
-+    
++
 +    ProcessedNode data;
 +    data.node_data = &node_data;
 +    data.node_id = current_node_id++;
@@ -357,62 +672,51 @@ index 0000000000000..885942336dcd6
 +    // Get accessible name
 +    if (node_data.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
 +      std::string name = node_data.GetStringAttribute(ax::mojom::StringAttribute::kName);
-+      data.name = SanitizeStringForOutput(name);
++      data.name = SanitizeStringForOutput(std::move(name));
 +    }
 +
-+    // Compute bounds using AXTree
-+    bool is_offscreen = false;
-+    if (ax_tree) {
-+      ui::AXNode* ax_node = ax_tree->GetFromId(node_data.id);
-+      if (ax_node) {
-+        // GetNodeBounds now returns CSS pixels directly
-+        data.absolute_bounds = GetNodeBounds(
-+            ax_tree, 
-+            ax_node,
-+            ui::AXCoordinateSystem::kFrame,
-+            // Use clipped bounds so the center lies within the visible area of
-+            // scrolled/clip containers. This matches how clicks should target
-+            // on-screen rects.
-+            ui::AXClippingBehavior::kClipped,
-+            device_scale_factor,  // Pass DSF for CSS pixel conversion
-+            &is_offscreen);
-+        
-+        VLOG(3) << "[browseros] Node " << node_data.id 
-+                << " CSS bounds: " << data.absolute_bounds.ToString()
-+                << " offscreen: " << is_offscreen;
-+      } else {
-+        // Node not found in AXTree, skip bounds computation
-+        VLOG(3) << "[browseros] Node " << node_data.id 
-+                << " not found in AXTree, skipping bounds";
-+      }
-+    } else {
-+      // No AXTree available
-+      LOG(WARNING) << "[browseros] No AXTree available for bounds computation";
-+    }
++    // Look up precomputed bounds (already in CSS pixels)
++    const NodeBounds& node_bounds = bounds_table->data[position];
++    const bool is_offscreen = node_bounds.offscreen;
++    data.absolute_bounds = node_bounds.bounds;
 +    
-+    // Populate all attributes using helper function
-+    PopulateNodeAttributes(node_data, data.attributes);
++    // Populate the requested attributes using helper function
++    PopulateNodeAttributes(node_data, attributes, data.attributes);
 +    
 +    // Add context from parent node
 +    int32_t parent_id = node_data.relative_bounds.offset_container_id;
-+    if (parent_id >= 0) {
-+      std::string context = CollectTextFromNode(parent_id, node_map, 200);
++    if (attributes.Has(NodeAttribute::kContext) && parent_id >= 0) {
++      std::string context = CollectTextFromNode(parent_id, *node_index, 200);
 +      if (!context.empty()) {
-+        data.attributes["context"] = context;
++        data.attributes.Set(NodeAttribute::kContext, std::move(context));
 +      }
 +    }
 +    
 +    // Add path and depth using offset_container_id chain
-+    auto [path, depth] = BuildPathAndDepth(node_data.id, node_map);
-+    if (!path.empty()) {
-+      data.attributes["path"] = path;
++    const bool include_path = attributes.Has(NodeAttribute::kPath);
++    if (attributes.depth || include_path) {
++      const NodeTemplate* node_template =
++          node_templates ? node_templates->data[position] : nullptr;
++      if (node_template) {
++        // Shared by the nodes of this structure; only the copy is paid
++        if (include_path) {
++          data.attributes.Set(NodeAttribute::kPath, node_template->path);
++        }
++        data.attributes.depth = node_template->depth;
++      } else {
++        auto [path, depth] =
++            BuildPathAndDepth(node_data.id, *node_index, include_path);
++        if (!path.empty()) {
++          data.attributes.Set(NodeAttribute::kPath, std::move(path));
++        }
++        data.attributes.depth = depth;
++      }
 +    }
-+    data.attributes["depth"] = std::to_string(depth);
 +    
 +    // Set viewport status based on offscreen flag
 +    // Note: offscreen=false means the node IS in viewport (at least partially visible)
 +    // offscreen=true means the node is NOT in viewport (completely hidden)
-+    data.attributes["in_viewport"] = is_offscreen ? "false" : "true";
++    data.attributes.in_viewport = !is_offscreen;
 +    
 +    results.push_back(std::move(data));
 +  }
@@ -420,91 +724,244 @@ index 0000000000000..885942336dcd6
 +  return results;
 +}
 +
++// static
++std::vector<size_t> SnapshotProcessor::CollectCandidatePositions(
++    const AXNodeIndex& node_index,
++    NodeTypeTable& node_types,
++    const SnapshotPruneMatcher* prune_rules,
++    size_t* pruned) {
++  node_types.data.assign(node_index.size(),
++                         browser_os::InteractiveNodeType::kOther);
++  std::vector<size_t> positions;
++  // Children of pruned nodes. Parents come before their children in the
++  // update, so a pruned subtree is skipped without walking it twice.
++  std::unordered_set<int32_t> pruned_ids;
++  for (size_t position = 0; position < node_index.size(); ++position) {
++    const ui::AXNodeData& node = node_index.at(position);
++    if (prune_rules &&
++        (pruned_ids.contains(node.id) || prune_rules->Matches(node))) {
++      pruned_ids.insert(node.child_ids.begin(), node.child_ids.end());
++      if (pruned) {
++        (*pruned)++;
++      }
++      continue;
++    }
++    // Invisible, ignored and non-interactive nodes are kOther
++    const browser_os::InteractiveNodeType node_type =
++        GetInteractiveNodeType(node);
++    if (node_type == browser_os::InteractiveNodeType::kOther) {
++      continue;
++    }
++    node_types.data[position] = node_type;
++    positions.push_back(position);
++  }
++  return positions;
++}
++
++// static
++browser_os::InteractiveNode SnapshotProcessor::ToInteractiveNode(
++    const ProcessedNode& node_data,
++    const NodeAttributeMask& attributes) {
++  browser_os::InteractiveNode interactive_node;
++  interactive_node.node_id = node_data.node_id;
++  interactive_node.type = node_data.node_type;
++  interactive_node.name = node_data.name;
++
++  // Set the bounding rectangle
++  browser_os::Rect rect;
++  rect.x = node_data.absolute_bounds.x();
++  rect.y = node_data.absolute_bounds.y();
++  rect.width = node_data.absolute_bounds.width();
++  rect.height = node_data.absolute_bounds.height();
++  interactive_node.rect = std::move(rect);
++
++  // Materialize the string dictionary only now, for the IDL result
++  browser_os::InteractiveNode::Attributes node_attributes;
++  node_attributes.additional_properties =
++      node_data.attributes.ToDict(attributes);
++  interactive_node.attributes = std::move(node_attributes);
++
++  return interactive_node;
++}
++
 +// Helper to handle batch processing results
 +void SnapshotProcessor::OnBatchProcessed(
 +    scoped_refptr<ProcessingContext> context,
++    size_t batch_index,
 +    std::vector<ProcessedNode> batch_results) {
++  // Batches claimed before a cancellation still report back
++  if (!context->callback) {
++    return;
++  }
++  if (IsRequestCancelled(context->options.cancellation.get())) {
++    FinishCancelled(std::move(context));
++    return;
++  }
++
++  // Every candidate of the batch yields a node, so its slots are known
++  // before it runs
++  std::vector<browser_os::InteractiveNode>& elements =
++      context->snapshot.elements;
++  const size_t first_slot = batch_index * context->batch_size;
++  CHECK_LE(first_slot + batch_results.size(), elements.size());
++  DCHECK_EQ(batch_results.size(),
++            std::min(context->batch_size, elements.size() - first_slot));
++  size_t slot = first_slot;
++
++  // Looked up once per batch; sized for the whole snapshot by
++  // OnBoundsTableComputed, so inserts don't rehash. Null if the tab's
++  // mappings were dropped meanwhile, e.g. by a navigation.
++  TabNodeMappings* tab_mappings =
++      context->mapping_store ? context->mapping_store->Find(context->tab_id)
++                             : nullptr;
++
 +  // Process batch results
-+  for (const auto& node_data : batch_results) {
++  for (auto& node_data : batch_results) {
++    if (context->node_id_resolver) {
++      node_data.node_id = context->node_id_resolver.Run(
++          context->tree_id, node_data.node_data->id);
++    }
++
++    // The IDL node takes its copies first, so the mapping below can take
++    // the name and attributes over instead of copying them again
++    elements[slot++] =
++        ToInteractiveNode(node_data, context->options.attributes);
++    if (!tab_mappings) {
++      continue;
++    }
++    IndexNodeName(*tab_mappings, node_data.node_id, node_data.name);
++
++    // Log the mapping for debugging
++    VLOG(2) << "Node ID Mapping: Interactive nodeId=" << node_data.node_id
++            << " -> AX node ID=" << node_data.node_data->id
++            << " (name: " << node_data.name << ")";
++
 +    // Store mapping from our nodeId to AX node ID, bounds, and attributes
 +    NodeInfo info;
 +    info.ax_node_id = node_data.node_data->id;
 +    info.ax_tree_id = context->tree_id;  // Store tree ID for change detection
 +    info.bounds = node_data.absolute_bounds;
-+    info.attributes = node_data.attributes;  // Store all computed attributes
 +    info.node_type = node_data.node_type;  // Store node type for efficient filtering
-+    // Extract in_viewport from attributes (stored as "true"/"false" string)
-+    auto viewport_it = node_data.attributes.find("in_viewport");
-+    info.in_viewport = (viewport_it != node_data.attributes.end() && viewport_it->second == "true");
-+    GetNodeIdMappings()[context->tab_id][node_data.node_id] = info;
-+    
-+    // Log the mapping for debugging
-+    VLOG(2) << "Node ID Mapping: Interactive nodeId=" << node_data.node_id 
-+            << " -> AX node ID=" << info.ax_node_id 
-+            << " (name: " << node_data.name << ")";
-+    
-+    // Create interactive node
-+    browser_os::InteractiveNode interactive_node;
-+    interactive_node.node_id = node_data.node_id;
-+    interactive_node.type = node_data.node_type;
-+    interactive_node.name = node_data.name;
-+    
-+    // Set the bounding rectangle
-+    browser_os::Rect rect;
-+    rect.x = node_data.absolute_bounds.x();
-+    rect.y = node_data.absolute_bounds.y();
-+    rect.width = node_data.absolute_bounds.width();
-+    rect.height = node_data.absolute_bounds.height();
-+    interactive_node.rect = std::move(rect);
-+    
-+    // Create attributes dictionary by iterating over all key-value pairs
-+    if (!node_data.attributes.empty()) {
-+      browser_os::InteractiveNode::Attributes attributes;
-+      
-+      // Iterate over all attributes and add them to the dictionary
-+      for (const auto& [key, value] : node_data.attributes) {
-+        attributes.additional_properties.Set(key, value);
-+      }
-+      
-+      interactive_node.attributes = std::move(attributes);
++    info.in_viewport = node_data.attributes.in_viewport;
++    info.name = std::move(node_data.name);
++    info.attributes = std::move(node_data.attributes);
++    tab_mappings->nodes.insert_or_assign(node_data.node_id, std::move(info));
++  }
++
++  context->finished_batches[batch_index] = true;
++  if (context->chunk_callback) {
++    // Batches finish in any order; emit the finished prefix in document
++    // order
++    while (context->next_chunk_index < context->total_batches &&
++           context->finished_batches[context->next_chunk_index]) {
++      const size_t begin = context->next_chunk_index * context->batch_size;
++      const size_t end =
++          std::min(begin + context->batch_size, elements.size());
++      context->chunk_callback.Run(
++          context->next_chunk_index,
++          std::vector<browser_os::InteractiveNode>(
++              std::make_move_iterator(elements.begin() + begin),
++              std::make_move_iterator(elements.begin() + end)));
++      context->next_chunk_index++;
 +    }
-+    
-+    context->snapshot.elements.push_back(std::move(interactive_node));
 +  }
 +  
 +  context->processed_batches++;
 +  
 +  // Check if all batches are complete
 +  if (context->processed_batches == context->total_batches) {
-+    // Sort elements by node_id to maintain consistent ordering
-+    std::sort(context->snapshot.elements.begin(), 
-+              context->snapshot.elements.end(),
-+              [](const browser_os::InteractiveNode& a, 
-+                 const browser_os::InteractiveNode& b) {
-+                return a.node_id < b.node_id;
-+              });
++    // Streamed nodes were moved out of their slots
++    if (context->chunk_callback) {
++      elements.clear();
++    }
 +
 +    // Leave hierarchical_structure empty for now as requested
 +    context->snapshot.hierarchical_structure = "";
 +
++    // Byte budget needs the serialized attributes, so it applies last
++    if (context->options.max_bytes > 0 && !context->chunk_callback) {
++      std::vector<uint32_t> dropped_node_ids = ApplyByteBudget(
++          context->snapshot, context->options.max_bytes);
++      if (!dropped_node_ids.empty()) {
++        context->truncated = true;
++        if (TabNodeMappings* tab_mappings =
++                context->mapping_store
++                    ? context->mapping_store->Find(context->tab_id)
++                    : nullptr) {
++          for (uint32_t node_id : dropped_node_ids) {
++            tab_mappings->nodes.erase(node_id);
++          }
++        }
++      }
++    }
++    if (context->truncated) {
++      context->snapshot.truncated = true;
++    }
++
 +    base::TimeDelta processing_time = base::TimeTicks::Now() - context->start_time;
-+    LOG(INFO) << "[PERF] Interactive snapshot processed in " 
-+              << processing_time.InMilliseconds() << " ms"
-+              << " (nodes: " << context->snapshot.elements.size() << ")";
++    VLOG(1) << "[browseros] Interactive snapshot processed in "
++            << processing_time.InMilliseconds() << " ms"
++            << " (nodes: " << context->snapshot.elements.size() << ")";
 +
 +    // Set processing time in the snapshot
 +    context->snapshot.processing_time_ms = processing_time.InMilliseconds();
++    browseros_metrics::BrowserOSMetrics::RecordLatency("snapshot.processing",
++                                                       processing_time);
++
++    if (BrowserOSNodeMappingStore* store = context->mapping_store.get()) {
++      store->OnSnapshotStored(context->tab_id);
++      // Sampled footprint of the profile's node mappings store
++      browseros_metrics::BrowserOSMetrics::Log(
++          "snapshot.mappings.footprint",
++          {{"tabs", base::Value(static_cast<int>(store->tab_count()))},
++           {"nodes", base::Value(static_cast<int>(store->GetNodeCount()))},
++           {"bytes",
++            base::Value(static_cast<double>(store->GetMemoryUsage()))}},
++          0.05);
++    }
 +
 +    SnapshotProcessingResult result;
 +    result.snapshot = std::move(context->snapshot);
 +    result.nodes_processed = context->total_nodes;
 +    result.processing_time_ms = processing_time.InMilliseconds();
-+    
++    for (const auto& element : result.snapshot.elements) {
++      result.estimated_bytes += EstimateSerializedSize(element);
++    }
++
 +    // Run callback (context will be deleted when last ref is released)
 +    std::move(context->callback).Run(std::move(result));
 +  }
 +}
 +
++// static
++void SnapshotProcessor::FinishCancelled(
++    scoped_refptr<ProcessingContext> context) {
++  if (!context->callback) {
++    return;
++  }
++
++  const base::TimeDelta processing_time =
++      base::TimeTicks::Now() - context->start_time;
++  VLOG(1) << "[browseros] Snapshot of tab " << context->tab_id
++          << " cancelled after " << processing_time.InMilliseconds() << " ms ("
++          << context->processed_batches << " of " << context->total_batches
++          << " batches merged)";
++  browseros_metrics::BrowserOSMetrics::Log(
++      "snapshot.cancelled",
++      {{"batches_merged",
++        base::Value(static_cast<int>(context->processed_batches))},
++       {"batches", base::Value(static_cast<int>(context->total_batches))},
++       {"elapsed_ms", base::Value(static_cast<int>(
++                          processing_time.InMilliseconds()))}});
++
++  SnapshotProcessingResult result;
++  result.snapshot.snapshot_id = context->snapshot.snapshot_id;
++  result.snapshot.timestamp = context->snapshot.timestamp;
++  result.processing_time_ms = processing_time.InMilliseconds();
++  result.cancelled = true;
++  std::move(context->callback).Run(std::move(result));
++}
++
 +// Main processing function
 +// Helper function to extract viewport info from WebContents
 +// Returns viewport size and device scale factor
@@ -514,75 +971,73 @@ index 0000000000000..885942336dcd6
 +  float device_scale_factor = 1.0f;
 +  
 +  if (web_contents) {
-+    if (auto* rwhv = web_contents->GetRenderWidgetHostView()) {
-+      viewport_size = rwhv->GetVisibleViewportSize();
-+      
-+      // Get device scale factor for CSS pixel conversion
-+      if (auto* rwhv_base = 
-+          static_cast<content::RenderWidgetHostViewBase*>(rwhv)) {
-+        device_scale_factor = rwhv_base->GetDeviceScaleFactor();
-+      }
-+    }
++    const TabGeometry& geometry = BrowserOSTabGeometry::Get(web_contents);
++    viewport_size = geometry.viewport_size;
++    device_scale_factor = geometry.device_scale_factor;
 +  }
 +  
-+  LOG(INFO) << "[browseros] Viewport: " << viewport_size.ToString() 
-+            << ", DSF: " << device_scale_factor;
++  VLOG(1) << "[browseros] Viewport: " << viewport_size.ToString() 
++          << ", DSF: " << device_scale_factor;
 +  
 +  return {viewport_size, device_scale_factor};
 +}
 +
++// static
++scoped_refptr<const SnapshotProcessor::BoundsTable>
++SnapshotProcessor::BuildTreeAndComputeBounds(
++    scoped_refptr<const AXNodeIndex> node_index,
++    std::vector<size_t> positions,
++    float device_scale_factor,
++    bool include_unclipped,
++    scoped_refptr<RequestCancellation> cancellation) {
++  if (IsRequestCancelled(cancellation.get())) {
++    return nullptr;
++  }
++  TRACE_EVENT("browser", "BrowserOS::ComputeBounds", "nodes",
++              positions.size());
++  auto ax_tree = std::make_unique<ui::AXTree>(node_index->snapshot()->data);
++  return ComputeBoundsTable(std::move(ax_tree), std::move(node_index),
++                            std::move(positions), device_scale_factor,
++                            include_unclipped);
++}
++
 +void SnapshotProcessor::ProcessAccessibilityTree(
-+    const ui::AXTreeUpdate& tree_update,
++    browseros::SharedAXTreeUpdate snapshot,
 +    int tab_id,
 +    uint32_t snapshot_id,
 +    content::WebContents* web_contents,
-+    base::OnceCallback<void(SnapshotProcessingResult)> callback) {
++    const SnapshotOptions& options,
++    base::OnceCallback<void(SnapshotProcessingResult)> callback,
++    NodeIdResolver node_id_resolver,
++    ChunkCallback chunk_callback) {
 +  base::TimeTicks start_time = base::TimeTicks::Now();
 +  
 +  // Extract viewport info from WebContents on UI thread
 +  auto [viewport_size, device_scale_factor] = ExtractViewportInfo(web_contents);
 +  
-+  // Build node ID map, parent map and children map for efficient lookup
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  std::unordered_map<int32_t, int32_t> parent_map;
-+  std::unordered_map<int32_t, std::vector<int32_t>> children_map;
-+  
-+  for (const auto& node : tree_update.nodes) {
-+    node_map[node.id] = node;
-+    // Build parent and children relationships
-+    for (int32_t child_id : node.child_ids) {
-+      parent_map[child_id] = node.id;
-+      children_map[node.id].push_back(child_id);
-+    }
-+  }
-+  
-+  // Clear previous mappings for this tab
-+  GetNodeIdMappings()[tab_id].clear();
-+
-+  // Create an AXTree from the tree update for accurate bounds computation
-+  std::unique_ptr<ui::AXTree> ax_tree = std::make_unique<ui::AXTree>(tree_update);
++  // Build the shared, read-only node index once. It references the shared
++  // snapshot, so neither the index nor the batches copy the node data.
++  const ui::AXTreeUpdate& tree_update = snapshot->data;
++  auto node_index = base::MakeRefCounted<AXNodeIndex>(snapshot);
 +  
-+  if (!ax_tree) {
-+    LOG(ERROR) << "[browseros] Failed to create AXTree from update";
-+    SnapshotProcessingResult result;
-+    result.nodes_processed = 0;
-+    result.processing_time_ms = 0;
-+    std::move(callback).Run(std::move(result));
-+    return;
++  // Clear previous mappings for this tab (and evict least recently used tabs)
++  BrowserOSNodeMappingStore* mapping_store =
++      web_contents
++          ? BrowserOSNodeMappingStore::Get(web_contents->GetBrowserContext())
++          : nullptr;
++  if (mapping_store) {
++    mapping_store->Reset(tab_id);
 +  }
 +  
-+  LOG(INFO) << "[browseros] Created AXTree with " << tree_update.nodes.size() 
-+            << " nodes for bounds computation";
-+  
 +  // Prepare processing context using RefCounted
 +  auto context = base::MakeRefCounted<ProcessingContext>();
 +  context->snapshot.snapshot_id = snapshot_id;
 +  context->snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +  context->tab_id = tab_id;
-+  context->node_map = std::move(node_map);
-+  context->parent_map = std::move(parent_map); 
-+  context->children_map = std::move(children_map);
-+  context->ax_tree = std::move(ax_tree);  // Store AXTree for bounds computation
++  if (mapping_store) {
++    context->mapping_store = mapping_store->GetWeakPtr();
++  }
++  context->node_index = node_index;
 +  context->device_scale_factor = device_scale_factor;  // For CSS pixel conversion
 +  context->viewport_size = viewport_size;  // For visibility checks
 +  context->start_time = start_time;
@@ -592,19 +1047,42 @@ index 0000000000000..885942336dcd6
 +    context->tree_id = tree_update.tree_data.tree_id;
 +  }
 +  
-+  // Viewport size is passed in but not currently used for viewport bounds calculation
-+  // TODO: Implement proper viewport detection if needed
++  context->options = options;  // Viewport scoping and budgets
++  if (options.reuse_templates && web_contents &&
++      (options.attributes.depth ||
++       options.attributes.Has(NodeAttribute::kPath))) {
++    context->templates = SnapshotTemplates::ForOrigin(
++        web_contents->GetPrimaryMainFrame()->GetLastCommittedOrigin());
++  }
 +  context->callback = std::move(callback);
++  context->node_id_resolver = std::move(node_id_resolver);
++  context->chunk_callback = std::move(chunk_callback);
 +  context->processed_batches = 0;
++  context->total_batches = 0;
++
++  if (IsRequestCancelled(options.cancellation.get())) {
++    FinishCancelled(std::move(context));
++    return;
++  }
 +  
-+  // Collect all nodes to process and filter
-+  std::vector<ui::AXNodeData> nodes_to_process;
-+  for (const auto& node : tree_update.nodes) {
-+    // Skip invisible, ignored, or non-interactive nodes
-+    if (ShouldSkipNode(node)) {
-+      continue;
++  // Collect positions of all nodes to process and filter
++  // Each node is classified here once; the type table is reused by the
++  // budget pass and the batches
++  scoped_refptr<const SnapshotPruneMatcher> prune_rules = options.prune_rules;
++  if (!prune_rules && web_contents) {
++    if (auto* site_rules =
++            BrowserOSPruneRules::Get(web_contents->GetBrowserContext())) {
++      prune_rules = site_rules->ForUrl(web_contents->GetLastCommittedURL());
 +    }
-+    nodes_to_process.push_back(node);
++  }
++  auto node_types = base::MakeRefCounted<NodeTypeTable>();
++  size_t pruned = 0;
++  std::vector<size_t> nodes_to_process = CollectCandidatePositions(
++      *node_index, *node_types, prune_rules.get(), &pruned);
++  context->node_types = std::move(node_types);
++  if (pruned > 0) {
++    VLOG(1) << "[browseros] Pruned " << pruned << " node(s) from tab "
++            << tab_id << "'s snapshot";
 +  }
 +  
 +  context->total_nodes = nodes_to_process.size();
@@ -622,31 +1100,224 @@ index 0000000000000..885942336dcd6
 +    return;
 +  }
 +  
-+  // Process nodes in batches using ThreadPool
-+  const size_t batch_size = 100;  // Process 100 nodes per batch
++  VLOG(1) << "[browseros] " << nodes_to_process.size() << " of "
++          << tree_update.nodes.size() << " nodes are snapshot candidates";
++
++  // Build the AXTree and the bounds table in one ThreadPool task, so the
++  // UI thread never pays for the tree and pages without candidates never
++  // build one. The AXTree is only ever touched there, then the reply fans
++  // the batches out.
++  context->candidate_positions = std::move(nodes_to_process);
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {options.priority},
++      base::BindOnce(&BuildTreeAndComputeBounds,
++                     node_index,
++                     context->candidate_positions,
++                     context->device_scale_factor,  // For CSS pixel conversion
++                     // Margin checks need bounds before clipping
++                     options.viewport_only && options.viewport_margin > 0.0f,
++                     options.cancellation),
++      base::BindOnce(&SnapshotProcessor::OnBoundsTableComputed, context));
++}
++
++namespace {
++
++constexpr size_t kMinBatchSize = 64;
++constexpr size_t kMaxBatchSize = 1024;
++// Enough batches per worker for work stealing to even out slow batches
++constexpr size_t kBatchesPerWorker = 4;
++
++// Workers to use for batch processing; one core is left for rendering
++size_t GetMaxSnapshotWorkers(int num_processors) {
++  return static_cast<size_t>(std::max(1, num_processors - 1));
++}
++
++size_t ComputeBatchSize(size_t node_count, int num_processors) {
++  const size_t target_batches =
++      GetMaxSnapshotWorkers(num_processors) * kBatchesPerWorker;
++  const size_t batch_size = (node_count + target_batches - 1) / target_batches;
++  return std::clamp(batch_size, kMinBatchSize, kMaxBatchSize);
++}
++
++// Processes the batches of one snapshot as a single base::PostJob job.
++// Workers claim the next unprocessed batch from an atomic cursor, so faster
++// workers take over more of the remaining ranges. The request's
++// cancellation is checked before every claim: the first worker to see it
++// claims all remaining batches at once and reports the cancellation.
++class SnapshotBatchJob : public base::RefCountedThreadSafe<SnapshotBatchJob> {
++ public:
++  using BatchDoneCallback = base::RepeatingCallback<void(
++      size_t batch_index,
++      std::vector<SnapshotProcessor::ProcessedNode> results)>;
++
++  SnapshotBatchJob(
++      scoped_refptr<const AXNodeIndex> node_index,
++      scoped_refptr<const SnapshotProcessor::BoundsTable> bounds_table,
++      scoped_refptr<const SnapshotProcessor::NodeTypeTable> node_types,
++      scoped_refptr<const SnapshotTemplates::Table> node_templates,
++      std::vector<size_t> positions,
++      size_t batch_size,
++      const NodeAttributeMask& attributes,
++      scoped_refptr<RequestCancellation> cancellation,
++      BatchDoneCallback on_batch_done,
++      base::OnceClosure on_cancelled)
++      : node_index_(std::move(node_index)),
++        bounds_table_(std::move(bounds_table)),
++        node_types_(std::move(node_types)),
++        node_templates_(std::move(node_templates)),
++        positions_(std::move(positions)),
++        batch_size_(batch_size),
++        attributes_(attributes),
++        num_batches_((positions_.size() + batch_size - 1) / batch_size),
++        max_workers_(
++            GetMaxSnapshotWorkers(base::SysInfo::NumberOfProcessors())),
++        cancellation_(std::move(cancellation)),
++        on_batch_done_(std::move(on_batch_done)),
++        on_cancelled_(std::move(on_cancelled)) {}
++
++  SnapshotBatchJob(const SnapshotBatchJob&) = delete;
++  SnapshotBatchJob& operator=(const SnapshotBatchJob&) = delete;
++
++  void Run(base::JobDelegate* delegate) {
++    while (!delegate->ShouldYield()) {
++      if (IsRequestCancelled(cancellation_.get())) {
++        // Only the worker that stops the job sees unclaimed batches
++        if (next_batch_.exchange(num_batches_, std::memory_order_relaxed) <
++            num_batches_) {
++          std::move(on_cancelled_).Run();
++        }
++        return;
++      }
++
++      const size_t batch_index =
++          next_batch_.fetch_add(1, std::memory_order_relaxed);
++      if (batch_index >= num_batches_) {
++        return;
++      }
++
++      const size_t begin = batch_index * batch_size_;
++      const size_t end = std::min(begin + batch_size_, positions_.size());
++      std::vector<size_t> batch(positions_.begin() + begin,
++                                positions_.begin() + end);
++      on_batch_done_.Run(
++          batch_index,
++          SnapshotProcessor::ProcessNodeBatch(
++              node_index_, bounds_table_, node_types_, std::move(batch),
++              begin + 1,  // Node IDs start at 1
++              attributes_, node_templates_));
++    }
++  }
++
++  size_t GetMaxConcurrency(size_t worker_count) const {
++    const size_t claimed = next_batch_.load(std::memory_order_relaxed);
++    const size_t remaining =
++        claimed >= num_batches_ ? 0 : num_batches_ - claimed;
++    return std::min(remaining, max_workers_);
++  }
++
++ private:
++  friend class base::RefCountedThreadSafe<SnapshotBatchJob>;
++  ~SnapshotBatchJob() = default;
++
++  const scoped_refptr<const AXNodeIndex> node_index_;
++  const scoped_refptr<const SnapshotProcessor::BoundsTable> bounds_table_;
++  const scoped_refptr<const SnapshotProcessor::NodeTypeTable> node_types_;
++  const scoped_refptr<const SnapshotTemplates::Table> node_templates_;
++  const std::vector<size_t> positions_;
++  const size_t batch_size_;
++  const NodeAttributeMask attributes_;
++  const size_t num_batches_;
++  const size_t max_workers_;
++  std::atomic<size_t> next_batch_{0};
++  const scoped_refptr<RequestCancellation> cancellation_;
++  // Both post to the UI thread
++  const BatchDoneCallback on_batch_done_;
++  base::OnceClosure on_cancelled_;
++};
++
++}  // namespace
++
++// static
++void SnapshotProcessor::OnBoundsTableComputed(
++    scoped_refptr<ProcessingContext> context,
++    scoped_refptr<const BoundsTable> bounds_table) {
++  if (!bounds_table ||
++      IsRequestCancelled(context->options.cancellation.get())) {
++    FinishCancelled(std::move(context));
++    return;
++  }
++
++  if (context->options.viewport_only || context->options.max_nodes > 0) {
++    context->candidate_positions = ApplyViewportAndNodeBudget(
++        *context->node_types, *bounds_table,
++        std::move(context->candidate_positions), context->options,
++        gfx::SizeF(context->viewport_size), &context->truncated);
++  }
++  const std::vector<size_t>& nodes_to_process = context->candidate_positions;
++  if (TabNodeMappings* tab_mappings =
++          context->mapping_store
++              ? context->mapping_store->Find(context->tab_id)
++              : nullptr) {
++    tab_mappings->nodes.reserve(nodes_to_process.size());
++  }
++
++  // Everything was scoped out; nothing to batch
++  if (nodes_to_process.empty()) {
++    base::TimeDelta processing_time =
++        base::TimeTicks::Now() - context->start_time;
++    context->snapshot.processing_time_ms = processing_time.InMilliseconds();
++    context->snapshot.truncated = context->truncated;
++
++    SnapshotProcessingResult result;
++    result.snapshot = std::move(context->snapshot);
++    result.nodes_processed = 0;
++    result.processing_time_ms = processing_time.InMilliseconds();
++    std::move(context->callback).Run(std::move(result));
++    return;
++  }
++
++  // Resolved here on the UI thread, the only one adding templates; on
++  // repetitive pages most nodes find theirs
++  scoped_refptr<const SnapshotTemplates::Table> node_templates;
++  if (context->templates) {
++    size_t hits = 0;
++    size_t added = 0;
++    node_templates = context->templates->Resolve(
++        *context->node_index, nodes_to_process, &hits, &added);
++    VLOG(1) << "[browseros] " << hits << " of " << nodes_to_process.size()
++            << " nodes reused a template, " << added << " template(s) added";
++  }
++
++  // Size batches from the node count and core count, then let one job
++  // work through them
++  const size_t batch_size = ComputeBatchSize(
++      nodes_to_process.size(), base::SysInfo::NumberOfProcessors());
 +  size_t num_batches = (nodes_to_process.size() + batch_size - 1) / batch_size;
 +  context->total_batches = num_batches;
-+  
-+  for (size_t i = 0; i < nodes_to_process.size(); i += batch_size) {
-+    size_t end = std::min(i + batch_size, nodes_to_process.size());
-+    std::vector<ui::AXNodeData> batch(
-+        std::make_move_iterator(nodes_to_process.begin() + i),
-+        std::make_move_iterator(nodes_to_process.begin() + end));
-+    uint32_t start_node_id = i + 1;  // Node IDs start at 1
-+    
-+    // Post task to ThreadPool and handle result on UI thread
-+    base::ThreadPool::PostTaskAndReplyWithResult(
-+        FROM_HERE,
-+        {base::TaskPriority::USER_VISIBLE},
-+        base::BindOnce(&SnapshotProcessor::ProcessNodeBatch, 
-+                       std::move(batch), 
-+                       context->node_map,
-+                       context->ax_tree.get(),  // Pass AXTree pointer for bounds computation
-+                       start_node_id,
-+                       context->device_scale_factor),  // Pass DSF for CSS pixel conversion
-+        base::BindOnce(&SnapshotProcessor::OnBatchProcessed,
-+                       context));
-+  }
++  context->batch_size = batch_size;
++  context->finished_batches.assign(num_batches, false);
++  // One slot per node, filled in by its batch
++  context->snapshot.elements.resize(nodes_to_process.size());
++
++  VLOG(1) << "[browseros] Processing " << nodes_to_process.size()
++          << " nodes in " << num_batches << " batches of " << batch_size;
++
++  // Results are handed back to the UI thread one batch at a time
++  auto job = base::MakeRefCounted<SnapshotBatchJob>(
++      context->node_index, std::move(bounds_table), context->node_types,
++      std::move(node_templates), context->candidate_positions, batch_size,
++      context->options.attributes, context->options.cancellation,
++      base::BindPostTask(
++          content::GetUIThreadTaskRunner({}),
++          base::BindRepeating(&SnapshotProcessor::OnBatchProcessed, context)),
++      base::BindPostTask(
++          content::GetUIThreadTaskRunner({}),
++          base::BindOnce(&SnapshotProcessor::FinishCancelled, context)));
++  base::PostJob(FROM_HERE, {context->options.priority},
++                base::BindRepeating(&SnapshotBatchJob::Run, job),
++                base::BindRepeating(&SnapshotBatchJob::GetMaxConcurrency, job))
++      .Detach();
 +}
 +
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h
 new file mode 100644
-index 0000000000000..5c85cd73b26f3
+index 0000000000000..57406e4e1b3f6
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h
-@@ -0,0 +1,111 @@
+@@ -0,0 +1,286 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,14 +12,26 @@ index 0000000000000..5c85cd73b26f3
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PROCESSOR_H_
 +
 +#include <cstdint>
++#include <memory>
 +#include <string>
 +#include <unordered_map>
 +#include <vector>
 +
 +#include "base/functional/callback.h"
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/ref_counted.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/task/task_traits.h"
++#include "chrome/browser/browseros/core/browseros_ax_snapshot_cache.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_attributes.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_prune_rules.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_request_cancellation.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.h"
 +#include "chrome/common/extensions/api/browser_os.h"
++#include "ui/accessibility/ax_node_id_forward.h"
 +#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/size_f.h"
++#include "ui/gfx/geometry/vector2d_f.h"
 +
 +namespace content {
 +class WebContents;
@@ -28,6 +40,7 @@ index 0000000000000..5c85cd73b26f3
 +namespace ui {
 +class AXNode;
 +class AXTree;
++class AXTreeID;
 +struct AXNodeData;
 +struct AXTreeUpdate;
 +enum class AXCoordinateSystem;
@@ -37,11 +50,42 @@ index 0000000000000..5c85cd73b26f3
 +namespace extensions {
 +namespace api {
 +
++class AXNodeIndex;
++
 +// Result of snapshot processing
 +struct SnapshotProcessingResult {
 +  browser_os::InteractiveSnapshot snapshot;
 +  int nodes_processed = 0;
 +  int64_t processing_time_ms = 0;
++  // Rough JSON size of |snapshot.elements|, for telemetry
++  size_t estimated_bytes = 0;
++  // Stopped early through SnapshotOptions::cancellation; |snapshot| holds
++  // nothing useful
++  bool cancelled = false;
++};
++
++// Scoping and budget for a snapshot (see InteractiveSnapshotOptions)
++struct SnapshotOptions {
++  // Only keep nodes intersecting the viewport grown by |viewport_margin|
++  bool viewport_only = false;
++  float viewport_margin = 0.0f;  // CSS pixels
++  // 0 means unlimited
++  size_t max_nodes = 0;
++  size_t max_bytes = 0;
++  // Priority of the ThreadPool work; BEST_EFFORT for background agents
++  base::TaskPriority priority = base::TaskPriority::USER_VISIBLE;
++  // Attributes computed and returned for each node
++  NodeAttributeMask attributes;
++  // Checked between stages and node batches; once cancelled the callback
++  // runs with SnapshotProcessingResult::cancelled and no further batches
++  // are processed
++  scoped_refptr<RequestCancellation> cancellation;
++  // Nodes it matches are left out with their subtrees. Taken from the
++  // profile's rules for the tab's site when not set.
++  scoped_refptr<const SnapshotPruneMatcher> prune_rules;
++  // Take the path and depth of nodes from the site's SnapshotTemplates, so
++  // repeated structures are only walked once. The result is the same.
++  bool reuse_templates = true;
 +};
 +
 +// Processes accessibility trees into interactive snapshots with parallel processing
@@ -61,33 +105,124 @@ index 0000000000000..5c85cd73b26f3
 +    browser_os::InteractiveNodeType node_type;
 +    std::string name;
 +    gfx::RectF absolute_bounds;
-+    // All attributes stored as key-value pairs
-+    std::unordered_map<std::string, std::string> attributes;
++    // Computed attributes; serialized to a dictionary only for the result
++    NodeAttributes attributes;
 +  };
 +
++  // Precomputed bounds for a single node, in CSS pixels
++  struct NodeBounds {
++    gfx::RectF bounds;
++    bool offscreen = false;
++    // Unclipped bounds, only filled in when a viewport margin is requested:
++    // clipped bounds of offscreen nodes are clamped to the container edge.
++    gfx::RectF unclipped_bounds;
++  };
++
++  // Immutable bounds table indexed by AXNodeIndex position. Built once per
++  // snapshot and read lock-free by every batch.
++  using BoundsTable = base::RefCountedData<std::vector<NodeBounds>>;
++
++  // Maps an AX node to the nodeId reported to the caller. Used for stable
++  // nodeIds that survive between snapshots of the same document.
++  using NodeIdResolver =
++      base::RepeatingCallback<uint32_t(const ui::AXTreeID&, int32_t)>;
++
++  // Receives the nodes of one batch, in document order of batches, when a
++  // snapshot is streamed. |chunk_index| counts from 0.
++  using ChunkCallback = base::RepeatingCallback<void(
++      size_t chunk_index,
++      std::vector<browser_os::InteractiveNode> nodes)>;
++
 +  SnapshotProcessor() = default;
 +  ~SnapshotProcessor() = default;
 +
 +  // Main processing function - handles all threading internally
 +  // This function processes the accessibility tree into an interactive snapshot
 +  // using parallel processing on the thread pool. Extracts viewport info from
-+  // web_contents on UI thread before processing.
++  // web_contents on UI thread before processing. If |node_id_resolver| is
++  // set it assigns nodeIds (on the UI thread) instead of the per-snapshot
++  // sequential numbering. If |chunk_callback| is set the snapshot is
++  // streamed: nodes are handed to it batch by batch instead of being
++  // collected into the result, whose |elements| stays empty. maxBytes is not
++  // applied to streamed snapshots.
 +  static void ProcessAccessibilityTree(
-+      const ui::AXTreeUpdate& tree_update,
++      browseros::SharedAXTreeUpdate snapshot,
 +      int tab_id,
 +      uint32_t snapshot_id,
 +      content::WebContents* web_contents,
-+      base::OnceCallback<void(SnapshotProcessingResult)> callback);
++      const SnapshotOptions& options,
++      base::OnceCallback<void(SnapshotProcessingResult)> callback,
++      NodeIdResolver node_id_resolver = NodeIdResolver(),
++      ChunkCallback chunk_callback = ChunkCallback());
++
++  // Interactive type of every node, indexed by AXNodeIndex position, with
++  // kOther for nodes that are not candidates. Filled in by the filter pass
++  // so later passes never classify a node again.
++  using NodeTypeTable =
++      base::RefCountedData<std::vector<browser_os::InteractiveNodeType>>;
++
++  // Returns the positions in |node_index| of the nodes that can go into a
++  // snapshot (visible interactive nodes), in tree-update order. The type of
++  // each node is stored in |node_types|. Nodes matching |prune_rules|, and
++  // everything below them, are not candidates; |pruned|, if given, is set
++  // to the number of those nodes.
++  static std::vector<size_t> CollectCandidatePositions(
++      const AXNodeIndex& node_index,
++      NodeTypeTable& node_types,
++      const SnapshotPruneMatcher* prune_rules = nullptr,
++      size_t* pruned = nullptr);
++
++  // Converts a processed node to its IDL representation, with the
++  // attributes in |attributes|
++  static browser_os::InteractiveNode ToInteractiveNode(
++      const ProcessedNode& node_data,
++      const NodeAttributeMask& attributes = NodeAttributeMask::All());
++
++  // Computes bounds for the nodes at |positions| in a single pass over
++  // |ax_tree|. This is the only code that reads the AXTree, so the tree is
++  // never accessed from more than one thread; it is destroyed once the table
++  // is built. device_scale_factor is used to convert physical pixels to CSS
++  // pixels. |include_unclipped| also fills NodeBounds::unclipped_bounds.
++  static scoped_refptr<const BoundsTable> ComputeBoundsTable(
++      std::unique_ptr<ui::AXTree> ax_tree,
++      scoped_refptr<const AXNodeIndex> node_index,
++      std::vector<size_t> positions,
++      float device_scale_factor = 1.0f,
++      bool include_unclipped = false);
++
++  // Applies |options| to |positions| (candidate nodes, typed in
++  // |node_types|): drops nodes outside the viewport and keeps at most
++  // max_nodes of them by type priority. The result stays in tree-update
++  // order. Sets |truncated| if anything was dropped.
++  static std::vector<size_t> ApplyViewportAndNodeBudget(
++      const NodeTypeTable& node_types,
++      const BoundsTable& bounds_table,
++      std::vector<size_t> positions,
++      const SnapshotOptions& options,
++      const gfx::SizeF& viewport_size,
++      bool* truncated);
++
++  // Keeps the highest-priority elements of |snapshot| that fit in
++  // |max_bytes|; returns the nodeIds that were dropped.
++  static std::vector<uint32_t> ApplyByteBudget(
++      browser_os::InteractiveSnapshot& snapshot,
++      size_t max_bytes);
 +
 +  // Process a batch of nodes (exposed for testing)
-+  // The ax_tree is used to compute accurate bounds for each node
-+  // device_scale_factor is used to convert physical pixels to CSS pixels
++  // |batch_positions| are candidate positions into |node_index|, as
++  // returned by CollectCandidatePositions(); the index, |bounds_table| and
++  // |node_types| are shared read-only by every batch, so no node data is
++  // copied per batch and bounds and types are an O(1) lookup.
++  // Only the attributes in |attributes| are computed. Nodes with a
++  // template in |node_templates| take their path and depth from it.
 +  static std::vector<ProcessedNode> ProcessNodeBatch(
-+      const std::vector<ui::AXNodeData>& nodes_to_process,
-+      const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+      ui::AXTree* ax_tree,
++      scoped_refptr<const AXNodeIndex> node_index,
++      scoped_refptr<const BoundsTable> bounds_table,
++      scoped_refptr<const NodeTypeTable> node_types,
++      std::vector<size_t> batch_positions,
 +      uint32_t start_node_id,
-+      float device_scale_factor = 1.0f);
++      const NodeAttributeMask& attributes = NodeAttributeMask::All(),
++      scoped_refptr<const SnapshotTemplates::Table> node_templates = nullptr);
 +
 + private:
 +  // Internal processing context
@@ -103,10 +238,50 @@ index 0000000000000..5c85cd73b26f3
 +                                   float device_scale_factor = 1.0f,
 +                                   bool* out_offscreen = nullptr);
 +  
++  // Builds the AXTree of |node_index|'s snapshot and then its bounds table.
++  // Runs on the ThreadPool.
++  // Returns null without building anything if |cancellation| is cancelled.
++  static scoped_refptr<const BoundsTable> BuildTreeAndComputeBounds(
++      scoped_refptr<const AXNodeIndex> node_index,
++      std::vector<size_t> positions,
++      float device_scale_factor,
++      bool include_unclipped,
++      scoped_refptr<RequestCancellation> cancellation);
++
++  // Placement of a child frame's content in main frame CSS pixels
++  struct FrameTransform {
++    gfx::Vector2dF offset;
++    // The visible part of the hosting iframe
++    gfx::RectF clip;
++  };
++  using FrameTransformCache = std::unordered_map<ui::AXNodeID, FrameTransform>;
++
++  // Returns the root of the innermost child frame containing |node|, or
++  // nullptr for nodes of the main frame.
++  static const ui::AXNode* GetChildFrameRoot(const ui::AXNode* node);
++
++  // Returns the transform of the child frame rooted at |frame_root|,
++  // computing and caching it (and those of enclosing frames) on first use.
++  static const FrameTransform& GetFrameTransform(
++      ui::AXTree* tree,
++      const ui::AXNode* frame_root,
++      float device_scale_factor,
++      FrameTransformCache& cache);
++
++  // Called on the UI thread once the bounds table is built (null if the
++  // request was cancelled); fans out batches
++  static void OnBoundsTableComputed(
++      scoped_refptr<ProcessingContext> context,
++      scoped_refptr<const BoundsTable> bounds_table);
++
 +  // Batch processing callback
 +  static void OnBatchProcessed(scoped_refptr<ProcessingContext> context,
++                               size_t batch_index,
 +                               std::vector<ProcessedNode> batch_results);
 +
++  // Runs the callback of a cancelled snapshot, unless it already ran
++  static void FinishCancelled(scoped_refptr<ProcessingContext> context);
++
 +  SnapshotProcessor(const SnapshotProcessor&) = delete;
 +  SnapshotProcessor& operator=(const SnapshotProcessor&) = delete;
 +};
@@ -0,0 +1,180 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.cc
+new file mode 100644
+index 0000000000000..f512e7c5b74d8
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.cc
+@@ -0,0 +1,174 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.h"
++
++#include <optional>
++
++#include "base/containers/lru_cache.h"
++#include "base/functional/bind.h"
++#include "base/no_destructor.h"
++#include "base/strings/strcat.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_index.h"
++#include "content/public/browser/browser_thread.h"
++#include "ui/accessibility/ax_enum_util.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "url/origin.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// The templates of the origins snapshotted last
++class TemplateCache {
++ public:
++  static TemplateCache* Get() {
++    static base::NoDestructor<TemplateCache> instance;
++    return instance.get();
++  }
++
++  scoped_refptr<SnapshotTemplates> ForOrigin(const url::Origin& origin) {
++    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++    if (!memory_pressure_registration_) {
++      // Unretained: the cache is never destroyed
++      memory_pressure_registration_ = browseros::AddMemoryPressureHandler(
++          "snapshot_templates",
++          base::BindRepeating(&TemplateCache::OnMemoryPressure,
++                              base::Unretained(this)));
++    }
++
++    auto it = cache_.Get(origin);
++    if (it != cache_.end() && it->second->size() < kMaxNodeTemplates) {
++      return it->second;
++    }
++    // Snapshots still running keep the full set they started with
++    auto templates = base::MakeRefCounted<SnapshotTemplates>();
++    cache_.Put(origin, templates);
++    return templates;
++  }
++
++ private:
++  friend base::NoDestructor<TemplateCache>;
++
++  TemplateCache() = default;
++  ~TemplateCache() = default;
++
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(browseros::ReleasedMemory)> done) {
++    browseros::ReleasedMemory released;
++    for (const auto& [origin, templates] : cache_) {
++      released.items += templates->size();
++    }
++    cache_.Clear();
++    std::move(done).Run(released);
++  }
++
++  base::LRUCache<url::Origin, scoped_refptr<SnapshotTemplates>> cache_{
++      kMaxTemplateOrigins};
++  base::ScopedClosureRunner memory_pressure_registration_;
++};
++
++}  // namespace
++
++SnapshotTemplates::SnapshotTemplates() = default;
++SnapshotTemplates::~SnapshotTemplates() = default;
++
++// static
++scoped_refptr<SnapshotTemplates> SnapshotTemplates::ForOrigin(
++    const url::Origin& origin) {
++  if (origin.opaque()) {
++    return nullptr;
++  }
++  return TemplateCache::Get()->ForOrigin(origin);
++}
++
++scoped_refptr<const SnapshotTemplates::Table> SnapshotTemplates::Resolve(
++    const AXNodeIndex& node_index,
++    const std::vector<size_t>& positions,
++    size_t* hits,
++    size_t* misses) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  auto table = base::MakeRefCounted<Table>();
++  std::vector<const NodeTemplate*>& node_templates = table->data;
++  node_templates.assign(node_index.size(), nullptr);
++
++  // Containers met on the way up, innermost first
++  std::vector<size_t> chain;
++  for (size_t position : positions) {
++    if (node_templates[position]) {
++      continue;  // A container of an earlier node
++    }
++
++    // Walk up to the first container resolved already, or to the root.
++    // Containers are ancestors, which the update lists first; one listed
++    // later is taken as a root, so a malformed chain can't loop.
++    chain.clear();
++    const NodeTemplate* container = nullptr;
++    size_t current = position;
++    while (true) {
++      chain.push_back(current);
++      const int32_t container_id =
++          node_index.at(current).relative_bounds.offset_container_id;
++      if (container_id < 0) {
++        break;
++      }
++      const std::optional<size_t> container_position =
++          node_index.FindPosition(container_id);
++      if (!container_position || *container_position >= current) {
++        break;
++      }
++      if (node_templates[*container_position]) {
++        container = node_templates[*container_position];
++        break;
++      }
++      current = *container_position;
++    }
++
++    const size_t templates_before = templates_.size();
++    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
++      container = GetOrAdd(node_index.at(*it).role, container);
++      node_templates[*it] = container;
++    }
++    if (hits && templates_.size() == templates_before) {
++      (*hits)++;
++    }
++    if (misses) {
++      *misses += templates_.size() - templates_before;
++    }
++  }
++  return table;
++}
++
++const NodeTemplate* SnapshotTemplates::GetOrAdd(ax::mojom::Role role,
++                                                const NodeTemplate* container) {
++  auto it = index_.find({container, role});
++  if (it != index_.end()) {
++    return it->second;
++  }
++
++  NodeTemplate& node_template = templates_.emplace_back();
++  const std::string_view role_name = ui::ToString(role);
++  if (!container) {
++    node_template.path = std::string(role_name);
++    node_template.depth = 1;
++  } else if (container->depth < kMaxPathDepth) {
++    node_template.path =
++        base::StrCat({container->path, kPathSeparator, role_name});
++    node_template.depth = container->depth + 1;
++  } else {
++    // The outermost container falls out of the path
++    std::string_view inner = container->path;
++    inner.remove_prefix(inner.find(kPathSeparator) + kPathSeparator.size());
++    node_template.path = base::StrCat({inner, kPathSeparator, role_name});
++    node_template.depth = kMaxPathDepth;
++  }
++  index_.emplace(std::make_pair(container, role), &node_template);
++  return &node_template;
++}
++
++}  // namespace api
++}  // namespace extensions
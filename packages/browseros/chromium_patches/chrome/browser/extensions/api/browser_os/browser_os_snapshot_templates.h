@@ -0,0 +1,107 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.h
+new file mode 100644
+index 0000000000000..9c72305852c2a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_templates.h
+@@ -0,0 +1,101 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_TEMPLATES_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_TEMPLATES_H_
++
++#include <cstddef>
++#include <deque>
++#include <map>
++#include <string>
++#include <string_view>
++#include <utility>
++#include <vector>
++
++#include "base/memory/raw_ptr.h"
++#include "base/memory/ref_counted.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++
++namespace url {
++class Origin;
++}  // namespace url
++
++namespace extensions {
++namespace api {
++
++class AXNodeIndex;
++
++// Nearest offset containers included in a node's path and depth
++inline constexpr int kMaxPathDepth = 10;
++inline constexpr std::string_view kPathSeparator = " > ";
++
++inline constexpr size_t kMaxTemplateOrigins = 16;
++inline constexpr size_t kMaxNodeTemplates = 8192;
++
++// The structural part of a processed node: its path and depth, which only
++// depend on the roles of the node and of its offset container chain. On
++// search results, listings and inboxes every item repeats the same chain,
++// so its nodes share one template instead of each walking the chain and
++// building the same path string.
++struct NodeTemplate {
++  // Roles of the nearest kMaxPathDepth containers, outermost first
++  std::string path;
++  int depth = 0;
++};
++
++// Templates keyed by structure, kept per origin so the later snapshots of
++// a site reuse those of the first. A template is identified exactly by its
++// role and its container's template; no hash is involved, so a template
++// never stands for a node of another structure.
++//
++// Templates are only ever added, and never move once added, so batches
++// read those of their snapshot on the ThreadPool while the UI thread adds
++// more for the next one. Resolving is UI thread only.
++class SnapshotTemplates : public base::RefCountedThreadSafe<SnapshotTemplates> {
++ public:
++  // Template of each node, indexed by AXNodeIndex position, with null for
++  // nodes that weren't resolved. Shared read-only by the batches.
++  using Table = base::RefCountedData<std::vector<const NodeTemplate*>>;
++
++  SnapshotTemplates();
++
++  SnapshotTemplates(const SnapshotTemplates&) = delete;
++  SnapshotTemplates& operator=(const SnapshotTemplates&) = delete;
++
++  // The templates of |origin|'s pages, or null for opaque origins. Origins
++  // beyond kMaxTemplateOrigins evict the least recently used one, and one
++  // holding kMaxNodeTemplates starts over.
++  static scoped_refptr<SnapshotTemplates> ForOrigin(const url::Origin& origin);
++
++  // Resolves the template of the nodes at |positions|, adding those not
++  // seen before. |hits| and |misses|, if given, count the nodes whose
++  // template already existed and the templates added.
++  scoped_refptr<const Table> Resolve(const AXNodeIndex& node_index,
++                                     const std::vector<size_t>& positions,
++                                     size_t* hits = nullptr,
++                                     size_t* misses = nullptr);
++
++  size_t size() const { return templates_.size(); }
++
++ private:
++  friend class base::RefCountedThreadSafe<SnapshotTemplates>;
++  ~SnapshotTemplates();
++
++  // The template of a node of |role| whose container has |container|,
++  // added if new
++  const NodeTemplate* GetOrAdd(ax::mojom::Role role,
++                               const NodeTemplate* container);
++
++  // Stable addresses: a deque doesn't move its elements on push_back
++  std::deque<NodeTemplate> templates_;
++  // (container template, role) -> template; null container for the roots
++  std::map<std::pair<const NodeTemplate*, ax::mojom::Role>,
++           raw_ptr<const NodeTemplate>>
++      index_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_TEMPLATES_H_
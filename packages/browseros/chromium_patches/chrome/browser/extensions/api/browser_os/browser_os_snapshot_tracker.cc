@@ -0,0 +1,418 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.cc
+new file mode 100644
+index 0000000000000..3364522995e9b
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.cc
+@@ -0,0 +1,412 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.h"
++
++#include <algorithm>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/functional/bind.h"
++#include "base/hash/hash.h"
++#include "base/logging.h"
++#include "base/strings/stringprintf.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "content/public/browser/browser_accessibility_state.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_mode.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Automation is done with a tab once nothing has asked for accessibility for
++// this long. Longer than the maximum waitForNode timeout.
++constexpr base::TimeDelta kAccessibilityIdleTimeout = base::Minutes(10);
++
++// Sample rate for the per-tab accessibility cost metric
++constexpr double kAccessibilityCostSampleRate = 0.1;
++
++// Snapshots per tab kept for diffSnapshots
++constexpr size_t kMaxDiffSnapshots = 8;
++
++// Hashes everything a client can observe about a node, so two snapshots of
++// the same nodeId compare equal only if the serialized node is identical.
++uint32_t FingerprintNode(const browser_os::InteractiveNode& node) {
++  std::string key = base::StringPrintf(
++      "%d|%s|", static_cast<int>(node.type),
++      node.name ? node.name->c_str() : "");
++  if (node.rect) {
++    base::StringAppendF(&key, "%.1f,%.1f,%.1f,%.1f|", node.rect->x,
++                        node.rect->y, node.rect->width, node.rect->height);
++  }
++  if (node.attributes) {
++    // base::Value::Dict iterates in key order, so this is deterministic
++    for (const auto [attr_key, attr_value] :
++         node.attributes->additional_properties) {
++      key += attr_key;
++      key += '=';
++      if (attr_value.is_string()) {
++        key += attr_value.GetString();
++      }
++      key += ';';
++    }
++  }
++  return base::PersistentHash(key);
++}
++
++// Hashes what a client sees of a mapped node apart from its rect and
++// viewport state, which only change when the node moves
++uint32_t HashNodeContent(const NodeInfo& info) {
++  std::string key = base::StringPrintf(
++      "%d|%d|%d|%s|", static_cast<int>(info.node_type),
++      static_cast<int>(info.attributes.role), info.attributes.depth,
++      info.name.c_str());
++  for (const auto& [attribute, value] : info.attributes.string_attributes) {
++    base::StringAppendF(&key, "%d=", static_cast<int>(attribute));
++    key += value;
++    key += ';';
++  }
++  return base::PersistentHash(key);
++}
++
++uint32_t HashNodeRect(const NodeInfo& info) {
++  return base::PersistentHash(base::StringPrintf(
++      "%.1f,%.1f,%.1f,%.1f", info.bounds.x(), info.bounds.y(),
++      info.bounds.width(), info.bounds.height()));
++}
++
++}  // namespace
++
++// NodeIdRemap implementation
++NodeIdRemap::NodeIdRemap() = default;
++NodeIdRemap::~NodeIdRemap() = default;
++
++uint32_t NodeIdRemap::Resolve(const ui::AXTreeID& tree_id,
++                              int32_t ax_node_id) {
++  if (tree_id != tree_id_) {
++    Reset();
++    tree_id_ = tree_id;
++  }
++
++  auto [it, inserted] = ids_.try_emplace(ax_node_id, next_id_);
++  if (inserted) {
++    next_id_++;
++  }
++  return it->second;
++}
++
++void NodeIdRemap::Reset() {
++  tree_id_ = ui::AXTreeID();
++  ids_.clear();
++  next_id_ = 1;
++}
++
++// BrowserOSSnapshotTracker implementation
++BrowserOSSnapshotTracker::BrowserOSSnapshotTracker(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSSnapshotTracker>(*web_contents),
++      tab_id_(ExtensionTabUtil::GetTabId(web_contents)),
++      node_id_remap_(base::MakeRefCounted<NodeIdRemap>()) {}
++
++BrowserOSSnapshotTracker::~BrowserOSSnapshotTracker() {
++  for (auto& [key, callbacks] : pending_snapshots_) {
++    for (auto& callback : callbacks) {
++      std::move(callback).Run(nullptr);
++    }
++  }
++}
++
++void BrowserOSSnapshotTracker::EnsureAccessibilityEnabled() {
++  accessibility_idle_timer_.Start(
++      FROM_HERE, kAccessibilityIdleTimeout,
++      base::BindOnce(&BrowserOSSnapshotTracker::OnAccessibilityIdle,
++                     base::Unretained(this)));
++  if (accessibility_mode_) {
++    return;
++  }
++
++  accessibility_mode_ =
++      content::BrowserAccessibilityState::GetInstance()
++          ->CreateScopedModeForWebContents(web_contents(),
++                                           ui::AXMode::kWebContents);
++  accessibility_enabled_time_ = base::TimeTicks::Now();
++  accessibility_event_count_ = 0;
++  accessibility_updated_nodes_ = 0;
++  // Nothing observed before this point can be trusted as "unchanged"
++  generation_++;
++  VLOG(1) << "[browseros] Enabled accessibility for incremental snapshots";
++}
++
++bool BrowserOSSnapshotTracker::IsUnchangedSince(
++    uint32_t base_snapshot_id) const {
++  return base_snapshot_id_ && *base_snapshot_id_ == base_snapshot_id &&
++         base_generation_ == generation_;
++}
++
++void BrowserOSSnapshotTracker::RecordUnchangedSnapshot(uint32_t snapshot_id) {
++  // The repeated snapshot is identical, so its kept copy is shared
++  if (base_snapshot_id_) {
++    if (const DiffSnapshot* base = FindDiffSnapshot(*base_snapshot_id_)) {
++      diff_history_.emplace_back(snapshot_id, base);
++      if (diff_history_.size() > kMaxDiffSnapshots) {
++        diff_history_.pop_front();
++      }
++    }
++  }
++  base_snapshot_id_ = snapshot_id;
++}
++
++bool BrowserOSSnapshotTracker::ApplyDelta(
++    std::optional<uint32_t> base_snapshot_id,
++    uint64_t request_generation,
++    browser_os::InteractiveSnapshot& snapshot) {
++  const bool as_delta = base_snapshot_id && base_snapshot_id_ &&
++                        *base_snapshot_id == *base_snapshot_id_;
++
++  std::unordered_map<uint32_t, uint32_t> fingerprints;
++  fingerprints.reserve(snapshot.elements.size());
++  std::vector<browser_os::InteractiveNode> changed;
++
++  for (auto& node : snapshot.elements) {
++    const uint32_t node_id = static_cast<uint32_t>(node.node_id);
++    const uint32_t fingerprint = FingerprintNode(node);
++    fingerprints[node_id] = fingerprint;
++
++    if (!as_delta) {
++      continue;
++    }
++    auto base_it = base_fingerprints_.find(node_id);
++    if (base_it != base_fingerprints_.end() &&
++        base_it->second == fingerprint) {
++      continue;  // Unchanged since the base snapshot
++    }
++    changed.push_back(std::move(node));
++  }
++
++  if (as_delta) {
++    std::vector<int> removed;
++    for (const auto& [node_id, fingerprint] : base_fingerprints_) {
++      if (!fingerprints.contains(node_id)) {
++        removed.push_back(static_cast<int>(node_id));
++      }
++    }
++    std::sort(removed.begin(), removed.end());
++
++    VLOG(1) << "[browseros] Incremental snapshot: " << changed.size()
++            << " added/changed, " << removed.size() << " removed (of "
++            << fingerprints.size() << " nodes)";
++
++    snapshot.elements = std::move(changed);
++    snapshot.base_snapshot_id = static_cast<int>(*base_snapshot_id);
++    snapshot.removed_node_ids = std::move(removed);
++  }
++
++  base_fingerprints_ = std::move(fingerprints);
++  base_snapshot_id_ = static_cast<uint32_t>(snapshot.snapshot_id);
++  base_generation_ = request_generation;
++  return as_delta;
++}
++
++void BrowserOSSnapshotTracker::Invalidate() {
++  base_snapshot_id_.reset();
++  base_fingerprints_.clear();
++}
++
++bool BrowserOSSnapshotTracker::JoinPendingSnapshot(
++    const std::string& key,
++    PendingSnapshotCallback callback) {
++  auto it = pending_snapshots_.find(key);
++  if (it == pending_snapshots_.end()) {
++    return false;
++  }
++  it->second.push_back(std::move(callback));
++  return true;
++}
++
++void BrowserOSSnapshotTracker::BeginPendingSnapshot(const std::string& key) {
++  pending_snapshots_.try_emplace(key);
++}
++
++void BrowserOSSnapshotTracker::FinishPendingSnapshot(
++    const std::string& key,
++    const browser_os::InteractiveSnapshot* snapshot) {
++  auto it = pending_snapshots_.find(key);
++  if (it == pending_snapshots_.end()) {
++    return;
++  }
++  std::vector<PendingSnapshotCallback> callbacks = std::move(it->second);
++  pending_snapshots_.erase(it);
++  if (!callbacks.empty()) {
++    VLOG(1) << "[browseros] Snapshot shared with " << callbacks.size()
++            << " coalesced request(s)";
++  }
++  for (auto& callback : callbacks) {
++    std::move(callback).Run(snapshot);
++  }
++}
++
++void BrowserOSSnapshotTracker::RecordSnapshotForDiff(uint32_t snapshot_id) {
++  const TabNodeMappings* mappings =
++      BrowserOSNodeMappingStore::FindForTab(web_contents());
++  if (!mappings) {
++    return;
++  }
++
++  auto snapshot = base::MakeRefCounted<DiffSnapshot>();
++  snapshot->data.reserve(mappings->nodes.size());
++  for (const auto& [node_id, info] : mappings->nodes) {
++    snapshot->data.push_back({info.ax_node_id, node_id, HashNodeContent(info),
++                              HashNodeRect(info)});
++  }
++
++  diff_history_.emplace_back(snapshot_id, std::move(snapshot));
++  if (diff_history_.size() > kMaxDiffSnapshots) {
++    diff_history_.pop_front();
++  }
++}
++
++base::expected<browser_os::SnapshotDiff, std::string>
++BrowserOSSnapshotTracker::DiffSnapshots(uint32_t from_snapshot_id,
++                                        uint32_t to_snapshot_id) const {
++  const DiffSnapshot* from = FindDiffSnapshot(from_snapshot_id);
++  if (!from) {
++    return base::unexpected(base::StringPrintf(
++        "Snapshot %u is not kept for this tab", from_snapshot_id));
++  }
++  const DiffSnapshot* to = FindDiffSnapshot(to_snapshot_id);
++  if (!to) {
++    return base::unexpected(base::StringPrintf(
++        "Snapshot %u is not kept for this tab", to_snapshot_id));
++  }
++
++  // AX node id -> node of |from|
++  std::unordered_map<int32_t, const DiffNode*> from_nodes;
++  from_nodes.reserve(from->data.size());
++  for (const DiffNode& node : from->data) {
++    from_nodes[node.ax_node_id] = &node;
++  }
++
++  browser_os::SnapshotDiff diff;
++  diff.from_snapshot_id = static_cast<int>(from_snapshot_id);
++  diff.to_snapshot_id = static_cast<int>(to_snapshot_id);
++  for (const DiffNode& node : to->data) {
++    auto from_it = from_nodes.find(node.ax_node_id);
++    if (from_it == from_nodes.end()) {
++      diff.added.push_back(static_cast<int>(node.node_id));
++      continue;
++    }
++    const DiffNode& from_node = *from_it->second;
++    from_nodes.erase(from_it);
++    if (from_node.content_hash != node.content_hash) {
++      diff.changed.push_back(static_cast<int>(node.node_id));
++    } else if (from_node.rect_hash != node.rect_hash) {
++      diff.moved.push_back(static_cast<int>(node.node_id));
++    }
++  }
++  // Whatever |to| didn't match is gone
++  for (const auto& [ax_node_id, node] : from_nodes) {
++    diff.removed.push_back(static_cast<int>(node->node_id));
++  }
++
++  std::sort(diff.added.begin(), diff.added.end());
++  std::sort(diff.removed.begin(), diff.removed.end());
++  std::sort(diff.moved.begin(), diff.moved.end());
++  std::sort(diff.changed.begin(), diff.changed.end());
++  return diff;
++}
++
++const BrowserOSSnapshotTracker::DiffSnapshot*
++BrowserOSSnapshotTracker::FindDiffSnapshot(uint32_t snapshot_id) const {
++  for (const auto& [id, snapshot] : diff_history_) {
++    if (id == snapshot_id) {
++      return snapshot.get();
++    }
++  }
++  return nullptr;
++}
++
++void BrowserOSSnapshotTracker::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  if (!details.updates.empty() || !details.events.empty()) {
++    generation_++;
++  }
++  if (accessibility_mode_) {
++    accessibility_event_count_ += details.events.size();
++    for (const auto& update : details.updates) {
++      accessibility_updated_nodes_ += update.nodes.size();
++    }
++  }
++}
++
++void BrowserOSSnapshotTracker::AccessibilityLocationChangesReceived(
++    const ui::AXTreeID& tree_id,
++    ui::AXLocationAndScrollUpdates& details) {
++  // Layout or scroll moved nodes; bounds in the last snapshot are stale
++  generation_++;
++}
++
++void BrowserOSSnapshotTracker::PrimaryPageChanged(content::Page& page) {
++  // New document: node ids, mappings and fingerprints no longer apply
++  generation_++;
++  node_id_remap_->Reset();
++  Invalidate();
++  diff_history_.clear();
++  if (BrowserOSNodeMappingStore* store =
++          BrowserOSNodeMappingStore::Get(web_contents()->GetBrowserContext())) {
++    store->Clear(tab_id_);
++  }
++}
++
++void BrowserOSSnapshotTracker::WebContentsDestroyed() {
++  accessibility_idle_timer_.Stop();
++  if (accessibility_mode_) {
++    RecordAccessibilityCost("closed");
++  }
++  if (BrowserOSNodeMappingStore* store =
++          BrowserOSNodeMappingStore::Get(web_contents()->GetBrowserContext())) {
++    store->Clear(tab_id_);
++  }
++}
++
++void BrowserOSSnapshotTracker::OnAccessibilityIdle() {
++  if (!accessibility_mode_) {
++    return;
++  }
++
++  RecordAccessibilityCost("idle");
++  accessibility_mode_.reset();
++  // Change events stop with the mode, so no base can be trusted from here on
++  generation_++;
++  Invalidate();
++  VLOG(1) << "[browseros] Disabled accessibility for idle tab " << tab_id_;
++}
++
++void BrowserOSSnapshotTracker::RecordAccessibilityCost(const char* reason) {
++  const base::TimeDelta enabled_for =
++      base::TimeTicks::Now() - accessibility_enabled_time_;
++  browseros_metrics::BrowserOSMetrics::Log(
++      "snapshot.accessibility.cost",
++      {{"reason", base::Value(reason)},
++       {"enabled_seconds",
++        base::Value(static_cast<int>(enabled_for.InSeconds()))},
++       {"events", base::Value(static_cast<double>(accessibility_event_count_))},
++       {"updated_nodes",
++        base::Value(static_cast<double>(accessibility_updated_nodes_))}},
++      kAccessibilityCostSampleRate);
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSSnapshotTracker);
++
++}  // namespace api
++}  // namespace extensions
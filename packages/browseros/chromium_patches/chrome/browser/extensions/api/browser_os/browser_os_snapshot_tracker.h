@@ -0,0 +1,221 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.h
+new file mode 100644
+index 0000000000000..703a2fa0e7583
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.h
+@@ -0,0 +1,215 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_TRACKER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_TRACKER_H_
++
++#include <cstdint>
++#include <deque>
++#include <map>
++#include <memory>
++#include <optional>
++#include <string>
++#include <unordered_map>
++#include <utility>
++#include <vector>
++
++#include "base/functional/callback.h"
++#include "base/memory/ref_counted.h"
++#include "base/types/expected.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_tree_id.h"
++
++namespace content {
++class ScopedAccessibilityMode;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++struct NodeInfo;
++
++// Maps AX node ids to snapshot nodeIds that stay stable for as long as the
++// same AX tree is being snapshotted. Switching to a different tree resets
++// the table.
++class NodeIdRemap : public base::RefCounted<NodeIdRemap> {
++ public:
++  NodeIdRemap();
++
++  NodeIdRemap(const NodeIdRemap&) = delete;
++  NodeIdRemap& operator=(const NodeIdRemap&) = delete;
++
++  // Returns the nodeId for |ax_node_id| in |tree_id|, allocating a new one
++  // the first time the node is seen.
++  uint32_t Resolve(const ui::AXTreeID& tree_id, int32_t ax_node_id);
++
++  // Drops all assignments; ids restart at 1.
++  void Reset();
++
++ private:
++  friend class base::RefCounted<NodeIdRemap>;
++  ~NodeIdRemap();
++
++  ui::AXTreeID tree_id_;
++  std::unordered_map<int32_t, uint32_t> ids_;  // AX node id -> nodeId
++  uint32_t next_id_ = 1;
++};
++
++// Per-tab state for interactive snapshots.
++// Ties the tab's node mappings to the WebContents: they are dropped
++// when the tab is destroyed or its primary page changes. Also owns the
++// NodeIdRemap used for stable nodeIds.
++// Counts accessibility changes observed since the last snapshot so a request
++// for an unchanged page can be answered without fetching the tree again, and
++// keeps per-node fingerprints of the last snapshot so a fresh one can be
++// reduced to added/changed/removed nodes. The last few snapshots are also
++// kept in compact form, so any two of them can be compared with
++// DiffSnapshots().
++// Accessibility is only kept on for this tab while it is being automated:
++// the mode is dropped again once no caller has asked for it for
++// kAccessibilityIdleTimeout.
++// Identical snapshots requested while one is being taken are coalesced: the
++// later callers wait for the first one's result instead of processing the
++// tree again and rebuilding the node mappings under it.
++class BrowserOSSnapshotTracker
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSSnapshotTracker> {
++ public:
++  BrowserOSSnapshotTracker(const BrowserOSSnapshotTracker&) = delete;
++  BrowserOSSnapshotTracker& operator=(const BrowserOSSnapshotTracker&) =
++      delete;
++  ~BrowserOSSnapshotTracker() override;
++
++  // Keeps the web contents accessibility mode enabled for this tab so that
++  // change events are delivered while incremental snapshots are in use.
++  // Every call restarts the idle timeout.
++  void EnsureAccessibilityEnabled();
++
++  bool accessibility_enabled() const { return !!accessibility_mode_; }
++
++  // Monotonic counter bumped on every observed page change.
++  uint64_t generation() const { return generation_; }
++
++  // Returns true if |base_snapshot_id| is the latest tracked snapshot and no
++  // change has been observed since it was requested.
++  bool IsUnchangedSince(uint32_t base_snapshot_id) const;
++
++  // Records |snapshot_id| as the new base when it reuses the previous
++  // snapshot without changes.
++  void RecordUnchangedSnapshot(uint32_t snapshot_id);
++
++  // Reduces |snapshot| to a delta against |base_snapshot_id| if that is the
++  // latest tracked snapshot, then makes |snapshot| the new base.
++  // |request_generation| is generation() at the time the tree was requested.
++  // Returns true if |snapshot| was turned into a delta.
++  bool ApplyDelta(std::optional<uint32_t> base_snapshot_id,
++                  uint64_t request_generation,
++                  browser_os::InteractiveSnapshot& snapshot);
++
++  // Forgets the tracked base, e.g. after a non-incremental snapshot reused
++  // the tab's node mappings.
++  void Invalidate();
++
++  // Keeps a compact copy of snapshot |snapshot_id| for DiffSnapshots(),
++  // taken from the tab's node mappings, which must hold that snapshot.
++  // Only the last kMaxDiffSnapshots snapshots are kept.
++  void RecordSnapshotForDiff(uint32_t snapshot_id);
++
++  // Compares two snapshots kept by RecordSnapshotForDiff(). Nodes are
++  // matched by AX node id, so this works with or without stable nodeIds.
++  // Fails if either snapshot is unknown or no longer kept.
++  base::expected<browser_os::SnapshotDiff, std::string> DiffSnapshots(
++      uint32_t from_snapshot_id,
++      uint32_t to_snapshot_id) const;
++
++  scoped_refptr<NodeIdRemap> node_id_remap() const { return node_id_remap_; }
++
++  // Runs with the snapshot a coalesced request waited for, or null if it
++  // was cancelled or the tab went away.
++  using PendingSnapshotCallback =
++      base::OnceCallback<void(const browser_os::InteractiveSnapshot*)>;
++
++  // Queues |callback| for the snapshot with |key| being taken, if there is
++  // one. Returns false if the caller should take it.
++  bool JoinPendingSnapshot(const std::string& key,
++                           PendingSnapshotCallback callback);
++
++  // Marks a snapshot with |key| as being taken until FinishPendingSnapshot()
++  void BeginPendingSnapshot(const std::string& key);
++
++  // Hands |snapshot| to the requests that joined the one with |key|.
++  void FinishPendingSnapshot(const std::string& key,
++                             const browser_os::InteractiveSnapshot* snapshot);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSSnapshotTracker>;
++
++  explicit BrowserOSSnapshotTracker(content::WebContents* web_contents);
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void AccessibilityLocationChangesReceived(
++      const ui::AXTreeID& tree_id,
++      ui::AXLocationAndScrollUpdates& details) override;
++  void PrimaryPageChanged(content::Page& page) override;
++  void WebContentsDestroyed() override;
++
++  // What a kept snapshot remembers about one node
++  struct DiffNode {
++    int32_t ax_node_id;
++    uint32_t node_id;
++    // Type, name and attributes other than in_viewport
++    uint32_t content_hash;
++    uint32_t rect_hash;
++  };
++  using DiffSnapshot = base::RefCountedData<std::vector<DiffNode>>;
++
++  // Returns the kept snapshot |snapshot_id|, or null
++  const DiffSnapshot* FindDiffSnapshot(uint32_t snapshot_id) const;
++
++  void OnAccessibilityIdle();
++
++  // Logs how long accessibility stayed on and how much tree traffic it cost
++  void RecordAccessibilityCost(const char* reason);
++
++  // Tab ID keying this tab's node mappings
++  const int tab_id_;
++  std::unique_ptr<content::ScopedAccessibilityMode> accessibility_mode_;
++  base::OneShotTimer accessibility_idle_timer_;
++
++  // Accessibility overhead since the mode was last enabled
++  base::TimeTicks accessibility_enabled_time_;
++  uint64_t accessibility_event_count_ = 0;
++  uint64_t accessibility_updated_nodes_ = 0;
++
++  scoped_refptr<NodeIdRemap> node_id_remap_;
++
++  uint64_t generation_ = 0;
++
++  // Latest snapshot handed out for this tab and the generation it reflects
++  std::optional<uint32_t> base_snapshot_id_;
++  uint64_t base_generation_ = 0;
++  std::unordered_map<uint32_t, uint32_t> base_fingerprints_;  // nodeId -> hash
++
++  // Snapshots kept for DiffSnapshots(), oldest first. An unchanged
++  // incremental snapshot shares the entry of the one it repeats.
++  std::deque<std::pair<uint32_t, scoped_refptr<const DiffSnapshot>>>
++      diff_history_;
++
++  // Snapshots being taken, by options key, with the requests waiting on them
++  std::map<std::string, std::vector<PendingSnapshotCallback>>
++      pending_snapshots_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_TRACKER_H_
@@ -0,0 +1,370 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_tab_budget.cc b/chrome/browser/extensions/api/browser_os/browser_os_tab_budget.cc
+new file mode 100644
+index 0000000000000..0c28f6a7fd007
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_tab_budget.cc
+@@ -0,0 +1,364 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_tab_budget.h"
++
++#include <memory>
++#include <tuple>
++#include <utility>
++
++#include "base/containers/flat_map.h"
++#include "base/containers/flat_set.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/no_destructor.h"
++#include "base/process/process.h"
++#include "base/process/process_metrics.h"
++#include "base/timer/timer.h"
++#include "build/build_config.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_background_rendering.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_process_host.h"
++#include "content/public/browser/visibility.h"
++#include "content/public/browser/web_contents.h"
++#include "extensions/browser/event_router.h"
++#include "services/resource_coordinator/public/cpp/memory_instrumentation/global_memory_dump.h"
++#include "services/resource_coordinator/public/cpp/memory_instrumentation/memory_instrumentation.h"
++
++#if BUILDFLAG(IS_MAC)
++#include "content/public/browser/browser_child_process_host.h"
++#endif
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++constexpr base::TimeDelta kSampleInterval = base::Seconds(5);
++// How long a tab stays throttled after its last sample over budget
++constexpr base::TimeDelta kThrottlePeriod = base::Seconds(30);
++// Lets page loads and one-off spikes through
++constexpr int kOverBudgetSamplesToThrottle = 2;
++
++using Usage = BrowserOSTabBudget::Usage;
++
++// Renderer process of |web_contents|' main frame, or null until it runs
++content::RenderProcessHost* GetRendererProcess(
++    content::WebContents* web_contents) {
++  content::RenderProcessHost* process =
++      web_contents->GetPrimaryMainFrame()->GetProcess();
++  return process->IsReady() ? process : nullptr;
++}
++
++std::unique_ptr<base::ProcessMetrics> CreateProcessMetrics(
++    const base::Process& process) {
++#if BUILDFLAG(IS_MAC)
++  return base::ProcessMetrics::CreateProcessMetrics(
++      process.Handle(), content::BrowserChildProcessHost::GetPortProvider());
++#else
++  return base::ProcessMetrics::CreateProcessMetrics(process.Handle());
++#endif
++}
++
++// Samples the renderers of all automation tabs. Runs only while there are
++// any, and samples each process once however many of the tabs share it.
++class TabBudgetSampler {
++ public:
++  static TabBudgetSampler& Get() {
++    static base::NoDestructor<TabBudgetSampler> sampler;
++    return *sampler;
++  }
++
++  TabBudgetSampler(const TabBudgetSampler&) = delete;
++  TabBudgetSampler& operator=(const TabBudgetSampler&) = delete;
++
++  void Add(BrowserOSTabBudget* budget) {
++    budgets_.insert(budget);
++    if (!timer_.IsRunning()) {
++      timer_.Start(FROM_HERE, kSampleInterval,
++                   base::BindRepeating(&TabBudgetSampler::Sample,
++                                       base::Unretained(this)));
++    }
++  }
++
++  void Remove(BrowserOSTabBudget* budget) {
++    budgets_.erase(budget);
++    if (budgets_.empty()) {
++      timer_.Stop();
++      process_metrics_.clear();
++    }
++  }
++
++  std::vector<content::WebContents*> GetWebContents() const {
++    std::vector<content::WebContents*> web_contents;
++    web_contents.reserve(budgets_.size());
++    for (BrowserOSTabBudget* budget : budgets_) {
++      web_contents.push_back(budget->web_contents());
++    }
++    return web_contents;
++  }
++
++ private:
++  friend class base::NoDestructor<TabBudgetSampler>;
++
++  TabBudgetSampler() = default;
++  ~TabBudgetSampler() = default;
++
++  void Sample() {
++    // A dump can take longer than the interval on a loaded machine
++    if (dump_pending_) {
++      return;
++    }
++
++    base::flat_map<base::ProcessId, Usage> usages;
++    base::flat_map<base::ProcessId, std::unique_ptr<base::ProcessMetrics>>
++        process_metrics;
++    for (BrowserOSTabBudget* budget : budgets_) {
++      content::RenderProcessHost* process =
++          GetRendererProcess(budget->web_contents());
++      if (!process) {
++        continue;
++      }
++      const base::ProcessId pid = process->GetProcess().Pid();
++      if (usages.contains(pid)) {
++        continue;
++      }
++
++      Usage& usage = usages[pid];
++      usage.shared_process = process->GetActiveViewCount() > 1;
++      auto it = process_metrics_.find(pid);
++      if (it == process_metrics_.end()) {
++        // The first reading only sets the baseline for the next one
++        std::unique_ptr<base::ProcessMetrics> metrics =
++            CreateProcessMetrics(process->GetProcess());
++        std::ignore = metrics->GetPlatformIndependentCPUUsage();
++        process_metrics[pid] = std::move(metrics);
++        continue;
++      }
++      if (auto cpu = it->second->GetPlatformIndependentCPUUsage();
++          cpu.has_value()) {
++        usage.cpu_percent = cpu.value();
++      }
++      process_metrics[pid] = std::move(it->second);
++    }
++    // Drops the metrics of processes no automation tab uses anymore
++    process_metrics_ = std::move(process_metrics);
++
++    auto* instrumentation =
++        memory_instrumentation::MemoryInstrumentation::GetInstance();
++    if (!instrumentation) {
++      Apply(std::move(usages));
++      return;
++    }
++    dump_pending_ = true;
++    instrumentation->RequestPrivateMemoryFootprint(
++        base::kNullProcessId,
++        base::BindOnce(&TabBudgetSampler::OnMemoryDump,
++                       weak_factory_.GetWeakPtr(), std::move(usages)));
++  }
++
++  void OnMemoryDump(
++      base::flat_map<base::ProcessId, Usage> usages,
++      bool success,
++      std::unique_ptr<memory_instrumentation::GlobalMemoryDump> dump) {
++    dump_pending_ = false;
++    if (success && dump) {
++      for (const auto& process_dump : dump->process_dumps()) {
++        auto it = usages.find(process_dump.pid());
++        if (it != usages.end()) {
++          it->second.memory_mb =
++              process_dump.os_dump().private_footprint_kb / 1024.0;
++        }
++      }
++    }
++    Apply(std::move(usages));
++  }
++
++  void Apply(base::flat_map<base::ProcessId, Usage> usages) {
++    const base::TimeTicks now = base::TimeTicks::Now();
++    for (BrowserOSTabBudget* budget : budgets_) {
++      content::RenderProcessHost* process =
++          GetRendererProcess(budget->web_contents());
++      if (!process) {
++        continue;
++      }
++      auto it = usages.find(process->GetProcess().Pid());
++      if (it != usages.end()) {
++        budget->OnSampled(it->second, now);
++      }
++    }
++  }
++
++  base::flat_set<raw_ptr<BrowserOSTabBudget>> budgets_;
++  base::flat_map<base::ProcessId, std::unique_ptr<base::ProcessMetrics>>
++      process_metrics_;
++  base::RepeatingTimer timer_;
++  bool dump_pending_ = false;
++  base::WeakPtrFactory<TabBudgetSampler> weak_factory_{this};
++};
++
++}  // namespace
++
++std::optional<TabBudget> ToTabBudget(
++    const std::optional<browser_os::TabBudget>& budget) {
++  TabBudget result;
++  if (!budget) {
++    return result;
++  }
++  if (budget->cpu_percent) {
++    if (*budget->cpu_percent <= 0) {
++      return std::nullopt;
++    }
++    result.cpu_percent = *budget->cpu_percent;
++  }
++  if (budget->memory_mb) {
++    if (*budget->memory_mb <= 0) {
++      return std::nullopt;
++    }
++    result.memory_mb = *budget->memory_mb;
++  }
++  return result;
++}
++
++BrowserOSTabBudget::BrowserOSTabBudget(content::WebContents* web_contents)
++    : content::WebContentsUserData<BrowserOSTabBudget>(*web_contents),
++      content::WebContentsObserver(web_contents) {
++  TabBudgetSampler::Get().Add(this);
++}
++
++BrowserOSTabBudget::~BrowserOSTabBudget() {
++  TabBudgetSampler::Get().Remove(this);
++}
++
++// static
++void BrowserOSTabBudget::SetBudget(content::WebContents* web_contents,
++                                   const TabBudget& budget) {
++  CreateForWebContents(web_contents);
++  FromWebContents(web_contents)->budget_ = budget;
++}
++
++// static
++void BrowserOSTabBudget::Clear(content::WebContents* web_contents) {
++  BrowserOSTabBudget* tab_budget = FromWebContents(web_contents);
++  if (!tab_budget) {
++    return;
++  }
++  tab_budget->Unthrottle();
++  web_contents->RemoveUserData(UserDataKey());
++}
++
++// static
++void BrowserOSTabBudget::Thaw(content::WebContents* web_contents) {
++  BrowserOSTabBudget* tab_budget = FromWebContents(web_contents);
++  if (tab_budget && tab_budget->throttled()) {
++    VLOG(1) << "[browseros] Lifting budget throttling of tab "
++            << ExtensionTabUtil::GetTabId(web_contents) << " for a request";
++    tab_budget->Unthrottle();
++  }
++}
++
++// static
++std::vector<content::WebContents*> BrowserOSTabBudget::GetAutomationTabs() {
++  return TabBudgetSampler::Get().GetWebContents();
++}
++
++browser_os::TabResourceUsage BrowserOSTabBudget::ToResourceUsage(
++    int tab_id) const {
++  browser_os::TabResourceUsage result;
++  result.tab_id = tab_id;
++  result.cpu_percent = usage_.cpu_percent;
++  result.memory_mb = usage_.memory_mb;
++  result.budget.cpu_percent = budget_.cpu_percent;
++  result.budget.memory_mb = budget_.memory_mb;
++  result.throttled = throttled();
++  result.frozen = frozen_;
++  result.shared_process = usage_.shared_process;
++  return result;
++}
++
++void BrowserOSTabBudget::OnSampled(const Usage& usage, base::TimeTicks now) {
++  usage_ = usage;
++  if (!IsOverBudget()) {
++    over_budget_samples_ = 0;
++    if (throttled() && now >= throttled_until_) {
++      Unthrottle();
++    }
++    return;
++  }
++
++  if (++over_budget_samples_ < kOverBudgetSamplesToThrottle) {
++    return;
++  }
++  const bool was_throttled = throttled();
++  throttled_until_ = now + kThrottlePeriod;
++  if (!was_throttled) {
++    Throttle();
++  }
++}
++
++bool BrowserOSTabBudget::IsOverBudget() const {
++  return usage_.cpu_percent.value_or(0) > budget_.cpu_percent ||
++         usage_.memory_mb.value_or(0) > budget_.memory_mb;
++}
++
++void BrowserOSTabBudget::Throttle() {
++  const int tab_id = ExtensionTabUtil::GetTabId(web_contents());
++  LOG(WARNING) << "[browseros] Tab " << tab_id
++               << " is over its budget: cpu "
++               << usage_.cpu_percent.value_or(0) << "%, memory "
++               << usage_.memory_mb.value_or(0) << " MB";
++  if (BrowserOSBackgroundRendering::IsEnabled(web_contents())) {
++    BrowserOSBackgroundRendering::SetEnabled(web_contents(), false);
++    rendering_suspended_ = true;
++  }
++  UpdateFrozen();
++
++  content::BrowserContext* browser_context =
++      web_contents()->GetBrowserContext();
++  EventRouter* event_router = EventRouter::Get(browser_context);
++  if (event_router && event_router->HasEventListener(
++                          browser_os::OnTabBudgetExceeded::kEventName)) {
++    auto event = std::make_unique<Event>(
++        events::UNKNOWN, browser_os::OnTabBudgetExceeded::kEventName,
++        browser_os::OnTabBudgetExceeded::Create(ToResourceUsage(tab_id)),
++        browser_context);
++    event_router->BroadcastEvent(std::move(event));
++  }
++}
++
++void BrowserOSTabBudget::Unthrottle() {
++  throttled_until_ = base::TimeTicks();
++  over_budget_samples_ = 0;
++  UpdateFrozen();
++  if (rendering_suspended_) {
++    rendering_suspended_ = false;
++    BrowserOSBackgroundRendering::SetEnabled(web_contents(), true);
++  }
++}
++
++void BrowserOSTabBudget::UpdateFrozen() {
++  const bool freeze =
++      throttled() &&
++      web_contents()->GetVisibility() == content::Visibility::HIDDEN &&
++      !web_contents()->IsBeingCaptured();
++  if (freeze == frozen_) {
++    return;
++  }
++  frozen_ = freeze;
++  VLOG(1) << "[browseros] Tab " << ExtensionTabUtil::GetTabId(web_contents())
++          << (freeze ? " frozen" : " unfrozen") << " for its budget";
++  web_contents()->SetPageFrozen(freeze);
++}
++
++void BrowserOSTabBudget::OnVisibilityChanged(content::Visibility visibility) {
++  UpdateFrozen();
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSTabBudget);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,126 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_tab_budget.h b/chrome/browser/extensions/api/browser_os/browser_os_tab_budget.h
+new file mode 100644
+index 0000000000000..8d42412fba539
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_tab_budget.h
+@@ -0,0 +1,120 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_BUDGET_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_BUDGET_H_
++
++#include <optional>
++#include <vector>
++
++#include "base/time/time.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Resource limits of an automation tab
++struct TabBudget {
++  // Percent of one core, counting the renderer's workers
++  double cpu_percent = 100;
++  double memory_mb = 2048;
++};
++
++// Budget from the setAutomationTab options, with defaults filled in. Returns
++// nullopt if a limit isn't positive.
++std::optional<TabBudget> ToTabBudget(
++    const std::optional<browser_os::TabBudget>& budget);
++
++// Marks a tab as owned by an agent, set through browserOS.setAutomationTab,
++// and holds it to a TabBudget so runaway pages (miners, endless animations)
++// don't slow down the other agents on the host.
++//
++// The renderer processes of all automation tabs are sampled together every
++// few seconds: CPU through base::ProcessMetrics, private memory through a
++// memory_instrumentation footprint dump. Both are per process, so a tab
++// sharing its renderer is charged for the other tabs in it.
++//
++// A tab over budget for two samples in a row is throttled: background
++// rendering from setBackgroundRendering is suspended, so the hidden page
++// gets the usual background timer and frame throttling, and once hidden it
++// is frozen outright. It is released after staying under budget for 30
++// seconds. As a frozen page runs no script, Thaw() releases it for
++// a browserOS request; it is throttled again if it keeps exceeding budget.
++class BrowserOSTabBudget
++    : public content::WebContentsUserData<BrowserOSTabBudget>,
++      public content::WebContentsObserver {
++ public:
++  // Latest sample of the tab's renderer
++  struct Usage {
++    // Unset until the process has been sampled twice
++    std::optional<double> cpu_percent;
++    std::optional<double> memory_mb;
++    bool shared_process = false;
++  };
++
++  BrowserOSTabBudget(const BrowserOSTabBudget&) = delete;
++  BrowserOSTabBudget& operator=(const BrowserOSTabBudget&) = delete;
++  ~BrowserOSTabBudget() override;
++
++  // Marks |web_contents| as an automation tab held to |budget|, or updates
++  // the budget of one
++  static void SetBudget(content::WebContents* web_contents,
++                        const TabBudget& budget);
++  // Unmarks |web_contents|, lifting any throttling
++  static void Clear(content::WebContents* web_contents);
++
++  // Releases |web_contents| from throttling for a browserOS request. No-op
++  // for tabs that aren't throttled.
++  static void Thaw(content::WebContents* web_contents);
++
++  // Every automation tab, in no particular order
++  static std::vector<content::WebContents*> GetAutomationTabs();
++
++  // Usage report of the tab
++  browser_os::TabResourceUsage ToResourceUsage(int tab_id) const;
++
++  const TabBudget& budget() const { return budget_; }
++  const Usage& usage() const { return usage_; }
++  bool throttled() const { return !throttled_until_.is_null(); }
++
++  // Takes in the latest sample of the tab's renderer
++  void OnSampled(const Usage& usage, base::TimeTicks now);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSTabBudget>;
++
++  explicit BrowserOSTabBudget(content::WebContents* web_contents);
++
++  bool IsOverBudget() const;
++  void Throttle();
++  void Unthrottle();
++  // Frozen only while hidden, and not while something is capturing the tab
++  void UpdateFrozen();
++
++  // content::WebContentsObserver:
++  void OnVisibilityChanged(content::Visibility visibility) override;
++
++  TabBudget budget_;
++  Usage usage_;
++  int over_budget_samples_ = 0;
++
++  // Null while not throttled
++  base::TimeTicks throttled_until_;
++  bool frozen_ = false;
++  // setBackgroundRendering was on when the tab was throttled
++  bool rendering_suspended_ = false;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_BUDGET_H_
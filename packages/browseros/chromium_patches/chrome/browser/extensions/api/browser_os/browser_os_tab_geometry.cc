@@ -0,0 +1,125 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_tab_geometry.cc b/chrome/browser/extensions/api/browser_os/browser_os_tab_geometry.cc
+new file mode 100644
+index 0000000000000..7c889efc724bc
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_tab_geometry.cc
+@@ -0,0 +1,119 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_tab_geometry.h"
++
++#include "content/browser/renderer_host/render_widget_host_impl.h"
++#include "content/browser/renderer_host/render_widget_host_view_base.h"
++#include "content/browser/web_contents/web_contents_impl.h"
++#include "content/public/browser/page.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_widget_host_view.h"
++#include "content/public/browser/web_contents.h"
++#include "third_party/blink/public/common/page/page_zoom.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Browser zoom times CSS zoom of |rwh|
++float ReadZoom(content::WebContents* web_contents,
++               content::RenderWidgetHost* rwh) {
++  float zoom = 1.0f;
++  if (auto* rwhi = static_cast<content::RenderWidgetHostImpl*>(rwh)) {
++    if (auto* wci = static_cast<content::WebContentsImpl*>(web_contents)) {
++      zoom = blink::ZoomLevelToZoomFactor(wci->GetPendingZoomLevel(rwhi));
++    }
++  }
++
++  float css_zoom = 1.0f;
++  if (auto* view = rwh ? rwh->GetView() : nullptr) {
++    if (auto* view_base =
++            static_cast<content::RenderWidgetHostViewBase*>(view)) {
++      css_zoom = view_base->GetCSSZoomFactor();
++    }
++  }
++  return zoom * css_zoom;
++}
++
++float ReadPageScale(content::WebContents* web_contents) {
++  if (auto* wci = static_cast<content::WebContentsImpl*>(web_contents)) {
++    return wci->GetPrimaryPage().GetPageScaleFactor();
++  }
++  return 1.0f;
++}
++
++}  // namespace
++
++BrowserOSTabGeometry::BrowserOSTabGeometry(content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSTabGeometry>(*web_contents) {}
++
++BrowserOSTabGeometry::~BrowserOSTabGeometry() = default;
++
++// static
++const TabGeometry& BrowserOSTabGeometry::Get(
++    content::WebContents* web_contents) {
++  CreateForWebContents(web_contents);
++  BrowserOSTabGeometry* tab_geometry = FromWebContents(web_contents);
++  if (tab_geometry->stale_) {
++    tab_geometry->Read();
++  }
++  return tab_geometry->geometry_;
++}
++
++void BrowserOSTabGeometry::PrimaryPageChanged(content::Page& page) {
++  // A cross-process navigation brings another main frame widget
++  widget_observation_.Reset();
++  stale_ = true;
++}
++
++void BrowserOSTabGeometry::OnPageScaleFactorChanged(content::Page& page) {
++  stale_ = true;
++}
++
++void BrowserOSTabGeometry::PrimaryMainFrameWasResized(bool width_changed) {
++  stale_ = true;
++}
++
++void BrowserOSTabGeometry::RenderWidgetHostDidUpdateVisualProperties(
++    content::RenderWidgetHost* widget_host) {
++  stale_ = true;
++}
++
++void BrowserOSTabGeometry::RenderWidgetHostDestroyed(
++    content::RenderWidgetHost* widget_host) {
++  widget_observation_.Reset();
++  stale_ = true;
++}
++
++void BrowserOSTabGeometry::Read() {
++  content::RenderFrameHost* rfh = web_contents()->GetPrimaryMainFrame();
++  content::RenderWidgetHost* rwh = rfh ? rfh->GetRenderWidgetHost() : nullptr;
++  if (rwh && !widget_observation_.IsObserving()) {
++    widget_observation_.Observe(rwh);
++  }
++
++  geometry_ = TabGeometry();
++  if (auto* rwhv = web_contents()->GetRenderWidgetHostView()) {
++    geometry_.viewport_size = rwhv->GetVisibleViewportSize();
++    geometry_.device_scale_factor =
++        static_cast<content::RenderWidgetHostViewBase*>(rwhv)
++            ->GetDeviceScaleFactor();
++  }
++  geometry_.zoom = ReadZoom(web_contents(), rwh);
++  geometry_.page_scale = ReadPageScale(web_contents());
++  stale_ = !widget_observation_.IsObserving();
++}
++
++float ReadCssToWidgetScale(content::WebContents* web_contents,
++                           content::RenderWidgetHost* rwh) {
++  return ReadZoom(web_contents, rwh) * ReadPageScale(web_contents);
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSTabGeometry);
++
++}  // namespace api
++}  // namespace extensions
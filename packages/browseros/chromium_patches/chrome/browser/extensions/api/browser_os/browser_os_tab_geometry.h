@@ -0,0 +1,102 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_tab_geometry.h b/chrome/browser/extensions/api/browser_os/browser_os_tab_geometry.h
+new file mode 100644
+index 0000000000000..3f39772f066ae
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_tab_geometry.h
+@@ -0,0 +1,96 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_GEOMETRY_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_GEOMETRY_H_
++
++#include "base/scoped_observation.h"
++#include "content/public/browser/render_widget_host.h"
++#include "content/public/browser/render_widget_host_observer.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/gfx/geometry/size.h"
++
++namespace content {
++class Page;
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// The layout state of a tab's main frame that snapshots and actions convert
++// coordinates with
++struct TabGeometry {
++  gfx::Size viewport_size;
++  float device_scale_factor = 1.0f;
++  // Browser zoom times CSS zoom
++  float zoom = 1.0f;
++  float page_scale = 1.0f;
++
++  // See CssToWidgetScale
++  float css_to_widget_scale() const { return zoom * page_scale; }
++};
++
++// Keeps a tab's TabGeometry, so each snapshot and click reads it without
++// going through the widget, its view and the zoom map. Nothing is pushed
++// into it: a visual properties sync of the main frame widget (resize,
++// device scale factor, browser and CSS zoom), a page scale change or a new
++// primary page marks it stale, and the next read takes the values again. A
++// read is so never older than the last change the browser knows of, as
++// with the live lookups it replaces.
++//
++// The main frame scroll offset isn't kept: the desktop compositor doesn't
++// report it to the browser, so it is still read by the viewport state
++// script.
++class BrowserOSTabGeometry
++    : public content::WebContentsObserver,
++      public content::RenderWidgetHostObserver,
++      public content::WebContentsUserData<BrowserOSTabGeometry> {
++ public:
++  BrowserOSTabGeometry(const BrowserOSTabGeometry&) = delete;
++  BrowserOSTabGeometry& operator=(const BrowserOSTabGeometry&) = delete;
++  ~BrowserOSTabGeometry() override;
++
++  // |web_contents|' geometry, read again if it changed since the last call
++  static const TabGeometry& Get(content::WebContents* web_contents);
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSTabGeometry>;
++
++  explicit BrowserOSTabGeometry(content::WebContents* web_contents);
++
++  // content::WebContentsObserver:
++  void PrimaryPageChanged(content::Page& page) override;
++  void OnPageScaleFactorChanged(content::Page& page) override;
++  void PrimaryMainFrameWasResized(bool width_changed) override;
++
++  // content::RenderWidgetHostObserver:
++  void RenderWidgetHostDidUpdateVisualProperties(
++      content::RenderWidgetHost* widget_host) override;
++  void RenderWidgetHostDestroyed(
++      content::RenderWidgetHost* widget_host) override;
++
++  void Read();
++
++  TabGeometry geometry_;
++  bool stale_ = true;
++  // The primary main frame's widget. Without one to watch every read is
++  // live.
++  base::ScopedObservation<content::RenderWidgetHost,
++                          content::RenderWidgetHostObserver>
++      widget_observation_{this};
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++// Reads the CSS to widget scale of |rwh| without the cache, for widgets
++// other than a tab's primary main frame one
++float ReadCssToWidgetScale(content::WebContents* web_contents,
++                           content::RenderWidgetHost* rwh);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_GEOMETRY_H_
@@ -0,0 +1,194 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_tab_pool.cc b/chrome/browser/extensions/api/browser_os/browser_os_tab_pool.cc
+new file mode 100644
+index 0000000000000..2aa14f1d9662b
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_tab_pool.cc
+@@ -0,0 +1,188 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_tab_pool.h"
++
++#include <algorithm>
++#include <string>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/memory/memory_pressure_monitor.h"
++#include "base/system/sys_info.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/time/time.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_tracker.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_task_tabs.h"
++#include "chrome/browser/ui/tab_helpers.h"
++#include "content/public/browser/navigation_controller.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/site_instance.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/base/page_transition_types.h"
++#include "url/gurl.h"
++#include "url/url_constants.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Lets the tab that was just taken load first
++constexpr base::TimeDelta kRefillDelay = base::Seconds(1);
++
++bool IsMemoryShort() {
++  if (base::SysInfo::IsLowEndDevice()) {
++    return true;
++  }
++  const base::MemoryPressureMonitor* monitor = base::MemoryPressureMonitor::Get();
++  return monitor && monitor->GetCurrentPressureLevel() !=
++                        base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE;
++}
++
++// Loads about:blank and drops the back/forward list, so a reused tab does
++// not carry over the previous task's history
++void LoadBlankPage(content::WebContents* web_contents) {
++  content::NavigationController::LoadURLParams params(
++      GURL(url::kAboutBlankURL));
++  params.transition_type = ui::PAGE_TRANSITION_AUTO_TOPLEVEL;
++  params.should_clear_history_list = true;
++  web_contents->GetController().LoadURLWithParams(params);
++}
++
++}  // namespace
++
++// static
++BrowserOSTabPool* BrowserOSTabPool::GetInstance() {
++  static base::NoDestructor<BrowserOSTabPool> instance;
++  return instance.get();
++}
++
++BrowserOSTabPool::BrowserOSTabPool()
++    : memory_pressure_registration_(browseros::AddMemoryPressureHandler(
++          "agent_tab_pool",
++          base::BindRepeating(&BrowserOSTabPool::OnMemoryPressure,
++                              base::Unretained(this)))) {}
++
++BrowserOSTabPool::~BrowserOSTabPool() = default;
++
++std::unique_ptr<content::WebContents> BrowserOSTabPool::Take(
++    Profile* profile) {
++  std::unique_ptr<content::WebContents> web_contents;
++  auto it = std::ranges::find(entries_, profile, &Entry::profile);
++  if (it != entries_.end()) {
++    web_contents = std::move(it->web_contents);
++    entries_.erase(it);
++    // Accessibility may have gone idle while the tab sat in the pool
++    BrowserOSSnapshotTracker::FromWebContents(web_contents.get())
++        ->EnsureAccessibilityEnabled();
++    VLOG(1) << "[browseros] Took pooled agent tab";
++  } else {
++    web_contents = CreateTab(content::WebContents::CreateParams(profile));
++  }
++
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&BrowserOSTabPool::Refill, base::Unretained(this),
++                     profile->GetWeakPtr()),
++      kRefillDelay);
++  return web_contents;
++}
++
++std::unique_ptr<content::WebContents> BrowserOSTabPool::CreateRelated(
++    content::WebContents* related) {
++  content::SiteInstance* site_instance =
++      related->GetPrimaryMainFrame()->GetSiteInstance();
++  VLOG(1) << "[browseros] Opening agent tab in the renderer of "
++          << site_instance->GetSiteURL();
++  return CreateTab(content::WebContents::CreateParams(
++      related->GetBrowserContext(), site_instance));
++}
++
++void BrowserOSTabPool::Return(
++    std::unique_ptr<content::WebContents> web_contents) {
++  Profile* profile =
++      Profile::FromBrowserContext(web_contents->GetBrowserContext());
++  if (GetPooledCount(profile) >= kMaxPooledTabs || IsMemoryShort()) {
++    return;
++  }
++  // Its browsing instance holds the task's other tabs
++  if (BrowserOSTaskTabs::FromWebContents(web_contents.get())) {
++    return;
++  }
++
++  // The next task starts from a new snapshot
++  BrowserOSNodeMappingStore::ClearForTab(web_contents.get());
++  LoadBlankPage(web_contents.get());
++  Park(profile, std::move(web_contents));
++}
++
++size_t BrowserOSTabPool::GetPooledCount(Profile* profile) const {
++  return std::ranges::count(entries_, profile, &Entry::profile);
++}
++
++std::unique_ptr<content::WebContents> BrowserOSTabPool::CreateTab(
++    const content::WebContents::CreateParams& create_params) {
++  content::WebContents::CreateParams params(create_params);
++  params.initially_hidden = true;
++  std::unique_ptr<content::WebContents> web_contents =
++      content::WebContents::Create(params);
++  // Tab helpers go on before the tab joins a tab strip, as for any new tab
++  TabHelpers::AttachTabHelpers(web_contents.get());
++
++  BrowserOSSnapshotTracker::CreateForWebContents(web_contents.get());
++  BrowserOSSnapshotTracker::FromWebContents(web_contents.get())
++      ->EnsureAccessibilityEnabled();
++
++  // Starts the renderer process
++  LoadBlankPage(web_contents.get());
++  return web_contents;
++}
++
++void BrowserOSTabPool::Refill(base::WeakPtr<Profile> profile) {
++  // The profile may have gone away meanwhile
++  if (!profile || GetPooledCount(profile.get()) >= kMaxPooledTabs ||
++      IsMemoryShort()) {
++    return;
++  }
++  VLOG(1) << "[browseros] Prewarming agent tab";
++  Park(profile.get(),
++       CreateTab(content::WebContents::CreateParams(profile.get())));
++}
++
++void BrowserOSTabPool::Park(
++    Profile* profile,
++    std::unique_ptr<content::WebContents> web_contents) {
++  web_contents->SetDelegate(nullptr);
++  web_contents->WasHidden();
++  if (!profile_observations_.IsObservingSource(profile)) {
++    profile_observations_.AddObservation(profile);
++  }
++  entries_.push_back({profile, std::move(web_contents)});
++}
++
++void BrowserOSTabPool::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level,
++    base::OnceCallback<void(browseros::ReleasedMemory)> done) {
++  browseros::ReleasedMemory released;
++  released.items = entries_.size();
++  if (!entries_.empty()) {
++    LOG(INFO) << "[browseros] Dropping " << entries_.size()
++              << " pooled agent tabs on memory pressure";
++    entries_.clear();
++  }
++  std::move(done).Run(released);
++}
++
++void BrowserOSTabPool::OnProfileWillBeDestroyed(Profile* profile) {
++  std::erase_if(entries_,
++                [profile](const Entry& entry) { return entry.profile == profile; });
++  profile_observations_.RemoveObservation(profile);
++}
++
++}  // namespace api
++}  // namespace extensions
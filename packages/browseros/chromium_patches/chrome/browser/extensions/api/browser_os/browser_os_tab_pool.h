@@ -0,0 +1,103 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_tab_pool.h b/chrome/browser/extensions/api/browser_os/browser_os_tab_pool.h
+new file mode 100644
+index 0000000000000..c85fc5aa1ffa0
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_tab_pool.h
+@@ -0,0 +1,97 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_POOL_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_POOL_H_
++
++#include <cstddef>
++#include <memory>
++#include <vector>
++
++#include "base/functional/callback_helpers.h"
++#include "base/memory/memory_pressure_listener.h"
++#include "base/memory/raw_ptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/no_destructor.h"
++#include "base/scoped_multi_source_observation.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "chrome/browser/profiles/profile.h"
++#include "chrome/browser/profiles/profile_observer.h"
++#include "content/public/browser/web_contents.h"
++
++namespace extensions {
++namespace api {
++
++// Hidden, pre-initialized tabs that agent tasks check out with acquireTab
++// instead of opening fresh ones. A pooled tab sits at about:blank with its
++// renderer process running, its tab helpers attached and accessibility
++// already enabled through BrowserOSSnapshotTracker, so the first snapshot
++// of a task skips the enablement cost. Tabs given back with releaseTab are
++// reset to a blank page with no history and pooled again.
++//
++// Pooled tabs live outside any window, so the pool also works with no
++// browser window open. It keeps up to kMaxPooledTabs per profile, refills
++// shortly after a tab is taken, and empties itself on memory pressure or
++// when the profile goes away. Lives on the UI thread.
++class BrowserOSTabPool : public ProfileObserver {
++ public:
++  static constexpr size_t kMaxPooledTabs = 2;
++
++  static BrowserOSTabPool* GetInstance();
++
++  BrowserOSTabPool(const BrowserOSTabPool&) = delete;
++  BrowserOSTabPool& operator=(const BrowserOSTabPool&) = delete;
++
++  // Returns a pooled tab of |profile|, or a newly initialized one if none
++  // is pooled. The caller inserts it into a tab strip.
++  std::unique_ptr<content::WebContents> Take(Profile* profile);
++
++  // Returns a newly initialized tab in |related|'s browsing instance, so
++  // same-site pages of the two share a renderer process. Pooled tabs each
++  // have a browsing instance of their own, so this never takes from the
++  // pool.
++  std::unique_ptr<content::WebContents> CreateRelated(
++      content::WebContents* related);
++
++  // Resets |web_contents|, detached from its tab strip, and pools it, or
++  // destroys it if the pool is full, memory is short or it belongs to a task
++  // sharing renderers
++  void Return(std::unique_ptr<content::WebContents> web_contents);
++
++  size_t GetPooledCount(Profile* profile) const;
++
++ private:
++  friend class base::NoDestructor<BrowserOSTabPool>;
++
++  struct Entry {
++    raw_ptr<Profile> profile;
++    std::unique_ptr<content::WebContents> web_contents;
++  };
++
++  BrowserOSTabPool();
++  ~BrowserOSTabPool() override;
++
++  std::unique_ptr<content::WebContents> CreateTab(
++      const content::WebContents::CreateParams& params);
++  void Refill(base::WeakPtr<Profile> profile);
++  void Park(Profile* profile,
++            std::unique_ptr<content::WebContents> web_contents);
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(browseros::ReleasedMemory)> done);
++
++  // ProfileObserver:
++  void OnProfileWillBeDestroyed(Profile* profile) override;
++
++  std::vector<Entry> entries_;
++
++  base::ScopedMultiSourceObservation<Profile, ProfileObserver>
++      profile_observations_{this};
++  base::ScopedClosureRunner memory_pressure_registration_;
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TAB_POOL_H_
@@ -0,0 +1,86 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_task_tabs.cc b/chrome/browser/extensions/api/browser_os/browser_os_task_tabs.cc
+new file mode 100644
+index 0000000000000..7ddf862a26060
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_task_tabs.cc
+@@ -0,0 +1,80 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_task_tabs.h"
++
++#include <utility>
++
++#include "base/containers/flat_set.h"
++#include "base/memory/raw_ptr.h"
++#include "base/no_destructor.h"
++#include "chrome/browser/browseros/core/browseros_prefs.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/prefs/pref_service.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_process_host.h"
++#include "content/public/browser/web_contents.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Every tagged tab, across profiles
++base::flat_set<raw_ptr<BrowserOSTaskTabs>>& GetTaskTabs() {
++  static base::NoDestructor<base::flat_set<raw_ptr<BrowserOSTaskTabs>>>
++      task_tabs;
++  return *task_tabs;
++}
++
++}  // namespace
++
++BrowserOSTaskTabs::BrowserOSTaskTabs(content::WebContents* web_contents,
++                                     std::string task_id)
++    : content::WebContentsUserData<BrowserOSTaskTabs>(*web_contents),
++      task_id_(std::move(task_id)) {
++  GetTaskTabs().insert(this);
++}
++
++BrowserOSTaskTabs::~BrowserOSTaskTabs() {
++  GetTaskTabs().erase(this);
++}
++
++// static
++bool BrowserOSTaskTabs::IsSharingEnabled(Profile* profile) {
++  return profile->GetPrefs()->GetBoolean(
++      browseros::prefs::kShareTaskRenderers);
++}
++
++// static
++void BrowserOSTaskTabs::SetTask(content::WebContents* web_contents,
++                                const std::string& task_id) {
++  web_contents->RemoveUserData(UserDataKey());
++  CreateForWebContents(web_contents, task_id);
++}
++
++// static
++content::WebContents* BrowserOSTaskTabs::FindTaskTab(
++    Profile* profile,
++    const std::string& task_id) {
++  for (BrowserOSTaskTabs* task_tab : GetTaskTabs()) {
++    content::WebContents* web_contents = &task_tab->GetWebContents();
++    if (task_tab->task_id_ != task_id ||
++        web_contents->GetBrowserContext() != profile) {
++      continue;
++    }
++    // A crashed renderer would only be respawned for the new tab
++    if (web_contents->GetPrimaryMainFrame()
++            ->GetProcess()
++            ->IsInitializedAndNotDead()) {
++      return web_contents;
++    }
++  }
++  return nullptr;
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSTaskTabs);
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,72 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_task_tabs.h b/chrome/browser/extensions/api/browser_os/browser_os_task_tabs.h
+new file mode 100644
+index 0000000000000..df8d693ded8ac
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_task_tabs.h
+@@ -0,0 +1,66 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TASK_TABS_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TASK_TABS_H_
++
++#include <string>
++
++#include "content/public/browser/web_contents_user_data.h"
++
++class Profile;
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Task an automation tab opened with acquireTab belongs to. With
++// browseros.automation.share_task_renderers on for the profile, the later
++// tabs of a task open in the browsing instance of an earlier one, so pages
++// of the same site across the task's tabs share a renderer process instead
++// of each starting one. Site isolation still applies: each site keeps its
++// own process, and a cross-site navigation the browser decides to give a
++// fresh browsing instance leaves the group.
++//
++// Sharing is off by default because tabs in one browsing instance can reach
++// each other by window name. A tab tagged with a task is not pooled again
++// on releaseTab, so no task inherits another's browsing instance.
++class BrowserOSTaskTabs
++    : public content::WebContentsUserData<BrowserOSTaskTabs> {
++ public:
++  BrowserOSTaskTabs(const BrowserOSTaskTabs&) = delete;
++  BrowserOSTaskTabs& operator=(const BrowserOSTaskTabs&) = delete;
++  ~BrowserOSTaskTabs() override;
++
++  // Whether |profile| groups the tabs of a task into shared renderers
++  static bool IsSharingEnabled(Profile* profile);
++
++  // Tags |web_contents| as a tab of |task_id|
++  static void SetTask(content::WebContents* web_contents,
++                      const std::string& task_id);
++
++  // A tab of |task_id| in |profile| whose renderer is alive, for a new tab
++  // of the task to share with, or null if there is none
++  static content::WebContents* FindTaskTab(Profile* profile,
++                                           const std::string& task_id);
++
++  const std::string& task_id() const { return task_id_; }
++
++ private:
++  friend class content::WebContentsUserData<BrowserOSTaskTabs>;
++
++  BrowserOSTaskTabs(content::WebContents* web_contents, std::string task_id);
++
++  const std::string task_id_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TASK_TABS_H_
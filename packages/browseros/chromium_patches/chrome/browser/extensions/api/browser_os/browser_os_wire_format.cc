@@ -0,0 +1,357 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_wire_format.cc b/chrome/browser/extensions/api/browser_os/browser_os_wire_format.cc
+new file mode 100644
+index 0000000000000..bc57886965fe1
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_wire_format.cc
+@@ -0,0 +1,351 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_wire_format.h"
++
++#include <charconv>
++#include <cmath>
++#include <cstdint>
++#include <initializer_list>
++#include <optional>
++#include <string_view>
++#include <unordered_map>
++#include <utility>
++#include <vector>
++
++#include "base/json/string_escape.h"
++#include "base/trace_event/trace_event.h"
++#include "base/types/expected_macros.h"
++#include "third_party/brotli/include/brotli/encode.h"
++#include "third_party/zlib/google/compression_utils.h"
++#include "third_party/zstd/src/lib/zstd.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Favour speed: payloads are compressed once per call, on the critical path
++constexpr int kBrotliQuality = 5;
++constexpr int kZstdLevel = 3;
++
++// Rough JSON bytes per node of a packed snapshot, to size the buffers
++constexpr size_t kNodeBytesEstimate = 24;
++constexpr size_t kRectBytesEstimate = 24;
++
++// One array of a packed payload, written straight to JSON text. Payloads
++// are mostly one number per field, so going through base::Value would
++// allocate a Value per number and then copy everything again into the text.
++class JsonArray {
++ public:
++  void Reserve(size_t bytes) { json_.reserve(bytes); }
++
++  void Append(int value) {
++    Separate();
++    char buffer[16];
++    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
++    json_.append(buffer, result.ptr);
++  }
++
++  // Non-finite values have no JSON form and are written as 0
++  void Append(double value) {
++    Separate();
++    if (!std::isfinite(value)) {
++      json_ += '0';
++      return;
++    }
++    char buffer[32];
++    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
++    json_.append(buffer, result.ptr);
++  }
++
++  void AppendString(std::string_view value) {
++    Separate();
++    base::EscapeJSONString(value, /* put_in_quotes= */ true, &json_);
++  }
++
++  size_t size() const { return size_; }
++  // The elements without the brackets
++  std::string_view elements() const { return json_; }
++
++ private:
++  void Separate() {
++    if (size_++) {
++      json_ += ',';
++    }
++  }
++
++  std::string json_;
++  size_t size_ = 0;
++};
++
++// Writes the JSON object of |fields|, in order, into a buffer sized for it
++std::string WritePayload(
++    std::initializer_list<std::pair<std::string_view, const JsonArray*>>
++        fields) {
++  size_t bytes = 2;
++  for (const auto& [name, array] : fields) {
++    bytes += name.size() + array->elements().size() + 6;
++  }
++  std::string json;
++  json.reserve(bytes);
++  json += '{';
++  for (const auto& [name, array] : fields) {
++    if (json.size() > 1) {
++      json += ',';
++    }
++    json += '"';
++    json += name;
++    json += "\":[";
++    json += array->elements();
++    json += ']';
++  }
++  json += '}';
++  return json;
++}
++
++// Interns the strings of one table of a packed payload
++class StringTable {
++ public:
++  int Intern(std::string_view value) {
++    auto [it, inserted] =
++        indices_.try_emplace(std::string(value), static_cast<int>(size_));
++    if (inserted) {
++      strings_.AppendString(value);
++      size_++;
++    }
++    return it->second;
++  }
++
++  int InternOptional(const std::optional<std::string>& value) {
++    return value ? Intern(*value) : -1;
++  }
++
++  const JsonArray& strings() const { return strings_; }
++
++ private:
++  std::unordered_map<std::string, int> indices_;
++  JsonArray strings_;
++  size_t size_ = 0;
++};
++
++// Position of |value| in its IDL enum. Generated enums start with kNone.
++template <typename Enum>
++int EnumPosition(Enum value) {
++  return static_cast<int>(value) - 1;
++}
++
++std::optional<std::vector<uint8_t>> Compress(
++    std::string_view data,
++    browser_os::WireCompression compression) {
++  const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
++  switch (compression) {
++    case browser_os::WireCompression::kNone:
++      return std::vector<uint8_t>(bytes, bytes + data.size());
++
++    case browser_os::WireCompression::kGzip: {
++      std::string compressed;
++      if (!compression::GzipCompress(data, &compressed)) {
++        return std::nullopt;
++      }
++      return std::vector<uint8_t>(compressed.begin(), compressed.end());
++    }
++
++    case browser_os::WireCompression::kBrotli: {
++      std::vector<uint8_t> compressed(
++          BrotliEncoderMaxCompressedSize(data.size()));
++      size_t compressed_size = compressed.size();
++      if (compressed.empty() ||
++          !BrotliEncoderCompress(kBrotliQuality, BROTLI_DEFAULT_WINDOW,
++                                 BROTLI_MODE_TEXT, data.size(), bytes,
++                                 &compressed_size, compressed.data())) {
++        return std::nullopt;
++      }
++      compressed.resize(compressed_size);
++      return compressed;
++    }
++
++    case browser_os::WireCompression::kZstd: {
++      std::vector<uint8_t> compressed(ZSTD_compressBound(data.size()));
++      const size_t compressed_size =
++          ZSTD_compress(compressed.data(), compressed.size(), data.data(),
++                        data.size(), kZstdLevel);
++      if (ZSTD_isError(compressed_size)) {
++        return std::nullopt;
++      }
++      compressed.resize(compressed_size);
++      return compressed;
++    }
++  }
++  return std::nullopt;
++}
++
++base::expected<browser_os::PackedPayload, std::string> Serialize(
++    std::string json,
++    browser_os::WireCompression compression) {
++  TRACE_EVENT("browser", "BrowserOS::CompressWireFormat", "bytes",
++              json.size());
++  std::optional<std::vector<uint8_t>> data = Compress(json, compression);
++  if (!data) {
++    return base::unexpected("Failed to compress packed payload");
++  }
++
++  browser_os::PackedPayload packed;
++  packed.version = kWireFormatVersion;
++  packed.compression = compression;
++  packed.uncompressed_size = static_cast<int>(json.size());
++  packed.data = std::move(*data);
++  return packed;
++}
++
++// Appends |item| as a row of a packed PageContent
++void AppendContentItem(const browser_os::ContentItem& item,
++                       const std::vector<std::string>& urls,
++                       StringTable& strings,
++                       JsonArray& items,
++                       JsonArray& hashes,
++                       bool& has_hashes) {
++  items.Append(EnumPosition(item.type));
++  items.Append(strings.InternOptional(item.text));
++  if (item.url) {
++    items.Append(strings.Intern(*item.url));
++  } else if (item.url_index && *item.url_index >= 0 &&
++             static_cast<size_t>(*item.url_index) < urls.size()) {
++    items.Append(strings.Intern(urls[*item.url_index]));
++  } else {
++    items.Append(-1);
++  }
++  items.Append(item.level.value_or(0));
++  items.Append(strings.InternOptional(item.alt));
++  hashes.AppendString(item.hash ? std::string_view(*item.hash) : "");
++  has_hashes |= item.hash && !item.hash->empty();
++}
++
++}  // namespace
++
++base::expected<browser_os::InteractiveSnapshot, std::string>
++PackInteractiveSnapshot(browser_os::InteractiveSnapshot snapshot,
++                        browser_os::WireCompression compression) {
++  TRACE_EVENT("browser", "BrowserOS::PackInteractiveSnapshot", "nodes",
++              snapshot.elements.size());
++  StringTable keys;
++  StringTable roles;
++  StringTable strings;
++  JsonArray nodes;
++  JsonArray rects;
++  JsonArray attributes;
++  nodes.Reserve(snapshot.elements.size() * kNodeBytesEstimate);
++  rects.Reserve(snapshot.elements.size() * kRectBytesEstimate);
++
++  for (const browser_os::InteractiveNode& node : snapshot.elements) {
++    int role = -1;
++    int attribute_count = 0;
++    if (node.attributes) {
++      for (const auto [key, value] : node.attributes->additional_properties) {
++        if (!value.is_string()) {
++          continue;
++        }
++        if (key == "role") {
++          role = roles.Intern(value.GetString());
++          continue;
++        }
++        attributes.Append(keys.Intern(key));
++        attributes.Append(strings.Intern(value.GetString()));
++        attribute_count++;
++      }
++    }
++
++    nodes.Append(node.node_id);
++    nodes.Append(EnumPosition(node.type));
++    nodes.Append(role);
++    nodes.Append(strings.InternOptional(node.name));
++    nodes.Append(attribute_count);
++
++    if (node.rect) {
++      rects.Append(node.rect->x);
++      rects.Append(node.rect->y);
++      rects.Append(node.rect->width);
++      rects.Append(node.rect->height);
++    } else {
++      for (int i = 0; i < 4; ++i) {
++        rects.Append(0);
++      }
++    }
++  }
++
++  std::string payload = WritePayload({{"attributes", &attributes},
++                                      {"keys", &keys.strings()},
++                                      {"nodes", &nodes},
++                                      {"rects", &rects},
++                                      {"roles", &roles.strings()},
++                                      {"strings", &strings.strings()}});
++  ASSIGN_OR_RETURN(browser_os::PackedPayload packed,
++                   Serialize(std::move(payload), compression));
++  snapshot.elements.clear();
++  snapshot.packed = std::move(packed);
++  return snapshot;
++}
++
++base::expected<browser_os::PageContent, std::string> PackPageContent(
++    browser_os::PageContent content,
++    browser_os::WireCompression compression) {
++  TRACE_EVENT("browser", "BrowserOS::PackPageContent", "items",
++              content.items.size());
++  const std::vector<std::string> urls =
++      std::move(content.urls).value_or(std::vector<std::string>());
++  StringTable strings;
++  JsonArray items;
++  JsonArray hashes;
++  JsonArray changes;
++  bool has_hashes = false;
++  int rows = 0;
++
++  for (const browser_os::ContentItem& item : content.items) {
++    AppendContentItem(item, urls, strings, items, hashes, has_hashes);
++    rows++;
++  }
++  if (content.changes) {
++    for (const browser_os::ContentItemChange& change : *content.changes) {
++      changes.Append(EnumPosition(change.type));
++      changes.Append(change.index);
++      if (change.item) {
++        AppendContentItem(*change.item, urls, strings, items, hashes,
++                          has_hashes);
++        changes.Append(rows++);
++      } else {
++        changes.Append(-1);
++      }
++    }
++  }
++
++  std::string payload;
++  if (has_hashes && content.changes) {
++    payload = WritePayload({{"changes", &changes},
++                            {"hashes", &hashes},
++                            {"items", &items},
++                            {"strings", &strings.strings()}});
++  } else if (has_hashes) {
++    payload = WritePayload({{"hashes", &hashes},
++                            {"items", &items},
++                            {"strings", &strings.strings()}});
++  } else if (content.changes) {
++    payload = WritePayload({{"changes", &changes},
++                            {"items", &items},
++                            {"strings", &strings.strings()}});
++  } else {
++    payload =
++        WritePayload({{"items", &items}, {"strings", &strings.strings()}});
++  }
++
++  ASSIGN_OR_RETURN(browser_os::PackedPayload packed,
++                   Serialize(std::move(payload), compression));
++  content.items.clear();
++  content.changes.reset();
++  content.urls.reset();
++  content.packed = std::move(packed);
++  return content;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,61 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_wire_format.h b/chrome/browser/extensions/api/browser_os/browser_os_wire_format.h
+new file mode 100644
+index 0000000000000..eea8634574614
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_wire_format.h
+@@ -0,0 +1,55 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_WIRE_FORMAT_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_WIRE_FORMAT_H_
++
++#include <string>
++
++#include "base/types/expected.h"
++#include "chrome/common/extensions/api/browser_os.h"
++
++namespace extensions {
++namespace api {
++
++// Compact wire form of snapshot results, requested through wireFormat, for
++// callers that forward them rather than read them, like the browserOS
++// extension relaying to the BrowserOS server over its port.
++//
++// The payload is JSON of flat arrays. Attribute keys and all other strings
++// are sent once, in tables, and referenced by index, -1 meaning unset.
++// Enums are sent as their position in the IDL, starting at 0. Version 1
++// layouts:
++//
++// InteractiveSnapshot.elements:
++//   keys        attribute keys
++//   roles       role names
++//   strings     names and attribute values
++//   nodes       5 per node: nodeId, type, role, name, attribute count
++//   rects       4 per node: x, y, width, height
++//   attributes  2 per attribute, in node order: key, value
++//
++// PageContent.items and .changes:
++//   strings     texts, URLs and alts. URLs are given in full even with the
++//               URL table.
++//   items       5 per item: type, text, url, level (0 if unset), alt
++//   hashes      the items' hashes, if they have any
++//   changes     3 per change: type, index, row in |items| or -1
++inline constexpr int kWireFormatVersion = 1;
++
++// Moves |snapshot|'s elements into its packed payload. Touches no browser
++// state, so it can run on the ThreadPool.
++base::expected<browser_os::InteractiveSnapshot, std::string>
++PackInteractiveSnapshot(browser_os::InteractiveSnapshot snapshot,
++                        browser_os::WireCompression compression);
++
++// Moves |content|'s items and changes into its packed payload
++base::expected<browser_os::PageContent, std::string> PackPageContent(
++    browser_os::PageContent content,
++    browser_os::WireCompression compression);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_WIRE_FORMAT_H_
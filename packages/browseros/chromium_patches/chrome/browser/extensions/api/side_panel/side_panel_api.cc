@@ -19,7 +19,7 @@ index f89e8095cc91f..90e334e435f2a 100644
  
    std::optional<api::side_panel::Open::Params> params =
        api::side_panel::Open::Params::Create(args());
-@@ -152,4 +152,54 @@ ExtensionFunction::ResponseAction SidePanelCloseFunction::RunFunction() {
+@@ -152,4 +152,116 @@ ExtensionFunction::ResponseAction SidePanelCloseFunction::RunFunction() {
    return RespondNow(NoArguments());
  }
  
@@ -72,5 +72,67 @@ index f89e8095cc91f..90e334e435f2a 100644
 +
 +  return RespondNow(WithArguments(is_open_result.value()));
 +}
++
++namespace {
++
++std::vector<api::side_panel::BrowserosTabPanelState> ToTabPanelStates(
++    const std::vector<int>& tab_ids,
++    std::vector<base::expected<bool, std::string>> results) {
++  std::vector<api::side_panel::BrowserosTabPanelState> states;
++  states.reserve(tab_ids.size());
++  for (size_t i = 0; i < tab_ids.size(); ++i) {
++    api::side_panel::BrowserosTabPanelState state;
++    state.tab_id = tab_ids[i];
++    if (results[i].has_value()) {
++      state.opened = results[i].value();
++    } else {
++      state.error = std::move(results[i].error());
++    }
++    states.push_back(std::move(state));
++  }
++  return states;
++}
++
++}  // namespace
++
++ExtensionFunction::ResponseAction
++SidePanelBrowserosToggleTabsFunction::RunFunction() {
++  EXTENSION_FUNCTION_VALIDATE(extension());
++
++  std::optional<api::side_panel::BrowserosToggleTabs::Params> params =
++      api::side_panel::BrowserosToggleTabs::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  SidePanelService* service = GetService();
++  std::vector<base::expected<bool, std::string>> toggle_results =
++      service->BrowserosToggleSidePanelForTabs(
++          *extension(), browser_context(), params->options.tab_ids,
++          include_incognito_information(), params->options.open);
++
++  return RespondNow(
++      ArgumentList(api::side_panel::BrowserosToggleTabs::Results::Create(
++          ToTabPanelStates(params->options.tab_ids,
++                           std::move(toggle_results)))));
++}
++
++ExtensionFunction::ResponseAction
++SidePanelBrowserosIsOpenTabsFunction::RunFunction() {
++  EXTENSION_FUNCTION_VALIDATE(extension());
++
++  std::optional<api::side_panel::BrowserosIsOpenTabs::Params> params =
++      api::side_panel::BrowserosIsOpenTabs::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  SidePanelService* service = GetService();
++  std::vector<base::expected<bool, std::string>> is_open_results =
++      service->BrowserosIsSidePanelOpenForTabs(
++          *extension(), browser_context(), params->options.tab_ids,
++          include_incognito_information());
++
++  return RespondNow(
++      ArgumentList(api::side_panel::BrowserosIsOpenTabs::Results::Create(
++          ToTabPanelStates(params->options.tab_ids,
++                           std::move(is_open_results)))));
++}
 +
  }  // namespace extensions
@@ -2,7 +2,7 @@ diff --git a/chrome/browser/extensions/api/side_panel/side_panel_api.h b/chrome/
 index 72a88888eb9fc..3f0779a57b615 100644
 --- a/chrome/browser/extensions/api/side_panel/side_panel_api.h
 +++ b/chrome/browser/extensions/api/side_panel/side_panel_api.h
-@@ -115,6 +115,36 @@ class SidePanelCloseFunction : public SidePanelApiFunction {
+@@ -115,6 +115,66 @@ class SidePanelCloseFunction : public SidePanelApiFunction {
    ResponseAction RunFunction() override;
  };
  
@@ -35,6 +35,36 @@ index 72a88888eb9fc..3f0779a57b615 100644
 +  ~SidePanelBrowserosIsOpenFunction() override = default;
 +  ResponseAction RunFunction() override;
 +};
++
++class SidePanelBrowserosToggleTabsFunction : public SidePanelApiFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("sidePanel.browserosToggleTabs",
++                             SIDEPANEL_BROWSEROSTOGGLETABS)
++  SidePanelBrowserosToggleTabsFunction() = default;
++  SidePanelBrowserosToggleTabsFunction(
++      const SidePanelBrowserosToggleTabsFunction&) = delete;
++  SidePanelBrowserosToggleTabsFunction& operator=(
++      const SidePanelBrowserosToggleTabsFunction&) = delete;
++
++ private:
++  ~SidePanelBrowserosToggleTabsFunction() override = default;
++  ResponseAction RunFunction() override;
++};
++
++class SidePanelBrowserosIsOpenTabsFunction : public SidePanelApiFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("sidePanel.browserosIsOpenTabs",
++                             SIDEPANEL_BROWSEROSISOPENTABS)
++  SidePanelBrowserosIsOpenTabsFunction() = default;
++  SidePanelBrowserosIsOpenTabsFunction(
++      const SidePanelBrowserosIsOpenTabsFunction&) = delete;
++  SidePanelBrowserosIsOpenTabsFunction& operator=(
++      const SidePanelBrowserosIsOpenTabsFunction&) = delete;
++
++ private:
++  ~SidePanelBrowserosIsOpenTabsFunction() override = default;
++  ResponseAction RunFunction() override;
++};
 +
  }  // namespace extensions
  
@@ -13,7 +13,7 @@ index 0582cf9b5141a..d3ec91af0f140 100644
  #include "chrome/browser/extensions/extension_tab_util.h"
  #include "chrome/browser/profiles/profile.h"
  #include "chrome/browser/ui/browser_window/public/browser_window_interface.h"
-@@ -464,6 +466,139 @@ void SidePanelService::OnExtensionUninstalled(
+@@ -464,6 +466,187 @@ void SidePanelService::OnExtensionUninstalled(
    RemoveExtensionOptions(extension->id());
  }
  
@@ -24,7 +24,58 @@ index 0582cf9b5141a..d3ec91af0f140 100644
 +    int tab_id,
 +    bool include_incognito_information,
 +    std::optional<bool> desired_state) {
-+  LOG(INFO) << "browseros: BrowserosToggleSidePanelForTab called for tab_id="
++  return BrowserosToggleTab(extension, context, tab_id,
++                            include_incognito_information, desired_state,
++                            GetOptions(extension, std::nullopt).path);
++}
++
++std::vector<base::expected<bool, std::string>>
++SidePanelService::BrowserosToggleSidePanelForTabs(
++    const Extension& extension,
++    content::BrowserContext* context,
++    const std::vector<int>& tab_ids,
++    bool include_incognito_information,
++    std::optional<bool> desired_state) {
++  LOG(INFO) << "browseros: BrowserosToggleSidePanelForTabs called for "
++            << tab_ids.size() << " tabs, extension=" << extension.id();
++
++  // Resolved once; every tab without its own options gets the same path.
++  const std::optional<std::string> default_path =
++      GetOptions(extension, std::nullopt).path;
++
++  std::vector<base::expected<bool, std::string>> results;
++  results.reserve(tab_ids.size());
++  for (int tab_id : tab_ids) {
++    results.push_back(BrowserosToggleTab(extension, context, tab_id,
++                                         include_incognito_information,
++                                         desired_state, default_path));
++  }
++  return results;
++}
++
++std::vector<base::expected<bool, std::string>>
++SidePanelService::BrowserosIsSidePanelOpenForTabs(
++    const Extension& extension,
++    content::BrowserContext* context,
++    const std::vector<int>& tab_ids,
++    bool include_incognito_information) {
++  std::vector<base::expected<bool, std::string>> results;
++  results.reserve(tab_ids.size());
++  for (int tab_id : tab_ids) {
++    results.push_back(BrowserosIsSidePanelOpenForTab(
++        extension, context, tab_id, include_incognito_information));
++  }
++  return results;
++}
++
++base::expected<bool, std::string> SidePanelService::BrowserosToggleTab(
++    const Extension& extension,
++    content::BrowserContext* context,
++    int tab_id,
++    bool include_incognito_information,
++    std::optional<bool> desired_state,
++    const std::optional<std::string>& default_path) {
++  LOG(INFO) << "browseros: BrowserosToggleTab called for tab_id="
 +            << tab_id << ", extension=" << extension.id()
 +            << ", desired_state="
 +            << (desired_state.has_value()
@@ -63,10 +114,7 @@ index 0582cf9b5141a..d3ec91af0f140 100644
 +            << " for tab_id=" << tab_id;
 +
 +  if (!has_contextual_options) {
-+    // Get the default/manifest path to use for this contextual panel.
-+    api::side_panel::PanelOptions default_options =
-+        GetOptions(extension, std::nullopt);
-+    if (!default_options.path) {
++    if (!default_path) {
 +      LOG(WARNING) << "browseros: No side panel path configured for extension="
 +                   << extension.id();
 +      return base::unexpected(
@@ -75,12 +123,12 @@ index 0582cf9b5141a..d3ec91af0f140 100644
 +    }
 +
 +    LOG(INFO) << "browseros: Auto-registering contextual panel for tab_id="
-+              << tab_id << " with path=" << *default_options.path;
++              << tab_id << " with path=" << *default_path;
 +
 +    // Create contextual options for this tab.
 +    api::side_panel::PanelOptions contextual_options;
 +    contextual_options.tab_id = tab_id;
-+    contextual_options.path = std::move(default_options.path);
++    contextual_options.path = default_path;
 +    contextual_options.enabled = true;
 +    SetOptions(extension, std::move(contextual_options));
 +  }
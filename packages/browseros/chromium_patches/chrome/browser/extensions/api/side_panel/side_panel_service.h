@@ -2,7 +2,7 @@ diff --git a/chrome/browser/extensions/api/side_panel/side_panel_service.h b/chr
 index 623e81e776d2f..cfe2abc1b2bc7 100644
 --- a/chrome/browser/extensions/api/side_panel/side_panel_service.h
 +++ b/chrome/browser/extensions/api/side_panel/side_panel_service.h
-@@ -161,6 +161,26 @@ class SidePanelService : public BrowserContextKeyedAPI,
+@@ -161,6 +161,52 @@ class SidePanelService : public BrowserContextKeyedAPI,
                               std::optional<int> tab_id,
                               const std::string& path);
  
@@ -25,7 +25,33 @@ index 623e81e776d2f..cfe2abc1b2bc7 100644
 +      content::BrowserContext* context,
 +      int tab_id,
 +      bool include_incognito_information);
++
++  // Multi-tab variants of the two methods above. Return one result per entry
++  // of `tab_ids`, in the same order; a tab that fails doesn't affect the
++  // others. The default panel path is resolved once for the whole call.
++  std::vector<base::expected<bool, std::string>>
++  BrowserosToggleSidePanelForTabs(const Extension& extension,
++                                  content::BrowserContext* context,
++                                  const std::vector<int>& tab_ids,
++                                  bool include_incognito_information,
++                                  std::optional<bool> desired_state);
++  std::vector<base::expected<bool, std::string>>
++  BrowserosIsSidePanelOpenForTabs(const Extension& extension,
++                                  content::BrowserContext* context,
++                                  const std::vector<int>& tab_ids,
++                                  bool include_incognito_information);
 +
   private:
    friend class BrowserContextKeyedAPIFactory<SidePanelService>;
++
++  // Toggles the panel on one tab. `default_path` is the extension's resolved
++  // default panel path, used to register contextual options for a tab that
++  // has none.
++  base::expected<bool, std::string> BrowserosToggleTab(
++      const Extension& extension,
++      content::BrowserContext* context,
++      int tab_id,
++      bool include_incognito_information,
++      std::optional<bool> desired_state,
++      const std::optional<std::string>& default_path);
  
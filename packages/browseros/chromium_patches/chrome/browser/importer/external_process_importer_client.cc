@@ -2,11 +2,12 @@ diff --git a/chrome/browser/importer/external_process_importer_client.cc b/chrom
 index 6ee7a959fde3e..e60d680b1a99b 100644
 --- a/chrome/browser/importer/external_process_importer_client.cc
 +++ b/chrome/browser/importer/external_process_importer_client.cc
-@@ -14,10 +14,12 @@
+@@ -14,10 +14,13 @@
  #include "chrome/common/importer/firefox_importer_utils.h"
  #include "chrome/common/importer/profile_import.mojom.h"
  #include "chrome/grit/generated_resources.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_metrics.h"
  #include "components/strings/grit/components_strings.h"
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
  #include "content/public/browser/child_process_host.h"
@@ -15,32 +16,50 @@ index 6ee7a959fde3e..e60d680b1a99b 100644
  #include "ui/base/l10n/l10n_util.h"
  
  ExternalProcessImporterClient::ExternalProcessImporterClient(
-@@ -221,6 +223,72 @@ void ExternalProcessImporterClient::OnPasswordFormImportReady(
+@@ -221,6 +224,138 @@ void ExternalProcessImporterClient::OnPasswordFormImportReady(
    bridge_->SetPasswordForm(form);
  }
  
-+void ExternalProcessImporterClient::OnCookieImportReady(
-+    chrome::mojom::ImportedCookieEntryPtr mojo_cookie) {
++void ExternalProcessImporterClient::OnPasswordFormsImportGroup(
++    const std::vector<user_data_importer::ImportedPasswordForm>& forms_group) {
++  if (cancelled_)
++    return;
++
++  bridge_->SetPasswordForms(forms_group);
++}
++
+void ExternalProcessImporterClient::OnHistoryImportChunk(
++    const std::vector<user_data_importer::ImporterURLRow>& history_rows,
++    int visit_source) {
 +  if (cancelled_)
 +    return;
 +
++  bridge_->AddHistoryItems(
++      history_rows,
++      static_cast<user_data_importer::VisitSource>(visit_source));
++}
++
++namespace {
++
++browseros_importer::ImportedCookieEntry ConvertFromMojoCookie(
++    const chrome::mojom::ImportedCookieEntry& mojo_cookie) {
 +  browseros_importer::ImportedCookieEntry cookie;
-+  cookie.host_key = mojo_cookie->host_key;
-+  cookie.name = mojo_cookie->name;
-+  cookie.value = mojo_cookie->value;
-+  cookie.path = mojo_cookie->path;
++  cookie.host_key = mojo_cookie.host_key;
++  cookie.name = mojo_cookie.name;
++  cookie.value = mojo_cookie.value;
++  cookie.path = mojo_cookie.path;
 +  cookie.expires_utc = base::Time::FromDeltaSinceWindowsEpoch(
-+      base::Microseconds(mojo_cookie->expires_utc));
++      base::Microseconds(mojo_cookie.expires_utc));
 +  cookie.creation_utc = base::Time::FromDeltaSinceWindowsEpoch(
-+      base::Microseconds(mojo_cookie->creation_utc));
++      base::Microseconds(mojo_cookie.creation_utc));
 +  cookie.last_access_utc = base::Time::FromDeltaSinceWindowsEpoch(
-+      base::Microseconds(mojo_cookie->last_access_utc));
++      base::Microseconds(mojo_cookie.last_access_utc));
 +  cookie.last_update_utc = base::Time::FromDeltaSinceWindowsEpoch(
-+      base::Microseconds(mojo_cookie->last_update_utc));
-+  cookie.is_secure = mojo_cookie->is_secure;
-+  cookie.is_httponly = mojo_cookie->is_httponly;
++      base::Microseconds(mojo_cookie.last_update_utc));
++  cookie.is_secure = mojo_cookie.is_secure;
++  cookie.is_httponly = mojo_cookie.is_httponly;
 +
-+  switch (mojo_cookie->same_site) {
++  switch (mojo_cookie.same_site) {
 +    case chrome::mojom::ImportedCookieEntry::SameSite::kUnspecified:
 +      cookie.same_site = net::CookieSameSite::UNSPECIFIED;
 +      break;
@@ -55,7 +74,7 @@ index 6ee7a959fde3e..e60d680b1a99b 100644
 +      break;
 +  }
 +
-+  switch (mojo_cookie->priority) {
++  switch (mojo_cookie.priority) {
 +    case chrome::mojom::ImportedCookieEntry::Priority::kLow:
 +      cookie.priority = net::COOKIE_PRIORITY_LOW;
 +      break;
@@ -67,7 +86,7 @@ index 6ee7a959fde3e..e60d680b1a99b 100644
 +      break;
 +  }
 +
-+  switch (mojo_cookie->source_scheme) {
++  switch (mojo_cookie.source_scheme) {
 +    case chrome::mojom::ImportedCookieEntry::SourceScheme::kUnset:
 +      cookie.source_scheme = net::CookieSourceScheme::kUnset;
 +      break;
@@ -79,16 +98,65 @@ index 6ee7a959fde3e..e60d680b1a99b 100644
 +      break;
 +  }
 +
-+  cookie.source_port = mojo_cookie->source_port;
-+  cookie.is_persistent = mojo_cookie->is_persistent;
++  cookie.source_port = mojo_cookie.source_port;
++  cookie.is_persistent = mojo_cookie.is_persistent;
++
++  return cookie;
++}
++
++}  // namespace
++
++void ExternalProcessImporterClient::OnBookmarkTreeImportStart(
++    const std::u16string& first_folder_name,
++    uint32_t total_bookmarks_count) {
++  if (cancelled_)
++    return;
++
++  bookmark_tree_folder_name_ = first_folder_name;
++  bookmark_tree_count_ = total_bookmarks_count;
++  bookmark_tree_.clear();
++  bookmark_tree_.reserve(total_bookmarks_count);
++}
++
++void ExternalProcessImporterClient::OnBookmarkTreeImportGroup(
++    const std::vector<user_data_importer::ImportedBookmarkEntry>&
++        bookmarks_group) {
++  if (cancelled_)
++    return;
++
++  bookmark_tree_.insert(bookmark_tree_.end(), bookmarks_group.begin(),
++                        bookmarks_group.end());
++  if (bookmark_tree_.size() >= bookmark_tree_count_) {
++    bridge_->AddBookmarkTree(bookmark_tree_, bookmark_tree_folder_name_);
++    bookmark_tree_.clear();
++  }
++}
++
++void ExternalProcessImporterClient::OnCookieImportReady(
++    chrome::mojom::ImportedCookieEntryPtr mojo_cookie) {
++  if (cancelled_)
++    return;
++
++  bridge_->SetCookie(ConvertFromMojoCookie(*mojo_cookie));
++}
 +
-+  bridge_->SetCookie(cookie);
++void ExternalProcessImporterClient::OnCookiesImportGroup(
++    std::vector<chrome::mojom::ImportedCookieEntryPtr> cookies_group) {
++  if (cancelled_)
++    return;
++
++  std::vector<browseros_importer::ImportedCookieEntry> cookies;
++  cookies.reserve(cookies_group.size());
++  for (const auto& mojo_cookie : cookies_group) {
++    cookies.push_back(ConvertFromMojoCookie(*mojo_cookie));
++  }
++  bridge_->SetCookies(cookies);
 +}
 +
  void ExternalProcessImporterClient::OnKeywordsImportReady(
      const std::vector<user_data_importer::SearchEngineInfo>& search_engines,
      bool unique_on_host_and_path) {
-@@ -251,6 +319,14 @@ void ExternalProcessImporterClient::OnAutofillFormDataImportGroup(
+@@ -251,6 +386,31 @@ void ExternalProcessImporterClient::OnAutofillFormDataImportGroup(
      bridge_->SetAutofillFormData(autofill_form_data_);
  }
  
@@ -99,6 +167,23 @@ index 6ee7a959fde3e..e60d680b1a99b 100644
 +
 +  bridge_->SetExtensions(extension_ids);
 +}
++
++void ExternalProcessImporterClient::OnImportItemMetrics(
++    user_data_importer::ImportItem item,
++    uint32_t rows,
++    int64_t read_time_us,
++    int64_t decrypt_time_us,
++    int64_t deliver_time_us) {
++  if (cancelled_)
++    return;
++
++  browseros_importer::ImportItemMetrics metrics;
++  metrics.rows = rows;
++  metrics.read_time = base::Microseconds(read_time_us);
++  metrics.decrypt_time = base::Microseconds(decrypt_time_us);
++  metrics.deliver_time = base::Microseconds(deliver_time_us);
++  bridge_->NotifyItemMetrics(item, metrics);
++}
 +
  ExternalProcessImporterClient::~ExternalProcessImporterClient() = default;
  
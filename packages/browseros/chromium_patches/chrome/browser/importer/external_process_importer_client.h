@@ -2,21 +2,47 @@ diff --git a/chrome/browser/importer/external_process_importer_client.h b/chrome
 index 42b466d3ce66b..eaa231f2015c3 100644
 --- a/chrome/browser/importer/external_process_importer_client.h
 +++ b/chrome/browser/importer/external_process_importer_client.h
-@@ -73,6 +73,8 @@ class ExternalProcessImporterClient
+@@ -73,6 +73,22 @@ class ExternalProcessImporterClient
        const favicon_base::FaviconUsageDataList& favicons_group) override;
    void OnPasswordFormImportReady(
        const user_data_importer::ImportedPasswordForm& form) override;
++  void OnPasswordFormsImportGroup(
++      const std::vector<user_data_importer::ImportedPasswordForm>& forms_group)
++      override;
++  void OnHistoryImportChunk(
++      const std::vector<user_data_importer::ImporterURLRow>& history_rows,
++      int visit_source) override;
++  void OnBookmarkTreeImportStart(const std::u16string& first_folder_name,
++                                 uint32_t total_bookmarks_count) override;
++  void OnBookmarkTreeImportGroup(
++      const std::vector<user_data_importer::ImportedBookmarkEntry>&
++          bookmarks_group) override;
 +  void OnCookieImportReady(
 +      chrome::mojom::ImportedCookieEntryPtr cookie) override;
++  void OnCookiesImportGroup(
++      std::vector<chrome::mojom::ImportedCookieEntryPtr> cookies_group)
++      override;
    void OnKeywordsImportReady(
        const std::vector<user_data_importer::SearchEngineInfo>& search_engines,
        bool unique_on_host_and_path) override;
-@@ -81,6 +83,8 @@ class ExternalProcessImporterClient
+@@ -81,6 +97,20 @@ class ExternalProcessImporterClient
    void OnAutofillFormDataImportGroup(
        const std::vector<ImporterAutofillFormDataEntry>&
            autofill_form_data_entry_group) override;
 +  void OnExtensionsImportReady(
 +      const std::vector<std::string>& extension_ids) override;
++  void OnImportItemMetrics(user_data_importer::ImportItem item,
++                           uint32_t rows,
++                           int64_t read_time_us,
++                           int64_t decrypt_time_us,
++                           int64_t deliver_time_us) override;
++
++ private:
++  // Bookmark tree import collected so far, written once it reaches
++  // |bookmark_tree_count_|
++  std::vector<user_data_importer::ImportedBookmarkEntry> bookmark_tree_;
++  std::u16string bookmark_tree_folder_name_;
++  size_t bookmark_tree_count_ = 0;
  
   protected:
    ~ExternalProcessImporterClient() override;
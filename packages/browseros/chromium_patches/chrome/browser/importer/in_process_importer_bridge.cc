@@ -2,11 +2,15 @@ diff --git a/chrome/browser/importer/in_process_importer_bridge.cc b/chrome/brow
 index fbb20f1ae0668..2ae55dd11704a 100644
 --- a/chrome/browser/importer/in_process_importer_bridge.cc
 +++ b/chrome/browser/importer/in_process_importer_bridge.cc
-@@ -21,11 +21,16 @@
+@@ -21,11 +21,48 @@
  #include "components/search_engines/template_url.h"
  #include "components/search_engines/template_url_parser.h"
  #include "components/search_engines/template_url_prepopulate_data.h"
++#include "base/metrics/histogram_functions.h"
++#include "base/timer/elapsed_timer.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_metrics.h"
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
  #include "ui/base/l10n/l10n_util.h"
  
@@ -15,11 +19,39 @@ index fbb20f1ae0668..2ae55dd11704a 100644
 +// Temporary definition for Chrome imported visits, mapped to value 4
 +const history::VisitSource SOURCE_CHROME_IMPORTED =
 +    static_cast<history::VisitSource>(4);
++
++// Name of |item| in import histograms and metrics events
++std::string GetImportItemMetricsName(user_data_importer::ImportItem item) {
++  switch (item) {
++    case user_data_importer::HISTORY:
++      return "History";
++    case user_data_importer::FAVORITES:
++      return "Bookmarks";
++    case user_data_importer::PASSWORDS:
++      return "Passwords";
++    case user_data_importer::COOKIES:
++      return "Cookies";
++    case user_data_importer::AUTOFILL_FORM_DATA:
++      return "Autofill";
++    case user_data_importer::EXTENSIONS:
++      return "Extensions";
++    default:
++      return "Other";
++  }
++}
++
++// Records how long writing one batch of |item| into the profile took
++void RecordImportWriteTime(user_data_importer::ImportItem item,
++                           base::TimeDelta write_time) {
++  base::UmaHistogramMediumTimes(
++      "BrowserOS.Import." + GetImportItemMetricsName(item) + ".WriteTime",
++      write_time);
++}
 +
  history::URLRows ConvertImporterURLRowsToHistoryURLRows(
      const std::vector<user_data_importer::ImporterURLRow>& rows) {
    history::URLRows converted;
-@@ -53,6 +58,8 @@ history::VisitSource ConvertImporterVisitSourceToHistoryVisitSource(
+@@ -53,6 +90,8 @@ history::VisitSource ConvertImporterVisitSourceToHistoryVisitSource(
        return history::SOURCE_IE_IMPORTED;
      case user_data_importer::VISIT_SOURCE_SAFARI_IMPORTED:
        return history::SOURCE_SAFARI_IMPORTED;
@@ -28,19 +60,56 @@ index fbb20f1ae0668..2ae55dd11704a 100644
    }
    NOTREACHED();
  }
-@@ -151,6 +158,11 @@ void InProcessImporterBridge::SetPasswordForm(
+@@ -151,6 +190,48 @@ void InProcessImporterBridge::SetPasswordForm(
    writer_->AddPasswordForm(ConvertImportedPasswordForm(form));
  }
  
++void InProcessImporterBridge::SetPasswordForms(
++    const std::vector<user_data_importer::ImportedPasswordForm>& forms) {
++  std::vector<password_manager::PasswordForm> converted;
++  converted.reserve(forms.size());
++  for (const auto& form : forms) {
++    converted.push_back(ConvertImportedPasswordForm(form));
++  }
++  base::ElapsedTimer write_timer;
++  writer_->AddPasswordForms(converted);
++  RecordImportWriteTime(user_data_importer::PASSWORDS, write_timer.Elapsed());
++}
++
++void InProcessImporterBridge::AddHistoryItems(
++    const std::vector<user_data_importer::ImporterURLRow>& rows,
++    user_data_importer::VisitSource visit_source) {
++  // Each call is written on its own here, so a chunk is just a smaller set
++  base::ElapsedTimer write_timer;
++  SetHistoryItems(rows, visit_source);
++  RecordImportWriteTime(user_data_importer::HISTORY, write_timer.Elapsed());
++}
++
++void InProcessImporterBridge::AddBookmarkTree(
++    const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks,
++    const std::u16string& first_folder_name) {
++  base::ElapsedTimer write_timer;
++  writer_->AddBookmarkTree(bookmarks, first_folder_name);
++  RecordImportWriteTime(user_data_importer::FAVORITES, write_timer.Elapsed());
++}
++
 +void InProcessImporterBridge::SetCookie(
 +    const browseros_importer::ImportedCookieEntry& cookie) {
 +  writer_->AddCookie(cookie);
 +}
++
++void InProcessImporterBridge::SetCookies(
++    const std::vector<browseros_importer::ImportedCookieEntry>& cookies) {
++  // Only the hand-off to the CookieManager; the writes finish later
++  base::ElapsedTimer write_timer;
++  writer_->AddCookies(cookies);
++  RecordImportWriteTime(user_data_importer::COOKIES, write_timer.Elapsed());
++}
 +
  void InProcessImporterBridge::SetAutofillFormData(
      const std::vector<ImporterAutofillFormDataEntry>& entries) {
    std::vector<autofill::AutocompleteEntry> autocomplete_entries;
-@@ -168,6 +180,15 @@ void InProcessImporterBridge::SetAutofillFormData(
+@@ -168,6 +249,41 @@ void InProcessImporterBridge::SetAutofillFormData(
    writer_->AddAutocompleteFormDataEntries(autocomplete_entries);
  }
  
@@ -52,6 +121,32 @@ index fbb20f1ae0668..2ae55dd11704a 100644
 +  // Pass the extension IDs to the profile writer to handle installation
 +  writer_->AddExtensions(extension_ids);
 +}
++
++void InProcessImporterBridge::NotifyItemMetrics(
++    user_data_importer::ImportItem item,
++    const browseros_importer::ImportItemMetrics& metrics) {
++  const std::string name = GetImportItemMetricsName(item);
++  const std::string histogram_prefix = "BrowserOS.Import." + name;
++  base::UmaHistogramCounts1M(histogram_prefix + ".Rows", metrics.rows);
++  base::UmaHistogramMediumTimes(histogram_prefix + ".ReadTime",
++                                metrics.read_time);
++  base::UmaHistogramMediumTimes(histogram_prefix + ".DecryptTime",
++                                metrics.decrypt_time);
++  base::UmaHistogramMediumTimes(histogram_prefix + ".DeliverTime",
++                                metrics.deliver_time);
++
++  const base::TimeDelta total_time = metrics.read_time + metrics.deliver_time;
++  const double rows_per_second =
++      total_time.is_positive() ? metrics.rows / total_time.InSecondsF() : 0;
++  browseros_metrics::BrowserOSMetrics::Log(
++      "import.item.finished",
++      {{"item", base::Value(name)},
++       {"rows", base::Value(static_cast<double>(metrics.rows))},
++       {"read_ms", base::Value(metrics.read_time.InMillisecondsF())},
++       {"decrypt_ms", base::Value(metrics.decrypt_time.InMillisecondsF())},
++       {"deliver_ms", base::Value(metrics.deliver_time.InMillisecondsF())},
++       {"rows_per_second", base::Value(rows_per_second)}});
++}
 +
  void InProcessImporterBridge::NotifyStarted() {
    host_->NotifyImportStarted();
@@ -2,17 +2,35 @@ diff --git a/chrome/browser/importer/in_process_importer_bridge.h b/chrome/brows
 index 61190844025f0..08ce2bd965704 100644
 --- a/chrome/browser/importer/in_process_importer_bridge.h
 +++ b/chrome/browser/importer/in_process_importer_bridge.h
-@@ -49,9 +49,14 @@ class InProcessImporterBridge : public ImporterBridge {
+@@ -49,9 +49,32 @@ class InProcessImporterBridge : public ImporterBridge {
    void SetPasswordForm(
        const user_data_importer::ImportedPasswordForm& form) override;
  
++  void SetPasswordForms(
++      const std::vector<user_data_importer::ImportedPasswordForm>& forms)
++      override;
++
++  void AddHistoryItems(
++      const std::vector<user_data_importer::ImporterURLRow>& rows,
++      user_data_importer::VisitSource visit_source) override;
++
++  void AddBookmarkTree(
++      const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks,
++      const std::u16string& first_folder_name) override;
++
 +  void SetCookie(
 +      const browseros_importer::ImportedCookieEntry& cookie) override;
++  void SetCookies(const std::vector<browseros_importer::ImportedCookieEntry>&
++                      cookies) override;
 +
    void SetAutofillFormData(
        const std::vector<ImporterAutofillFormDataEntry>& entries) override;
  
 +  void SetExtensions(const std::vector<std::string>& extension_ids) override;
++
++  void NotifyItemMetrics(
++      user_data_importer::ImportItem item,
++      const browseros_importer::ImportItemMetrics& metrics) override;
 +
    void NotifyStarted() override;
    void NotifyItemStarted(user_data_importer::ImportItem item) override;
@@ -2,15 +2,17 @@ diff --git a/chrome/browser/importer/profile_writer.cc b/chrome/browser/importer
 index 6edb974687c07..738d8ca61a9b4 100644
 --- a/chrome/browser/importer/profile_writer.cc
 +++ b/chrome/browser/importer/profile_writer.cc
-@@ -11,6 +11,7 @@
+@@ -11,6 +11,9 @@
++#include <map>
  #include <set>
  #include <string>
++#include <variant>
  
 +#include "base/logging.h"
  #include "base/strings/string_number_conversions.h"
  #include "base/strings/string_util.h"
  #include "base/strings/utf_string_conversions.h"
-@@ -36,7 +37,25 @@
+@@ -36,7 +39,23 @@
  #include "components/prefs/pref_service.h"
  #include "components/search_engines/template_url.h"
  #include "components/search_engines/template_url_service.h"
@@ -18,6 +20,7 @@ index 6edb974687c07..738d8ca61a9b4 100644
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
 +#include "content/public/browser/storage_partition.h"
 +#include "net/cookies/canonical_cookie.h"
++#include "net/cookies/cookie_access_result.h"
 +#include "net/cookies/cookie_inclusion_status.h"
 +#include "net/cookies/cookie_options.h"
 +#include "services/network/public/mojom/cookie_manager.mojom.h"
@@ -29,14 +32,11 @@ index 6edb974687c07..738d8ca61a9b4 100644
 +#include "extensions/browser/extension_registry.h"
 +#include "chrome/browser/extensions/extension_install_prompt.h"
 +#include "chrome/browser/extensions/webstore_install_with_prompt.h"
-+#include "chrome/browser/ui/browser.h"
-+#include "chrome/browser/ui/browser_finder.h"
-+#include "content/public/browser/web_contents.h"
 +#include "base/memory/raw_ptr.h"
  
  using bookmarks::BookmarkModel;
  using bookmarks::BookmarkNode;
-@@ -75,6 +94,22 @@ void ShowBookmarkBar(Profile* profile) {
+@@ -75,6 +94,266 @@ void ShowBookmarkBar(Profile* profile) {
    profile->GetPrefs()->SetBoolean(bookmarks::prefs::kShowBookmarkBar, true);
  }
  
@@ -56,17 +56,84 @@ index 6edb974687c07..738d8ca61a9b4 100644
 +  bool ShouldShowPostInstallUI() const override { return false; }
 +};
 +
- }  // namespace
- 
- ProfileWriter::ProfileWriter(Profile* profile) : profile_(profile) {}
-@@ -99,6 +134,73 @@ void ProfileWriter::AddPasswordForm(
-   }
- }
- 
-+void ProfileWriter::AddCookie(
-+    const browseros_importer::ImportedCookieEntry& cookie) {
-+  DCHECK(profile_);
++// Web Store installs of imported extensions running at once
++constexpr size_t kMaxExtensionInstallsInFlight = 4;
++
++// Installs imported extensions from the Web Store a few at a time instead of
++// starting them all at once. Installs run without a tab: the installer
++// creates its own WebContents for the Web Store lookup. The queue is kept
++// alive by the callbacks of its pending installs.
++class ImportedExtensionInstallQueue
++    : public base::RefCounted<ImportedExtensionInstallQueue> {
++ public:
++  ImportedExtensionInstallQueue(Profile* profile,
++                                std::vector<std::string> extension_ids)
++      : profile_(profile), extension_ids_(std::move(extension_ids)) {}
++
++  ImportedExtensionInstallQueue(const ImportedExtensionInstallQueue&) =
++      delete;
++  ImportedExtensionInstallQueue& operator=(
++      const ImportedExtensionInstallQueue&) = delete;
++
++  void Start() {
++    while (in_flight_ < kMaxExtensionInstallsInFlight && StartNext()) {
++    }
++  }
++
++ private:
++  friend class base::RefCounted<ImportedExtensionInstallQueue>;
++  ~ImportedExtensionInstallQueue() {
++    LOG(INFO) << "ProfileWriter: Extension import finished, " << installed_
++              << " of " << extension_ids_.size() << " installed";
++  }
++
++  bool StartNext() {
++    if (next_ == extension_ids_.size()) {
++      return false;
++    }
++    const std::string& extension_id = extension_ids_[next_++];
++    in_flight_++;
++    // WebstoreInstallWithPrompt keeps itself alive until it has run the
++    // callback
++    base::MakeRefCounted<SilentWebstoreInstaller>(
++        extension_id, profile_.get(),
++        base::BindOnce(&ImportedExtensionInstallQueue::OnInstalled,
++                       base::WrapRefCounted(this), extension_id))
++        ->BeginInstall();
++    LOG(INFO) << "Started installation for extension: " << extension_id;
++    return true;
++  }
++
++  void OnInstalled(const std::string& extension_id,
++                   bool success,
++                   const std::string& error,
++                   extensions::webstore_install::Result result) {
++    in_flight_--;
++    if (success) {
++      installed_++;
++      LOG(INFO) << "Successfully installed extension: " << extension_id;
++    } else {
++      LOG(ERROR) << "Failed to install extension " << extension_id << ": "
++                 << error << " (reason: " << result << ")";
++    }
++    Start();
++  }
++
++  raw_ptr<Profile> profile_;
++  const std::vector<std::string> extension_ids_;
++  size_t next_ = 0;
++  size_t in_flight_ = 0;
++  size_t installed_ = 0;
++};
++
++// Maximum SetCanonicalCookie() calls outstanding during a cookie import
++constexpr size_t kMaxCookieWritesInFlight = 32;
 +
++// Builds the CanonicalCookie for an imported entry and the URL to set it
++// for. Returns nullptr if the entry is not a valid cookie.
++std::unique_ptr<net::CanonicalCookie> CreateImportedCookie(
++    const browseros_importer::ImportedCookieEntry& cookie,
++    GURL* cookie_url) {
 +  // Build the cookie URL from host_key
 +  std::string scheme = cookie.is_secure ? "https" : "http";
 +  std::string host = cookie.host_key;
@@ -74,17 +141,17 @@ index 6edb974687c07..738d8ca61a9b4 100644
 +  if (!host.empty() && host[0] == '.') {
 +    host = host.substr(1);
 +  }
-+  GURL cookie_url(scheme + "://" + host + cookie.path);
++  *cookie_url = GURL(scheme + "://" + host + cookie.path);
 +
-+  if (!cookie_url.is_valid()) {
++  if (!cookie_url->is_valid()) {
 +    LOG(WARNING) << "ProfileWriter: Invalid cookie URL for " << cookie.name;
-+    return;
++    return nullptr;
 +  }
 +
 +  // Create a CanonicalCookie from the imported data
 +  net::CookieInclusionStatus status;
 +  auto canonical_cookie = net::CanonicalCookie::CreateSanitizedCookie(
-+      cookie_url,
++      *cookie_url,
 +      cookie.name,
 +      cookie.value,
 +      cookie.host_key,
@@ -102,10 +169,189 @@ index 6edb974687c07..738d8ca61a9b4 100644
 +  if (!canonical_cookie) {
 +    LOG(WARNING) << "ProfileWriter: Failed to create canonical cookie for "
 +                 << cookie.name << " - status: " << status.GetDebugString();
++  }
++  return canonical_cookie;
++}
++
++// Feeds imported cookies to a CookieManager, keeping at most
++// kMaxCookieWritesInFlight writes outstanding instead of queueing tens of
++// thousands at once. Kept alive by its pending write callbacks.
++class CookieBatchWriter : public base::RefCounted<CookieBatchWriter> {
++ public:
++  explicit CookieBatchWriter(network::mojom::CookieManager* cookie_manager)
++      : cookie_manager_(cookie_manager) {
++    options_.set_include_httponly();
++    options_.set_same_site_cookie_context(
++        net::CookieOptions::SameSiteCookieContext::MakeInclusive());
++  }
++
++  CookieBatchWriter(const CookieBatchWriter&) = delete;
++  CookieBatchWriter& operator=(const CookieBatchWriter&) = delete;
++
++  void Add(std::unique_ptr<net::CanonicalCookie> cookie, GURL url) {
++    cookies_.emplace_back(std::move(cookie), std::move(url));
++  }
++
++  void Start() {
++    while (in_flight_ < kMaxCookieWritesInFlight && SendNext()) {
++    }
++  }
++
++ private:
++  friend class base::RefCounted<CookieBatchWriter>;
++
++  ~CookieBatchWriter() {
++    LOG(INFO) << "ProfileWriter: Imported " << (next_ - failed_) << " of "
++              << cookies_.size() << " cookies";
++  }
++
++  bool SendNext() {
++    if (next_ == cookies_.size()) {
++      return false;
++    }
++    auto& [cookie, url] = cookies_[next_++];
++    in_flight_++;
++    cookie_manager_->SetCanonicalCookie(
++        *cookie, url, options_,
++        base::BindOnce(&CookieBatchWriter::OnCookieSet,
++                       base::WrapRefCounted(this)));
++    // No longer needed once sent
++    cookie.reset();
++    return true;
++  }
++
++  void OnCookieSet(net::CookieAccessResult result) {
++    in_flight_--;
++    if (!result.status.IsInclude()) {
++      failed_++;
++    }
++    SendNext();
++  }
++
++  raw_ptr<network::mojom::CookieManager> cookie_manager_;
++  net::CookieOptions options_;
++  std::vector<std::pair<std::unique_ptr<net::CanonicalCookie>, GURL>>
++      cookies_;
++  size_t next_ = 0;
++  size_t in_flight_ = 0;
++  size_t failed_ = 0;
++};
++
++// Password forms handed to the password store per AddLogins() call
++constexpr size_t kPasswordFormsPerCommit = 500;
++
++// A folder of a bookmark import, laid out before it goes into the model
++struct ImportedBookmarkFolder {
++  struct Url {
++    raw_ptr<const user_data_importer::ImportedBookmarkEntry> entry;
++  };
++  using Child = std::variant<std::unique_ptr<ImportedBookmarkFolder>, Url>;
++
++  ImportedBookmarkFolder() = default;
++  ImportedBookmarkFolder(const std::u16string& title, base::Time creation_time)
++      : title(title), creation_time(creation_time) {}
++
++  ImportedBookmarkFolder* AddFolder(const std::u16string& folder_title,
++                                    base::Time folder_creation_time) {
++    auto folder = std::make_unique<ImportedBookmarkFolder>(
++        folder_title, folder_creation_time);
++    ImportedBookmarkFolder* added = folder.get();
++    children.push_back(std::move(folder));
++    // Paths lead to the first folder of a title, as in AddBookmarks()
++    folders.emplace(folder_title, added);
++    return added;
++  }
++
++  ImportedBookmarkFolder* GetOrAddFolder(const std::u16string& folder_title) {
++    auto it = folders.find(folder_title);
++    return it != folders.end() ? it->second.get()
++                               : AddFolder(folder_title, base::Time());
++  }
++
++  std::u16string title;
++  base::Time creation_time;
++  // In import order
++  std::vector<Child> children;
++  std::map<std::u16string, raw_ptr<ImportedBookmarkFolder>> folders;
++};
++
++// Adds the children of |folder| under |parent|, depth first. Records the
++// model folders that got bookmarks in |folders_added_to|.
++void AddImportedBookmarkChildren(
++    BookmarkModel* model,
++    const ImportedBookmarkFolder& folder,
++    const BookmarkNode* parent,
++    std::set<const BookmarkNode*>* folders_added_to) {
++  for (const auto& child : folder.children) {
++    if (const auto* url = std::get_if<ImportedBookmarkFolder::Url>(&child)) {
++      model->AddURL(parent, parent->children().size(), url->entry->title,
++                    url->entry->url, nullptr, url->entry->creation_time);
++      folders_added_to->insert(parent);
++      continue;
++    }
++    const auto& subfolder =
++        std::get<std::unique_ptr<ImportedBookmarkFolder>>(child);
++    const BookmarkNode* node = model->AddFolder(
++        parent, parent->children().size(), subfolder->title, nullptr,
++        subfolder->creation_time.is_null()
++            ? std::nullopt
++            : std::make_optional(subfolder->creation_time));
++    AddImportedBookmarkChildren(model, *subfolder, node, folders_added_to);
++  }
++}
++
+ }  // namespace
+ 
+ ProfileWriter::ProfileWriter(Profile* profile) : profile_(profile) {}
+@@ -99,6 +378,72 @@ void ProfileWriter::AddPasswordForm(
+   }
+ }
+ 
++void ProfileWriter::AddPasswordForms(
++    const std::vector<password_manager::PasswordForm>& forms) {
++  DCHECK(profile_);
++  if (forms.empty() || !profile_->GetPrefs()->GetBoolean(
++                           password_manager::prefs::kCredentialsEnableService)) {
 +    return;
 +  }
 +
-+  // Get the cookie manager from the default storage partition
++  scoped_refptr<password_manager::PasswordStoreInterface> store =
++      ProfilePasswordStoreFactory::GetForProfile(
++          profile_, ServiceAccessType::EXPLICIT_ACCESS);
++  if (!store) {
++    LOG(WARNING) << "ProfileWriter: Failed to get password store";
++    return;
++  }
++
++  // AddLogins() writes a whole batch in one login database transaction,
++  // where AddLogin() commits each form on its own
++  std::vector<password_manager::PasswordForm> batch;
++  for (const auto& form : forms) {
++    batch.push_back(form);
++    if (batch.size() == kPasswordFormsPerCommit) {
++      store->AddLogins(batch);
++      batch.clear();
++    }
++  }
++  if (!batch.empty()) {
++    store->AddLogins(batch);
++  }
++}
++
++void ProfileWriter::AddCookie(
++    const browseros_importer::ImportedCookieEntry& cookie) {
++  AddCookies({cookie});
++}
++
++void ProfileWriter::AddCookies(
++    const std::vector<browseros_importer::ImportedCookieEntry>& cookies) {
++  DCHECK(profile_);
++  if (cookies.empty()) {
++    return;
++  }
++
++  // Get the cookie manager from the default storage partition, once for the
++  // whole batch
 +  network::mojom::CookieManager* cookie_manager =
 +      profile_->GetDefaultStoragePartition()
 +          ->GetCookieManagerForBrowserProcess();
@@ -115,25 +361,22 @@ index 6edb974687c07..738d8ca61a9b4 100644
 +    return;
 +  }
 +
-+  // Set the cookie with appropriate options
-+  net::CookieOptions options;
-+  options.set_include_httponly();
-+  options.set_same_site_cookie_context(
-+      net::CookieOptions::SameSiteCookieContext::MakeInclusive());
-+
-+  cookie_manager->SetCanonicalCookie(
-+      *canonical_cookie, cookie_url, options,
-+      base::BindOnce([](net::CookieAccessResult result) {
-+        if (!result.status.IsInclude()) {
-+          LOG(WARNING) << "ProfileWriter: Cookie set failed";
-+        }
-+      }));
++  auto writer = base::MakeRefCounted<CookieBatchWriter>(cookie_manager);
++  for (const auto& cookie : cookies) {
++    GURL cookie_url;
++    std::unique_ptr<net::CanonicalCookie> canonical_cookie =
++        CreateImportedCookie(cookie, &cookie_url);
++    if (canonical_cookie) {
++      writer->Add(std::move(canonical_cookie), std::move(cookie_url));
++    }
++  }
++  writer->Start();
 +}
 +
  void ProfileWriter::AddHistoryPage(const history::URLRows& page,
                                     history::VisitSource visit_source) {
    if (!page.empty()) {
-@@ -338,3 +440,119 @@ void ProfileWriter::AddAutocompleteFormDataEntries(
+@@ -338,3 +683,113 @@ void ProfileWriter::AddAutocompleteFormDataEntries(
  }
  
  ProfileWriter::~ProfileWriter() = default;
@@ -165,20 +408,6 @@ index 6edb974687c07..738d8ca61a9b4 100644
 +  extensions::ExtensionRegistry* registry =
 +      extensions::ExtensionRegistry::Get(profile_);
 +
-+  // Find an active WebContents to use (required by WebstoreInstallWithPrompt)
-+  content::WebContents* web_contents = nullptr;
-+
-+  // Try to get a web contents from the active browser
-+  Browser* browser = chrome::FindBrowserWithProfile(profile_);
-+  if (browser && browser->tab_strip_model()) {
-+    web_contents = browser->tab_strip_model()->GetActiveWebContents();
-+  }
-+
-+  if (!web_contents) {
-+    LOG(ERROR) << "Could not find an active WebContents. Extension import aborted.";
-+    return;
-+  }
-+
 +  // Filter out already installed extensions
 +  std::vector<std::string> extensions_to_install;
 +  for (const auto& extension_id : extension_ids) {
@@ -195,61 +424,69 @@ index 6edb974687c07..738d8ca61a9b4 100644
 +    return;
 +  }
 +
-+  // The window/tab could be closed before all extensions are installed
-+  // Keep a reference to it in a new class
-+  class ExtensionInstallHelper : public base::RefCounted<ExtensionInstallHelper> {
-+   public:
-+    ExtensionInstallHelper(Profile* profile, content::WebContents* web_contents)
-+        : profile_(profile), web_contents_(web_contents) {}
-+
-+    void InstallExtension(const std::string& extension_id) {
-+      // Create the callback that handles installation results
-+      auto callback = base::BindOnce(
-+          &ExtensionInstallHelper::OnExtensionInstalled,
-+          // Need to capture this to ensure the object lives until callback is called
-+          base::WrapRefCounted(this),
-+          extension_id);
-+
-+      installer_ = base::MakeRefCounted<SilentWebstoreInstaller>(
-+          extension_id,
-+          profile_,
-+          web_contents_->GetTopLevelNativeWindow(),
-+          std::move(callback));
-+
-+      installer_->BeginInstall();
-+      LOG(INFO) << "Started installation for extension: " << extension_id;
-+    }
++  base::MakeRefCounted<ImportedExtensionInstallQueue>(
++      profile_, std::move(extensions_to_install))
++      ->Start();
++}
 +
-+   private:
-+    friend class base::RefCounted<ExtensionInstallHelper>;
-+
-+    // This callback matches the signature expected by WebstoreInstallWithPrompt
-+    void OnExtensionInstalled(
-+        const std::string& extension_id,
-+        bool success,
-+        const std::string& error,
-+        extensions::webstore_install::Result result) {
-+      if (success) {
-+        LOG(INFO) << "Successfully installed extension: " << extension_id;
-+      } else {
-+        LOG(ERROR) << "Failed to install extension " << extension_id
-+                  << ": " << error << " (reason: " << result << ")";
-+      }
-+      // Clear installer to avoid memory leaks
-+      installer_ = nullptr;
-+    }
++void ProfileWriter::AddBookmarkTree(
++    const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks,
++    const std::u16string& top_level_folder_name) {
++  if (bookmarks.empty())
++    return;
 +
-+    ~ExtensionInstallHelper() = default;
++  BookmarkModel* model = BookmarkModelFactory::GetForBrowserContext(profile_);
++  DCHECK(model->loaded());
 +
-+    raw_ptr<Profile> profile_;
-+    raw_ptr<content::WebContents> web_contents_;
-+    scoped_refptr<SilentWebstoreInstaller> installer_;
-+  };
++  // As in AddBookmarks(), toolbar bookmarks go straight onto an empty
++  // bookmarks bar and everything else into a new top-level folder
++  const BookmarkNode* bookmark_bar = model->bookmark_bar_node();
++  const bool import_to_top_level = bookmark_bar->children().empty();
++
++  // Everything is laid out first, so each entry's path is a few map lookups
++  // instead of a scan of every folder's children in the model
++  ImportedBookmarkFolder bar_folder;
++  ImportedBookmarkFolder top_level_folder;
++  for (const auto& bookmark : bookmarks) {
++    if (!bookmark.is_folder && !bookmark.url.is_valid())
++      continue;
 +
-+  scoped_refptr<ExtensionInstallHelper> helper =
-+      base::MakeRefCounted<ExtensionInstallHelper>(profile_, web_contents);
++    const bool to_bar = import_to_top_level && bookmark.in_toolbar;
++    ImportedBookmarkFolder* folder = to_bar ? &bar_folder : &top_level_folder;
++    auto folder_name = bookmark.path.begin();
++    // The first path element of toolbar bookmarks is the toolbar itself
++    if (to_bar && folder_name != bookmark.path.end())
++      ++folder_name;
++    for (; folder_name != bookmark.path.end(); ++folder_name)
++      folder = folder->GetOrAddFolder(*folder_name);
++
++    if (bookmark.is_folder) {
++      folder->AddFolder(bookmark.title, bookmark.creation_time);
++    } else {
++      folder->children.push_back(ImportedBookmarkFolder::Url{&bookmark});
++    }
++  }
 +
-+  for (const auto& extension_id : extensions_to_install) {
-+    helper->InstallExtension(extension_id);
++  // Observers such as the bookmarks bar, sync and the title index hold
++  // their updates until the extensive change ends
++  std::set<const BookmarkNode*> folders_added_to;
++  model->BeginExtensiveChanges();
++  AddImportedBookmarkChildren(model, bar_folder, bookmark_bar,
++                              &folders_added_to);
++  if (!top_level_folder.children.empty()) {
++    const BookmarkNode* node = model->AddFolder(
++        bookmark_bar, bookmark_bar->children().size(),
++        GenerateUniqueFolderName(model, top_level_folder_name));
++    AddImportedBookmarkChildren(model, top_level_folder, node,
++                                &folders_added_to);
 +  }
++  // Keeps the imported-to folders out of the recently used folders
++  for (const BookmarkNode* folder : folders_added_to)
++    model->ResetDateFolderModified(folder);
++  model->EndExtensiveChanges();
++
++  LOG(INFO) << "ProfileWriter: Added " << bookmarks.size()
++            << " bookmarks in one pass";
++  if (!bar_folder.children.empty())
++    ShowBookmarkBar(profile_);
 +}
@@ -13,21 +13,38 @@ index f609d99dde302..54119399b48f0 100644
  namespace password_manager {
  struct PasswordForm;
  }  // namespace password_manager
-@@ -48,6 +52,8 @@ class ProfileWriter : public base::RefCountedThreadSafe<ProfileWriter> {
+@@ -48,7 +52,18 @@ class ProfileWriter : public base::RefCountedThreadSafe<ProfileWriter> {
    // Helper methods for adding data to local stores.
    virtual void AddPasswordForm(const password_manager::PasswordForm& form);
  
-+  virtual void AddCookie(const browseros_importer::ImportedCookieEntry& cookie);
++  // Adds |forms| to the password store in batches, each committed in one
++  // store transaction.
++  virtual void AddPasswordForms(
++      const std::vector<password_manager::PasswordForm>& forms);
++
+  virtual void AddCookie(const browseros_importer::ImportedCookieEntry& cookie);
++
++  // Adds |cookies| through a single CookieManager, with a bounded number of
++  // writes in flight.
++  virtual void AddCookies(
++      const std::vector<browseros_importer::ImportedCookieEntry>& cookies);
 +
    virtual void AddHistoryPage(const history::URLRows& page,
                                history::VisitSource visit_source);
  
-@@ -92,6 +98,9 @@ class ProfileWriter : public base::RefCountedThreadSafe<ProfileWriter> {
+@@ -92,6 +107,16 @@ class ProfileWriter : public base::RefCountedThreadSafe<ProfileWriter> {
    virtual void AddAutocompleteFormDataEntries(
        const std::vector<autofill::AutocompleteEntry>& autocomplete_entries);
  
 +  // Adds the imported extensions to the profile.
 +  virtual void AddExtensions(const std::vector<std::string>& extension_ids);
++
++  // Adds |bookmarks| the way AddBookmarks() does, but builds the folder tree
++  // in memory first and adds it in one extensive change, with folders found
++  // by title through a map rather than by scanning their children.
++  virtual void AddBookmarkTree(
++      const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks,
++      const std::u16string& top_level_folder_name);
 +
   protected:
    friend class base::RefCountedThreadSafe<ProfileWriter>;
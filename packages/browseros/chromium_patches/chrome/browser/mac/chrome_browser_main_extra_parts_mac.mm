@@ -2,7 +2,7 @@ diff --git a/chrome/browser/mac/chrome_browser_main_extra_parts_mac.mm b/chrome/
 index 6bb5ccb823895..b6bed8c40d57d 100644
 --- a/chrome/browser/mac/chrome_browser_main_extra_parts_mac.mm
 +++ b/chrome/browser/mac/chrome_browser_main_extra_parts_mac.mm
-@@ -4,11 +4,25 @@
+@@ -4,11 +4,31 @@
  
  #include "chrome/browser/mac/chrome_browser_main_extra_parts_mac.h"
  
@@ -28,3 +28,9 @@ index 6bb5ccb823895..b6bed8c40d57d 100644
 +  sparkle_glue::SparkleEnabled();
 +#endif
 +}
++
++void ChromeBrowserMainExtraPartsMac::PostBrowserStart() {
++#if BUILDFLAG(ENABLE_SPARKLE)
++  sparkle_glue::ScheduleUpdateChecks();
++#endif
++}
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/mac/sparkle_glue.h b/chrome/browser/mac/sparkle_glue.h
 new file mode 100644
-index 0000000000000..868ffa7c1bfd0
+index 0000000000000..63ea1b5a46a3c
 --- /dev/null
 +++ b/chrome/browser/mac/sparkle_glue.h
-@@ -0,0 +1,84 @@
+@@ -0,0 +1,89 @@
 +// Copyright 2024 BrowserOS Authors. All rights reserved.
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -85,6 +85,11 @@ index 0000000000000..868ffa7c1bfd0
 +// Triggers installation of downloaded update and relaunches the app.
 +void InstallAndRelaunch();
 +
++// Hands the periodic background checks over to BrowserOSUpdateScheduler,
++// which staggers them with the BrowserOS server's. Call once the browser
++// has started.
++void ScheduleUpdateChecks();
++
 +}  // namespace sparkle_glue
 +
 +#endif  // CHROME_BROWSER_MAC_SPARKLE_GLUE_H_
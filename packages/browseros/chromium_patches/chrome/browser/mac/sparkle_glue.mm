@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/mac/sparkle_glue.mm b/chrome/browser/mac/sparkle_glue.mm
 new file mode 100644
-index 0000000000000..25a2dd2d5a578
+index 0000000000000..aa8b361507683
 --- /dev/null
 +++ b/chrome/browser/mac/sparkle_glue.mm
-@@ -0,0 +1,662 @@
+@@ -0,0 +1,741 @@
 +// Copyright 2024 BrowserOS Authors. All rights reserved.
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -15,12 +15,14 @@ index 0000000000000..25a2dd2d5a578
 +
 +#include "base/apple/bundle_locations.h"
 +#include "base/command_line.h"
++#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/strings/sys_string_conversions.h"
 +#include "base/system/sys_info.h"
 +#include "base/version.h"
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/core/browseros_update_scheduler.h"
 +#include "chrome/browser/upgrade_detector/build_state.h"
 +
 +#import <Sparkle/Sparkle.h>
@@ -113,6 +115,7 @@ index 0000000000000..25a2dd2d5a578
 +- (void)setInternalStatus:(SparkleStatus)status
 +             errorMessage:(nullable NSString*)errorMessage;
 +- (void)notifyProgress:(SparkleProgress*)progress;
++- (void)checkForUpdatesInBackground;
 +@end
 +
 +#pragma mark - BrowserOSUserDriver
@@ -126,6 +129,7 @@ index 0000000000000..25a2dd2d5a578
 +@property(nonatomic) uint64_t receivedBytes;
 +@property(nonatomic, copy, nullable) void (^installReplyBlock)(SPUUserUpdateChoice);
 +@property(nonatomic, copy, nullable) void (^downloadCancellation)(void);
++@property(nonatomic, copy, nullable) void (^deferredDownloadReply)(SPUUserUpdateChoice);
 +@property(nonatomic, copy, nullable) NSString* updateVersion;
 +
 +@end
@@ -137,6 +141,7 @@ index 0000000000000..25a2dd2d5a578
 +@synthesize receivedBytes = _receivedBytes;
 +@synthesize installReplyBlock = _installReplyBlock;
 +@synthesize downloadCancellation = _downloadCancellation;
++@synthesize deferredDownloadReply = _deferredDownloadReply;
 +@synthesize updateVersion = _updateVersion;
 +
 +#pragma mark - SPUUserDriver Required Methods
@@ -172,16 +177,26 @@ index 0000000000000..25a2dd2d5a578
 +
 +  switch (state.stage) {
 +    case SPUUserUpdateStageNotDownloaded:
-+      // Start downloading the update.
-+      reply(SPUUserUpdateChoiceInstall);
-+      break;
-+
-+    case SPUUserUpdateStageDownloaded:
-+      // Update already downloaded, ready to install.
-+      self.installReplyBlock = reply;
-+      [self.glue setInternalStatus:SparkleStatusReadyToInstall];
-+      NotifyUpgradeReady(base::SysNSStringToUTF8(self.updateVersion));
++    case SPUUserUpdateStageDownloaded: {
++      // Downloaded updates are only extracted and staged once installing is
++      // chosen. Choose it now rather than at relaunch, so the bundle is
++      // unpacked and validated in the background and relaunching only swaps
++      // it in. showReadyToInstallAndRelaunch reports when that is done.
++      if (state.userInitiated) {
++        reply(SPUUserUpdateChoiceInstall);
++        break;
++      }
++      // Background checks download and stage once the machine is idle and
++      // on AC.
++      self.deferredDownloadReply = reply;
++      __weak BrowserOSUserDriver* weakSelf = self;
++      browseros::BrowserOSUpdateScheduler::GetInstance()->RunWhenIdle(
++          browseros::BrowserOSUpdateScheduler::Client::kBrowser,
++          base::BindOnce(^{
++            [weakSelf startDeferredDownload];
++          }));
 +      break;
++    }
 +
 +    case SPUUserUpdateStageInstalling:
 +      // Already installing - store reply block and notify user, don't auto-proceed
@@ -285,11 +300,22 @@ index 0000000000000..25a2dd2d5a578
 +  VLOG(1) << "Sparkle: Update installation dismissed";
 +  self.installReplyBlock = nil;
 +  self.downloadCancellation = nil;
++  self.deferredDownloadReply = nil;
 +  [self.glue setInternalStatus:SparkleStatusIdle];
 +}
 +
 +#pragma mark - Internal
 +
++- (void)startDeferredDownload {
++  if (!self.deferredDownloadReply) {
++    return;  // Dismissed while waiting.
++  }
++  VLOG(1) << "Sparkle: Starting deferred download and staging";
++  void (^reply)(SPUUserUpdateChoice) = self.deferredDownloadReply;
++  self.deferredDownloadReply = nil;
++  reply(SPUUserUpdateChoiceInstall);
++}
++
 +- (void)triggerInstall {
 +  if (self.installReplyBlock) {
 +    VLOG(1) << "Sparkle: Triggering install";
@@ -388,6 +414,12 @@ index 0000000000000..25a2dd2d5a578
 +    return NO;
 +  }
 +
++  // Background checks and downloads are driven by BrowserOSUpdateScheduler
++  // (see sparkle_glue::ScheduleUpdateChecks), so that they don't land
++  // during startup or next to the server updater's.
++  _updater.automaticallyChecksForUpdates = NO;
++  _updater.automaticallyDownloadsUpdates = NO;
++
 +  // Log auto-update configuration for validation.
 +  VLOG(1) << "Sparkle: Updater initialized successfully";
 +  VLOG(1) << "Sparkle: automaticallyChecksForUpdates="
@@ -465,6 +497,22 @@ index 0000000000000..25a2dd2d5a578
 +  [_updater checkForUpdates];
 +}
 +
++- (void)checkForUpdatesInBackground {
++#if !defined(OFFICIAL_BUILD)
++  if (_dryRunMode) {
++    return;
++  }
++#endif
++
++  if (!_updater.canCheckForUpdates) {
++    VLOG(1) << "Sparkle: Cannot check for updates right now";
++    return;
++  }
++
++  VLOG(1) << "Sparkle: Checking for updates in background";
++  [_updater checkForUpdatesInBackground];
++}
++
 +- (void)installAndRelaunch {
 +  if (_status != SparkleStatusReadyToInstall) {
 +    LOG(WARNING) << "Sparkle: installAndRelaunch called but not ready";
@@ -554,6 +602,21 @@ index 0000000000000..25a2dd2d5a578
 +          << base::SysNSStringToUTF8(item.displayVersionString);
 +}
 +
++- (void)updater:(SPUUpdater*)updater didDownloadUpdate:(SUAppcastItem*)item {
++  VLOG(1) << "Sparkle: Downloaded "
++          << (item.isDeltaUpdate ? "delta" : "full") << " update "
++          << base::SysNSStringToUTF8(item.displayVersionString);
++}
++
++- (void)updater:(SPUUpdater*)updater
++    failedToDownloadUpdate:(SUAppcastItem*)item
++                     error:(NSError*)error {
++  // Sparkle retries a failed delta with the full update by itself.
++  LOG(WARNING) << "Sparkle: Failed to download "
++               << (item.isDeltaUpdate ? "delta" : "full") << " update: "
++               << base::SysNSStringToUTF8(error.localizedDescription);
++}
++
 +- (void)updaterDidNotFindUpdate:(SPUUpdater*)updater
 +                          error:(NSError*)error {
 +  // Already handled by user driver's showUpdateNotFoundWithError.
@@ -665,4 +728,20 @@ index 0000000000000..25a2dd2d5a578
 +  [[SparkleGlue sharedSparkleGlue] installAndRelaunch];
 +}
 +
++void ScheduleUpdateChecks() {
++  SparkleGlue* glue = [SparkleGlue sharedSparkleGlue];
++  if (!glue) {
++    return;
++  }
++
++  // Keep the check interval configured through SUScheduledCheckInterval.
++  __weak SparkleGlue* weak_glue = glue;
++  browseros::BrowserOSUpdateScheduler::GetInstance()->RegisterClient(
++      browseros::BrowserOSUpdateScheduler::Client::kBrowser,
++      base::Seconds(glue.updater.updateCheckInterval),
++      base::BindRepeating(^{
++        [weak_glue checkForUpdatesInBackground];
++      }));
++}
++
 +}  // namespace sparkle_glue
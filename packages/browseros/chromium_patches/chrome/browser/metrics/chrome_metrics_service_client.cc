@@ -2,19 +2,23 @@ diff --git a/chrome/browser/metrics/chrome_metrics_service_client.cc b/chrome/br
 index cc273dc75b378..601c0223c8965 100644
 --- a/chrome/browser/metrics/chrome_metrics_service_client.cc
 +++ b/chrome/browser/metrics/chrome_metrics_service_client.cc
-@@ -76,6 +76,7 @@
+@@ -76,6 +76,8 @@
  #include "components/component_updater/component_updater_service.h"
  #include "components/crash/core/common/crash_keys.h"
  #include "components/history/core/browser/history_service.h"
-+#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/browseros/metrics/browseros_daily_usage.h"
++#include "chrome/browser/metrics/tab_stats/tab_stats_tracker.h"
  #include "components/metrics/call_stacks/call_stack_profile_metrics_provider.h"
  #include "components/metrics/component_metrics_provider.h"
  #include "components/metrics/content/content_stability_metrics_provider.h"
-@@ -1074,6 +1075,7 @@ void ChromeMetricsServiceClient::RegisterUKMProviders() {
+@@ -1074,6 +1076,10 @@ void ChromeMetricsServiceClient::RegisterUKMProviders() {
  }
  
  void ChromeMetricsServiceClient::NotifyApplicationNotIdle() {
-+  browseros_metrics::BrowserOSMetrics::Log("alive", 0.01);
++  // Counted in memory; summed up in BrowserOS's daily usage report
++  metrics::TabStatsTracker* tab_stats = metrics::TabStatsTracker::GetInstance();
++  browseros_metrics::BrowserOSDailyUsage::GetInstance()->RecordUserActivity(
++      tab_stats ? tab_stats->tab_stats().total_tab_count : 0);
    metrics_service_->OnApplicationNotIdle();
  }
  
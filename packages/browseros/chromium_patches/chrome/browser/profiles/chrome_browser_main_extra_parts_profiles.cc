@@ -2,19 +2,33 @@ diff --git a/chrome/browser/profiles/chrome_browser_main_extra_parts_profiles.cc
 index fdb211c4c8ae2..ccd0f1b891a3e 100644
 --- a/chrome/browser/profiles/chrome_browser_main_extra_parts_profiles.cc
 +++ b/chrome/browser/profiles/chrome_browser_main_extra_parts_profiles.cc
-@@ -52,6 +52,7 @@
+@@ -52,6 +52,14 @@
  #include "chrome/browser/collaboration/messaging/messaging_backend_service_factory.h"
  #include "chrome/browser/commerce/shopping_service_factory.h"
  #include "chrome/browser/consent_auditor/consent_auditor_factory.h"
++#include "chrome/browser/browseros/extensions/browseros_direct_dispatcher_factory.h"
++#include "chrome/browser/browseros/extensions/browseros_worker_keepalive_factory.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service_factory.h"
++#if BUILDFLAG(ENABLE_EXTENSIONS)
++#include "chrome/browser/extensions/api/browser_os/browser_os_node_mapping_store.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_prefs.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_prune_rules.h"
++#endif
  #include "chrome/browser/content_index/content_index_provider_factory.h"
  #include "chrome/browser/content_settings/cookie_settings_factory.h"
  #include "chrome/browser/content_settings/host_content_settings_map_factory.h"
-@@ -755,6 +756,7 @@ void ChromeBrowserMainExtraPartsProfiles::
+@@ -755,6 +763,14 @@ void ChromeBrowserMainExtraPartsProfiles::
  #endif
    BitmapFetcherServiceFactory::GetInstance();
    BluetoothChooserContextFactory::GetInstance();
 +  browseros_metrics::BrowserOSMetricsServiceFactory::GetInstance();
++#if BUILDFLAG(ENABLE_EXTENSIONS)
++  browseros::BrowserOSDirectDispatcherFactory::GetInstance();
++  browseros::BrowserOSWorkerKeepaliveFactory::GetInstance();
++  extensions::api::BrowserOSNodeMappingStore::GetFactoryInstance();
++  extensions::api::BrowserOSPrefsAPI::GetFactoryInstance();
++  extensions::api::BrowserOSPruneRules::GetFactoryInstance();
++#endif
  #if defined(TOOLKIT_VIEWS)
    BookmarkExpandedStateTrackerFactory::GetInstance();
    BookmarkMergedSurfaceServiceFactory::GetInstance();
@@ -2,16 +2,19 @@ diff --git a/chrome/browser/ui/toolbar/pinned_toolbar/pinned_toolbar_actions_mod
 index d9315fa4fa5b0..fbf550745d2a6 100644
 --- a/chrome/browser/ui/toolbar/pinned_toolbar/pinned_toolbar_actions_model.cc
 +++ b/chrome/browser/ui/toolbar/pinned_toolbar/pinned_toolbar_actions_model.cc
-@@ -16,6 +16,8 @@
+@@ -16,6 +16,11 @@
++#include "base/containers/contains.h"
  #include "base/observer_list.h"
  #include "base/strings/strcat.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/time/time.h"
  #include "base/values.h"
 +#include "chrome/browser/browseros/core/browseros_action_utils.h"
 +#include "chrome/browser/browseros/core/browseros_prefs.h"
  #include "chrome/browser/profiles/profile.h"
  #include "chrome/browser/ui/actions/chrome_action_id.h"
  #include "chrome/browser/ui/toolbar/pinned_toolbar/pinned_toolbar_actions_model_factory.h"
-@@ -37,6 +39,23 @@ PinnedToolbarActionsModel::PinnedToolbarActionsModel(Profile* profile)
+@@ -37,6 +42,23 @@ PinnedToolbarActionsModel::PinnedToolbarActionsModel(Profile* profile)
        base::BindRepeating(&PinnedToolbarActionsModel::UpdatePinnedActionIds,
                            base::Unretained(this)));
  
@@ -35,7 +38,7 @@ index d9315fa4fa5b0..fbf550745d2a6 100644
    // Initialize the model with the current state of the kPinnedActions pref.
    UpdatePinnedActionIds();
  }
-@@ -236,8 +255,11 @@ void PinnedToolbarActionsModel::MaybeMigrateExistingPinnedStates() {
+@@ -236,8 +258,11 @@ void PinnedToolbarActionsModel::MaybeMigrateExistingPinnedStates() {
    if (!CanUpdate()) {
      return;
    }
@@ -48,7 +51,7 @@ index d9315fa4fa5b0..fbf550745d2a6 100644
      pref_service_->SetBoolean(prefs::kPinnedChromeLabsMigrationComplete, true);
    }
    if (features::HasTabSearchToolbarButton() &&
-@@ -253,6 +275,36 @@ void PinnedToolbarActionsModel::MaybeMigrateExistingPinnedStates() {
+@@ -253,6 +278,40 @@ void PinnedToolbarActionsModel::MaybeMigrateExistingPinnedStates() {
    }
  }
  
@@ -61,6 +64,8 @@ index d9315fa4fa5b0..fbf550745d2a6 100644
 +  // Pin native BrowserOS actions if:
 +  // 1. Their feature flag is enabled (or no feature flag exists)
 +  // 2. Their visibility pref allows it
++  // All changes go into one pref write, so each window relayouts once.
++  std::vector<actions::ActionId> updated_list = pinned_action_ids_;
 +  for (actions::ActionId id : browseros::kBrowserOSNativeActionIds) {
 +    const base::Feature* feature = browseros::GetFeatureForBrowserOSAction(id);
 +    bool feature_enabled = !feature || base::FeatureList::IsEnabled(*feature);
@@ -68,41 +73,74 @@ index d9315fa4fa5b0..fbf550745d2a6 100644
 +
 +    if (feature_enabled && pref_enabled) {
 +      // Should be pinned - add if not already present
-+      if (!Contains(id)) {
-+        UpdatePinnedState(id, true);
++      if (!base::Contains(updated_list, id)) {
++        updated_list.push_back(id);
 +      }
 +    } else {
 +      // Should not be pinned - remove if currently pinned
-+      if (Contains(id)) {
-+        UpdatePinnedState(id, false);
-+      }
++      std::erase(updated_list, id);
 +    }
 +  }
 +
++  if (updated_list != pinned_action_ids_) {
++    UpdatePref(updated_list);
++  }
++
 +  // Note: Extension pinning is handled by ExtensionSidePanelManager
 +}
 +
  const std::vector<actions::ActionId>&
  PinnedToolbarActionsModel::PinnedActionIds() const {
    return pinned_action_ids_;
-@@ -271,3 +323,20 @@ void PinnedToolbarActionsModel::UpdatePref(
+@@ -271,3 +330,51 @@ void PinnedToolbarActionsModel::UpdatePref(
      list_of_values.Append(id_string.value());
    }
  }
 +
 +void PinnedToolbarActionsModel::OnBrowserOSVisibilityPrefChanged() {
-+  // Re-evaluate which BrowserOS actions should be pinned.
-+  EnsureAlwaysPinnedActions();
++  browseros_visibility_changed_ = true;
++  ScheduleBrowserOSPrefChanges();
++}
++
++void PinnedToolbarActionsModel::OnBrowserOSLabelsPrefChanged() {
++  browseros_labels_changed_ = true;
++  ScheduleBrowserOSPrefChanges();
++}
++
++void PinnedToolbarActionsModel::ScheduleBrowserOSPrefChanges() {
++  // About one frame, enough to take in a batch of pref writes
++  constexpr base::TimeDelta kCoalesceDelay = base::Milliseconds(16);
 +
-+  // Notify observers that actions may have changed.
-+  for (Observer& observer : observers_) {
-+    observer.OnActionsChanged();
++  if (browseros_weak_factory_.HasWeakPtrs()) {
++    return;
 +  }
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(
++          &PinnedToolbarActionsModel::ApplyPendingBrowserOSPrefChanges,
++          browseros_weak_factory_.GetWeakPtr()),
++      kCoalesceDelay);
 +}
 +
-+void PinnedToolbarActionsModel::OnBrowserOSLabelsPrefChanged() {
-+  // Notify observers so buttons can refresh their labels.
-+  for (Observer& observer : observers_) {
-+    observer.OnLabelsVisibilityChanged();
++void PinnedToolbarActionsModel::ApplyPendingBrowserOSPrefChanges() {
++  browseros_weak_factory_.InvalidateWeakPtrs();
++
++  if (std::exchange(browseros_visibility_changed_, false)) {
++    // Re-evaluate which BrowserOS actions should be pinned. A changed pin
++    // set notifies observers through the kPinnedActions pref already.
++    const std::vector<actions::ActionId> previous_ids = pinned_action_ids_;
++    EnsureAlwaysPinnedActions();
++    if (pinned_action_ids_ == previous_ids) {
++      for (Observer& observer : observers_) {
++        observer.OnActionsChanged();
++      }
++    }
++  }
++
++  if (std::exchange(browseros_labels_changed_, false)) {
++    // Notify observers so buttons can refresh their labels.
++    for (Observer& observer : observers_) {
++      observer.OnLabelsVisibilityChanged();
++    }
 +  }
 +}
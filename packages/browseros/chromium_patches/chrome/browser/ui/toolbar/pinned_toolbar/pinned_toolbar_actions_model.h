@@ -12,19 +12,20 @@ index 9f7cbd0272c0a..a47f90c1ae192 100644
     protected:
      virtual ~Observer() = default;
    };
-@@ -96,6 +99,11 @@ class PinnedToolbarActionsModel : public KeyedService {
+@@ -96,6 +99,12 @@ class PinnedToolbarActionsModel : public KeyedService {
    // Search migrations are complete.
    void MaybeMigrateExistingPinnedStates();
  
 +  // Ensures that certain actions are always pinned to the toolbar.
 +  // This is called during initialization to ensure specific actions
-+  // (like Third Party LLM and Clash of GPTs) are always visible.
++  // (like Third Party LLM and Clash of GPTs) are always visible. All
++  // changes are written in a single kPinnedActions update.
 +  void EnsureAlwaysPinnedActions();
 +
    // Returns the ordered list of pinned ActionIds.
    virtual const std::vector<actions::ActionId>& PinnedActionIds() const;
  
-@@ -114,6 +122,14 @@ class PinnedToolbarActionsModel : public KeyedService {
+@@ -114,6 +123,25 @@ class PinnedToolbarActionsModel : public KeyedService {
  
    void UpdatePref(const std::vector<actions::ActionId>& updated_list);
  
@@ -35,6 +36,17 @@ index 9f7cbd0272c0a..a47f90c1ae192 100644
 +  // Called when the toolbar labels pref changes.
 +  // Notifies observers so buttons can refresh their labels.
 +  void OnBrowserOSLabelsPrefChanged();
++
++  // BrowserOS pref changes are applied about a frame later, so a batch of
++  // pref writes (e.g. a settings import) rebuilds each toolbar only once.
++  void ScheduleBrowserOSPrefChanges();
++  void ApplyPendingBrowserOSPrefChanges();
++
++  bool browseros_visibility_changed_ = false;
++  bool browseros_labels_changed_ = false;
++  // Only vends the pending ApplyPendingBrowserOSPrefChanges() task
++  base::WeakPtrFactory<PinnedToolbarActionsModel> browseros_weak_factory_{
++      this};
 +
    // Our observers.
    base::ObserverList<Observer>::Unchecked observers_;
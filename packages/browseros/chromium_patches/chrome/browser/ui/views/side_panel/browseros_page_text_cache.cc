@@ -0,0 +1,407 @@
+diff --git a/chrome/browser/ui/views/side_panel/browseros_page_text_cache.cc b/chrome/browser/ui/views/side_panel/browseros_page_text_cache.cc
+new file mode 100644
+index 0000000000000..9c1384a4c55e4
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/browseros_page_text_cache.cc
+@@ -0,0 +1,401 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/ui/views/side_panel/browseros_page_text_cache.h"
++
++#include <algorithm>
++#include <utility>
++#include <vector>
++
++#include "base/containers/span.h"
++#include "base/files/file_enumerator.h"
++#include "base/files/file_util.h"
++#include "base/files/important_file_writer.h"
++#include "base/functional/bind.h"
++#include "base/hash/hash.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/strcat.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/stringprintf.h"
++#include "base/strings/utf_string_conversions.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "chrome/browser/browseros/core/browseros_prefs.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/prefs/pref_service.h"
++#include "content/public/browser/browser_thread.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_mode.h"
++#include "ui/accessibility/ax_node_data.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace side_panel {
++
++namespace {
++
++constexpr char kDiskKeyKey[] = "key";
++constexpr char kDiskTextKey[] = "text";
++
++uint64_t NextDocumentVersion() {
++  static uint64_t next_version = 1;
++  return next_version++;
++}
++
++// Bumps a tab's document version whenever its page may have changed.
++// Versions are unique across tabs, so one names a single page state.
++class DocumentVersion
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<DocumentVersion> {
++ public:
++  DocumentVersion(const DocumentVersion&) = delete;
++  DocumentVersion& operator=(const DocumentVersion&) = delete;
++  ~DocumentVersion() override = default;
++
++  uint64_t version() const { return version_; }
++
++ private:
++  friend class content::WebContentsUserData<DocumentVersion>;
++
++  explicit DocumentVersion(content::WebContents* web_contents)
++      : content::WebContentsObserver(web_contents),
++        content::WebContentsUserData<DocumentVersion>(*web_contents) {}
++
++  void Bump() { version_ = NextDocumentVersion(); }
++
++  // content::WebContentsObserver:
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override {
++    // Same-document ones too: that is how single-page apps change pages
++    if (navigation_handle->HasCommitted()) {
++      Bump();
++    }
++  }
++  void DidFinishLoad(content::RenderFrameHost* render_frame_host,
++                     const GURL& validated_url) override {
++    Bump();
++  }
++  void TitleWasSet(content::NavigationEntry* entry) override { Bump(); }
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override {
++    if (!details.updates.empty() || !details.events.empty()) {
++      Bump();
++    }
++  }
++
++  uint64_t version_ = NextDocumentVersion();
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(DocumentVersion);
++
++bool SameBudget(const BrowserOSSimplePageExtractor::Budget& a,
++                const BrowserOSSimplePageExtractor::Budget& b) {
++  return a.max_chars == b.max_chars && a.max_tokens == b.max_tokens;
++}
++
++bool SameKey(const BrowserOSPageTextCache::Key& a,
++             const BrowserOSPageTextCache::Key& b) {
++  return a.url == b.url && a.content_hash == b.content_hash &&
++         SameBudget(a.budget, b.budget);
++}
++
++// Spells |key| out, stored in its file so a file name collision reads as a
++// miss
++std::string GetDiskKey(const BrowserOSPageTextCache::Key& key) {
++  return base::StrCat({key.url.spec(), "\n",
++                       base::NumberToString(key.content_hash), "\n",
++                       base::NumberToString(key.budget.max_chars), "\n",
++                       base::NumberToString(key.budget.max_tokens)});
++}
++
++base::FilePath GetDiskPath(const base::FilePath& disk_dir,
++                           const std::string& disk_key) {
++  return disk_dir.AppendASCII(
++      base::StringPrintf("%08x.json", base::PersistentHash(disk_key)));
++}
++
++// Disk task runner only, like the two below
++std::optional<std::u16string> ReadFromDisk(const base::FilePath& disk_dir,
++                                           const std::string& disk_key) {
++  const base::FilePath path = GetDiskPath(disk_dir, disk_key);
++  base::File::Info info;
++  if (!base::GetFileInfo(path, &info)) {
++    return std::nullopt;
++  }
++  const base::Time now = base::Time::Now();
++  if (now - info.last_modified > kMaxDiskPageTextAge) {
++    base::DeleteFile(path);
++    return std::nullopt;
++  }
++
++  std::string contents;
++  // A character escaped as \uXXXX takes 6 bytes, the most it can
++  const size_t max_size = (kMaxDiskPageTextChars + disk_key.size()) * 6 + 64;
++  if (!base::ReadFileToStringWithMaxSize(path, &contents, max_size)) {
++    return std::nullopt;
++  }
++  std::optional<base::Value::Dict> dict = base::JSONReader::ReadDict(contents);
++  if (!dict) {
++    return std::nullopt;
++  }
++  const std::string* stored_key = dict->FindString(kDiskKeyKey);
++  const std::string* text = dict->FindString(kDiskTextKey);
++  if (!stored_key || *stored_key != disk_key || !text) {
++    return std::nullopt;
++  }
++  // Recently used files are the last to go
++  base::TouchFile(path, now, now);
++  return base::UTF8ToUTF16(*text);
++}
++
++// Deletes expired files, then the least recently used beyond
++// kMaxDiskPageTexts
++void PruneDisk(const base::FilePath& disk_dir) {
++  std::vector<std::pair<base::Time, base::FilePath>> files;
++  base::FileEnumerator enumerator(disk_dir, /*recursive=*/false,
++                                  base::FileEnumerator::FILES,
++                                  FILE_PATH_LITERAL("*.json"));
++  const base::Time now = base::Time::Now();
++  for (base::FilePath path = enumerator.Next(); !path.empty();
++       path = enumerator.Next()) {
++    const base::Time modified = enumerator.GetInfo().GetLastModifiedTime();
++    if (now - modified > kMaxDiskPageTextAge) {
++      base::DeleteFile(path);
++    } else {
++      files.emplace_back(modified, std::move(path));
++    }
++  }
++  if (files.size() <= kMaxDiskPageTexts) {
++    return;
++  }
++  std::sort(files.begin(), files.end(),
++            [](const auto& a, const auto& b) { return a.first > b.first; });
++  for (size_t i = kMaxDiskPageTexts; i < files.size(); ++i) {
++    base::DeleteFile(files[i].second);
++  }
++}
++
++void WriteToDisk(const base::FilePath& disk_dir,
++                 const std::string& disk_key,
++                 const std::string& text) {
++  if (!base::CreateDirectory(disk_dir)) {
++    LOG(WARNING) << "[browseros] Failed to create page text cache directory";
++    return;
++  }
++  std::optional<std::string> contents = base::WriteJson(
++      base::Value::Dict().Set(kDiskKeyKey, disk_key).Set(kDiskTextKey, text));
++  if (!contents || !base::ImportantFileWriter::WriteFileAtomically(
++                       GetDiskPath(disk_dir, disk_key), *contents)) {
++    LOG(WARNING) << "[browseros] Failed to write cached page text";
++    return;
++  }
++  PruneDisk(disk_dir);
++}
++
++}  // namespace
++
++BrowserOSPageTextCache::Entry::Entry() = default;
++BrowserOSPageTextCache::Entry::Entry(Entry&&) = default;
++BrowserOSPageTextCache::Entry& BrowserOSPageTextCache::Entry::operator=(
++    Entry&&) = default;
++BrowserOSPageTextCache::Entry::~Entry() = default;
++
++// static
++BrowserOSPageTextCache* BrowserOSPageTextCache::Get() {
++  static base::NoDestructor<BrowserOSPageTextCache> instance;
++  return instance.get();
++}
++
++BrowserOSPageTextCache::BrowserOSPageTextCache()
++    : disk_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
++           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {
++  // Unretained: the cache is never destroyed
++  memory_pressure_registration_ = browseros::AddMemoryPressureHandler(
++      "page_text_cache",
++      base::BindRepeating(&BrowserOSPageTextCache::OnMemoryPressure,
++                          base::Unretained(this)));
++  profiler_registration_ = browseros::AddStepProfilerSource(
++      "page_text_cache",
++      base::BindRepeating(&BrowserOSPageTextCache::ReportStepProfile,
++                          base::Unretained(this)));
++}
++
++BrowserOSPageTextCache::~BrowserOSPageTextCache() = default;
++
++// static
++BrowserOSPageTextCache::Document BrowserOSPageTextCache::GetDocument(
++    content::WebContents* web_contents) {
++  DocumentVersion::CreateForWebContents(web_contents);
++  GURL::Replacements clear_ref;
++  clear_ref.ClearRef();
++  return Document{
++      web_contents->GetLastCommittedURL().ReplaceComponents(clear_ref),
++      DocumentVersion::FromWebContents(web_contents)->version(),
++      web_contents->GetAccessibilityMode().has_mode(ui::AXMode::kWebContents)};
++}
++
++// static
++base::FilePath BrowserOSPageTextCache::GetDiskDir(
++    content::WebContents* web_contents) {
++  Profile* profile =
++      Profile::FromBrowserContext(web_contents->GetBrowserContext());
++  if (profile->IsOffTheRecord() ||
++      !profile->GetPrefs()->GetBoolean(browseros::prefs::kPageTextDiskCache)) {
++    return base::FilePath();
++  }
++  return profile->GetPath().AppendASCII(kPageTextCacheDirName);
++}
++
++// static
++uint32_t BrowserOSPageTextCache::HashSnapshot(const ui::AXTreeUpdate& update) {
++  std::vector<uint32_t> node_hashes;
++  node_hashes.reserve(update.nodes.size());
++  std::string key;
++  for (const ui::AXNodeData& node : update.nodes) {
++    key = base::StringPrintf(
++        "%d|%d|%d|%d|", node.id, static_cast<int>(node.role),
++        node.IsInvisibleOrIgnored(),
++        node.GetIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel));
++    for (int32_t child_id : node.child_ids) {
++      base::StringAppendF(&key, "%d,", child_id);
++    }
++    // NUL separated so that moving text between them changes the hash
++    key.push_back('\0');
++    key += node.GetStringAttribute(ax::mojom::StringAttribute::kName);
++    key.push_back('\0');
++    key += node.GetStringAttribute(ax::mojom::StringAttribute::kValue);
++    node_hashes.push_back(base::PersistentHash(key));
++  }
++  return base::PersistentHash(base::as_byte_span(node_hashes));
++}
++
++std::optional<std::u16string> BrowserOSPageTextCache::FindUnchanged(
++    const Document& document,
++    const BrowserOSSimplePageExtractor::Budget& budget) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  const base::TimeTicks now = base::TimeTicks::Now();
++  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
++    if (it->document_version != document.version ||
++        it->key.url != document.url || !SameBudget(it->key.budget, budget)) {
++      continue;
++    }
++    if (!it->observed && now - it->extracted > kMaxUnobservedPageTextAge) {
++      return std::nullopt;
++    }
++    entries_.splice(entries_.begin(), entries_, it);
++    unchanged_hits_++;
++    VLOG(1) << "[browseros] Page text cache hit, page unchanged";
++    return entries_.front().text;
++  }
++  return std::nullopt;
++}
++
++std::optional<std::u16string> BrowserOSPageTextCache::Find(const Key& key) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
++    if (SameKey(it->key, key)) {
++      entries_.splice(entries_.begin(), entries_, it);
++      content_hits_++;
++      VLOG(1) << "[browseros] Page text cache hit, same snapshot";
++      return entries_.front().text;
++    }
++  }
++  return std::nullopt;
++}
++
++void BrowserOSPageTextCache::FindOnDisk(
++    const base::FilePath& disk_dir,
++    const Key& key,
++    base::OnceCallback<void(std::optional<std::u16string>)> callback) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  disk_task_runner_->PostTaskAndReplyWithResult(
++      FROM_HERE, base::BindOnce(&ReadFromDisk, disk_dir, GetDiskKey(key)),
++      base::BindOnce(
++          [](BrowserOSPageTextCache* cache,
++             base::OnceCallback<void(std::optional<std::u16string>)> callback,
++             std::optional<std::u16string> text) {
++            if (text) {
++              cache->disk_hits_++;
++              VLOG(1) << "[browseros] Page text cache hit on disk";
++            }
++            std::move(callback).Run(std::move(text));
++          },
++          // Unretained: the cache is never destroyed
++          base::Unretained(this), std::move(callback)));
++}
++
++void BrowserOSPageTextCache::Put(const Key& key,
++                                 const Document& document,
++                                 const std::u16string& text,
++                                 const base::FilePath& disk_dir) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  DCHECK_EQ(key.url, document.url);
++  stored_++;
++  if (!disk_dir.empty() && text.size() <= kMaxDiskPageTextChars) {
++    disk_task_runner_->PostTask(
++        FROM_HERE, base::BindOnce(&WriteToDisk, disk_dir, GetDiskKey(key),
++                                  base::UTF16ToUTF8(text)));
++  }
++  if (text.size() > kMaxCachedPageTextChars) {
++    return;
++  }
++
++  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
++    if (SameKey(it->key, key)) {
++      cached_chars_ -= it->text.size();
++      entries_.erase(it);
++      break;
++    }
++  }
++  Entry& entry = entries_.emplace_front();
++  entry.key = key;
++  entry.document_version = document.version;
++  entry.observed = document.observed;
++  entry.extracted = base::TimeTicks::Now();
++  entry.text = text;
++  cached_chars_ += text.size();
++  Trim();
++}
++
++void BrowserOSPageTextCache::Trim() {
++  while (entries_.size() > kMaxCachedPageTexts ||
++         cached_chars_ > kMaxCachedPageTextChars) {
++    cached_chars_ -= entries_.back().text.size();
++    entries_.pop_back();
++  }
++}
++
++void BrowserOSPageTextCache::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level,
++    base::OnceCallback<void(browseros::ReleasedMemory)> done) {
++  browseros::ReleasedMemory released;
++  released.items = entries_.size();
++  released.bytes = cached_chars_ * sizeof(char16_t);
++  entries_.clear();
++  cached_chars_ = 0;
++  std::move(done).Run(released);
++}
++
++void BrowserOSPageTextCache::ReportStepProfile(
++    base::OnceCallback<void(base::Value::Dict)> done) {
++  std::move(done).Run(
++      base::Value::Dict()
++          .Set("cachedTexts", static_cast<int>(entries_.size()))
++          .Set("cachedChars", static_cast<int>(cached_chars_))
++          .Set("unchangedHits", static_cast<int>(unchanged_hits_))
++          .Set("contentHits", static_cast<int>(content_hits_))
++          .Set("diskHits", static_cast<int>(disk_hits_))
++          .Set("stored", static_cast<int>(stored_)));
++}
++
++}  // namespace side_panel
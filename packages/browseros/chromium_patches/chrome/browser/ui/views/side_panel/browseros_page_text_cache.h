@@ -0,0 +1,178 @@
+diff --git a/chrome/browser/ui/views/side_panel/browseros_page_text_cache.h b/chrome/browser/ui/views/side_panel/browseros_page_text_cache.h
+new file mode 100644
+index 0000000000000..f75638749ad09
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/browseros_page_text_cache.h
+@@ -0,0 +1,172 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PAGE_TEXT_CACHE_H_
++#define CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PAGE_TEXT_CACHE_H_
++
++#include <cstddef>
++#include <cstdint>
++#include <list>
++#include <optional>
++#include <string>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/functional/callback_helpers.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/no_destructor.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h"
++#include "url/gurl.h"
++
++namespace base {
++class SequencedTaskRunner;
++}  // namespace base
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace ui {
++struct AXTreeUpdate;
++}  // namespace ui
++
++namespace side_panel {
++
++inline constexpr size_t kMaxCachedPageTexts = 16;
++inline constexpr size_t kMaxCachedPageTextChars = 4 * 1024 * 1024;
++// How long a page that can change without telling us (no accessibility
++// events) is taken as unchanged
++inline constexpr base::TimeDelta kMaxUnobservedPageTextAge =
++    base::Seconds(30);
++inline constexpr size_t kMaxDiskPageTexts = 32;
++inline constexpr size_t kMaxDiskPageTextChars = 1024 * 1024;
++inline constexpr base::TimeDelta kMaxDiskPageTextAge = base::Days(7);
++// Under the profile directory
++inline constexpr char kPageTextCacheDirName[] = "BrowserOS Page Text";
++
++// Text extracted from pages for the LLM panels, so a page sent again (to
++// the panel, or to every Clash of GPTs pane) isn't extracted again. UI
++// thread only, apart from HashSnapshot().
++//
++// Two keys find a page's text, both with its URL and the extraction
++// budget:
++//  - Its document version, which changes whenever the tab navigates,
++//    finishes a load, changes its title or fires accessibility events.
++//    A hit needs no snapshot, so the renderer isn't asked at all. Pages
++//    without accessibility events can change silently, so for them a hit
++//    is only taken within kMaxUnobservedPageTextAge of the extraction.
++//  - A hash of its snapshot, for a page snapshotted again but unchanged,
++//    which then isn't extracted again.
++//
++// Texts live in memory, least recently used dropped first, and in
++// profiles with browseros::prefs::kPageTextDiskCache also on disk, keyed
++// by snapshot hash, so they outlive a restart. Off-the-record profiles
++// never write to disk. Memory pressure clears the memory entries.
++class BrowserOSPageTextCache {
++ public:
++  // Where a text came from, read when its snapshot was requested
++  struct Document {
++    // The committed URL, less its ref
++    GURL url;
++    // Never 0
++    uint64_t version = 0;
++    // Whether the tab had accessibility on, so that the page's changes
++    // reach us as events and bump |version|
++    bool observed = false;
++  };
++
++  struct Key {
++    GURL url;
++    uint32_t content_hash = 0;
++    BrowserOSSimplePageExtractor::Budget budget;
++  };
++
++  static BrowserOSPageTextCache* Get();
++
++  BrowserOSPageTextCache(const BrowserOSPageTextCache&) = delete;
++  BrowserOSPageTextCache& operator=(const BrowserOSPageTextCache&) = delete;
++
++  static Document GetDocument(content::WebContents* web_contents);
++
++  // Where |web_contents|' profile keeps texts on disk, or empty if it
++  // doesn't
++  static base::FilePath GetDiskDir(content::WebContents* web_contents);
++
++  // Hash of what the extraction reads from |update|, stable across
++  // restarts. Any thread.
++  static uint32_t HashSnapshot(const ui::AXTreeUpdate& update);
++
++  // The text of |document| for |budget|, if cached at its version and
++  // still taken as current
++  std::optional<std::u16string> FindUnchanged(
++      const Document& document,
++      const BrowserOSSimplePageExtractor::Budget& budget);
++
++  // The text cached for |key| in memory
++  std::optional<std::u16string> Find(const Key& key);
++
++  // Looks |key| up in |disk_dir| and runs |callback| with the text, or
++  // nullopt if not there, on the UI thread
++  void FindOnDisk(
++      const base::FilePath& disk_dir,
++      const Key& key,
++      base::OnceCallback<void(std::optional<std::u16string>)> callback);
++
++  // Caches |text| for |key| and |document|, and writes it to |disk_dir|
++  // unless empty
++  void Put(const Key& key,
++           const Document& document,
++           const std::u16string& text,
++           const base::FilePath& disk_dir);
++
++ private:
++  friend base::NoDestructor<BrowserOSPageTextCache>;
++
++  struct Entry {
++    Entry();
++    Entry(Entry&&);
++    Entry& operator=(Entry&&);
++    ~Entry();
++
++    Key key;
++    uint64_t document_version = 0;
++    bool observed = false;
++    base::TimeTicks extracted;
++    std::u16string text;
++  };
++
++  BrowserOSPageTextCache();
++  ~BrowserOSPageTextCache();
++
++  void Trim();
++
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(browseros::ReleasedMemory)> done);
++
++  // Hit counts and cached texts, for chrome://browseros-internals
++  void ReportStepProfile(base::OnceCallback<void(base::Value::Dict)> done);
++
++  // Most recently used first
++  std::list<Entry> entries_;
++  size_t cached_chars_ = 0;
++
++  size_t unchanged_hits_ = 0;
++  size_t content_hits_ = 0;
++  size_t disk_hits_ = 0;
++  size_t stored_ = 0;
++
++  // Reads and writes files in order
++  scoped_refptr<base::SequencedTaskRunner> disk_task_runner_;
++
++  base::ScopedClosureRunner memory_pressure_registration_;
++  base::ScopedClosureRunner profiler_registration_;
++};
++
++}  // namespace side_panel
++
++#endif  // CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PAGE_TEXT_CACHE_H_
@@ -0,0 +1,189 @@
+diff --git a/chrome/browser/ui/views/side_panel/browseros_page_text_request.cc b/chrome/browser/ui/views/side_panel/browseros_page_text_request.cc
+new file mode 100644
+index 0000000000000..d3a60bdd59552
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/browseros_page_text_request.cc
+@@ -0,0 +1,183 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/ui/views/side_panel/browseros_page_text_request.h"
++
++#include <optional>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "base/time/time.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_mode.h"
++
++namespace side_panel {
++
++namespace {
++
++constexpr base::TimeDelta kSnapshotTimeout = base::Seconds(5);
++
++}  // namespace
++
++BrowserOSPageTextRequest::BrowserOSPageTextRequest(
++    TabStripModel* tab_strip_model,
++    BrowserOSSimplePageExtractor::Budget budget,
++    Callback callback)
++    : budget_(budget),
++      callback_(std::move(callback)),
++      cancel_flag_(base::MakeRefCounted<CancelFlag>()) {
++  content::WebContents* active_contents =
++      tab_strip_model ? tab_strip_model->GetActiveWebContents() : nullptr;
++  if (!active_contents) {
++    return;
++  }
++
++  tab_strip_observation_.Observe(tab_strip_model);
++  document_ = BrowserOSPageTextCache::GetDocument(active_contents);
++  disk_dir_ = BrowserOSPageTextCache::GetDiskDir(active_contents);
++  if (std::optional<std::u16string> text =
++          BrowserOSPageTextCache::Get()->FindUnchanged(document_, budget_)) {
++    // Still asynchronous, like a snapshot
++    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++        FROM_HERE,
++        base::BindOnce(&BrowserOSPageTextRequest::Finish,
++                       weak_factory_.GetWeakPtr(), std::move(*text)));
++    return;
++  }
++  browseros::AXSnapshotCache::Request(
++      active_contents, ui::AXMode::kWebContents,
++      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants,
++      kSnapshotTimeout, browseros::AXSnapshotCache::Freshness::kAny,
++      base::BindOnce(&BrowserOSPageTextRequest::OnSnapshotReceived,
++                     weak_factory_.GetWeakPtr()));
++}
++
++BrowserOSPageTextRequest::~BrowserOSPageTextRequest() {
++  Cancel();
++}
++
++void BrowserOSPageTextRequest::OnTabStripModelChanged(
++    TabStripModel* tab_strip_model,
++    const TabStripModelChange& change,
++    const TabStripSelectionChange& selection) {
++  if (selection.active_tab_changed()) {
++    VLOG(1) << "[browseros] Active tab changed, cancelling page text request";
++    Cancel();
++  }
++}
++
++void BrowserOSPageTextRequest::OnTabStripModelDestroyed(
++    TabStripModel* tab_strip_model) {
++  Cancel();
++}
++
++void BrowserOSPageTextRequest::OnSnapshotReceived(
++    browseros::SharedAXTreeUpdate snapshot) {
++  if (!callback_) {
++    return;
++  }
++
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::TaskPriority::USER_VISIBLE,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(
++          [](browseros::SharedAXTreeUpdate snapshot) {
++            return BrowserOSPageTextCache::HashSnapshot(snapshot->data);
++          },
++          snapshot),
++      base::BindOnce(&BrowserOSPageTextRequest::OnSnapshotHashed,
++                     weak_factory_.GetWeakPtr(), snapshot));
++}
++
++void BrowserOSPageTextRequest::OnSnapshotHashed(
++    browseros::SharedAXTreeUpdate snapshot,
++    uint32_t content_hash) {
++  if (!callback_) {
++    return;
++  }
++
++  const BrowserOSPageTextCache::Key key{document_.url, content_hash, budget_};
++  BrowserOSPageTextCache* cache = BrowserOSPageTextCache::Get();
++  if (std::optional<std::u16string> text = cache->Find(key)) {
++    Finish(std::move(*text));
++    return;
++  }
++  if (disk_dir_.empty()) {
++    Extract(std::move(snapshot), content_hash);
++    return;
++  }
++  cache->FindOnDisk(
++      disk_dir_, key,
++      base::BindOnce(&BrowserOSPageTextRequest::OnDiskChecked,
++                     weak_factory_.GetWeakPtr(), snapshot, content_hash));
++}
++
++void BrowserOSPageTextRequest::OnDiskChecked(
++    browseros::SharedAXTreeUpdate snapshot,
++    uint32_t content_hash,
++    std::optional<std::u16string> text) {
++  if (!callback_) {
++    return;
++  }
++  if (!text) {
++    Extract(std::move(snapshot), content_hash);
++    return;
++  }
++  // Already on disk, so only kept in memory
++  BrowserOSPageTextCache::Get()->Put({document_.url, content_hash, budget_},
++                                     document_, *text, base::FilePath());
++  Finish(std::move(*text));
++}
++
++void BrowserOSPageTextRequest::Extract(browseros::SharedAXTreeUpdate snapshot,
++                                       uint32_t content_hash) {
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE,
++      {base::TaskPriority::USER_VISIBLE,
++       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
++      base::BindOnce(
++          [](browseros::SharedAXTreeUpdate snapshot,
++             BrowserOSSimplePageExtractor::Budget budget,
++             scoped_refptr<CancelFlag> cancel_flag) {
++            return BrowserOSSimplePageExtractor::ExtractStructuredText(
++                snapshot->data, budget, &cancel_flag->data);
++          },
++          snapshot, budget_, cancel_flag_),
++      base::BindOnce(&BrowserOSPageTextRequest::OnTextExtracted,
++                     weak_factory_.GetWeakPtr(), content_hash));
++}
++
++void BrowserOSPageTextRequest::OnTextExtracted(
++    uint32_t content_hash,
++    BrowserOSSimplePageExtractor::Result result) {
++  if (!callback_ || cancel_flag_->data.IsSet()) {
++    return;
++  }
++
++  BrowserOSPageTextCache::Get()->Put({document_.url, content_hash, budget_},
++                                     document_, result.text, disk_dir_);
++  Finish(std::move(result.text));
++}
++
++void BrowserOSPageTextRequest::Finish(std::u16string text) {
++  if (!callback_) {
++    return;
++  }
++  tab_strip_observation_.Reset();
++  std::move(callback_).Run(std::move(text));
++}
++
++void BrowserOSPageTextRequest::Cancel() {
++  tab_strip_observation_.Reset();
++  callback_.Reset();
++  if (!cancel_flag_->data.IsSet()) {
++    cancel_flag_->data.Set();
++  }
++}
++
++}  // namespace side_panel
@@ -0,0 +1,94 @@
+diff --git a/chrome/browser/ui/views/side_panel/browseros_page_text_request.h b/chrome/browser/ui/views/side_panel/browseros_page_text_request.h
+new file mode 100644
+index 0000000000000..c42b932878f2e
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/browseros_page_text_request.h
+@@ -0,0 +1,88 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PAGE_TEXT_REQUEST_H_
++#define CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PAGE_TEXT_REQUEST_H_
++
++#include <cstdint>
++#include <optional>
++#include <string>
++
++#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/scoped_observation.h"
++#include "base/synchronization/atomic_flag.h"
++#include "chrome/browser/browseros/core/browseros_ax_snapshot_cache.h"
++#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "chrome/browser/ui/tabs/tab_strip_model_observer.h"
++#include "chrome/browser/ui/views/side_panel/browseros_page_text_cache.h"
++#include "chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h"
++
++namespace side_panel {
++
++// Extracts the structured text of a tab's page for the LLM panels, keeping
++// the UI thread responsive: the snapshot comes from AXSnapshotCache and
++// BrowserOSSimplePageExtractor runs on the ThreadPool.
++// Switching tabs cancels the request, stopping a running extraction
++// early, as does destroying it. Texts go through BrowserOSPageTextCache,
++// so copying an unchanged page again (e.g. into every Clash of GPTs pane)
++// neither extracts it twice nor, mostly, asks the renderer again.
++class BrowserOSPageTextRequest : public TabStripModelObserver {
++ public:
++  using Callback = base::OnceCallback<void(std::u16string text)>;
++
++  // Starts extracting the page of the active tab of |tab_strip_model|.
++  // |callback| runs on the UI thread unless the request is cancelled.
++  BrowserOSPageTextRequest(TabStripModel* tab_strip_model,
++                           BrowserOSSimplePageExtractor::Budget budget,
++                           Callback callback);
++
++  BrowserOSPageTextRequest(const BrowserOSPageTextRequest&) = delete;
++  BrowserOSPageTextRequest& operator=(const BrowserOSPageTextRequest&) =
++      delete;
++
++  ~BrowserOSPageTextRequest() override;
++
++  // TabStripModelObserver:
++  void OnTabStripModelChanged(
++      TabStripModel* tab_strip_model,
++      const TabStripModelChange& change,
++      const TabStripSelectionChange& selection) override;
++  void OnTabStripModelDestroyed(TabStripModel* tab_strip_model) override;
++
++ private:
++  using CancelFlag = base::RefCountedData<base::AtomicFlag>;
++
++  void OnSnapshotReceived(browseros::SharedAXTreeUpdate snapshot);
++  void OnSnapshotHashed(browseros::SharedAXTreeUpdate snapshot,
++                        uint32_t content_hash);
++  void OnDiskChecked(browseros::SharedAXTreeUpdate snapshot,
++                     uint32_t content_hash,
++                     std::optional<std::u16string> text);
++  void Extract(browseros::SharedAXTreeUpdate snapshot, uint32_t content_hash);
++  void OnTextExtracted(uint32_t content_hash,
++                       BrowserOSSimplePageExtractor::Result result);
++  void Finish(std::u16string text);
++  void Cancel();
++
++  const BrowserOSSimplePageExtractor::Budget budget_;
++  // The page when the request started; what its text is cached under
++  BrowserOSPageTextCache::Document document_;
++  // Empty unless the profile caches texts on disk
++  base::FilePath disk_dir_;
++  Callback callback_;
++  // Set on the UI thread, read by the extraction
++  const scoped_refptr<CancelFlag> cancel_flag_;
++
++  base::ScopedObservation<TabStripModel, TabStripModelObserver>
++      tab_strip_observation_{this};
++
++  base::WeakPtrFactory<BrowserOSPageTextRequest> weak_factory_{this};
++};
++
++}  // namespace side_panel
++
++#endif  // CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PAGE_TEXT_REQUEST_H_
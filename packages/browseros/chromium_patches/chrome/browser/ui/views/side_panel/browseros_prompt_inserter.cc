@@ -0,0 +1,197 @@
+diff --git a/chrome/browser/ui/views/side_panel/browseros_prompt_inserter.cc b/chrome/browser/ui/views/side_panel/browseros_prompt_inserter.cc
+new file mode 100644
+index 0000000000000..359e1162063ae
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/browseros_prompt_inserter.cc
+@@ -0,0 +1,191 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/ui/views/side_panel/browseros_prompt_inserter.h"
++
++#include <algorithm>
++#include <string_view>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/strcat.h"
++#include "base/strings/utf_string_conversions.h"
++#include "base/third_party/icu/icu_utf.h"
++#include "chrome/common/chrome_isolated_world_ids.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/web_contents.h"
++
++namespace side_panel {
++
++namespace {
++
++// Finds the editor, remembers it for the chunks that follow and inserts
++// the first part of the prompt. The isolated world keeps its globals
++// between scripts, and the page can't see them.
++constexpr char kInsertFirstScript[] = R"((text) => {
++  const isEditable = (el) => el && (el.isContentEditable ||
++      el.tagName === 'TEXTAREA' ||
++      (el.tagName === 'INPUT' && el.type === 'text'));
++  let target = document.activeElement;
++  if (!isEditable(target)) {
++    target = document.querySelector('textarea, [contenteditable="true"]');
++  }
++  if (!target) {
++    return false;
++  }
++  globalThis.browserosPromptTarget = target;
++  target.focus();
++  return document.execCommand('insertText', false, text);
++})";
++
++// Appends a chunk where the last one ended, in the editor the first one
++// went to
++constexpr char kInsertChunkScript[] = R"((text) => {
++  const target = globalThis.browserosPromptTarget;
++  if (!target || !target.isConnected) {
++    return false;
++  }
++  if (document.activeElement !== target) {
++    target.focus();
++  }
++  return document.execCommand('insertText', false, text);
++})";
++
++// Hands the prompt to the first file input taking text files, as an upload
++// picked by the user would be
++constexpr char kAttachScript[] = R"((name, text) => {
++  const takesText = (input) => !input.accept ||
++      input.accept.split(',').some((type) =>
++          ['text/plain', 'text/*', '.txt', '*/*'].includes(type.trim()));
++  const input = [...document.querySelectorAll('input[type="file"]')]
++      .find((el) => !el.disabled && takesText(el));
++  if (!input) {
++    return false;
++  }
++  const transfer = new DataTransfer();
++  transfer.items.add(new File([text], name, {type: 'text/plain'}));
++  input.files = transfer.files;
++  input.dispatchEvent(new Event('input', {bubbles: true}));
++  input.dispatchEvent(new Event('change', {bubbles: true}));
++  return true;
++})";
++
++// Runs |script| with |args| in the isolated world of |web_contents|' main
++// frame. JSON is a valid JavaScript expression, so the arguments need no
++// escaping of their own.
++void RunScript(content::WebContents* web_contents,
++               std::string_view script,
++               base::Value::List args,
++               base::OnceCallback<void(base::Value)> callback) {
++  std::string args_json = base::WriteJson(args).value_or("[]");
++  // Strip the brackets; the list becomes the argument list
++  std::string_view arguments(args_json);
++  arguments = arguments.substr(1, arguments.size() - 2);
++  web_contents->GetPrimaryMainFrame()->ExecuteJavaScriptInIsolatedWorld(
++      base::UTF8ToUTF16(base::StrCat({"(", script, ")(", arguments, ")"})),
++      std::move(callback), ISOLATED_WORLD_ID_CHROME_INTERNAL);
++}
++
++}  // namespace
++
++BrowserOSPromptInserter::BrowserOSPromptInserter(
++    content::WebContents* web_contents,
++    std::u16string prompt,
++    Callback callback)
++    : content::WebContentsObserver(web_contents),
++      prompt_(std::move(prompt)),
++      callback_(std::move(callback)) {
++  if (prompt_.size() >= kMinAttachedPromptSize) {
++    Attach();
++  } else {
++    InsertNextChunk();
++  }
++}
++
++BrowserOSPromptInserter::~BrowserOSPromptInserter() = default;
++
++void BrowserOSPromptInserter::PrimaryPageChanged(content::Page& page) {
++  Finish(Result::kInterrupted);
++}
++
++void BrowserOSPromptInserter::WebContentsDestroyed() {
++  Observe(nullptr);
++  Finish(Result::kInterrupted);
++}
++
++void BrowserOSPromptInserter::Attach() {
++  RunScript(web_contents(), kAttachScript,
++            base::Value::List()
++                .Append(kAttachedPromptFileName)
++                .Append(prompt_),
++            base::BindOnce(&BrowserOSPromptInserter::OnAttached,
++                           weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSPromptInserter::OnAttached(base::Value attached) {
++  if (attached.GetIfBool().value_or(false)) {
++    VLOG(1) << "[browseros] Attached a " << prompt_.size()
++            << " character prompt as " << kAttachedPromptFileName;
++    Finish(Result::kAttached);
++    return;
++  }
++  // No upload input here; the editor takes it piece by piece
++  InsertNextChunk();
++}
++
++void BrowserOSPromptInserter::InsertNextChunk() {
++  if (!web_contents()) {
++    return;
++  }
++  const size_t begin = next_chunk_;
++  const size_t chunk_size =
++      prompt_.size() <= kMaxDirectPromptSize ? prompt_.size()
++                                             : kPromptChunkSize;
++  size_t end = std::min(prompt_.size(), begin + chunk_size);
++  // Never split a surrogate pair between two chunks
++  if (end < prompt_.size() && end > begin + 1 &&
++      CBU16_IS_LEAD(prompt_[end - 1])) {
++    --end;
++  }
++  RunScript(web_contents(),
++            begin == 0 ? kInsertFirstScript : kInsertChunkScript,
++            base::Value::List().Append(prompt_.substr(begin, end - begin)),
++            base::BindOnce(&BrowserOSPromptInserter::OnChunkInserted,
++                           weak_factory_.GetWeakPtr(), end));
++}
++
++void BrowserOSPromptInserter::OnChunkInserted(size_t end,
++                                              base::Value inserted) {
++  if (!inserted.GetIfBool().value_or(false)) {
++    // Nothing in yet means there was no editor to begin with
++    Finish(next_chunk_ == 0 ? Result::kNoTarget : Result::kInterrupted);
++    return;
++  }
++  next_chunk_ = end;
++  if (next_chunk_ >= prompt_.size()) {
++    Finish(Result::kInserted);
++    return;
++  }
++  chunk_timer_.Start(FROM_HERE, kPromptChunkInterval,
++                     base::BindOnce(&BrowserOSPromptInserter::InsertNextChunk,
++                                    weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSPromptInserter::Finish(Result result) {
++  if (!callback_) {
++    return;
++  }
++  chunk_timer_.Stop();
++  weak_factory_.InvalidateWeakPtrs();
++  if (result == Result::kInterrupted) {
++    LOG(WARNING) << "[browseros] Prompt insertion stopped after "
++                 << next_chunk_ << " of " << prompt_.size() << " characters";
++  }
++  // May destroy |this|
++  std::move(callback_).Run(result);
++}
++
++}  // namespace side_panel
@@ -0,0 +1,102 @@
+diff --git a/chrome/browser/ui/views/side_panel/browseros_prompt_inserter.h b/chrome/browser/ui/views/side_panel/browseros_prompt_inserter.h
+new file mode 100644
+index 0000000000000..cc2ce96f9e32d
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/browseros_prompt_inserter.h
+@@ -0,0 +1,96 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PROMPT_INSERTER_H_
++#define CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PROMPT_INSERTER_H_
++
++#include <cstddef>
++#include <string>
++
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "base/timer/timer.h"
++#include "base/values.h"
++#include "content/public/browser/web_contents_observer.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace side_panel {
++
++// Prompts up to this size are inserted in one go
++inline constexpr size_t kMaxDirectPromptSize = 16 * 1024;
++// Larger ones are inserted this many UTF-16 units at a time...
++inline constexpr size_t kPromptChunkSize = 8 * 1024;
++// ...waiting this long after the page took one before sending the next
++inline constexpr base::TimeDelta kPromptChunkInterval = base::Milliseconds(30);
++// Prompts from this size on go as a text file to providers that take
++// uploads, and are inserted in chunks by the others
++inline constexpr size_t kMinAttachedPromptSize = 64 * 1024;
++inline constexpr char kAttachedPromptFileName[] = "web-page.txt";
++
++// Hands a prompt, usually a page's extracted text, to an LLM provider page
++// in the LLM panels. Inserted like a paste into the focused editor, or
++// else the page's first textarea or contenteditable, so provider editors
++// see ordinary input events.
++//
++// Provider editors freeze on a multi-hundred-KB insert, and their
++// renderer sometimes dies of it, so large prompts are inserted in chunks,
++// one after the page took the last, kPromptChunkInterval apart: the page
++// keeps laying out and responding between them. The largest go to the
++// page's file input as kAttachedPromptFileName instead, if it has one
++// that takes text files, so the text never reaches the editor.
++//
++// Inserting stops when the page navigates or the inserter is destroyed.
++// Nothing else touches the editor meanwhile: a new prompt for the page
++// replaces the inserter.
++class BrowserOSPromptInserter : public content::WebContentsObserver {
++ public:
++  enum class Result {
++    kInserted,
++    kAttached,
++    // The page has no editor to insert into, so nothing was inserted
++    kNoTarget,
++    // The page navigated, went away or dropped the editor midway
++    kInterrupted,
++  };
++  using Callback = base::OnceCallback<void(Result result)>;
++
++  // Starts inserting |prompt| into |web_contents|' primary main frame.
++  // |callback| runs once it is in, unless the inserter is destroyed first;
++  // the inserter may be destroyed from it.
++  BrowserOSPromptInserter(content::WebContents* web_contents,
++                          std::u16string prompt,
++                          Callback callback);
++
++  BrowserOSPromptInserter(const BrowserOSPromptInserter&) = delete;
++  BrowserOSPromptInserter& operator=(const BrowserOSPromptInserter&) = delete;
++
++  ~BrowserOSPromptInserter() override;
++
++  // content::WebContentsObserver:
++  void PrimaryPageChanged(content::Page& page) override;
++  void WebContentsDestroyed() override;
++
++ private:
++  void Attach();
++  void OnAttached(base::Value attached);
++  void InsertNextChunk();
++  void OnChunkInserted(size_t end, base::Value inserted);
++  void Finish(Result result);
++
++  const std::u16string prompt_;
++  // Where the next chunk starts
++  size_t next_chunk_ = 0;
++  Callback callback_;
++  base::OneShotTimer chunk_timer_;
++
++  base::WeakPtrFactory<BrowserOSPromptInserter> weak_factory_{this};
++};
++
++}  // namespace side_panel
++
++#endif  // CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_PROMPT_INSERTER_H_
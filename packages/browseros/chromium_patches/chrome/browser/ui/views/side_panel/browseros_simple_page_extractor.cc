@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.cc b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.cc
 new file mode 100644
-index 0000000000000..4a801a5d847ea
+index 0000000000000..b52c409f6c3b0
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.cc
-@@ -0,0 +1,231 @@
+@@ -0,0 +1,476 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,11 +11,20 @@ index 0000000000000..4a801a5d847ea
 +#include "chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h"
 +
 +#include <algorithm>
++#include <limits>
++#include <optional>
 +#include <string>
-+#include <unordered_map>
++#include <string_view>
++#include <unordered_set>
++#include <utility>
++#include <vector>
 +
++#include "base/memory/raw_ref.h"
 +#include "base/strings/string_util.h"
++#include "base/synchronization/atomic_flag.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "base/third_party/icu/icu_utf.h"
++#include "chrome/browser/browseros/core/browseros_ax_tree_walker.h"
 +#include "ui/accessibility/ax_enums.mojom.h"
 +#include "ui/accessibility/ax_node_data.h"
 +#include "ui/accessibility/ax_role_properties.h"
@@ -23,185 +32,337 @@ index 0000000000000..4a801a5d847ea
 +
 +namespace {
 +
++// Rough characters-per-token ratio used to turn a token budget into a
++// character budget
++constexpr size_t kCharsPerToken = 4;
++
++// Initial output capacity per tree node, so most pages never reallocate
++constexpr size_t kReservedCharsPerNode = 8;
++
++constexpr char16_t kTruncationMarker[] = u"\n\n[Content truncated]";
++
++// Order in which budgeted extraction visits the sections of a page
++enum class SectionPriority {
++  kHigh,    // main, article
++  kNormal,  // Content outside any section
++  kLow,     // navigation, banner, footer, complementary
++};
++
++// A top-level section of the page, extracted as a unit
++struct Section {
++  int32_t node_id;
++  SectionPriority priority;
++  int depth;  // List depth at the section, as MarkdownSink counts it
++};
++
 +// Forward declarations
-+std::u16string GetNodeText(const ui::AXNodeData* node);
++std::u16string GetNodeText(const ui::AXNodeData& node);
 +void CleanupWhitespace(std::u16string& text);
 +
-+// Recursively extracts text from a node using DFS with semantic boundaries.
-+// Stops recursion at headings, links, and images to prevent duplication.
-+void ExtractNode(
-+    int32_t node_id,
-+    const std::unordered_map<int32_t, const ui::AXNodeData*>& node_map,
-+    std::u16string& output,
-+    int depth = 0) {
++// Returns true for nodes whose children MarkdownSink never visits
++bool IsTerminalNode(const ui::AXNodeData& node) {
++  return ui::IsHeading(node.role) || ui::IsLink(node.role) ||
++         ui::IsImage(node.role) || ui::IsText(node.role);
++}
 +
-+  auto it = node_map.find(node_id);
-+  if (it == node_map.end()) return;
++// Returns the section priority of |node|, or nullopt if it does not start a
++// section
++std::optional<SectionPriority> GetSectionPriority(const ui::AXNodeData& node) {
++  switch (node.role) {
++    case ax::mojom::Role::kMain:
++    case ax::mojom::Role::kArticle:
++      return SectionPriority::kHigh;
++    case ax::mojom::Role::kNavigation:
++    case ax::mojom::Role::kBanner:
++    case ax::mojom::Role::kContentInfo:
++    case ax::mojom::Role::kComplementary:
++      return SectionPriority::kLow;
++    default:
++      return std::nullopt;
++  }
++}
 +
-+  const ui::AXNodeData* node = it->second;
++// Formats nodes as markdown-like text with semantic boundaries: headings,
++// links, images and text nodes are terminal, so their child text is not
++// extracted twice.
++class MarkdownSink : public browseros::AXContentSink {
++ public:
++  MarkdownSink(size_t budget, int depth) : remaining_(budget), depth_(depth) {}
++
++  // Starts the next fragment, e.g. for the next section.
++  void Reset(int depth) {
++    fragments_.assign(1, std::u16string());
++    depth_ = depth;
++  }
 +
-+  // Skip invisible or ignored nodes but still process their children
-+  if (node->IsInvisibleOrIgnored()) {
-+    for (int32_t child_id : node->child_ids) {
-+      ExtractNode(child_id, node_map, output, depth);
-+    }
-+    return;
++  // Leaves |sections| out of the walk. Each one ends the current fragment,
++  // so fragment i is the text in front of the i-th skipped section.
++  void set_skipped_sections(const std::unordered_set<int32_t>* sections) {
++    skipped_sections_ = sections;
 +  }
 +
-+  // Handle different semantic elements (stop recursion at boundaries)
++  void set_cancel_flag(const base::AtomicFlag* cancel) { cancel_ = cancel; }
 +
-+  // NAVIGATION - Separate from main content
-+  if (node->role == ax::mojom::Role::kNavigation ||
-+      node->role == ax::mojom::Role::kBanner) {
-+    // Add spacing before
-+    if (!output.empty() && output.back() != u'\n') {
-+      output += u"\n\n";
++  void Reserve(size_t chars) { output().reserve(std::min(chars, remaining_)); }
++
++  std::vector<std::u16string> TakeFragments() { return std::move(fragments_); }
++  std::u16string TakeOutput() { return std::move(output()); }
++
++  bool truncated() const { return truncated_; }
++  void set_truncated() { truncated_ = true; }
++
++  // browseros::AXContentSink:
++  bool EnterNode(const ui::AXNodeData& node) override {
++    // Sections are extracted separately by the budgeted pass
++    if (skipped_sections_ && skipped_sections_->contains(node.id)) {
++      fragments_.emplace_back();
++      return false;
 +    }
 +
-+    // Recurse to extract nav links
-+    for (int32_t child_id : node->child_ids) {
-+      ExtractNode(child_id, node_map, output, depth);
++    // Skip invisible or ignored nodes but still process their children
++    if (node.IsInvisibleOrIgnored()) {
++      return true;
 +    }
 +
-+    // Add spacing after to separate from content
-+    output += u"\n\n";
-+    return;
-+  }
++    // NAVIGATION - Separate from main content
++    if (node.role == ax::mojom::Role::kNavigation ||
++        node.role == ax::mojom::Role::kBanner) {
++      // Add spacing before
++      if (!output().empty() && output().back() != u'\n') {
++        Append(u"\n\n");
++      }
++      return true;
++    }
++
++    // HEADINGS - Extract and format as markdown
++    if (ui::IsHeading(node.role)) {
++      int level = 2;  // Default to h2
++      if (node.HasIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel)) {
++        level =
++            node.GetIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel);
++        level = std::clamp(level, 1, 6);  // Ensure valid heading level
++      }
 +
-+  // HEADINGS - Extract and format as markdown
-+  if (ui::IsHeading(node->role)) {
-+    int level = 2;  // Default to h2
-+    if (node->HasIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel)) {
-+      level = node->GetIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel);
-+      level = std::clamp(level, 1, 6);  // Ensure valid heading level
++      std::u16string text = GetNodeText(node);
++      if (!text.empty()) {
++        // Add newline if not at start
++        if (!output().empty() && output().back() != u'\n') {
++          Append(u"\n\n");
++        }
++        // Add markdown heading
++        Append(std::u16string(level, u'#'));
++        Append(u" ");
++        Append(text);
++        Append(u"\n\n");
++      }
++      return false;  // Don't recurse into heading children
 +    }
 +
-+    std::u16string text = GetNodeText(node);
-+    if (!text.empty()) {
-+      // Add newline if not at start
-+      if (!output.empty() && output.back() != u'\n') {
-+        output += u"\n\n";
++    // LINKS - Extract text only (no URLs)
++    if (ui::IsLink(node.role)) {
++      std::u16string text = GetNodeText(node);
++      if (!text.empty()) {
++        Append(text);
++        Append(u" ");
 +      }
-+      // Add markdown heading
-+      output += std::u16string(level, u'#') + u" " + text + u"\n\n";
++      return false;  // Don't recurse into link children
 +    }
-+    return;  // Don't recurse into heading children
-+  }
 +
-+  // LINKS - Extract text only (no URLs)
-+  if (ui::IsLink(node->role)) {
-+    std::u16string text = GetNodeText(node);
-+    if (!text.empty()) {
-+      output += text + u" ";
++    // IMAGES - Extract alt text
++    if (ui::IsImage(node.role)) {
++      std::u16string alt_text = GetNodeText(node);
++      if (!alt_text.empty()) {
++        Append(u"[Image: ");
++        Append(alt_text);
++        Append(u"] ");
++      }
++      return false;  // Don't recurse into image children
 +    }
-+    return;  // Don't recurse into link children
-+  }
 +
-+  // IMAGES - Extract alt text
-+  if (ui::IsImage(node->role)) {
-+    std::u16string alt_text = GetNodeText(node);
-+    if (!alt_text.empty()) {
-+      output += u"[Image: " + alt_text + u"] ";
++    // TEXT NODES - Extract actual text content
++    if (ui::IsText(node.role)) {
++      std::u16string text = GetNodeText(node);
++      if (!text.empty()) {
++        // Add space if needed
++        if (!output().empty() && output().back() != u' ' &&
++            output().back() != u'\n') {
++          Append(u" ");
++        }
++        Append(text);
++      }
++      return false;  // Terminal node, no children
 +    }
-+    return;  // Don't recurse into image children
-+  }
 +
-+  // TEXT NODES - Extract actual text content
-+  if (ui::IsText(node->role)) {
-+    std::u16string text = GetNodeText(node);
-+    if (!text.empty()) {
-+      // Add space if needed
-+      if (!output.empty() && output.back() != u' ' && output.back() != u'\n') {
-+        output += u" ";
++    // LIST container - Increase depth for nested structure
++    if (node.role == ax::mojom::Role::kList) {
++      ++depth_;
++      return true;
++    }
++
++    // LIST ITEMS - Start new line with indentation
++    if (node.role == ax::mojom::Role::kListItem) {
++      // Start new line
++      if (!output().empty() && output().back() != u'\n') {
++        Append(u"\n");
++      }
++
++      // Add indentation for nested items (only if depth > 0)
++      if (depth_ > 0) {
++        Append(std::u16string(depth_, u'\t'));
 +      }
-+      output += text;
++
++      // Children go inline (same depth - they're siblings on same line)
++      return true;
 +    }
-+    return;  // Terminal node, no children
-+  }
 +
-+  // LIST container - Increase depth for nested structure
-+  if (node->role == ax::mojom::Role::kList) {
-+    for (int32_t child_id : node->child_ids) {
-+      ExtractNode(child_id, node_map, output, depth + 1);
++    // PARAGRAPHS - Add spacing
++    if (node.role == ax::mojom::Role::kParagraph) {
++      if (!output().empty() && output().back() != u'\n') {
++        Append(u"\n\n");
++      }
 +    }
-+    return;
++
++    // For all other container nodes, recurse to children
++    return true;
 +  }
 +
-+  // LIST ITEMS - Start new line with indentation
-+  if (node->role == ax::mojom::Role::kListItem) {
-+    // Start new line
-+    if (!output.empty() && output.back() != u'\n') {
-+      output += u"\n";
++  void ExitNode(const ui::AXNodeData& node) override {
++    if (node.IsInvisibleOrIgnored()) {
++      return;
 +    }
 +
-+    // Add indentation for nested items (only if depth > 0)
-+    if (depth > 0) {
-+      output += std::u16string(depth, u'\t');
++    // Add spacing after navigation to separate from content
++    if (node.role == ax::mojom::Role::kNavigation ||
++        node.role == ax::mojom::Role::kBanner) {
++      Append(u"\n\n");
++      return;
 +    }
 +
-+    // Extract children inline (same depth - they're siblings on same line)
-+    for (int32_t child_id : node->child_ids) {
-+      ExtractNode(child_id, node_map, output, depth);
++    if (node.role == ax::mojom::Role::kList) {
++      --depth_;
++      return;
 +    }
 +
-+    return;  // Semantic boundary - don't let parent recurse again
++    // Add spacing after certain block elements
++    if (node.role == ax::mojom::Role::kParagraph ||
++        node.role == ax::mojom::Role::kSection ||
++        node.role == ax::mojom::Role::kArticle) {
++      if (!output().empty() && output().back() != u'\n') {
++        Append(u"\n\n");
++      }
++    }
 +  }
 +
-+  // PARAGRAPHS - Add spacing
-+  if (node->role == ax::mojom::Role::kParagraph) {
-+    if (!output.empty() && output.back() != u'\n') {
-+      output += u"\n\n";
++  bool IsDone() const override {
++    return remaining_ == 0 || (cancel_ && cancel_->IsSet());
++  }
++
++ private:
++  std::u16string& output() { return fragments_.back(); }
++
++  // Appends |text| to the output, cutting it at the remaining budget
++  void Append(std::u16string_view text) {
++    if (text.size() <= remaining_) {
++      output().append(text);
++      remaining_ -= text.size();
++      return;
++    }
++
++    size_t cut = remaining_;
++    // Don't split a surrogate pair
++    if (cut > 0 && CBU16_IS_LEAD(text[cut - 1])) {
++      --cut;
 +    }
++    output().append(text.substr(0, cut));
++    remaining_ = 0;
++    truncated_ = true;
 +  }
 +
-+  // For all other container nodes, recurse to children
-+  for (int32_t child_id : node->child_ids) {
-+    ExtractNode(child_id, node_map, output, depth);
++  // Characters left before truncation
++  size_t remaining_;
++  bool truncated_ = false;
++  // List nesting depth
++  int depth_;
++  std::vector<std::u16string> fragments_ = std::vector<std::u16string>(1);
++  const std::unordered_set<int32_t>* skipped_sections_ = nullptr;
++  const base::AtomicFlag* cancel_ = nullptr;
++};
++
++// Collects the top-level sections of a page in document order. Follows the
++// same descent rules as MarkdownSink, so the ambient pass meets the
++// sections in the same order.
++class SectionCollector : public browseros::AXContentSink {
++ public:
++  explicit SectionCollector(std::vector<Section>& sections)
++      : sections_(sections) {}
++
++  // browseros::AXContentSink:
++  bool EnterNode(const ui::AXNodeData& node) override {
++    if (node.IsInvisibleOrIgnored()) {
++      return true;
++    }
++    if (std::optional<SectionPriority> priority = GetSectionPriority(node)) {
++      sections_->push_back({node.id, *priority, depth_});
++      return false;
++    }
++    if (IsTerminalNode(node)) {
++      return false;
++    }
++    if (node.role == ax::mojom::Role::kList) {
++      ++depth_;
++    }
++    return true;
 +  }
 +
-+  // Add spacing after certain block elements
-+  if (node->role == ax::mojom::Role::kParagraph ||
-+      node->role == ax::mojom::Role::kSection ||
-+      node->role == ax::mojom::Role::kArticle) {
-+    if (!output.empty() && output.back() != u'\n') {
-+      output += u"\n\n";
++  void ExitNode(const ui::AXNodeData& node) override {
++    if (!node.IsInvisibleOrIgnored() && node.role == ax::mojom::Role::kList) {
++      --depth_;
 +    }
 +  }
-+}
++
++ private:
++  const raw_ref<std::vector<Section>> sections_;
++  int depth_ = -1;  // Same start depth as the extraction
++};
 +
 +// Helper to get text from a node (name or value)
-+std::u16string GetNodeText(const ui::AXNodeData* node) {
-+  std::string text;
++std::u16string GetNodeText(const ui::AXNodeData& node) {
++  std::string_view text;
 +
 +  // Try name attribute first (most common)
-+  if (node->HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+    text = node->GetStringAttribute(ax::mojom::StringAttribute::kName);
++  if (node.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++    text = node.GetStringAttribute(ax::mojom::StringAttribute::kName);
 +  }
 +  // Fall back to value attribute (for input fields)
-+  else if (node->HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
-+    text = node->GetStringAttribute(ax::mojom::StringAttribute::kValue);
++  else if (node.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
++    text = node.GetStringAttribute(ax::mojom::StringAttribute::kValue);
 +  }
 +
-+  // Clean up the text
-+  text = std::string(base::TrimWhitespaceASCII(text, base::TRIM_ALL));
-+
-+  // Convert to UTF16 and return
-+  return base::UTF8ToUTF16(text);
++  // Clean up the text and convert to UTF16
++  return base::UTF8ToUTF16(base::TrimWhitespaceASCII(text, base::TRIM_ALL));
 +}
 +
-+// Clean up excessive whitespace in the final output
++// Clean up excessive whitespace in the final output, in a single pass:
++// runs of spaces become one space, runs of more than two newlines become
++// two, and trailing whitespace is trimmed.
 +void CleanupWhitespace(std::u16string& text) {
-+  // Replace multiple spaces with single space
-+  size_t pos = 0;
-+  while ((pos = text.find(u"  ", pos)) != std::u16string::npos) {
-+    text.replace(pos, 2, u" ");
-+  }
-+
-+  // Replace multiple newlines (more than 2) with double newline
-+  pos = 0;
-+  while ((pos = text.find(u"\n\n\n", pos)) != std::u16string::npos) {
-+    text.replace(pos, 3, u"\n\n");
++  size_t out = 0;
++  size_t newlines = 0;
++  for (size_t in = 0; in < text.size(); ++in) {
++    const char16_t c = text[in];
++    if (c == u' ' && out > 0 && text[out - 1] == u' ') {
++      continue;
++    }
++    if (c == u'\n') {
++      if (++newlines > 2) {
++        continue;
++      }
++    } else {
++      newlines = 0;
++    }
++    text[out++] = c;
 +  }
++  text.resize(out);
 +
 +  // Trim trailing whitespace
 +  while (!text.empty() && (text.back() == u' ' || text.back() == u'\n')) {
@@ -219,20 +380,103 @@ index 0000000000000..4a801a5d847ea
 +    return u"";
 +  }
 +
-+  // Build node map for O(1) lookup
-+  std::unordered_map<int32_t, const ui::AXNodeData*> node_map;
-+  for (const auto& node : update.nodes) {
-+    node_map[node.id] = &node;
-+  }
-+
-+  std::u16string output;
-+  ExtractNode(update.root_id, node_map, output, -1);  // Start at depth -1
++  browseros::AXTreeWalker walker(update);
++  MarkdownSink sink(std::numeric_limits<size_t>::max(), -1);  // Depth -1
++  sink.Reserve(update.nodes.size() * kReservedCharsPerNode);
++  walker.Walk(sink);
 +
 +  // Clean up extra whitespace
++  std::u16string output = sink.TakeOutput();
 +  CleanupWhitespace(output);
 +
 +  return output;
 +}
 +
++BrowserOSSimplePageExtractor::Result
++BrowserOSSimplePageExtractor::ExtractStructuredText(
++    const ui::AXTreeUpdate& update,
++    const Budget& budget,
++    const base::AtomicFlag* cancel) {
++  size_t max_chars = budget.max_chars;
++  if (budget.max_tokens > 0) {
++    const size_t token_chars = budget.max_tokens * kCharsPerToken;
++    max_chars = max_chars > 0 ? std::min(max_chars, token_chars) : token_chars;
++  }
++  if (max_chars == 0) {
++    return {ExtractStructuredText(update), false};
++  }
++
++  Result result;
++  if (update.nodes.empty()) {
++    return result;
++  }
++
++  // One index for all passes below
++  browseros::AXTreeWalker walker(update);
++
++  std::vector<Section> sections;
++  SectionCollector collector(sections);
++  walker.Walk(collector);
++  std::unordered_set<int32_t> section_ids;
++  for (const Section& section : sections) {
++    section_ids.insert(section.node_id);
++  }
++
++  // Spend the budget by priority. Each section is extracted on its own and
++  // content outside the sections in one pass that leaves them out; the
++  // pieces are put back in document order below.
++  MarkdownSink sink(max_chars, -1);
++  sink.set_cancel_flag(cancel);
++  std::vector<std::u16string> section_text(sections.size());
++  auto extract_sections = [&](SectionPriority priority) {
++    for (size_t i = 0; i < sections.size(); ++i) {
++      if (sections[i].priority != priority) {
++        continue;
++      }
++      sink.Reset(sections[i].depth);
++      if (!walker.Walk(sections[i].node_id, sink)) {
++        sink.set_truncated();
++      }
++      section_text[i] = sink.TakeOutput();
++    }
++  };
++
++  extract_sections(SectionPriority::kHigh);
++
++  sink.Reset(-1);
++  sink.set_skipped_sections(&section_ids);
++  if (!walker.Walk(sink)) {
++    sink.set_truncated();
++  }
++  sink.set_skipped_sections(nullptr);
++  std::vector<std::u16string> ambient_text = sink.TakeFragments();
++  // The ambient pass stops at the budget before reaching later sections
++  ambient_text.resize(sections.size() + 1);
++
++  extract_sections(SectionPriority::kLow);
++
++  result.text.reserve(max_chars);
++  auto join = [&](const std::u16string& piece) {
++    if (piece.empty()) {
++      return;
++    }
++    if (!result.text.empty() && result.text.back() != u'\n') {
++      result.text += u"\n\n";
++    }
++    result.text += piece;
++  };
++  join(ambient_text[0]);
++  for (size_t i = 0; i < sections.size(); ++i) {
++    join(section_text[i]);
++    join(ambient_text[i + 1]);
++  }
++
++  CleanupWhitespace(result.text);
++  result.truncated = sink.truncated();
++  if (result.truncated) {
++    result.text += kTruncationMarker;
++  }
++  return result;
++}
++
 +}  // namespace side_panel
-\ No newline at end of file
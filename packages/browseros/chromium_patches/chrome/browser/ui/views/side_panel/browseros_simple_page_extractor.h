@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h
 new file mode 100644
-index 0000000000000..b9cbddf65327e
+index 0000000000000..387985796d98c
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h
-@@ -0,0 +1,71 @@
+@@ -0,0 +1,105 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,8 +11,13 @@ index 0000000000000..b9cbddf65327e
 +#ifndef CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_SIMPLE_PAGE_EXTRACTOR_H_
 +#define CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_SIMPLE_PAGE_EXTRACTOR_H_
 +
++#include <cstddef>
 +#include <string>
 +
++namespace base {
++class AtomicFlag;
++}  // namespace base
++
 +namespace ui {
 +struct AXTreeUpdate;
 +}  // namespace ui
@@ -41,6 +46,14 @@ index 0000000000000..b9cbddf65327e
 +//   extracting their child text multiple times, which would otherwise appear
 +//   as duplicates in the output.
 +//
++// Budgeted Extraction:
++//   With a Budget, top-level sections are extracted by priority: main and
++//   article first, then content outside any section, then navigation,
++//   banner, footer and complementary regions. Extraction stops once the
++//   budget is spent, so no more text than fits is ever built. The pieces
++//   are put back together in document order and a truncation marker is
++//   appended if anything was left out.
++//
 +// Thread Safety:
 +//   All methods are static and stateless. Safe to call from any thread.
 +//
@@ -54,6 +67,19 @@ index 0000000000000..b9cbddf65327e
 +//
 +class BrowserOSSimplePageExtractor {
 + public:
++  // Upper bound on the extracted text. 0 means no limit; if both are set
++  // the smaller one applies. Tokens are estimated from characters.
++  struct Budget {
++    size_t max_chars = 0;
++    size_t max_tokens = 0;
++  };
++
++  struct Result {
++    std::u16string text;
++    // Whether content was left out to stay within the budget
++    bool truncated = false;
++  };
++
 +  // Extracts structured text from an accessibility tree update.
 +  //
 +  // Args:
@@ -65,6 +91,14 @@ index 0000000000000..b9cbddf65327e
 +  //   - The tree contains no readable text content
 +  static std::u16string ExtractStructuredText(const ui::AXTreeUpdate& update);
 +
++  // Like above, but stops at |budget| (see Budgeted Extraction). The text
++  // may exceed the budget by the length of the truncation marker.
++  // Extraction also stops early once |cancel| is set, e.g. from the UI
++  // thread while this runs on the ThreadPool; the result is then partial.
++  static Result ExtractStructuredText(const ui::AXTreeUpdate& update,
++                                      const Budget& budget,
++                                      const base::AtomicFlag* cancel = nullptr);
++
 +  // Utility class - no instances allowed
 +  BrowserOSSimplePageExtractor() = delete;
 +  ~BrowserOSSimplePageExtractor() = delete;
@@ -0,0 +1,159 @@
+diff --git a/chrome/browser/ui/views/side_panel/browseros_web_contents_pool.cc b/chrome/browser/ui/views/side_panel/browseros_web_contents_pool.cc
+new file mode 100644
+index 0000000000000..6eb80de9711a9
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/browseros_web_contents_pool.cc
+@@ -0,0 +1,153 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/ui/views/side_panel/browseros_web_contents_pool.h"
++
++#include <algorithm>
++#include <string>
++#include <utility>
++
++#include "base/check_deref.h"
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/memory/memory_pressure_monitor.h"
++#include "base/system/sys_info.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/time/time.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/pref_registry/pref_registry_syncable.h"
++#include "components/prefs/pref_service.h"
++#include "content/public/browser/navigation_controller.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/base/page_transition_types.h"
++
++namespace side_panel {
++
++namespace {
++
++// Lets the visible panel load first
++constexpr base::TimeDelta kPrewarmDelay = base::Seconds(3);
++
++// Minutes a closed LLM panel keeps its WebContents; 0 keeps them
++const char kIdleDiscardMinutesPref[] =
++    "browseros.llm_panels.idle_discard_minutes";
++constexpr int kDefaultIdleDiscardMinutes = 10;
++
++bool IsMemoryShort() {
++  if (base::SysInfo::IsLowEndDevice()) {
++    return true;
++  }
++  const base::MemoryPressureMonitor* monitor = base::MemoryPressureMonitor::Get();
++  return monitor && monitor->GetCurrentPressureLevel() !=
++                        base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE;
++}
++
++}  // namespace
++
++// static
++void BrowserOSWebContentsPool::RegisterProfilePrefs(
++    user_prefs::PrefRegistrySyncable* registry) {
++  registry->RegisterIntegerPref(kIdleDiscardMinutesPref,
++                                kDefaultIdleDiscardMinutes);
++}
++
++// static
++base::TimeDelta BrowserOSWebContentsPool::GetIdleDiscardDelay(
++    Profile* profile) {
++  const int minutes = profile->GetPrefs()->GetInteger(kIdleDiscardMinutesPref);
++  return minutes > 0 ? base::Minutes(minutes) : base::TimeDelta();
++}
++
++BrowserOSWebContentsPool::BrowserOSWebContentsPool(Profile* profile)
++    : profile_(CHECK_DEREF(profile)),
++      memory_pressure_registration_(browseros::AddMemoryPressureHandler(
++          "llm_web_contents_pool",
++          base::BindRepeating(&BrowserOSWebContentsPool::OnMemoryPressure,
++                              base::Unretained(this)))) {}
++
++BrowserOSWebContentsPool::~BrowserOSWebContentsPool() = default;
++
++std::unique_ptr<content::WebContents> BrowserOSWebContentsPool::Take(
++    const GURL& provider_url) {
++  auto it = Find(provider_url);
++  if (it == entries_.end()) {
++    return nullptr;
++  }
++  std::unique_ptr<content::WebContents> web_contents =
++      std::move(it->web_contents);
++  entries_.erase(it);
++  return web_contents;
++}
++
++void BrowserOSWebContentsPool::Park(
++    const GURL& provider_url,
++    std::unique_ptr<content::WebContents> web_contents) {
++  if (!web_contents || !provider_url.is_valid()) {
++    return;
++  }
++
++  web_contents->SetDelegate(nullptr);
++  web_contents->WasHidden();
++
++  auto it = Find(provider_url);
++  if (it != entries_.end()) {
++    entries_.erase(it);
++  }
++  entries_.push_back({provider_url, std::move(web_contents)});
++  if (entries_.size() > kMaxPooledWebContents) {
++    entries_.erase(entries_.begin());
++  }
++}
++
++void BrowserOSWebContentsPool::Prewarm(const GURL& provider_url,
++                                       const GURL& url) {
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&BrowserOSWebContentsPool::DoPrewarm,
++                     weak_factory_.GetWeakPtr(), provider_url, url),
++      kPrewarmDelay);
++}
++
++void BrowserOSWebContentsPool::Clear() {
++  weak_factory_.InvalidateWeakPtrs();
++  entries_.clear();
++}
++
++std::vector<BrowserOSWebContentsPool::Entry>::iterator
++BrowserOSWebContentsPool::Find(const GURL& provider_url) {
++  return std::ranges::find(entries_, provider_url, &Entry::provider_url);
++}
++
++void BrowserOSWebContentsPool::DoPrewarm(const GURL& provider_url,
++                                         const GURL& url) {
++  if (!url.is_valid() || Find(provider_url) != entries_.end() ||
++      IsMemoryShort()) {
++    return;
++  }
++
++  VLOG(1) << "[browseros] Prewarming LLM provider: " << provider_url.spec();
++  content::WebContents::CreateParams params(&profile_.get());
++  params.initially_hidden = true;
++  std::unique_ptr<content::WebContents> web_contents =
++      content::WebContents::Create(params);
++  web_contents->GetController().LoadURL(url, content::Referrer(),
++                                        ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
++                                        std::string());
++  Park(provider_url, std::move(web_contents));
++}
++
++void BrowserOSWebContentsPool::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level,
++    base::OnceCallback<void(browseros::ReleasedMemory)> done) {
++  browseros::ReleasedMemory released;
++  released.items = entries_.size();
++  if (!entries_.empty()) {
++    LOG(INFO) << "[browseros] Dropping " << entries_.size()
++              << " pooled LLM WebContents on memory pressure";
++  }
++  Clear();
++  std::move(done).Run(released);
++}
++
++}  // namespace side_panel
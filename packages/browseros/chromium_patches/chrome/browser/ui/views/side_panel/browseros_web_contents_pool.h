@@ -0,0 +1,108 @@
+diff --git a/chrome/browser/ui/views/side_panel/browseros_web_contents_pool.h b/chrome/browser/ui/views/side_panel/browseros_web_contents_pool.h
+new file mode 100644
+index 0000000000000..bf01a54e9acd6
+--- /dev/null
++++ b/chrome/browser/ui/views/side_panel/browseros_web_contents_pool.h
+@@ -0,0 +1,102 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_WEB_CONTENTS_POOL_H_
++#define CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_WEB_CONTENTS_POOL_H_
++
++#include <cstddef>
++#include <memory>
++#include <vector>
++
++#include "base/functional/callback_helpers.h"
++#include "base/memory/memory_pressure_listener.h"
++#include "base/memory/raw_ref.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
++#include "url/gurl.h"
++
++class Profile;
++
++namespace user_prefs {
++class PrefRegistrySyncable;
++}  // namespace user_prefs
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace side_panel {
++
++// Keeps a few hidden provider WebContents alive so the LLM panels (LLM
++// Chat, Clash of GPTs) can switch to a provider without a cold load.
++//
++// Entries are keyed by the provider's home URL. A parked WebContents keeps
++// its page and history, so taking it back restores the provider where the
++// user left it. The pool holds at most kMaxPooledWebContents entries,
++// dropping the least recently parked one first, and empties itself on
++// memory pressure. Prewarming is skipped on low-end devices and while
++// memory is short.
++//
++// The owner must Clear() the pool before the profile is destroyed.
++class BrowserOSWebContentsPool {
++ public:
++  static constexpr size_t kMaxPooledWebContents = 2;
++
++  // Registers the idle discard pref shared by the LLM panels.
++  static void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry);
++
++  // How long a closed LLM panel keeps its WebContents before discarding
++  // them, or zero if they are kept until the window closes.
++  static base::TimeDelta GetIdleDiscardDelay(Profile* profile);
++
++  explicit BrowserOSWebContentsPool(Profile* profile);
++
++  BrowserOSWebContentsPool(const BrowserOSWebContentsPool&) = delete;
++  BrowserOSWebContentsPool& operator=(const BrowserOSWebContentsPool&) =
++      delete;
++
++  ~BrowserOSWebContentsPool();
++
++  // Removes and returns the WebContents pooled for |provider_url|, or
++  // nullptr. The caller becomes its delegate.
++  std::unique_ptr<content::WebContents> Take(const GURL& provider_url);
++
++  // Parks |web_contents|, which shows the provider at |provider_url|. It is
++  // hidden and loses its delegate until taken back.
++  void Park(const GURL& provider_url,
++            std::unique_ptr<content::WebContents> web_contents);
++
++  // Shortly after, loads |url| in a hidden WebContents pooled for
++  // |provider_url|, unless one is pooled already or memory is short.
++  void Prewarm(const GURL& provider_url, const GURL& url);
++
++  // Destroys all pooled WebContents and drops pending prewarms.
++  void Clear();
++
++ private:
++  struct Entry {
++    GURL provider_url;
++    std::unique_ptr<content::WebContents> web_contents;
++  };
++
++  std::vector<Entry>::iterator Find(const GURL& provider_url);
++  void DoPrewarm(const GURL& provider_url, const GURL& url);
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(browseros::ReleasedMemory)> done);
++
++  const raw_ref<Profile> profile_;
++
++  // Least recently parked first
++  std::vector<Entry> entries_;
++
++  base::ScopedClosureRunner memory_pressure_registration_;
++
++  base::WeakPtrFactory<BrowserOSWebContentsPool> weak_factory_{this};
++};
++
++}  // namespace side_panel
++
++#endif  // CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_BROWSEROS_WEB_CONTENTS_POOL_H_
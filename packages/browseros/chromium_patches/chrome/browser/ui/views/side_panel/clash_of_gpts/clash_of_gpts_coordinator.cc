@@ -1,18 +1,22 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc
 new file mode 100644
-index 0000000000000..9e1c6dc9fe8a1
+index 0000000000000..3d24c41c362d9
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc
-@@ -0,0 +1,568 @@
+@@ -0,0 +1,808 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h"
 +
++#include <algorithm>
++#include <utility>
++
 +#include "base/check.h"
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
++#include "base/strings/str_cat.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/stringprintf.h"
 +#include "base/strings/utf_string_conversions.h"
@@ -27,6 +31,8 @@ index 0000000000000..9e1c6dc9fe8a1
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h"
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_window.h"
++#include "chrome/browser/ui/views/side_panel/browseros_page_text_request.h"
++#include "chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h"
 +#include "components/input/native_web_keyboard_event.h"
 +#include "components/pref_registry/pref_registry_syncable.h"
 +#include "components/prefs/pref_service.h"
@@ -50,6 +56,13 @@ index 0000000000000..9e1c6dc9fe8a1
 +// Shared provider list preference (from third_party_llm)
 +const char kThirdPartyLlmProvidersPref[] = "browseros.third_party_llm.providers";
 +
++// Keeps pasted page content within typical provider context limits
++constexpr size_t kPageContentTokenBudget = 50000;
++
++// How long hidden panes keep running before they are frozen, so answers
++// still streaming in when the window is minimized can finish
++constexpr base::TimeDelta kPaneFreezeDelay = base::Minutes(1);
++
 +}  // namespace
 +
 +ClashOfGptsCoordinator::ClashOfGptsCoordinator(Browser* browser)
@@ -58,16 +71,15 @@ index 0000000000000..9e1c6dc9fe8a1
 +  // Register for early cleanup notifications
 +  browser_list_observation_.Observe(BrowserList::GetInstance());
 +  profile_observation_.Observe(browser_->profile());
-+
-+  // Load shared provider list first
-+  LoadProvidersFromPrefs();
++  memory_pressure_registration_ = browseros::AddMemoryPressureHandler(
++      "clash_of_gpts",
++      base::BindRepeating(&ClashOfGptsCoordinator::OnMemoryPressure,
++                          base::Unretained(this)));
 +
 +  // Initialize with default provider indices for max panes
 +  pane_provider_indices_[0] = 0;
 +  pane_provider_indices_[1] = 1;
 +  pane_provider_indices_[2] = 2;
-+
-+  LoadState();
 +}
 +
 +ClashOfGptsCoordinator::~ClashOfGptsCoordinator() {
@@ -77,6 +89,11 @@ index 0000000000000..9e1c6dc9fe8a1
 +}
 +
 +void ClashOfGptsCoordinator::Show() {
++  EnsureInitialized();
++  idle_discard_timer_.Stop();
++  // A visible page must not be frozen, so thaw the panes before a new view
++  // attaches them
++  SetPanesFrozen(false);
 +  CreateWindowIfNeeded();
 +  if (widget_) {
 +    widget_->Show();
@@ -86,12 +103,15 @@ index 0000000000000..9e1c6dc9fe8a1
 +}
 +
 +void ClashOfGptsCoordinator::Close() {
++  widget_observation_.Reset();
 +  if (widget_) {
 +    // Following Chromium style guide: destroy widget by resetting unique_ptr
 +    widget_.reset();
 +  }
 +  window_.reset();
 +  view_ = nullptr;
++  UpdatePaneLifecycle();
++  StartIdleDiscardTimer();
 +}
 +
 +bool ClashOfGptsCoordinator::IsShowing() const {
@@ -99,6 +119,7 @@ index 0000000000000..9e1c6dc9fe8a1
 +}
 +
 +void ClashOfGptsCoordinator::CycleProviderInPane(int pane_index) {
++  EnsureInitialized();
 +  if (pane_index < 0 || pane_index >= current_pane_count_) {
 +    return;
 +  }
@@ -128,28 +149,14 @@ index 0000000000000..9e1c6dc9fe8a1
 +  std::u16string page_title = active_contents->GetTitle();
 +  GURL page_url = active_contents->GetVisibleURL();
 +
-+  // Request accessibility tree snapshot (similar to the side panel implementation)
-+  active_contents->RequestAXTreeSnapshot(
-+      base::BindOnce([](std::u16string title, GURL url, ui::AXTreeUpdate& update) {
-+        // Extract text from accessibility tree
-+        std::u16string extracted_text;
-+        // TODO: Implement text extraction similar to third_party_llm_panel_coordinator.cc
-+        
-+        // Format the output for comparison across LLMs
-+        std::u16string formatted_output = u"----------- WEB PAGE CONTENT -----------\n\n";
-+        formatted_output += u"TITLE: " + title + u"\n\n";
-+        formatted_output += u"URL: " + base::UTF8ToUTF16(url.spec()) + u"\n\n";
-+        formatted_output += u"CONTENT:\n\n" + extracted_text;
-+        formatted_output += u"\n\n----------- USER PROMPT -----------\n\n";
-+
-+        // Copy to clipboard
-+        ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
-+        clipboard_writer.WriteText(formatted_output);
-+      }, page_title, page_url),
-+      ui::AXMode::kWebContents,
-+      0,  // max_nodes (0 = no limit)
-+      base::Seconds(5),  // timeout
-+      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants);
++  // Extract the page text once, off the UI thread, main content first
++  // (similar to the side panel implementation, which shares the extracted
++  // text for an unchanged page)
++  copy_request_ = std::make_unique<side_panel::BrowserOSPageTextRequest>(
++      tab_strip_model, side_panel::BrowserOSSimplePageExtractor::Budget{
++                           .max_tokens = kPageContentTokenBudget},
++      base::BindOnce(&ClashOfGptsCoordinator::OnPageContentExtracted,
++                     base::Unretained(this), page_title, page_url));
 +
 +  // Show feedback in the UI
 +  if (view_) {
@@ -157,6 +164,34 @@ index 0000000000000..9e1c6dc9fe8a1
 +  }
 +}
 +
++void ClashOfGptsCoordinator::OnPageContentExtracted(
++    std::u16string title,
++    GURL url,
++    std::u16string extracted_text) {
++  // Format the output for comparison across LLMs
++  std::u16string formatted_output = u"----------- WEB PAGE CONTENT -----------\n\n";
++  formatted_output += u"TITLE: " + title + u"\n\n";
++  formatted_output += u"URL: " + base::UTF8ToUTF16(url.spec()) + u"\n\n";
++  formatted_output += u"CONTENT:\n\n" + extracted_text;
++  formatted_output += u"\n\n----------- USER PROMPT -----------\n\n";
++
++  // Copy to clipboard, for panes whose prompt box could not be found
++  ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
++  clipboard_writer.WriteText(formatted_output);
++
++  // All panes get it at once; none waits for another to load
++  for (int i = 0; i < current_pane_count_; ++i) {
++    SendPromptToPane(i, formatted_output);
++  }
++}
++
++void ClashOfGptsCoordinator::SendPromptToPane(int pane_index,
++                                              const std::u16string& prompt) {
++  if (pane_observers_[pane_index]) {
++    pane_observers_[pane_index]->SendPrompt(prompt);
++  }
++}
++
 +std::vector<LlmProviderInfo> ClashOfGptsCoordinator::GetDefaultProviders() const {
 +  std::vector<LlmProviderInfo> defaults;
 +  defaults.push_back({u"ChatGPT", GURL("https://chatgpt.com")});
@@ -224,6 +259,7 @@ index 0000000000000..9e1c6dc9fe8a1
 +}
 +
 +void ClashOfGptsCoordinator::SetProviderForPane(int pane_index, size_t provider_index) {
++  EnsureInitialized();
 +  if (pane_index < 0 || pane_index >= current_pane_count_) {
 +    return;
 +  }
@@ -243,11 +279,17 @@ index 0000000000000..9e1c6dc9fe8a1
 +    }
 +  }
 +
++  GURL previous_provider_url;
++  if (pane_provider_indices_[pane_index] < providers_.size()) {
++    previous_provider_url = providers_[pane_provider_indices_[pane_index]].url;
++  }
++
 +  pane_provider_indices_[pane_index] = provider_index;
 +  SaveState();
 +
-+  // Navigate to the new provider URL
-+  if (view_) {
++  // Navigate to the new provider URL, unless a pooled WebContents already
++  // shows it where the user left it
++  if (view_ && !SwapPaneWebContents(pane_index, previous_provider_url)) {
 +    GURL provider_url;
 +    auto it = last_urls_.find({pane_index, provider_index});
 +    if (it != last_urls_.end() && it->second.is_valid()) {
@@ -260,6 +302,7 @@ index 0000000000000..9e1c6dc9fe8a1
 +}
 +
 +void ClashOfGptsCoordinator::SetPaneCount(int count) {
++  EnsureInitialized();
 +  if (count < kMinPanes || count > kMaxPanes || count == current_pane_count_) {
 +    return;
 +  }
@@ -337,10 +380,135 @@ index 0000000000000..9e1c6dc9fe8a1
 +void ClashOfGptsCoordinator::OnViewIsDeleting(views::View* observed_view) {
 +  if (observed_view == view_) {
 +    view_ = nullptr;
++    // Closed from the window's own close button
++    UpdatePaneLifecycle();
++    StartIdleDiscardTimer();
 +  }
 +  view_observation_.RemoveObservation(observed_view);
 +}
 +
++void ClashOfGptsCoordinator::OnWidgetVisibilityChanged(views::Widget* widget,
++                                                       bool visible) {
++  UpdatePaneLifecycle();
++}
++
++void ClashOfGptsCoordinator::OnWidgetShowStateChanged(views::Widget* widget) {
++  UpdatePaneLifecycle();
++}
++
++void ClashOfGptsCoordinator::OnWidgetDestroying(views::Widget* widget) {
++  widget_observation_.Reset();
++}
++
++void ClashOfGptsCoordinator::UpdatePaneLifecycle() {
++  const bool background =
++      !view_ || !widget_ || !widget_->IsVisible() || widget_->IsMinimized();
++  if (background == panes_hidden_) {
++    return;
++  }
++  panes_hidden_ = background;
++
++  if (background) {
++    for (auto& web_contents : owned_web_contents_) {
++      if (web_contents) {
++        web_contents->WasHidden();
++      }
++    }
++    freeze_timer_.Start(FROM_HERE, kPaneFreezeDelay,
++                        base::BindOnce(&ClashOfGptsCoordinator::SetPanesFrozen,
++                                       base::Unretained(this), true));
++    return;
++  }
++
++  SetPanesFrozen(false);
++  for (auto& web_contents : owned_web_contents_) {
++    if (web_contents) {
++      web_contents->WasShown();
++    }
++  }
++}
++
++void ClashOfGptsCoordinator::SetPanesFrozen(bool frozen) {
++  freeze_timer_.Stop();
++  if (frozen == panes_frozen_) {
++    return;
++  }
++  VLOG(1) << "[browseros] " << (frozen ? "Freezing" : "Unfreezing")
++          << " hidden Clash of GPTs panes";
++  for (auto& web_contents : owned_web_contents_) {
++    if (web_contents) {
++      web_contents->SetPageFrozen(frozen);
++    }
++  }
++  panes_frozen_ = frozen;
++}
++
++void ClashOfGptsCoordinator::EnsureInitialized() {
++  if (initialized_) {
++    return;
++  }
++  initialized_ = true;
++  web_contents_pool_ = std::make_unique<side_panel::BrowserOSWebContentsPool>(
++      GetBrowser().profile());
++
++  // Load shared provider list first
++  LoadProvidersFromPrefs();
++  LoadState();
++}
++
++void ClashOfGptsCoordinator::StartIdleDiscardTimer() {
++  const base::TimeDelta delay =
++      side_panel::BrowserOSWebContentsPool::GetIdleDiscardDelay(
++          GetBrowser().profile());
++  if (delay.is_zero()) {
++    return;
++  }
++  idle_discard_timer_.Start(
++      FROM_HERE, delay,
++      base::BindOnce(&ClashOfGptsCoordinator::DiscardIdleWebContents,
++                     base::Unretained(this)));
++}
++
++void ClashOfGptsCoordinator::DiscardIdleWebContents() {
++  // Reopened in the meantime; its panes still show these WebContents
++  if (view_) {
++    return;
++  }
++
++  LOG(INFO) << "[browseros] Discarding idle Clash of GPTs WebContents";
++  for (int i = 0; i < kMaxPanes; ++i) {
++    if (!owned_web_contents_[i]) {
++      continue;
++    }
++    GURL current_url = owned_web_contents_[i]->GetURL();
++    if (current_url.is_valid()) {
++      last_urls_[{i, pane_provider_indices_[i]}] = current_url;
++    }
++    pane_observers_[i].reset();
++    owned_web_contents_[i].reset();
++  }
++  if (web_contents_pool_) {
++    web_contents_pool_->Clear();
++  }
++  panes_frozen_ = false;
++  SaveState();
++}
++
++void ClashOfGptsCoordinator::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level,
++    base::OnceCallback<void(browseros::ReleasedMemory)> done) {
++  browseros::ReleasedMemory released;
++  if (!view_) {
++    released.items = std::ranges::count_if(
++        owned_web_contents_, [](const auto& contents) { return !!contents; });
++    if (released.items > 0) {
++      idle_discard_timer_.Stop();
++      DiscardIdleWebContents();
++    }
++  }
++  std::move(done).Run(released);
++}
++
 +void ClashOfGptsCoordinator::CreateWindowIfNeeded() {
 +  LOG(INFO) << "CreateWindowIfNeeded called, window_ = " << window_.get();
 +
@@ -380,6 +548,7 @@ index 0000000000000..9e1c6dc9fe8a1
 +    
 +    params.bounds = gfx::Rect(window_size);
 +    widget_->Init(std::move(params));
++    widget_observation_.Observe(widget_.get());
 +    
 +    // Let the window know about its widget
 +    window_->SetWidget(widget_.get());
@@ -401,6 +570,11 @@ index 0000000000000..9e1c6dc9fe8a1
 +}
 +
 +void ClashOfGptsCoordinator::SaveState() {
++  // Nothing was loaded, so there is nothing to save over the prefs
++  if (!initialized_) {
++    return;
++  }
++
 +  PrefService* prefs = GetBrowser().profile()->GetPrefs();
 +  if (!prefs) {
 +    return;
@@ -492,10 +666,42 @@ index 0000000000000..9e1c6dc9fe8a1
 +
 +ClashOfGptsCoordinator::PaneWebContentsObserver::~PaneWebContentsObserver() = default;
 +
++void ClashOfGptsCoordinator::PaneWebContentsObserver::SendPrompt(
++    std::u16string prompt) {
++  // Replaces a prompt still going in
++  prompt_inserter_.reset();
++  if (web_contents()->IsLoading()) {
++    pending_prompt_ = std::move(prompt);
++    return;
++  }
++  pending_prompt_.reset();
++  StartPromptInsertion(std::move(prompt));
++}
++
++void ClashOfGptsCoordinator::PaneWebContentsObserver::StartPromptInsertion(
++    std::u16string prompt) {
++  // Unretained: the inserter doesn't outlive the observer
++  prompt_inserter_ = std::make_unique<side_panel::BrowserOSPromptInserter>(
++      web_contents(), std::move(prompt),
++      base::BindOnce(&PaneWebContentsObserver::OnPromptInserted,
++                     base::Unretained(this)));
++}
++
++void ClashOfGptsCoordinator::PaneWebContentsObserver::OnPromptInserted(
++    side_panel::BrowserOSPromptInserter::Result result) {
++  if (result == side_panel::BrowserOSPromptInserter::Result::kAttached) {
++    browseros_metrics::BrowserOSMetrics::Log("llmhub.content.attached");
++  }
++  prompt_inserter_.reset();
++}
++
 +void ClashOfGptsCoordinator::PaneWebContentsObserver::DidFinishLoad(
 +    content::RenderFrameHost* render_frame_host,
 +    const GURL& validated_url) {
-+  // Nothing to do on page load
++  if (!pending_prompt_ || !render_frame_host->IsInPrimaryMainFrame()) {
++    return;
++  }
++  StartPromptInsertion(*std::exchange(pending_prompt_, std::nullopt));
 +}
 +
 +content::WebContents* ClashOfGptsCoordinator::GetOrCreateWebContentsForPane(int pane_index) {
@@ -518,6 +724,33 @@ index 0000000000000..9e1c6dc9fe8a1
 +  return owned_web_contents_[pane_index].get();
 +}
 +
++bool ClashOfGptsCoordinator::SwapPaneWebContents(
++    int pane_index,
++    const GURL& previous_provider_url) {
++  if (!owned_web_contents_[pane_index]) {
++    return false;
++  }
++
++  std::unique_ptr<content::WebContents> next_contents =
++      web_contents_pool_->Take(providers_[pane_provider_indices_[pane_index]].url);
++  const bool from_pool = !!next_contents;
++  if (!next_contents) {
++    content::WebContents::CreateParams params(GetBrowser().profile());
++    next_contents = content::WebContents::Create(params);
++  }
++  next_contents->SetDelegate(this);
++
++  pane_observers_[pane_index].reset();
++  std::unique_ptr<content::WebContents> previous_contents =
++      std::exchange(owned_web_contents_[pane_index], std::move(next_contents));
++  pane_observers_[pane_index] = std::make_unique<PaneWebContentsObserver>(
++      this, owned_web_contents_[pane_index].get());
++  view_->SetPaneWebContents(pane_index, owned_web_contents_[pane_index].get());
++  web_contents_pool_->Park(previous_provider_url, std::move(previous_contents));
++
++  return from_pool;
++}
++
 +void ClashOfGptsCoordinator::CleanupWebContents() {
 +  // Save any URLs before cleanup
 +  if (view_) {
@@ -539,6 +772,10 @@ index 0000000000000..9e1c6dc9fe8a1
 +    // Then destroy the WebContents
 +    owned_web_contents_[i].reset();
 +  }
++  if (web_contents_pool_) {
++    web_contents_pool_->Clear();
++  }
++  idle_discard_timer_.Stop();
 +
 +  // Remove view observation before widget cleanup
 +  if (view_) {
@@ -546,7 +783,10 @@ index 0000000000000..9e1c6dc9fe8a1
 +    view_ = nullptr;
 +  }
 +
++  freeze_timer_.Stop();
++
 +  // Close the window if it exists
++  widget_observation_.Reset();
 +  if (widget_ && !widget_->IsClosed()) {
 +    widget_->CloseNow();
 +  }
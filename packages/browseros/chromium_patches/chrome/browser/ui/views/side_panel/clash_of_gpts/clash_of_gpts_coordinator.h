@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h
 new file mode 100644
-index 0000000000000..80c7895b1e08b
+index 0000000000000..7526b488f793c
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h
-@@ -0,0 +1,214 @@
+@@ -0,0 +1,294 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,15 +14,22 @@ index 0000000000000..80c7895b1e08b
 +#include <array>
 +#include <map>
 +#include <memory>
++#include <optional>
 +#include <string>
 +#include <vector>
 +
++#include "base/functional/callback_helpers.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/scoped_multi_source_observation.h"
 +#include "base/scoped_observation.h"
++#include "base/timer/timer.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
 +#include "chrome/browser/ui/browser_list_observer.h"
 +#include "chrome/browser/profiles/profile_observer.h"
++#include "chrome/browser/ui/views/side_panel/browseros_page_text_request.h"
++#include "chrome/browser/ui/views/side_panel/browseros_prompt_inserter.h"
++#include "chrome/browser/ui/views/side_panel/browseros_web_contents_pool.h"
 +#include "content/public/browser/web_contents_delegate.h"
 +#include "content/public/browser/web_contents_observer.h"
 +#include "third_party/blink/public/mojom/window_features/window_features.mojom-forward.h"
@@ -30,6 +37,7 @@ index 0000000000000..80c7895b1e08b
 +#include "ui/views/controls/webview/unhandled_keyboard_event_handler.h"
 +#include "ui/views/view_observer.h"
 +#include "ui/views/widget/widget.h"
++#include "ui/views/widget/widget_observer.h"
 +#include "url/gurl.h"
 +
 +class Browser;
@@ -63,7 +71,8 @@ index 0000000000000..80c7895b1e08b
 +class ClashOfGptsCoordinator : public BrowserListObserver,
 +                                public ProfileObserver,
 +                                public content::WebContentsDelegate,
-+                                public views::ViewObserver {
++                                public views::ViewObserver,
++                                public views::WidgetObserver {
 + public:
 +  // Configuration constants
 +  static constexpr int kMinPanes = 1;
@@ -85,7 +94,9 @@ index 0000000000000..80c7895b1e08b
 +  // Cycles to the next provider for a specific pane
 +  void CycleProviderInPane(int pane_index);
 +
-+  // Copies content from active tab to all panes
++  // Extracts the active tab's content once, copies it to the clipboard and
++  // pastes it into the prompt box of every pane at the same time. A pane
++  // still loading gets it as soon as its own load finishes.
 +  void CopyContentToAll();
 +
 +  // Gets the current provider index for a pane
@@ -127,6 +138,11 @@ index 0000000000000..80c7895b1e08b
 +  // views::ViewObserver:
 +  void OnViewIsDeleting(views::View* observed_view) override;
 +
++  // views::WidgetObserver:
++  void OnWidgetVisibilityChanged(views::Widget* widget, bool visible) override;
++  void OnWidgetShowStateChanged(views::Widget* widget) override;
++  void OnWidgetDestroying(views::Widget* widget) override;
++
 +  // BrowserListObserver:
 +  void OnBrowserRemoved(Browser* browser) override;
 +
@@ -139,9 +155,29 @@ index 0000000000000..80c7895b1e08b
 + private:
 +  friend class ClashOfGptsView;
 +
++  // Loads providers and saved state and creates |web_contents_pool_| on
++  // first use, so windows that never open Clash of GPTs do no work
++  void EnsureInitialized();
++
 +  // Creates the window if it doesn't exist
 +  void CreateWindowIfNeeded();
 +
++  // Destroys the pane WebContents once the window has been closed for the
++  // pref'd delay; they are recreated the next time it is shown
++  void StartIdleDiscardTimer();
++  void DiscardIdleWebContents();
++
++  // Discards the pane WebContents right away if the window is closed
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(browseros::ReleasedMemory)> done);
++
++  // Hides the pane WebContents while the window is hidden or minimized and
++  // freezes them if it stays that way, so background provider apps stop
++  // running timers and scripts. Shows and unfreezes them again otherwise.
++  void UpdatePaneLifecycle();
++  void SetPanesFrozen(bool frozen);
++
 +  // Saves the current state to preferences
 +  void SaveState();
 +
@@ -155,6 +191,19 @@ index 0000000000000..80c7895b1e08b
 +  // Clean up WebContents early to avoid shutdown crashes
 +  void CleanupWebContents();
 +
++  // Parks the pane's previous provider WebContents in |web_contents_pool_|
++  // and shows the pane provider's pooled one, or a new one. Returns true if
++  // the shown WebContents came from the pool and needs no navigation.
++  bool SwapPaneWebContents(int pane_index, const GURL& previous_provider_url);
++
++  // Fans the extracted page out to the clipboard and all panes
++  void OnPageContentExtracted(std::u16string title,
++                              GURL url,
++                              std::u16string extracted_text);
++
++  // Pastes |prompt| into the pane's prompt box, now or once it has loaded
++  void SendPromptToPane(int pane_index, const std::u16string& prompt);
++
 +  // WebContents observer for a specific pane
 +  class PaneWebContentsObserver : public content::WebContentsObserver {
 +   public:
@@ -162,12 +211,22 @@ index 0000000000000..80c7895b1e08b
 +                           content::WebContents* web_contents);
 +    ~PaneWebContentsObserver() override;
 +
++    // Pastes |prompt| into the pane's prompt box, now or once the current
++    // load finishes, replacing a prompt still going in
++    void SendPrompt(std::u16string prompt);
++
 +    // content::WebContentsObserver:
 +    void DidFinishLoad(content::RenderFrameHost* render_frame_host,
 +                       const GURL& validated_url) override;
 +
 +   private:
++    void StartPromptInsertion(std::u16string prompt);
++    void OnPromptInserted(side_panel::BrowserOSPromptInserter::Result result);
++
 +    raw_ptr<ClashOfGptsCoordinator> coordinator_;
++    std::optional<std::u16string> pending_prompt_;
++    // Large prompts go in over several tasks
++    std::unique_ptr<side_panel::BrowserOSPromptInserter> prompt_inserter_;
 +  };
 +
 +  // Shared provider list (loaded from preferences)
@@ -182,6 +241,22 @@ index 0000000000000..80c7895b1e08b
 +  // Last URLs for each provider in each pane (pane_index, provider_index)
 +  std::map<std::pair<int, size_t>, GURL> last_urls_;
 +
++  // Set once EnsureInitialized() has loaded the prefs
++  bool initialized_ = false;
++
++  // Hidden WebContents of providers recently switched away from
++  std::unique_ptr<side_panel::BrowserOSWebContentsPool> web_contents_pool_;
++
++  // Runs DiscardIdleWebContents() while the window is closed
++  base::OneShotTimer idle_discard_timer_;
++
++  base::ScopedClosureRunner memory_pressure_registration_;
++
++  // Runs SetPanesFrozen(true) while the window is hidden or minimized
++  base::OneShotTimer freeze_timer_;
++  bool panes_frozen_ = false;
++  bool panes_hidden_ = false;
++
 +  // The window (delegate) containing the UI
 +  std::unique_ptr<ClashOfGptsWindow> window_;
 +  
@@ -201,6 +276,8 @@ index 0000000000000..80c7895b1e08b
 +  // Observe lifetime of UI views
 +  base::ScopedMultiSourceObservation<views::View, views::ViewObserver>
 +      view_observation_{this};
++  base::ScopedObservation<views::Widget, views::WidgetObserver>
++      widget_observation_{this};
 +
 +  // Observer registrations for early cleanup notifications
 +  base::ScopedObservation<BrowserList, BrowserListObserver>
@@ -213,6 +290,9 @@ index 0000000000000..80c7895b1e08b
 +  // Handler for unhandled keyboard events
 +  views::UnhandledKeyboardEventHandler unhandled_keyboard_event_handler_;
 +
++  // In-flight page text extraction for CopyContentToAll
++  std::unique_ptr<side_panel::BrowserOSPageTextRequest> copy_request_;
++
 +  // Weak pointer factory for callbacks
 +  base::WeakPtrFactory<ClashOfGptsCoordinator> weak_factory_{this};
 +};
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc
 new file mode 100644
-index 0000000000000..24eefea8b8860
+index 0000000000000..5b9a3a6d79472
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc
-@@ -0,0 +1,474 @@
+@@ -0,0 +1,483 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -218,6 +218,15 @@ index 0000000000000..24eefea8b8860
 +  }
 +}
 +
++void ClashOfGptsView::SetPaneWebContents(int pane_index,
++                                         content::WebContents* web_contents) {
++  if (pane_index < 0 || pane_index >= static_cast<int>(panes_.size()) ||
++      !panes_[pane_index].web_view) {
++    return;
++  }
++  panes_[pane_index].web_view->SetWebContents(web_contents);
++}
++
 +void ClashOfGptsView::ShowCopyFeedback() {
 +  if (copy_feedback_label_) {
 +    copy_feedback_label_->SetText(u"Content copied to clipboard");
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h
 new file mode 100644
-index 0000000000000..e9bc398177fe3
+index 0000000000000..34e9dc0391a45
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h
-@@ -0,0 +1,112 @@
+@@ -0,0 +1,115 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -52,6 +52,9 @@ index 0000000000000..e9bc398177fe3
 +  // Navigates a specific pane to a URL
 +  void NavigatePaneToUrl(int pane_index, const GURL& url);
 +
++  // Shows |web_contents| in a specific pane (the coordinator owns it)
++  void SetPaneWebContents(int pane_index, content::WebContents* web_contents);
++
 +  // Shows copy feedback message
 +  void ShowCopyFeedback();
 +
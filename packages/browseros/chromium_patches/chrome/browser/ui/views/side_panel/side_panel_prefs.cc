@@ -2,16 +2,17 @@ diff --git a/chrome/browser/ui/views/side_panel/side_panel_prefs.cc b/chrome/bro
 index 2c6ba6c527498..46424babda9e1 100644
 --- a/chrome/browser/ui/views/side_panel/side_panel_prefs.cc
 +++ b/chrome/browser/ui/views/side_panel/side_panel_prefs.cc
-@@ -7,6 +7,8 @@
+@@ -7,6 +7,9 @@
  #include "base/feature_list.h"
  #include "base/i18n/rtl.h"
  #include "chrome/browser/ui/ui_features.h"
++#include "chrome/browser/ui/views/side_panel/browseros_web_contents_pool.h"
 +#include "chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h"
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h"
  #include "chrome/common/pref_names.h"
  #include "components/pref_registry/pref_registry_syncable.h"
  #include "components/prefs/pref_registry_simple.h"
-@@ -22,6 +24,16 @@ void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry) {
+@@ -22,6 +25,19 @@ void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry) {
                                  !base::i18n::IsRTL());
    registry->RegisterBooleanPref(prefs::kGoogleSearchSidePanelEnabled, true);
    registry->RegisterDictionaryPref(prefs::kSidePanelIdToWidth);
@@ -25,6 +26,9 @@ index 2c6ba6c527498..46424babda9e1 100644
 +  if (base::FeatureList::IsEnabled(features::kClashOfGpts)) {
 +    ClashOfGptsCoordinator::RegisterProfilePrefs(registry);
 +  }
++
++  // Shared by both LLM panels, which may be enabled independently
++  side_panel::BrowserOSWebContentsPool::RegisterProfilePrefs(registry);
  }
  
  }  // namespace side_panel_prefs
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc
 new file mode 100644
-index 0000000000000..ea3e4207ee029
+index 0000000000000..2aafe7fe26031
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc
-@@ -0,0 +1,1187 @@
+@@ -0,0 +1,1264 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,6 +11,7 @@ index 0000000000000..ea3e4207ee029
 +#include "chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h"
 +
 +#include <memory>
++#include <utility>
 +#include <vector>
 +
 +#include "base/check.h"
@@ -76,6 +77,7 @@ index 0000000000000..ea3e4207ee029
 +#include "third_party/blink/public/common/mediastream/media_stream_request.h"
 +#include "content/public/browser/render_frame_host.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.h"
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h"
 +
 +namespace {
@@ -84,6 +86,9 @@ index 0000000000000..ea3e4207ee029
 +const char kThirdPartyLlmProvidersPref[] = "browseros.third_party_llm.providers";
 +const char kThirdPartyLlmSelectedProviderPref[] = "browseros.third_party_llm.selected_provider";
 +
++// Keeps copied page content within typical provider context limits
++constexpr size_t kPageContentTokenBudget = 50000;
++
 +bool IsRestorableProviderUrl(const GURL& url) {
 +  return url.is_valid() && url.SchemeIsHTTPOrHTTPS();
 +}
@@ -122,9 +127,13 @@ index 0000000000000..ea3e4207ee029
 +  // Register for early cleanup notifications
 +  browser_list_observation_.Observe(BrowserList::GetInstance());
 +  profile_observation_.Observe(&profile_.get());
++  memory_pressure_registration_ = browseros::AddMemoryPressureHandler(
++      "llm_panel",
++      base::BindRepeating(&ThirdPartyLlmPanelCoordinator::OnMemoryPressure,
++                          base::Unretained(this)));
 +
-+  // Load providers from preferences
-+  LoadProvidersFromPrefs();
++  // Providers are loaded when the panel is first opened, so windows that
++  // never open it do no work here
 +}
 +
 +ThirdPartyLlmPanelCoordinator::~ThirdPartyLlmPanelCoordinator() {
@@ -162,8 +171,9 @@ index 0000000000000..ea3e4207ee029
 +  LoadProvidersFromPrefs();
 +
 +  // If provider list size changed, reset to first provider for safety
-+  // This handles providers being added/removed while panel was closed
-+  if (providers_.size() != previous_size) {
++  // This handles providers being added/removed while panel was closed. On
++  // first open there is no previous list and the saved selection stands.
++  if (previous_size != 0 && providers_.size() != previous_size) {
 +    LOG(INFO) << "[browseros] Provider list size changed from " << previous_size
 +              << " to " << providers_.size() << ", resetting to first provider";
 +    current_provider_index_ = 0;
@@ -176,6 +186,7 @@ index 0000000000000..ea3e4207ee029
 +  if (feedback_timer_ && feedback_timer_->IsRunning()) {
 +    feedback_timer_->Stop();
 +  }
++  idle_discard_timer_.Stop();
 +
 +  // Reset UI pointers when creating new view
 +  web_view_ = nullptr;
@@ -361,6 +372,8 @@ index 0000000000000..ea3e4207ee029
 +  // Observe the WebContents
 +  Observe(owned_web_contents_.get());
 +
++  PrewarmNextProvider();
++
 +  // Enable focus for the WebView to handle keyboard events properly
 +  web_view_->SetFocusBehavior(views::View::FocusBehavior::ALWAYS);
 +
@@ -522,6 +535,11 @@ index 0000000000000..ea3e4207ee029
 +    }
 +  }
 +
++  GURL previous_provider_url;
++  if (current_provider_index_ < providers_.size()) {
++    previous_provider_url = providers_[current_provider_index_].url;
++  }
++
 +  current_provider_index_ = new_provider_index;
 +
 +  // Persist preference.
@@ -529,24 +547,122 @@ index 0000000000000..ea3e4207ee029
 +    prefs->SetInteger(kThirdPartyLlmSelectedProviderPref, static_cast<int>(current_provider_index_));
 +  }
 +
-+  // Determine URL to load.
-+  GURL provider_url;
-+  auto it = last_urls_.find(current_provider_index_);
-+  if (it != last_urls_.end()) {
-+    if (IsRestorableProviderUrl(it->second)) {
-+      provider_url = it->second;
-+    }
++  // A pooled WebContents already shows the provider where the user left it
++  if (!SwapProviderWebContents(previous_provider_url) && owned_web_contents_) {
++    owned_web_contents_->GetController().LoadURL(
++        GetProviderStartUrl(current_provider_index_), content::Referrer(),
++        ui::PAGE_TRANSITION_AUTO_TOPLEVEL, std::string());
 +  }
-+  if (!provider_url.is_valid()) {
-+    provider_url = providers_[current_provider_index_].url;
++
++  PrewarmNextProvider();
++
++  provider_change_in_progress_ = false;
++}
++
++bool ThirdPartyLlmPanelCoordinator::SwapProviderWebContents(
++    const GURL& previous_provider_url) {
++  // Without a WebView the single WebContents is just navigated
++  if (!web_view_ || !owned_web_contents_) {
++    return false;
 +  }
 +
-+  if (owned_web_contents_) {
-+    owned_web_contents_->GetController().LoadURL(
-+        provider_url, content::Referrer(), ui::PAGE_TRANSITION_AUTO_TOPLEVEL, std::string());
++  // The text was meant for the provider going away
++  prompt_inserter_.reset();
++  std::unique_ptr<content::WebContents> next_contents =
++      GetWebContentsPool().Take(providers_[current_provider_index_].url);
++  const bool from_pool = !!next_contents;
++  if (!next_contents) {
++    content::WebContents::CreateParams params(GetProfile());
++    next_contents = content::WebContents::Create(params);
 +  }
++  next_contents->SetDelegate(this);
 +
-+  provider_change_in_progress_ = false;
++  std::unique_ptr<content::WebContents> previous_contents =
++      std::exchange(owned_web_contents_, std::move(next_contents));
++  web_view_->SetWebContents(owned_web_contents_.get());
++  Observe(owned_web_contents_.get());
++  GetWebContentsPool().Park(previous_provider_url,
++                            std::move(previous_contents));
++
++  return from_pool;
++}
++
++GURL ThirdPartyLlmPanelCoordinator::GetProviderStartUrl(
++    size_t provider_index) const {
++  auto it = last_urls_.find(provider_index);
++  if (it != last_urls_.end() && IsRestorableProviderUrl(it->second)) {
++    return it->second;
++  }
++  return providers_[provider_index].url;
++}
++
++void ThirdPartyLlmPanelCoordinator::PrewarmNextProvider() {
++  if (providers_.size() < 2 || current_provider_index_ >= providers_.size()) {
++    return;
++  }
++  size_t next_index = (current_provider_index_ + 1) % providers_.size();
++  GetWebContentsPool().Prewarm(providers_[next_index].url,
++                               GetProviderStartUrl(next_index));
++}
++
++side_panel::BrowserOSWebContentsPool&
++ThirdPartyLlmPanelCoordinator::GetWebContentsPool() {
++  if (!web_contents_pool_) {
++    web_contents_pool_ =
++        std::make_unique<side_panel::BrowserOSWebContentsPool>(GetProfile());
++  }
++  return *web_contents_pool_;
++}
++
++void ThirdPartyLlmPanelCoordinator::DiscardIdleWebContents() {
++  if (!owned_web_contents_) {
++    return;
++  }
++
++  LOG(INFO) << "[browseros] Discarding idle LLM panel WebContents";
++  GURL current_url = owned_web_contents_->GetURL();
++  if (IsRestorableProviderUrl(current_url)) {
++    last_urls_[current_provider_index_] = current_url;
++  }
++
++  if (web_view_) {
++    web_view_->SetWebContents(nullptr);
++  }
++  Observe(nullptr);
++  owned_web_contents_.reset();
++  if (web_contents_pool_) {
++    web_contents_pool_->Clear();
++  }
++}
++
++void ThirdPartyLlmPanelCoordinator::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level,
++    base::OnceCallback<void(browseros::ReleasedMemory)> done) {
++  browseros::ReleasedMemory released;
++  // Like the idle timer, only touches a panel that isn't showing
++  if (owned_web_contents_ && (!web_view_ || !web_view_->GetWidget())) {
++    idle_discard_timer_.Stop();
++    DiscardIdleWebContents();
++    released.items = 1;
++  }
++  std::move(done).Run(released);
++}
++
++void ThirdPartyLlmPanelCoordinator::RestoreDiscardedWebContents() {
++  if (owned_web_contents_ || !web_view_ ||
++      current_provider_index_ >= providers_.size()) {
++    return;
++  }
++
++  content::WebContents::CreateParams params(GetProfile());
++  owned_web_contents_ = content::WebContents::Create(params);
++  owned_web_contents_->SetDelegate(this);
++  owned_web_contents_->GetController().LoadURL(
++      GetProviderStartUrl(current_provider_index_), content::Referrer(),
++      ui::PAGE_TRANSITION_AUTO_TOPLEVEL, std::string());
++  web_view_->SetWebContents(owned_web_contents_.get());
++  Observe(owned_web_contents_.get());
++  PrewarmNextProvider();
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::OnRefreshContent() {
@@ -607,14 +723,13 @@ index 0000000000000..ea3e4207ee029
 +  page_title_ = active_contents->GetTitle();
 +  page_url_ = active_contents->GetVisibleURL();
 +  
-+  // Request accessibility tree snapshot
-+  active_contents->RequestAXTreeSnapshot(
-+      base::BindOnce(&ThirdPartyLlmPanelCoordinator::OnAccessibilityTreeReceived,
-+                     weak_factory_.GetWeakPtr()),
-+      ui::AXMode::kWebContents,  // Request web contents mode
-+      0,  // max_nodes (0 = no limit)
-+      base::Seconds(5),  // timeout
-+      content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants);
++  // Extract the page text off the UI thread, main content first. Replacing
++  // an earlier request cancels it.
++  copy_request_ = std::make_unique<side_panel::BrowserOSPageTextRequest>(
++      tab_strip_model, side_panel::BrowserOSSimplePageExtractor::Budget{
++                           .max_tokens = kPageContentTokenBudget},
++      base::BindOnce(&ThirdPartyLlmPanelCoordinator::OnPageTextExtracted,
++                     weak_factory_.GetWeakPtr()));
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::OnScreenshotContent() {
@@ -693,33 +808,9 @@ index 0000000000000..ea3e4207ee029
 +  }
 +}
 +
-+void ThirdPartyLlmPanelCoordinator::OnAccessibilityTreeReceived(
-+    ui::AXTreeUpdate& update) {
-+  // Build a map of node IDs to node data for easy lookup
-+  std::map<ui::AXNodeID, const ui::AXNodeData*> node_map;
-+  for (const auto& node_data : update.nodes) {
-+    node_map[node_data.id] = &node_data;
-+  }
-+  
-+  // Find the root node
-+  ui::AXNodeID root_id = update.root_id;
-+  if (node_map.find(root_id) == node_map.end()) {
-+    LOG(ERROR) << "Root node not found in tree update";
-+    return;
-+  }
-+  
-+  // Extract text from the accessibility tree recursively
-+  std::u16string extracted_text;
-+  ExtractTextFromNodeData(node_map[root_id], node_map, &extracted_text);
-+  
-+  // Clean up text - remove excessive whitespace
++void ThirdPartyLlmPanelCoordinator::OnPageTextExtracted(
++    std::u16string extracted_text) {
 +  if (!extracted_text.empty()) {
-+    // Simple cleanup of multiple spaces
-+    size_t pos = 0;
-+    while ((pos = extracted_text.find(u"  ", pos)) != std::u16string::npos) {
-+      extracted_text.replace(pos, 2, u" ");
-+    }
-+    
 +    // Format the final output
 +    std::u16string formatted_output = u"----------- WEB PAGE -----------\n\n";
 +    formatted_output += u"TITLE: " + page_title_ + u"\n\n";
@@ -727,31 +818,71 @@ index 0000000000000..ea3e4207ee029
 +    formatted_output += u"CONTENT:\n\n" + extracted_text;
 +    formatted_output += u" ------------------------------------\n\n";
 +    formatted_output += u"USER PROMPT:\n\n";
-+    
-+    // Copy to clipboard
-+    ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
-+    clipboard_writer.WriteText(formatted_output);
-+    
-+    browseros_metrics::BrowserOSMetrics::Log("llmchat.content.copied");
-+    
-+    // Show feedback message
-+    if (copy_feedback_label_) {
-+      copy_feedback_label_->SetText(u"Content copied to clipboard");
-+      copy_feedback_label_->SetVisible(true);
-+
-+      // Cancel any existing timer
-+      if (feedback_timer_->IsRunning()) {
-+        feedback_timer_->Stop();
-+      }
 +
-+      // Start timer to hide message after 2.5 seconds
-+      feedback_timer_->Start(FROM_HERE, base::Seconds(2.5),
-+          base::BindOnce(&ThirdPartyLlmPanelCoordinator::HideFeedbackLabel,
-+                         weak_factory_.GetWeakPtr()));
++    // Pasting a large page freezes provider editors, so it goes into the
++    // provider page in chunks, or as a file where the page takes uploads
++    if (formatted_output.size() > side_panel::kMaxDirectPromptSize &&
++        owned_web_contents_) {
++      ShowFeedback(u"Adding page to chat...");
++      std::u16string prompt = formatted_output;
++      // Unretained: |this| owns the inserter
++      prompt_inserter_ = std::make_unique<side_panel::BrowserOSPromptInserter>(
++          owned_web_contents_.get(), std::move(prompt),
++          base::BindOnce(&ThirdPartyLlmPanelCoordinator::OnPromptInserted,
++                         base::Unretained(this), std::move(formatted_output)));
++      return;
 +    }
++    CopyPromptToClipboard(formatted_output);
 +  }
 +}
 +
++void ThirdPartyLlmPanelCoordinator::CopyPromptToClipboard(
++    const std::u16string& prompt) {
++  ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
++  clipboard_writer.WriteText(prompt);
++
++  browseros_metrics::BrowserOSMetrics::Log("llmchat.content.copied");
++  ShowFeedback(u"Content copied to clipboard");
++}
++
++void ThirdPartyLlmPanelCoordinator::OnPromptInserted(
++    std::u16string prompt,
++    side_panel::BrowserOSPromptInserter::Result result) {
++  prompt_inserter_.reset();
++  switch (result) {
++    case side_panel::BrowserOSPromptInserter::Result::kInserted:
++      browseros_metrics::BrowserOSMetrics::Log("llmchat.content.inserted");
++      ShowFeedback(u"Content added to chat");
++      break;
++    case side_panel::BrowserOSPromptInserter::Result::kAttached:
++      browseros_metrics::BrowserOSMetrics::Log("llmchat.content.attached");
++      ShowFeedback(u"Page attached as file");
++      break;
++    case side_panel::BrowserOSPromptInserter::Result::kNoTarget:
++    case side_panel::BrowserOSPromptInserter::Result::kInterrupted:
++      CopyPromptToClipboard(prompt);
++      break;
++  }
++}
++
++void ThirdPartyLlmPanelCoordinator::ShowFeedback(const std::u16string& text) {
++  if (!copy_feedback_label_) {
++    return;
++  }
++  copy_feedback_label_->SetText(text);
++  copy_feedback_label_->SetVisible(true);
++
++  // Cancel any existing timer
++  if (feedback_timer_->IsRunning()) {
++    feedback_timer_->Stop();
++  }
++
++  // Start timer to hide message after 2.5 seconds
++  feedback_timer_->Start(FROM_HERE, base::Seconds(2.5),
++      base::BindOnce(&ThirdPartyLlmPanelCoordinator::HideFeedbackLabel,
++                     weak_factory_.GetWeakPtr()));
++}
++
 +void ThirdPartyLlmPanelCoordinator::HideFeedbackLabel() {
 +  // The timer may fire after the UI element has been destroyed (e.g. the side
 +  // panel was closed). Guard against use-after-free by checking that the raw
@@ -793,92 +924,33 @@ index 0000000000000..ea3e4207ee029
 +  view_observation_.RemoveObservation(observed_view);
 +}
 +
-+
-+void ThirdPartyLlmPanelCoordinator::ExtractTextFromNodeData(
-+    const ui::AXNodeData* node,
-+    const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
-+    std::u16string* output) {
-+  if (!node || !output) {
++void ThirdPartyLlmPanelCoordinator::OnViewAddedToWidget(
++    views::View* observed_view) {
++  if (observed_view != web_view_) {
 +    return;
 +  }
-+  
-+  // Skip UI elements and navigation
-+  if (node->role == ax::mojom::Role::kButton ||
-+      node->role == ax::mojom::Role::kNavigation ||
-+      node->role == ax::mojom::Role::kBanner ||
-+      node->role == ax::mojom::Role::kComplementary ||
-+      node->role == ax::mojom::Role::kContentInfo ||
-+      node->role == ax::mojom::Role::kForm ||
-+      node->role == ax::mojom::Role::kSearch ||
-+      node->role == ax::mojom::Role::kMenu ||
-+      node->role == ax::mojom::Role::kMenuBar ||
-+      node->role == ax::mojom::Role::kMenuItem ||
-+      node->role == ax::mojom::Role::kToolbar) {
-+    // For these elements, still traverse children but don't extract their text
-+    for (ui::AXNodeID child_id : node->child_ids) {
-+      auto it = node_map.find(child_id);
-+      if (it != node_map.end()) {
-+        ExtractTextFromNodeData(it->second, node_map, output);
-+      }
-+    }
++  idle_discard_timer_.Stop();
++  RestoreDiscardedWebContents();
++}
++
++void ThirdPartyLlmPanelCoordinator::OnViewRemovedFromWidget(
++    views::View* observed_view) {
++  // The side panel keeps the closed panel's view cached, WebContents and all
++  if (observed_view != web_view_ || !owned_web_contents_) {
 +    return;
 +  }
-+  
-+  // Check if this is a text-containing element
-+  bool is_text_element = (node->role == ax::mojom::Role::kStaticText ||
-+                         node->role == ax::mojom::Role::kInlineTextBox);
-+  
-+  // Extract text if this is a text element
-+  if (is_text_element) {
-+    std::u16string text;
-+    if (node->HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+      text = node->GetString16Attribute(ax::mojom::StringAttribute::kName);
-+    }
-+    
-+    if (text.empty() && node->HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
-+      text = node->GetString16Attribute(ax::mojom::StringAttribute::kValue);
-+    }
-+    
-+    if (!text.empty()) {
-+      // Add appropriate spacing
-+      if (!output->empty() && output->back() != ' ' && output->back() != '\n') {
-+        *output += u" ";
-+      }
-+      *output += text;
-+    }
-+  }
-+  
-+  // Handle line breaks
-+  if (node->role == ax::mojom::Role::kLineBreak) {
-+    *output += u"\n";
-+  }
-+  
-+  // Add paragraph breaks for block-level elements
-+  bool needs_paragraph_break = (node->role == ax::mojom::Role::kParagraph ||
-+                               node->role == ax::mojom::Role::kHeading ||
-+                               node->role == ax::mojom::Role::kListItem ||
-+                               node->role == ax::mojom::Role::kBlockquote ||
-+                               node->role == ax::mojom::Role::kArticle ||
-+                               node->role == ax::mojom::Role::kSection);
-+  
-+  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
-+    *output += u"\n\n";
-+  }
-+  
-+  // Recursively process children for all elements
-+  for (ui::AXNodeID child_id : node->child_ids) {
-+    auto it = node_map.find(child_id);
-+    if (it != node_map.end()) {
-+      ExtractTextFromNodeData(it->second, node_map, output);
-+    }
-+  }
-+  
-+  // Add paragraph break after block-level elements if they had content
-+  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
-+    *output += u"\n\n";
++  const base::TimeDelta delay =
++      side_panel::BrowserOSWebContentsPool::GetIdleDiscardDelay(GetProfile());
++  if (delay.is_zero()) {
++    return;
 +  }
++  idle_discard_timer_.Start(
++      FROM_HERE, delay,
++      base::BindOnce(&ThirdPartyLlmPanelCoordinator::DiscardIdleWebContents,
++                     base::Unretained(this)));
 +}
 +
++
 +bool ThirdPartyLlmPanelCoordinator::HandleKeyboardEvent(
 +    content::WebContents* source,
 +    const input::NativeWebKeyboardEvent& event) {
@@ -1063,14 +1135,19 @@ index 0000000000000..ea3e4207ee029
 +  if (feedback_timer_ && feedback_timer_->IsRunning()) {
 +    feedback_timer_->Stop();
 +  }
++  idle_discard_timer_.Stop();
++  prompt_inserter_.reset();
 +
 +  // Clear the WebView's association with WebContents
 +  if (web_view_ && web_view_->web_contents()) {
 +    web_view_->SetWebContents(nullptr);
 +  }
 +
-+  // Destroy the WebContents we own
++  // Destroy the WebContents we own, including pooled ones
 +  owned_web_contents_.reset();
++  if (web_contents_pool_) {
++    web_contents_pool_->Clear();
++  }
 +
 +  // Stop observing
 +  Observe(nullptr);
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h
 new file mode 100644
-index 0000000000000..ef7c13f156ea7
+index 0000000000000..5966e04f4e160
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h
-@@ -0,0 +1,237 @@
+@@ -0,0 +1,287 @@
 +// Copyright 2026 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,15 +12,21 @@ index 0000000000000..ef7c13f156ea7
 +#define CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_THIRD_PARTY_LLM_THIRD_PARTY_LLM_PANEL_COORDINATOR_H_
 +
 +#include <map>
++#include <memory>
 +#include <string>
 +
++#include "base/functional/callback_helpers.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/raw_ref.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/scoped_multi_source_observation.h"
 +#include "base/scoped_observation.h"
 +#include "base/timer/timer.h"
++#include "chrome/browser/browseros/core/browseros_memory_pressure.h"
 +#include "chrome/browser/ui/browser_list_observer.h"
++#include "chrome/browser/ui/views/side_panel/browseros_page_text_request.h"
++#include "chrome/browser/ui/views/side_panel/browseros_prompt_inserter.h"
++#include "chrome/browser/ui/views/side_panel/browseros_web_contents_pool.h"
 +#include "chrome/browser/profiles/profile_observer.h"
 +#include "components/prefs/pref_change_registrar.h"
 +#include "content/public/browser/media_stream_request.h"
@@ -135,6 +141,8 @@ index 0000000000000..ef7c13f156ea7
 +
 +  // views::ViewObserver:
 +  void OnViewIsDeleting(views::View* observed_view) override;
++  void OnViewAddedToWidget(views::View* observed_view) override;
++  void OnViewRemovedFromWidget(views::View* observed_view) override;
 +
 +  // BrowserListObserver:
 +  void OnBrowserRemoved(Browser* browser) override;
@@ -164,12 +172,14 @@ index 0000000000000..ef7c13f156ea7
 +  void OnOpenInNewTab();
 +  void OnCopyContent();
 +  void OnScreenshotContent();
-+  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& update);
++  void OnPageTextExtracted(std::u16string extracted_text);
 +  void OnScreenshotCaptured(const gfx::Image& image);
-+  void ExtractTextFromNodeData(
-+      const ui::AXNodeData* node,
-+      const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
-+      std::u16string* output);
++  // Puts |prompt| on the clipboard for the user to paste
++  void CopyPromptToClipboard(const std::u16string& prompt);
++  // Copies |prompt| if the provider page didn't take it
++  void OnPromptInserted(std::u16string prompt,
++                        side_panel::BrowserOSPromptInserter::Result result);
++  void ShowFeedback(const std::u16string& text);
 +  void HideFeedbackLabel();
 +  void ShowOptionsMenu();
 +
@@ -183,6 +193,30 @@ index 0000000000000..ef7c13f156ea7
 +  // reentrancy.
 +  void DoProviderChange(size_t new_provider_index);
 +
++  // Parks the previous provider's WebContents in |web_contents_pool_| and
++  // shows the current provider's pooled one, or a new one. Returns true if
++  // the shown WebContents came from the pool and needs no navigation.
++  bool SwapProviderWebContents(const GURL& previous_provider_url);
++
++  // The URL a provider opens at: its last URL if restorable, else its home.
++  GURL GetProviderStartUrl(size_t provider_index) const;
++
++  // Prewarms the provider after the current one, the next one cycled to.
++  void PrewarmNextProvider();
++
++  // Creates |web_contents_pool_| on first use.
++  side_panel::BrowserOSWebContentsPool& GetWebContentsPool();
++
++  // Drops the WebContents of the closed panel once it has been idle for the
++  // pref'd delay, and brings the current provider back when it reopens.
++  void DiscardIdleWebContents();
++  void RestoreDiscardedWebContents();
++
++  // Discards the WebContents right away if the panel is closed
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level,
++      base::OnceCallback<void(browseros::ReleasedMemory)> done);
++
 +  // Clean up WebContents early to avoid shutdown crashes.
 +  void CleanupWebContents();
 +
@@ -203,8 +237,21 @@ index 0000000000000..ef7c13f156ea7
 +  // when we call SetWebContents with externally created WebContents
 +  std::unique_ptr<content::WebContents> owned_web_contents_;
 +
++  // Inserts page text too large to paste into |owned_web_contents_|.
++  // Declared after it, so it goes first and never sees it destroyed.
++  std::unique_ptr<side_panel::BrowserOSPromptInserter> prompt_inserter_;
++
 +  // Store the last URL for each provider to restore state
 +  std::map<size_t, GURL> last_urls_;
++
++  // Hidden WebContents of recently used and prewarmed providers, created
++  // when the panel is first opened
++  std::unique_ptr<side_panel::BrowserOSWebContentsPool> web_contents_pool_;
++
++  // Runs DiscardIdleWebContents() while the panel is closed
++  base::OneShotTimer idle_discard_timer_;
++
++  base::ScopedClosureRunner memory_pressure_registration_;
 +  
 +  // Timer for auto-hiding feedback messages
 +  std::unique_ptr<base::OneShotTimer> feedback_timer_;
@@ -212,6 +259,9 @@ index 0000000000000..ef7c13f156ea7
 +  // Temporary storage for page info during copy
 +  std::u16string page_title_;
 +  GURL page_url_;
++
++  // In-flight page text extraction for OnCopyContent
++  std::unique_ptr<side_panel::BrowserOSPageTextRequest> copy_request_;
 +  
 +  // Handler for unhandled keyboard events
 +  views::UnhandledKeyboardEventHandler unhandled_keyboard_event_handler_;
@@ -0,0 +1,268 @@
+diff --git a/chrome/browser/ui/webui/browseros_internals/browseros_internals_ui.cc b/chrome/browser/ui/webui/browseros_internals/browseros_internals_ui.cc
+new file mode 100644
+index 0000000000000..164de875e8a10
+--- /dev/null
++++ b/chrome/browser/ui/webui/browseros_internals/browseros_internals_ui.cc
+@@ -0,0 +1,262 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/ui/webui/browseros_internals/browseros_internals_ui.h"
++
++#include <memory>
++#include <string>
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/json/json_writer.h"
++#include "base/memory/ref_counted_memory.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++#include "chrome/common/webui_url_constants.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_ui.h"
++#include "content/public/browser/web_ui_data_source.h"
++#include "services/network/public/mojom/content_security_policy.mojom.h"
++
++namespace {
++
++constexpr char kDataPath[] = "data.json";
++
++constexpr const char kHtmlContent[] = R"(
++<!DOCTYPE html>
++<html>
++<head>
++  <meta charset="utf-8">
++  <title>BrowserOS Internals</title>
++  <style>
++    body {
++      font-family: system-ui, -apple-system, sans-serif;
++      font-size: 13px;
++      margin: 16px;
++      color: #202124;
++    }
++    h2 { font-size: 15px; margin: 20px 0 8px; }
++    table { border-collapse: collapse; width: 100%; }
++    th, td {
++      text-align: left;
++      padding: 3px 6px;
++      border-bottom: 1px solid #eee;
++      white-space: nowrap;
++    }
++    th { color: #5f6368; font-weight: 500; }
++    td.bar { width: 60%; }
++    .track { position: relative; height: 12px; }
++    .phase { position: absolute; top: 0; height: 12px; min-width: 1px; }
++    .failed td { color: #c5221f; }
++    .running td { font-style: italic; }
++    .legend span {
++      display: inline-block;
++      margin-right: 12px;
++    }
++    .legend i {
++      display: inline-block;
++      width: 10px;
++      height: 10px;
++      margin-right: 4px;
++      vertical-align: middle;
++    }
++    pre { background: #f8f9fa; padding: 8px; margin: 4px 0; }
++  </style>
++</head>
++<body>
++  <h2>Recent calls</h2>
++  <div class="legend" id="legend"></div>
++  <table>
++    <thead>
++      <tr><th>Function</th><th>Tab</th><th>Total</th><th>Phases</th></tr>
++    </thead>
++    <tbody id="calls"></tbody>
++  </table>
++  <h2>Average per phase</h2>
++  <table>
++    <thead>
++      <tr><th>Function</th><th>Phase</th><th>Calls</th><th>Mean</th>
++          <th>Max</th></tr>
++    </thead>
++    <tbody id="averages"></tbody>
++  </table>
++  <h2>Components</h2>
++  <div id="sources"></div>
++  <script>
++    const kColors = ['#1a73e8', '#e37400', '#188038', '#a142f4', '#d93025',
++                     '#12b5cb', '#f9ab00', '#5f6368'];
++    const phaseColors = new Map();
++
++    function colorFor(phase) {
++      if (!phaseColors.has(phase)) {
++        phaseColors.set(phase, kColors[phaseColors.size % kColors.length]);
++      }
++      return phaseColors.get(phase);
++    }
++
++    function ms(value) {
++      return value.toFixed(1) + ' ms';
++    }
++
++    function cell(row, text) {
++      const td = row.insertCell();
++      td.textContent = text;
++      return td;
++    }
++
++    function renderCalls(calls) {
++      // Newest on top, all on one time scale
++      const longest = Math.max(1, ...calls.map(call => call.totalMs));
++      const body = document.getElementById('calls');
++      body.replaceChildren();
++      for (const call of calls.slice().reverse()) {
++        const row = body.insertRow();
++        if (call.running) {
++          row.className = 'running';
++        } else if (!call.success) {
++          row.className = 'failed';
++        }
++        cell(row, call.function);
++        cell(row, call.tabId >= 0 ? call.tabId : '');
++        cell(row, ms(call.totalMs));
++        const bar = row.insertCell();
++        bar.className = 'bar';
++        const track = document.createElement('div');
++        track.className = 'track';
++        for (const phase of call.phases) {
++          const span = document.createElement('div');
++          span.className = 'phase';
++          span.style.left = (100 * phase.startMs / longest) + '%';
++          span.style.width = (100 * phase.durationMs / longest) + '%';
++          span.style.background = colorFor(phase.name);
++          span.title = phase.name + ': ' + ms(phase.durationMs);
++          track.appendChild(span);
++        }
++        bar.appendChild(track);
++      }
++
++      const legend = document.getElementById('legend');
++      legend.replaceChildren();
++      for (const [phase, color] of phaseColors) {
++        const item = document.createElement('span');
++        const swatch = document.createElement('i');
++        swatch.style.background = color;
++        item.append(swatch, phase);
++        legend.appendChild(item);
++      }
++    }
++
++    function renderAverages(calls) {
++      const totals = new Map();
++      for (const call of calls) {
++        if (call.running) {
++          continue;
++        }
++        for (const phase of call.phases) {
++          const key = call.function + '\n' + phase.name;
++          const total = totals.get(key) || {count: 0, sum: 0, max: 0};
++          total.count++;
++          total.sum += phase.durationMs;
++          total.max = Math.max(total.max, phase.durationMs);
++          totals.set(key, total);
++        }
++      }
++      const body = document.getElementById('averages');
++      body.replaceChildren();
++      for (const key of [...totals.keys()].sort()) {
++        const [func, phase] = key.split('\n');
++        const total = totals.get(key);
++        const row = body.insertRow();
++        cell(row, func);
++        cell(row, phase);
++        cell(row, total.count);
++        cell(row, ms(total.sum / total.count));
++        cell(row, ms(total.max));
++      }
++    }
++
++    function renderSources(sources) {
++      const container = document.getElementById('sources');
++      container.replaceChildren();
++      for (const component of Object.keys(sources).sort()) {
++        const title = document.createElement('h2');
++        title.textContent = component;
++        container.appendChild(title);
++        for (const report of sources[component]) {
++          const pre = document.createElement('pre');
++          pre.textContent = JSON.stringify(report, null, 2);
++          container.appendChild(pre);
++        }
++      }
++    }
++
++    async function refresh() {
++      try {
++        const response = await fetch('data.json', {cache: 'no-store'});
++        const profile = await response.json();
++        renderCalls(profile.calls);
++        renderAverages(profile.calls);
++        renderSources(profile.sources);
++      } finally {
++        setTimeout(refresh, 1000);
++      }
++    }
++
++    refresh();
++  </script>
++</body>
++</html>
++)";
++
++scoped_refptr<base::RefCountedMemory> ToBytes(const std::string& data) {
++  return base::MakeRefCounted<base::RefCountedBytes>(
++      std::vector<uint8_t>(data.begin(), data.end()));
++}
++
++void ServeProfile(content::WebUIDataSource::GotDataCallback callback,
++                  base::Value::Dict profile) {
++  std::move(callback).Run(ToBytes(base::WriteJson(profile).value_or("{}")));
++}
++
++}  // namespace
++
++BrowserOSInternalsUIConfig::BrowserOSInternalsUIConfig()
++    : content::WebUIConfig(content::kChromeUIScheme,
++                           chrome::kChromeUIBrowserOSInternalsHost) {}
++
++BrowserOSInternalsUIConfig::~BrowserOSInternalsUIConfig() = default;
++
++std::unique_ptr<content::WebUIController>
++BrowserOSInternalsUIConfig::CreateWebUIController(content::WebUI* web_ui,
++                                                  const GURL& url) {
++  return std::make_unique<BrowserOSInternalsUI>(web_ui);
++}
++
++BrowserOSInternalsUI::BrowserOSInternalsUI(content::WebUI* web_ui)
++    : content::WebUIController(web_ui) {
++  content::WebUIDataSource* source = content::WebUIDataSource::CreateAndAdd(
++      web_ui->GetWebContents()->GetBrowserContext(),
++      chrome::kChromeUIBrowserOSInternalsHost);
++
++  source->SetRequestFilter(
++      base::BindRepeating([](const std::string& path) {
++        return path.empty() || path == "/" || path == kDataPath;
++      }),
++      base::BindRepeating(
++          [](const std::string& path,
++             content::WebUIDataSource::GotDataCallback callback) {
++            if (path == kDataPath) {
++              browseros::CollectStepProfile(
++                  base::BindOnce(&ServeProfile, std::move(callback)));
++              return;
++            }
++            std::move(callback).Run(ToBytes(kHtmlContent));
++          }));
++
++  source->OverrideContentSecurityPolicy(
++      network::mojom::CSPDirectiveName::ScriptSrc,
++      "script-src 'self' 'unsafe-inline';");
++}
++
++BrowserOSInternalsUI::~BrowserOSInternalsUI() = default;
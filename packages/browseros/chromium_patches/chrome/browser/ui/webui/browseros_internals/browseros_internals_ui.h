@@ -0,0 +1,42 @@
+diff --git a/chrome/browser/ui/webui/browseros_internals/browseros_internals_ui.h b/chrome/browser/ui/webui/browseros_internals/browseros_internals_ui.h
+new file mode 100644
+index 0000000000000..27e4aae944b69
+--- /dev/null
++++ b/chrome/browser/ui/webui/browseros_internals/browseros_internals_ui.h
+@@ -0,0 +1,36 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_UI_WEBUI_BROWSEROS_INTERNALS_BROWSEROS_INTERNALS_UI_H_
++#define CHROME_BROWSER_UI_WEBUI_BROWSEROS_INTERNALS_BROWSEROS_INTERNALS_UI_H_
++
++#include "content/public/browser/web_ui_controller.h"
++#include "content/public/browser/webui_config.h"
++
++// WebUI config for chrome://browseros-internals
++class BrowserOSInternalsUIConfig : public content::WebUIConfig {
++ public:
++  BrowserOSInternalsUIConfig();
++  ~BrowserOSInternalsUIConfig() override;
++
++  // content::WebUIConfig:
++  std::unique_ptr<content::WebUIController> CreateWebUIController(
++      content::WebUI* web_ui,
++      const GURL& url) override;
++};
++
++// WebUI controller for chrome://browseros-internals. Shows where recent
++// browserOS calls spent their time, phase by phase, along with queue
++// depths, cache hit counts and store sizes. The page polls data.json, which
++// is the step profile from browseros::CollectStepProfile().
++class BrowserOSInternalsUI : public content::WebUIController {
++ public:
++  explicit BrowserOSInternalsUI(content::WebUI* web_ui);
++  ~BrowserOSInternalsUI() override;
++
++  BrowserOSInternalsUI(const BrowserOSInternalsUI&) = delete;
++  BrowserOSInternalsUI& operator=(const BrowserOSInternalsUI&) = delete;
++};
++
++#endif  // CHROME_BROWSER_UI_WEBUI_BROWSEROS_INTERNALS_BROWSEROS_INTERNALS_UI_H_
@@ -2,28 +2,57 @@ diff --git a/chrome/common/importer/importer_bridge.h b/chrome/common/importer/i
 index 1738a3baff3e4..5f62d61cc7d08 100644
 --- a/chrome/common/importer/importer_bridge.h
 +++ b/chrome/common/importer/importer_bridge.h
-@@ -17,6 +17,10 @@
+@@ -17,6 +17,11 @@
  class GURL;
  struct ImporterAutofillFormDataEntry;
  
 +namespace browseros_importer {
 +struct ImportedCookieEntry;
++struct ImportItemMetrics;
 +}  // namespace browseros_importer
 +
  namespace user_data_importer {
  struct ImportedBookmarkEntry;
  }  // namespace user_data_importer
-@@ -48,9 +52,14 @@ class ImporterBridge : public base::RefCountedThreadSafe<ImporterBridge> {
+@@ -48,9 +53,42 @@ class ImporterBridge : public base::RefCountedThreadSafe<ImporterBridge> {
    virtual void SetPasswordForm(
        const user_data_importer::ImportedPasswordForm& form) = 0;
  
++  // Imports many password forms at once, which the profile commits in a few
++  // store transactions instead of one per form. May be called repeatedly.
++  virtual void SetPasswordForms(
++      const std::vector<user_data_importer::ImportedPasswordForm>& forms) = 0;
++
++  // Imports one chunk of history; unlike SetHistoryItems(), it may be called
++  // repeatedly to stream a large history.
++  virtual void AddHistoryItems(
++      const std::vector<user_data_importer::ImporterURLRow>& rows,
++      user_data_importer::VisitSource visit_source) = 0;
++
++  // Imports a whole bookmark set like AddBookmarks(), but lays the folders
++  // out in memory first and adds them in a single bookmark model pass, so
++  // observers see one batch of changes however large the set is.
++  virtual void AddBookmarkTree(
++      const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks,
++      const std::u16string& first_folder_name) = 0;
++
 +  virtual void SetCookie(
 +      const browseros_importer::ImportedCookieEntry& cookie) = 0;
++
++  // Imports a whole profile's cookies; cheaper than SetCookie() per entry.
++  virtual void SetCookies(
++      const std::vector<browseros_importer::ImportedCookieEntry>& cookies) = 0;
 +
    virtual void SetAutofillFormData(
        const std::vector<ImporterAutofillFormDataEntry>& entries) = 0;
  
 +  virtual void SetExtensions(const std::vector<std::string>& extension_ids) = 0;
++
++  // Reports where |item|'s import spent its time; sent just before
++  // NotifyItemEnded() by importers that measure it.
++  virtual void NotifyItemMetrics(
++      user_data_importer::ImportItem item,
++      const browseros_importer::ImportItemMetrics& metrics) = 0;
 +
    // Notifies the coordinator that the import operation has begun.
    virtual void NotifyStarted() = 0;
@@ -2,20 +2,37 @@ diff --git a/chrome/common/importer/mock_importer_bridge.h b/chrome/common/impor
 index 9d91eac580b2f..23051e0887d0b 100644
 --- a/chrome/common/importer/mock_importer_bridge.h
 +++ b/chrome/common/importer/mock_importer_bridge.h
-@@ -10,6 +10,7 @@
+@@ -10,6 +10,8 @@
  
  #include "chrome/common/importer/importer_autofill_form_data_entry.h"
  #include "chrome/common/importer/importer_bridge.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_metrics.h"
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
  #include "testing/gmock/include/gmock/gmock.h"
  
-@@ -33,6 +34,8 @@ class MockImporterBridge : public ImporterBridge {
+@@ -33,6 +35,24 @@ class MockImporterBridge : public ImporterBridge {
                 void(const user_data_importer::ImportedPasswordForm&));
    MOCK_METHOD1(SetAutofillFormData,
                 void(const std::vector<ImporterAutofillFormDataEntry>&));
++  MOCK_METHOD1(
++      SetPasswordForms,
++      void(const std::vector<user_data_importer::ImportedPasswordForm>&));
++  MOCK_METHOD2(AddHistoryItems,
++               void(const std::vector<user_data_importer::ImporterURLRow>&,
++                    user_data_importer::VisitSource));
++  MOCK_METHOD2(
++      AddBookmarkTree,
++      void(const std::vector<user_data_importer::ImportedBookmarkEntry>&,
++           const std::u16string&));
 +  MOCK_METHOD1(SetCookie, void(const browseros_importer::ImportedCookieEntry&));
++  MOCK_METHOD1(
++      SetCookies,
++      void(const std::vector<browseros_importer::ImportedCookieEntry>&));
 +  MOCK_METHOD1(SetExtensions, void(const std::vector<std::string>&));
++  MOCK_METHOD2(NotifyItemMetrics,
++               void(user_data_importer::ImportItem,
++                    const browseros_importer::ImportItemMetrics&));
    MOCK_METHOD0(NotifyStarted, void());
    MOCK_METHOD1(NotifyItemStarted, void(user_data_importer::ImportItem));
    MOCK_METHOD1(NotifyItemEnded, void(user_data_importer::ImportItem));
@@ -12,7 +12,7 @@ index 1a4683393ff24..dc1e69f5fc57d 100644
  
  // Profile avatar and name
  inline constexpr char kProfileAvatarIndex[] = "profile.avatar_index";
-@@ -4302,6 +4305,17 @@ inline constexpr char kNonMilestoneUpdateToastVersion[] =
+@@ -4302,6 +4305,32 @@ inline constexpr char kNonMilestoneUpdateToastVersion[] =
      "toast.non_milestone_update_toast_version";
  #endif  // !BUILDFLAG(IS_ANDROID)
  
@@ -20,10 +20,25 @@ index 1a4683393ff24..dc1e69f5fc57d 100644
 +inline constexpr char kBrowserOSMetricsClientId[] =
 +    "browseros.metrics_client_id";
 +
++// List of BrowserOS metrics events not yet uploaded
++inline constexpr char kBrowserOSMetricsPendingEvents[] =
++    "browseros.metrics_pending_events";
++
 +// String containing the stable install ID for BrowserOS metrics (Local State)
 +inline constexpr char kBrowserOSMetricsInstallId[] =
 +    "browseros.metrics_install_id";
 +
++// BrowserOS daily usage report (Local State): when the last one was sent,
++// and the totals of the day so far
++inline constexpr char kBrowserOSDailyUsageLastFired[] =
++    "browseros.daily_usage.last_fired";
++inline constexpr char kBrowserOSDailyUsageActiveMinutes[] =
++    "browseros.daily_usage.active_minutes";
++inline constexpr char kBrowserOSDailyUsageMaxTabs[] =
++    "browseros.daily_usage.max_tabs";
++inline constexpr char kBrowserOSDailyUsageAgentCalls[] =
++    "browseros.daily_usage.agent_calls";
++
 +// NOTE: Other BrowserOS prefs have been moved to
 +// chrome/browser/browseros/core/browseros_prefs.h
 +
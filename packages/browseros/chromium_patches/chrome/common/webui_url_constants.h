@@ -10,10 +10,14 @@ index de9e7825e979e..fbe089c8bc7b6 100644
  inline constexpr char kChromeUIAboutURL[] = "chrome://about/";
  inline constexpr char kChromeUIAccessCodeCastHost[] = "access-code-cast";
  inline constexpr char kChromeUIAccessCodeCastURL[] =
-@@ -62,6 +63,8 @@ inline constexpr char kChromeUIBatchUploadURL[] = "chrome://batch-upload/";
+@@ -62,6 +63,12 @@ inline constexpr char kChromeUIBatchUploadURL[] = "chrome://batch-upload/";
  inline constexpr char kChromeUIBluetoothInternalsHost[] = "bluetooth-internals";
  inline constexpr char kChromeUIBookmarksHost[] = "bookmarks";
  inline constexpr char kChromeUIBookmarksURL[] = "chrome://bookmarks/";
++inline constexpr char kChromeUIBrowserOSInternalsHost[] =
++    "browseros-internals";
++inline constexpr char kChromeUIBrowserOSInternalsURL[] =
++    "chrome://browseros-internals/";
 +inline constexpr char kChromeUIClashOfGptsHost[] = "clash-of-gpts";
 +inline constexpr char kChromeUIClashOfGptsURL[] = "chrome://clash-of-gpts/";
  inline constexpr char kChromeUIBrowsingTopicsInternalsHost[] =
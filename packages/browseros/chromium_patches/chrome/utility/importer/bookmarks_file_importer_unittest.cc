@@ -2,25 +2,49 @@ diff --git a/chrome/utility/importer/bookmarks_file_importer_unittest.cc b/chrom
 index 01439138862f1..dac2ce83c6e1d 100644
 --- a/chrome/utility/importer/bookmarks_file_importer_unittest.cc
 +++ b/chrome/utility/importer/bookmarks_file_importer_unittest.cc
-@@ -16,6 +16,7 @@
+@@ -16,6 +16,8 @@
  #include "base/time/time.h"
  #include "chrome/common/importer/importer_autofill_form_data_entry.h"
  #include "chrome/common/importer/importer_bridge.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_metrics.h"
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
  #include "components/user_data_importer/common/importer_data_types.h"
  #include "testing/gmock/include/gmock/gmock.h"
-@@ -83,6 +84,14 @@ class MockImporterBridge : public ImporterBridge {
+@@ -83,6 +85,37 @@ class MockImporterBridge : public ImporterBridge {
                SetAutofillFormData,
                (const std::vector<ImporterAutofillFormDataEntry>&),
                (override));
 +  MOCK_METHOD(void,
++              SetPasswordForms,
++              (const std::vector<user_data_importer::ImportedPasswordForm>&),
++              (override));
++  MOCK_METHOD(void,
++              AddHistoryItems,
++              (const std::vector<user_data_importer::ImporterURLRow>&,
++               user_data_importer::VisitSource),
++              (override));
++  MOCK_METHOD(void,
++              AddBookmarkTree,
++              (const std::vector<user_data_importer::ImportedBookmarkEntry>&,
++               const std::u16string&),
++              (override));
++  MOCK_METHOD(void,
 +              SetCookie,
 +              (const browseros_importer::ImportedCookieEntry&),
 +              (override));
 +  MOCK_METHOD(void,
++              SetCookies,
++              (const std::vector<browseros_importer::ImportedCookieEntry>&),
++              (override));
++  MOCK_METHOD(void,
 +              SetExtensions,
 +              (const std::vector<std::string>&),
++              (override));
++  MOCK_METHOD(void,
++              NotifyItemMetrics,
++              (user_data_importer::ImportItem,
++               const browseros_importer::ImportItemMetrics&),
 +              (override));
  
   protected:
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_autofill_importer.cc b/chrome/utility/importer/browseros/chrome_autofill_importer.cc
 new file mode 100644
-index 0000000000000..3d1e95eaf3461
+index 0000000000000..40f1bd00c48ab
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_autofill_importer.cc
-@@ -0,0 +1,79 @@
+@@ -0,0 +1,80 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome autofill importer implementation
 +
@@ -40,7 +40,8 @@ index 0000000000000..3d1e95eaf3461
 +    }
 +  }
 +
-+  base::FilePath temp_path = CopyToTempFile(web_data_path);
++  base::FilePath temp_path = SnapshotDatabaseToTempFile(
++      web_data_path, IsSourceBrowserRunning(profile_path));
 +  if (temp_path.empty()) {
 +    return entries;
 +  }
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_bookmarks_importer.cc b/chrome/utility/importer/browseros/chrome_bookmarks_importer.cc
 new file mode 100644
-index 0000000000000..6896bb7ab0f7c
+index 0000000000000..ad436dacb3e43
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_bookmarks_importer.cc
-@@ -0,0 +1,249 @@
+@@ -0,0 +1,288 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome bookmarks importer implementation
 +
@@ -19,8 +19,10 @@ index 0000000000000..6896bb7ab0f7c
 +#include "base/strings/utf_string_conversions.h"
 +#include "chrome/utility/importer/browseros/chrome_importer_utils.h"
 +#include "components/user_data_importer/content/favicon_reencode.h"
++#include "crypto/sha2.h"
 +#include "sql/database.h"
 +#include "sql/statement.h"
++#include "ui/gfx/favicon_size.h"
 +#include "url/gurl.h"
 +
 +namespace browseros_importer {
@@ -115,19 +117,32 @@ index 0000000000000..6896bb7ab0f7c
 +  }
 +}
 +
-+void LoadFaviconURLMappings(sql::Database* db, FaviconMap* favicon_map) {
-+  const char kQuery[] = "SELECT icon_id, page_url FROM icon_mapping";
++// Maps each bookmarked URL to its icon, collecting the URLs per icon. Uses
++// icon_mapping's page_url index instead of reading every mapping.
++void LoadFaviconURLMappings(
++    sql::Database* db,
++    const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks,
++    FaviconMap* favicon_map) {
++  const char kQuery[] = "SELECT icon_id FROM icon_mapping WHERE page_url = ?";
 +  sql::Statement statement(db->GetUniqueStatement(kQuery));
++  if (!statement.is_valid()) {
++    return;
++  }
 +
-+  while (statement.Step()) {
-+    int64_t icon_id = statement.ColumnInt64(0);
-+    GURL url(statement.ColumnString(1));
-+    if (url.is_valid()) {
-+      (*favicon_map)[icon_id].insert(url);
++  for (const auto& bookmark : bookmarks) {
++    if (bookmark.is_folder || !bookmark.url.is_valid()) {
++      continue;
++    }
++    statement.BindString(0, bookmark.url.spec());
++    if (statement.Step()) {
++      (*favicon_map)[statement.ColumnInt64(0)].insert(bookmark.url);
 +    }
++    statement.Reset(true);
 +  }
 +}
 +
++// Loads one bitmap per icon: the smallest that is at least as wide as a
++// displayed favicon, or the widest one if all are smaller.
 +void LoadFaviconData(sql::Database* db,
 +                     const FaviconMap& favicon_map,
 +                     favicon_base::FaviconUsageDataList* favicons) {
@@ -135,7 +150,9 @@ index 0000000000000..6896bb7ab0f7c
 +      "SELECT f.url, fb.image_data "
 +      "FROM favicons f "
 +      "JOIN favicon_bitmaps fb ON f.id = fb.icon_id "
-+      "WHERE f.id = ?";
++      "WHERE f.id = ? "
++      "ORDER BY fb.width < ?, ABS(fb.width - ?) "
++      "LIMIT 1";
 +
 +  sql::Statement statement(db->GetUniqueStatement(kQuery));
 +  if (!statement.is_valid()) {
@@ -144,6 +161,8 @@ index 0000000000000..6896bb7ab0f7c
 +
 +  for (const auto& [icon_id, urls] : favicon_map) {
 +    statement.BindInt64(0, icon_id);
++    statement.BindInt(1, gfx::kFaviconSize);
++    statement.BindInt(2, gfx::kFaviconSize);
 +    if (statement.Step()) {
 +      GURL favicon_url(statement.ColumnString(0));
 +      if (!favicon_url.is_valid()) {
@@ -225,31 +244,51 @@ index 0000000000000..6896bb7ab0f7c
 +                                 &result.bookmarks);
 +  }
 +
-+  // Import favicons from Favicons database
++  return result;
++}
++
++favicon_base::FaviconUsageDataList ImportChromeBookmarkFavicons(
++    const base::FilePath& profile_path,
++    const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks) {
++  favicon_base::FaviconUsageDataList favicons;
++
 +  // Original code uses DirName() - try that first, then profile directory
 +  base::FilePath favicons_path =
 +      profile_path.DirName().AppendASCII(kFaviconsFilename);
 +  if (!base::PathExists(favicons_path)) {
 +    favicons_path = profile_path.AppendASCII(kFaviconsFilename);
 +  }
++  if (!base::PathExists(favicons_path)) {
++    return favicons;
++  }
 +
-+  if (base::PathExists(favicons_path)) {
-+    base::FilePath temp_favicons = CopyToTempFile(favicons_path);
-+    if (!temp_favicons.empty()) {
-+      sql::Database db(kDatabaseTag);
-+      if (db.Open(temp_favicons)) {
-+        FaviconMap favicon_map;
-+        LoadFaviconURLMappings(&db, &favicon_map);
-+        if (!favicon_map.empty()) {
-+          LoadFaviconData(&db, favicon_map, &result.favicons);
-+        }
-+        db.Close();
-+      }
-+      base::DeleteFile(temp_favicons);
++  base::FilePath temp_favicons = SnapshotDatabaseToTempFile(
++      favicons_path, IsSourceBrowserRunning(profile_path));
++  if (temp_favicons.empty()) {
++    return favicons;
++  }
++
++  sql::Database db(kDatabaseTag);
++  if (db.Open(temp_favicons)) {
++    FaviconMap favicon_map;
++    LoadFaviconURLMappings(&db, bookmarks, &favicon_map);
++    if (!favicon_map.empty()) {
++      LoadFaviconData(&db, favicon_map, &favicons);
 +    }
++    db.Close();
 +  }
++  base::DeleteFile(temp_favicons);
 +
-+  return result;
++  return favicons;
++}
++
++std::string HashChromeBookmarksFile(const base::FilePath& profile_path) {
++  std::string bookmarks_content;
++  if (!base::ReadFileToString(profile_path.AppendASCII(kBookmarksFilename),
++                              &bookmarks_content)) {
++    return std::string();
++  }
++  return base::HexEncode(crypto::SHA256HashString(bookmarks_content));
 +}
 +
 +}  // namespace browseros_importer
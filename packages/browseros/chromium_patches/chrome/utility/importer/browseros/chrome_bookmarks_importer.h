@@ -1,15 +1,16 @@
 diff --git a/chrome/utility/importer/browseros/chrome_bookmarks_importer.h b/chrome/utility/importer/browseros/chrome_bookmarks_importer.h
 new file mode 100644
-index 0000000000000..40dfcc2ce8af8
+index 0000000000000..ade1ba6bc0a5e
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_bookmarks_importer.h
-@@ -0,0 +1,33 @@
+@@ -0,0 +1,45 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome bookmarks importer
 +
 +#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_BOOKMARKS_IMPORTER_H_
 +#define CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_BOOKMARKS_IMPORTER_H_
 +
++#include <string>
 +#include <vector>
 +
 +#include "base/files/file_path.h"
@@ -18,7 +19,8 @@ index 0000000000000..40dfcc2ce8af8
 +
 +namespace browseros_importer {
 +
-+// Result of bookmark import operation containing both bookmarks and favicons.
++// Result of bookmark import operation. Favicons are imported separately,
++// once the bookmarks are in, by ImportChromeBookmarkFavicons().
 +struct ChromeBookmarksResult {
 +  ChromeBookmarksResult();
 +  ~ChromeBookmarksResult();
@@ -26,14 +28,24 @@ index 0000000000000..40dfcc2ce8af8
 +  ChromeBookmarksResult& operator=(ChromeBookmarksResult&&);
 +
 +  std::vector<user_data_importer::ImportedBookmarkEntry> bookmarks;
-+  favicon_base::FaviconUsageDataList favicons;
 +};
 +
-+// Imports bookmarks and favicons from Chrome.
++// Imports bookmarks from Chrome.
 +// |profile_path| should be the Chrome profile directory (e.g., .../Default)
-+// Returns bookmarks and associated favicons. Returns empty result on failure.
++// Returns empty result on failure.
 +ChromeBookmarksResult ImportChromeBookmarks(const base::FilePath& profile_path);
 +
++// Imports the favicons of |bookmarks| from Chrome's Favicons database, one
++// bitmap per icon in the size favicons are displayed at.
++// Returns empty list on failure.
++favicon_base::FaviconUsageDataList ImportChromeBookmarkFavicons(
++    const base::FilePath& profile_path,
++    const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks);
++
++// Hex SHA-256 of Chrome's Bookmarks file, to tell whether it changed since
++// an earlier import. Returns empty string if the file can't be read.
++std::string HashChromeBookmarksFile(const base::FilePath& profile_path);
++
 +}  // namespace browseros_importer
 +
 +#endif  // CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_BOOKMARKS_IMPORTER_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_cookie_importer.cc b/chrome/utility/importer/browseros/chrome_cookie_importer.cc
 new file mode 100644
-index 0000000000000..4497532338b3f
+index 0000000000000..70676216cf462
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_cookie_importer.cc
-@@ -0,0 +1,229 @@
+@@ -0,0 +1,215 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome cookie importer implementation
 +
@@ -11,7 +11,9 @@ index 0000000000000..4497532338b3f
 +
 +#include "base/files/file_util.h"
 +#include "base/logging.h"
++#include "base/timer/elapsed_timer.h"
 +#include "chrome/utility/importer/browseros/chrome_decryptor.h"
++#include "chrome/utility/importer/browseros/chrome_importer_utils.h"
 +#include "sql/database.h"
 +#include "sql/statement.h"
 +
@@ -35,34 +37,6 @@ index 0000000000000..4497532338b3f
 +
 +constexpr char kCookiesFilename[] = "Cookies";
 +
-+// Copy database to temp location to avoid locking issues with Chrome
-+base::FilePath CopyDatabaseToTemp(const base::FilePath& db_path) {
-+  base::FilePath temp_path;
-+  if (!base::CreateTemporaryFile(&temp_path)) {
-+    LOG(WARNING) << "browseros: Failed to create temp file";
-+    return base::FilePath();
-+  }
-+
-+  if (!base::CopyFile(db_path, temp_path)) {
-+    LOG(WARNING) << "browseros: Failed to copy database to temp";
-+    base::DeleteFile(temp_path);
-+    return base::FilePath();
-+  }
-+
-+  return temp_path;
-+}
-+
-+// Convert Chrome's microseconds since Windows epoch to base::Time
-+// Chrome stores times as microseconds since Jan 1, 1601 (Windows epoch)
-+base::Time ChromeTimeToBaseTime(int64_t chrome_time) {
-+  if (chrome_time == 0) {
-+    return base::Time();
-+  }
-+  // base::Time::FromDeltaSinceWindowsEpoch handles the conversion
-+  return base::Time::FromDeltaSinceWindowsEpoch(
-+      base::Microseconds(chrome_time));
-+}
-+
 +// Map Chrome's samesite integer to net::CookieSameSite
 +net::CookieSameSite IntToSameSite(int value) {
 +  switch (value) {
@@ -108,12 +82,17 @@ index 0000000000000..4497532338b3f
 +}  // namespace
 +
 +std::vector<ImportedCookieEntry> ImportChromeCookies(
-+    const base::FilePath& profile_path) {
++    const base::FilePath& profile_path,
++    scoped_refptr<ChromeKeyCache> key_cache,
++    base::Time since,
++    base::TimeDelta* decrypt_time) {
 +  std::vector<ImportedCookieEntry> cookies;
 +
-+  // Extract encryption key (same key used for passwords and cookies)
++  // Same key as passwords; extracted once per import session
 +  KeyExtractionResult key_result;
-+  std::string encryption_key = ExtractChromeKey(profile_path, &key_result);
++  base::ElapsedTimer key_timer;
++  std::string encryption_key = key_cache->GetKey(&key_result);
++  *decrypt_time += key_timer.Elapsed();
 +
 +  if (encryption_key.empty()) {
 +    LOG(WARNING) << "browseros: Failed to extract encryption key, "
@@ -129,8 +108,9 @@ index 0000000000000..4497532338b3f
 +    return cookies;
 +  }
 +
-+  // Copy to temp location to avoid locking issues
-+  base::FilePath temp_db_path = CopyDatabaseToTemp(cookies_path);
++  // Snapshot to a temp location to avoid locking issues
++  base::FilePath temp_db_path = SnapshotDatabaseToTempFile(
++      cookies_path, IsSourceBrowserRunning(profile_path));
 +  if (temp_db_path.empty()) {
 +    return cookies;
 +  }
@@ -167,7 +147,8 @@ index 0000000000000..4497532338b3f
 +        "is_secure, is_httponly, creation_utc, last_access_utc, "
 +        "samesite, priority, source_scheme, source_port, is_persistent, "
 +        "last_update_utc "
-+        "FROM cookies";
++        "FROM cookies "
++        "WHERE last_update_utc > ?";
 +
 +    sql::Statement statement(db.GetUniqueStatement(kQuery));
 +    if (!statement.is_valid()) {
@@ -176,6 +157,11 @@ index 0000000000000..4497532338b3f
 +      return cookies;
 +    }
 +
++    statement.BindInt64(0, ChromeTimeLowerBound(since));
++
++    // Rows are read first and their values decrypted together, in parallel;
++    // entry.value holds the plaintext column until then
++    std::vector<std::string> encrypted_values;
 +    while (statement.Step()) {
 +      ImportedCookieEntry entry;
 +
@@ -183,31 +169,10 @@ index 0000000000000..4497532338b3f
 +      entry.name = statement.ColumnString(1);
 +
 +      // Get both plaintext and encrypted values
-+      std::string plaintext_value = statement.ColumnString(2);
++      entry.value = statement.ColumnString(2);
 +      std::string encrypted_value;
 +      statement.ColumnBlobAsString(3, &encrypted_value);
 +
-+      // Prefer encrypted_value if present, otherwise use plaintext
-+      if (!encrypted_value.empty()) {
-+        std::string decrypted_value;
-+        if (DecryptChromeValue(encrypted_value, encryption_key,
-+                               &decrypted_value)) {
-+          // Chrome 130+ (db version ≥ 24) prepends SHA256 hash of domain
-+          // to the cookie value before encryption. Strip it after decryption.
-+          if (has_domain_hash_prefix &&
-+              decrypted_value.size() > kSha256HashLength) {
-+            entry.value = decrypted_value.substr(kSha256HashLength);
-+          } else {
-+            entry.value = decrypted_value;
-+          }
-+        } else {
-+          // Fall back to plaintext if decryption fails
-+          entry.value = plaintext_value;
-+        }
-+      } else {
-+        entry.value = plaintext_value;
-+      }
-+
 +      entry.path = statement.ColumnString(4);
 +      entry.expires_utc = ChromeTimeToBaseTime(statement.ColumnInt64(5));
 +      entry.is_secure = statement.ColumnBool(6);
@@ -222,8 +187,29 @@ index 0000000000000..4497532338b3f
 +      entry.last_update_utc = ChromeTimeToBaseTime(statement.ColumnInt64(15));
 +
 +      cookies.push_back(std::move(entry));
++      encrypted_values.push_back(std::move(encrypted_value));
 +    }
 +
++    base::ElapsedTimer decrypt_timer;
++    std::vector<std::optional<std::string>> decrypted_values =
++        DecryptChromeValues(encrypted_values, encryption_key);
++    *decrypt_time += decrypt_timer.Elapsed();
++    for (size_t i = 0; i < cookies.size(); ++i) {
++      // Prefer encrypted_value if present and decryptable, otherwise keep
++      // the plaintext value
++      if (encrypted_values[i].empty() || !decrypted_values[i]) {
++        continue;
++      }
++      std::string& decrypted_value = *decrypted_values[i];
++      // Chrome 130+ (db version ≥ 24) prepends SHA256 hash of domain
++      // to the cookie value before encryption. Strip it after decryption.
++      if (has_domain_hash_prefix &&
++          decrypted_value.size() > kSha256HashLength) {
++        cookies[i].value = decrypted_value.substr(kSha256HashLength);
++      } else {
++        cookies[i].value = std::move(decrypted_value);
++      }
++    }
 +  }  // statement destroyed here
 +
 +  db.Close();
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_cookie_importer.h b/chrome/utility/importer/browseros/chrome_cookie_importer.h
 new file mode 100644
-index 0000000000000..edfd9f068250b
+index 0000000000000..920916bb625c2
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_cookie_importer.h
-@@ -0,0 +1,52 @@
+@@ -0,0 +1,61 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome cookie importer interface
 +
@@ -14,11 +14,14 @@ index 0000000000000..edfd9f068250b
 +#include <vector>
 +
 +#include "base/files/file_path.h"
++#include "base/memory/scoped_refptr.h"
 +#include "base/time/time.h"
 +#include "net/cookies/cookie_constants.h"
 +
 +namespace browseros_importer {
 +
++class ChromeKeyCache;
++
 +// Represents a cookie imported from Chrome's Cookies database.
 +// Fields mirror Chrome's cookies table schema (v24+).
 +struct ImportedCookieEntry {
@@ -49,9 +52,15 @@ index 0000000000000..edfd9f068250b
 +// Imports cookies from Chrome's Cookies database.
 +// Returns a vector of ImportedCookieEntry with decrypted values.
 +// profile_path should point to the Chrome profile directory containing
-+// the "Cookies" database file.
++// the "Cookies" database file. |key_cache| provides Chrome's encryption key
++// for the import session. Only cookies set or updated after |since| are
++// read; pass a null time for all of them. Time spent getting the key and
++// decrypting is added to |decrypt_time|.
 +std::vector<ImportedCookieEntry> ImportChromeCookies(
-+    const base::FilePath& profile_path);
++    const base::FilePath& profile_path,
++    scoped_refptr<ChromeKeyCache> key_cache,
++    base::Time since,
++    base::TimeDelta* decrypt_time);
 +
 +}  // namespace browseros_importer
 +
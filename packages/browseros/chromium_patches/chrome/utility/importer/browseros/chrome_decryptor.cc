@@ -1,19 +1,115 @@
 diff --git a/chrome/utility/importer/browseros/chrome_decryptor.cc b/chrome/utility/importer/browseros/chrome_decryptor.cc
 new file mode 100644
-index 0000000000000..cf7ccdf4336f7
+index 0000000000000..c27a707e5752b
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_decryptor.cc
-@@ -0,0 +1,31 @@
+@@ -0,0 +1,132 @@
 +// Copyright 2024 AKW Technology Inc
-+// Chrome decryption - Linux stub (deferred implementation)
++// Chrome decryption - shared helpers and Linux stub (deferred implementation)
 +
 +#include "chrome/utility/importer/browseros/chrome_decryptor.h"
 +
++#include <algorithm>
++#include <utility>
++
++#include "base/barrier_closure.h"
++#include "base/functional/bind.h"
 +#include "base/logging.h"
++#include "base/synchronization/waitable_event.h"
++#include "base/task/thread_pool.h"
 +#include "build/build_config.h"
++#include "third_party/boringssl/src/include/openssl/mem.h"
 +
 +namespace browseros_importer {
 +
++namespace {
++
++// Values decrypted per ThreadPool task; smaller batches aren't split
++constexpr size_t kValuesPerDecryptTask = 256;
++
++void DecryptRange(const std::vector<std::string>* ciphertexts,
++                  const std::string* key,
++                  size_t begin,
++                  size_t end,
++                  std::vector<std::optional<std::string>>* plaintexts) {
++  ChromeValueDecryptor decryptor(*key);
++  for (size_t i = begin; i < end; ++i) {
++    std::string plaintext;
++    if (decryptor.Decrypt((*ciphertexts)[i], &plaintext)) {
++      (*plaintexts)[i] = std::move(plaintext);
++    }
++  }
++}
++
++}  // namespace
++
++bool DecryptChromeValue(const std::string& ciphertext,
++                        const std::string& key,
++                        std::string* plaintext) {
++  return ChromeValueDecryptor(key).Decrypt(ciphertext, plaintext);
++}
++
++std::vector<std::optional<std::string>> DecryptChromeValues(
++    const std::vector<std::string>& ciphertexts,
++    const std::string& key) {
++  std::vector<std::optional<std::string>> plaintexts(ciphertexts.size());
++  if (ciphertexts.size() <= kValuesPerDecryptTask) {
++    DecryptRange(&ciphertexts, &key, 0, ciphertexts.size(), &plaintexts);
++    return plaintexts;
++  }
++
++  // Each task writes only its own range of |plaintexts|
++  const size_t task_count =
++      (ciphertexts.size() + kValuesPerDecryptTask - 1) / kValuesPerDecryptTask;
++  base::WaitableEvent done;
++  base::RepeatingClosure task_done = base::BarrierClosure(
++      task_count,
++      base::BindOnce(&base::WaitableEvent::Signal, base::Unretained(&done)));
++  for (size_t begin = 0; begin < ciphertexts.size();
++       begin += kValuesPerDecryptTask) {
++    const size_t end =
++        std::min(ciphertexts.size(), begin + kValuesPerDecryptTask);
++    base::ThreadPool::PostTask(
++        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
++        base::BindOnce(&DecryptRange, base::Unretained(&ciphertexts),
++                       base::Unretained(&key), begin, end,
++                       base::Unretained(&plaintexts))
++            .Then(task_done));
++  }
++  done.Wait();
++  return plaintexts;
++}
++
++ChromeKeyCache::ChromeKeyCache(const base::FilePath& profile_path)
++    : profile_path_(profile_path) {}
++
++// static
++scoped_refptr<ChromeKeyCache> ChromeKeyCache::CreateForTesting(
++    std::string key) {
++  auto key_cache = base::MakeRefCounted<ChromeKeyCache>(base::FilePath());
++  base::AutoLock lock(key_cache->lock_);
++  key_cache->key_ = std::move(key);
++  key_cache->result_ = KeyExtractionResult::kSuccess;
++  key_cache->extracted_ = true;
++  return key_cache;
++}
++
++ChromeKeyCache::~ChromeKeyCache() {
++  OPENSSL_cleanse(key_.data(), key_.size());
++}
++
++std::string ChromeKeyCache::GetKey(KeyExtractionResult* result) {
++  base::AutoLock lock(lock_);
++  if (!extracted_) {
++    key_ = ExtractChromeKey(profile_path_, &result_);
++    extracted_ = true;
++  }
++  if (result) {
++    *result = result_;
++  }
++  return key_;
++}
++
 +#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
 +
 +std::string ExtractChromeKey(const base::FilePath& profile_path,
@@ -25,9 +121,14 @@ index 0000000000000..cf7ccdf4336f7
 +  return std::string();
 +}
 +
-+bool DecryptChromeValue(const std::string& ciphertext,
-+                        const std::string& key,
-+                        std::string* plaintext) {
++struct ChromeValueDecryptor::State {};
++
++ChromeValueDecryptor::ChromeValueDecryptor(const std::string& key) {}
++
++ChromeValueDecryptor::~ChromeValueDecryptor() = default;
++
++bool ChromeValueDecryptor::Decrypt(const std::string& ciphertext,
++                                   std::string* plaintext) {
 +  LOG(INFO) << "browseros: Linux decryption not yet implemented";
 +  return false;
 +}
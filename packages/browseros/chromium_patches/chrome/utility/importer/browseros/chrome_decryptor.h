@@ -1,18 +1,24 @@
 diff --git a/chrome/utility/importer/browseros/chrome_decryptor.h b/chrome/utility/importer/browseros/chrome_decryptor.h
 new file mode 100644
-index 0000000000000..3805c007ec30c
+index 0000000000000..e8fbc55e5b073
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_decryptor.h
-@@ -0,0 +1,45 @@
+@@ -0,0 +1,111 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome data decryption interface
 +
 +#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_DECRYPTOR_H_
 +#define CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_DECRYPTOR_H_
 +
++#include <memory>
++#include <optional>
 +#include <string>
++#include <vector>
 +
 +#include "base/files/file_path.h"
++#include "base/memory/ref_counted.h"
++#include "base/synchronization/lock.h"
++#include "base/thread_annotations.h"
 +#include "build/build_config.h"
 +
 +namespace browseros_importer {
@@ -46,6 +52,66 @@ index 0000000000000..3805c007ec30c
 +                        const std::string& key,
 +                        std::string* plaintext);
 +
++// Decrypts values under one key with a cipher context keyed once, so a batch
++// doesn't redo the key setup per value. Each plaintext is written straight
++// into the caller's string, sized once up front. BoringSSL picks the AES-NI
++// or ARMv8 AES code at runtime. Not thread-safe: use one per thread.
++class ChromeValueDecryptor {
++ public:
++  // |key| is the encryption key from ExtractChromeKey()
++  explicit ChromeValueDecryptor(const std::string& key);
++  ~ChromeValueDecryptor();
++
++  ChromeValueDecryptor(const ChromeValueDecryptor&) = delete;
++  ChromeValueDecryptor& operator=(const ChromeValueDecryptor&) = delete;
++
++  // Like DecryptChromeValue(). |plaintext| is left untouched on failure.
++  bool Decrypt(const std::string& ciphertext, std::string* plaintext);
++
++ private:
++  // Platform cipher context, defined next to the platform's decryption
++  struct State;
++  std::unique_ptr<State> state_;
++};
++
++// Decrypts each of |ciphertexts| with a ChromeValueDecryptor per ThreadPool
++// worker, spreading large batches over workers. Returns one entry per
++// ciphertext, in order; std::nullopt where decryption failed.
++// Blocks until done, so the caller needs base::WithBaseSyncPrimitives().
++std::vector<std::optional<std::string>> DecryptChromeValues(
++    const std::vector<std::string>& ciphertexts,
++    const std::string& key);
++
++// Chrome's encryption key for one import session, shared by the password
++// and cookie importers. The key is extracted on first use and then only
++// kept in memory, so the user sees a single Keychain prompt per import.
++// Thread-safe.
++class ChromeKeyCache : public base::RefCountedThreadSafe<ChromeKeyCache> {
++ public:
++  explicit ChromeKeyCache(const base::FilePath& profile_path);
++
++  // A cache that hands out |key| without touching the system key store
++  static scoped_refptr<ChromeKeyCache> CreateForTesting(std::string key);
++
++  ChromeKeyCache(const ChromeKeyCache&) = delete;
++  ChromeKeyCache& operator=(const ChromeKeyCache&) = delete;
++
++  // Returns the key like ExtractChromeKey(). Blocks a concurrent caller
++  // while the first one extracts it; a failed extraction isn't retried.
++  std::string GetKey(KeyExtractionResult* result);
++
++ private:
++  friend class base::RefCountedThreadSafe<ChromeKeyCache>;
++  ~ChromeKeyCache();
++
++  const base::FilePath profile_path_;
++  base::Lock lock_;
++  bool extracted_ GUARDED_BY(lock_) = false;
++  std::string key_ GUARDED_BY(lock_);
++  KeyExtractionResult result_ GUARDED_BY(lock_) =
++      KeyExtractionResult::kUnknownError;
++};
++
 +}  // namespace browseros_importer
 +
 +#endif  // CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_DECRYPTOR_H_
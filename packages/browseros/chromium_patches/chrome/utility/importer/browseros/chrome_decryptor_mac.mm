@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_decryptor_mac.mm b/chrome/utility/importer/browseros/chrome_decryptor_mac.mm
 new file mode 100644
-index 0000000000000..caabfa17010ab
+index 0000000000000..38f3d5a69f6b7
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_decryptor_mac.mm
-@@ -0,0 +1,191 @@
+@@ -0,0 +1,200 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome decryption - macOS implementation
 +// Uses Keychain for key retrieval, PBKDF2 for key derivation, AES-128-CBC for decryption
@@ -12,6 +12,9 @@ index 0000000000000..caabfa17010ab
 +
 +#include <Security/Security.h>
 +
++#include <memory>
++#include <utility>
++
 +#include "base/containers/span.h"
 +#include "base/logging.h"
 +#include "base/strings/string_util.h"
@@ -87,48 +90,6 @@ index 0000000000000..caabfa17010ab
 +  return result == 1;
 +}
 +
-+// Decrypt AES-128-CBC encrypted data
-+bool DecryptAesCbc(const std::vector<uint8_t>& key,
-+                   const uint8_t* ciphertext,
-+                   size_t ciphertext_length,
-+                   std::string* plaintext) {
-+  if (key.size() != kDerivedKeyLength) {
-+    LOG(WARNING) << "browseros: Invalid key size";
-+    return false;
-+  }
-+
-+  // Initialize cipher context
-+  bssl::ScopedEVP_CIPHER_CTX ctx;
-+  if (!EVP_DecryptInit_ex(ctx.get(), EVP_aes_128_cbc(), nullptr,
-+                          key.data(), kIv)) {
-+    LOG(WARNING) << "browseros: EVP_DecryptInit_ex failed";
-+    return false;
-+  }
-+
-+  // Allocate output buffer (plaintext is at most ciphertext length)
-+  std::vector<uint8_t> output(ciphertext_length + EVP_MAX_BLOCK_LENGTH);
-+  int output_length = 0;
-+
-+  if (!EVP_DecryptUpdate(ctx.get(), output.data(), &output_length,
-+                         ciphertext, ciphertext_length)) {
-+    LOG(WARNING) << "browseros: EVP_DecryptUpdate failed";
-+    return false;
-+  }
-+
-+  int final_length = 0;
-+  auto output_span = base::span(output);
-+  if (!EVP_DecryptFinal_ex(ctx.get(),
-+                           output_span.subspan(static_cast<size_t>(output_length)).data(),
-+                           &final_length)) {
-+    LOG(WARNING) << "browseros: EVP_DecryptFinal_ex failed - possible padding error";
-+    return false;
-+  }
-+
-+  plaintext->assign(reinterpret_cast<char*>(output.data()),
-+                    output_length + final_length);
-+  return true;
-+}
-+
 +}  // namespace
 +
 +std::string ExtractChromeKey(const base::FilePath& profile_path,
@@ -160,9 +121,31 @@ index 0000000000000..caabfa17010ab
 +                     derived_key.size());
 +}
 +
-+bool DecryptChromeValue(const std::string& ciphertext,
-+                        const std::string& key,
-+                        std::string* plaintext) {
++struct ChromeValueDecryptor::State {
++  bssl::ScopedEVP_CIPHER_CTX ctx;
++  bool keyed = false;
++};
++
++ChromeValueDecryptor::ChromeValueDecryptor(const std::string& key)
++    : state_(std::make_unique<State>()) {
++  if (key.size() != kDerivedKeyLength) {
++    LOG(WARNING) << "browseros: Invalid key size";
++    return;
++  }
++
++  // Expands the AES key schedule once; each value only resets the IV
++  state_->keyed =
++      EVP_DecryptInit_ex(state_->ctx.get(), EVP_aes_128_cbc(), nullptr,
++                         reinterpret_cast<const uint8_t*>(key.data()), kIv);
++  if (!state_->keyed) {
++    LOG(WARNING) << "browseros: EVP_DecryptInit_ex failed";
++  }
++}
++
++ChromeValueDecryptor::~ChromeValueDecryptor() = default;
++
++bool ChromeValueDecryptor::Decrypt(const std::string& ciphertext,
++                                   std::string* plaintext) {
 +  if (ciphertext.empty()) {
 +    return false;
 +  }
@@ -176,20 +159,46 @@ index 0000000000000..caabfa17010ab
 +  }
 +
 +  // Extract the actual encrypted data (skip "v10" prefix)
-+  auto ciphertext_span = base::as_byte_span(ciphertext);
-+  auto encrypted_span = ciphertext_span.subspan(kEncryptionVersionPrefixLength);
-+  const uint8_t* encrypted_data = encrypted_span.data();
-+  size_t encrypted_length = encrypted_span.size();
-+
-+  if (encrypted_length == 0) {
++  auto encrypted_span =
++      base::as_byte_span(ciphertext).subspan(kEncryptionVersionPrefixLength);
++  if (encrypted_span.empty()) {
 +    LOG(WARNING) << "browseros: Empty ciphertext after prefix";
 +    return false;
 +  }
 +
-+  // Convert key string to vector
-+  std::vector<uint8_t> key_bytes(key.begin(), key.end());
++  if (!state_->keyed) {
++    return false;
++  }
 +
-+  return DecryptAesCbc(key_bytes, encrypted_data, encrypted_length, plaintext);
++  // Keeps the key, restarts CBC from the fixed IV
++  EVP_CIPHER_CTX* ctx = state_->ctx.get();
++  if (!EVP_DecryptInit_ex(ctx, nullptr, nullptr, nullptr, kIv)) {
++    LOG(WARNING) << "browseros: EVP_DecryptInit_ex failed";
++    return false;
++  }
++
++  // Plaintext is at most ciphertext length; padding is trimmed after
++  std::string output(encrypted_span.size() + EVP_MAX_BLOCK_LENGTH, '\0');
++  auto output_span = base::as_writable_byte_span(output);
++  int output_length = 0;
++  if (!EVP_DecryptUpdate(ctx, output_span.data(), &output_length,
++                         encrypted_span.data(), encrypted_span.size())) {
++    LOG(WARNING) << "browseros: EVP_DecryptUpdate failed";
++    return false;
++  }
++
++  int final_length = 0;
++  if (!EVP_DecryptFinal_ex(
++          ctx,
++          output_span.subspan(static_cast<size_t>(output_length)).data(),
++          &final_length)) {
++    LOG(WARNING) << "browseros: EVP_DecryptFinal_ex failed - possible padding error";
++    return false;
++  }
++
++  output.resize(static_cast<size_t>(output_length + final_length));
++  *plaintext = std::move(output);
++  return true;
 +}
 +
 +}  // namespace browseros_importer
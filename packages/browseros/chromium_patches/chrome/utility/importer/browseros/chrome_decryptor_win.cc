@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_decryptor_win.cc b/chrome/utility/importer/browseros/chrome_decryptor_win.cc
 new file mode 100644
-index 0000000000000..5853c63c5e2d4
+index 0000000000000..87c3edd0b7e10
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_decryptor_win.cc
-@@ -0,0 +1,246 @@
+@@ -0,0 +1,259 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome decryption - Windows implementation
 +// Uses DPAPI for key retrieval, AES-256-GCM for decryption
@@ -13,6 +13,9 @@ index 0000000000000..5853c63c5e2d4
 +#include <windows.h>
 +#include <wincrypt.h>
 +
++#include <memory>
++#include <utility>
++
 +#include "base/base64.h"
 +#include "base/files/file_util.h"
 +#include "base/json/json_reader.h"
@@ -20,7 +23,7 @@ index 0000000000000..5853c63c5e2d4
 +#include "base/strings/string_util.h"
 +#include "base/values.h"
 +#include "build/build_config.h"
-+#include "crypto/aead.h"
++#include "third_party/boringssl/src/include/openssl/aead.h"
 +
 +#if BUILDFLAG(IS_WIN)
 +
@@ -126,47 +129,6 @@ index 0000000000000..5853c63c5e2d4
 +  return false;
 +}
 +
-+// Decrypt AES-256-GCM encrypted data
-+bool DecryptAesGcm(const std::string& key,
-+                   const uint8_t* ciphertext,
-+                   size_t ciphertext_length,
-+                   std::string* plaintext) {
-+  if (key.size() != kAesKeyLength) {
-+    LOG(WARNING) << "browseros: Invalid AES key size: " << key.size();
-+    return false;
-+  }
-+
-+  // Minimum: nonce (12) + auth tag (16) + at least 1 byte of data
-+  if (ciphertext_length < kNonceLength + kAuthTagLength) {
-+    LOG(WARNING) << "browseros: Ciphertext too short for AES-GCM";
-+    return false;
-+  }
-+
-+  // Extract nonce (first 12 bytes)
-+  const uint8_t* nonce = ciphertext;
-+
-+  // Extract ciphertext + auth tag (remaining bytes)
-+  const uint8_t* encrypted_data = ciphertext + kNonceLength;
-+  size_t encrypted_length = ciphertext_length - kNonceLength;
-+
-+  // Use Chromium's crypto::Aead for decryption
-+  crypto::Aead aead(crypto::Aead::AES_256_GCM);
-+  aead.Init(base::as_byte_span(key));
-+
-+  std::optional<std::vector<uint8_t>> decrypted = aead.Open(
-+      base::span<const uint8_t>(encrypted_data, encrypted_length),
-+      base::span<const uint8_t>(nonce, kNonceLength),
-+      base::span<const uint8_t>());  // empty additional data
-+
-+  if (!decrypted) {
-+    LOG(WARNING) << "browseros: AES-GCM decryption failed";
-+    return false;
-+  }
-+
-+  plaintext->assign(decrypted->begin(), decrypted->end());
-+  return true;
-+}
-+
 +}  // namespace
 +
 +std::string ExtractChromeKey(const base::FilePath& profile_path,
@@ -217,9 +179,32 @@ index 0000000000000..5853c63c5e2d4
 +  return decrypted_key;
 +}
 +
-+bool DecryptChromeValue(const std::string& ciphertext,
-+                        const std::string& key,
-+                        std::string* plaintext) {
++struct ChromeValueDecryptor::State {
++  bssl::ScopedEVP_AEAD_CTX ctx;
++  bool keyed = false;
++};
++
++ChromeValueDecryptor::ChromeValueDecryptor(const std::string& key)
++    : state_(std::make_unique<State>()) {
++  if (key.size() != kAesKeyLength) {
++    LOG(WARNING) << "browseros: Invalid AES key size: " << key.size();
++    return;
++  }
++
++  // Expands the AES key and GHASH tables once for the whole batch
++  state_->keyed = EVP_AEAD_CTX_init(
++      state_->ctx.get(), EVP_aead_aes_256_gcm(),
++      reinterpret_cast<const uint8_t*>(key.data()), key.size(),
++      kAuthTagLength, nullptr);
++  if (!state_->keyed) {
++    LOG(WARNING) << "browseros: EVP_AEAD_CTX_init failed";
++  }
++}
++
++ChromeValueDecryptor::~ChromeValueDecryptor() = default;
++
++bool ChromeValueDecryptor::Decrypt(const std::string& ciphertext,
++                                   std::string* plaintext) {
 +  if (ciphertext.empty()) {
 +    return false;
 +  }
@@ -244,7 +229,35 @@ index 0000000000000..5853c63c5e2d4
 +    return false;
 +  }
 +
-+  return DecryptAesGcm(key, encrypted_data, encrypted_length, plaintext);
++  // Minimum: nonce (12) + auth tag (16)
++  if (encrypted_length < kNonceLength + kAuthTagLength) {
++    LOG(WARNING) << "browseros: Ciphertext too short for AES-GCM";
++    return false;
++  }
++
++  if (!state_->keyed) {
++    return false;
++  }
++
++  // Nonce first, then ciphertext + auth tag
++  const uint8_t* nonce = encrypted_data;
++  const uint8_t* sealed = encrypted_data + kNonceLength;
++  const size_t sealed_length = encrypted_length - kNonceLength;
++
++  // Decrypt straight into the result, sized to the plaintext up front
++  std::string output(sealed_length - kAuthTagLength, '\0');
++  size_t output_length = 0;
++  if (!EVP_AEAD_CTX_open(state_->ctx.get(),
++                         reinterpret_cast<uint8_t*>(output.data()),
++                         &output_length, output.size(), nonce, kNonceLength,
++                         sealed, sealed_length, nullptr, 0)) {
++    LOG(WARNING) << "browseros: AES-GCM decryption failed";
++    return false;
++  }
++
++  output.resize(output_length);
++  *plaintext = std::move(output);
++  return true;
 +}
 +
 +}  // namespace browseros_importer
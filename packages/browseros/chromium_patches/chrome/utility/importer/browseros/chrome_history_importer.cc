@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_history_importer.cc b/chrome/utility/importer/browseros/chrome_history_importer.cc
 new file mode 100644
-index 0000000000000..ec7b96bb6b854
+index 0000000000000..54a1f5b6fd628
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_history_importer.cc
-@@ -0,0 +1,92 @@
+@@ -0,0 +1,110 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome history importer implementation
 +
@@ -26,37 +26,42 @@ index 0000000000000..ec7b96bb6b854
 +
 +}  // namespace
 +
-+std::vector<user_data_importer::ImporterURLRow> ImportChromeHistory(
-+    const base::FilePath& profile_path) {
-+  std::vector<user_data_importer::ImporterURLRow> rows;
++size_t ImportChromeHistory(const base::FilePath& profile_path,
++                           base::Time since,
++                           size_t chunk_size,
++                           const HistoryChunkCallback& on_chunk) {
++  size_t row_count = 0;
 +
 +  base::FilePath history_path = profile_path.AppendASCII(kHistoryFilename);
 +  if (!base::PathExists(history_path)) {
 +    LOG(WARNING) << "browseros: History file not found";
-+    return rows;
++    return row_count;
 +  }
 +
-+  base::FilePath temp_path = CopyToTempFile(history_path);
++  base::FilePath temp_path = SnapshotDatabaseToTempFile(
++      history_path, IsSourceBrowserRunning(profile_path));
 +  if (temp_path.empty()) {
-+    return rows;
++    return row_count;
 +  }
 +
 +  sql::Database db(kDatabaseTag);
 +  if (!db.Open(temp_path)) {
 +    LOG(WARNING) << "browseros: Failed to open database";
 +    base::DeleteFile(temp_path);
-+    return rows;
++    return row_count;
 +  }
 +
 +  // Query URLs with visit information, filtering out internal navigation types
 +  // - CHAIN_END: Only get final URLs in redirect chains
 +  // - Exclude SUBFRAME and KEYWORD_GENERATED transitions
++  // - Only visits after |since|, which visits_time_index serves
 +  // Use scope block to ensure statement is destroyed before db.Close()
 +  {
 +    const char kQuery[] =
 +        "SELECT u.url, u.title, v.visit_time, u.typed_count, u.visit_count "
 +        "FROM urls u JOIN visits v ON u.id = v.url "
 +        "WHERE hidden = 0 "
++        "AND v.visit_time > ? "
 +        "AND (transition & ?) != 0 "
 +        "AND (transition & ?) NOT IN (?, ?, ?)";
 +
@@ -64,16 +69,20 @@ index 0000000000000..ec7b96bb6b854
 +    if (!statement.is_valid()) {
 +      LOG(WARNING) << "browseros: Failed to prepare query";
 +      base::DeleteFile(temp_path);
-+      return rows;
++      return row_count;
 +    }
 +
-+    statement.BindInt64(0, ui::PAGE_TRANSITION_CHAIN_END);
-+    statement.BindInt64(1, ui::PAGE_TRANSITION_CORE_MASK);
-+    statement.BindInt64(2, ui::PAGE_TRANSITION_AUTO_SUBFRAME);
-+    statement.BindInt64(3, ui::PAGE_TRANSITION_MANUAL_SUBFRAME);
-+    statement.BindInt64(4, ui::PAGE_TRANSITION_KEYWORD_GENERATED);
-+
-+    while (statement.Step()) {
++    statement.BindInt64(0, ChromeTimeLowerBound(since));
++    statement.BindInt64(1, ui::PAGE_TRANSITION_CHAIN_END);
++    statement.BindInt64(2, ui::PAGE_TRANSITION_CORE_MASK);
++    statement.BindInt64(3, ui::PAGE_TRANSITION_AUTO_SUBFRAME);
++    statement.BindInt64(4, ui::PAGE_TRANSITION_MANUAL_SUBFRAME);
++    statement.BindInt64(5, ui::PAGE_TRANSITION_KEYWORD_GENERATED);
++
++    std::vector<user_data_importer::ImporterURLRow> rows;
++    rows.reserve(chunk_size);
++    bool stopped = false;
++    while (!stopped && statement.Step()) {
 +      GURL url(statement.ColumnString(0));
 +      if (!url.is_valid()) {
 +        continue;
@@ -87,12 +96,21 @@ index 0000000000000..ec7b96bb6b854
 +      row.visit_count = statement.ColumnInt(4);
 +
 +      rows.push_back(std::move(row));
++      row_count++;
++      if (rows.size() == chunk_size) {
++        stopped = !on_chunk.Run(std::move(rows));
++        rows.clear();
++        rows.reserve(chunk_size);
++      }
++    }
++    if (!stopped && !rows.empty()) {
++      on_chunk.Run(std::move(rows));
 +    }
 +  }  // statement destroyed here
 +
 +  base::DeleteFile(temp_path);
 +
-+  return rows;
++  return row_count;
 +}
 +
 +}  // namespace browseros_importer
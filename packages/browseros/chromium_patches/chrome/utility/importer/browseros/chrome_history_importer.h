@@ -1,27 +1,40 @@
 diff --git a/chrome/utility/importer/browseros/chrome_history_importer.h b/chrome/utility/importer/browseros/chrome_history_importer.h
 new file mode 100644
-index 0000000000000..3de1c03c501a9
+index 0000000000000..ede7e68b097df
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_history_importer.h
-@@ -0,0 +1,22 @@
+@@ -0,0 +1,35 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome history importer
 +
 +#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_HISTORY_IMPORTER_H_
 +#define CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_HISTORY_IMPORTER_H_
 +
++#include <stddef.h>
++
 +#include <vector>
 +
 +#include "base/files/file_path.h"
++#include "base/functional/callback.h"
++#include "base/time/time.h"
 +#include "components/user_data_importer/common/importer_url_row.h"
 +
 +namespace browseros_importer {
 +
++// Receives one chunk of history rows. Returning false stops the import.
++using HistoryChunkCallback = base::RepeatingCallback<bool(
++    std::vector<user_data_importer::ImporterURLRow> rows)>;
++
 +// Imports browsing history from Chrome's History database.
 +// |profile_path| should be the Chrome profile directory (e.g., .../Default)
-+// Returns a vector of ImporterURLRow. Returns empty vector on failure.
-+std::vector<user_data_importer::ImporterURLRow> ImportChromeHistory(
-+    const base::FilePath& profile_path);
++// Only visits after |since| are read; pass a null time for all of them.
++// Rows are handed to |on_chunk| in chunks of up to |chunk_size| as they are
++// read, so the whole history is never held in memory at once. Returns the
++// number of rows read, 0 on failure.
++size_t ImportChromeHistory(const base::FilePath& profile_path,
++                           base::Time since,
++                           size_t chunk_size,
++                           const HistoryChunkCallback& on_chunk);
 +
 +}  // namespace browseros_importer
 +
@@ -0,0 +1,33 @@
+diff --git a/chrome/utility/importer/browseros/chrome_import_metrics.h b/chrome/utility/importer/browseros/chrome_import_metrics.h
+new file mode 100644
+index 0000000000000..067258cb98dab
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_import_metrics.h
+@@ -0,0 +1,27 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome import phase timings
++
++#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_METRICS_H_
++#define CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_METRICS_H_
++
++#include <stddef.h>
++
++#include "base/time/time.h"
++
++namespace browseros_importer {
++
++// Where one data type's import spent its time in the utility process.
++// ChromeImporter fills these in; the browser reports them.
++struct ImportItemMetrics {
++  size_t rows = 0;
++  // Reading the source files and databases, including |decrypt_time|
++  base::TimeDelta read_time;
++  // Getting Chrome's key and decrypting values with it
++  base::TimeDelta decrypt_time;
++  // Handing the rows to the bridge, which serializes them into IPCs
++  base::TimeDelta deliver_time;
++};
++
++}  // namespace browseros_importer
++
++#endif  // CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_METRICS_H_
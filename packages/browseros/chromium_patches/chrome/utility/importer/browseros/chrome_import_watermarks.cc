@@ -0,0 +1,117 @@
+diff --git a/chrome/utility/importer/browseros/chrome_import_watermarks.cc b/chrome/utility/importer/browseros/chrome_import_watermarks.cc
+new file mode 100644
+index 0000000000000..b5d53bc14e7e5
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_import_watermarks.cc
+@@ -0,0 +1,111 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome import watermarks implementation
++
++#include "chrome/utility/importer/browseros/chrome_import_watermarks.h"
++
++#include <optional>
++#include <utility>
++
++#include "base/files/file_util.h"
++#include "base/files/important_file_writer.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/json/values_util.h"
++#include "base/logging.h"
++#include "base/path_service.h"
++#include "base/values.h"
++#include "chrome/common/chrome_paths.h"
++
++namespace browseros_importer {
++
++namespace {
++
++constexpr char kWatermarksFilename[] = "BrowserOS Import Watermarks";
++
++constexpr char kHistoryKey[] = "history";
++constexpr char kPasswordsKey[] = "passwords";
++constexpr char kCookiesKey[] = "cookies";
++constexpr char kBookmarksHashKey[] = "bookmarks_hash";
++
++base::FilePath GetWatermarksPath() {
++  base::FilePath user_data_dir;
++  if (!base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir)) {
++    return base::FilePath();
++  }
++  return user_data_dir.AppendASCII(kWatermarksFilename);
++}
++
++// All sources' watermarks, keyed by profile path
++base::Value::Dict ReadAllWatermarks(const base::FilePath& path) {
++  std::string contents;
++  if (path.empty() || !base::ReadFileToString(path, &contents)) {
++    return base::Value::Dict();
++  }
++  std::optional<base::Value::Dict> dict = base::JSONReader::ReadDict(contents);
++  if (!dict) {
++    LOG(WARNING) << "browseros: Ignoring unreadable import watermarks";
++    return base::Value::Dict();
++  }
++  return std::move(*dict);
++}
++
++base::Time ReadTime(const base::Value::Dict& dict, const char* key) {
++  const base::Value* value = dict.Find(key);
++  return value ? base::ValueToTime(*value).value_or(base::Time())
++               : base::Time();
++}
++
++void SetTime(base::Value::Dict& dict, const char* key, base::Time time) {
++  if (time.is_null()) {
++    dict.Remove(key);
++  } else {
++    dict.Set(key, base::TimeToValue(time));
++  }
++}
++
++}  // namespace
++
++ChromeImportWatermarks LoadChromeImportWatermarks(
++    const base::FilePath& profile_path) {
++  ChromeImportWatermarks watermarks;
++  const base::Value::Dict all = ReadAllWatermarks(GetWatermarksPath());
++  const base::Value::Dict* dict = all.FindDict(profile_path.AsUTF8Unsafe());
++  if (!dict) {
++    return watermarks;
++  }
++
++  watermarks.history = ReadTime(*dict, kHistoryKey);
++  watermarks.passwords = ReadTime(*dict, kPasswordsKey);
++  watermarks.cookies = ReadTime(*dict, kCookiesKey);
++  if (const std::string* hash = dict->FindString(kBookmarksHashKey)) {
++    watermarks.bookmarks_hash = *hash;
++  }
++  return watermarks;
++}
++
++bool SaveChromeImportWatermarks(const base::FilePath& profile_path,
++                                const ChromeImportWatermarks& watermarks) {
++  const base::FilePath path = GetWatermarksPath();
++  if (path.empty()) {
++    return false;
++  }
++
++  base::Value::Dict all = ReadAllWatermarks(path);
++  base::Value::Dict dict;
++  SetTime(dict, kHistoryKey, watermarks.history);
++  SetTime(dict, kPasswordsKey, watermarks.passwords);
++  SetTime(dict, kCookiesKey, watermarks.cookies);
++  if (!watermarks.bookmarks_hash.empty()) {
++    dict.Set(kBookmarksHashKey, watermarks.bookmarks_hash);
++  }
++  all.Set(profile_path.AsUTF8Unsafe(), std::move(dict));
++
++  std::optional<std::string> json = base::WriteJson(all);
++  if (!json || !base::ImportantFileWriter::WriteFileAtomically(path, *json)) {
++    LOG(WARNING) << "browseros: Failed to save import watermarks";
++    return false;
++  }
++  return true;
++}
++
++}  // namespace browseros_importer
@@ -0,0 +1,46 @@
+diff --git a/chrome/utility/importer/browseros/chrome_import_watermarks.h b/chrome/utility/importer/browseros/chrome_import_watermarks.h
+new file mode 100644
+index 0000000000000..f652dc4eb0a0d
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_import_watermarks.h
+@@ -0,0 +1,40 @@
++// Copyright 2024 AKW Technology Inc
++// Chrome import watermarks
++
++#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_WATERMARKS_H_
++#define CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_WATERMARKS_H_
++
++#include <string>
++
++#include "base/files/file_path.h"
++#include "base/time/time.h"
++
++namespace browseros_importer {
++
++// How far earlier imports of one Chrome profile got, so a repeat import
++// only reads what changed since. Each time is when the last read of that
++// data type that delivered something started; null if there was none.
++struct ChromeImportWatermarks {
++  base::Time history;
++  base::Time passwords;
++  base::Time cookies;
++  // HashChromeBookmarksFile() of the last imported Bookmarks file
++  std::string bookmarks_hash;
++
++  friend bool operator==(const ChromeImportWatermarks&,
++                         const ChromeImportWatermarks&) = default;
++};
++
++// Loads the watermarks recorded for the Chrome profile at |profile_path|.
++// Returns empty watermarks if there are none.
++ChromeImportWatermarks LoadChromeImportWatermarks(
++    const base::FilePath& profile_path);
++
++// Records |watermarks| for |profile_path|. They are kept in the BrowserOS
++// user data directory, keyed by source profile path.
++bool SaveChromeImportWatermarks(const base::FilePath& profile_path,
++                                const ChromeImportWatermarks& watermarks);
++
++}  // namespace browseros_importer
++
++#endif  // CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORT_WATERMARKS_H_
@@ -1,27 +1,96 @@
 diff --git a/chrome/utility/importer/browseros/chrome_importer.cc b/chrome/utility/importer/browseros/chrome_importer.cc
 new file mode 100644
-index 0000000000000..41dce65dacf4f
+index 0000000000000..03d3d6d34878a
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_importer.cc
-@@ -0,0 +1,202 @@
+@@ -0,0 +1,410 @@
 +// Copyright 2023 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/utility/importer/browseros/chrome_importer.h"
 +
++#include <memory>
++#include <utility>
++
++#include "base/functional/bind.h"
 +#include "base/logging.h"
++#include "base/synchronization/waitable_event.h"
++#include "base/task/thread_pool.h"
++#include "base/time/time.h"
++#include "base/timer/elapsed_timer.h"
 +#include "chrome/common/importer/importer_bridge.h"
 +#include "chrome/grit/generated_resources.h"
 +#include "chrome/utility/importer/browseros/chrome_autofill_importer.h"
 +#include "chrome/utility/importer/browseros/chrome_bookmarks_importer.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_decryptor.h"
 +#include "chrome/utility/importer/browseros/chrome_extensions_importer.h"
 +#include "chrome/utility/importer/browseros/chrome_history_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_metrics.h"
++#include "chrome/utility/importer/browseros/chrome_import_watermarks.h"
 +#include "chrome/utility/importer/browseros/chrome_password_importer.h"
 +#include "components/user_data_importer/common/importer_data_types.h"
 +#include "ui/base/l10n/l10n_util.h"
 +
++namespace {
++
++// One data type's reader, run on a ThreadPool worker so that the data types,
++// which live in separate databases, are read concurrently.
++template <typename T>
++class PendingRead {
++ public:
++  PendingRead(base::TaskRunner* task_runner, base::OnceCallback<T()> read) {
++    task_runner->PostTask(
++        FROM_HERE, base::BindOnce(&PendingRead::Run, base::Unretained(this),
++                                  std::move(read)));
++  }
++
++  PendingRead(const PendingRead&) = delete;
++  PendingRead& operator=(const PendingRead&) = delete;
++
++  // The read holds a pointer to this, so it can't be abandoned mid-run
++  ~PendingRead() { done_.Wait(); }
++
++  // Blocks until the read has finished.
++  T Take() {
++    done_.Wait();
++    return std::move(result_);
++  }
++
++  // How long the read itself ran, not counting time queued. Valid after
++  // Take().
++  base::TimeDelta read_time() const { return read_time_; }
++
++ private:
++  void Run(base::OnceCallback<T()> read) {
++    base::ElapsedTimer timer;
++    result_ = std::move(read).Run();
++    read_time_ = timer.Elapsed();
++    done_.Signal();
++  }
++
++  base::WaitableEvent done_;
++  T result_;
++  base::TimeDelta read_time_;
++};
++
++// History rows handed to the bridge at a time, bounding how much of a long
++// history is held in memory on either side of the import
++constexpr size_t kHistoryRowsPerChunk = 2000;
++
++template <typename T>
++std::unique_ptr<PendingRead<T>> StartReadIf(bool requested,
++                                            base::TaskRunner* task_runner,
++                                            base::OnceCallback<T()> read) {
++  if (!requested) {
++    return nullptr;
++  }
++  return std::make_unique<PendingRead<T>>(task_runner, std::move(read));
++}
++
++}  // namespace
++
 +ChromeImporter::ChromeImporter() = default;
 +
 +ChromeImporter::~ChromeImporter() = default;
@@ -35,142 +104,285 @@ index 0000000000000..41dce65dacf4f
 +
 +  bridge_->NotifyStarted();
 +
++  if (cancelled()) {
++    bridge_->NotifyEnded();
++    return;
++  }
++
++  // Start every requested reader at once, so the import takes about as long
++  // as the slowest data type. Results still reach the bridge one type at a
++  // time, in the same order as before. History, usually the largest, is
++  // streamed from this thread instead while the others are read.
++  LOG(INFO) << "browseros: Reading Chrome profile data";
++  // Repeat imports of the same profile only read what changed since the
++  // last one that delivered each data type
++  const browseros_importer::ChromeImportWatermarks old_watermarks =
++      browseros_importer::LoadChromeImportWatermarks(source_path_);
++  browseros_importer::ChromeImportWatermarks new_watermarks = old_watermarks;
++  const base::Time read_started = base::Time::Now();
++
++  std::string bookmarks_hash;
++  bool bookmarks_changed = true;
++  if (items & user_data_importer::FAVORITES) {
++    bookmarks_hash = browseros_importer::HashChromeBookmarksFile(source_path_);
++    bookmarks_changed = bookmarks_hash.empty() ||
++                        bookmarks_hash != old_watermarks.bookmarks_hash;
++  }
++
++  // Readers wait on their decryption tasks
++  scoped_refptr<base::TaskRunner> pool = base::ThreadPool::CreateTaskRunner(
++      {base::MayBlock(), base::WithBaseSyncPrimitives(),
++       base::TaskPriority::USER_VISIBLE});
++  // Passwords and cookies share one key, so the Keychain prompts only once
++  auto key_cache =
++      base::MakeRefCounted<browseros_importer::ChromeKeyCache>(source_path_);
++  // Written by the readers below, which are waited for before these go away
++  base::TimeDelta passwords_decrypt_time;
++  base::TimeDelta cookies_decrypt_time;
++
++  auto bookmarks = StartReadIf(
++      (items & user_data_importer::FAVORITES) && bookmarks_changed, pool.get(),
++      base::BindOnce(&browseros_importer::ImportChromeBookmarks, source_path_));
++  auto passwords = StartReadIf(
++      items & user_data_importer::PASSWORDS, pool.get(),
++      base::BindOnce(&browseros_importer::ImportChromePasswords, source_path_,
++                     key_cache, old_watermarks.passwords,
++                     base::Unretained(&passwords_decrypt_time)));
++  auto cookies = StartReadIf(
++      items & user_data_importer::COOKIES, pool.get(),
++      base::BindOnce(&browseros_importer::ImportChromeCookies, source_path_,
++                     key_cache, old_watermarks.cookies,
++                     base::Unretained(&cookies_decrypt_time)));
++  auto autofill = StartReadIf(
++      items & user_data_importer::AUTOFILL_FORM_DATA, pool.get(),
++      base::BindOnce(&browseros_importer::ImportChromeAutofill, source_path_));
++  auto extensions = StartReadIf(
++      items & user_data_importer::EXTENSIONS, pool.get(),
++      base::BindOnce(&browseros_importer::ImportChromeExtensions,
++                     source_path_));
++
++  std::unique_ptr<PendingRead<favicon_base::FaviconUsageDataList>> favicons;
++
 +  if ((items & user_data_importer::HISTORY) && !cancelled()) {
 +    bridge_->NotifyItemStarted(user_data_importer::HISTORY);
-+    ImportHistory();
-+    bridge_->NotifyItemEnded(user_data_importer::HISTORY);
++    browseros_importer::ImportItemMetrics metrics;
++    if (ImportHistory(old_watermarks.history, &metrics)) {
++      new_watermarks.history = read_started;
++    }
++    EndItem(user_data_importer::HISTORY, metrics);
 +  }
 +
 +  if ((items & user_data_importer::FAVORITES) && !cancelled()) {
 +    bridge_->NotifyItemStarted(user_data_importer::FAVORITES);
-+    ImportBookmarks();
-+    bridge_->NotifyItemEnded(user_data_importer::FAVORITES);
++    browseros_importer::ImportItemMetrics metrics;
++    if (!bookmarks) {
++      LOG(INFO) << "browseros: Bookmarks unchanged since the last import";
++    } else {
++      browseros_importer::ChromeBookmarksResult result = bookmarks->Take();
++      metrics.rows = result.bookmarks.size();
++      metrics.read_time = bookmarks->read_time();
++      base::ElapsedTimer deliver_timer;
++      const bool delivered = ImportBookmarks(result.bookmarks);
++      metrics.deliver_time = deliver_timer.Elapsed();
++      if (delivered) {
++        new_watermarks.bookmarks_hash = bookmarks_hash;
++        // Favicons are cosmetic, so they are read at low priority while the
++        // remaining data types go through, and delivered last
++        favicons = std::make_unique<
++            PendingRead<favicon_base::FaviconUsageDataList>>(
++            base::ThreadPool::CreateTaskRunner(
++                {base::MayBlock(), base::TaskPriority::BEST_EFFORT})
++                .get(),
++            base::BindOnce(&browseros_importer::ImportChromeBookmarkFavicons,
++                           source_path_, std::move(result.bookmarks)));
++      }
++    }
++    EndItem(user_data_importer::FAVORITES, metrics);
 +  }
 +
-+  if ((items & user_data_importer::PASSWORDS) && !cancelled()) {
++  if (passwords && !cancelled()) {
 +    bridge_->NotifyItemStarted(user_data_importer::PASSWORDS);
-+    ImportPasswords();
-+    bridge_->NotifyItemEnded(user_data_importer::PASSWORDS);
++    auto rows = passwords->Take();
++    browseros_importer::ImportItemMetrics metrics;
++    metrics.rows = rows.size();
++    metrics.read_time = passwords->read_time();
++    metrics.decrypt_time = passwords_decrypt_time;
++    base::ElapsedTimer deliver_timer;
++    if (ImportPasswords(std::move(rows))) {
++      new_watermarks.passwords = read_started;
++    }
++    metrics.deliver_time = deliver_timer.Elapsed();
++    EndItem(user_data_importer::PASSWORDS, metrics);
 +  }
 +
-+  if ((items & user_data_importer::COOKIES) && !cancelled()) {
++  if (cookies && !cancelled()) {
 +    bridge_->NotifyItemStarted(user_data_importer::COOKIES);
-+    ImportCookies();
-+    bridge_->NotifyItemEnded(user_data_importer::COOKIES);
++    auto rows = cookies->Take();
++    browseros_importer::ImportItemMetrics metrics;
++    metrics.rows = rows.size();
++    metrics.read_time = cookies->read_time();
++    metrics.decrypt_time = cookies_decrypt_time;
++    base::ElapsedTimer deliver_timer;
++    if (ImportCookies(std::move(rows))) {
++      new_watermarks.cookies = read_started;
++    }
++    metrics.deliver_time = deliver_timer.Elapsed();
++    EndItem(user_data_importer::COOKIES, metrics);
 +  }
 +
-+  if ((items & user_data_importer::AUTOFILL_FORM_DATA) && !cancelled()) {
++  if (autofill && !cancelled()) {
 +    bridge_->NotifyItemStarted(user_data_importer::AUTOFILL_FORM_DATA);
-+    ImportAutofillFormData();
-+    bridge_->NotifyItemEnded(user_data_importer::AUTOFILL_FORM_DATA);
++    auto rows = autofill->Take();
++    browseros_importer::ImportItemMetrics metrics;
++    metrics.rows = rows.size();
++    metrics.read_time = autofill->read_time();
++    base::ElapsedTimer deliver_timer;
++    ImportAutofillFormData(std::move(rows));
++    metrics.deliver_time = deliver_timer.Elapsed();
++    EndItem(user_data_importer::AUTOFILL_FORM_DATA, metrics);
 +  }
 +
-+  if ((items & user_data_importer::EXTENSIONS) && !cancelled()) {
++  if (extensions && !cancelled()) {
 +    bridge_->NotifyItemStarted(user_data_importer::EXTENSIONS);
-+    ImportExtensions();
-+    bridge_->NotifyItemEnded(user_data_importer::EXTENSIONS);
++    auto rows = extensions->Take();
++    browseros_importer::ImportItemMetrics metrics;
++    metrics.rows = rows.size();
++    metrics.read_time = extensions->read_time();
++    base::ElapsedTimer deliver_timer;
++    ImportExtensions(std::move(rows));
++    metrics.deliver_time = deliver_timer.Elapsed();
++    EndItem(user_data_importer::EXTENSIONS, metrics);
++  }
++
++  if (favicons && !cancelled()) {
++    ImportFavicons(favicons->Take());
++  }
++
++  // Types delivered before a cancellation still count as imported
++  if (new_watermarks != old_watermarks) {
++    browseros_importer::SaveChromeImportWatermarks(source_path_,
++                                                   new_watermarks);
 +  }
 +
 +  bridge_->NotifyEnded();
 +}
 +
-+void ChromeImporter::ImportHistory() {
++bool ChromeImporter::ImportHistory(
++    base::Time since,
++    browseros_importer::ImportItemMetrics* metrics) {
 +  LOG(INFO) << "browseros: Starting history import";
 +
-+  std::vector<user_data_importer::ImporterURLRow> rows =
-+      browseros_importer::ImportChromeHistory(source_path_);
++  base::ElapsedTimer timer;
++  const size_t read = browseros_importer::ImportChromeHistory(
++      source_path_, since, kHistoryRowsPerChunk,
++      base::BindRepeating(&ChromeImporter::OnHistoryChunk,
++                          base::Unretained(this), metrics));
++  // Reading and delivering take turns on this thread
++  metrics->read_time = timer.Elapsed() - metrics->deliver_time;
 +
-+  if (rows.empty()) {
++  if (read == 0) {
 +    LOG(INFO) << "browseros: No history to import";
-+    return;
++    return false;
 +  }
 +
-+  LOG(INFO) << "browseros: Importing " << rows.size() << " history items";
++  LOG(INFO) << "browseros: History import complete, " << metrics->rows
++            << " of " << read << " items imported";
++  return metrics->rows == read;
++}
 +
-+  if (!cancelled()) {
-+    bridge_->SetHistoryItems(rows,
-+                             user_data_importer::VISIT_SOURCE_CHROME_IMPORTED);
++bool ChromeImporter::OnHistoryChunk(
++    browseros_importer::ImportItemMetrics* metrics,
++    std::vector<user_data_importer::ImporterURLRow> rows) {
++  if (cancelled()) {
++    return false;
 +  }
 +
-+  LOG(INFO) << "browseros: History import complete";
++  base::ElapsedTimer deliver_timer;
++  bridge_->AddHistoryItems(rows,
++                           user_data_importer::VISIT_SOURCE_CHROME_IMPORTED);
++  metrics->deliver_time += deliver_timer.Elapsed();
++  metrics->rows += rows.size();
++  LOG(INFO) << "browseros: Imported " << metrics->rows << " history items";
++  return true;
 +}
 +
-+void ChromeImporter::ImportBookmarks() {
-+  LOG(INFO) << "browseros: Starting bookmarks import";
-+
-+  browseros_importer::ChromeBookmarksResult result =
-+      browseros_importer::ImportChromeBookmarks(source_path_);
++void ChromeImporter::EndItem(
++    user_data_importer::ImportItem item,
++    const browseros_importer::ImportItemMetrics& metrics) {
++  LOG(INFO) << "browseros: Item " << item << " done, " << metrics.rows
++            << " rows, read " << metrics.read_time.InMilliseconds()
++            << "ms (decrypt " << metrics.decrypt_time.InMilliseconds()
++            << "ms), deliver " << metrics.deliver_time.InMilliseconds()
++            << "ms";
++  bridge_->NotifyItemMetrics(item, metrics);
++  bridge_->NotifyItemEnded(item);
++}
 +
-+  if (!result.bookmarks.empty() && !cancelled()) {
-+    LOG(INFO) << "browseros: Importing " << result.bookmarks.size()
-+              << " bookmarks";
-+    bridge_->AddBookmarks(result.bookmarks,
-+                          l10n_util::GetStringUTF16(IDS_IMPORT_FROM_CHROME));
-+  } else {
++bool ChromeImporter::ImportBookmarks(
++    const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks) {
++  if (bookmarks.empty() || cancelled()) {
 +    LOG(INFO) << "browseros: No bookmarks to import";
++    return false;
 +  }
 +
-+  if (!result.favicons.empty() && !cancelled()) {
-+    LOG(INFO) << "browseros: Importing " << result.favicons.size()
-+              << " favicons";
-+    bridge_->SetFavicons(result.favicons);
-+  }
++  LOG(INFO) << "browseros: Importing " << bookmarks.size() << " bookmarks";
++  bridge_->AddBookmarkTree(bookmarks,
++                           l10n_util::GetStringUTF16(IDS_IMPORT_FROM_CHROME));
 +
 +  LOG(INFO) << "browseros: Bookmarks import complete";
++  return true;
 +}
 +
-+void ChromeImporter::ImportPasswords() {
-+  LOG(INFO) << "browseros: Starting password import";
++void ChromeImporter::ImportFavicons(
++    favicon_base::FaviconUsageDataList favicons) {
++  if (favicons.empty()) {
++    LOG(INFO) << "browseros: No bookmark favicons to import";
++    return;
++  }
 +
-+  std::vector<user_data_importer::ImportedPasswordForm> passwords =
-+      browseros_importer::ImportChromePasswords(source_path_);
++  LOG(INFO) << "browseros: Importing " << favicons.size() << " favicons";
++  bridge_->SetFavicons(favicons);
++}
 +
++bool ChromeImporter::ImportPasswords(
++    std::vector<user_data_importer::ImportedPasswordForm> passwords) {
 +  if (passwords.empty()) {
 +    LOG(INFO) << "browseros: No passwords to import";
-+    return;
++    return false;
 +  }
 +
 +  LOG(INFO) << "browseros: Importing " << passwords.size() << " passwords";
 +
-+  for (const auto& password : passwords) {
-+    if (cancelled()) {
-+      break;
-+    }
-+    bridge_->SetPasswordForm(password);
++  if (cancelled()) {
++    return false;
 +  }
++  // Sent and committed in batches; the browser side drops batches arriving
++  // after cancellation
++  bridge_->SetPasswordForms(passwords);
 +
 +  LOG(INFO) << "browseros: Password import complete";
++  return true;
 +}
 +
-+void ChromeImporter::ImportCookies() {
-+  LOG(INFO) << "browseros: Starting cookie import";
-+
-+  std::vector<browseros_importer::ImportedCookieEntry> cookies =
-+      browseros_importer::ImportChromeCookies(source_path_);
-+
++bool ChromeImporter::ImportCookies(
++    std::vector<browseros_importer::ImportedCookieEntry> cookies) {
 +  if (cookies.empty()) {
 +    LOG(INFO) << "browseros: No cookies to import";
-+    return;
++    return false;
 +  }
 +
 +  LOG(INFO) << "browseros: Importing " << cookies.size() << " cookies";
 +
-+  for (const auto& cookie : cookies) {
-+    if (cancelled()) {
-+      break;
-+    }
-+    bridge_->SetCookie(cookie);
-+  }
++  // Sent in groups rather than one message per cookie; the browser side
++  // drops groups arriving after cancellation
++  bridge_->SetCookies(cookies);
 +
 +  LOG(INFO) << "browseros: Cookie import complete";
++  return true;
 +}
 +
-+void ChromeImporter::ImportAutofillFormData() {
-+  LOG(INFO) << "browseros: Starting autofill import";
-+
-+  std::vector<ImporterAutofillFormDataEntry> entries =
-+      browseros_importer::ImportChromeAutofill(source_path_);
-+
++void ChromeImporter::ImportAutofillFormData(
++    std::vector<ImporterAutofillFormDataEntry> entries) {
 +  if (entries.empty()) {
 +    LOG(INFO) << "browseros: No autofill entries to import";
 +    return;
@@ -186,12 +398,8 @@ index 0000000000000..41dce65dacf4f
 +  LOG(INFO) << "browseros: Autofill import complete";
 +}
 +
-+void ChromeImporter::ImportExtensions() {
-+  LOG(INFO) << "browseros: Starting extensions import";
-+
-+  std::vector<std::string> extension_ids =
-+      browseros_importer::ImportChromeExtensions(source_path_);
-+
++void ChromeImporter::ImportExtensions(
++    std::vector<std::string> extension_ids) {
 +  if (extension_ids.empty()) {
 +    LOG(INFO) << "browseros: No extensions to import";
 +    return;
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_importer.h b/chrome/utility/importer/browseros/chrome_importer.h
 new file mode 100644
-index 0000000000000..da685413cee76
+index 0000000000000..e322882bfdd35
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_importer.h
-@@ -0,0 +1,45 @@
+@@ -0,0 +1,78 @@
 +// Copyright 2023 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,19 +11,35 @@ index 0000000000000..da685413cee76
 +#ifndef CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORTER_H_
 +#define CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORTER_H_
 +
++#include <stddef.h>
 +#include <stdint.h>
 +
++#include <string>
++#include <vector>
++
 +#include "base/files/file_path.h"
++#include "base/time/time.h"
++#include "chrome/common/importer/importer_autofill_form_data_entry.h"
++#include "chrome/utility/importer/browseros/chrome_bookmarks_importer.h"
++#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_metrics.h"
 +#include "chrome/utility/importer/importer.h"
++#include "components/user_data_importer/common/importer_data_types.h"
++#include "components/user_data_importer/common/importer_url_row.h"
 +
 +// ChromeImporter orchestrates importing user data from Chrome/Chromium browsers.
 +// The actual data extraction is delegated to specialized importer modules:
 +// - chrome_history_importer: browsing history
-+// - chrome_bookmarks_importer: bookmarks and favicons
++// - chrome_bookmarks_importer: bookmarks, then their favicons at low priority
 +// - chrome_password_importer: saved passwords
 +// - chrome_cookie_importer: cookies
 +// - chrome_autofill_importer: autofill form data
 +// - chrome_extensions_importer: extension IDs
++// The modules read their databases concurrently on ThreadPool workers; their
++// results are then sent to the bridge one data type at a time. Repeat
++// imports of a profile only read rows newer than the recorded
++// ChromeImportWatermarks, and skip an unchanged Bookmarks file. Each data
++// type's phase timings are sent to the browser as it ends.
 +class ChromeImporter : public Importer {
 + public:
 +  ChromeImporter();
@@ -38,12 +54,29 @@ index 0000000000000..da685413cee76
 + private:
 +  ~ChromeImporter() override;
 +
-+  void ImportBookmarks();
-+  void ImportHistory();
-+  void ImportPasswords();
-+  void ImportCookies();
-+  void ImportAutofillFormData();
-+  void ImportExtensions();
++  // Streams history after |since| to the bridge in chunks as it is read,
++  // timing it into |metrics|. Returns whether all of it was delivered.
++  bool ImportHistory(base::Time since,
++                     browseros_importer::ImportItemMetrics* metrics);
++  bool OnHistoryChunk(browseros_importer::ImportItemMetrics* metrics,
++                      std::vector<user_data_importer::ImporterURLRow> rows);
++
++  // Reports |metrics| for |item| to the bridge and ends the item.
++  void EndItem(user_data_importer::ImportItem item,
++               const browseros_importer::ImportItemMetrics& metrics);
++
++  // Send what a module read to the bridge. Those returning bool report
++  // whether anything was delivered, which moves the type's watermark.
++  bool ImportBookmarks(
++      const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks);
++  void ImportFavicons(favicon_base::FaviconUsageDataList favicons);
++  bool ImportPasswords(
++      std::vector<user_data_importer::ImportedPasswordForm> passwords);
++  bool ImportCookies(
++      std::vector<browseros_importer::ImportedCookieEntry> cookies);
++  void ImportAutofillFormData(
++      std::vector<ImporterAutofillFormDataEntry> entries);
++  void ImportExtensions(std::vector<std::string> extension_ids);
 +
 +  base::FilePath source_path_;
 +};
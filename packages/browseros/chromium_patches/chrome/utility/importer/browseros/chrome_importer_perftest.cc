@@ -0,0 +1,444 @@
+diff --git a/chrome/utility/importer/browseros/chrome_importer_perftest.cc b/chrome/utility/importer/browseros/chrome_importer_perftest.cc
+new file mode 100644
+index 0000000000000..909361166d67a
+--- /dev/null
++++ b/chrome/utility/importer/browseros/chrome_importer_perftest.cc
+@@ -0,0 +1,438 @@
++// Copyright 2025 AKW Technology Inc
++// Throughput of the Chrome profile readers and value decryption
++//
++// Each test writes a synthetic Chrome profile (History, Cookies, Login Data)
++// with the source browser's schema, encrypting cookie values and passwords
++// the way Chrome does on the platform: AES-128-CBC on macOS, AES-256-GCM on
++// Windows. Results are rows per second plus the peak resident set size of
++// the process, which only means something with one test per process
++// (--gtest_filter=<one test> --single-process-tests). The small cases run
++// with unit_tests; the full-size profiles are MANUAL_ and need
++// --run-manual. Decryption isn't implemented on Linux, so the cookie,
++// password and decryption cases are skipped there.
++
++#include <algorithm>
++#include <array>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/containers/span.h"
++#include "base/files/file_path.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/functional/bind.h"
++#include "base/rand_util.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/test/task_environment.h"
++#include "base/time/time.h"
++#include "base/timer/elapsed_timer.h"
++#include "build/build_config.h"
++#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_decryptor.h"
++#include "chrome/utility/importer/browseros/chrome_history_importer.h"
++#include "chrome/utility/importer/browseros/chrome_password_importer.h"
++#include "crypto/hash.h"
++#include "sql/database.h"
++#include "sql/statement.h"
++#include "sql/transaction.h"
++#include "testing/gtest/include/gtest/gtest.h"
++#include "testing/perf/perf_result_reporter.h"
++#include "ui/base/page_transition_types.h"
++
++#if BUILDFLAG(IS_WIN)
++#include <windows.h>
++
++#include <psapi.h>
++
++#include "crypto/aead.h"
++#else
++#include <sys/resource.h>
++
++#include "third_party/boringssl/src/include/openssl/evp.h"
++#endif
++
++namespace browseros_importer {
++
++namespace {
++
++inline constexpr sql::Database::Tag kDatabaseTag{"ChromeImporterPerfTest"};
++
++constexpr char kMetricPrefix[] = "BrowserOSImporter.";
++constexpr char kRowsPerSecond[] = "rows_per_second";
++constexpr char kPeakRss[] = "peak_rss";
++
++constexpr size_t kHistoryChunkSize = 1000;
++
++// Chrome's time format: microseconds since 1601-01-01
++int64_t ToChromeTime(base::Time time) {
++  return time.ToDeltaSinceWindowsEpoch().InMicroseconds();
++}
++
++// Peak resident set size of this process so far
++size_t GetPeakRssBytes() {
++#if BUILDFLAG(IS_WIN)
++  PROCESS_MEMORY_COUNTERS counters = {};
++  if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters,
++                              sizeof(counters))) {
++    return 0;
++  }
++  return counters.PeakWorkingSetSize;
++#else
++  struct rusage usage = {};
++  if (getrusage(RUSAGE_SELF, &usage) != 0) {
++    return 0;
++  }
++#if BUILDFLAG(IS_APPLE)
++  return static_cast<size_t>(usage.ru_maxrss);  // Bytes
++#else
++  return static_cast<size_t>(usage.ru_maxrss) * 1024;  // Kilobytes
++#endif
++#endif
++}
++
++// Key and encryption matching the platform's DecryptChromeValue()
++class ChromeEncryptor {
++ public:
++#if BUILDFLAG(IS_WIN)
++  static constexpr size_t kKeyLength = 32;
++#else
++  static constexpr size_t kKeyLength = 16;
++#endif
++
++  ChromeEncryptor() : key_(base::RandBytesAsString(kKeyLength)) {}
++
++  const std::string& key() const { return key_; }
++
++  // "v10" followed by the ciphertext of |plaintext|
++  std::string Encrypt(const std::string& plaintext) const {
++#if BUILDFLAG(IS_WIN)
++    crypto::Aead aead(crypto::Aead::AES_256_GCM);
++    aead.Init(base::as_byte_span(key_));
++    std::vector<uint8_t> nonce = base::RandBytesAsVector(aead.NonceLength());
++    std::vector<uint8_t> sealed =
++        aead.Seal(base::as_byte_span(plaintext), nonce,
++                  base::span<const uint8_t>());
++    std::string ciphertext = "v10";
++    ciphertext.append(nonce.begin(), nonce.end());
++    ciphertext.append(sealed.begin(), sealed.end());
++    return ciphertext;
++#else
++    // 16 spaces, as in os_crypt_mac.mm
++    static constexpr uint8_t kIv[16] = {' ', ' ', ' ', ' ', ' ', ' ',
++                                        ' ', ' ', ' ', ' ', ' ', ' ',
++                                        ' ', ' ', ' ', ' '};
++    bssl::ScopedEVP_CIPHER_CTX ctx;
++    std::vector<uint8_t> output(plaintext.size() + EVP_MAX_BLOCK_LENGTH);
++    int output_length = 0;
++    int final_length = 0;
++    CHECK(EVP_EncryptInit_ex(ctx.get(), EVP_aes_128_cbc(), nullptr,
++                             reinterpret_cast<const uint8_t*>(key_.data()),
++                             kIv));
++    CHECK(EVP_EncryptUpdate(ctx.get(), output.data(), &output_length,
++                            reinterpret_cast<const uint8_t*>(plaintext.data()),
++                            plaintext.size()));
++    CHECK(EVP_EncryptFinal_ex(ctx.get(), output.data() + output_length,
++                              &final_length));
++    std::string ciphertext = "v10";
++    ciphertext.append(output.begin(),
++                      output.begin() + output_length + final_length);
++    return ciphertext;
++#endif
++  }
++
++ private:
++  const std::string key_;
++};
++
++class ChromeImporterPerfTest : public testing::Test {
++ protected:
++  void SetUp() override { ASSERT_TRUE(profile_dir_.CreateUniqueTempDir()); }
++
++  const base::FilePath& profile_path() const {
++    return profile_dir_.GetPath();
++  }
++
++  // Writes a History database with |row_count| visits, one per URL
++  void WriteHistory(size_t row_count) {
++    sql::Database db(kDatabaseTag);
++    ASSERT_TRUE(db.Open(profile_path().AppendASCII("History")));
++    ASSERT_TRUE(db.Execute(
++        "CREATE TABLE urls(id INTEGER PRIMARY KEY AUTOINCREMENT, "
++        "url LONGVARCHAR, title LONGVARCHAR, visit_count INTEGER DEFAULT 0 "
++        "NOT NULL, typed_count INTEGER DEFAULT 0 NOT NULL, last_visit_time "
++        "INTEGER NOT NULL, hidden INTEGER DEFAULT 0 NOT NULL)"));
++    ASSERT_TRUE(db.Execute(
++        "CREATE TABLE visits(id INTEGER PRIMARY KEY AUTOINCREMENT, "
++        "url INTEGER NOT NULL, visit_time INTEGER NOT NULL, "
++        "from_visit INTEGER, transition INTEGER DEFAULT 0 NOT NULL)"));
++    ASSERT_TRUE(db.Execute("CREATE INDEX visits_time_index ON visits "
++                           "(visit_time)"));
++
++    sql::Transaction transaction(&db);
++    ASSERT_TRUE(transaction.Begin());
++    sql::Statement url_statement(db.GetUniqueStatement(
++        "INSERT INTO urls(id, url, title, visit_count, typed_count, "
++        "last_visit_time, hidden) VALUES (?, ?, ?, ?, ?, ?, 0)"));
++    sql::Statement visit_statement(db.GetUniqueStatement(
++        "INSERT INTO visits(url, visit_time, transition) VALUES (?, ?, ?)"));
++    const int64_t now = ToChromeTime(base::Time::Now());
++    const int64_t transition =
++        ui::PAGE_TRANSITION_LINK | ui::PAGE_TRANSITION_CHAIN_END;
++    for (size_t i = 0; i < row_count; ++i) {
++      const int64_t visit_time = now - static_cast<int64_t>(i) * 1000000;
++      const std::string index = base::NumberToString(i);
++      url_statement.BindInt64(0, i + 1);
++      url_statement.BindString(1, "https://site" +
++                                      base::NumberToString(i % 500) +
++                                      ".example.com/articles/" + index);
++      url_statement.BindString(2, "Article " + index + " - Example site");
++      url_statement.BindInt(3, 1 + i % 7);
++      url_statement.BindInt(4, i % 3);
++      url_statement.BindInt64(5, visit_time);
++      ASSERT_TRUE(url_statement.Run());
++      url_statement.Reset(/*clear_bound_vars=*/true);
++
++      visit_statement.BindInt64(0, i + 1);
++      visit_statement.BindInt64(1, visit_time);
++      visit_statement.BindInt64(2, transition);
++      ASSERT_TRUE(visit_statement.Run());
++      visit_statement.Reset(/*clear_bound_vars=*/true);
++    }
++    ASSERT_TRUE(transaction.Commit());
++  }
++
++  // Writes a version 24 Cookies database with |row_count| encrypted cookies
++  void WriteCookies(size_t row_count) {
++    sql::Database db(kDatabaseTag);
++    ASSERT_TRUE(db.Open(profile_path().AppendASCII("Cookies")));
++    ASSERT_TRUE(db.Execute(
++        "CREATE TABLE meta(key LONGVARCHAR NOT NULL UNIQUE PRIMARY KEY, "
++        "value LONGVARCHAR)"));
++    ASSERT_TRUE(db.Execute("INSERT INTO meta VALUES ('version', '24')"));
++    ASSERT_TRUE(db.Execute(
++        "CREATE TABLE cookies(creation_utc INTEGER NOT NULL, host_key TEXT "
++        "NOT NULL, top_frame_site_key TEXT NOT NULL, name TEXT NOT NULL, "
++        "value TEXT NOT NULL, encrypted_value BLOB NOT NULL, path TEXT NOT "
++        "NULL, expires_utc INTEGER NOT NULL, is_secure INTEGER NOT NULL, "
++        "is_httponly INTEGER NOT NULL, last_access_utc INTEGER NOT NULL, "
++        "has_expires INTEGER NOT NULL, is_persistent INTEGER NOT NULL, "
++        "priority INTEGER NOT NULL, samesite INTEGER NOT NULL, "
++        "source_scheme INTEGER NOT NULL, source_port INTEGER NOT NULL, "
++        "last_update_utc INTEGER NOT NULL, source_type INTEGER NOT NULL, "
++        "has_cross_site_ancestor INTEGER NOT NULL)"));
++
++    sql::Transaction transaction(&db);
++    ASSERT_TRUE(transaction.Begin());
++    sql::Statement statement(db.GetUniqueStatement(
++        "INSERT INTO cookies VALUES (?, ?, '', ?, '', ?, '/', ?, 1, 1, ?, 1, "
++        "1, 1, 0, 2, 443, ?, 0, 0)"));
++    const int64_t now = ToChromeTime(base::Time::Now());
++    const int64_t expires = ToChromeTime(base::Time::Now() + base::Days(365));
++    for (size_t i = 0; i < row_count; ++i) {
++      const std::string host =
++          ".site" + base::NumberToString(i % 2000) + ".example.com";
++      // Version 24 prepends the SHA-256 of the host to the value
++      std::array<uint8_t, crypto::hash::kSha256Size> host_hash =
++          crypto::hash::Sha256(base::as_byte_span(host));
++      std::string plaintext(host_hash.begin(), host_hash.end());
++      plaintext += "session-" + base::NumberToString(i) +
++                   "-a1b2c3d4e5f60718293a4b5c6d7e8f90";
++      const int64_t creation = now - static_cast<int64_t>(i) * 1000;
++      statement.BindInt64(0, creation);
++      statement.BindString(1, host);
++      statement.BindString(2, "cookie_" + base::NumberToString(i % 20));
++      statement.BindBlob(3, encryptor_.Encrypt(plaintext));
++      statement.BindInt64(4, expires);
++      statement.BindInt64(5, creation);
++      statement.BindInt64(6, creation);
++      ASSERT_TRUE(statement.Run());
++      statement.Reset(/*clear_bound_vars=*/true);
++    }
++    ASSERT_TRUE(transaction.Commit());
++  }
++
++  // Writes a Login Data database with |row_count| encrypted passwords
++  void WritePasswords(size_t row_count) {
++    sql::Database db(kDatabaseTag);
++    ASSERT_TRUE(db.Open(profile_path().AppendASCII("Login Data")));
++    ASSERT_TRUE(db.Execute(
++        "CREATE TABLE logins(origin_url VARCHAR NOT NULL, action_url "
++        "VARCHAR, username_element VARCHAR, username_value VARCHAR, "
++        "password_element VARCHAR, password_value BLOB, submit_element "
++        "VARCHAR, signon_realm VARCHAR NOT NULL, date_created INTEGER NOT "
++        "NULL, blacklisted_by_user INTEGER NOT NULL, scheme INTEGER NOT "
++        "NULL, password_type INTEGER, times_used INTEGER, "
++        "date_last_used INTEGER NOT NULL DEFAULT 0, "
++        "date_password_modified INTEGER NOT NULL DEFAULT 0, "
++        "id INTEGER PRIMARY KEY AUTOINCREMENT)"));
++
++    sql::Transaction transaction(&db);
++    ASSERT_TRUE(transaction.Begin());
++    sql::Statement statement(db.GetUniqueStatement(
++        "INSERT INTO logins(origin_url, action_url, username_element, "
++        "username_value, password_element, password_value, signon_realm, "
++        "date_created, blacklisted_by_user, scheme, date_password_modified) "
++        "VALUES (?, ?, 'email', ?, 'password', ?, ?, ?, 0, 0, ?)"));
++    const int64_t now = ToChromeTime(base::Time::Now());
++    for (size_t i = 0; i < row_count; ++i) {
++      const std::string index = base::NumberToString(i);
++      const std::string realm = "https://login" + index + ".example.com/";
++      const int64_t created = now - static_cast<int64_t>(i) * 1000000;
++      statement.BindString(0, realm + "signin");
++      statement.BindString(1, realm + "session");
++      statement.BindString(2, "user" + index + "@example.com");
++      statement.BindBlob(3, encryptor_.Encrypt("Pa55-word-" + index));
++      statement.BindString(4, realm);
++      statement.BindInt64(5, created);
++      statement.BindInt64(6, created);
++      ASSERT_TRUE(statement.Run());
++      statement.Reset(/*clear_bound_vars=*/true);
++    }
++    ASSERT_TRUE(transaction.Commit());
++  }
++
++  void ReportThroughput(const std::string& story,
++                        size_t row_count,
++                        base::TimeDelta elapsed) {
++    perf_test::PerfResultReporter reporter(kMetricPrefix, story);
++    reporter.RegisterImportantMetric(kRowsPerSecond, "rows/s");
++    reporter.RegisterImportantMetric(kPeakRss, "bytes");
++    reporter.AddResult(kRowsPerSecond,
++                       row_count / std::max(elapsed.InSecondsF(), 1e-6));
++    reporter.AddResult(kPeakRss, GetPeakRssBytes());
++  }
++
++  void RunHistory(const std::string& story, size_t row_count) {
++    WriteHistory(row_count);
++    size_t chunked_rows = 0;
++    base::ElapsedTimer timer;
++    const size_t rows = ImportChromeHistory(
++        profile_path(), base::Time(), kHistoryChunkSize,
++        base::BindRepeating(
++            [](size_t* total,
++               std::vector<user_data_importer::ImporterURLRow> chunk) {
++              *total += chunk.size();
++              return true;
++            },
++            &chunked_rows));
++    const base::TimeDelta elapsed = timer.Elapsed();
++    EXPECT_EQ(row_count, rows);
++    EXPECT_EQ(row_count, chunked_rows);
++    ReportThroughput(story, rows, elapsed);
++  }
++
++  void RunCookies(const std::string& story, size_t row_count) {
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++    GTEST_SKIP() << "Chrome value decryption isn't implemented on Linux";
++#else
++    WriteCookies(row_count);
++    base::TimeDelta decrypt_time;
++    base::ElapsedTimer timer;
++    std::vector<ImportedCookieEntry> cookies = ImportChromeCookies(
++        profile_path(), ChromeKeyCache::CreateForTesting(encryptor_.key()),
++        base::Time(), &decrypt_time);
++    const base::TimeDelta elapsed = timer.Elapsed();
++    ASSERT_EQ(row_count, cookies.size());
++    EXPECT_EQ(0u, cookies.front().value.rfind("session-", 0));
++    ReportThroughput(story, cookies.size(), elapsed);
++#endif
++  }
++
++  void RunPasswords(const std::string& story, size_t row_count) {
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++    GTEST_SKIP() << "Chrome value decryption isn't implemented on Linux";
++#else
++    WritePasswords(row_count);
++    base::TimeDelta decrypt_time;
++    base::ElapsedTimer timer;
++    std::vector<user_data_importer::ImportedPasswordForm> passwords =
++        ImportChromePasswords(
++            profile_path(), ChromeKeyCache::CreateForTesting(encryptor_.key()),
++            base::Time(), &decrypt_time);
++    const base::TimeDelta elapsed = timer.Elapsed();
++    EXPECT_EQ(row_count, passwords.size());
++    ReportThroughput(story, passwords.size(), elapsed);
++#endif
++  }
++
++  // DecryptChromeValue() one value at a time, one ChromeValueDecryptor over
++  // the batch, and DecryptChromeValues() on the same batch
++  void RunDecrypt(const std::string& story, size_t value_count) {
++#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
++    GTEST_SKIP() << "Chrome value decryption isn't implemented on Linux";
++#else
++    std::vector<std::string> ciphertexts;
++    ciphertexts.reserve(value_count);
++    for (size_t i = 0; i < value_count; ++i) {
++      ciphertexts.push_back(
++          encryptor_.Encrypt("value-" + base::NumberToString(i)));
++    }
++
++    base::ElapsedTimer timer;
++    size_t decrypted = 0;
++    std::string plaintext;
++    for (const std::string& ciphertext : ciphertexts) {
++      decrypted += DecryptChromeValue(ciphertext, encryptor_.key(), &plaintext);
++    }
++    ReportThroughput(story + "_serial", decrypted, timer.Elapsed());
++    EXPECT_EQ(value_count, decrypted);
++
++    timer = base::ElapsedTimer();
++    decrypted = 0;
++    ChromeValueDecryptor decryptor(encryptor_.key());
++    for (const std::string& ciphertext : ciphertexts) {
++      decrypted += decryptor.Decrypt(ciphertext, &plaintext);
++    }
++    ReportThroughput(story + "_keyed_once", decrypted, timer.Elapsed());
++    EXPECT_EQ(value_count, decrypted);
++
++    timer = base::ElapsedTimer();
++    std::vector<std::optional<std::string>> plaintexts =
++        DecryptChromeValues(ciphertexts, encryptor_.key());
++    ReportThroughput(story + "_parallel", plaintexts.size(), timer.Elapsed());
++    EXPECT_TRUE(std::ranges::all_of(
++        plaintexts, [](const auto& value) { return value.has_value(); }));
++#endif
++  }
++
++ private:
++  base::test::TaskEnvironment task_environment_;
++  base::ScopedTempDir profile_dir_;
++  const ChromeEncryptor encryptor_;
++};
++
++TEST_F(ChromeImporterPerfTest, History10k) {
++  RunHistory("history_10k", 10000);
++}
++
++TEST_F(ChromeImporterPerfTest, Cookies5k) {
++  RunCookies("cookies_5k", 5000);
++}
++
++TEST_F(ChromeImporterPerfTest, Passwords500) {
++  RunPasswords("passwords_500", 500);
++}
++
++TEST_F(ChromeImporterPerfTest, Decrypt10k) {
++  RunDecrypt("decrypt_10k", 10000);
++}
++
++TEST_F(ChromeImporterPerfTest, MANUAL_History100k) {
++  RunHistory("history_100k", 100000);
++}
++
++TEST_F(ChromeImporterPerfTest, MANUAL_Cookies50k) {
++  RunCookies("cookies_50k", 50000);
++}
++
++TEST_F(ChromeImporterPerfTest, MANUAL_Passwords5k) {
++  RunPasswords("passwords_5k", 5000);
++}
++
++TEST_F(ChromeImporterPerfTest, MANUAL_Decrypt100k) {
++  RunDecrypt("decrypt_100k", 100000);
++}
++
++}  // namespace
++
++}  // namespace browseros_importer
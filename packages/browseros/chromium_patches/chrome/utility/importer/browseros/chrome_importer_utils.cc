@@ -1,19 +1,117 @@
 diff --git a/chrome/utility/importer/browseros/chrome_importer_utils.cc b/chrome/utility/importer/browseros/chrome_importer_utils.cc
 new file mode 100644
-index 0000000000000..8b0401a695e20
+index 0000000000000..a477e09963ce2
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_importer_utils.cc
-@@ -0,0 +1,37 @@
+@@ -0,0 +1,171 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome importer shared utilities
 +
 +#include "chrome/utility/importer/browseros/chrome_importer_utils.h"
 +
++#include <string>
++
 +#include "base/files/file_util.h"
 +#include "base/logging.h"
++#include "base/strings/stringprintf.h"
++#include "base/threading/platform_thread.h"
++#include "build/build_config.h"
++#include "third_party/sqlite/sqlite3.h"
 +
 +namespace browseros_importer {
 +
++namespace {
++
++// Held in the user data directory for as long as Chrome runs
++#if BUILDFLAG(IS_WIN)
++constexpr char kProcessSingletonLockFilename[] = "lockfile";
++#else
++constexpr char kProcessSingletonLockFilename[] = "SingletonLock";
++#endif
++
++// Pages copied per backup step; the source is only locked during a step
++constexpr int kBackupPagesPerStep = 256;
++
++// Busy or locked backup steps tolerated before falling back to a file copy
++constexpr int kMaxBackupBusyRetries = 20;
++
++constexpr base::TimeDelta kBackupRetryDelay = base::Milliseconds(50);
++
++// Builds a read-only SQLite URI filename for |path| with |parameters|
++std::string ToReadOnlyUri(const base::FilePath& path,
++                          const char* parameters) {
++  std::string uri = "file:";
++  for (char c : path.AsUTF8Unsafe()) {
++    if (c == '%' || c == '?' || c == '#') {
++      base::StringAppendF(&uri, "%%%02X", static_cast<unsigned char>(c));
++#if BUILDFLAG(IS_WIN)
++    } else if (c == '\\') {
++      uri += '/';
++#endif
++    } else {
++      uri += c;
++    }
++  }
++  return uri + "?mode=ro&" + parameters;
++}
++
++bool BackupDatabase(const base::FilePath& source_path,
++                    bool source_running,
++                    const base::FilePath& dest_path) {
++  // immutable=1 skips locking and change detection entirely, which is only
++  // safe while nothing else can write to the file
++  const std::string source_uri = ToReadOnlyUri(
++      source_path, source_running ? "cache=private" : "immutable=1");
++
++  sqlite3* source = nullptr;
++  sqlite3* dest = nullptr;
++  bool success =
++      sqlite3_open_v2(source_uri.c_str(), &source,
++                      SQLITE_OPEN_READONLY | SQLITE_OPEN_URI,
++                      nullptr) == SQLITE_OK &&
++      sqlite3_open_v2(dest_path.AsUTF8Unsafe().c_str(), &dest,
++                      SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
++                      nullptr) == SQLITE_OK;
++
++  if (success) {
++    sqlite3_backup* backup = sqlite3_backup_init(dest, "main", source, "main");
++    success = backup != nullptr;
++    int busy_retries = 0;
++    while (backup) {
++      const int result = sqlite3_backup_step(backup, kBackupPagesPerStep);
++      if (result == SQLITE_DONE) {
++        break;
++      }
++      if (result == SQLITE_OK) {
++        continue;
++      }
++      if ((result == SQLITE_BUSY || result == SQLITE_LOCKED) &&
++          ++busy_retries <= kMaxBackupBusyRetries) {
++        base::PlatformThread::Sleep(kBackupRetryDelay);
++        continue;
++      }
++      success = false;
++      break;
++    }
++    if (backup && sqlite3_backup_finish(backup) != SQLITE_OK) {
++      success = false;
++    }
++  }
++
++  if (!success) {
++    LOG(WARNING) << "browseros: SQLite backup of "
++                 << source_path.BaseName().value() << " failed: "
++                 << (dest ? sqlite3_errmsg(dest) : "open failed");
++  }
++
++  // Both are safe to close even if opening failed
++  sqlite3_close(source);
++  sqlite3_close(dest);
++  return success;
++}
++
++}  // namespace
++
 +base::Time ChromeTimeToBaseTime(int64_t chrome_time) {
 +  if (chrome_time == 0) {
 +    return base::Time();
@@ -22,6 +120,13 @@ index 0000000000000..8b0401a695e20
 +      base::Microseconds(chrome_time));
 +}
 +
++int64_t ChromeTimeLowerBound(base::Time since) {
++  if (since.is_null()) {
++    return -1;
++  }
++  return since.ToDeltaSinceWindowsEpoch().InMicroseconds();
++}
++
 +base::FilePath CopyToTempFile(const base::FilePath& source_path) {
 +  base::FilePath temp_path;
 +  if (!base::CreateTemporaryFile(&temp_path)) {
@@ -40,4 +145,33 @@ index 0000000000000..8b0401a695e20
 +  return temp_path;
 +}
 +
++bool IsSourceBrowserRunning(const base::FilePath& profile_path) {
++  const base::FilePath lock_path =
++      profile_path.DirName().AppendASCII(kProcessSingletonLockFilename);
++#if BUILDFLAG(IS_WIN)
++  // Opened delete-on-close, so it only exists while Chrome runs
++  return base::PathExists(lock_path);
++#else
++  // A symlink to "hostname-pid"; PathExists() would follow it
++  return base::IsLink(lock_path);
++#endif
++}
++
++base::FilePath SnapshotDatabaseToTempFile(const base::FilePath& db_path,
++                                          bool source_running) {
++  base::FilePath temp_path;
++  if (!base::CreateTemporaryFile(&temp_path)) {
++    LOG(WARNING) << "browseros: Failed to create temp file for "
++                 << db_path.BaseName().value();
++    return base::FilePath();
++  }
++
++  if (BackupDatabase(db_path, source_running, temp_path)) {
++    return temp_path;
++  }
++
++  base::DeleteFile(temp_path);
++  return CopyToTempFile(db_path);
++}
++
 +}  // namespace browseros_importer
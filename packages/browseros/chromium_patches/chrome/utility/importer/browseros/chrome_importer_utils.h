@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_importer_utils.h b/chrome/utility/importer/browseros/chrome_importer_utils.h
 new file mode 100644
-index 0000000000000..1a144725d2e89
+index 0000000000000..f8d980e8949b2
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_importer_utils.h
-@@ -0,0 +1,23 @@
+@@ -0,0 +1,39 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome importer shared utilities
 +
@@ -19,11 +19,27 @@ index 0000000000000..1a144725d2e89
 +// to base::Time. Returns null time for zero input.
 +base::Time ChromeTimeToBaseTime(int64_t chrome_time);
 +
++// Value to bind to a "chrome_time > ?" predicate selecting rows newer than
++// |since|. Selects every row when |since| is null.
++int64_t ChromeTimeLowerBound(base::Time since);
++
 +// Copies a file to a temporary location to avoid locking issues when the
 +// source browser is running. Returns empty path on failure.
 +// Caller is responsible for deleting the temp file when done.
 +base::FilePath CopyToTempFile(const base::FilePath& source_path);
 +
++// Whether the browser owning |profile_path| holds its profile lock.
++bool IsSourceBrowserRunning(const base::FilePath& profile_path);
++
++// Takes a consistent snapshot of a source browser's SQLite database with
++// SQLite's online backup API, reading the source without locks when
++// |source_running| is false. Falls back to CopyToTempFile() when the backup
++// fails, e.g. because the running browser holds an exclusive lock. Returns
++// empty path on failure.
++// Caller is responsible for deleting the temp file when done.
++base::FilePath SnapshotDatabaseToTempFile(const base::FilePath& db_path,
++                                          bool source_running);
++
 +}  // namespace browseros_importer
 +
 +#endif  // CHROME_UTILITY_IMPORTER_BROWSEROS_CHROME_IMPORTER_UTILS_H_
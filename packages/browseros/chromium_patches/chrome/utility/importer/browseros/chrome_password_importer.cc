@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_password_importer.cc b/chrome/utility/importer/browseros/chrome_password_importer.cc
 new file mode 100644
-index 0000000000000..cbae752f359b5
+index 0000000000000..1389e94d96f08
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_password_importer.cc
-@@ -0,0 +1,151 @@
+@@ -0,0 +1,159 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome password importer implementation
 +
@@ -12,7 +12,9 @@ index 0000000000000..cbae752f359b5
 +#include "base/files/file_util.h"
 +#include "base/logging.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "base/timer/elapsed_timer.h"
 +#include "chrome/utility/importer/browseros/chrome_decryptor.h"
++#include "chrome/utility/importer/browseros/chrome_importer_utils.h"
 +#include "sql/database.h"
 +#include "sql/statement.h"
 +#include "url/gurl.h"
@@ -26,32 +28,20 @@ index 0000000000000..cbae752f359b5
 +
 +constexpr char kLoginDataFilename[] = "Login Data";
 +
-+// Copy database to temp location to avoid locking issues with Chrome
-+base::FilePath CopyDatabaseToTemp(const base::FilePath& db_path) {
-+  base::FilePath temp_path;
-+  if (!base::CreateTemporaryFile(&temp_path)) {
-+    LOG(WARNING) << "browseros: Failed to create temp file";
-+    return base::FilePath();
-+  }
-+
-+  if (!base::CopyFile(db_path, temp_path)) {
-+    LOG(WARNING) << "browseros: Failed to copy database to temp";
-+    base::DeleteFile(temp_path);
-+    return base::FilePath();
-+  }
-+
-+  return temp_path;
-+}
-+
 +}  // namespace
 +
 +std::vector<user_data_importer::ImportedPasswordForm> ImportChromePasswords(
-+    const base::FilePath& profile_path) {
++    const base::FilePath& profile_path,
++    scoped_refptr<ChromeKeyCache> key_cache,
++    base::Time since,
++    base::TimeDelta* decrypt_time) {
 +  std::vector<user_data_importer::ImportedPasswordForm> passwords;
 +
 +  // Extract encryption key
 +  KeyExtractionResult key_result;
-+  std::string encryption_key = ExtractChromeKey(profile_path, &key_result);
++  base::ElapsedTimer key_timer;
++  std::string encryption_key = key_cache->GetKey(&key_result);
++  *decrypt_time += key_timer.Elapsed();
 +
 +  if (encryption_key.empty()) {
 +    LOG(WARNING) << "browseros: Failed to extract encryption key, "
@@ -67,8 +57,9 @@ index 0000000000000..cbae752f359b5
 +    return passwords;
 +  }
 +
-+  // Copy to temp location to avoid locking issues
-+  base::FilePath temp_db_path = CopyDatabaseToTemp(login_data_path);
++  // Snapshot to a temp location to avoid locking issues
++  base::FilePath temp_db_path = SnapshotDatabaseToTempFile(
++      login_data_path, IsSourceBrowserRunning(profile_path));
 +  if (temp_db_path.empty()) {
 +    return passwords;
 +  }
@@ -87,7 +78,8 @@ index 0000000000000..cbae752f359b5
 +    const char kQuery[] =
 +        "SELECT origin_url, action_url, username_element, username_value, "
 +        "password_element, password_value, signon_realm, blacklisted_by_user, "
-+        "scheme FROM logins";
++        "scheme FROM logins "
++        "WHERE date_created > ? OR date_password_modified > ?";
 +
 +    sql::Statement statement(db.GetUniqueStatement(kQuery));
 +    if (!statement.is_valid()) {
@@ -96,6 +88,11 @@ index 0000000000000..cbae752f359b5
 +      return passwords;
 +    }
 +
++    statement.BindInt64(0, ChromeTimeLowerBound(since));
++    statement.BindInt64(1, ChromeTimeLowerBound(since));
++
++    // Rows are read first and their passwords decrypted together, in parallel
++    std::vector<std::string> encrypted_passwords;
 +    while (statement.Step()) {
 +      std::string origin_url = statement.ColumnString(0);
 +      std::string action_url = statement.ColumnString(1);
@@ -111,17 +108,6 @@ index 0000000000000..cbae752f359b5
 +      bool blacklisted = statement.ColumnBool(7);
 +      int scheme = statement.ColumnInt(8);
 +
-+      // Decrypt password
-+      std::string decrypted_password;
-+      if (!encrypted_password.empty()) {
-+        if (!DecryptChromeValue(encrypted_password, encryption_key,
-+                                &decrypted_password)) {
-+          LOG(WARNING) << "browseros: Failed to decrypt password for: "
-+                       << origin_url;
-+          continue;
-+        }
-+      }
-+
 +      // Create ImportedPasswordForm
 +      user_data_importer::ImportedPasswordForm form;
 +
@@ -138,11 +124,33 @@ index 0000000000000..cbae752f359b5
 +      form.username_element = username_element;
 +      form.username_value = username_value;
 +      form.password_element = password_element;
-+      form.password_value = base::UTF8ToUTF16(decrypted_password);
 +      form.blocked_by_user = blacklisted;
 +
 +      passwords.push_back(std::move(form));
++      encrypted_passwords.push_back(std::move(encrypted_password));
++    }
++
++    base::ElapsedTimer decrypt_timer;
++    std::vector<std::optional<std::string>> decrypted_passwords =
++        DecryptChromeValues(encrypted_passwords, encryption_key);
++    *decrypt_time += decrypt_timer.Elapsed();
++    std::vector<user_data_importer::ImportedPasswordForm> decrypted_forms;
++    decrypted_forms.reserve(passwords.size());
++    for (size_t i = 0; i < passwords.size(); ++i) {
++      // An empty password_value is kept as is (e.g. blocklisted sites)
++      if (encrypted_passwords[i].empty()) {
++        decrypted_forms.push_back(std::move(passwords[i]));
++        continue;
++      }
++      if (!decrypted_passwords[i]) {
++        LOG(WARNING) << "browseros: Failed to decrypt password for: "
++                     << passwords[i].url.spec();
++        continue;
++      }
++      passwords[i].password_value = base::UTF8ToUTF16(*decrypted_passwords[i]);
++      decrypted_forms.push_back(std::move(passwords[i]));
 +    }
++    passwords = std::move(decrypted_forms);
 +  }  // statement destroyed here
 +
 +  db.Close();
@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/browseros/chrome_password_importer.h b/chrome/utility/importer/browseros/chrome_password_importer.h
 new file mode 100644
-index 0000000000000..e0cb4ec631e39
+index 0000000000000..3e1728d7ef213
 --- /dev/null
 +++ b/chrome/utility/importer/browseros/chrome_password_importer.h
-@@ -0,0 +1,23 @@
+@@ -0,0 +1,34 @@
 +// Copyright 2024 AKW Technology Inc
 +// Chrome password importer interface
 +
@@ -13,16 +13,27 @@ index 0000000000000..e0cb4ec631e39
 +#include <vector>
 +
 +#include "base/files/file_path.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/time/time.h"
 +#include "components/user_data_importer/common/importer_data_types.h"
 +
 +namespace browseros_importer {
 +
++class ChromeKeyCache;
++
 +// Import passwords from Chrome's Login Data database.
 +// |profile_path| should be the Chrome profile directory (e.g., .../Default)
++// |key_cache| provides Chrome's encryption key for the import session.
++// Only logins created or changed after |since| are read; pass a null time
++// for all of them. Time spent getting the key and decrypting is added to
++// |decrypt_time|.
 +// Returns a vector of ImportedPasswordForm structs.
 +// On failure, returns an empty vector.
 +std::vector<user_data_importer::ImportedPasswordForm> ImportChromePasswords(
-+    const base::FilePath& profile_path);
++    const base::FilePath& profile_path,
++    scoped_refptr<ChromeKeyCache> key_cache,
++    base::Time since,
++    base::TimeDelta* decrypt_time);
 +
 +}  // namespace browseros_importer
 +
@@ -2,23 +2,38 @@ diff --git a/chrome/utility/importer/external_process_importer_bridge.cc b/chrom
 index 67092331c3801..df9cfc2576fd8 100644
 --- a/chrome/utility/importer/external_process_importer_bridge.cc
 +++ b/chrome/utility/importer/external_process_importer_bridge.cc
-@@ -15,8 +15,11 @@
+@@ -15,8 +15,12 @@
  #include "base/task/task_runner.h"
  #include "build/build_config.h"
  #include "chrome/common/importer/importer_autofill_form_data_entry.h"
 +#include "chrome/common/importer/profile_import.mojom.h"
 +#include "chrome/utility/importer/browseros/chrome_cookie_importer.h"
++#include "chrome/utility/importer/browseros/chrome_import_metrics.h"
  #include "components/user_data_importer/common/imported_bookmark_entry.h"
  #include "components/user_data_importer/common/importer_data_types.h"
 +#include "net/cookies/cookie_constants.h"
  
  namespace {
  
-@@ -113,6 +116,79 @@ void ExternalProcessImporterBridge::SetPasswordForm(
+@@ -113,6 +117,162 @@ void ExternalProcessImporterBridge::SetPasswordForm(
    observer_->OnPasswordFormImportReady(form);
  }
  
-+void ExternalProcessImporterBridge::SetCookie(
++namespace {
++
++// Password forms per OnPasswordFormsImportGroup() message; each group is
++// committed to the password store in one transaction.
++constexpr size_t kNumPasswordFormsToSend = 500;
++
++// Bookmarks per OnBookmarkTreeImportGroup() message. The browser collects
++// all of them before writing, so this only bounds the message size.
++constexpr size_t kNumBookmarkTreeEntriesToSend = 500;
++
++// Cookies per OnCookiesImportGroup() message; like the other chunked imports,
++// this keeps a large profile from producing an oversized IPC message.
++constexpr size_t kNumCookiesToSend = 500;
++
++chrome::mojom::ImportedCookieEntryPtr ConvertToMojoCookie(
 +    const browseros_importer::ImportedCookieEntry& cookie) {
 +  auto mojo_cookie = chrome::mojom::ImportedCookieEntry::New();
 +  mojo_cookie->host_key = cookie.host_key;
@@ -87,14 +102,83 @@ index 67092331c3801..df9cfc2576fd8 100644
 +
 +  mojo_cookie->source_port = cookie.source_port;
 +  mojo_cookie->is_persistent = cookie.is_persistent;
++  return mojo_cookie;
++}
++
++}  // namespace
 +
-+  observer_->OnCookieImportReady(std::move(mojo_cookie));
++void ExternalProcessImporterBridge::SetPasswordForms(
++    const std::vector<user_data_importer::ImportedPasswordForm>& forms) {
++  std::vector<user_data_importer::ImportedPasswordForm> group;
++  for (const auto& form : forms) {
++    group.push_back(form);
++    if (group.size() == kNumPasswordFormsToSend) {
++      observer_->OnPasswordFormsImportGroup(group);
++      group.clear();
++    }
++  }
++  if (!group.empty()) {
++    observer_->OnPasswordFormsImportGroup(group);
++  }
++}
++
++void ExternalProcessImporterBridge::AddHistoryItems(
++    const std::vector<user_data_importer::ImporterURLRow>& rows,
++    user_data_importer::VisitSource visit_source) {
++  std::vector<user_data_importer::ImporterURLRow> group;
++  for (const auto& row : rows) {
++    group.push_back(row);
++    if (group.size() == static_cast<size_t>(kNumHistoryRowsToSend)) {
++      observer_->OnHistoryImportChunk(group, visit_source);
++      group.clear();
++    }
++  }
++  if (!group.empty()) {
++    observer_->OnHistoryImportChunk(group, visit_source);
++  }
++}
++
++void ExternalProcessImporterBridge::AddBookmarkTree(
++    const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks,
++    const std::u16string& first_folder_name) {
++  observer_->OnBookmarkTreeImportStart(first_folder_name, bookmarks.size());
++  std::vector<user_data_importer::ImportedBookmarkEntry> group;
++  for (const auto& bookmark : bookmarks) {
++    group.push_back(bookmark);
++    if (group.size() == kNumBookmarkTreeEntriesToSend) {
++      observer_->OnBookmarkTreeImportGroup(group);
++      group.clear();
++    }
++  }
++  if (!group.empty()) {
++    observer_->OnBookmarkTreeImportGroup(group);
++  }
++}
++
++void ExternalProcessImporterBridge::SetCookie(
++    const browseros_importer::ImportedCookieEntry& cookie) {
++  observer_->OnCookieImportReady(ConvertToMojoCookie(cookie));
++}
++
++void ExternalProcessImporterBridge::SetCookies(
++    const std::vector<browseros_importer::ImportedCookieEntry>& cookies) {
++  std::vector<chrome::mojom::ImportedCookieEntryPtr> group;
++  for (const auto& cookie : cookies) {
++    group.push_back(ConvertToMojoCookie(cookie));
++    if (group.size() == kNumCookiesToSend) {
++      observer_->OnCookiesImportGroup(std::move(group));
++      group.clear();
++    }
++  }
++  if (!group.empty()) {
++    observer_->OnCookiesImportGroup(std::move(group));
++  }
 +}
 +
  void ExternalProcessImporterBridge::SetAutofillFormData(
      const std::vector<ImporterAutofillFormDataEntry>& entries) {
    observer_->OnAutofillFormDataImportStart(entries.size());
-@@ -135,6 +211,13 @@ void ExternalProcessImporterBridge::SetAutofillFormData(
+@@ -135,6 +295,22 @@ void ExternalProcessImporterBridge::SetAutofillFormData(
    DCHECK_EQ(0, autofill_form_data_entries_left);
  }
  
@@ -104,6 +188,15 @@ index 67092331c3801..df9cfc2576fd8 100644
 +  // we'll just pass this information through
 +  observer_->OnExtensionsImportReady(extension_ids);
 +}
++
++void ExternalProcessImporterBridge::NotifyItemMetrics(
++    user_data_importer::ImportItem item,
++    const browseros_importer::ImportItemMetrics& metrics) {
++  observer_->OnImportItemMetrics(
++      item, static_cast<uint32_t>(metrics.rows),
++      metrics.read_time.InMicroseconds(), metrics.decrypt_time.InMicroseconds(),
++      metrics.deliver_time.InMicroseconds());
++}
 +
  void ExternalProcessImporterBridge::NotifyStarted() {
    observer_->OnImportStart();
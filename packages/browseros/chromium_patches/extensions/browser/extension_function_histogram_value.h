@@ -2,7 +2,7 @@ diff --git a/extensions/browser/extension_function_histogram_value.h b/extension
 index 6d9bd29ae220f..f84c951ebeacb 100644
 --- a/extensions/browser/extension_function_histogram_value.h
 +++ b/extensions/browser/extension_function_histogram_value.h
-@@ -2011,6 +2011,31 @@ enum HistogramValue {
+@@ -2011,6 +2011,67 @@ enum HistogramValue {
    DEVELOPERPRIVATE_SHOWSITESETTINGS = 1948,
    ACCESSIBILITY_PRIVATE_PROCESSPENDINGSPOKENFEEDBACKEVENT = 1949,
    ACCESSIBILITY_PRIVATE_ENABLESPOKENFEEDBACKMV3KEYHANDLING = 1950,
@@ -31,6 +31,42 @@ index 6d9bd29ae220f..f84c951ebeacb 100644
 +  SIDEPANEL_BROWSEROSISOPEN = 1973,
 +  BROWSER_OS_GETBROWSEROSVERSIONNUMBER = 1974,
 +  BROWSER_OS_CHOOSEPATH = 1975,
++  BROWSER_OS_GETINTERACTIVESNAPSHOTSTREAM = 1976,
++  BROWSER_OS_EXECUTEACTIONS = 1977,
++  BROWSER_OS_CAPTURESCREENSHOTBINARY = 1978,
++  BROWSER_OS_STARTSCREENCAST = 1979,
++  BROWSER_OS_STOPSCREENCAST = 1980,
++  BROWSER_OS_ACKSCREENCASTFRAME = 1981,
++  BROWSER_OS_GETINTERACTIVESNAPSHOTS = 1982,
++  BROWSER_OS_WAITFORLOADSTATE = 1983,
++  BROWSER_OS_FINDNODES = 1984,
++  BROWSER_OS_WAITFORNODE = 1985,
++  BROWSER_OS_DISPATCHINPUT = 1986,
++  BROWSER_OS_SETBACKGROUNDRENDERING = 1987,
++  BROWSER_OS_ACQUIRETAB = 1988,
++  BROWSER_OS_RELEASETAB = 1989,
++  BROWSER_OS_SETPREFS = 1990,
++  SIDEPANEL_BROWSEROSTOGGLETABS = 1991,
++  SIDEPANEL_BROWSEROSISOPENTABS = 1992,
++  BROWSER_OS_DIFFSNAPSHOTS = 1993,
++  BROWSER_OS_CANCELREQUEST = 1994,
++  BROWSER_OS_SETTABPRIORITY = 1995,
++  BROWSER_OS_GETNODESTATE = 1996,
++  BROWSER_OS_SETINPUTFILES = 1997,
++  BROWSER_OS_DOWNLOAD = 1998,
++  BROWSER_OS_SETAUTOMATIONTAB = 1999,
++  BROWSER_OS_GETTABRESOURCEUSAGE = 2000,
++  BROWSER_OS_STARTAUDIOCAPTURE = 2001,
++  BROWSER_OS_STOPAUDIOCAPTURE = 2002,
++  BROWSER_OS_STARTACTIONRECORDING = 2003,
++  BROWSER_OS_STOPACTIONRECORDING = 2004,
++  BROWSER_OS_SAVEACTIONSCRIPT = 2005,
++  BROWSER_OS_GETACTIONSCRIPTS = 2006,
++  BROWSER_OS_DELETEACTIONSCRIPT = 2007,
++  BROWSER_OS_RUNACTIONSCRIPT = 2008,
++  BROWSER_OS_CAPTUREPAGESTATE = 2009,
++  BROWSER_OS_STARTACCESSIBILITYSTREAM = 2010,
++  BROWSER_OS_STOPACCESSIBILITYSTREAM = 2011,
    // Last entry: Add new entries above, then run:
    // tools/metrics/histograms/update_extension_histograms.py
    ENUM_BOUNDARY